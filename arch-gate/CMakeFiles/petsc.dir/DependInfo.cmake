@@ -0,0 +1,847 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/dm/dt/dualspace/impls/lagrange/dspacelagrange.c" "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/lagrange/dspacelagrange.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/lagrange/dspacelagrange.c.o.d"
+  "/root/repo/src/dm/dt/dualspace/impls/simple/dspacesimple.c" "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/simple/dspacesimple.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/simple/dspacesimple.c.o.d"
+  "/root/repo/src/dm/dt/dualspace/interface/dualspace.c" "CMakeFiles/petsc.dir/src/dm/dt/dualspace/interface/dualspace.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/dualspace/interface/dualspace.c.o.d"
+  "/root/repo/src/dm/dt/fe/impls/basic/febasic.c" "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/basic/febasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/basic/febasic.c.o.d"
+  "/root/repo/src/dm/dt/fe/impls/composite/fecomposite.c" "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/composite/fecomposite.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/composite/fecomposite.c.o.d"
+  "/root/repo/src/dm/dt/fe/interface/fe.c" "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fe.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fe.c.o.d"
+  "/root/repo/src/dm/dt/fe/interface/fegeom.c" "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fegeom.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fegeom.c.o.d"
+  "/root/repo/src/dm/dt/interface/dt.c" "CMakeFiles/petsc.dir/src/dm/dt/interface/dt.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/interface/dt.c.o.d"
+  "/root/repo/src/dm/dt/interface/dtds.c" "CMakeFiles/petsc.dir/src/dm/dt/interface/dtds.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/interface/dtds.c.o.d"
+  "/root/repo/src/dm/dt/interface/dtfv.c" "CMakeFiles/petsc.dir/src/dm/dt/interface/dtfv.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/interface/dtfv.c.o.d"
+  "/root/repo/src/dm/dt/space/impls/point/spacepoint.c" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/point/spacepoint.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/point/spacepoint.c.o.d"
+  "/root/repo/src/dm/dt/space/impls/poly/spacepoly.c" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/poly/spacepoly.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/poly/spacepoly.c.o.d"
+  "/root/repo/src/dm/dt/space/impls/subspace/spacesubspace.c" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/subspace/spacesubspace.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/subspace/spacesubspace.c.o.d"
+  "/root/repo/src/dm/dt/space/impls/tensor/spacetensor.c" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/tensor/spacetensor.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/space/impls/tensor/spacetensor.c.o.d"
+  "/root/repo/src/dm/dt/space/interface/space.c" "CMakeFiles/petsc.dir/src/dm/dt/space/interface/space.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/dt/space/interface/space.c.o.d"
+  "/root/repo/src/dm/field/impls/da/dmfieldda.c" "CMakeFiles/petsc.dir/src/dm/field/impls/da/dmfieldda.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/field/impls/da/dmfieldda.c.o.d"
+  "/root/repo/src/dm/field/impls/ds/dmfieldds.c" "CMakeFiles/petsc.dir/src/dm/field/impls/ds/dmfieldds.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/field/impls/ds/dmfieldds.c.o.d"
+  "/root/repo/src/dm/field/impls/shell/dmfieldshell.c" "CMakeFiles/petsc.dir/src/dm/field/impls/shell/dmfieldshell.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/field/impls/shell/dmfieldshell.c.o.d"
+  "/root/repo/src/dm/field/interface/dlregisdmfield.c" "CMakeFiles/petsc.dir/src/dm/field/interface/dlregisdmfield.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/field/interface/dlregisdmfield.c.o.d"
+  "/root/repo/src/dm/field/interface/dmfield.c" "CMakeFiles/petsc.dir/src/dm/field/interface/dmfield.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/field/interface/dmfield.c.o.d"
+  "/root/repo/src/dm/field/interface/dmfieldregi.c" "CMakeFiles/petsc.dir/src/dm/field/interface/dmfieldregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/field/interface/dmfieldregi.c.o.d"
+  "/root/repo/src/dm/impls/composite/pack.c" "CMakeFiles/petsc.dir/src/dm/impls/composite/pack.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/composite/pack.c.o.d"
+  "/root/repo/src/dm/impls/composite/packm.c" "CMakeFiles/petsc.dir/src/dm/impls/composite/packm.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/composite/packm.c.o.d"
+  "/root/repo/src/dm/impls/da/da.c" "CMakeFiles/petsc.dir/src/dm/impls/da/da.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/da.c.o.d"
+  "/root/repo/src/dm/impls/da/da1.c" "CMakeFiles/petsc.dir/src/dm/impls/da/da1.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/da1.c.o.d"
+  "/root/repo/src/dm/impls/da/da2.c" "CMakeFiles/petsc.dir/src/dm/impls/da/da2.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/da2.c.o.d"
+  "/root/repo/src/dm/impls/da/da3.c" "CMakeFiles/petsc.dir/src/dm/impls/da/da3.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/da3.c.o.d"
+  "/root/repo/src/dm/impls/da/dacorn.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dacorn.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dacorn.c.o.d"
+  "/root/repo/src/dm/impls/da/dacreate.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dacreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dacreate.c.o.d"
+  "/root/repo/src/dm/impls/da/dadd.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dadd.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dadd.c.o.d"
+  "/root/repo/src/dm/impls/da/dadestroy.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dadestroy.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dadestroy.c.o.d"
+  "/root/repo/src/dm/impls/da/dadist.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dadist.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dadist.c.o.d"
+  "/root/repo/src/dm/impls/da/dageometry.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dageometry.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dageometry.c.o.d"
+  "/root/repo/src/dm/impls/da/dagetarray.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dagetarray.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dagetarray.c.o.d"
+  "/root/repo/src/dm/impls/da/dagetelem.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dagetelem.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dagetelem.c.o.d"
+  "/root/repo/src/dm/impls/da/daghost.c" "CMakeFiles/petsc.dir/src/dm/impls/da/daghost.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/daghost.c.o.d"
+  "/root/repo/src/dm/impls/da/dagtol.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dagtol.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dagtol.c.o.d"
+  "/root/repo/src/dm/impls/da/dagtona.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dagtona.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dagtona.c.o.d"
+  "/root/repo/src/dm/impls/da/daindex.c" "CMakeFiles/petsc.dir/src/dm/impls/da/daindex.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/daindex.c.o.d"
+  "/root/repo/src/dm/impls/da/dainterp.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dainterp.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dainterp.c.o.d"
+  "/root/repo/src/dm/impls/da/dalocal.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dalocal.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dalocal.c.o.d"
+  "/root/repo/src/dm/impls/da/daltol.c" "CMakeFiles/petsc.dir/src/dm/impls/da/daltol.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/daltol.c.o.d"
+  "/root/repo/src/dm/impls/da/dapf.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dapf.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dapf.c.o.d"
+  "/root/repo/src/dm/impls/da/dapreallocate.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dapreallocate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dapreallocate.c.o.d"
+  "/root/repo/src/dm/impls/da/dareg.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dareg.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dareg.c.o.d"
+  "/root/repo/src/dm/impls/da/dascatter.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dascatter.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dascatter.c.o.d"
+  "/root/repo/src/dm/impls/da/dasub.c" "CMakeFiles/petsc.dir/src/dm/impls/da/dasub.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/dasub.c.o.d"
+  "/root/repo/src/dm/impls/da/daview.c" "CMakeFiles/petsc.dir/src/dm/impls/da/daview.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/daview.c.o.d"
+  "/root/repo/src/dm/impls/da/fdda.c" "CMakeFiles/petsc.dir/src/dm/impls/da/fdda.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/fdda.c.o.d"
+  "/root/repo/src/dm/impls/da/gr1.c" "CMakeFiles/petsc.dir/src/dm/impls/da/gr1.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/gr1.c.o.d"
+  "/root/repo/src/dm/impls/da/gr2.c" "CMakeFiles/petsc.dir/src/dm/impls/da/gr2.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/gr2.c.o.d"
+  "/root/repo/src/dm/impls/da/grglvis.c" "CMakeFiles/petsc.dir/src/dm/impls/da/grglvis.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/grglvis.c.o.d"
+  "/root/repo/src/dm/impls/da/grvtk.c" "CMakeFiles/petsc.dir/src/dm/impls/da/grvtk.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/da/grvtk.c.o.d"
+  "/root/repo/src/dm/impls/forest/forest.c" "CMakeFiles/petsc.dir/src/dm/impls/forest/forest.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/forest/forest.c.o.d"
+  "/root/repo/src/dm/impls/network/network.c" "CMakeFiles/petsc.dir/src/dm/impls/network/network.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/network/network.c.o.d"
+  "/root/repo/src/dm/impls/network/networkcreate.c" "CMakeFiles/petsc.dir/src/dm/impls/network/networkcreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/network/networkcreate.c.o.d"
+  "/root/repo/src/dm/impls/network/networkmonitor.c" "CMakeFiles/petsc.dir/src/dm/impls/network/networkmonitor.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/network/networkmonitor.c.o.d"
+  "/root/repo/src/dm/impls/patch/patch.c" "CMakeFiles/petsc.dir/src/dm/impls/patch/patch.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/patch/patch.c.o.d"
+  "/root/repo/src/dm/impls/patch/patchcreate.c" "CMakeFiles/petsc.dir/src/dm/impls/patch/patchcreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/patch/patchcreate.c.o.d"
+  "/root/repo/src/dm/impls/plex/glexg.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/glexg.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/glexg.c.o.d"
+  "/root/repo/src/dm/impls/plex/petscpartmatpart.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/petscpartmatpart.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/petscpartmatpart.c.o.d"
+  "/root/repo/src/dm/impls/plex/plex.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plex.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plex.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexadapt.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexadapt.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexadapt.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexcgns.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcgns.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcgns.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexcheckinterface.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcheckinterface.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcheckinterface.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexcoarsen.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcoarsen.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcoarsen.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexcreate.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcreate.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexdistribute.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexdistribute.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexdistribute.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexexodusii.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexexodusii.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexexodusii.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexfem.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfem.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfem.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexfluent.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfluent.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfluent.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexfvm.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfvm.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfvm.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexgenerate.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgenerate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgenerate.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexgeometry.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgeometry.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgeometry.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexglvis.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexglvis.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexglvis.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexgmsh.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgmsh.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgmsh.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexhdf5.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexhdf5xdmf.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5xdmf.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5xdmf.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexindices.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexindices.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexindices.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexinterpolate.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexinterpolate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexinterpolate.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexmed.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexmed.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexmed.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexnatural.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexnatural.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexnatural.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexorient.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexorient.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexorient.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexpartition.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpartition.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpartition.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexply.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexply.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexply.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexpoint.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpoint.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpoint.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexpreallocate.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpreallocate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpreallocate.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexproject.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexproject.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexproject.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexrefine.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexrefine.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexrefine.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexreorder.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexreorder.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexreorder.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexsection.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsection.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsection.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexsubmesh.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsubmesh.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsubmesh.c.o.d"
+  "/root/repo/src/dm/impls/plex/plextree.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plextree.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plextree.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexvtk.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtk.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtk.c.o.d"
+  "/root/repo/src/dm/impls/plex/plexvtu.c" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtu.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtu.c.o.d"
+  "/root/repo/src/dm/impls/product/product.c" "CMakeFiles/petsc.dir/src/dm/impls/product/product.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/product/product.c.o.d"
+  "/root/repo/src/dm/impls/product/productutils.c" "CMakeFiles/petsc.dir/src/dm/impls/product/productutils.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/product/productutils.c.o.d"
+  "/root/repo/src/dm/impls/redundant/dmredundant.c" "CMakeFiles/petsc.dir/src/dm/impls/redundant/dmredundant.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/redundant/dmredundant.c.o.d"
+  "/root/repo/src/dm/impls/shell/dmshell.c" "CMakeFiles/petsc.dir/src/dm/impls/shell/dmshell.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/shell/dmshell.c.o.d"
+  "/root/repo/src/dm/impls/sliced/sliced.c" "CMakeFiles/petsc.dir/src/dm/impls/sliced/sliced.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/sliced/sliced.c.o.d"
+  "/root/repo/src/dm/impls/stag/stag.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag.c.o.d"
+  "/root/repo/src/dm/impls/stag/stag1d.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag1d.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag1d.c.o.d"
+  "/root/repo/src/dm/impls/stag/stag2d.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag2d.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag2d.c.o.d"
+  "/root/repo/src/dm/impls/stag/stag3d.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag3d.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stag3d.c.o.d"
+  "/root/repo/src/dm/impls/stag/stagda.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stagda.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stagda.c.o.d"
+  "/root/repo/src/dm/impls/stag/stagstencil.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stagstencil.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stagstencil.c.o.d"
+  "/root/repo/src/dm/impls/stag/stagutils.c" "CMakeFiles/petsc.dir/src/dm/impls/stag/stagutils.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/stag/stagutils.c.o.d"
+  "/root/repo/src/dm/impls/swarm/data_bucket.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_bucket.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_bucket.c.o.d"
+  "/root/repo/src/dm/impls/swarm/data_ex.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_ex.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_ex.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarm.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarm_migrate.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm_migrate.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm_migrate.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarmpic.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarmpic_da.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_da.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_da.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarmpic_plex.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_plex.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_plex.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarmpic_sort.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_sort.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_sort.c.o.d"
+  "/root/repo/src/dm/impls/swarm/swarmpic_view.c" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_view.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_view.c.o.d"
+  "/root/repo/src/dm/interface/dlregisdmdm.c" "CMakeFiles/petsc.dir/src/dm/interface/dlregisdmdm.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/interface/dlregisdmdm.c.o.d"
+  "/root/repo/src/dm/interface/dm.c" "CMakeFiles/petsc.dir/src/dm/interface/dm.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/interface/dm.c.o.d"
+  "/root/repo/src/dm/interface/dmget.c" "CMakeFiles/petsc.dir/src/dm/interface/dmget.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/interface/dmget.c.o.d"
+  "/root/repo/src/dm/interface/dmglvis.c" "CMakeFiles/petsc.dir/src/dm/interface/dmglvis.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/interface/dmglvis.c.o.d"
+  "/root/repo/src/dm/interface/dmi.c" "CMakeFiles/petsc.dir/src/dm/interface/dmi.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/interface/dmi.c.o.d"
+  "/root/repo/src/dm/interface/dmregall.c" "CMakeFiles/petsc.dir/src/dm/interface/dmregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/interface/dmregall.c.o.d"
+  "/root/repo/src/dm/label/dmlabel.c" "CMakeFiles/petsc.dir/src/dm/label/dmlabel.c.o" "gcc" "CMakeFiles/petsc.dir/src/dm/label/dmlabel.c.o.d"
+  "/root/repo/src/ksp/ksp/guess/impls/fischer/fischer.c" "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/fischer/fischer.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/fischer/fischer.c.o.d"
+  "/root/repo/src/ksp/ksp/guess/impls/pod/pod.c" "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/pod/pod.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/pod/pod.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/bcgs/bcgs.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/bcgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/bcgs.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/bcgs/fbcgs/fbcgs.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgs/fbcgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgs/fbcgs.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/bcgs/fbcgsr/fbcgsr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgsr/fbcgsr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgsr/fbcgsr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/bcgs/pipebcgs/pipebcgs.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/pipebcgs/pipebcgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/pipebcgs/pipebcgs.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/bcgsl/bcgsl.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgsl/bcgsl.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgsl/bcgsl.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/bicg/bicg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bicg/bicg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bicg/bicg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/cg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/cgeig.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgeig.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgeig.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/cgls.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgls.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgls.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/cgne/cgne.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgne/cgne.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgne/cgne.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/cgtype.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgtype.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgtype.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/gltr/gltr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/gltr/gltr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/gltr/gltr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/groppcg/groppcg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/groppcg/groppcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/groppcg/groppcg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/nash/nash.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/nash/nash.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/nash/nash.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/pipecg/pipecg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecg/pipecg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecg/pipecg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/pipecgrr/pipecgrr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecgrr/pipecgrr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecgrr/pipecgrr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/pipelcg/pipelcg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipelcg/pipelcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipelcg/pipelcg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cg/stcg/stcg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/stcg/stcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/stcg/stcg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cgs/cgs.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cgs/cgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cgs/cgs.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cheby/cheby.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cheby/cheby.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cheby/cheby.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cr/cr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/cr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/cr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/cr/pipecr/pipecr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/pipecr/pipecr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/pipecr/pipecr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/fcg/fcg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/fcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/fcg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/fcg/pipefcg/pipefcg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/pipefcg/pipefcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/pipefcg/pipefcg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/fetidp/fetidp.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fetidp/fetidp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fetidp/fetidp.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gcr/gcr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/gcr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/gcr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gcr/pipegcr/pipegcr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/pipegcr/pipegcr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/pipegcr/pipegcr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/agmres/agmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/agmres/agmresdeflation.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresdeflation.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresdeflation.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/agmres/agmresleja.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresleja.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresleja.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/agmres/agmresorthog.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresorthog.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresorthog.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/borthog.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/borthog2.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog2.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog2.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/dgmres/dgmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/dgmres/dgmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/dgmres/dgmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/fgmres/fgmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/fgmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/fgmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/fgmres/modpcf.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/modpcf.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/modpcf.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/gmpre.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmpre.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmpre.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/gmreig.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmreig.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmreig.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/gmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/gmres2.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres2.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres2.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/lgmres/lgmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/lgmres/lgmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/lgmres/lgmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/pgmres/pgmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pgmres/pgmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pgmres/pgmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/gmres/pipefgmres/pipefgmres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pipefgmres/pipefgmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pipefgmres/pipefgmres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/ibcgs/ibcgs.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/ibcgs/ibcgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/ibcgs/ibcgs.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/lcd/lcd.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lcd/lcd.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lcd/lcd.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/lsqr/lsqr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lsqr/lsqr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lsqr/lsqr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/minres/minres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/minres/minres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/minres/minres.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/preonly/preonly.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/preonly/preonly.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/preonly/preonly.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/python/pythonksp.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/python/pythonksp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/python/pythonksp.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/qcg/qcg.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/qcg/qcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/qcg/qcg.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/rich/rich.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/rich.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/rich.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/rich/richscale.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/richscale.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/richscale.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/symmlq/symmlq.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/symmlq/symmlq.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/symmlq/symmlq.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/tcqmr/tcqmr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tcqmr/tcqmr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tcqmr/tcqmr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/tfqmr/tfqmr.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tfqmr/tfqmr.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tfqmr/tfqmr.c.o.d"
+  "/root/repo/src/ksp/ksp/impls/tsirm/tsirm.c" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tsirm/tsirm.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tsirm/tsirm.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/dlregisksp.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dlregisksp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dlregisksp.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/dmksp.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dmksp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dmksp.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/eige.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/eige.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/eige.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/iguess.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iguess.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iguess.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/itcl.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcl.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcl.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/itcreate.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcreate.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/iterativ.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iterativ.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iterativ.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/itfunc.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itfunc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itfunc.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/itregis.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itregis.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/itres.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itres.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itres.c.o.d"
+  "/root/repo/src/ksp/ksp/interface/xmon.c" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/xmon.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/interface/xmon.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/dmproject.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/dmproject.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/dmproject.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/kspmatregi.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/kspmatregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/kspmatregi.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/badbrdn/badbrdn.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/badbrdn/badbrdn.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/badbrdn/badbrdn.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/bfgs/bfgs.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/bfgs/bfgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/bfgs/bfgs.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/brdn/brdn.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/brdn/brdn.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/brdn/brdn.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/dfp/dfp.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/dfp/dfp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/dfp/dfp.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/diagbrdn/diagbrdn.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/diagbrdn/diagbrdn.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/diagbrdn/diagbrdn.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/lmvmimpl.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmimpl.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmimpl.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/lmvmutils.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmutils.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmutils.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/sr1/sr1.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/sr1/sr1.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/sr1/sr1.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/symbrdn/symbadbrdn.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbadbrdn.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbadbrdn.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/lmvm/symbrdn/symbrdn.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbrdn.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbrdn.c.o.d"
+  "/root/repo/src/ksp/ksp/utils/schurm/schurm.c" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/schurm/schurm.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/ksp/utils/schurm/schurm.c.o.d"
+  "/root/repo/src/ksp/pc/impls/asm/asm.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/asm/asm.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/asm/asm.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddcfetidp.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcfetidp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcfetidp.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddcgraph.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcgraph.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcgraph.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddcnullspace.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcnullspace.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcnullspace.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddcprivate.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcprivate.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcprivate.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddcscalingbasic.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcscalingbasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcscalingbasic.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bddc/bddcschurs.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcschurs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcschurs.c.o.d"
+  "/root/repo/src/ksp/pc/impls/bjacobi/bjacobi.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bjacobi/bjacobi.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/bjacobi/bjacobi.c.o.d"
+  "/root/repo/src/ksp/pc/impls/composite/composite.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/composite/composite.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/composite/composite.c.o.d"
+  "/root/repo/src/ksp/pc/impls/cp/cp.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/cp/cp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/cp/cp.c.o.d"
+  "/root/repo/src/ksp/pc/impls/eisens/eisen.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/eisens/eisen.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/eisens/eisen.c.o.d"
+  "/root/repo/src/ksp/pc/impls/factor/cholesky/cholesky.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/cholesky/cholesky.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/cholesky/cholesky.c.o.d"
+  "/root/repo/src/ksp/pc/impls/factor/factimpl.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factimpl.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factimpl.c.o.d"
+  "/root/repo/src/ksp/pc/impls/factor/factor.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factor.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factor.c.o.d"
+  "/root/repo/src/ksp/pc/impls/factor/icc/icc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/icc/icc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/icc/icc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/factor/ilu/ilu.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/ilu/ilu.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/ilu/ilu.c.o.d"
+  "/root/repo/src/ksp/pc/impls/factor/lu/lu.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/lu/lu.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/lu/lu.c.o.d"
+  "/root/repo/src/ksp/pc/impls/fieldsplit/fieldsplit.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/fieldsplit/fieldsplit.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/fieldsplit/fieldsplit.c.o.d"
+  "/root/repo/src/ksp/pc/impls/galerkin/galerkin.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/galerkin/galerkin.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/galerkin/galerkin.c.o.d"
+  "/root/repo/src/ksp/pc/impls/gamg/agg.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/agg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/agg.c.o.d"
+  "/root/repo/src/ksp/pc/impls/gamg/classical.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/classical.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/classical.c.o.d"
+  "/root/repo/src/ksp/pc/impls/gamg/gamg.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/gamg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/gamg.c.o.d"
+  "/root/repo/src/ksp/pc/impls/gamg/geo.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/geo.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/geo.c.o.d"
+  "/root/repo/src/ksp/pc/impls/gamg/util.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/util.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/util.c.o.d"
+  "/root/repo/src/ksp/pc/impls/gasm/gasm.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gasm/gasm.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/gasm/gasm.c.o.d"
+  "/root/repo/src/ksp/pc/impls/is/nn/nn.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/nn/nn.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/nn/nn.c.o.d"
+  "/root/repo/src/ksp/pc/impls/is/pcis.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/pcis.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/pcis.c.o.d"
+  "/root/repo/src/ksp/pc/impls/jacobi/jacobi.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/jacobi/jacobi.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/jacobi/jacobi.c.o.d"
+  "/root/repo/src/ksp/pc/impls/kaczmarz/kaczmarz.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/kaczmarz/kaczmarz.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/kaczmarz/kaczmarz.c.o.d"
+  "/root/repo/src/ksp/pc/impls/ksp/pcksp.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/ksp/pcksp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/ksp/pcksp.c.o.d"
+  "/root/repo/src/ksp/pc/impls/lmvm/lmvmpc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/lmvm/lmvmpc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/lmvm/lmvmpc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/lsc/lsc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/lsc/lsc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/lsc/lsc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/mat/pcmat.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mat/pcmat.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mat/pcmat.c.o.d"
+  "/root/repo/src/ksp/pc/impls/mg/fmg.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/fmg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/fmg.c.o.d"
+  "/root/repo/src/ksp/pc/impls/mg/mg.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mg.c.o.d"
+  "/root/repo/src/ksp/pc/impls/mg/mgfunc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mgfunc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mgfunc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/mg/smg.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/smg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/smg.c.o.d"
+  "/root/repo/src/ksp/pc/impls/none/none.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/none/none.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/none/none.c.o.d"
+  "/root/repo/src/ksp/pc/impls/patch/pcpatch.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/patch/pcpatch.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/patch/pcpatch.c.o.d"
+  "/root/repo/src/ksp/pc/impls/pbjacobi/pbjacobi.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/pbjacobi/pbjacobi.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/pbjacobi/pbjacobi.c.o.d"
+  "/root/repo/src/ksp/pc/impls/python/pythonpc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/python/pythonpc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/python/pythonpc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/redistribute/redistribute.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/redistribute/redistribute.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/redistribute/redistribute.c.o.d"
+  "/root/repo/src/ksp/pc/impls/redundant/redundant.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/redundant/redundant.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/redundant/redundant.c.o.d"
+  "/root/repo/src/ksp/pc/impls/shell/shellpc.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/shell/shellpc.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/shell/shellpc.c.o.d"
+  "/root/repo/src/ksp/pc/impls/sor/sor.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/sor/sor.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/sor/sor.c.o.d"
+  "/root/repo/src/ksp/pc/impls/svd/svd.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/svd/svd.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/svd/svd.c.o.d"
+  "/root/repo/src/ksp/pc/impls/telescope/telescope.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope.c.o.d"
+  "/root/repo/src/ksp/pc/impls/telescope/telescope_dmda.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope_dmda.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope_dmda.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/bitmask.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/bitmask.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/bitmask.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/comm.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/comm.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/comm.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/gs.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/gs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/gs.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/ivec.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/ivec.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/ivec.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/tfs.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/tfs.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/tfs.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/xxt.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xxt.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xxt.c.o.d"
+  "/root/repo/src/ksp/pc/impls/tfs/xyt.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xyt.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xyt.c.o.d"
+  "/root/repo/src/ksp/pc/impls/vpbjacobi/vpbjacobi.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/vpbjacobi/vpbjacobi.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/vpbjacobi/vpbjacobi.c.o.d"
+  "/root/repo/src/ksp/pc/impls/wb/wb.c" "CMakeFiles/petsc.dir/src/ksp/pc/impls/wb/wb.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/impls/wb/wb.c.o.d"
+  "/root/repo/src/ksp/pc/interface/pcregis.c" "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcregis.c.o.d"
+  "/root/repo/src/ksp/pc/interface/pcset.c" "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcset.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcset.c.o.d"
+  "/root/repo/src/ksp/pc/interface/precon.c" "CMakeFiles/petsc.dir/src/ksp/pc/interface/precon.c.o" "gcc" "CMakeFiles/petsc.dir/src/ksp/pc/interface/precon.c.o.d"
+  "/root/repo/src/mat/coarsen/coarsen.c" "CMakeFiles/petsc.dir/src/mat/coarsen/coarsen.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/coarsen/coarsen.c.o.d"
+  "/root/repo/src/mat/coarsen/impls/hem/hem.c" "CMakeFiles/petsc.dir/src/mat/coarsen/impls/hem/hem.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/coarsen/impls/hem/hem.c.o.d"
+  "/root/repo/src/mat/coarsen/impls/mis/mis.c" "CMakeFiles/petsc.dir/src/mat/coarsen/impls/mis/mis.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/coarsen/impls/mis/mis.c.o.d"
+  "/root/repo/src/mat/coarsen/scoarsen.c" "CMakeFiles/petsc.dir/src/mat/coarsen/scoarsen.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/coarsen/scoarsen.c.o.d"
+  "/root/repo/src/mat/color/impls/greedy/greedy.c" "CMakeFiles/petsc.dir/src/mat/color/impls/greedy/greedy.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/greedy/greedy.c.o.d"
+  "/root/repo/src/mat/color/impls/jp/jp.c" "CMakeFiles/petsc.dir/src/mat/color/impls/jp/jp.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/jp/jp.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/color.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/color.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/color.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/degr.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/degr.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/degr.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/dsm.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/dsm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/dsm.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/ido.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/ido.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/ido.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/numsrt.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/numsrt.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/numsrt.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/seq.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/seq.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/seq.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/setr.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/setr.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/setr.c.o.d"
+  "/root/repo/src/mat/color/impls/minpack/slo.c" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/slo.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/slo.c.o.d"
+  "/root/repo/src/mat/color/impls/natural/natural.c" "CMakeFiles/petsc.dir/src/mat/color/impls/natural/natural.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/natural/natural.c.o.d"
+  "/root/repo/src/mat/color/impls/power/power.c" "CMakeFiles/petsc.dir/src/mat/color/impls/power/power.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/impls/power/power.c.o.d"
+  "/root/repo/src/mat/color/interface/matcoloring.c" "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloring.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloring.c.o.d"
+  "/root/repo/src/mat/color/interface/matcoloringregi.c" "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloringregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloringregi.c.o.d"
+  "/root/repo/src/mat/color/utils/bipartite.c" "CMakeFiles/petsc.dir/src/mat/color/utils/bipartite.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/utils/bipartite.c.o.d"
+  "/root/repo/src/mat/color/utils/valid.c" "CMakeFiles/petsc.dir/src/mat/color/utils/valid.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/utils/valid.c.o.d"
+  "/root/repo/src/mat/color/utils/weights.c" "CMakeFiles/petsc.dir/src/mat/color/utils/weights.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/color/utils/weights.c.o.d"
+  "/root/repo/src/mat/impls/adj/mpi/mpiadj.c" "CMakeFiles/petsc.dir/src/mat/impls/adj/mpi/mpiadj.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/adj/mpi/mpiadj.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/aijperm/mpiaijperm.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijperm/mpiaijperm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijperm/mpiaijperm.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/aijsell/mpiaijsell.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijsell/mpiaijsell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijsell/mpiaijsell.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/crl/mcrl.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/crl/mcrl.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/crl/mcrl.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/fdmpiaij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/fdmpiaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/fdmpiaij.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mmaij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mmaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mmaij.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpb_aij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpb_aij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpb_aij.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpiaij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaij.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpiaijpc.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaijpc.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaijpc.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpimatmatmatmult.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmatmult.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmatmult.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpimatmatmult.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmult.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmult.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpimattransposematmult.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimattransposematmult.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimattransposematmult.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpiov.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiov.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiov.c.o.d"
+  "/root/repo/src/mat/impls/aij/mpi/mpiptap.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiptap.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiptap.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/aij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aij.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/aijfact.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijfact.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijfact.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/aijhdf5.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijhdf5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijhdf5.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/aijperm/aijperm.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijperm/aijperm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijperm/aijperm.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/aijsell/aijsell.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijsell/aijsell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijsell/aijsell.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/bas/basfactor.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/basfactor.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/basfactor.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/bas/spbas.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/spbas.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/spbas.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/crl/crl.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/crl/crl.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/crl/crl.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/fdaij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/fdaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/fdaij.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/ij.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/ij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/ij.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/inode.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/inode2.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode2.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/matmatmatmult.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmatmult.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmatmult.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/matmatmult.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmult.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmult.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/matptap.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matptap.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matptap.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/matrart.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matrart.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matrart.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/mattransposematmult.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/mattransposematmult.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/mattransposematmult.c.o.d"
+  "/root/repo/src/mat/impls/aij/seq/symtranspose.c" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/symtranspose.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/symtranspose.c.o.d"
+  "/root/repo/src/mat/impls/baij/mpi/baijov.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/baijov.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/baijov.c.o.d"
+  "/root/repo/src/mat/impls/baij/mpi/mmbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mmbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mmbaij.c.o.d"
+  "/root/repo/src/mat/impls/baij/mpi/mpb_baij.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpb_baij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpb_baij.c.o.d"
+  "/root/repo/src/mat/impls/baij/mpi/mpibaij.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpibaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpibaij.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/aijbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/aijbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/aijbaij.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baij.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baij2.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij2.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact11.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact11.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact11.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact13.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact13.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact13.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact2.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact2.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact3.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact3.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact3.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact4.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact4.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact4.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact5.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact5.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact7.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact7.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact7.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact81.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact81.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact81.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijfact9.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact9.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact9.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolv.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolv.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolv.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat1.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat1.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat1.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat11.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat11.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat11.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat14.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat14.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat14.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat15.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat15.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat15.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat2.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat2.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat3.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat3.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat3.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat4.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat4.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat4.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat5.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat5.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat6.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat6.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat6.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvnat7.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat7.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat7.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran1.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran1.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran1.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran2.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran2.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran3.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran3.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran3.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran4.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran4.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran4.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran5.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran5.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran6.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran6.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran6.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtran7.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran7.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran7.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrann.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrann.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrann.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat1.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat1.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat1.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat2.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat2.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat3.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat3.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat3.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat4.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat4.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat4.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat5.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat5.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat6.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat6.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat6.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/baijsolvtrannat7.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat7.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat7.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgedi.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgedi.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgedi.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa2.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa2.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa3.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa3.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa3.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa4.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa4.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa4.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa5.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa5.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa6.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa6.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa6.c.o.d"
+  "/root/repo/src/mat/impls/baij/seq/dgefa7.c" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa7.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa7.c.o.d"
+  "/root/repo/src/mat/impls/blockmat/seq/blockmat.c" "CMakeFiles/petsc.dir/src/mat/impls/blockmat/seq/blockmat.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/blockmat/seq/blockmat.c.o.d"
+  "/root/repo/src/mat/impls/composite/mcomposite.c" "CMakeFiles/petsc.dir/src/mat/impls/composite/mcomposite.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/composite/mcomposite.c.o.d"
+  "/root/repo/src/mat/impls/dense/mpi/mmdense.c" "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mmdense.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mmdense.c.o.d"
+  "/root/repo/src/mat/impls/dense/mpi/mpidense.c" "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mpidense.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mpidense.c.o.d"
+  "/root/repo/src/mat/impls/dense/seq/dense.c" "CMakeFiles/petsc.dir/src/mat/impls/dense/seq/dense.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/dense/seq/dense.c.o.d"
+  "/root/repo/src/mat/impls/dummy/matdummy.c" "CMakeFiles/petsc.dir/src/mat/impls/dummy/matdummy.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/dummy/matdummy.c.o.d"
+  "/root/repo/src/mat/impls/fft/fft.c" "CMakeFiles/petsc.dir/src/mat/impls/fft/fft.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/fft/fft.c.o.d"
+  "/root/repo/src/mat/impls/is/matis.c" "CMakeFiles/petsc.dir/src/mat/impls/is/matis.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/is/matis.c.o.d"
+  "/root/repo/src/mat/impls/localref/mlocalref.c" "CMakeFiles/petsc.dir/src/mat/impls/localref/mlocalref.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/localref/mlocalref.c.o.d"
+  "/root/repo/src/mat/impls/lrc/lrc.c" "CMakeFiles/petsc.dir/src/mat/impls/lrc/lrc.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/lrc/lrc.c.o.d"
+  "/root/repo/src/mat/impls/maij/maij.c" "CMakeFiles/petsc.dir/src/mat/impls/maij/maij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/maij/maij.c.o.d"
+  "/root/repo/src/mat/impls/mffd/mffd.c" "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffd.c.o.d"
+  "/root/repo/src/mat/impls/mffd/mffddef.c" "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffddef.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffddef.c.o.d"
+  "/root/repo/src/mat/impls/mffd/mfregis.c" "CMakeFiles/petsc.dir/src/mat/impls/mffd/mfregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/mffd/mfregis.c.o.d"
+  "/root/repo/src/mat/impls/mffd/wp.c" "CMakeFiles/petsc.dir/src/mat/impls/mffd/wp.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/mffd/wp.c.o.d"
+  "/root/repo/src/mat/impls/nest/matnest.c" "CMakeFiles/petsc.dir/src/mat/impls/nest/matnest.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/nest/matnest.c.o.d"
+  "/root/repo/src/mat/impls/normal/normm.c" "CMakeFiles/petsc.dir/src/mat/impls/normal/normm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/normal/normm.c.o.d"
+  "/root/repo/src/mat/impls/normal/normmh.c" "CMakeFiles/petsc.dir/src/mat/impls/normal/normmh.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/normal/normmh.c.o.d"
+  "/root/repo/src/mat/impls/preallocator/matpreallocator.c" "CMakeFiles/petsc.dir/src/mat/impls/preallocator/matpreallocator.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/preallocator/matpreallocator.c.o.d"
+  "/root/repo/src/mat/impls/python/pythonmat.c" "CMakeFiles/petsc.dir/src/mat/impls/python/pythonmat.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/python/pythonmat.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/mpi/mmsbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mmsbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mmsbaij.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/mpi/mpiaijsbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpiaijsbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpiaijsbaij.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/mpi/mpisbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpisbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpisbaij.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/mpi/sbaijov.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/sbaijov.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/sbaijov.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/aijsbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/aijsbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/aijsbaij.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaij.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaij2.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij2.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact10.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact10.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact10.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact11.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact11.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact11.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact12.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact12.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact12.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact2.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact2.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact2.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact3.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact3.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact3.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact4.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact4.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact4.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact5.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact5.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact5.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact6.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact6.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact6.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact7.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact7.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact7.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact8.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact8.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact8.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sbaijfact9.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact9.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact9.c.o.d"
+  "/root/repo/src/mat/impls/sbaij/seq/sro.c" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sro.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sro.c.o.d"
+  "/root/repo/src/mat/impls/scatter/mscatter.c" "CMakeFiles/petsc.dir/src/mat/impls/scatter/mscatter.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/scatter/mscatter.c.o.d"
+  "/root/repo/src/mat/impls/sell/mpi/mmsell.c" "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mmsell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mmsell.c.o.d"
+  "/root/repo/src/mat/impls/sell/mpi/mpisell.c" "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mpisell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mpisell.c.o.d"
+  "/root/repo/src/mat/impls/sell/seq/fdsell.c" "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/fdsell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/fdsell.c.o.d"
+  "/root/repo/src/mat/impls/sell/seq/sell.c" "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/sell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/sell.c.o.d"
+  "/root/repo/src/mat/impls/shell/shell.c" "CMakeFiles/petsc.dir/src/mat/impls/shell/shell.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/shell/shell.c.o.d"
+  "/root/repo/src/mat/impls/shell/shellcnv.c" "CMakeFiles/petsc.dir/src/mat/impls/shell/shellcnv.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/shell/shellcnv.c.o.d"
+  "/root/repo/src/mat/impls/submat/submat.c" "CMakeFiles/petsc.dir/src/mat/impls/submat/submat.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/submat/submat.c.o.d"
+  "/root/repo/src/mat/impls/transpose/htransm.c" "CMakeFiles/petsc.dir/src/mat/impls/transpose/htransm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/transpose/htransm.c.o.d"
+  "/root/repo/src/mat/impls/transpose/transm.c" "CMakeFiles/petsc.dir/src/mat/impls/transpose/transm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/impls/transpose/transm.c.o.d"
+  "/root/repo/src/mat/interface/dlregismat.c" "CMakeFiles/petsc.dir/src/mat/interface/dlregismat.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/interface/dlregismat.c.o.d"
+  "/root/repo/src/mat/interface/matnull.c" "CMakeFiles/petsc.dir/src/mat/interface/matnull.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/interface/matnull.c.o.d"
+  "/root/repo/src/mat/interface/matreg.c" "CMakeFiles/petsc.dir/src/mat/interface/matreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/interface/matreg.c.o.d"
+  "/root/repo/src/mat/interface/matregis.c" "CMakeFiles/petsc.dir/src/mat/interface/matregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/interface/matregis.c.o.d"
+  "/root/repo/src/mat/interface/matrix.c" "CMakeFiles/petsc.dir/src/mat/interface/matrix.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/interface/matrix.c.o.d"
+  "/root/repo/src/mat/matfd/fdmatrix.c" "CMakeFiles/petsc.dir/src/mat/matfd/fdmatrix.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/matfd/fdmatrix.c.o.d"
+  "/root/repo/src/mat/order/degree.c" "CMakeFiles/petsc.dir/src/mat/order/degree.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/degree.c.o.d"
+  "/root/repo/src/mat/order/fn1wd.c" "CMakeFiles/petsc.dir/src/mat/order/fn1wd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/fn1wd.c.o.d"
+  "/root/repo/src/mat/order/fndsep.c" "CMakeFiles/petsc.dir/src/mat/order/fndsep.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/fndsep.c.o.d"
+  "/root/repo/src/mat/order/fnroot.c" "CMakeFiles/petsc.dir/src/mat/order/fnroot.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/fnroot.c.o.d"
+  "/root/repo/src/mat/order/gen1wd.c" "CMakeFiles/petsc.dir/src/mat/order/gen1wd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/gen1wd.c.o.d"
+  "/root/repo/src/mat/order/gennd.c" "CMakeFiles/petsc.dir/src/mat/order/gennd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/gennd.c.o.d"
+  "/root/repo/src/mat/order/genqmd.c" "CMakeFiles/petsc.dir/src/mat/order/genqmd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/genqmd.c.o.d"
+  "/root/repo/src/mat/order/genrcm.c" "CMakeFiles/petsc.dir/src/mat/order/genrcm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/genrcm.c.o.d"
+  "/root/repo/src/mat/order/qmdmrg.c" "CMakeFiles/petsc.dir/src/mat/order/qmdmrg.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/qmdmrg.c.o.d"
+  "/root/repo/src/mat/order/qmdqt.c" "CMakeFiles/petsc.dir/src/mat/order/qmdqt.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/qmdqt.c.o.d"
+  "/root/repo/src/mat/order/qmdrch.c" "CMakeFiles/petsc.dir/src/mat/order/qmdrch.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/qmdrch.c.o.d"
+  "/root/repo/src/mat/order/qmdupd.c" "CMakeFiles/petsc.dir/src/mat/order/qmdupd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/qmdupd.c.o.d"
+  "/root/repo/src/mat/order/rcm.c" "CMakeFiles/petsc.dir/src/mat/order/rcm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/rcm.c.o.d"
+  "/root/repo/src/mat/order/rootls.c" "CMakeFiles/petsc.dir/src/mat/order/rootls.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/rootls.c.o.d"
+  "/root/repo/src/mat/order/sorder.c" "CMakeFiles/petsc.dir/src/mat/order/sorder.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/sorder.c.o.d"
+  "/root/repo/src/mat/order/sp1wd.c" "CMakeFiles/petsc.dir/src/mat/order/sp1wd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/sp1wd.c.o.d"
+  "/root/repo/src/mat/order/spectral.c" "CMakeFiles/petsc.dir/src/mat/order/spectral.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/spectral.c.o.d"
+  "/root/repo/src/mat/order/spnd.c" "CMakeFiles/petsc.dir/src/mat/order/spnd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/spnd.c.o.d"
+  "/root/repo/src/mat/order/spqmd.c" "CMakeFiles/petsc.dir/src/mat/order/spqmd.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/spqmd.c.o.d"
+  "/root/repo/src/mat/order/sprcm.c" "CMakeFiles/petsc.dir/src/mat/order/sprcm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/sprcm.c.o.d"
+  "/root/repo/src/mat/order/sregis.c" "CMakeFiles/petsc.dir/src/mat/order/sregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/sregis.c.o.d"
+  "/root/repo/src/mat/order/wbm.c" "CMakeFiles/petsc.dir/src/mat/order/wbm.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/order/wbm.c.o.d"
+  "/root/repo/src/mat/partition/impls/hierarchical/hierarchical.c" "CMakeFiles/petsc.dir/src/mat/partition/impls/hierarchical/hierarchical.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/partition/impls/hierarchical/hierarchical.c.o.d"
+  "/root/repo/src/mat/partition/partition.c" "CMakeFiles/petsc.dir/src/mat/partition/partition.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/partition/partition.c.o.d"
+  "/root/repo/src/mat/partition/spartition.c" "CMakeFiles/petsc.dir/src/mat/partition/spartition.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/partition/spartition.c.o.d"
+  "/root/repo/src/mat/utils/axpy.c" "CMakeFiles/petsc.dir/src/mat/utils/axpy.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/axpy.c.o.d"
+  "/root/repo/src/mat/utils/bandwidth.c" "CMakeFiles/petsc.dir/src/mat/utils/bandwidth.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/bandwidth.c.o.d"
+  "/root/repo/src/mat/utils/compressedrow.c" "CMakeFiles/petsc.dir/src/mat/utils/compressedrow.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/compressedrow.c.o.d"
+  "/root/repo/src/mat/utils/convert.c" "CMakeFiles/petsc.dir/src/mat/utils/convert.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/convert.c.o.d"
+  "/root/repo/src/mat/utils/factorschur.c" "CMakeFiles/petsc.dir/src/mat/utils/factorschur.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/factorschur.c.o.d"
+  "/root/repo/src/mat/utils/freespace.c" "CMakeFiles/petsc.dir/src/mat/utils/freespace.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/freespace.c.o.d"
+  "/root/repo/src/mat/utils/gcreate.c" "CMakeFiles/petsc.dir/src/mat/utils/gcreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/gcreate.c.o.d"
+  "/root/repo/src/mat/utils/getcolv.c" "CMakeFiles/petsc.dir/src/mat/utils/getcolv.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/getcolv.c.o.d"
+  "/root/repo/src/mat/utils/matstash.c" "CMakeFiles/petsc.dir/src/mat/utils/matstash.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/matstash.c.o.d"
+  "/root/repo/src/mat/utils/matstashspace.c" "CMakeFiles/petsc.dir/src/mat/utils/matstashspace.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/matstashspace.c.o.d"
+  "/root/repo/src/mat/utils/multequal.c" "CMakeFiles/petsc.dir/src/mat/utils/multequal.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/multequal.c.o.d"
+  "/root/repo/src/mat/utils/overlapsplit.c" "CMakeFiles/petsc.dir/src/mat/utils/overlapsplit.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/overlapsplit.c.o.d"
+  "/root/repo/src/mat/utils/pheap.c" "CMakeFiles/petsc.dir/src/mat/utils/pheap.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/pheap.c.o.d"
+  "/root/repo/src/mat/utils/zerodiag.c" "CMakeFiles/petsc.dir/src/mat/utils/zerodiag.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/zerodiag.c.o.d"
+  "/root/repo/src/mat/utils/zerorows.c" "CMakeFiles/petsc.dir/src/mat/utils/zerorows.c.o" "gcc" "CMakeFiles/petsc.dir/src/mat/utils/zerorows.c.o.d"
+  "/root/repo/src/snes/impls/composite/snescomposite.c" "CMakeFiles/petsc.dir/src/snes/impls/composite/snescomposite.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/composite/snescomposite.c.o.d"
+  "/root/repo/src/snes/impls/fas/fas.c" "CMakeFiles/petsc.dir/src/snes/impls/fas/fas.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/fas/fas.c.o.d"
+  "/root/repo/src/snes/impls/fas/fasfunc.c" "CMakeFiles/petsc.dir/src/snes/impls/fas/fasfunc.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/fas/fasfunc.c.o.d"
+  "/root/repo/src/snes/impls/fas/fasgalerkin.c" "CMakeFiles/petsc.dir/src/snes/impls/fas/fasgalerkin.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/fas/fasgalerkin.c.o.d"
+  "/root/repo/src/snes/impls/gs/gssecant.c" "CMakeFiles/petsc.dir/src/snes/impls/gs/gssecant.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/gs/gssecant.c.o.d"
+  "/root/repo/src/snes/impls/gs/snesgs.c" "CMakeFiles/petsc.dir/src/snes/impls/gs/snesgs.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/gs/snesgs.c.o.d"
+  "/root/repo/src/snes/impls/ksponly/ksponly.c" "CMakeFiles/petsc.dir/src/snes/impls/ksponly/ksponly.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ksponly/ksponly.c.o.d"
+  "/root/repo/src/snes/impls/ls/ls.c" "CMakeFiles/petsc.dir/src/snes/impls/ls/ls.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ls/ls.c.o.d"
+  "/root/repo/src/snes/impls/ms/ms.c" "CMakeFiles/petsc.dir/src/snes/impls/ms/ms.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ms/ms.c.o.d"
+  "/root/repo/src/snes/impls/nasm/aspin.c" "CMakeFiles/petsc.dir/src/snes/impls/nasm/aspin.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/nasm/aspin.c.o.d"
+  "/root/repo/src/snes/impls/nasm/nasm.c" "CMakeFiles/petsc.dir/src/snes/impls/nasm/nasm.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/nasm/nasm.c.o.d"
+  "/root/repo/src/snes/impls/ncg/snesncg.c" "CMakeFiles/petsc.dir/src/snes/impls/ncg/snesncg.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ncg/snesncg.c.o.d"
+  "/root/repo/src/snes/impls/ngmres/anderson.c" "CMakeFiles/petsc.dir/src/snes/impls/ngmres/anderson.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ngmres/anderson.c.o.d"
+  "/root/repo/src/snes/impls/ngmres/ngmresfunc.c" "CMakeFiles/petsc.dir/src/snes/impls/ngmres/ngmresfunc.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ngmres/ngmresfunc.c.o.d"
+  "/root/repo/src/snes/impls/ngmres/snesngmres.c" "CMakeFiles/petsc.dir/src/snes/impls/ngmres/snesngmres.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/ngmres/snesngmres.c.o.d"
+  "/root/repo/src/snes/impls/patch/snespatch.c" "CMakeFiles/petsc.dir/src/snes/impls/patch/snespatch.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/patch/snespatch.c.o.d"
+  "/root/repo/src/snes/impls/python/pythonsnes.c" "CMakeFiles/petsc.dir/src/snes/impls/python/pythonsnes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/python/pythonsnes.c.o.d"
+  "/root/repo/src/snes/impls/qn/qn.c" "CMakeFiles/petsc.dir/src/snes/impls/qn/qn.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/qn/qn.c.o.d"
+  "/root/repo/src/snes/impls/richardson/snesrichardson.c" "CMakeFiles/petsc.dir/src/snes/impls/richardson/snesrichardson.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/richardson/snesrichardson.c.o.d"
+  "/root/repo/src/snes/impls/shell/snesshell.c" "CMakeFiles/petsc.dir/src/snes/impls/shell/snesshell.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/shell/snesshell.c.o.d"
+  "/root/repo/src/snes/impls/tr/tr.c" "CMakeFiles/petsc.dir/src/snes/impls/tr/tr.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/tr/tr.c.o.d"
+  "/root/repo/src/snes/impls/vi/rs/virs.c" "CMakeFiles/petsc.dir/src/snes/impls/vi/rs/virs.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/vi/rs/virs.c.o.d"
+  "/root/repo/src/snes/impls/vi/ss/viss.c" "CMakeFiles/petsc.dir/src/snes/impls/vi/ss/viss.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/vi/ss/viss.c.o.d"
+  "/root/repo/src/snes/impls/vi/vi.c" "CMakeFiles/petsc.dir/src/snes/impls/vi/vi.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/impls/vi/vi.c.o.d"
+  "/root/repo/src/snes/interface/dlregissnes.c" "CMakeFiles/petsc.dir/src/snes/interface/dlregissnes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/dlregissnes.c.o.d"
+  "/root/repo/src/snes/interface/noise/snesdnest.c" "CMakeFiles/petsc.dir/src/snes/interface/noise/snesdnest.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/noise/snesdnest.c.o.d"
+  "/root/repo/src/snes/interface/noise/snesmfj2.c" "CMakeFiles/petsc.dir/src/snes/interface/noise/snesmfj2.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/noise/snesmfj2.c.o.d"
+  "/root/repo/src/snes/interface/noise/snesnoise.c" "CMakeFiles/petsc.dir/src/snes/interface/noise/snesnoise.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/noise/snesnoise.c.o.d"
+  "/root/repo/src/snes/interface/snes.c" "CMakeFiles/petsc.dir/src/snes/interface/snes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snes.c.o.d"
+  "/root/repo/src/snes/interface/snesj.c" "CMakeFiles/petsc.dir/src/snes/interface/snesj.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snesj.c.o.d"
+  "/root/repo/src/snes/interface/snesj2.c" "CMakeFiles/petsc.dir/src/snes/interface/snesj2.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snesj2.c.o.d"
+  "/root/repo/src/snes/interface/snesob.c" "CMakeFiles/petsc.dir/src/snes/interface/snesob.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snesob.c.o.d"
+  "/root/repo/src/snes/interface/snespc.c" "CMakeFiles/petsc.dir/src/snes/interface/snespc.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snespc.c.o.d"
+  "/root/repo/src/snes/interface/snesregi.c" "CMakeFiles/petsc.dir/src/snes/interface/snesregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snesregi.c.o.d"
+  "/root/repo/src/snes/interface/snesut.c" "CMakeFiles/petsc.dir/src/snes/interface/snesut.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/interface/snesut.c.o.d"
+  "/root/repo/src/snes/linesearch/impls/basic/linesearchbasic.c" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/basic/linesearchbasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/basic/linesearchbasic.c.o.d"
+  "/root/repo/src/snes/linesearch/impls/bt/linesearchbt.c" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/bt/linesearchbt.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/bt/linesearchbt.c.o.d"
+  "/root/repo/src/snes/linesearch/impls/cp/linesearchcp.c" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/cp/linesearchcp.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/cp/linesearchcp.c.o.d"
+  "/root/repo/src/snes/linesearch/impls/l2/linesearchl2.c" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/l2/linesearchl2.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/l2/linesearchl2.c.o.d"
+  "/root/repo/src/snes/linesearch/impls/nleqerr/linesearchnleqerr.c" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/nleqerr/linesearchnleqerr.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/nleqerr/linesearchnleqerr.c.o.d"
+  "/root/repo/src/snes/linesearch/impls/shell/linesearchshell.c" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/shell/linesearchshell.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/impls/shell/linesearchshell.c.o.d"
+  "/root/repo/src/snes/linesearch/interface/linesearch.c" "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearch.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearch.c.o.d"
+  "/root/repo/src/snes/linesearch/interface/linesearchregi.c" "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearchregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearchregi.c.o.d"
+  "/root/repo/src/snes/mf/snesmfj.c" "CMakeFiles/petsc.dir/src/snes/mf/snesmfj.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/mf/snesmfj.c.o.d"
+  "/root/repo/src/snes/utils/convest.c" "CMakeFiles/petsc.dir/src/snes/utils/convest.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/utils/convest.c.o.d"
+  "/root/repo/src/snes/utils/dmadapt.c" "CMakeFiles/petsc.dir/src/snes/utils/dmadapt.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/utils/dmadapt.c.o.d"
+  "/root/repo/src/snes/utils/dmdasnes.c" "CMakeFiles/petsc.dir/src/snes/utils/dmdasnes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/utils/dmdasnes.c.o.d"
+  "/root/repo/src/snes/utils/dmlocalsnes.c" "CMakeFiles/petsc.dir/src/snes/utils/dmlocalsnes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/utils/dmlocalsnes.c.o.d"
+  "/root/repo/src/snes/utils/dmplexsnes.c" "CMakeFiles/petsc.dir/src/snes/utils/dmplexsnes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/utils/dmplexsnes.c.o.d"
+  "/root/repo/src/snes/utils/dmsnes.c" "CMakeFiles/petsc.dir/src/snes/utils/dmsnes.c.o" "gcc" "CMakeFiles/petsc.dir/src/snes/utils/dmsnes.c.o.d"
+  "/root/repo/src/sys/classes/bag/bag.c" "CMakeFiles/petsc.dir/src/sys/classes/bag/bag.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/bag/bag.c.o.d"
+  "/root/repo/src/sys/classes/draw/impls/image/drawimage.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/image/drawimage.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/image/drawimage.c.o.d"
+  "/root/repo/src/sys/classes/draw/impls/null/drawnull.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/null/drawnull.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/null/drawnull.c.o.d"
+  "/root/repo/src/sys/classes/draw/impls/tikz/tikz.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/tikz/tikz.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/tikz/tikz.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dclear.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dclear.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dclear.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dcoor.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dcoor.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dcoor.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dellipse.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dellipse.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dellipse.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dflush.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dflush.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dflush.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dline.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dline.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dline.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dmarker.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmarker.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmarker.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dmouse.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmouse.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmouse.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dpause.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpause.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpause.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dpoint.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpoint.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpoint.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/draw.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/draw.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/draw.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/drawreg.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawreg.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/drawregall.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawregall.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/drect.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drect.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drect.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dsave.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dsave.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dsave.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dtext.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtext.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtext.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dtri.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtri.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtri.c.o.d"
+  "/root/repo/src/sys/classes/draw/interface/dviewp.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dviewp.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dviewp.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/axis.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axis.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axis.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/axisc.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axisc.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axisc.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/bars.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/bars.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/bars.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/cmap.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/cmap.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/cmap.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/dscatter.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/dscatter.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/dscatter.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/hists.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/hists.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/hists.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/image.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/image.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/image.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/lg.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lg.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lg.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/lgc.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lgc.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lgc.c.o.d"
+  "/root/repo/src/sys/classes/draw/utils/zoom.c" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/zoom.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/zoom.c.o.d"
+  "/root/repo/src/sys/classes/gll/petscgll.c" "CMakeFiles/petsc.dir/src/sys/classes/gll/petscgll.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/gll/petscgll.c.o.d"
+  "/root/repo/src/sys/classes/random/impls/rand/rand.c" "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand/rand.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand/rand.c.o.d"
+  "/root/repo/src/sys/classes/random/impls/rand48/rand48.c" "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand48/rand48.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand48/rand48.c.o.d"
+  "/root/repo/src/sys/classes/random/impls/rander48/rander48.c" "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rander48/rander48.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rander48/rander48.c.o.d"
+  "/root/repo/src/sys/classes/random/interface/dlregisrand.c" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/dlregisrand.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/dlregisrand.c.o.d"
+  "/root/repo/src/sys/classes/random/interface/random.c" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/random.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/random.c.o.d"
+  "/root/repo/src/sys/classes/random/interface/randomc.c" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randomc.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randomc.c.o.d"
+  "/root/repo/src/sys/classes/random/interface/randreg.c" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randreg.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/ascii/filev.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/filev.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/filev.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/ascii/vcreatea.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/vcreatea.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/vcreatea.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/binary/binv.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/binary/binv.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/binary/binv.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/draw/drawv.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/draw/drawv.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/draw/drawv.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/glvis/glvis.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/glvis/glvis.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/glvis/glvis.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/socket/send.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/socket/send.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/socket/send.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/string/stringv.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/string/stringv.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/string/stringv.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/vtk/vtkv.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vtk/vtkv.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vtk/vtkv.c.o.d"
+  "/root/repo/src/sys/classes/viewer/impls/vu/petscvu.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vu/petscvu.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vu/petscvu.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/dlregispetsc.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dlregispetsc.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dlregispetsc.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/dupl.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dupl.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dupl.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/flush.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/flush.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/flush.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/view.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/view.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/view.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/viewa.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewa.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewa.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/viewers.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewers.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewers.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/viewreg.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewreg.c.o.d"
+  "/root/repo/src/sys/classes/viewer/interface/viewregall.c" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewregall.c.o.d"
+  "/root/repo/src/sys/dll/dl.c" "CMakeFiles/petsc.dir/src/sys/dll/dl.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/dll/dl.c.o.d"
+  "/root/repo/src/sys/dll/dlimpl.c" "CMakeFiles/petsc.dir/src/sys/dll/dlimpl.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/dll/dlimpl.c.o.d"
+  "/root/repo/src/sys/dll/reg.c" "CMakeFiles/petsc.dir/src/sys/dll/reg.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/dll/reg.c.o.d"
+  "/root/repo/src/sys/error/adebug.c" "CMakeFiles/petsc.dir/src/sys/error/adebug.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/adebug.c.o.d"
+  "/root/repo/src/sys/error/checkptr.c" "CMakeFiles/petsc.dir/src/sys/error/checkptr.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/checkptr.c.o.d"
+  "/root/repo/src/sys/error/err.c" "CMakeFiles/petsc.dir/src/sys/error/err.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/err.c.o.d"
+  "/root/repo/src/sys/error/errabort.c" "CMakeFiles/petsc.dir/src/sys/error/errabort.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/errabort.c.o.d"
+  "/root/repo/src/sys/error/errstop.c" "CMakeFiles/petsc.dir/src/sys/error/errstop.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/errstop.c.o.d"
+  "/root/repo/src/sys/error/errtrace.c" "CMakeFiles/petsc.dir/src/sys/error/errtrace.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/errtrace.c.o.d"
+  "/root/repo/src/sys/error/fp.c" "CMakeFiles/petsc.dir/src/sys/error/fp.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/fp.c.o.d"
+  "/root/repo/src/sys/error/pstack.c" "CMakeFiles/petsc.dir/src/sys/error/pstack.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/pstack.c.o.d"
+  "/root/repo/src/sys/error/signal.c" "CMakeFiles/petsc.dir/src/sys/error/signal.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/error/signal.c.o.d"
+  "/root/repo/src/sys/fileio/fdir.c" "CMakeFiles/petsc.dir/src/sys/fileio/fdir.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/fdir.c.o.d"
+  "/root/repo/src/sys/fileio/fpath.c" "CMakeFiles/petsc.dir/src/sys/fileio/fpath.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/fpath.c.o.d"
+  "/root/repo/src/sys/fileio/fretrieve.c" "CMakeFiles/petsc.dir/src/sys/fileio/fretrieve.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/fretrieve.c.o.d"
+  "/root/repo/src/sys/fileio/ftest.c" "CMakeFiles/petsc.dir/src/sys/fileio/ftest.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/ftest.c.o.d"
+  "/root/repo/src/sys/fileio/fwd.c" "CMakeFiles/petsc.dir/src/sys/fileio/fwd.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/fwd.c.o.d"
+  "/root/repo/src/sys/fileio/ghome.c" "CMakeFiles/petsc.dir/src/sys/fileio/ghome.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/ghome.c.o.d"
+  "/root/repo/src/sys/fileio/grpath.c" "CMakeFiles/petsc.dir/src/sys/fileio/grpath.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/grpath.c.o.d"
+  "/root/repo/src/sys/fileio/mpiuopen.c" "CMakeFiles/petsc.dir/src/sys/fileio/mpiuopen.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/mpiuopen.c.o.d"
+  "/root/repo/src/sys/fileio/mprint.c" "CMakeFiles/petsc.dir/src/sys/fileio/mprint.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/mprint.c.o.d"
+  "/root/repo/src/sys/fileio/rpath.c" "CMakeFiles/petsc.dir/src/sys/fileio/rpath.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/rpath.c.o.d"
+  "/root/repo/src/sys/fileio/smatlab.c" "CMakeFiles/petsc.dir/src/sys/fileio/smatlab.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/smatlab.c.o.d"
+  "/root/repo/src/sys/fileio/sysio.c" "CMakeFiles/petsc.dir/src/sys/fileio/sysio.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/fileio/sysio.c.o.d"
+  "/root/repo/src/sys/info/verboseinfo.c" "CMakeFiles/petsc.dir/src/sys/info/verboseinfo.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/info/verboseinfo.c.o.d"
+  "/root/repo/src/sys/logging/plog.c" "CMakeFiles/petsc.dir/src/sys/logging/plog.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/plog.c.o.d"
+  "/root/repo/src/sys/logging/utils/classlog.c" "CMakeFiles/petsc.dir/src/sys/logging/utils/classlog.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/utils/classlog.c.o.d"
+  "/root/repo/src/sys/logging/utils/eventlog.c" "CMakeFiles/petsc.dir/src/sys/logging/utils/eventlog.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/utils/eventlog.c.o.d"
+  "/root/repo/src/sys/logging/utils/stack.c" "CMakeFiles/petsc.dir/src/sys/logging/utils/stack.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/utils/stack.c.o.d"
+  "/root/repo/src/sys/logging/utils/stagelog.c" "CMakeFiles/petsc.dir/src/sys/logging/utils/stagelog.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/utils/stagelog.c.o.d"
+  "/root/repo/src/sys/logging/xmllogevent.c" "CMakeFiles/petsc.dir/src/sys/logging/xmllogevent.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/xmllogevent.c.o.d"
+  "/root/repo/src/sys/logging/xmlviewer.c" "CMakeFiles/petsc.dir/src/sys/logging/xmlviewer.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/logging/xmlviewer.c.o.d"
+  "/root/repo/src/sys/memory/mal.c" "CMakeFiles/petsc.dir/src/sys/memory/mal.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/memory/mal.c.o.d"
+  "/root/repo/src/sys/memory/mem.c" "CMakeFiles/petsc.dir/src/sys/memory/mem.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/memory/mem.c.o.d"
+  "/root/repo/src/sys/memory/mhbw.c" "CMakeFiles/petsc.dir/src/sys/memory/mhbw.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/memory/mhbw.c.o.d"
+  "/root/repo/src/sys/memory/mtr.c" "CMakeFiles/petsc.dir/src/sys/memory/mtr.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/memory/mtr.c.o.d"
+  "/root/repo/src/sys/objects/aoptions.c" "CMakeFiles/petsc.dir/src/sys/objects/aoptions.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/aoptions.c.o.d"
+  "/root/repo/src/sys/objects/destroy.c" "CMakeFiles/petsc.dir/src/sys/objects/destroy.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/destroy.c.o.d"
+  "/root/repo/src/sys/objects/fcallback.c" "CMakeFiles/petsc.dir/src/sys/objects/fcallback.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/fcallback.c.o.d"
+  "/root/repo/src/sys/objects/gcomm.c" "CMakeFiles/petsc.dir/src/sys/objects/gcomm.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/gcomm.c.o.d"
+  "/root/repo/src/sys/objects/gcookie.c" "CMakeFiles/petsc.dir/src/sys/objects/gcookie.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/gcookie.c.o.d"
+  "/root/repo/src/sys/objects/gtype.c" "CMakeFiles/petsc.dir/src/sys/objects/gtype.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/gtype.c.o.d"
+  "/root/repo/src/sys/objects/inherit.c" "CMakeFiles/petsc.dir/src/sys/objects/inherit.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/inherit.c.o.d"
+  "/root/repo/src/sys/objects/init.c" "CMakeFiles/petsc.dir/src/sys/objects/init.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/init.c.o.d"
+  "/root/repo/src/sys/objects/olist.c" "CMakeFiles/petsc.dir/src/sys/objects/olist.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/olist.c.o.d"
+  "/root/repo/src/sys/objects/options.c" "CMakeFiles/petsc.dir/src/sys/objects/options.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/options.c.o.d"
+  "/root/repo/src/sys/objects/pgname.c" "CMakeFiles/petsc.dir/src/sys/objects/pgname.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/pgname.c.o.d"
+  "/root/repo/src/sys/objects/pinit.c" "CMakeFiles/petsc.dir/src/sys/objects/pinit.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/pinit.c.o.d"
+  "/root/repo/src/sys/objects/pname.c" "CMakeFiles/petsc.dir/src/sys/objects/pname.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/pname.c.o.d"
+  "/root/repo/src/sys/objects/prefix.c" "CMakeFiles/petsc.dir/src/sys/objects/prefix.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/prefix.c.o.d"
+  "/root/repo/src/sys/objects/ptype.c" "CMakeFiles/petsc.dir/src/sys/objects/ptype.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/ptype.c.o.d"
+  "/root/repo/src/sys/objects/state.c" "CMakeFiles/petsc.dir/src/sys/objects/state.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/state.c.o.d"
+  "/root/repo/src/sys/objects/subcomm.c" "CMakeFiles/petsc.dir/src/sys/objects/subcomm.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/subcomm.c.o.d"
+  "/root/repo/src/sys/objects/tagm.c" "CMakeFiles/petsc.dir/src/sys/objects/tagm.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/tagm.c.o.d"
+  "/root/repo/src/sys/objects/version.c" "CMakeFiles/petsc.dir/src/sys/objects/version.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/objects/version.c.o.d"
+  "/root/repo/src/sys/python/pythonsys.c" "CMakeFiles/petsc.dir/src/sys/python/pythonsys.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/python/pythonsys.c.o.d"
+  "/root/repo/src/sys/time/cputime.c" "CMakeFiles/petsc.dir/src/sys/time/cputime.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/time/cputime.c.o.d"
+  "/root/repo/src/sys/time/fdate.c" "CMakeFiles/petsc.dir/src/sys/time/fdate.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/time/fdate.c.o.d"
+  "/root/repo/src/sys/totalview/tv_data_display.c" "CMakeFiles/petsc.dir/src/sys/totalview/tv_data_display.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/totalview/tv_data_display.c.o.d"
+  "/root/repo/src/sys/utils/arch.c" "CMakeFiles/petsc.dir/src/sys/utils/arch.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/arch.c.o.d"
+  "/root/repo/src/sys/utils/ctable.c" "CMakeFiles/petsc.dir/src/sys/utils/ctable.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/ctable.c.o.d"
+  "/root/repo/src/sys/utils/fhost.c" "CMakeFiles/petsc.dir/src/sys/utils/fhost.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/fhost.c.o.d"
+  "/root/repo/src/sys/utils/fuser.c" "CMakeFiles/petsc.dir/src/sys/utils/fuser.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/fuser.c.o.d"
+  "/root/repo/src/sys/utils/mathclose.c" "CMakeFiles/petsc.dir/src/sys/utils/mathclose.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mathclose.c.o.d"
+  "/root/repo/src/sys/utils/matheq.c" "CMakeFiles/petsc.dir/src/sys/utils/matheq.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/matheq.c.o.d"
+  "/root/repo/src/sys/utils/mathinf.c" "CMakeFiles/petsc.dir/src/sys/utils/mathinf.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mathinf.c.o.d"
+  "/root/repo/src/sys/utils/memc.c" "CMakeFiles/petsc.dir/src/sys/utils/memc.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/memc.c.o.d"
+  "/root/repo/src/sys/utils/mpilong.c" "CMakeFiles/petsc.dir/src/sys/utils/mpilong.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mpilong.c.o.d"
+  "/root/repo/src/sys/utils/mpimesg.c" "CMakeFiles/petsc.dir/src/sys/utils/mpimesg.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mpimesg.c.o.d"
+  "/root/repo/src/sys/utils/mpishm.c" "CMakeFiles/petsc.dir/src/sys/utils/mpishm.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mpishm.c.o.d"
+  "/root/repo/src/sys/utils/mpitr.c" "CMakeFiles/petsc.dir/src/sys/utils/mpitr.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mpitr.c.o.d"
+  "/root/repo/src/sys/utils/mpits.c" "CMakeFiles/petsc.dir/src/sys/utils/mpits.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mpits.c.o.d"
+  "/root/repo/src/sys/utils/mpiu.c" "CMakeFiles/petsc.dir/src/sys/utils/mpiu.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/mpiu.c.o.d"
+  "/root/repo/src/sys/utils/pbarrier.c" "CMakeFiles/petsc.dir/src/sys/utils/pbarrier.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/pbarrier.c.o.d"
+  "/root/repo/src/sys/utils/pdisplay.c" "CMakeFiles/petsc.dir/src/sys/utils/pdisplay.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/pdisplay.c.o.d"
+  "/root/repo/src/sys/utils/psleep.c" "CMakeFiles/petsc.dir/src/sys/utils/psleep.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/psleep.c.o.d"
+  "/root/repo/src/sys/utils/psplit.c" "CMakeFiles/petsc.dir/src/sys/utils/psplit.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/psplit.c.o.d"
+  "/root/repo/src/sys/utils/segbuffer.c" "CMakeFiles/petsc.dir/src/sys/utils/segbuffer.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/segbuffer.c.o.d"
+  "/root/repo/src/sys/utils/sortd.c" "CMakeFiles/petsc.dir/src/sys/utils/sortd.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/sortd.c.o.d"
+  "/root/repo/src/sys/utils/sorti.c" "CMakeFiles/petsc.dir/src/sys/utils/sorti.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/sorti.c.o.d"
+  "/root/repo/src/sys/utils/sortip.c" "CMakeFiles/petsc.dir/src/sys/utils/sortip.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/sortip.c.o.d"
+  "/root/repo/src/sys/utils/sseenabled.c" "CMakeFiles/petsc.dir/src/sys/utils/sseenabled.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/sseenabled.c.o.d"
+  "/root/repo/src/sys/utils/str.c" "CMakeFiles/petsc.dir/src/sys/utils/str.c.o" "gcc" "CMakeFiles/petsc.dir/src/sys/utils/str.c.o.d"
+  "/root/repo/src/tao/bound/impls/blmvm/blmvm.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/blmvm/blmvm.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/blmvm/blmvm.c.o.d"
+  "/root/repo/src/tao/bound/impls/bncg/bncg.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bncg/bncg.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bncg/bncg.c.o.d"
+  "/root/repo/src/tao/bound/impls/bnk/bnk.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnk.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnk.c.o.d"
+  "/root/repo/src/tao/bound/impls/bnk/bnls.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnls.c.o.d"
+  "/root/repo/src/tao/bound/impls/bnk/bntl.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntl.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntl.c.o.d"
+  "/root/repo/src/tao/bound/impls/bnk/bntr.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntr.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntr.c.o.d"
+  "/root/repo/src/tao/bound/impls/bqnk/bqnk.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnk.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnk.c.o.d"
+  "/root/repo/src/tao/bound/impls/bqnk/bqnkls.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnkls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnkls.c.o.d"
+  "/root/repo/src/tao/bound/impls/bqnk/bqnktl.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktl.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktl.c.o.d"
+  "/root/repo/src/tao/bound/impls/bqnk/bqnktr.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktr.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktr.c.o.d"
+  "/root/repo/src/tao/bound/impls/bqnls/bqnls.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnls/bqnls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnls/bqnls.c.o.d"
+  "/root/repo/src/tao/bound/impls/tron/tron.c" "CMakeFiles/petsc.dir/src/tao/bound/impls/tron/tron.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/impls/tron/tron.c.o.d"
+  "/root/repo/src/tao/bound/utils/isutil.c" "CMakeFiles/petsc.dir/src/tao/bound/utils/isutil.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/bound/utils/isutil.c.o.d"
+  "/root/repo/src/tao/complementarity/impls/asls/asfls.c" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asfls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asfls.c.o.d"
+  "/root/repo/src/tao/complementarity/impls/asls/asils.c" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asils.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asils.c.o.d"
+  "/root/repo/src/tao/complementarity/impls/ssls/ssfls.c" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssfls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssfls.c.o.d"
+  "/root/repo/src/tao/complementarity/impls/ssls/ssils.c" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssils.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssils.c.o.d"
+  "/root/repo/src/tao/complementarity/impls/ssls/ssls.c" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssls.c.o.d"
+  "/root/repo/src/tao/constrained/impls/ipm/ipm.c" "CMakeFiles/petsc.dir/src/tao/constrained/impls/ipm/ipm.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/constrained/impls/ipm/ipm.c.o.d"
+  "/root/repo/src/tao/interface/dlregistao.c" "CMakeFiles/petsc.dir/src/tao/interface/dlregistao.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/dlregistao.c.o.d"
+  "/root/repo/src/tao/interface/fdiff.c" "CMakeFiles/petsc.dir/src/tao/interface/fdiff.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/fdiff.c.o.d"
+  "/root/repo/src/tao/interface/taosolver.c" "CMakeFiles/petsc.dir/src/tao/interface/taosolver.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/taosolver.c.o.d"
+  "/root/repo/src/tao/interface/taosolver_bounds.c" "CMakeFiles/petsc.dir/src/tao/interface/taosolver_bounds.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/taosolver_bounds.c.o.d"
+  "/root/repo/src/tao/interface/taosolver_fg.c" "CMakeFiles/petsc.dir/src/tao/interface/taosolver_fg.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/taosolver_fg.c.o.d"
+  "/root/repo/src/tao/interface/taosolver_hj.c" "CMakeFiles/petsc.dir/src/tao/interface/taosolver_hj.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/taosolver_hj.c.o.d"
+  "/root/repo/src/tao/interface/taosolverregi.c" "CMakeFiles/petsc.dir/src/tao/interface/taosolverregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/interface/taosolverregi.c.o.d"
+  "/root/repo/src/tao/leastsquares/impls/brgn/brgn.c" "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/brgn/brgn.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/brgn/brgn.c.o.d"
+  "/root/repo/src/tao/leastsquares/impls/pounders/gqt.c" "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/gqt.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/gqt.c.o.d"
+  "/root/repo/src/tao/leastsquares/impls/pounders/pounders.c" "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/pounders.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/pounders.c.o.d"
+  "/root/repo/src/tao/linesearch/impls/armijo/armijo.c" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/armijo/armijo.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/armijo/armijo.c.o.d"
+  "/root/repo/src/tao/linesearch/impls/gpcglinesearch/gpcglinesearch.c" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/gpcglinesearch/gpcglinesearch.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/gpcglinesearch/gpcglinesearch.c.o.d"
+  "/root/repo/src/tao/linesearch/impls/morethuente/morethuente.c" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/morethuente/morethuente.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/morethuente/morethuente.c.o.d"
+  "/root/repo/src/tao/linesearch/impls/owarmijo/owarmijo.c" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/owarmijo/owarmijo.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/owarmijo/owarmijo.c.o.d"
+  "/root/repo/src/tao/linesearch/impls/unit/unit.c" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/unit/unit.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/impls/unit/unit.c.o.d"
+  "/root/repo/src/tao/linesearch/interface/dlregis_taolinesearch.c" "CMakeFiles/petsc.dir/src/tao/linesearch/interface/dlregis_taolinesearch.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/interface/dlregis_taolinesearch.c.o.d"
+  "/root/repo/src/tao/linesearch/interface/taolinesearch.c" "CMakeFiles/petsc.dir/src/tao/linesearch/interface/taolinesearch.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/linesearch/interface/taolinesearch.c.o.d"
+  "/root/repo/src/tao/matrix/adamat.c" "CMakeFiles/petsc.dir/src/tao/matrix/adamat.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/matrix/adamat.c.o.d"
+  "/root/repo/src/tao/matrix/submatfree.c" "CMakeFiles/petsc.dir/src/tao/matrix/submatfree.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/matrix/submatfree.c.o.d"
+  "/root/repo/src/tao/pde_constrained/impls/lcl/lcl.c" "CMakeFiles/petsc.dir/src/tao/pde_constrained/impls/lcl/lcl.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/pde_constrained/impls/lcl/lcl.c.o.d"
+  "/root/repo/src/tao/quadratic/impls/bqpip/bqpip.c" "CMakeFiles/petsc.dir/src/tao/quadratic/impls/bqpip/bqpip.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/quadratic/impls/bqpip/bqpip.c.o.d"
+  "/root/repo/src/tao/quadratic/impls/gpcg/gpcg.c" "CMakeFiles/petsc.dir/src/tao/quadratic/impls/gpcg/gpcg.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/quadratic/impls/gpcg/gpcg.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/bmrm/bmrm.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/bmrm/bmrm.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/bmrm/bmrm.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/cg/taocg.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/cg/taocg.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/cg/taocg.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/lmvm/lmvm.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/lmvm/lmvm.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/lmvm/lmvm.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/neldermead/neldermead.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/neldermead/neldermead.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/neldermead/neldermead.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/nls/nls.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/nls/nls.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/nls/nls.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/ntl/ntl.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntl/ntl.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntl/ntl.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/ntr/ntr.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntr/ntr.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntr/ntr.c.o.d"
+  "/root/repo/src/tao/unconstrained/impls/owlqn/owlqn.c" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/owlqn/owlqn.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/owlqn/owlqn.c.o.d"
+  "/root/repo/src/tao/util/tao_util.c" "CMakeFiles/petsc.dir/src/tao/util/tao_util.c.o" "gcc" "CMakeFiles/petsc.dir/src/tao/util/tao_util.c.o.d"
+  "/root/repo/src/ts/adapt/impls/basic/adaptbasic.c" "CMakeFiles/petsc.dir/src/ts/adapt/impls/basic/adaptbasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/impls/basic/adaptbasic.c.o.d"
+  "/root/repo/src/ts/adapt/impls/cfl/adaptcfl.c" "CMakeFiles/petsc.dir/src/ts/adapt/impls/cfl/adaptcfl.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/impls/cfl/adaptcfl.c.o.d"
+  "/root/repo/src/ts/adapt/impls/dsp/adaptdsp.c" "CMakeFiles/petsc.dir/src/ts/adapt/impls/dsp/adaptdsp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/impls/dsp/adaptdsp.c.o.d"
+  "/root/repo/src/ts/adapt/impls/glee/adaptglee.c" "CMakeFiles/petsc.dir/src/ts/adapt/impls/glee/adaptglee.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/impls/glee/adaptglee.c.o.d"
+  "/root/repo/src/ts/adapt/impls/history/adapthist.c" "CMakeFiles/petsc.dir/src/ts/adapt/impls/history/adapthist.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/impls/history/adapthist.c.o.d"
+  "/root/repo/src/ts/adapt/impls/none/adaptnone.c" "CMakeFiles/petsc.dir/src/ts/adapt/impls/none/adaptnone.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/impls/none/adaptnone.c.o.d"
+  "/root/repo/src/ts/adapt/interface/tsadapt.c" "CMakeFiles/petsc.dir/src/ts/adapt/interface/tsadapt.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/adapt/interface/tsadapt.c.o.d"
+  "/root/repo/src/ts/characteristic/impls/da/slda.c" "CMakeFiles/petsc.dir/src/ts/characteristic/impls/da/slda.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/characteristic/impls/da/slda.c.o.d"
+  "/root/repo/src/ts/characteristic/interface/characteristic.c" "CMakeFiles/petsc.dir/src/ts/characteristic/interface/characteristic.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/characteristic/interface/characteristic.c.o.d"
+  "/root/repo/src/ts/characteristic/interface/mocregis.c" "CMakeFiles/petsc.dir/src/ts/characteristic/interface/mocregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/characteristic/interface/mocregis.c.o.d"
+  "/root/repo/src/ts/characteristic/interface/slregis.c" "CMakeFiles/petsc.dir/src/ts/characteristic/interface/slregis.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/characteristic/interface/slregis.c.o.d"
+  "/root/repo/src/ts/event/tsevent.c" "CMakeFiles/petsc.dir/src/ts/event/tsevent.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/event/tsevent.c.o.d"
+  "/root/repo/src/ts/impls/arkimex/arkimex.c" "CMakeFiles/petsc.dir/src/ts/impls/arkimex/arkimex.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/arkimex/arkimex.c.o.d"
+  "/root/repo/src/ts/impls/bdf/bdf.c" "CMakeFiles/petsc.dir/src/ts/impls/bdf/bdf.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/bdf/bdf.c.o.d"
+  "/root/repo/src/ts/impls/eimex/eimex.c" "CMakeFiles/petsc.dir/src/ts/impls/eimex/eimex.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/eimex/eimex.c.o.d"
+  "/root/repo/src/ts/impls/explicit/euler/euler.c" "CMakeFiles/petsc.dir/src/ts/impls/explicit/euler/euler.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/explicit/euler/euler.c.o.d"
+  "/root/repo/src/ts/impls/explicit/rk/rk.c" "CMakeFiles/petsc.dir/src/ts/impls/explicit/rk/rk.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/explicit/rk/rk.c.o.d"
+  "/root/repo/src/ts/impls/explicit/ssp/ssp.c" "CMakeFiles/petsc.dir/src/ts/impls/explicit/ssp/ssp.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/explicit/ssp/ssp.c.o.d"
+  "/root/repo/src/ts/impls/glee/glee.c" "CMakeFiles/petsc.dir/src/ts/impls/glee/glee.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/glee/glee.c.o.d"
+  "/root/repo/src/ts/impls/implicit/alpha/alpha1.c" "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha1.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha1.c.o.d"
+  "/root/repo/src/ts/impls/implicit/alpha/alpha2.c" "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha2.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha2.c.o.d"
+  "/root/repo/src/ts/impls/implicit/glle/glle.c" "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glle.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glle.c.o.d"
+  "/root/repo/src/ts/impls/implicit/glle/glleadapt.c" "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glleadapt.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glleadapt.c.o.d"
+  "/root/repo/src/ts/impls/implicit/theta/theta.c" "CMakeFiles/petsc.dir/src/ts/impls/implicit/theta/theta.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/implicit/theta/theta.c.o.d"
+  "/root/repo/src/ts/impls/mimex/mimex.c" "CMakeFiles/petsc.dir/src/ts/impls/mimex/mimex.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/mimex/mimex.c.o.d"
+  "/root/repo/src/ts/impls/pseudo/posindep.c" "CMakeFiles/petsc.dir/src/ts/impls/pseudo/posindep.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/pseudo/posindep.c.o.d"
+  "/root/repo/src/ts/impls/python/pythonts.c" "CMakeFiles/petsc.dir/src/ts/impls/python/pythonts.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/python/pythonts.c.o.d"
+  "/root/repo/src/ts/impls/rosw/rosw.c" "CMakeFiles/petsc.dir/src/ts/impls/rosw/rosw.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/rosw/rosw.c.o.d"
+  "/root/repo/src/ts/impls/symplectic/basicsymplectic/basicsymplectic.c" "CMakeFiles/petsc.dir/src/ts/impls/symplectic/basicsymplectic/basicsymplectic.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/impls/symplectic/basicsymplectic/basicsymplectic.c.o.d"
+  "/root/repo/src/ts/interface/dlregists.c" "CMakeFiles/petsc.dir/src/ts/interface/dlregists.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/dlregists.c.o.d"
+  "/root/repo/src/ts/interface/sensitivity/tssen.c" "CMakeFiles/petsc.dir/src/ts/interface/sensitivity/tssen.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/sensitivity/tssen.c.o.d"
+  "/root/repo/src/ts/interface/ts.c" "CMakeFiles/petsc.dir/src/ts/interface/ts.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/ts.c.o.d"
+  "/root/repo/src/ts/interface/tscreate.c" "CMakeFiles/petsc.dir/src/ts/interface/tscreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/tscreate.c.o.d"
+  "/root/repo/src/ts/interface/tseig.c" "CMakeFiles/petsc.dir/src/ts/interface/tseig.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/tseig.c.o.d"
+  "/root/repo/src/ts/interface/tshistory.c" "CMakeFiles/petsc.dir/src/ts/interface/tshistory.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/tshistory.c.o.d"
+  "/root/repo/src/ts/interface/tsreg.c" "CMakeFiles/petsc.dir/src/ts/interface/tsreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/tsreg.c.o.d"
+  "/root/repo/src/ts/interface/tsregall.c" "CMakeFiles/petsc.dir/src/ts/interface/tsregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/tsregall.c.o.d"
+  "/root/repo/src/ts/interface/tsrhssplit.c" "CMakeFiles/petsc.dir/src/ts/interface/tsrhssplit.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/interface/tsrhssplit.c.o.d"
+  "/root/repo/src/ts/trajectory/impls/basic/trajbasic.c" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/basic/trajbasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/basic/trajbasic.c.o.d"
+  "/root/repo/src/ts/trajectory/impls/memory/trajmemory.c" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/memory/trajmemory.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/memory/trajmemory.c.o.d"
+  "/root/repo/src/ts/trajectory/impls/singlefile/singlefile.c" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/singlefile/singlefile.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/singlefile/singlefile.c.o.d"
+  "/root/repo/src/ts/trajectory/impls/visualization/trajvisualization.c" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/visualization/trajvisualization.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/trajectory/impls/visualization/trajvisualization.c.o.d"
+  "/root/repo/src/ts/trajectory/interface/traj.c" "CMakeFiles/petsc.dir/src/ts/trajectory/interface/traj.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/trajectory/interface/traj.c.o.d"
+  "/root/repo/src/ts/trajectory/utils/reconstruct.c" "CMakeFiles/petsc.dir/src/ts/trajectory/utils/reconstruct.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/trajectory/utils/reconstruct.c.o.d"
+  "/root/repo/src/ts/utils/dmdats.c" "CMakeFiles/petsc.dir/src/ts/utils/dmdats.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/utils/dmdats.c.o.d"
+  "/root/repo/src/ts/utils/dmlocalts.c" "CMakeFiles/petsc.dir/src/ts/utils/dmlocalts.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/utils/dmlocalts.c.o.d"
+  "/root/repo/src/ts/utils/dmplexts.c" "CMakeFiles/petsc.dir/src/ts/utils/dmplexts.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/utils/dmplexts.c.o.d"
+  "/root/repo/src/ts/utils/dmts.c" "CMakeFiles/petsc.dir/src/ts/utils/dmts.c.o" "gcc" "CMakeFiles/petsc.dir/src/ts/utils/dmts.c.o.d"
+  "/root/repo/src/vec/is/ao/impls/basic/aobasic.c" "CMakeFiles/petsc.dir/src/vec/is/ao/impls/basic/aobasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/impls/basic/aobasic.c.o.d"
+  "/root/repo/src/vec/is/ao/impls/mapping/aomapping.c" "CMakeFiles/petsc.dir/src/vec/is/ao/impls/mapping/aomapping.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/impls/mapping/aomapping.c.o.d"
+  "/root/repo/src/vec/is/ao/impls/memscalable/aomemscalable.c" "CMakeFiles/petsc.dir/src/vec/is/ao/impls/memscalable/aomemscalable.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/impls/memscalable/aomemscalable.c.o.d"
+  "/root/repo/src/vec/is/ao/interface/ao.c" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/ao.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/ao.c.o.d"
+  "/root/repo/src/vec/is/ao/interface/aoreg.c" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoreg.c.o.d"
+  "/root/repo/src/vec/is/ao/interface/aoregall.c" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoregall.c.o.d"
+  "/root/repo/src/vec/is/ao/interface/dlregisdm.c" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/dlregisdm.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/ao/interface/dlregisdm.c.o.d"
+  "/root/repo/src/vec/is/is/impls/block/block.c" "CMakeFiles/petsc.dir/src/vec/is/is/impls/block/block.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/impls/block/block.c.o.d"
+  "/root/repo/src/vec/is/is/impls/general/general.c" "CMakeFiles/petsc.dir/src/vec/is/is/impls/general/general.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/impls/general/general.c.o.d"
+  "/root/repo/src/vec/is/is/impls/stride/stride.c" "CMakeFiles/petsc.dir/src/vec/is/is/impls/stride/stride.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/impls/stride/stride.c.o.d"
+  "/root/repo/src/vec/is/is/interface/index.c" "CMakeFiles/petsc.dir/src/vec/is/is/interface/index.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/interface/index.c.o.d"
+  "/root/repo/src/vec/is/is/interface/isreg.c" "CMakeFiles/petsc.dir/src/vec/is/is/interface/isreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/interface/isreg.c.o.d"
+  "/root/repo/src/vec/is/is/interface/isregall.c" "CMakeFiles/petsc.dir/src/vec/is/is/interface/isregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/interface/isregall.c.o.d"
+  "/root/repo/src/vec/is/is/utils/isblock.c" "CMakeFiles/petsc.dir/src/vec/is/is/utils/isblock.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/utils/isblock.c.o.d"
+  "/root/repo/src/vec/is/is/utils/iscoloring.c" "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscoloring.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscoloring.c.o.d"
+  "/root/repo/src/vec/is/is/utils/iscomp.c" "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscomp.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscomp.c.o.d"
+  "/root/repo/src/vec/is/is/utils/isdiff.c" "CMakeFiles/petsc.dir/src/vec/is/is/utils/isdiff.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/is/utils/isdiff.c.o.d"
+  "/root/repo/src/vec/is/sf/impls/basic/sfbasic.c" "CMakeFiles/petsc.dir/src/vec/is/sf/impls/basic/sfbasic.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/sf/impls/basic/sfbasic.c.o.d"
+  "/root/repo/src/vec/is/sf/impls/window/sfwindow.c" "CMakeFiles/petsc.dir/src/vec/is/sf/impls/window/sfwindow.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/sf/impls/window/sfwindow.c.o.d"
+  "/root/repo/src/vec/is/sf/interface/dlregissf.c" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/dlregissf.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/dlregissf.c.o.d"
+  "/root/repo/src/vec/is/sf/interface/sf.c" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sf.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sf.c.o.d"
+  "/root/repo/src/vec/is/sf/interface/sfregi.c" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sfregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sfregi.c.o.d"
+  "/root/repo/src/vec/is/sf/interface/sftype.c" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sftype.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sftype.c.o.d"
+  "/root/repo/src/vec/is/utils/isio.c" "CMakeFiles/petsc.dir/src/vec/is/utils/isio.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/utils/isio.c.o.d"
+  "/root/repo/src/vec/is/utils/isltog.c" "CMakeFiles/petsc.dir/src/vec/is/utils/isltog.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/utils/isltog.c.o.d"
+  "/root/repo/src/vec/is/utils/pmap.c" "CMakeFiles/petsc.dir/src/vec/is/utils/pmap.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/utils/pmap.c.o.d"
+  "/root/repo/src/vec/is/utils/vsectionis.c" "CMakeFiles/petsc.dir/src/vec/is/utils/vsectionis.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/is/utils/vsectionis.c.o.d"
+  "/root/repo/src/vec/pf/impls/constant/const.c" "CMakeFiles/petsc.dir/src/vec/pf/impls/constant/const.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/pf/impls/constant/const.c.o.d"
+  "/root/repo/src/vec/pf/impls/string/cstring.c" "CMakeFiles/petsc.dir/src/vec/pf/impls/string/cstring.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/pf/impls/string/cstring.c.o.d"
+  "/root/repo/src/vec/pf/interface/pf.c" "CMakeFiles/petsc.dir/src/vec/pf/interface/pf.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/pf/interface/pf.c.o.d"
+  "/root/repo/src/vec/pf/interface/pfall.c" "CMakeFiles/petsc.dir/src/vec/pf/interface/pfall.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/pf/interface/pfall.c.o.d"
+  "/root/repo/src/vec/vec/impls/mpi/commonmpvec.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/commonmpvec.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/commonmpvec.c.o.d"
+  "/root/repo/src/vec/vec/impls/mpi/pbvec.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pbvec.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pbvec.c.o.d"
+  "/root/repo/src/vec/vec/impls/mpi/pdvec.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pdvec.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pdvec.c.o.d"
+  "/root/repo/src/vec/vec/impls/mpi/pvec2.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pvec2.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pvec2.c.o.d"
+  "/root/repo/src/vec/vec/impls/mpi/vmpicr.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/vmpicr.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/vmpicr.c.o.d"
+  "/root/repo/src/vec/vec/impls/nest/vecnest.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/nest/vecnest.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/nest/vecnest.c.o.d"
+  "/root/repo/src/vec/vec/impls/node/vecnode.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/node/vecnode.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/node/vecnode.c.o.d"
+  "/root/repo/src/vec/vec/impls/seq/bvec1.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec1.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec1.c.o.d"
+  "/root/repo/src/vec/vec/impls/seq/bvec2.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec2.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec2.c.o.d"
+  "/root/repo/src/vec/vec/impls/seq/bvec3.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec3.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec3.c.o.d"
+  "/root/repo/src/vec/vec/impls/seq/dvec2.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/dvec2.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/dvec2.c.o.d"
+  "/root/repo/src/vec/vec/impls/seq/vseqcr.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/vseqcr.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/vseqcr.c.o.d"
+  "/root/repo/src/vec/vec/impls/shared/shvec.c" "CMakeFiles/petsc.dir/src/vec/vec/impls/shared/shvec.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/impls/shared/shvec.c.o.d"
+  "/root/repo/src/vec/vec/interface/dlregisvec.c" "CMakeFiles/petsc.dir/src/vec/vec/interface/dlregisvec.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/interface/dlregisvec.c.o.d"
+  "/root/repo/src/vec/vec/interface/rvector.c" "CMakeFiles/petsc.dir/src/vec/vec/interface/rvector.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/interface/rvector.c.o.d"
+  "/root/repo/src/vec/vec/interface/veccreate.c" "CMakeFiles/petsc.dir/src/vec/vec/interface/veccreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/interface/veccreate.c.o.d"
+  "/root/repo/src/vec/vec/interface/vecreg.c" "CMakeFiles/petsc.dir/src/vec/vec/interface/vecreg.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/interface/vecreg.c.o.d"
+  "/root/repo/src/vec/vec/interface/vecregall.c" "CMakeFiles/petsc.dir/src/vec/vec/interface/vecregall.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/interface/vecregall.c.o.d"
+  "/root/repo/src/vec/vec/interface/vector.c" "CMakeFiles/petsc.dir/src/vec/vec/interface/vector.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/interface/vector.c.o.d"
+  "/root/repo/src/vec/vec/utils/comb.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/comb.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/comb.c.o.d"
+  "/root/repo/src/vec/vec/utils/projection.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/projection.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/projection.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/absolute.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/absolute.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/absolute.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/and.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/and.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/and.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/andor.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/andor.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/andor.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/cdf.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/cdf.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/cdf.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/or.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/or.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/or.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/relative.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/relative.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/relative.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/impls/simple.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/simple.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/simple.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/interface/dlregistagger.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/dlregistagger.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/dlregistagger.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/interface/tagger.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/tagger.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/tagger.c.o.d"
+  "/root/repo/src/vec/vec/utils/tagger/interface/taggerregi.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/taggerregi.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/taggerregi.c.o.d"
+  "/root/repo/src/vec/vec/utils/vecglvis.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecglvis.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecglvis.c.o.d"
+  "/root/repo/src/vec/vec/utils/vecio.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecio.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecio.c.o.d"
+  "/root/repo/src/vec/vec/utils/vecmpitoseq.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecmpitoseq.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecmpitoseq.c.o.d"
+  "/root/repo/src/vec/vec/utils/vecs.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecs.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecs.c.o.d"
+  "/root/repo/src/vec/vec/utils/vecstash.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecstash.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vecstash.c.o.d"
+  "/root/repo/src/vec/vec/utils/vinv.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vinv.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vinv.c.o.d"
+  "/root/repo/src/vec/vec/utils/vsection.c" "CMakeFiles/petsc.dir/src/vec/vec/utils/vsection.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vec/utils/vsection.c.o.d"
+  "/root/repo/src/vec/vscat/impls/mpi1/vpscat_mpi1.c" "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi1/vpscat_mpi1.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi1/vpscat_mpi1.c.o.d"
+  "/root/repo/src/vec/vscat/impls/mpi3/vpscat.c" "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi3/vpscat.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi3/vpscat.c.o.d"
+  "/root/repo/src/vec/vscat/impls/seq/seqvscat.c" "CMakeFiles/petsc.dir/src/vec/vscat/impls/seq/seqvscat.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/impls/seq/seqvscat.c.o.d"
+  "/root/repo/src/vec/vscat/impls/vscat.c" "CMakeFiles/petsc.dir/src/vec/vscat/impls/vscat.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/impls/vscat.c.o.d"
+  "/root/repo/src/vec/vscat/interface/dlregisvecscat.c" "CMakeFiles/petsc.dir/src/vec/vscat/interface/dlregisvecscat.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/interface/dlregisvecscat.c.o.d"
+  "/root/repo/src/vec/vscat/interface/vscatfce.c" "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscatfce.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscatfce.c.o.d"
+  "/root/repo/src/vec/vscat/interface/vscreate.c" "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscreate.c.o" "gcc" "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscreate.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,1667 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/lagrange/dspacelagrange.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/lagrange/dspacelagrange.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/simple/dspacesimple.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/dualspace/impls/simple/dspacesimple.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/dualspace/interface/dualspace.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/dualspace/interface/dualspace.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/basic/febasic.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/basic/febasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/composite/fecomposite.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/impls/composite/fecomposite.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fe.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fe.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fegeom.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/fe/interface/fegeom.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/interface/dt.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/interface/dt.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/interface/dtds.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/interface/dtds.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/interface/dtfv.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/interface/dtfv.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/point/spacepoint.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/point/spacepoint.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/poly/spacepoly.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/poly/spacepoly.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/subspace/spacesubspace.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/subspace/spacesubspace.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/tensor/spacetensor.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/impls/tensor/spacetensor.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/interface/space.c.o"
+  "CMakeFiles/petsc.dir/src/dm/dt/space/interface/space.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/field/impls/da/dmfieldda.c.o"
+  "CMakeFiles/petsc.dir/src/dm/field/impls/da/dmfieldda.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/field/impls/ds/dmfieldds.c.o"
+  "CMakeFiles/petsc.dir/src/dm/field/impls/ds/dmfieldds.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/field/impls/shell/dmfieldshell.c.o"
+  "CMakeFiles/petsc.dir/src/dm/field/impls/shell/dmfieldshell.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/field/interface/dlregisdmfield.c.o"
+  "CMakeFiles/petsc.dir/src/dm/field/interface/dlregisdmfield.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/field/interface/dmfield.c.o"
+  "CMakeFiles/petsc.dir/src/dm/field/interface/dmfield.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/field/interface/dmfieldregi.c.o"
+  "CMakeFiles/petsc.dir/src/dm/field/interface/dmfieldregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/composite/pack.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/composite/pack.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/composite/packm.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/composite/packm.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da1.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da1.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da2.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da2.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da3.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/da3.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dacorn.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dacorn.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dacreate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dacreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dadd.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dadd.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dadestroy.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dadestroy.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dadist.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dadist.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dageometry.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dageometry.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagetarray.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagetarray.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagetelem.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagetelem.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daghost.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daghost.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagtol.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagtol.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagtona.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dagtona.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daindex.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daindex.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dainterp.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dainterp.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dalocal.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dalocal.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daltol.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daltol.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dapf.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dapf.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dapreallocate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dapreallocate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dareg.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dareg.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dascatter.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dascatter.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dasub.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/dasub.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daview.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/daview.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/fdda.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/fdda.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/gr1.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/gr1.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/gr2.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/gr2.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/grglvis.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/grglvis.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/grvtk.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/da/grvtk.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/forest/forest.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/forest/forest.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/network/network.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/network/network.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/network/networkcreate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/network/networkcreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/network/networkmonitor.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/network/networkmonitor.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/patch/patch.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/patch/patch.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/patch/patchcreate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/patch/patchcreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/glexg.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/glexg.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/petscpartmatpart.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/petscpartmatpart.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plex.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plex.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexadapt.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexadapt.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcgns.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcgns.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcheckinterface.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcheckinterface.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcoarsen.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcoarsen.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcreate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexcreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexdistribute.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexdistribute.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexexodusii.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexexodusii.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfem.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfem.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfluent.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfluent.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfvm.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexfvm.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgenerate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgenerate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgeometry.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgeometry.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexglvis.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexglvis.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgmsh.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexgmsh.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5xdmf.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexhdf5xdmf.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexindices.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexindices.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexinterpolate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexinterpolate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexmed.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexmed.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexnatural.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexnatural.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexorient.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexorient.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpartition.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpartition.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexply.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexply.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpoint.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpoint.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpreallocate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexpreallocate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexproject.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexproject.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexrefine.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexrefine.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexreorder.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexreorder.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsection.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsection.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsubmesh.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexsubmesh.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plextree.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plextree.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtk.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtk.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtu.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/plex/plexvtu.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/product/product.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/product/product.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/product/productutils.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/product/productutils.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/redundant/dmredundant.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/redundant/dmredundant.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/shell/dmshell.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/shell/dmshell.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/sliced/sliced.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/sliced/sliced.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag1d.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag1d.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag2d.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag2d.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag3d.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stag3d.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stagda.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stagda.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stagstencil.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stagstencil.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stagutils.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/stag/stagutils.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_bucket.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_bucket.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_ex.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/data_ex.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm_migrate.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarm_migrate.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_da.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_da.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_plex.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_plex.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_sort.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_sort.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_view.c.o"
+  "CMakeFiles/petsc.dir/src/dm/impls/swarm/swarmpic_view.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/interface/dlregisdmdm.c.o"
+  "CMakeFiles/petsc.dir/src/dm/interface/dlregisdmdm.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/interface/dm.c.o"
+  "CMakeFiles/petsc.dir/src/dm/interface/dm.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmget.c.o"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmget.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmglvis.c.o"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmglvis.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmi.c.o"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmi.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmregall.c.o"
+  "CMakeFiles/petsc.dir/src/dm/interface/dmregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/dm/label/dmlabel.c.o"
+  "CMakeFiles/petsc.dir/src/dm/label/dmlabel.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/fischer/fischer.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/fischer/fischer.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/pod/pod.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/guess/impls/pod/pod.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/bcgs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/bcgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgs/fbcgs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgs/fbcgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgsr/fbcgsr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/fbcgsr/fbcgsr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/pipebcgs/pipebcgs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgs/pipebcgs/pipebcgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgsl/bcgsl.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bcgsl/bcgsl.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bicg/bicg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/bicg/bicg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgeig.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgeig.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgls.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgls.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgne/cgne.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgne/cgne.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgtype.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/cgtype.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/gltr/gltr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/gltr/gltr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/groppcg/groppcg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/groppcg/groppcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/nash/nash.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/nash/nash.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecg/pipecg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecg/pipecg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecgrr/pipecgrr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipecgrr/pipecgrr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipelcg/pipelcg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/pipelcg/pipelcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/stcg/stcg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cg/stcg/stcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cgs/cgs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cgs/cgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cheby/cheby.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cheby/cheby.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/cr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/cr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/pipecr/pipecr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/cr/pipecr/pipecr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/fcg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/fcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/pipefcg/pipefcg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fcg/pipefcg/pipefcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fetidp/fetidp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/fetidp/fetidp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/gcr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/gcr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/pipegcr/pipegcr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gcr/pipegcr/pipegcr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresdeflation.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresdeflation.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresleja.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresleja.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresorthog.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/agmres/agmresorthog.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog2.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/borthog2.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/dgmres/dgmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/dgmres/dgmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/fgmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/fgmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/modpcf.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/fgmres/modpcf.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmpre.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmpre.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmreig.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmreig.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres2.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/gmres2.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/lgmres/lgmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/lgmres/lgmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pgmres/pgmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pgmres/pgmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pipefgmres/pipefgmres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/gmres/pipefgmres/pipefgmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/ibcgs/ibcgs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/ibcgs/ibcgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lcd/lcd.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lcd/lcd.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lsqr/lsqr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/lsqr/lsqr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/minres/minres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/minres/minres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/preonly/preonly.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/preonly/preonly.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/python/pythonksp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/python/pythonksp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/qcg/qcg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/qcg/qcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/rich.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/rich.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/richscale.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/rich/richscale.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/symmlq/symmlq.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/symmlq/symmlq.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tcqmr/tcqmr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tcqmr/tcqmr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tfqmr/tfqmr.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tfqmr/tfqmr.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tsirm/tsirm.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/impls/tsirm/tsirm.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dlregisksp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dlregisksp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dmksp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/dmksp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/eige.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/eige.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iguess.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iguess.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcl.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcl.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcreate.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itcreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iterativ.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/iterativ.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itfunc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itfunc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itregis.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itres.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/itres.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/xmon.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/interface/xmon.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/dmproject.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/dmproject.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/kspmatregi.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/kspmatregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/badbrdn/badbrdn.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/badbrdn/badbrdn.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/bfgs/bfgs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/bfgs/bfgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/brdn/brdn.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/brdn/brdn.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/dfp/dfp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/dfp/dfp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/diagbrdn/diagbrdn.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/diagbrdn/diagbrdn.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmimpl.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmimpl.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmutils.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/lmvmutils.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/sr1/sr1.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/sr1/sr1.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbadbrdn.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbadbrdn.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbrdn.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/lmvm/symbrdn/symbrdn.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/schurm/schurm.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/ksp/utils/schurm/schurm.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/asm/asm.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/asm/asm.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcfetidp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcfetidp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcgraph.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcgraph.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcnullspace.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcnullspace.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcprivate.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcprivate.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcscalingbasic.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcscalingbasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcschurs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bddc/bddcschurs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bjacobi/bjacobi.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/bjacobi/bjacobi.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/composite/composite.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/composite/composite.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/cp/cp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/cp/cp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/eisens/eisen.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/eisens/eisen.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/cholesky/cholesky.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/cholesky/cholesky.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factimpl.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factimpl.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factor.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/factor.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/icc/icc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/icc/icc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/ilu/ilu.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/ilu/ilu.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/lu/lu.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/factor/lu/lu.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/fieldsplit/fieldsplit.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/fieldsplit/fieldsplit.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/galerkin/galerkin.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/galerkin/galerkin.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/agg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/agg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/classical.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/classical.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/gamg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/gamg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/geo.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/geo.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/util.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gamg/util.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gasm/gasm.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/gasm/gasm.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/nn/nn.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/nn/nn.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/pcis.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/is/pcis.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/jacobi/jacobi.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/jacobi/jacobi.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/kaczmarz/kaczmarz.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/kaczmarz/kaczmarz.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/ksp/pcksp.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/ksp/pcksp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/lmvm/lmvmpc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/lmvm/lmvmpc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/lsc/lsc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/lsc/lsc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mat/pcmat.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mat/pcmat.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/fmg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/fmg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mgfunc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/mgfunc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/smg.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/mg/smg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/none/none.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/none/none.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/patch/pcpatch.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/patch/pcpatch.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/pbjacobi/pbjacobi.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/pbjacobi/pbjacobi.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/python/pythonpc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/python/pythonpc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/redistribute/redistribute.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/redistribute/redistribute.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/redundant/redundant.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/redundant/redundant.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/shell/shellpc.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/shell/shellpc.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/sor/sor.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/sor/sor.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/svd/svd.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/svd/svd.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope_dmda.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/telescope/telescope_dmda.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/bitmask.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/bitmask.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/comm.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/comm.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/gs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/gs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/ivec.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/ivec.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/tfs.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/tfs.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xxt.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xxt.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xyt.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/tfs/xyt.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/vpbjacobi/vpbjacobi.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/vpbjacobi/vpbjacobi.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/wb/wb.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/impls/wb/wb.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcregis.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcset.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/interface/pcset.c.o.d"
+  "CMakeFiles/petsc.dir/src/ksp/pc/interface/precon.c.o"
+  "CMakeFiles/petsc.dir/src/ksp/pc/interface/precon.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/coarsen.c.o"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/coarsen.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/impls/hem/hem.c.o"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/impls/hem/hem.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/impls/mis/mis.c.o"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/impls/mis/mis.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/scoarsen.c.o"
+  "CMakeFiles/petsc.dir/src/mat/coarsen/scoarsen.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/greedy/greedy.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/greedy/greedy.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/jp/jp.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/jp/jp.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/color.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/color.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/degr.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/degr.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/dsm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/dsm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/ido.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/ido.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/numsrt.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/numsrt.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/seq.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/seq.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/setr.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/setr.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/slo.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/minpack/slo.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/natural/natural.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/natural/natural.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/power/power.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/impls/power/power.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloring.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloring.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloringregi.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/interface/matcoloringregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/utils/bipartite.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/utils/bipartite.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/utils/valid.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/utils/valid.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/color/utils/weights.c.o"
+  "CMakeFiles/petsc.dir/src/mat/color/utils/weights.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/adj/mpi/mpiadj.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/adj/mpi/mpiadj.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijperm/mpiaijperm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijperm/mpiaijperm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijsell/mpiaijsell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/aijsell/mpiaijsell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/crl/mcrl.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/crl/mcrl.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/fdmpiaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/fdmpiaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mmaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mmaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpb_aij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpb_aij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaijpc.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiaijpc.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmatmult.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmatmult.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmult.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimatmatmult.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimattransposematmult.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpimattransposematmult.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiov.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiov.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiptap.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/mpi/mpiptap.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijfact.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijfact.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijhdf5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijhdf5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijperm/aijperm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijperm/aijperm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijsell/aijsell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/aijsell/aijsell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/basfactor.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/basfactor.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/spbas.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/bas/spbas.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/crl/crl.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/crl/crl.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/fdaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/fdaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/ij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/ij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/inode2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmatmult.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmatmult.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmult.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matmatmult.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matptap.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matptap.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matrart.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/matrart.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/mattransposematmult.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/mattransposematmult.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/symtranspose.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/aij/seq/symtranspose.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/baijov.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/baijov.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mmbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mmbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpb_baij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpb_baij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpibaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/mpi/mpibaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/aijbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/aijbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baij2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact11.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact11.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact13.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact13.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact3.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact3.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact4.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact4.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact7.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact7.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact81.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact81.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact9.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijfact9.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolv.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolv.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat1.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat1.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat11.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat11.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat14.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat14.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat15.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat15.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat3.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat3.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat4.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat4.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat6.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat6.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat7.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvnat7.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran1.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran1.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran3.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran3.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran4.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran4.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran6.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran6.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran7.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtran7.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrann.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrann.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat1.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat1.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat3.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat3.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat4.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat4.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat6.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat6.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat7.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/baijsolvtrannat7.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgedi.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgedi.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa3.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa3.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa4.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa4.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa6.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa6.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa7.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/baij/seq/dgefa7.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/blockmat/seq/blockmat.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/blockmat/seq/blockmat.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/composite/mcomposite.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/composite/mcomposite.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mmdense.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mmdense.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mpidense.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/dense/mpi/mpidense.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/dense/seq/dense.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/dense/seq/dense.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/dummy/matdummy.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/dummy/matdummy.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/fft/fft.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/fft/fft.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/is/matis.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/is/matis.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/localref/mlocalref.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/localref/mlocalref.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/lrc/lrc.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/lrc/lrc.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/maij/maij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/maij/maij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffddef.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/mffddef.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/mfregis.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/mfregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/wp.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/mffd/wp.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/nest/matnest.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/nest/matnest.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/normal/normm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/normal/normm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/normal/normmh.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/normal/normmh.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/preallocator/matpreallocator.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/preallocator/matpreallocator.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/python/pythonmat.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/python/pythonmat.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mmsbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mmsbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpiaijsbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpiaijsbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpisbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/mpisbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/sbaijov.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/mpi/sbaijov.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/aijsbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/aijsbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaij2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact10.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact10.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact11.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact11.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact12.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact12.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact2.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact2.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact3.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact3.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact4.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact4.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact5.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact5.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact6.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact6.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact7.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact7.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact8.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact8.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact9.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sbaijfact9.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sro.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sbaij/seq/sro.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/scatter/mscatter.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/scatter/mscatter.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mmsell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mmsell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mpisell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/mpi/mpisell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/fdsell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/fdsell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/sell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/sell/seq/sell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/shell/shell.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/shell/shell.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/shell/shellcnv.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/shell/shellcnv.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/submat/submat.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/submat/submat.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/transpose/htransm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/transpose/htransm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/impls/transpose/transm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/impls/transpose/transm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/interface/dlregismat.c.o"
+  "CMakeFiles/petsc.dir/src/mat/interface/dlregismat.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/interface/matnull.c.o"
+  "CMakeFiles/petsc.dir/src/mat/interface/matnull.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/interface/matreg.c.o"
+  "CMakeFiles/petsc.dir/src/mat/interface/matreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/interface/matregis.c.o"
+  "CMakeFiles/petsc.dir/src/mat/interface/matregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/interface/matrix.c.o"
+  "CMakeFiles/petsc.dir/src/mat/interface/matrix.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/matfd/fdmatrix.c.o"
+  "CMakeFiles/petsc.dir/src/mat/matfd/fdmatrix.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/degree.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/degree.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/fn1wd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/fn1wd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/fndsep.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/fndsep.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/fnroot.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/fnroot.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/gen1wd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/gen1wd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/gennd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/gennd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/genqmd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/genqmd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/genrcm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/genrcm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdmrg.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdmrg.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdqt.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdqt.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdrch.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdrch.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdupd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/qmdupd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/rcm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/rcm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/rootls.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/rootls.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/sorder.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/sorder.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/sp1wd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/sp1wd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/spectral.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/spectral.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/spnd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/spnd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/spqmd.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/spqmd.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/sprcm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/sprcm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/sregis.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/sregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/order/wbm.c.o"
+  "CMakeFiles/petsc.dir/src/mat/order/wbm.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/partition/impls/hierarchical/hierarchical.c.o"
+  "CMakeFiles/petsc.dir/src/mat/partition/impls/hierarchical/hierarchical.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/partition/partition.c.o"
+  "CMakeFiles/petsc.dir/src/mat/partition/partition.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/partition/spartition.c.o"
+  "CMakeFiles/petsc.dir/src/mat/partition/spartition.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/axpy.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/axpy.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/bandwidth.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/bandwidth.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/compressedrow.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/compressedrow.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/convert.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/convert.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/factorschur.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/factorschur.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/freespace.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/freespace.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/gcreate.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/gcreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/getcolv.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/getcolv.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/matstash.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/matstash.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/matstashspace.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/matstashspace.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/multequal.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/multequal.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/overlapsplit.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/overlapsplit.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/pheap.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/pheap.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/zerodiag.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/zerodiag.c.o.d"
+  "CMakeFiles/petsc.dir/src/mat/utils/zerorows.c.o"
+  "CMakeFiles/petsc.dir/src/mat/utils/zerorows.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/composite/snescomposite.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/composite/snescomposite.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/fas/fas.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/fas/fas.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/fas/fasfunc.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/fas/fasfunc.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/fas/fasgalerkin.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/fas/fasgalerkin.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/gs/gssecant.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/gs/gssecant.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/gs/snesgs.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/gs/snesgs.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ksponly/ksponly.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ksponly/ksponly.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ls/ls.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ls/ls.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ms/ms.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ms/ms.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/nasm/aspin.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/nasm/aspin.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/nasm/nasm.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/nasm/nasm.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ncg/snesncg.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ncg/snesncg.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ngmres/anderson.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ngmres/anderson.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ngmres/ngmresfunc.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ngmres/ngmresfunc.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/ngmres/snesngmres.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/ngmres/snesngmres.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/patch/snespatch.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/patch/snespatch.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/python/pythonsnes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/python/pythonsnes.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/qn/qn.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/qn/qn.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/richardson/snesrichardson.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/richardson/snesrichardson.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/shell/snesshell.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/shell/snesshell.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/tr/tr.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/tr/tr.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/vi/rs/virs.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/vi/rs/virs.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/vi/ss/viss.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/vi/ss/viss.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/impls/vi/vi.c.o"
+  "CMakeFiles/petsc.dir/src/snes/impls/vi/vi.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/dlregissnes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/dlregissnes.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/noise/snesdnest.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/noise/snesdnest.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/noise/snesmfj2.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/noise/snesmfj2.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/noise/snesnoise.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/noise/snesnoise.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snes.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesj.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesj.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesj2.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesj2.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesob.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesob.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snespc.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snespc.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesregi.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesut.c.o"
+  "CMakeFiles/petsc.dir/src/snes/interface/snesut.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/basic/linesearchbasic.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/basic/linesearchbasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/bt/linesearchbt.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/bt/linesearchbt.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/cp/linesearchcp.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/cp/linesearchcp.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/l2/linesearchl2.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/l2/linesearchl2.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/nleqerr/linesearchnleqerr.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/nleqerr/linesearchnleqerr.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/shell/linesearchshell.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/impls/shell/linesearchshell.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearch.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearch.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearchregi.c.o"
+  "CMakeFiles/petsc.dir/src/snes/linesearch/interface/linesearchregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/mf/snesmfj.c.o"
+  "CMakeFiles/petsc.dir/src/snes/mf/snesmfj.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/utils/convest.c.o"
+  "CMakeFiles/petsc.dir/src/snes/utils/convest.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmadapt.c.o"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmadapt.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmdasnes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmdasnes.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmlocalsnes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmlocalsnes.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmplexsnes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmplexsnes.c.o.d"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmsnes.c.o"
+  "CMakeFiles/petsc.dir/src/snes/utils/dmsnes.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/bag/bag.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/bag/bag.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/image/drawimage.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/image/drawimage.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/null/drawnull.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/null/drawnull.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/tikz/tikz.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/impls/tikz/tikz.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dclear.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dclear.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dcoor.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dcoor.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dellipse.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dellipse.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dflush.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dflush.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dline.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dline.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmarker.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmarker.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmouse.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dmouse.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpause.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpause.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpoint.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dpoint.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/draw.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/draw.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawreg.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawregall.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drawregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drect.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/drect.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dsave.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dsave.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtext.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtext.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtri.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dtri.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dviewp.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/interface/dviewp.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axis.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axis.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axisc.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/axisc.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/bars.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/bars.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/cmap.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/cmap.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/dscatter.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/dscatter.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/hists.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/hists.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/image.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/image.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lg.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lg.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lgc.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/lgc.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/zoom.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/draw/utils/zoom.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/gll/petscgll.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/gll/petscgll.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand/rand.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand/rand.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand48/rand48.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rand48/rand48.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rander48/rander48.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/impls/rander48/rander48.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/dlregisrand.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/dlregisrand.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/random.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/random.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randomc.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randomc.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randreg.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/random/interface/randreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/filev.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/filev.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/vcreatea.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/ascii/vcreatea.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/binary/binv.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/binary/binv.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/draw/drawv.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/draw/drawv.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/glvis/glvis.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/glvis/glvis.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/socket/send.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/socket/send.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/string/stringv.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/string/stringv.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vtk/vtkv.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vtk/vtkv.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vu/petscvu.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/impls/vu/petscvu.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dlregispetsc.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dlregispetsc.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dupl.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/dupl.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/flush.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/flush.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/view.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/view.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewa.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewa.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewers.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewers.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewreg.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewregall.c.o"
+  "CMakeFiles/petsc.dir/src/sys/classes/viewer/interface/viewregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/dll/dl.c.o"
+  "CMakeFiles/petsc.dir/src/sys/dll/dl.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/dll/dlimpl.c.o"
+  "CMakeFiles/petsc.dir/src/sys/dll/dlimpl.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/dll/reg.c.o"
+  "CMakeFiles/petsc.dir/src/sys/dll/reg.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/adebug.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/adebug.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/checkptr.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/checkptr.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/err.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/err.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/errabort.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/errabort.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/errstop.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/errstop.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/errtrace.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/errtrace.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/fp.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/fp.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/pstack.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/pstack.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/error/signal.c.o"
+  "CMakeFiles/petsc.dir/src/sys/error/signal.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fdir.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fdir.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fpath.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fpath.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fretrieve.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fretrieve.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/ftest.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/ftest.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fwd.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/fwd.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/ghome.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/ghome.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/grpath.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/grpath.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/mpiuopen.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/mpiuopen.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/mprint.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/mprint.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/rpath.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/rpath.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/smatlab.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/smatlab.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/fileio/sysio.c.o"
+  "CMakeFiles/petsc.dir/src/sys/fileio/sysio.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/info/verboseinfo.c.o"
+  "CMakeFiles/petsc.dir/src/sys/info/verboseinfo.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/plog.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/plog.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/classlog.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/classlog.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/eventlog.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/eventlog.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/stack.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/stack.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/stagelog.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/utils/stagelog.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/xmllogevent.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/xmllogevent.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/logging/xmlviewer.c.o"
+  "CMakeFiles/petsc.dir/src/sys/logging/xmlviewer.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/memory/mal.c.o"
+  "CMakeFiles/petsc.dir/src/sys/memory/mal.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/memory/mem.c.o"
+  "CMakeFiles/petsc.dir/src/sys/memory/mem.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/memory/mhbw.c.o"
+  "CMakeFiles/petsc.dir/src/sys/memory/mhbw.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/memory/mtr.c.o"
+  "CMakeFiles/petsc.dir/src/sys/memory/mtr.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/aoptions.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/aoptions.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/destroy.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/destroy.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/fcallback.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/fcallback.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/gcomm.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/gcomm.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/gcookie.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/gcookie.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/gtype.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/gtype.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/inherit.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/inherit.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/init.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/init.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/olist.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/olist.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/options.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/options.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/pgname.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/pgname.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/pinit.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/pinit.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/pname.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/pname.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/prefix.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/prefix.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/ptype.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/ptype.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/state.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/state.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/subcomm.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/subcomm.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/tagm.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/tagm.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/objects/version.c.o"
+  "CMakeFiles/petsc.dir/src/sys/objects/version.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/python/pythonsys.c.o"
+  "CMakeFiles/petsc.dir/src/sys/python/pythonsys.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/time/cputime.c.o"
+  "CMakeFiles/petsc.dir/src/sys/time/cputime.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/time/fdate.c.o"
+  "CMakeFiles/petsc.dir/src/sys/time/fdate.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/totalview/tv_data_display.c.o"
+  "CMakeFiles/petsc.dir/src/sys/totalview/tv_data_display.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/arch.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/arch.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/ctable.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/ctable.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/fhost.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/fhost.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/fuser.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/fuser.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mathclose.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mathclose.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/matheq.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/matheq.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mathinf.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mathinf.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/memc.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/memc.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpilong.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpilong.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpimesg.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpimesg.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpishm.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpishm.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpitr.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpitr.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpits.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpits.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpiu.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/mpiu.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/pbarrier.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/pbarrier.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/pdisplay.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/pdisplay.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/psleep.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/psleep.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/psplit.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/psplit.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/segbuffer.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/segbuffer.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/sortd.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/sortd.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/sorti.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/sorti.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/sortip.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/sortip.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/sseenabled.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/sseenabled.c.o.d"
+  "CMakeFiles/petsc.dir/src/sys/utils/str.c.o"
+  "CMakeFiles/petsc.dir/src/sys/utils/str.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/blmvm/blmvm.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/blmvm/blmvm.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bncg/bncg.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bncg/bncg.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnk.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnk.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bnls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntl.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntl.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntr.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bnk/bntr.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnk.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnk.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnkls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnkls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktl.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktl.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktr.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnk/bqnktr.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnls/bqnls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/bqnls/bqnls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/tron/tron.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/impls/tron/tron.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/bound/utils/isutil.c.o"
+  "CMakeFiles/petsc.dir/src/tao/bound/utils/isutil.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asfls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asfls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asils.c.o"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/asls/asils.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssfls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssfls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssils.c.o"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssils.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/complementarity/impls/ssls/ssls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/constrained/impls/ipm/ipm.c.o"
+  "CMakeFiles/petsc.dir/src/tao/constrained/impls/ipm/ipm.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/dlregistao.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/dlregistao.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/fdiff.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/fdiff.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver_bounds.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver_bounds.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver_fg.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver_fg.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver_hj.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolver_hj.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolverregi.c.o"
+  "CMakeFiles/petsc.dir/src/tao/interface/taosolverregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/brgn/brgn.c.o"
+  "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/brgn/brgn.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/gqt.c.o"
+  "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/gqt.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/pounders.c.o"
+  "CMakeFiles/petsc.dir/src/tao/leastsquares/impls/pounders/pounders.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/armijo/armijo.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/armijo/armijo.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/gpcglinesearch/gpcglinesearch.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/gpcglinesearch/gpcglinesearch.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/morethuente/morethuente.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/morethuente/morethuente.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/owarmijo/owarmijo.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/owarmijo/owarmijo.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/unit/unit.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/impls/unit/unit.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/interface/dlregis_taolinesearch.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/interface/dlregis_taolinesearch.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/interface/taolinesearch.c.o"
+  "CMakeFiles/petsc.dir/src/tao/linesearch/interface/taolinesearch.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/matrix/adamat.c.o"
+  "CMakeFiles/petsc.dir/src/tao/matrix/adamat.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/matrix/submatfree.c.o"
+  "CMakeFiles/petsc.dir/src/tao/matrix/submatfree.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/pde_constrained/impls/lcl/lcl.c.o"
+  "CMakeFiles/petsc.dir/src/tao/pde_constrained/impls/lcl/lcl.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/quadratic/impls/bqpip/bqpip.c.o"
+  "CMakeFiles/petsc.dir/src/tao/quadratic/impls/bqpip/bqpip.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/quadratic/impls/gpcg/gpcg.c.o"
+  "CMakeFiles/petsc.dir/src/tao/quadratic/impls/gpcg/gpcg.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/bmrm/bmrm.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/bmrm/bmrm.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/cg/taocg.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/cg/taocg.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/lmvm/lmvm.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/lmvm/lmvm.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/neldermead/neldermead.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/neldermead/neldermead.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/nls/nls.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/nls/nls.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntl/ntl.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntl/ntl.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntr/ntr.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/ntr/ntr.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/owlqn/owlqn.c.o"
+  "CMakeFiles/petsc.dir/src/tao/unconstrained/impls/owlqn/owlqn.c.o.d"
+  "CMakeFiles/petsc.dir/src/tao/util/tao_util.c.o"
+  "CMakeFiles/petsc.dir/src/tao/util/tao_util.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/basic/adaptbasic.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/basic/adaptbasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/cfl/adaptcfl.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/cfl/adaptcfl.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/dsp/adaptdsp.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/dsp/adaptdsp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/glee/adaptglee.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/glee/adaptglee.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/history/adapthist.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/history/adapthist.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/none/adaptnone.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/impls/none/adaptnone.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/adapt/interface/tsadapt.c.o"
+  "CMakeFiles/petsc.dir/src/ts/adapt/interface/tsadapt.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/impls/da/slda.c.o"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/impls/da/slda.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/interface/characteristic.c.o"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/interface/characteristic.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/interface/mocregis.c.o"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/interface/mocregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/interface/slregis.c.o"
+  "CMakeFiles/petsc.dir/src/ts/characteristic/interface/slregis.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/event/tsevent.c.o"
+  "CMakeFiles/petsc.dir/src/ts/event/tsevent.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/arkimex/arkimex.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/arkimex/arkimex.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/bdf/bdf.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/bdf/bdf.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/eimex/eimex.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/eimex/eimex.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/explicit/euler/euler.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/explicit/euler/euler.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/explicit/rk/rk.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/explicit/rk/rk.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/explicit/ssp/ssp.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/explicit/ssp/ssp.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/glee/glee.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/glee/glee.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha1.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha1.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha2.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/alpha/alpha2.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glle.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glle.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glleadapt.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/glle/glleadapt.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/theta/theta.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/implicit/theta/theta.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/mimex/mimex.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/mimex/mimex.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/pseudo/posindep.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/pseudo/posindep.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/python/pythonts.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/python/pythonts.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/rosw/rosw.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/rosw/rosw.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/impls/symplectic/basicsymplectic/basicsymplectic.c.o"
+  "CMakeFiles/petsc.dir/src/ts/impls/symplectic/basicsymplectic/basicsymplectic.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/dlregists.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/dlregists.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/sensitivity/tssen.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/sensitivity/tssen.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/ts.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/ts.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/tscreate.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/tscreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/tseig.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/tseig.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/tshistory.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/tshistory.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/tsreg.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/tsreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/tsregall.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/tsregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/interface/tsrhssplit.c.o"
+  "CMakeFiles/petsc.dir/src/ts/interface/tsrhssplit.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/basic/trajbasic.c.o"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/basic/trajbasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/memory/trajmemory.c.o"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/memory/trajmemory.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/singlefile/singlefile.c.o"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/singlefile/singlefile.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/visualization/trajvisualization.c.o"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/impls/visualization/trajvisualization.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/interface/traj.c.o"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/interface/traj.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/utils/reconstruct.c.o"
+  "CMakeFiles/petsc.dir/src/ts/trajectory/utils/reconstruct.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmdats.c.o"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmdats.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmlocalts.c.o"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmlocalts.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmplexts.c.o"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmplexts.c.o.d"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmts.c.o"
+  "CMakeFiles/petsc.dir/src/ts/utils/dmts.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/impls/basic/aobasic.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/impls/basic/aobasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/impls/mapping/aomapping.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/impls/mapping/aomapping.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/impls/memscalable/aomemscalable.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/impls/memscalable/aomemscalable.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/ao.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/ao.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoreg.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoregall.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/aoregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/dlregisdm.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/ao/interface/dlregisdm.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/impls/block/block.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/impls/block/block.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/impls/general/general.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/impls/general/general.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/impls/stride/stride.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/impls/stride/stride.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/interface/index.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/interface/index.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/interface/isreg.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/interface/isreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/interface/isregall.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/interface/isregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/isblock.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/isblock.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscoloring.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscoloring.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscomp.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/iscomp.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/isdiff.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/is/utils/isdiff.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/impls/basic/sfbasic.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/impls/basic/sfbasic.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/impls/window/sfwindow.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/impls/window/sfwindow.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/dlregissf.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/dlregissf.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sf.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sf.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sfregi.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sfregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sftype.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/sf/interface/sftype.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/isio.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/isio.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/isltog.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/isltog.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/pmap.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/pmap.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/vsectionis.c.o"
+  "CMakeFiles/petsc.dir/src/vec/is/utils/vsectionis.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/pf/impls/constant/const.c.o"
+  "CMakeFiles/petsc.dir/src/vec/pf/impls/constant/const.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/pf/impls/string/cstring.c.o"
+  "CMakeFiles/petsc.dir/src/vec/pf/impls/string/cstring.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/pf/interface/pf.c.o"
+  "CMakeFiles/petsc.dir/src/vec/pf/interface/pf.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/pf/interface/pfall.c.o"
+  "CMakeFiles/petsc.dir/src/vec/pf/interface/pfall.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/commonmpvec.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/commonmpvec.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pbvec.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pbvec.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pdvec.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pdvec.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pvec2.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/pvec2.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/vmpicr.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/mpi/vmpicr.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/nest/vecnest.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/nest/vecnest.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/node/vecnode.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/node/vecnode.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec1.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec1.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec2.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec2.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec3.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/bvec3.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/dvec2.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/dvec2.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/vseqcr.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/seq/vseqcr.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/shared/shvec.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/impls/shared/shvec.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/dlregisvec.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/dlregisvec.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/rvector.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/rvector.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/veccreate.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/veccreate.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/vecreg.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/vecreg.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/vecregall.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/vecregall.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/vector.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/interface/vector.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/comb.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/comb.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/projection.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/projection.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/absolute.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/absolute.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/and.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/and.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/andor.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/andor.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/cdf.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/cdf.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/or.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/or.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/relative.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/relative.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/simple.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/impls/simple.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/dlregistagger.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/dlregistagger.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/tagger.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/tagger.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/taggerregi.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/tagger/interface/taggerregi.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecglvis.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecglvis.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecio.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecio.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecmpitoseq.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecmpitoseq.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecs.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecs.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecstash.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vecstash.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vinv.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vinv.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vsection.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vec/utils/vsection.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi1/vpscat_mpi1.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi1/vpscat_mpi1.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi3/vpscat.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/mpi3/vpscat.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/seq/seqvscat.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/seq/seqvscat.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/vscat.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/impls/vscat.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/interface/dlregisvecscat.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/interface/dlregisvecscat.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscatfce.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscatfce.c.o.d"
+  "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscreate.c.o"
+  "CMakeFiles/petsc.dir/src/vec/vscat/interface/vscreate.c.o.d"
+  "lib/libpetsc.pdb"
+  "lib/libpetsc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/petsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1 @@
+static const char *petscconfigureoptions = "PETSC_ARCH=arch-gate --with-debugging=1 --with-fortran-bindings=0 --with-fc=0 --with-x=0 --with-shared-libraries=1";
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -degrees 1,2,3 -target_points -0.3,0,.2 -src_points -1,-.3,0,.2,1  > ex2_1.tmp 2> runex2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/dt/examples/tests/output/ex3_0.out ex3_0.tmp > diff-runex3_0.out 2> diff-runex3_0.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3   > ex3_0.tmp 2> runex3_0.err
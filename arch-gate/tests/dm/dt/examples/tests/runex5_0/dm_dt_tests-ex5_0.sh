@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -petscspace_degree 1 -trace_fe_view  > ex5_0.tmp 2> runex5_0.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex16 -gather_add  > ex16_2.tmp 2> runex16_2.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex1 -nox  2>&1 | cat > ex1_1.tmp
+cat ex1_1.tmp | grep -v -i Object > ex1_1.tmp.tmp 2>> runex1_1.err && mv ex1_1.tmp.tmp ex1_1.tmp
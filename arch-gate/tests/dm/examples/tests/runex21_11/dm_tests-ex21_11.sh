@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex21 -mx 30 -my 29 -mz 30 -periodic 2 -da_processors_z 5  > ex21_11.tmp 2> runex21_11.err
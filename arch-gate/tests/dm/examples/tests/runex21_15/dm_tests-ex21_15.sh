@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex21 -mx 30 -my 29 -mz 30 -periodic 2  > ex21_15.tmp 2> runex21_15.err
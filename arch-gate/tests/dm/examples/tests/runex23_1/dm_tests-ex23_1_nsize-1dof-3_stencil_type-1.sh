@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex23 -one  -dof 3 -stencil_type 1 > ex23_1.tmp 2> runex23_1.err
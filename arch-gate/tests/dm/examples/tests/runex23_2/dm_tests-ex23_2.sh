@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex23 -two -native  > ex23_2.tmp 2> runex23_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex23_4.out ex23_4.tmp > diff-runex23_4.out 2> diff-runex23_4.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex24   2>&1 | cat > ex24_1.tmp
+cat ex24_1.tmp | grep -v -i Process > ex24_1.tmp.tmp 2>> runex24_1.err && mv ex24_1.tmp.tmp ex24_1.tmp
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex24   2>&1 | cat > ex24_2.tmp
+cat ex24_2.tmp | grep -v -i Process > ex24_2.tmp.tmp 2>> runex24_2.err && mv ex24_2.tmp.tmp ex24_2.tmp
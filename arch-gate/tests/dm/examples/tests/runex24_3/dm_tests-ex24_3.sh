@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex24   2>&1 | cat > ex24_3.tmp
+cat ex24_3.tmp | grep -v -i Process > ex24_3.tmp.tmp 2>> runex24_3.err && mv ex24_3.tmp.tmp ex24_3.tmp
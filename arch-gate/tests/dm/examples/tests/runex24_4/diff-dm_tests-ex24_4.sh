@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex24_2.out ex24_4.tmp > diff-runex24_4.out 2> diff-runex24_4.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex24   2>&1 | cat > ex24_4.tmp
+cat ex24_4.tmp | grep -v -i Process > ex24_4.tmp.tmp 2>> runex24_4.err && mv ex24_4.tmp.tmp ex24_4.tmp
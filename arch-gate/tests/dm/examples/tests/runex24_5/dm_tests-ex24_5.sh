@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 5 ../ex24   2>&1 | cat > ex24_5.tmp
+cat ex24_5.tmp | grep -v -i Process > ex24_5.tmp.tmp 2>> runex24_5.err && mv ex24_5.tmp.tmp ex24_5.tmp
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 6 ../ex24   2>&1 | cat > ex24_6.tmp
+cat ex24_6.tmp | grep -v -i Process > ex24_6.tmp.tmp 2>> runex24_6.err && mv ex24_6.tmp.tmp ex24_6.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex25_1.out ex25_1.tmp > diff-runex25_1.out 2> diff-runex25_1.out
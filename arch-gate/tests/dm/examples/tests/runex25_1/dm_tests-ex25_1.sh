@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex25   2>&1 | cat > ex25_1.tmp
+cat ex25_1.tmp | grep -v -i Process > ex25_1.tmp.tmp 2>> runex25_1.err && mv ex25_1.tmp.tmp ex25_1.tmp
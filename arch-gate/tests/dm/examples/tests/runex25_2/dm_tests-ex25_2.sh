@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex25   2>&1 | cat > ex25_2.tmp
+cat ex25_2.tmp | grep -v -i Process > ex25_2.tmp.tmp 2>> runex25_2.err && mv ex25_2.tmp.tmp ex25_2.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex25_2.out ex25_3.tmp > diff-runex25_3.out 2> diff-runex25_3.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex25   2>&1 | cat > ex25_3.tmp
+cat ex25_3.tmp | grep -v -i Process > ex25_3.tmp.tmp 2>> runex25_3.err && mv ex25_3.tmp.tmp ex25_3.tmp
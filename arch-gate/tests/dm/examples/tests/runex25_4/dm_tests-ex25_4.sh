@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex25   2>&1 | cat > ex25_4.tmp
+cat ex25_4.tmp | grep -v -i Process > ex25_4.tmp.tmp 2>> runex25_4.err && mv ex25_4.tmp.tmp ex25_4.tmp
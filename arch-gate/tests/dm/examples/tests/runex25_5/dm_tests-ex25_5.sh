@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 5 ../ex25   2>&1 | cat > ex25_5.tmp
+cat ex25_5.tmp | grep -v -i Process > ex25_5.tmp.tmp 2>> runex25_5.err && mv ex25_5.tmp.tmp ex25_5.tmp
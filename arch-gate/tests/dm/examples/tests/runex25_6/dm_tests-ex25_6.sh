@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 6 ../ex25   2>&1 | cat > ex25_6.tmp
+cat ex25_6.tmp | grep -v -i Process > ex25_6.tmp.tmp 2>> runex25_6.err && mv ex25_6.tmp.tmp ex25_6.tmp
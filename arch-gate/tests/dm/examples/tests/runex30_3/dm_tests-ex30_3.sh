@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex30 -bs 2 -block 0 -sliced_mat_type aij -alpha 10 -u0 0.1  > ex30_3.tmp 2> runex30_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex32   > ex32_1.tmp 2> runex32_1.err
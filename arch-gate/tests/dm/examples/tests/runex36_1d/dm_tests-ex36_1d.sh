@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex36 -mx 10 -nl 6 -dim 1  > ex36_1d.tmp 2> runex36_1d.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex36  -mx 10 -my 10 -nl 6 -dim 2 -cmap 3 > ex36_2d.tmp 2> runex36_2d.err
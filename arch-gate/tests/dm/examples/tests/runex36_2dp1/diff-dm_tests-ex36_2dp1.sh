@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex36_2dp1.out ex36_2dp1.tmp > diff-runex36_2dp1.out 2> diff-runex36_2dp1.out
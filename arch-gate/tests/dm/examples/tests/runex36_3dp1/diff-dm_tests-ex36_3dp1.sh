@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex36_3dp1.out ex36_3dp1.tmp > diff-runex36_3dp1.out 2> diff-runex36_3dp1.out
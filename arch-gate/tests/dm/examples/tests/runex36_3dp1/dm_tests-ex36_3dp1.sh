@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 32 ../ex36 -mx 5 -my 5 -mz 5 -nl 3 -dim 3 -cmap 1 -da_refine_x 1 -da_refine_y 3 -da_refine_z 4  > ex36_3dp1.tmp 2> runex36_3dp1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex39   > ex39_1.tmp 2> runex39.err
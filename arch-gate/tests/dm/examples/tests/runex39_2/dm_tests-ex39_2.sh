@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex39   2>&1 | cat > ex39_2.tmp
+cat ex39_2.tmp | grep -v "Vec Object" > ex39_2.tmp.tmp 2>> runex39_2.err && mv ex39_2.tmp.tmp ex39_2.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex40   > ex40_1.tmp 2> runex40.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex40   2>&1 | cat > ex40_2.tmp
+cat ex40_2.tmp | grep -v "Vec Object" > ex40_2.tmp.tmp 2>> runex40_2.err && mv ex40_2.tmp.tmp ex40_2.tmp
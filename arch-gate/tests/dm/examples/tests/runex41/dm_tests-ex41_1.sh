@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex41   > ex41_1.tmp 2> runex41.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex46_2.out ex46_2.tmp > diff-runex46_2.out 2> diff-runex46_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex48 -dof 2  > ex48_1.tmp 2> runex48_1.err
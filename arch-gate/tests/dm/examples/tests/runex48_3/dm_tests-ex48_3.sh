@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex48 -dof 3  > ex48_3.tmp 2> runex48_3.err
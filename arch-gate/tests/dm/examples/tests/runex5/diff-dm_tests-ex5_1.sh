@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex5_1.out ex5_1.tmp > diff-runex5.out 2> diff-runex5.out
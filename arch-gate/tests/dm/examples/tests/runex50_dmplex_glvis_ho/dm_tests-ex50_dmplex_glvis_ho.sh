@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex50 -view glvis: -nex 1 -ney 1 -nez 1  > ex50_dmplex_glvis_ho.tmp 2> runex50_dmplex_glvis_ho.err
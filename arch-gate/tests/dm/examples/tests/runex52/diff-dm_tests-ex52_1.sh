@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex52_1.out ex52_1.tmp > diff-runex52.out 2> diff-runex52.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex52   > ex52_2.tmp 2> runex52_2.err
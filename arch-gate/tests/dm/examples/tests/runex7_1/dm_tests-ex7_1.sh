@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 8 ../ex7 -dof 3 -stencil_width 2 -M 50 -N 50 -periodic  > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tutorials/output/ex15_2.out ex15_2.tmp > diff-runex15_2.out 2> diff-runex15_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 12 ../ex15   > ex15_2.tmp 2> runex15_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tutorials/output/ex15_3.out ex15_3.tmp > diff-runex15_3.out 2> diff-runex15_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 12 ../ex15 -usempiio  > ex15_3.tmp 2> runex15_3.err
@@ -0,0 +1 @@
+grep -v atomic /root/repo/src/dm/examples/tutorials/output/ex20_1.out | /root/repo/lib/petsc/bin/petscdiff  - ex20_1.tmp > diff-runex20_1.out 2> diff-runex20_1.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex20   2>&1 | cat > ex20_1.tmp
+cat ex20_1.tmp | grep -v DM_ | grep -v atomic > ex20_1.tmp.tmp 2>> runex20_1.err && mv ex20_1.tmp.tmp ex20_1.tmp
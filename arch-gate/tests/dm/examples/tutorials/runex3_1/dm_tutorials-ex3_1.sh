@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex3 -mat_view  > ex3_1.tmp 2> runex3_1.err
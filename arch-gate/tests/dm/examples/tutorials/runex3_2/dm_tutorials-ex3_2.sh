@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex3 -mat_view -dim 2  > ex3_2.tmp 2> runex3_2.err
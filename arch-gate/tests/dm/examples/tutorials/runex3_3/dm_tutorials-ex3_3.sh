@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex3 -mat_view -dim 3  > ex3_3.tmp 2> runex3_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tutorials/output/ex6_1.out ex6_1.tmp > diff-runex6.out 2> diff-runex6.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex6   > ex6_2.tmp 2> runex6_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex6   > ex6_4.tmp 2> runex6_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 9 ../ex6   > ex6_9.tmp 2> runex6_9.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7   > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+grep -v atomic /root/repo/src/dm/examples/tutorials/output/swarm_ex1.out | /root/repo/lib/petsc/bin/petscdiff  - swarm_ex1.tmp > diff-runswarm_ex1.out 2> diff-runswarm_ex1.out
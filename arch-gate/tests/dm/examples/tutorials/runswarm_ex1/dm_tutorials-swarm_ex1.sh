@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../swarm_ex1 -test_mode 1  2>&1 | cat > swarm_ex1.tmp
+cat swarm_ex1.tmp | grep -v atomic > swarm_ex1.tmp.tmp 2>> runswarm_ex1.err && mv swarm_ex1.tmp.tmp swarm_ex1.tmp
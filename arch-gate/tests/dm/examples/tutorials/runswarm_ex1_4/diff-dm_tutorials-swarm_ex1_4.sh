@@ -0,0 +1 @@
+grep -v atomic /root/repo/src/dm/examples/tutorials/output/swarm_ex1_4.out | /root/repo/lib/petsc/bin/petscdiff  - swarm_ex1_4.tmp > diff-runswarm_ex1_4.out 2> diff-runswarm_ex1_4.out
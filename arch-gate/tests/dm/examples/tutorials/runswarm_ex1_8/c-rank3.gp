@@ -0,0 +1,10308 @@
++1.8000e-02 +1.8000e-02 3.0000e+00
++2.2000e-02 +1.8000e-02 3.0000e+00
++1.8000e-02 +2.2000e-02 3.0000e+00
++2.2000e-02 +2.2000e-02 3.0000e+00
++3.8000e-02 +1.8000e-02 3.0000e+00
++4.2000e-02 +1.8000e-02 3.0000e+00
++3.8000e-02 +2.2000e-02 3.0000e+00
++4.2000e-02 +2.2000e-02 3.0000e+00
++5.8000e-02 +1.8000e-02 3.0000e+00
++6.2000e-02 +1.8000e-02 3.0000e+00
++5.8000e-02 +2.2000e-02 3.0000e+00
++6.2000e-02 +2.2000e-02 3.0000e+00
++7.8000e-02 +1.8000e-02 3.0000e+00
++8.2000e-02 +1.8000e-02 3.0000e+00
++7.8000e-02 +2.2000e-02 3.0000e+00
++8.2000e-02 +2.2000e-02 3.0000e+00
++9.8000e-02 +1.8000e-02 3.0000e+00
++1.0200e-01 +1.8000e-02 3.0000e+00
++9.8000e-02 +2.2000e-02 3.0000e+00
++1.0200e-01 +2.2000e-02 3.0000e+00
++1.1800e-01 +1.8000e-02 3.0000e+00
++1.2200e-01 +1.8000e-02 3.0000e+00
++1.1800e-01 +2.2000e-02 3.0000e+00
++1.2200e-01 +2.2000e-02 3.0000e+00
++1.3800e-01 +1.8000e-02 3.0000e+00
++1.4200e-01 +1.8000e-02 3.0000e+00
++1.3800e-01 +2.2000e-02 3.0000e+00
++1.4200e-01 +2.2000e-02 3.0000e+00
++1.5800e-01 +1.8000e-02 3.0000e+00
++1.6200e-01 +1.8000e-02 3.0000e+00
++1.5800e-01 +2.2000e-02 3.0000e+00
++1.6200e-01 +2.2000e-02 3.0000e+00
++1.7800e-01 +1.8000e-02 3.0000e+00
++1.8200e-01 +1.8000e-02 3.0000e+00
++1.7800e-01 +2.2000e-02 3.0000e+00
++1.8200e-01 +2.2000e-02 3.0000e+00
++1.9800e-01 +1.8000e-02 3.0000e+00
++2.0200e-01 +1.8000e-02 3.0000e+00
++1.9800e-01 +2.2000e-02 3.0000e+00
++2.0200e-01 +2.2000e-02 3.0000e+00
++2.1800e-01 +1.8000e-02 3.0000e+00
++2.2200e-01 +1.8000e-02 3.0000e+00
++2.1800e-01 +2.2000e-02 3.0000e+00
++2.2200e-01 +2.2000e-02 3.0000e+00
++2.3800e-01 +1.8000e-02 3.0000e+00
++2.4200e-01 +1.8000e-02 3.0000e+00
++2.3800e-01 +2.2000e-02 3.0000e+00
++2.4200e-01 +2.2000e-02 3.0000e+00
++2.5800e-01 +1.8000e-02 3.0000e+00
++2.6200e-01 +1.8000e-02 3.0000e+00
++2.5800e-01 +2.2000e-02 3.0000e+00
++2.6200e-01 +2.2000e-02 3.0000e+00
++2.7800e-01 +1.8000e-02 3.0000e+00
++2.8200e-01 +1.8000e-02 3.0000e+00
++2.7800e-01 +2.2000e-02 3.0000e+00
++2.8200e-01 +2.2000e-02 3.0000e+00
++2.9800e-01 +1.8000e-02 3.0000e+00
++3.0200e-01 +1.8000e-02 3.0000e+00
++2.9800e-01 +2.2000e-02 3.0000e+00
++3.0200e-01 +2.2000e-02 3.0000e+00
++3.1800e-01 +1.8000e-02 3.0000e+00
++3.2200e-01 +1.8000e-02 3.0000e+00
++3.1800e-01 +2.2000e-02 3.0000e+00
++3.2200e-01 +2.2000e-02 3.0000e+00
++3.3800e-01 +1.8000e-02 3.0000e+00
++3.4200e-01 +1.8000e-02 3.0000e+00
++3.3800e-01 +2.2000e-02 3.0000e+00
++3.4200e-01 +2.2000e-02 3.0000e+00
++3.5800e-01 +1.8000e-02 3.0000e+00
++3.6200e-01 +1.8000e-02 3.0000e+00
++3.5800e-01 +2.2000e-02 3.0000e+00
++3.6200e-01 +2.2000e-02 3.0000e+00
++3.7800e-01 +1.8000e-02 3.0000e+00
++3.8200e-01 +1.8000e-02 3.0000e+00
++3.7800e-01 +2.2000e-02 3.0000e+00
++3.8200e-01 +2.2000e-02 3.0000e+00
++3.9800e-01 +1.8000e-02 3.0000e+00
++4.0200e-01 +1.8000e-02 3.0000e+00
++3.9800e-01 +2.2000e-02 3.0000e+00
++4.0200e-01 +2.2000e-02 3.0000e+00
++4.1800e-01 +1.8000e-02 3.0000e+00
++4.2200e-01 +1.8000e-02 3.0000e+00
++4.1800e-01 +2.2000e-02 3.0000e+00
++4.2200e-01 +2.2000e-02 3.0000e+00
++4.3800e-01 +1.8000e-02 3.0000e+00
++4.4200e-01 +1.8000e-02 3.0000e+00
++4.3800e-01 +2.2000e-02 3.0000e+00
++4.4200e-01 +2.2000e-02 3.0000e+00
++4.5800e-01 +1.8000e-02 3.0000e+00
++4.6200e-01 +1.8000e-02 3.0000e+00
++4.5800e-01 +2.2000e-02 3.0000e+00
++4.6200e-01 +2.2000e-02 3.0000e+00
++4.7800e-01 +1.8000e-02 3.0000e+00
++4.8200e-01 +1.8000e-02 3.0000e+00
++4.7800e-01 +2.2000e-02 3.0000e+00
++4.8200e-01 +2.2000e-02 3.0000e+00
++4.9800e-01 +1.8000e-02 3.0000e+00
++5.0200e-01 +1.8000e-02 3.0000e+00
++4.9800e-01 +2.2000e-02 3.0000e+00
++5.0200e-01 +2.2000e-02 3.0000e+00
++5.1800e-01 +1.8000e-02 3.0000e+00
++5.2200e-01 +1.8000e-02 3.0000e+00
++5.1800e-01 +2.2000e-02 3.0000e+00
++5.2200e-01 +2.2000e-02 3.0000e+00
++5.3800e-01 +1.8000e-02 3.0000e+00
++5.4200e-01 +1.8000e-02 3.0000e+00
++5.3800e-01 +2.2000e-02 3.0000e+00
++5.4200e-01 +2.2000e-02 3.0000e+00
++5.5800e-01 +1.8000e-02 3.0000e+00
++5.6200e-01 +1.8000e-02 3.0000e+00
++5.5800e-01 +2.2000e-02 3.0000e+00
++5.6200e-01 +2.2000e-02 3.0000e+00
++5.7800e-01 +1.8000e-02 3.0000e+00
++5.8200e-01 +1.8000e-02 3.0000e+00
++5.7800e-01 +2.2000e-02 3.0000e+00
++5.8200e-01 +2.2000e-02 3.0000e+00
++5.9800e-01 +1.8000e-02 3.0000e+00
++6.0200e-01 +1.8000e-02 3.0000e+00
++5.9800e-01 +2.2000e-02 3.0000e+00
++6.0200e-01 +2.2000e-02 3.0000e+00
++6.1800e-01 +1.8000e-02 3.0000e+00
++6.2200e-01 +1.8000e-02 3.0000e+00
++6.1800e-01 +2.2000e-02 3.0000e+00
++6.2200e-01 +2.2000e-02 3.0000e+00
++6.3800e-01 +1.8000e-02 3.0000e+00
++6.4200e-01 +1.8000e-02 3.0000e+00
++6.3800e-01 +2.2000e-02 3.0000e+00
++6.4200e-01 +2.2000e-02 3.0000e+00
++6.5800e-01 +1.8000e-02 3.0000e+00
++6.6200e-01 +1.8000e-02 3.0000e+00
++6.5800e-01 +2.2000e-02 3.0000e+00
++6.6200e-01 +2.2000e-02 3.0000e+00
++6.7800e-01 +1.8000e-02 3.0000e+00
++6.8200e-01 +1.8000e-02 3.0000e+00
++6.7800e-01 +2.2000e-02 3.0000e+00
++6.8200e-01 +2.2000e-02 3.0000e+00
++6.9800e-01 +1.8000e-02 3.0000e+00
++7.0200e-01 +1.8000e-02 3.0000e+00
++6.9800e-01 +2.2000e-02 3.0000e+00
++7.0200e-01 +2.2000e-02 3.0000e+00
++7.1800e-01 +1.8000e-02 3.0000e+00
++7.2200e-01 +1.8000e-02 3.0000e+00
++7.1800e-01 +2.2000e-02 3.0000e+00
++7.2200e-01 +2.2000e-02 3.0000e+00
++7.3800e-01 +1.8000e-02 3.0000e+00
++7.4200e-01 +1.8000e-02 3.0000e+00
++7.3800e-01 +2.2000e-02 3.0000e+00
++7.4200e-01 +2.2000e-02 3.0000e+00
++7.5800e-01 +1.8000e-02 3.0000e+00
++7.6200e-01 +1.8000e-02 3.0000e+00
++7.5800e-01 +2.2000e-02 3.0000e+00
++7.6200e-01 +2.2000e-02 3.0000e+00
++7.7800e-01 +1.8000e-02 3.0000e+00
++7.8200e-01 +1.8000e-02 3.0000e+00
++7.7800e-01 +2.2000e-02 3.0000e+00
++7.8200e-01 +2.2000e-02 3.0000e+00
++7.9800e-01 +1.8000e-02 3.0000e+00
++8.0200e-01 +1.8000e-02 3.0000e+00
++7.9800e-01 +2.2000e-02 3.0000e+00
++8.0200e-01 +2.2000e-02 3.0000e+00
++8.1800e-01 +1.8000e-02 3.0000e+00
++8.2200e-01 +1.8000e-02 3.0000e+00
++8.1800e-01 +2.2000e-02 3.0000e+00
++8.2200e-01 +2.2000e-02 3.0000e+00
++8.3800e-01 +1.8000e-02 3.0000e+00
++8.4200e-01 +1.8000e-02 3.0000e+00
++8.3800e-01 +2.2000e-02 3.0000e+00
++8.4200e-01 +2.2000e-02 3.0000e+00
++8.5800e-01 +1.8000e-02 3.0000e+00
++8.6200e-01 +1.8000e-02 3.0000e+00
++8.5800e-01 +2.2000e-02 3.0000e+00
++8.6200e-01 +2.2000e-02 3.0000e+00
++8.7800e-01 +1.8000e-02 3.0000e+00
++8.8200e-01 +1.8000e-02 3.0000e+00
++8.7800e-01 +2.2000e-02 3.0000e+00
++8.8200e-01 +2.2000e-02 3.0000e+00
++8.9800e-01 +1.8000e-02 3.0000e+00
++9.0200e-01 +1.8000e-02 3.0000e+00
++8.9800e-01 +2.2000e-02 3.0000e+00
++9.0200e-01 +2.2000e-02 3.0000e+00
++9.1800e-01 +1.8000e-02 3.0000e+00
++9.2200e-01 +1.8000e-02 3.0000e+00
++9.1800e-01 +2.2000e-02 3.0000e+00
++9.2200e-01 +2.2000e-02 3.0000e+00
++9.3800e-01 +1.8000e-02 3.0000e+00
++9.4200e-01 +1.8000e-02 3.0000e+00
++9.3800e-01 +2.2000e-02 3.0000e+00
++9.4200e-01 +2.2000e-02 3.0000e+00
++9.5800e-01 +1.8000e-02 3.0000e+00
++9.6200e-01 +1.8000e-02 3.0000e+00
++9.5800e-01 +2.2000e-02 3.0000e+00
++9.6200e-01 +2.2000e-02 3.0000e+00
++9.7800e-01 +1.8000e-02 3.0000e+00
++9.8200e-01 +1.8000e-02 3.0000e+00
++9.7800e-01 +2.2000e-02 3.0000e+00
++9.8200e-01 +2.2000e-02 3.0000e+00
++9.9800e-01 +1.8000e-02 3.0000e+00
++1.0020e+00 +1.8000e-02 3.0000e+00
++9.9800e-01 +2.2000e-02 3.0000e+00
++1.0020e+00 +2.2000e-02 3.0000e+00
++1.8000e-02 +3.8000e-02 3.0000e+00
++2.2000e-02 +3.8000e-02 3.0000e+00
++1.8000e-02 +4.2000e-02 3.0000e+00
++2.2000e-02 +4.2000e-02 3.0000e+00
++3.8000e-02 +3.8000e-02 3.0000e+00
++4.2000e-02 +3.8000e-02 3.0000e+00
++3.8000e-02 +4.2000e-02 3.0000e+00
++4.2000e-02 +4.2000e-02 3.0000e+00
++5.8000e-02 +3.8000e-02 3.0000e+00
++6.2000e-02 +3.8000e-02 3.0000e+00
++5.8000e-02 +4.2000e-02 3.0000e+00
++6.2000e-02 +4.2000e-02 3.0000e+00
++7.8000e-02 +3.8000e-02 3.0000e+00
++8.2000e-02 +3.8000e-02 3.0000e+00
++7.8000e-02 +4.2000e-02 3.0000e+00
++8.2000e-02 +4.2000e-02 3.0000e+00
++9.8000e-02 +3.8000e-02 3.0000e+00
++1.0200e-01 +3.8000e-02 3.0000e+00
++9.8000e-02 +4.2000e-02 3.0000e+00
++1.0200e-01 +4.2000e-02 3.0000e+00
++1.1800e-01 +3.8000e-02 3.0000e+00
++1.2200e-01 +3.8000e-02 3.0000e+00
++1.1800e-01 +4.2000e-02 3.0000e+00
++1.2200e-01 +4.2000e-02 3.0000e+00
++1.3800e-01 +3.8000e-02 3.0000e+00
++1.4200e-01 +3.8000e-02 3.0000e+00
++1.3800e-01 +4.2000e-02 3.0000e+00
++1.4200e-01 +4.2000e-02 3.0000e+00
++1.5800e-01 +3.8000e-02 3.0000e+00
++1.6200e-01 +3.8000e-02 3.0000e+00
++1.5800e-01 +4.2000e-02 3.0000e+00
++1.6200e-01 +4.2000e-02 3.0000e+00
++1.7800e-01 +3.8000e-02 3.0000e+00
++1.8200e-01 +3.8000e-02 3.0000e+00
++1.7800e-01 +4.2000e-02 3.0000e+00
++1.8200e-01 +4.2000e-02 3.0000e+00
++1.9800e-01 +3.8000e-02 3.0000e+00
++2.0200e-01 +3.8000e-02 3.0000e+00
++1.9800e-01 +4.2000e-02 3.0000e+00
++2.0200e-01 +4.2000e-02 3.0000e+00
++2.1800e-01 +3.8000e-02 3.0000e+00
++2.2200e-01 +3.8000e-02 3.0000e+00
++2.1800e-01 +4.2000e-02 3.0000e+00
++2.2200e-01 +4.2000e-02 3.0000e+00
++2.3800e-01 +3.8000e-02 3.0000e+00
++2.4200e-01 +3.8000e-02 3.0000e+00
++2.3800e-01 +4.2000e-02 3.0000e+00
++2.4200e-01 +4.2000e-02 3.0000e+00
++2.5800e-01 +3.8000e-02 3.0000e+00
++2.6200e-01 +3.8000e-02 3.0000e+00
++2.5800e-01 +4.2000e-02 3.0000e+00
++2.6200e-01 +4.2000e-02 3.0000e+00
++2.7800e-01 +3.8000e-02 3.0000e+00
++2.8200e-01 +3.8000e-02 3.0000e+00
++2.7800e-01 +4.2000e-02 3.0000e+00
++2.8200e-01 +4.2000e-02 3.0000e+00
++2.9800e-01 +3.8000e-02 3.0000e+00
++3.0200e-01 +3.8000e-02 3.0000e+00
++2.9800e-01 +4.2000e-02 3.0000e+00
++3.0200e-01 +4.2000e-02 3.0000e+00
++3.1800e-01 +3.8000e-02 3.0000e+00
++3.2200e-01 +3.8000e-02 3.0000e+00
++3.1800e-01 +4.2000e-02 3.0000e+00
++3.2200e-01 +4.2000e-02 3.0000e+00
++3.3800e-01 +3.8000e-02 3.0000e+00
++3.4200e-01 +3.8000e-02 3.0000e+00
++3.3800e-01 +4.2000e-02 3.0000e+00
++3.4200e-01 +4.2000e-02 3.0000e+00
++3.5800e-01 +3.8000e-02 3.0000e+00
++3.6200e-01 +3.8000e-02 3.0000e+00
++3.5800e-01 +4.2000e-02 3.0000e+00
++3.6200e-01 +4.2000e-02 3.0000e+00
++3.7800e-01 +3.8000e-02 3.0000e+00
++3.8200e-01 +3.8000e-02 3.0000e+00
++3.7800e-01 +4.2000e-02 3.0000e+00
++3.8200e-01 +4.2000e-02 3.0000e+00
++3.9800e-01 +3.8000e-02 3.0000e+00
++4.0200e-01 +3.8000e-02 3.0000e+00
++3.9800e-01 +4.2000e-02 3.0000e+00
++4.0200e-01 +4.2000e-02 3.0000e+00
++4.1800e-01 +3.8000e-02 3.0000e+00
++4.2200e-01 +3.8000e-02 3.0000e+00
++4.1800e-01 +4.2000e-02 3.0000e+00
++4.2200e-01 +4.2000e-02 3.0000e+00
++4.3800e-01 +3.8000e-02 3.0000e+00
++4.4200e-01 +3.8000e-02 3.0000e+00
++4.3800e-01 +4.2000e-02 3.0000e+00
++4.4200e-01 +4.2000e-02 3.0000e+00
++4.5800e-01 +3.8000e-02 3.0000e+00
++4.6200e-01 +3.8000e-02 3.0000e+00
++4.5800e-01 +4.2000e-02 3.0000e+00
++4.6200e-01 +4.2000e-02 3.0000e+00
++4.7800e-01 +3.8000e-02 3.0000e+00
++4.8200e-01 +3.8000e-02 3.0000e+00
++4.7800e-01 +4.2000e-02 3.0000e+00
++4.8200e-01 +4.2000e-02 3.0000e+00
++4.9800e-01 +3.8000e-02 3.0000e+00
++5.0200e-01 +3.8000e-02 3.0000e+00
++4.9800e-01 +4.2000e-02 3.0000e+00
++5.0200e-01 +4.2000e-02 3.0000e+00
++5.1800e-01 +3.8000e-02 3.0000e+00
++5.2200e-01 +3.8000e-02 3.0000e+00
++5.1800e-01 +4.2000e-02 3.0000e+00
++5.2200e-01 +4.2000e-02 3.0000e+00
++5.3800e-01 +3.8000e-02 3.0000e+00
++5.4200e-01 +3.8000e-02 3.0000e+00
++5.3800e-01 +4.2000e-02 3.0000e+00
++5.4200e-01 +4.2000e-02 3.0000e+00
++5.5800e-01 +3.8000e-02 3.0000e+00
++5.6200e-01 +3.8000e-02 3.0000e+00
++5.5800e-01 +4.2000e-02 3.0000e+00
++5.6200e-01 +4.2000e-02 3.0000e+00
++5.7800e-01 +3.8000e-02 3.0000e+00
++5.8200e-01 +3.8000e-02 3.0000e+00
++5.7800e-01 +4.2000e-02 3.0000e+00
++5.8200e-01 +4.2000e-02 3.0000e+00
++5.9800e-01 +3.8000e-02 3.0000e+00
++6.0200e-01 +3.8000e-02 3.0000e+00
++5.9800e-01 +4.2000e-02 3.0000e+00
++6.0200e-01 +4.2000e-02 3.0000e+00
++6.1800e-01 +3.8000e-02 3.0000e+00
++6.2200e-01 +3.8000e-02 3.0000e+00
++6.1800e-01 +4.2000e-02 3.0000e+00
++6.2200e-01 +4.2000e-02 3.0000e+00
++6.3800e-01 +3.8000e-02 3.0000e+00
++6.4200e-01 +3.8000e-02 3.0000e+00
++6.3800e-01 +4.2000e-02 3.0000e+00
++6.4200e-01 +4.2000e-02 3.0000e+00
++6.5800e-01 +3.8000e-02 3.0000e+00
++6.6200e-01 +3.8000e-02 3.0000e+00
++6.5800e-01 +4.2000e-02 3.0000e+00
++6.6200e-01 +4.2000e-02 3.0000e+00
++6.7800e-01 +3.8000e-02 3.0000e+00
++6.8200e-01 +3.8000e-02 3.0000e+00
++6.7800e-01 +4.2000e-02 3.0000e+00
++6.8200e-01 +4.2000e-02 3.0000e+00
++6.9800e-01 +3.8000e-02 3.0000e+00
++7.0200e-01 +3.8000e-02 3.0000e+00
++6.9800e-01 +4.2000e-02 3.0000e+00
++7.0200e-01 +4.2000e-02 3.0000e+00
++7.1800e-01 +3.8000e-02 3.0000e+00
++7.2200e-01 +3.8000e-02 3.0000e+00
++7.1800e-01 +4.2000e-02 3.0000e+00
++7.2200e-01 +4.2000e-02 3.0000e+00
++7.3800e-01 +3.8000e-02 3.0000e+00
++7.4200e-01 +3.8000e-02 3.0000e+00
++7.3800e-01 +4.2000e-02 3.0000e+00
++7.4200e-01 +4.2000e-02 3.0000e+00
++7.5800e-01 +3.8000e-02 3.0000e+00
++7.6200e-01 +3.8000e-02 3.0000e+00
++7.5800e-01 +4.2000e-02 3.0000e+00
++7.6200e-01 +4.2000e-02 3.0000e+00
++7.7800e-01 +3.8000e-02 3.0000e+00
++7.8200e-01 +3.8000e-02 3.0000e+00
++7.7800e-01 +4.2000e-02 3.0000e+00
++7.8200e-01 +4.2000e-02 3.0000e+00
++7.9800e-01 +3.8000e-02 3.0000e+00
++8.0200e-01 +3.8000e-02 3.0000e+00
++7.9800e-01 +4.2000e-02 3.0000e+00
++8.0200e-01 +4.2000e-02 3.0000e+00
++8.1800e-01 +3.8000e-02 3.0000e+00
++8.2200e-01 +3.8000e-02 3.0000e+00
++8.1800e-01 +4.2000e-02 3.0000e+00
++8.2200e-01 +4.2000e-02 3.0000e+00
++8.3800e-01 +3.8000e-02 3.0000e+00
++8.4200e-01 +3.8000e-02 3.0000e+00
++8.3800e-01 +4.2000e-02 3.0000e+00
++8.4200e-01 +4.2000e-02 3.0000e+00
++8.5800e-01 +3.8000e-02 3.0000e+00
++8.6200e-01 +3.8000e-02 3.0000e+00
++8.5800e-01 +4.2000e-02 3.0000e+00
++8.6200e-01 +4.2000e-02 3.0000e+00
++8.7800e-01 +3.8000e-02 3.0000e+00
++8.8200e-01 +3.8000e-02 3.0000e+00
++8.7800e-01 +4.2000e-02 3.0000e+00
++8.8200e-01 +4.2000e-02 3.0000e+00
++8.9800e-01 +3.8000e-02 3.0000e+00
++9.0200e-01 +3.8000e-02 3.0000e+00
++8.9800e-01 +4.2000e-02 3.0000e+00
++9.0200e-01 +4.2000e-02 3.0000e+00
++9.1800e-01 +3.8000e-02 3.0000e+00
++9.2200e-01 +3.8000e-02 3.0000e+00
++9.1800e-01 +4.2000e-02 3.0000e+00
++9.2200e-01 +4.2000e-02 3.0000e+00
++9.3800e-01 +3.8000e-02 3.0000e+00
++9.4200e-01 +3.8000e-02 3.0000e+00
++9.3800e-01 +4.2000e-02 3.0000e+00
++9.4200e-01 +4.2000e-02 3.0000e+00
++9.5800e-01 +3.8000e-02 3.0000e+00
++9.6200e-01 +3.8000e-02 3.0000e+00
++9.5800e-01 +4.2000e-02 3.0000e+00
++9.6200e-01 +4.2000e-02 3.0000e+00
++9.7800e-01 +3.8000e-02 3.0000e+00
++9.8200e-01 +3.8000e-02 3.0000e+00
++9.7800e-01 +4.2000e-02 3.0000e+00
++9.8200e-01 +4.2000e-02 3.0000e+00
++9.9800e-01 +3.8000e-02 3.0000e+00
++1.0020e+00 +3.8000e-02 3.0000e+00
++9.9800e-01 +4.2000e-02 3.0000e+00
++1.0020e+00 +4.2000e-02 3.0000e+00
++1.8000e-02 +5.8000e-02 3.0000e+00
++2.2000e-02 +5.8000e-02 3.0000e+00
++1.8000e-02 +6.2000e-02 3.0000e+00
++2.2000e-02 +6.2000e-02 3.0000e+00
++3.8000e-02 +5.8000e-02 3.0000e+00
++4.2000e-02 +5.8000e-02 3.0000e+00
++3.8000e-02 +6.2000e-02 3.0000e+00
++4.2000e-02 +6.2000e-02 3.0000e+00
++5.8000e-02 +5.8000e-02 3.0000e+00
++6.2000e-02 +5.8000e-02 3.0000e+00
++5.8000e-02 +6.2000e-02 3.0000e+00
++6.2000e-02 +6.2000e-02 3.0000e+00
++7.8000e-02 +5.8000e-02 3.0000e+00
++8.2000e-02 +5.8000e-02 3.0000e+00
++7.8000e-02 +6.2000e-02 3.0000e+00
++8.2000e-02 +6.2000e-02 3.0000e+00
++9.8000e-02 +5.8000e-02 3.0000e+00
++1.0200e-01 +5.8000e-02 3.0000e+00
++9.8000e-02 +6.2000e-02 3.0000e+00
++1.0200e-01 +6.2000e-02 3.0000e+00
++1.1800e-01 +5.8000e-02 3.0000e+00
++1.2200e-01 +5.8000e-02 3.0000e+00
++1.1800e-01 +6.2000e-02 3.0000e+00
++1.2200e-01 +6.2000e-02 3.0000e+00
++1.3800e-01 +5.8000e-02 3.0000e+00
++1.4200e-01 +5.8000e-02 3.0000e+00
++1.3800e-01 +6.2000e-02 3.0000e+00
++1.4200e-01 +6.2000e-02 3.0000e+00
++1.5800e-01 +5.8000e-02 3.0000e+00
++1.6200e-01 +5.8000e-02 3.0000e+00
++1.5800e-01 +6.2000e-02 3.0000e+00
++1.6200e-01 +6.2000e-02 3.0000e+00
++1.7800e-01 +5.8000e-02 3.0000e+00
++1.8200e-01 +5.8000e-02 3.0000e+00
++1.7800e-01 +6.2000e-02 3.0000e+00
++1.8200e-01 +6.2000e-02 3.0000e+00
++1.9800e-01 +5.8000e-02 3.0000e+00
++2.0200e-01 +5.8000e-02 3.0000e+00
++1.9800e-01 +6.2000e-02 3.0000e+00
++2.0200e-01 +6.2000e-02 3.0000e+00
++2.1800e-01 +5.8000e-02 3.0000e+00
++2.2200e-01 +5.8000e-02 3.0000e+00
++2.1800e-01 +6.2000e-02 3.0000e+00
++2.2200e-01 +6.2000e-02 3.0000e+00
++2.3800e-01 +5.8000e-02 3.0000e+00
++2.4200e-01 +5.8000e-02 3.0000e+00
++2.3800e-01 +6.2000e-02 3.0000e+00
++2.4200e-01 +6.2000e-02 3.0000e+00
++2.5800e-01 +5.8000e-02 3.0000e+00
++2.6200e-01 +5.8000e-02 3.0000e+00
++2.5800e-01 +6.2000e-02 3.0000e+00
++2.6200e-01 +6.2000e-02 3.0000e+00
++2.7800e-01 +5.8000e-02 3.0000e+00
++2.8200e-01 +5.8000e-02 3.0000e+00
++2.7800e-01 +6.2000e-02 3.0000e+00
++2.8200e-01 +6.2000e-02 3.0000e+00
++2.9800e-01 +5.8000e-02 3.0000e+00
++3.0200e-01 +5.8000e-02 3.0000e+00
++2.9800e-01 +6.2000e-02 3.0000e+00
++3.0200e-01 +6.2000e-02 3.0000e+00
++3.1800e-01 +5.8000e-02 3.0000e+00
++3.2200e-01 +5.8000e-02 3.0000e+00
++3.1800e-01 +6.2000e-02 3.0000e+00
++3.2200e-01 +6.2000e-02 3.0000e+00
++3.3800e-01 +5.8000e-02 3.0000e+00
++3.4200e-01 +5.8000e-02 3.0000e+00
++3.3800e-01 +6.2000e-02 3.0000e+00
++3.4200e-01 +6.2000e-02 3.0000e+00
++3.5800e-01 +5.8000e-02 3.0000e+00
++3.6200e-01 +5.8000e-02 3.0000e+00
++3.5800e-01 +6.2000e-02 3.0000e+00
++3.6200e-01 +6.2000e-02 3.0000e+00
++3.7800e-01 +5.8000e-02 3.0000e+00
++3.8200e-01 +5.8000e-02 3.0000e+00
++3.7800e-01 +6.2000e-02 3.0000e+00
++3.8200e-01 +6.2000e-02 3.0000e+00
++3.9800e-01 +5.8000e-02 3.0000e+00
++4.0200e-01 +5.8000e-02 3.0000e+00
++3.9800e-01 +6.2000e-02 3.0000e+00
++4.0200e-01 +6.2000e-02 3.0000e+00
++4.1800e-01 +5.8000e-02 3.0000e+00
++4.2200e-01 +5.8000e-02 3.0000e+00
++4.1800e-01 +6.2000e-02 3.0000e+00
++4.2200e-01 +6.2000e-02 3.0000e+00
++4.3800e-01 +5.8000e-02 3.0000e+00
++4.4200e-01 +5.8000e-02 3.0000e+00
++4.3800e-01 +6.2000e-02 3.0000e+00
++4.4200e-01 +6.2000e-02 3.0000e+00
++4.5800e-01 +5.8000e-02 3.0000e+00
++4.6200e-01 +5.8000e-02 3.0000e+00
++4.5800e-01 +6.2000e-02 3.0000e+00
++4.6200e-01 +6.2000e-02 3.0000e+00
++4.7800e-01 +5.8000e-02 3.0000e+00
++4.8200e-01 +5.8000e-02 3.0000e+00
++4.7800e-01 +6.2000e-02 3.0000e+00
++4.8200e-01 +6.2000e-02 3.0000e+00
++4.9800e-01 +5.8000e-02 3.0000e+00
++5.0200e-01 +5.8000e-02 3.0000e+00
++4.9800e-01 +6.2000e-02 3.0000e+00
++5.0200e-01 +6.2000e-02 3.0000e+00
++5.1800e-01 +5.8000e-02 3.0000e+00
++5.2200e-01 +5.8000e-02 3.0000e+00
++5.1800e-01 +6.2000e-02 3.0000e+00
++5.2200e-01 +6.2000e-02 3.0000e+00
++5.3800e-01 +5.8000e-02 3.0000e+00
++5.4200e-01 +5.8000e-02 3.0000e+00
++5.3800e-01 +6.2000e-02 3.0000e+00
++5.4200e-01 +6.2000e-02 3.0000e+00
++5.5800e-01 +5.8000e-02 3.0000e+00
++5.6200e-01 +5.8000e-02 3.0000e+00
++5.5800e-01 +6.2000e-02 3.0000e+00
++5.6200e-01 +6.2000e-02 3.0000e+00
++5.7800e-01 +5.8000e-02 3.0000e+00
++5.8200e-01 +5.8000e-02 3.0000e+00
++5.7800e-01 +6.2000e-02 3.0000e+00
++5.8200e-01 +6.2000e-02 3.0000e+00
++5.9800e-01 +5.8000e-02 3.0000e+00
++6.0200e-01 +5.8000e-02 3.0000e+00
++5.9800e-01 +6.2000e-02 3.0000e+00
++6.0200e-01 +6.2000e-02 3.0000e+00
++6.1800e-01 +5.8000e-02 3.0000e+00
++6.2200e-01 +5.8000e-02 3.0000e+00
++6.1800e-01 +6.2000e-02 3.0000e+00
++6.2200e-01 +6.2000e-02 3.0000e+00
++6.3800e-01 +5.8000e-02 3.0000e+00
++6.4200e-01 +5.8000e-02 3.0000e+00
++6.3800e-01 +6.2000e-02 3.0000e+00
++6.4200e-01 +6.2000e-02 3.0000e+00
++6.5800e-01 +5.8000e-02 3.0000e+00
++6.6200e-01 +5.8000e-02 3.0000e+00
++6.5800e-01 +6.2000e-02 3.0000e+00
++6.6200e-01 +6.2000e-02 3.0000e+00
++6.7800e-01 +5.8000e-02 3.0000e+00
++6.8200e-01 +5.8000e-02 3.0000e+00
++6.7800e-01 +6.2000e-02 3.0000e+00
++6.8200e-01 +6.2000e-02 3.0000e+00
++6.9800e-01 +5.8000e-02 3.0000e+00
++7.0200e-01 +5.8000e-02 3.0000e+00
++6.9800e-01 +6.2000e-02 3.0000e+00
++7.0200e-01 +6.2000e-02 3.0000e+00
++7.1800e-01 +5.8000e-02 3.0000e+00
++7.2200e-01 +5.8000e-02 3.0000e+00
++7.1800e-01 +6.2000e-02 3.0000e+00
++7.2200e-01 +6.2000e-02 3.0000e+00
++7.3800e-01 +5.8000e-02 3.0000e+00
++7.4200e-01 +5.8000e-02 3.0000e+00
++7.3800e-01 +6.2000e-02 3.0000e+00
++7.4200e-01 +6.2000e-02 3.0000e+00
++7.5800e-01 +5.8000e-02 3.0000e+00
++7.6200e-01 +5.8000e-02 3.0000e+00
++7.5800e-01 +6.2000e-02 3.0000e+00
++7.6200e-01 +6.2000e-02 3.0000e+00
++7.7800e-01 +5.8000e-02 3.0000e+00
++7.8200e-01 +5.8000e-02 3.0000e+00
++7.7800e-01 +6.2000e-02 3.0000e+00
++7.8200e-01 +6.2000e-02 3.0000e+00
++7.9800e-01 +5.8000e-02 3.0000e+00
++8.0200e-01 +5.8000e-02 3.0000e+00
++7.9800e-01 +6.2000e-02 3.0000e+00
++8.0200e-01 +6.2000e-02 3.0000e+00
++8.1800e-01 +5.8000e-02 3.0000e+00
++8.2200e-01 +5.8000e-02 3.0000e+00
++8.1800e-01 +6.2000e-02 3.0000e+00
++8.2200e-01 +6.2000e-02 3.0000e+00
++8.3800e-01 +5.8000e-02 3.0000e+00
++8.4200e-01 +5.8000e-02 3.0000e+00
++8.3800e-01 +6.2000e-02 3.0000e+00
++8.4200e-01 +6.2000e-02 3.0000e+00
++8.5800e-01 +5.8000e-02 3.0000e+00
++8.6200e-01 +5.8000e-02 3.0000e+00
++8.5800e-01 +6.2000e-02 3.0000e+00
++8.6200e-01 +6.2000e-02 3.0000e+00
++8.7800e-01 +5.8000e-02 3.0000e+00
++8.8200e-01 +5.8000e-02 3.0000e+00
++8.7800e-01 +6.2000e-02 3.0000e+00
++8.8200e-01 +6.2000e-02 3.0000e+00
++8.9800e-01 +5.8000e-02 3.0000e+00
++9.0200e-01 +5.8000e-02 3.0000e+00
++8.9800e-01 +6.2000e-02 3.0000e+00
++9.0200e-01 +6.2000e-02 3.0000e+00
++9.1800e-01 +5.8000e-02 3.0000e+00
++9.2200e-01 +5.8000e-02 3.0000e+00
++9.1800e-01 +6.2000e-02 3.0000e+00
++9.2200e-01 +6.2000e-02 3.0000e+00
++9.3800e-01 +5.8000e-02 3.0000e+00
++9.4200e-01 +5.8000e-02 3.0000e+00
++9.3800e-01 +6.2000e-02 3.0000e+00
++9.4200e-01 +6.2000e-02 3.0000e+00
++9.5800e-01 +5.8000e-02 3.0000e+00
++9.6200e-01 +5.8000e-02 3.0000e+00
++9.5800e-01 +6.2000e-02 3.0000e+00
++9.6200e-01 +6.2000e-02 3.0000e+00
++9.7800e-01 +5.8000e-02 3.0000e+00
++9.8200e-01 +5.8000e-02 3.0000e+00
++9.7800e-01 +6.2000e-02 3.0000e+00
++9.8200e-01 +6.2000e-02 3.0000e+00
++9.9800e-01 +5.8000e-02 3.0000e+00
++1.0020e+00 +5.8000e-02 3.0000e+00
++9.9800e-01 +6.2000e-02 3.0000e+00
++1.0020e+00 +6.2000e-02 3.0000e+00
++1.8000e-02 +7.8000e-02 3.0000e+00
++2.2000e-02 +7.8000e-02 3.0000e+00
++1.8000e-02 +8.2000e-02 3.0000e+00
++2.2000e-02 +8.2000e-02 3.0000e+00
++3.8000e-02 +7.8000e-02 3.0000e+00
++4.2000e-02 +7.8000e-02 3.0000e+00
++3.8000e-02 +8.2000e-02 3.0000e+00
++4.2000e-02 +8.2000e-02 3.0000e+00
++5.8000e-02 +7.8000e-02 3.0000e+00
++6.2000e-02 +7.8000e-02 3.0000e+00
++5.8000e-02 +8.2000e-02 3.0000e+00
++6.2000e-02 +8.2000e-02 3.0000e+00
++7.8000e-02 +7.8000e-02 3.0000e+00
++8.2000e-02 +7.8000e-02 3.0000e+00
++7.8000e-02 +8.2000e-02 3.0000e+00
++8.2000e-02 +8.2000e-02 3.0000e+00
++9.8000e-02 +7.8000e-02 3.0000e+00
++1.0200e-01 +7.8000e-02 3.0000e+00
++9.8000e-02 +8.2000e-02 3.0000e+00
++1.0200e-01 +8.2000e-02 3.0000e+00
++1.1800e-01 +7.8000e-02 3.0000e+00
++1.2200e-01 +7.8000e-02 3.0000e+00
++1.1800e-01 +8.2000e-02 3.0000e+00
++1.2200e-01 +8.2000e-02 3.0000e+00
++1.3800e-01 +7.8000e-02 3.0000e+00
++1.4200e-01 +7.8000e-02 3.0000e+00
++1.3800e-01 +8.2000e-02 3.0000e+00
++1.4200e-01 +8.2000e-02 3.0000e+00
++1.5800e-01 +7.8000e-02 3.0000e+00
++1.6200e-01 +7.8000e-02 3.0000e+00
++1.5800e-01 +8.2000e-02 3.0000e+00
++1.6200e-01 +8.2000e-02 3.0000e+00
++1.7800e-01 +7.8000e-02 3.0000e+00
++1.8200e-01 +7.8000e-02 3.0000e+00
++1.7800e-01 +8.2000e-02 3.0000e+00
++1.8200e-01 +8.2000e-02 3.0000e+00
++1.9800e-01 +7.8000e-02 3.0000e+00
++2.0200e-01 +7.8000e-02 3.0000e+00
++1.9800e-01 +8.2000e-02 3.0000e+00
++2.0200e-01 +8.2000e-02 3.0000e+00
++2.1800e-01 +7.8000e-02 3.0000e+00
++2.2200e-01 +7.8000e-02 3.0000e+00
++2.1800e-01 +8.2000e-02 3.0000e+00
++2.2200e-01 +8.2000e-02 3.0000e+00
++2.3800e-01 +7.8000e-02 3.0000e+00
++2.4200e-01 +7.8000e-02 3.0000e+00
++2.3800e-01 +8.2000e-02 3.0000e+00
++2.4200e-01 +8.2000e-02 3.0000e+00
++2.5800e-01 +7.8000e-02 3.0000e+00
++2.6200e-01 +7.8000e-02 3.0000e+00
++2.5800e-01 +8.2000e-02 3.0000e+00
++2.6200e-01 +8.2000e-02 3.0000e+00
++2.7800e-01 +7.8000e-02 3.0000e+00
++2.8200e-01 +7.8000e-02 3.0000e+00
++2.7800e-01 +8.2000e-02 3.0000e+00
++2.8200e-01 +8.2000e-02 3.0000e+00
++2.9800e-01 +7.8000e-02 3.0000e+00
++3.0200e-01 +7.8000e-02 3.0000e+00
++2.9800e-01 +8.2000e-02 3.0000e+00
++3.0200e-01 +8.2000e-02 3.0000e+00
++3.1800e-01 +7.8000e-02 3.0000e+00
++3.2200e-01 +7.8000e-02 3.0000e+00
++3.1800e-01 +8.2000e-02 3.0000e+00
++3.2200e-01 +8.2000e-02 3.0000e+00
++3.3800e-01 +7.8000e-02 3.0000e+00
++3.4200e-01 +7.8000e-02 3.0000e+00
++3.3800e-01 +8.2000e-02 3.0000e+00
++3.4200e-01 +8.2000e-02 3.0000e+00
++3.5800e-01 +7.8000e-02 3.0000e+00
++3.6200e-01 +7.8000e-02 3.0000e+00
++3.5800e-01 +8.2000e-02 3.0000e+00
++3.6200e-01 +8.2000e-02 3.0000e+00
++3.7800e-01 +7.8000e-02 3.0000e+00
++3.8200e-01 +7.8000e-02 3.0000e+00
++3.7800e-01 +8.2000e-02 3.0000e+00
++3.8200e-01 +8.2000e-02 3.0000e+00
++3.9800e-01 +7.8000e-02 3.0000e+00
++4.0200e-01 +7.8000e-02 3.0000e+00
++3.9800e-01 +8.2000e-02 3.0000e+00
++4.0200e-01 +8.2000e-02 3.0000e+00
++4.1800e-01 +7.8000e-02 3.0000e+00
++4.2200e-01 +7.8000e-02 3.0000e+00
++4.1800e-01 +8.2000e-02 3.0000e+00
++4.2200e-01 +8.2000e-02 3.0000e+00
++4.3800e-01 +7.8000e-02 3.0000e+00
++4.4200e-01 +7.8000e-02 3.0000e+00
++4.3800e-01 +8.2000e-02 3.0000e+00
++4.4200e-01 +8.2000e-02 3.0000e+00
++4.5800e-01 +7.8000e-02 3.0000e+00
++4.6200e-01 +7.8000e-02 3.0000e+00
++4.5800e-01 +8.2000e-02 3.0000e+00
++4.6200e-01 +8.2000e-02 3.0000e+00
++4.7800e-01 +7.8000e-02 3.0000e+00
++4.8200e-01 +7.8000e-02 3.0000e+00
++4.7800e-01 +8.2000e-02 3.0000e+00
++4.8200e-01 +8.2000e-02 3.0000e+00
++4.9800e-01 +7.8000e-02 3.0000e+00
++5.0200e-01 +7.8000e-02 3.0000e+00
++4.9800e-01 +8.2000e-02 3.0000e+00
++5.0200e-01 +8.2000e-02 3.0000e+00
++5.1800e-01 +7.8000e-02 3.0000e+00
++5.2200e-01 +7.8000e-02 3.0000e+00
++5.1800e-01 +8.2000e-02 3.0000e+00
++5.2200e-01 +8.2000e-02 3.0000e+00
++5.3800e-01 +7.8000e-02 3.0000e+00
++5.4200e-01 +7.8000e-02 3.0000e+00
++5.3800e-01 +8.2000e-02 3.0000e+00
++5.4200e-01 +8.2000e-02 3.0000e+00
++5.5800e-01 +7.8000e-02 3.0000e+00
++5.6200e-01 +7.8000e-02 3.0000e+00
++5.5800e-01 +8.2000e-02 3.0000e+00
++5.6200e-01 +8.2000e-02 3.0000e+00
++5.7800e-01 +7.8000e-02 3.0000e+00
++5.8200e-01 +7.8000e-02 3.0000e+00
++5.7800e-01 +8.2000e-02 3.0000e+00
++5.8200e-01 +8.2000e-02 3.0000e+00
++5.9800e-01 +7.8000e-02 3.0000e+00
++6.0200e-01 +7.8000e-02 3.0000e+00
++5.9800e-01 +8.2000e-02 3.0000e+00
++6.0200e-01 +8.2000e-02 3.0000e+00
++6.1800e-01 +7.8000e-02 3.0000e+00
++6.2200e-01 +7.8000e-02 3.0000e+00
++6.1800e-01 +8.2000e-02 3.0000e+00
++6.2200e-01 +8.2000e-02 3.0000e+00
++6.3800e-01 +7.8000e-02 3.0000e+00
++6.4200e-01 +7.8000e-02 3.0000e+00
++6.3800e-01 +8.2000e-02 3.0000e+00
++6.4200e-01 +8.2000e-02 3.0000e+00
++6.5800e-01 +7.8000e-02 3.0000e+00
++6.6200e-01 +7.8000e-02 3.0000e+00
++6.5800e-01 +8.2000e-02 3.0000e+00
++6.6200e-01 +8.2000e-02 3.0000e+00
++6.7800e-01 +7.8000e-02 3.0000e+00
++6.8200e-01 +7.8000e-02 3.0000e+00
++6.7800e-01 +8.2000e-02 3.0000e+00
++6.8200e-01 +8.2000e-02 3.0000e+00
++6.9800e-01 +7.8000e-02 3.0000e+00
++7.0200e-01 +7.8000e-02 3.0000e+00
++6.9800e-01 +8.2000e-02 3.0000e+00
++7.0200e-01 +8.2000e-02 3.0000e+00
++7.1800e-01 +7.8000e-02 3.0000e+00
++7.2200e-01 +7.8000e-02 3.0000e+00
++7.1800e-01 +8.2000e-02 3.0000e+00
++7.2200e-01 +8.2000e-02 3.0000e+00
++7.3800e-01 +7.8000e-02 3.0000e+00
++7.4200e-01 +7.8000e-02 3.0000e+00
++7.3800e-01 +8.2000e-02 3.0000e+00
++7.4200e-01 +8.2000e-02 3.0000e+00
++7.5800e-01 +7.8000e-02 3.0000e+00
++7.6200e-01 +7.8000e-02 3.0000e+00
++7.5800e-01 +8.2000e-02 3.0000e+00
++7.6200e-01 +8.2000e-02 3.0000e+00
++7.7800e-01 +7.8000e-02 3.0000e+00
++7.8200e-01 +7.8000e-02 3.0000e+00
++7.7800e-01 +8.2000e-02 3.0000e+00
++7.8200e-01 +8.2000e-02 3.0000e+00
++7.9800e-01 +7.8000e-02 3.0000e+00
++8.0200e-01 +7.8000e-02 3.0000e+00
++7.9800e-01 +8.2000e-02 3.0000e+00
++8.0200e-01 +8.2000e-02 3.0000e+00
++8.1800e-01 +7.8000e-02 3.0000e+00
++8.2200e-01 +7.8000e-02 3.0000e+00
++8.1800e-01 +8.2000e-02 3.0000e+00
++8.2200e-01 +8.2000e-02 3.0000e+00
++8.3800e-01 +7.8000e-02 3.0000e+00
++8.4200e-01 +7.8000e-02 3.0000e+00
++8.3800e-01 +8.2000e-02 3.0000e+00
++8.4200e-01 +8.2000e-02 3.0000e+00
++8.5800e-01 +7.8000e-02 3.0000e+00
++8.6200e-01 +7.8000e-02 3.0000e+00
++8.5800e-01 +8.2000e-02 3.0000e+00
++8.6200e-01 +8.2000e-02 3.0000e+00
++8.7800e-01 +7.8000e-02 3.0000e+00
++8.8200e-01 +7.8000e-02 3.0000e+00
++8.7800e-01 +8.2000e-02 3.0000e+00
++8.8200e-01 +8.2000e-02 3.0000e+00
++8.9800e-01 +7.8000e-02 3.0000e+00
++9.0200e-01 +7.8000e-02 3.0000e+00
++8.9800e-01 +8.2000e-02 3.0000e+00
++9.0200e-01 +8.2000e-02 3.0000e+00
++9.1800e-01 +7.8000e-02 3.0000e+00
++9.2200e-01 +7.8000e-02 3.0000e+00
++9.1800e-01 +8.2000e-02 3.0000e+00
++9.2200e-01 +8.2000e-02 3.0000e+00
++9.3800e-01 +7.8000e-02 3.0000e+00
++9.4200e-01 +7.8000e-02 3.0000e+00
++9.3800e-01 +8.2000e-02 3.0000e+00
++9.4200e-01 +8.2000e-02 3.0000e+00
++9.5800e-01 +7.8000e-02 3.0000e+00
++9.6200e-01 +7.8000e-02 3.0000e+00
++9.5800e-01 +8.2000e-02 3.0000e+00
++9.6200e-01 +8.2000e-02 3.0000e+00
++9.7800e-01 +7.8000e-02 3.0000e+00
++9.8200e-01 +7.8000e-02 3.0000e+00
++9.7800e-01 +8.2000e-02 3.0000e+00
++9.8200e-01 +8.2000e-02 3.0000e+00
++9.9800e-01 +7.8000e-02 3.0000e+00
++1.0020e+00 +7.8000e-02 3.0000e+00
++9.9800e-01 +8.2000e-02 3.0000e+00
++1.0020e+00 +8.2000e-02 3.0000e+00
++1.8000e-02 +9.8000e-02 3.0000e+00
++2.2000e-02 +9.8000e-02 3.0000e+00
++1.8000e-02 +1.0200e-01 3.0000e+00
++2.2000e-02 +1.0200e-01 3.0000e+00
++3.8000e-02 +9.8000e-02 3.0000e+00
++4.2000e-02 +9.8000e-02 3.0000e+00
++3.8000e-02 +1.0200e-01 3.0000e+00
++4.2000e-02 +1.0200e-01 3.0000e+00
++5.8000e-02 +9.8000e-02 3.0000e+00
++6.2000e-02 +9.8000e-02 3.0000e+00
++5.8000e-02 +1.0200e-01 3.0000e+00
++6.2000e-02 +1.0200e-01 3.0000e+00
++7.8000e-02 +9.8000e-02 3.0000e+00
++8.2000e-02 +9.8000e-02 3.0000e+00
++7.8000e-02 +1.0200e-01 3.0000e+00
++8.2000e-02 +1.0200e-01 3.0000e+00
++9.8000e-02 +9.8000e-02 3.0000e+00
++1.0200e-01 +9.8000e-02 3.0000e+00
++9.8000e-02 +1.0200e-01 3.0000e+00
++1.0200e-01 +1.0200e-01 3.0000e+00
++1.1800e-01 +9.8000e-02 3.0000e+00
++1.2200e-01 +9.8000e-02 3.0000e+00
++1.1800e-01 +1.0200e-01 3.0000e+00
++1.2200e-01 +1.0200e-01 3.0000e+00
++1.3800e-01 +9.8000e-02 3.0000e+00
++1.4200e-01 +9.8000e-02 3.0000e+00
++1.3800e-01 +1.0200e-01 3.0000e+00
++1.4200e-01 +1.0200e-01 3.0000e+00
++1.5800e-01 +9.8000e-02 3.0000e+00
++1.6200e-01 +9.8000e-02 3.0000e+00
++1.5800e-01 +1.0200e-01 3.0000e+00
++1.6200e-01 +1.0200e-01 3.0000e+00
++1.7800e-01 +9.8000e-02 3.0000e+00
++1.8200e-01 +9.8000e-02 3.0000e+00
++1.7800e-01 +1.0200e-01 3.0000e+00
++1.8200e-01 +1.0200e-01 3.0000e+00
++1.9800e-01 +9.8000e-02 3.0000e+00
++2.0200e-01 +9.8000e-02 3.0000e+00
++1.9800e-01 +1.0200e-01 3.0000e+00
++2.0200e-01 +1.0200e-01 3.0000e+00
++2.1800e-01 +9.8000e-02 3.0000e+00
++2.2200e-01 +9.8000e-02 3.0000e+00
++2.1800e-01 +1.0200e-01 3.0000e+00
++2.2200e-01 +1.0200e-01 3.0000e+00
++2.3800e-01 +9.8000e-02 3.0000e+00
++2.4200e-01 +9.8000e-02 3.0000e+00
++2.3800e-01 +1.0200e-01 3.0000e+00
++2.4200e-01 +1.0200e-01 3.0000e+00
++2.5800e-01 +9.8000e-02 3.0000e+00
++2.6200e-01 +9.8000e-02 3.0000e+00
++2.5800e-01 +1.0200e-01 3.0000e+00
++2.6200e-01 +1.0200e-01 3.0000e+00
++2.7800e-01 +9.8000e-02 3.0000e+00
++2.8200e-01 +9.8000e-02 3.0000e+00
++2.7800e-01 +1.0200e-01 3.0000e+00
++2.8200e-01 +1.0200e-01 3.0000e+00
++2.9800e-01 +9.8000e-02 3.0000e+00
++3.0200e-01 +9.8000e-02 3.0000e+00
++2.9800e-01 +1.0200e-01 3.0000e+00
++3.0200e-01 +1.0200e-01 3.0000e+00
++3.1800e-01 +9.8000e-02 3.0000e+00
++3.2200e-01 +9.8000e-02 3.0000e+00
++3.1800e-01 +1.0200e-01 3.0000e+00
++3.2200e-01 +1.0200e-01 3.0000e+00
++3.3800e-01 +9.8000e-02 3.0000e+00
++3.4200e-01 +9.8000e-02 3.0000e+00
++3.3800e-01 +1.0200e-01 3.0000e+00
++3.4200e-01 +1.0200e-01 3.0000e+00
++3.5800e-01 +9.8000e-02 3.0000e+00
++3.6200e-01 +9.8000e-02 3.0000e+00
++3.5800e-01 +1.0200e-01 3.0000e+00
++3.6200e-01 +1.0200e-01 3.0000e+00
++3.7800e-01 +9.8000e-02 3.0000e+00
++3.8200e-01 +9.8000e-02 3.0000e+00
++3.7800e-01 +1.0200e-01 3.0000e+00
++3.8200e-01 +1.0200e-01 3.0000e+00
++3.9800e-01 +9.8000e-02 3.0000e+00
++4.0200e-01 +9.8000e-02 3.0000e+00
++3.9800e-01 +1.0200e-01 3.0000e+00
++4.0200e-01 +1.0200e-01 3.0000e+00
++4.1800e-01 +9.8000e-02 3.0000e+00
++4.2200e-01 +9.8000e-02 3.0000e+00
++4.1800e-01 +1.0200e-01 3.0000e+00
++4.2200e-01 +1.0200e-01 3.0000e+00
++4.3800e-01 +9.8000e-02 3.0000e+00
++4.4200e-01 +9.8000e-02 3.0000e+00
++4.3800e-01 +1.0200e-01 3.0000e+00
++4.4200e-01 +1.0200e-01 3.0000e+00
++4.5800e-01 +9.8000e-02 3.0000e+00
++4.6200e-01 +9.8000e-02 3.0000e+00
++4.5800e-01 +1.0200e-01 3.0000e+00
++4.6200e-01 +1.0200e-01 3.0000e+00
++4.7800e-01 +9.8000e-02 3.0000e+00
++4.8200e-01 +9.8000e-02 3.0000e+00
++4.7800e-01 +1.0200e-01 3.0000e+00
++4.8200e-01 +1.0200e-01 3.0000e+00
++4.9800e-01 +9.8000e-02 3.0000e+00
++5.0200e-01 +9.8000e-02 3.0000e+00
++4.9800e-01 +1.0200e-01 3.0000e+00
++5.0200e-01 +1.0200e-01 3.0000e+00
++5.1800e-01 +9.8000e-02 3.0000e+00
++5.2200e-01 +9.8000e-02 3.0000e+00
++5.1800e-01 +1.0200e-01 3.0000e+00
++5.2200e-01 +1.0200e-01 3.0000e+00
++5.3800e-01 +9.8000e-02 3.0000e+00
++5.4200e-01 +9.8000e-02 3.0000e+00
++5.3800e-01 +1.0200e-01 3.0000e+00
++5.4200e-01 +1.0200e-01 3.0000e+00
++5.5800e-01 +9.8000e-02 3.0000e+00
++5.6200e-01 +9.8000e-02 3.0000e+00
++5.5800e-01 +1.0200e-01 3.0000e+00
++5.6200e-01 +1.0200e-01 3.0000e+00
++5.7800e-01 +9.8000e-02 3.0000e+00
++5.8200e-01 +9.8000e-02 3.0000e+00
++5.7800e-01 +1.0200e-01 3.0000e+00
++5.8200e-01 +1.0200e-01 3.0000e+00
++5.9800e-01 +9.8000e-02 3.0000e+00
++6.0200e-01 +9.8000e-02 3.0000e+00
++5.9800e-01 +1.0200e-01 3.0000e+00
++6.0200e-01 +1.0200e-01 3.0000e+00
++6.1800e-01 +9.8000e-02 3.0000e+00
++6.2200e-01 +9.8000e-02 3.0000e+00
++6.1800e-01 +1.0200e-01 3.0000e+00
++6.2200e-01 +1.0200e-01 3.0000e+00
++6.3800e-01 +9.8000e-02 3.0000e+00
++6.4200e-01 +9.8000e-02 3.0000e+00
++6.3800e-01 +1.0200e-01 3.0000e+00
++6.4200e-01 +1.0200e-01 3.0000e+00
++6.5800e-01 +9.8000e-02 3.0000e+00
++6.6200e-01 +9.8000e-02 3.0000e+00
++6.5800e-01 +1.0200e-01 3.0000e+00
++6.6200e-01 +1.0200e-01 3.0000e+00
++6.7800e-01 +9.8000e-02 3.0000e+00
++6.8200e-01 +9.8000e-02 3.0000e+00
++6.7800e-01 +1.0200e-01 3.0000e+00
++6.8200e-01 +1.0200e-01 3.0000e+00
++6.9800e-01 +9.8000e-02 3.0000e+00
++7.0200e-01 +9.8000e-02 3.0000e+00
++6.9800e-01 +1.0200e-01 3.0000e+00
++7.0200e-01 +1.0200e-01 3.0000e+00
++7.1800e-01 +9.8000e-02 3.0000e+00
++7.2200e-01 +9.8000e-02 3.0000e+00
++7.1800e-01 +1.0200e-01 3.0000e+00
++7.2200e-01 +1.0200e-01 3.0000e+00
++7.3800e-01 +9.8000e-02 3.0000e+00
++7.4200e-01 +9.8000e-02 3.0000e+00
++7.3800e-01 +1.0200e-01 3.0000e+00
++7.4200e-01 +1.0200e-01 3.0000e+00
++7.5800e-01 +9.8000e-02 3.0000e+00
++7.6200e-01 +9.8000e-02 3.0000e+00
++7.5800e-01 +1.0200e-01 3.0000e+00
++7.6200e-01 +1.0200e-01 3.0000e+00
++7.7800e-01 +9.8000e-02 3.0000e+00
++7.8200e-01 +9.8000e-02 3.0000e+00
++7.7800e-01 +1.0200e-01 3.0000e+00
++7.8200e-01 +1.0200e-01 3.0000e+00
++7.9800e-01 +9.8000e-02 3.0000e+00
++8.0200e-01 +9.8000e-02 3.0000e+00
++7.9800e-01 +1.0200e-01 3.0000e+00
++8.0200e-01 +1.0200e-01 3.0000e+00
++8.1800e-01 +9.8000e-02 3.0000e+00
++8.2200e-01 +9.8000e-02 3.0000e+00
++8.1800e-01 +1.0200e-01 3.0000e+00
++8.2200e-01 +1.0200e-01 3.0000e+00
++8.3800e-01 +9.8000e-02 3.0000e+00
++8.4200e-01 +9.8000e-02 3.0000e+00
++8.3800e-01 +1.0200e-01 3.0000e+00
++8.4200e-01 +1.0200e-01 3.0000e+00
++8.5800e-01 +9.8000e-02 3.0000e+00
++8.6200e-01 +9.8000e-02 3.0000e+00
++8.5800e-01 +1.0200e-01 3.0000e+00
++8.6200e-01 +1.0200e-01 3.0000e+00
++8.7800e-01 +9.8000e-02 3.0000e+00
++8.8200e-01 +9.8000e-02 3.0000e+00
++8.7800e-01 +1.0200e-01 3.0000e+00
++8.8200e-01 +1.0200e-01 3.0000e+00
++8.9800e-01 +9.8000e-02 3.0000e+00
++9.0200e-01 +9.8000e-02 3.0000e+00
++8.9800e-01 +1.0200e-01 3.0000e+00
++9.0200e-01 +1.0200e-01 3.0000e+00
++9.1800e-01 +9.8000e-02 3.0000e+00
++9.2200e-01 +9.8000e-02 3.0000e+00
++9.1800e-01 +1.0200e-01 3.0000e+00
++9.2200e-01 +1.0200e-01 3.0000e+00
++9.3800e-01 +9.8000e-02 3.0000e+00
++9.4200e-01 +9.8000e-02 3.0000e+00
++9.3800e-01 +1.0200e-01 3.0000e+00
++9.4200e-01 +1.0200e-01 3.0000e+00
++9.5800e-01 +9.8000e-02 3.0000e+00
++9.6200e-01 +9.8000e-02 3.0000e+00
++9.5800e-01 +1.0200e-01 3.0000e+00
++9.6200e-01 +1.0200e-01 3.0000e+00
++9.7800e-01 +9.8000e-02 3.0000e+00
++9.8200e-01 +9.8000e-02 3.0000e+00
++9.7800e-01 +1.0200e-01 3.0000e+00
++9.8200e-01 +1.0200e-01 3.0000e+00
++9.9800e-01 +9.8000e-02 3.0000e+00
++1.0020e+00 +9.8000e-02 3.0000e+00
++9.9800e-01 +1.0200e-01 3.0000e+00
++1.0020e+00 +1.0200e-01 3.0000e+00
++1.8000e-02 +1.1800e-01 3.0000e+00
++2.2000e-02 +1.1800e-01 3.0000e+00
++1.8000e-02 +1.2200e-01 3.0000e+00
++2.2000e-02 +1.2200e-01 3.0000e+00
++3.8000e-02 +1.1800e-01 3.0000e+00
++4.2000e-02 +1.1800e-01 3.0000e+00
++3.8000e-02 +1.2200e-01 3.0000e+00
++4.2000e-02 +1.2200e-01 3.0000e+00
++5.8000e-02 +1.1800e-01 3.0000e+00
++6.2000e-02 +1.1800e-01 3.0000e+00
++5.8000e-02 +1.2200e-01 3.0000e+00
++6.2000e-02 +1.2200e-01 3.0000e+00
++7.8000e-02 +1.1800e-01 3.0000e+00
++8.2000e-02 +1.1800e-01 3.0000e+00
++7.8000e-02 +1.2200e-01 3.0000e+00
++8.2000e-02 +1.2200e-01 3.0000e+00
++9.8000e-02 +1.1800e-01 3.0000e+00
++1.0200e-01 +1.1800e-01 3.0000e+00
++9.8000e-02 +1.2200e-01 3.0000e+00
++1.0200e-01 +1.2200e-01 3.0000e+00
++1.1800e-01 +1.1800e-01 3.0000e+00
++1.2200e-01 +1.1800e-01 3.0000e+00
++1.1800e-01 +1.2200e-01 3.0000e+00
++1.2200e-01 +1.2200e-01 3.0000e+00
++1.3800e-01 +1.1800e-01 3.0000e+00
++1.4200e-01 +1.1800e-01 3.0000e+00
++1.3800e-01 +1.2200e-01 3.0000e+00
++1.4200e-01 +1.2200e-01 3.0000e+00
++1.5800e-01 +1.1800e-01 3.0000e+00
++1.6200e-01 +1.1800e-01 3.0000e+00
++1.5800e-01 +1.2200e-01 3.0000e+00
++1.6200e-01 +1.2200e-01 3.0000e+00
++1.7800e-01 +1.1800e-01 3.0000e+00
++1.8200e-01 +1.1800e-01 3.0000e+00
++1.7800e-01 +1.2200e-01 3.0000e+00
++1.8200e-01 +1.2200e-01 3.0000e+00
++1.9800e-01 +1.1800e-01 3.0000e+00
++2.0200e-01 +1.1800e-01 3.0000e+00
++1.9800e-01 +1.2200e-01 3.0000e+00
++2.0200e-01 +1.2200e-01 3.0000e+00
++2.1800e-01 +1.1800e-01 3.0000e+00
++2.2200e-01 +1.1800e-01 3.0000e+00
++2.1800e-01 +1.2200e-01 3.0000e+00
++2.2200e-01 +1.2200e-01 3.0000e+00
++2.3800e-01 +1.1800e-01 3.0000e+00
++2.4200e-01 +1.1800e-01 3.0000e+00
++2.3800e-01 +1.2200e-01 3.0000e+00
++2.4200e-01 +1.2200e-01 3.0000e+00
++2.5800e-01 +1.1800e-01 3.0000e+00
++2.6200e-01 +1.1800e-01 3.0000e+00
++2.5800e-01 +1.2200e-01 3.0000e+00
++2.6200e-01 +1.2200e-01 3.0000e+00
++2.7800e-01 +1.1800e-01 3.0000e+00
++2.8200e-01 +1.1800e-01 3.0000e+00
++2.7800e-01 +1.2200e-01 3.0000e+00
++2.8200e-01 +1.2200e-01 3.0000e+00
++2.9800e-01 +1.1800e-01 3.0000e+00
++3.0200e-01 +1.1800e-01 3.0000e+00
++2.9800e-01 +1.2200e-01 3.0000e+00
++3.0200e-01 +1.2200e-01 3.0000e+00
++3.1800e-01 +1.1800e-01 3.0000e+00
++3.2200e-01 +1.1800e-01 3.0000e+00
++3.1800e-01 +1.2200e-01 3.0000e+00
++3.2200e-01 +1.2200e-01 3.0000e+00
++3.3800e-01 +1.1800e-01 3.0000e+00
++3.4200e-01 +1.1800e-01 3.0000e+00
++3.3800e-01 +1.2200e-01 3.0000e+00
++3.4200e-01 +1.2200e-01 3.0000e+00
++3.5800e-01 +1.1800e-01 3.0000e+00
++3.6200e-01 +1.1800e-01 3.0000e+00
++3.5800e-01 +1.2200e-01 3.0000e+00
++3.6200e-01 +1.2200e-01 3.0000e+00
++3.7800e-01 +1.1800e-01 3.0000e+00
++3.8200e-01 +1.1800e-01 3.0000e+00
++3.7800e-01 +1.2200e-01 3.0000e+00
++3.8200e-01 +1.2200e-01 3.0000e+00
++3.9800e-01 +1.1800e-01 3.0000e+00
++4.0200e-01 +1.1800e-01 3.0000e+00
++3.9800e-01 +1.2200e-01 3.0000e+00
++4.0200e-01 +1.2200e-01 3.0000e+00
++4.1800e-01 +1.1800e-01 3.0000e+00
++4.2200e-01 +1.1800e-01 3.0000e+00
++4.1800e-01 +1.2200e-01 3.0000e+00
++4.2200e-01 +1.2200e-01 3.0000e+00
++4.3800e-01 +1.1800e-01 3.0000e+00
++4.4200e-01 +1.1800e-01 3.0000e+00
++4.3800e-01 +1.2200e-01 3.0000e+00
++4.4200e-01 +1.2200e-01 3.0000e+00
++4.5800e-01 +1.1800e-01 3.0000e+00
++4.6200e-01 +1.1800e-01 3.0000e+00
++4.5800e-01 +1.2200e-01 3.0000e+00
++4.6200e-01 +1.2200e-01 3.0000e+00
++4.7800e-01 +1.1800e-01 3.0000e+00
++4.8200e-01 +1.1800e-01 3.0000e+00
++4.7800e-01 +1.2200e-01 3.0000e+00
++4.8200e-01 +1.2200e-01 3.0000e+00
++4.9800e-01 +1.1800e-01 3.0000e+00
++5.0200e-01 +1.1800e-01 3.0000e+00
++4.9800e-01 +1.2200e-01 3.0000e+00
++5.0200e-01 +1.2200e-01 3.0000e+00
++5.1800e-01 +1.1800e-01 3.0000e+00
++5.2200e-01 +1.1800e-01 3.0000e+00
++5.1800e-01 +1.2200e-01 3.0000e+00
++5.2200e-01 +1.2200e-01 3.0000e+00
++5.3800e-01 +1.1800e-01 3.0000e+00
++5.4200e-01 +1.1800e-01 3.0000e+00
++5.3800e-01 +1.2200e-01 3.0000e+00
++5.4200e-01 +1.2200e-01 3.0000e+00
++5.5800e-01 +1.1800e-01 3.0000e+00
++5.6200e-01 +1.1800e-01 3.0000e+00
++5.5800e-01 +1.2200e-01 3.0000e+00
++5.6200e-01 +1.2200e-01 3.0000e+00
++5.7800e-01 +1.1800e-01 3.0000e+00
++5.8200e-01 +1.1800e-01 3.0000e+00
++5.7800e-01 +1.2200e-01 3.0000e+00
++5.8200e-01 +1.2200e-01 3.0000e+00
++5.9800e-01 +1.1800e-01 3.0000e+00
++6.0200e-01 +1.1800e-01 3.0000e+00
++5.9800e-01 +1.2200e-01 3.0000e+00
++6.0200e-01 +1.2200e-01 3.0000e+00
++6.1800e-01 +1.1800e-01 3.0000e+00
++6.2200e-01 +1.1800e-01 3.0000e+00
++6.1800e-01 +1.2200e-01 3.0000e+00
++6.2200e-01 +1.2200e-01 3.0000e+00
++6.3800e-01 +1.1800e-01 3.0000e+00
++6.4200e-01 +1.1800e-01 3.0000e+00
++6.3800e-01 +1.2200e-01 3.0000e+00
++6.4200e-01 +1.2200e-01 3.0000e+00
++6.5800e-01 +1.1800e-01 3.0000e+00
++6.6200e-01 +1.1800e-01 3.0000e+00
++6.5800e-01 +1.2200e-01 3.0000e+00
++6.6200e-01 +1.2200e-01 3.0000e+00
++6.7800e-01 +1.1800e-01 3.0000e+00
++6.8200e-01 +1.1800e-01 3.0000e+00
++6.7800e-01 +1.2200e-01 3.0000e+00
++6.8200e-01 +1.2200e-01 3.0000e+00
++6.9800e-01 +1.1800e-01 3.0000e+00
++7.0200e-01 +1.1800e-01 3.0000e+00
++6.9800e-01 +1.2200e-01 3.0000e+00
++7.0200e-01 +1.2200e-01 3.0000e+00
++7.1800e-01 +1.1800e-01 3.0000e+00
++7.2200e-01 +1.1800e-01 3.0000e+00
++7.1800e-01 +1.2200e-01 3.0000e+00
++7.2200e-01 +1.2200e-01 3.0000e+00
++7.3800e-01 +1.1800e-01 3.0000e+00
++7.4200e-01 +1.1800e-01 3.0000e+00
++7.3800e-01 +1.2200e-01 3.0000e+00
++7.4200e-01 +1.2200e-01 3.0000e+00
++7.5800e-01 +1.1800e-01 3.0000e+00
++7.6200e-01 +1.1800e-01 3.0000e+00
++7.5800e-01 +1.2200e-01 3.0000e+00
++7.6200e-01 +1.2200e-01 3.0000e+00
++7.7800e-01 +1.1800e-01 3.0000e+00
++7.8200e-01 +1.1800e-01 3.0000e+00
++7.7800e-01 +1.2200e-01 3.0000e+00
++7.8200e-01 +1.2200e-01 3.0000e+00
++7.9800e-01 +1.1800e-01 3.0000e+00
++8.0200e-01 +1.1800e-01 3.0000e+00
++7.9800e-01 +1.2200e-01 3.0000e+00
++8.0200e-01 +1.2200e-01 3.0000e+00
++8.1800e-01 +1.1800e-01 3.0000e+00
++8.2200e-01 +1.1800e-01 3.0000e+00
++8.1800e-01 +1.2200e-01 3.0000e+00
++8.2200e-01 +1.2200e-01 3.0000e+00
++8.3800e-01 +1.1800e-01 3.0000e+00
++8.4200e-01 +1.1800e-01 3.0000e+00
++8.3800e-01 +1.2200e-01 3.0000e+00
++8.4200e-01 +1.2200e-01 3.0000e+00
++8.5800e-01 +1.1800e-01 3.0000e+00
++8.6200e-01 +1.1800e-01 3.0000e+00
++8.5800e-01 +1.2200e-01 3.0000e+00
++8.6200e-01 +1.2200e-01 3.0000e+00
++8.7800e-01 +1.1800e-01 3.0000e+00
++8.8200e-01 +1.1800e-01 3.0000e+00
++8.7800e-01 +1.2200e-01 3.0000e+00
++8.8200e-01 +1.2200e-01 3.0000e+00
++8.9800e-01 +1.1800e-01 3.0000e+00
++9.0200e-01 +1.1800e-01 3.0000e+00
++8.9800e-01 +1.2200e-01 3.0000e+00
++9.0200e-01 +1.2200e-01 3.0000e+00
++9.1800e-01 +1.1800e-01 3.0000e+00
++9.2200e-01 +1.1800e-01 3.0000e+00
++9.1800e-01 +1.2200e-01 3.0000e+00
++9.2200e-01 +1.2200e-01 3.0000e+00
++9.3800e-01 +1.1800e-01 3.0000e+00
++9.4200e-01 +1.1800e-01 3.0000e+00
++9.3800e-01 +1.2200e-01 3.0000e+00
++9.4200e-01 +1.2200e-01 3.0000e+00
++9.5800e-01 +1.1800e-01 3.0000e+00
++9.6200e-01 +1.1800e-01 3.0000e+00
++9.5800e-01 +1.2200e-01 3.0000e+00
++9.6200e-01 +1.2200e-01 3.0000e+00
++9.7800e-01 +1.1800e-01 3.0000e+00
++9.8200e-01 +1.1800e-01 3.0000e+00
++9.7800e-01 +1.2200e-01 3.0000e+00
++9.8200e-01 +1.2200e-01 3.0000e+00
++9.9800e-01 +1.1800e-01 3.0000e+00
++1.0020e+00 +1.1800e-01 3.0000e+00
++9.9800e-01 +1.2200e-01 3.0000e+00
++1.0020e+00 +1.2200e-01 3.0000e+00
++1.8000e-02 +1.3800e-01 3.0000e+00
++2.2000e-02 +1.3800e-01 3.0000e+00
++1.8000e-02 +1.4200e-01 3.0000e+00
++2.2000e-02 +1.4200e-01 3.0000e+00
++3.8000e-02 +1.3800e-01 3.0000e+00
++4.2000e-02 +1.3800e-01 3.0000e+00
++3.8000e-02 +1.4200e-01 3.0000e+00
++4.2000e-02 +1.4200e-01 3.0000e+00
++5.8000e-02 +1.3800e-01 3.0000e+00
++6.2000e-02 +1.3800e-01 3.0000e+00
++5.8000e-02 +1.4200e-01 3.0000e+00
++6.2000e-02 +1.4200e-01 3.0000e+00
++7.8000e-02 +1.3800e-01 3.0000e+00
++8.2000e-02 +1.3800e-01 3.0000e+00
++7.8000e-02 +1.4200e-01 3.0000e+00
++8.2000e-02 +1.4200e-01 3.0000e+00
++9.8000e-02 +1.3800e-01 3.0000e+00
++1.0200e-01 +1.3800e-01 3.0000e+00
++9.8000e-02 +1.4200e-01 3.0000e+00
++1.0200e-01 +1.4200e-01 3.0000e+00
++1.1800e-01 +1.3800e-01 3.0000e+00
++1.2200e-01 +1.3800e-01 3.0000e+00
++1.1800e-01 +1.4200e-01 3.0000e+00
++1.2200e-01 +1.4200e-01 3.0000e+00
++1.3800e-01 +1.3800e-01 3.0000e+00
++1.4200e-01 +1.3800e-01 3.0000e+00
++1.3800e-01 +1.4200e-01 3.0000e+00
++1.4200e-01 +1.4200e-01 3.0000e+00
++1.5800e-01 +1.3800e-01 3.0000e+00
++1.6200e-01 +1.3800e-01 3.0000e+00
++1.5800e-01 +1.4200e-01 3.0000e+00
++1.6200e-01 +1.4200e-01 3.0000e+00
++1.7800e-01 +1.3800e-01 3.0000e+00
++1.8200e-01 +1.3800e-01 3.0000e+00
++1.7800e-01 +1.4200e-01 3.0000e+00
++1.8200e-01 +1.4200e-01 3.0000e+00
++1.9800e-01 +1.3800e-01 3.0000e+00
++2.0200e-01 +1.3800e-01 3.0000e+00
++1.9800e-01 +1.4200e-01 3.0000e+00
++2.0200e-01 +1.4200e-01 3.0000e+00
++2.1800e-01 +1.3800e-01 3.0000e+00
++2.2200e-01 +1.3800e-01 3.0000e+00
++2.1800e-01 +1.4200e-01 3.0000e+00
++2.2200e-01 +1.4200e-01 3.0000e+00
++2.3800e-01 +1.3800e-01 3.0000e+00
++2.4200e-01 +1.3800e-01 3.0000e+00
++2.3800e-01 +1.4200e-01 3.0000e+00
++2.4200e-01 +1.4200e-01 3.0000e+00
++2.5800e-01 +1.3800e-01 3.0000e+00
++2.6200e-01 +1.3800e-01 3.0000e+00
++2.5800e-01 +1.4200e-01 3.0000e+00
++2.6200e-01 +1.4200e-01 3.0000e+00
++2.7800e-01 +1.3800e-01 3.0000e+00
++2.8200e-01 +1.3800e-01 3.0000e+00
++2.7800e-01 +1.4200e-01 3.0000e+00
++2.8200e-01 +1.4200e-01 3.0000e+00
++2.9800e-01 +1.3800e-01 3.0000e+00
++3.0200e-01 +1.3800e-01 3.0000e+00
++2.9800e-01 +1.4200e-01 3.0000e+00
++3.0200e-01 +1.4200e-01 3.0000e+00
++3.1800e-01 +1.3800e-01 3.0000e+00
++3.2200e-01 +1.3800e-01 3.0000e+00
++3.1800e-01 +1.4200e-01 3.0000e+00
++3.2200e-01 +1.4200e-01 3.0000e+00
++3.3800e-01 +1.3800e-01 3.0000e+00
++3.4200e-01 +1.3800e-01 3.0000e+00
++3.3800e-01 +1.4200e-01 3.0000e+00
++3.4200e-01 +1.4200e-01 3.0000e+00
++3.5800e-01 +1.3800e-01 3.0000e+00
++3.6200e-01 +1.3800e-01 3.0000e+00
++3.5800e-01 +1.4200e-01 3.0000e+00
++3.6200e-01 +1.4200e-01 3.0000e+00
++3.7800e-01 +1.3800e-01 3.0000e+00
++3.8200e-01 +1.3800e-01 3.0000e+00
++3.7800e-01 +1.4200e-01 3.0000e+00
++3.8200e-01 +1.4200e-01 3.0000e+00
++3.9800e-01 +1.3800e-01 3.0000e+00
++4.0200e-01 +1.3800e-01 3.0000e+00
++3.9800e-01 +1.4200e-01 3.0000e+00
++4.0200e-01 +1.4200e-01 3.0000e+00
++4.1800e-01 +1.3800e-01 3.0000e+00
++4.2200e-01 +1.3800e-01 3.0000e+00
++4.1800e-01 +1.4200e-01 3.0000e+00
++4.2200e-01 +1.4200e-01 3.0000e+00
++4.3800e-01 +1.3800e-01 3.0000e+00
++4.4200e-01 +1.3800e-01 3.0000e+00
++4.3800e-01 +1.4200e-01 3.0000e+00
++4.4200e-01 +1.4200e-01 3.0000e+00
++4.5800e-01 +1.3800e-01 3.0000e+00
++4.6200e-01 +1.3800e-01 3.0000e+00
++4.5800e-01 +1.4200e-01 3.0000e+00
++4.6200e-01 +1.4200e-01 3.0000e+00
++4.7800e-01 +1.3800e-01 3.0000e+00
++4.8200e-01 +1.3800e-01 3.0000e+00
++4.7800e-01 +1.4200e-01 3.0000e+00
++4.8200e-01 +1.4200e-01 3.0000e+00
++4.9800e-01 +1.3800e-01 3.0000e+00
++5.0200e-01 +1.3800e-01 3.0000e+00
++4.9800e-01 +1.4200e-01 3.0000e+00
++5.0200e-01 +1.4200e-01 3.0000e+00
++5.1800e-01 +1.3800e-01 3.0000e+00
++5.2200e-01 +1.3800e-01 3.0000e+00
++5.1800e-01 +1.4200e-01 3.0000e+00
++5.2200e-01 +1.4200e-01 3.0000e+00
++5.3800e-01 +1.3800e-01 3.0000e+00
++5.4200e-01 +1.3800e-01 3.0000e+00
++5.3800e-01 +1.4200e-01 3.0000e+00
++5.4200e-01 +1.4200e-01 3.0000e+00
++5.5800e-01 +1.3800e-01 3.0000e+00
++5.6200e-01 +1.3800e-01 3.0000e+00
++5.5800e-01 +1.4200e-01 3.0000e+00
++5.6200e-01 +1.4200e-01 3.0000e+00
++5.7800e-01 +1.3800e-01 3.0000e+00
++5.8200e-01 +1.3800e-01 3.0000e+00
++5.7800e-01 +1.4200e-01 3.0000e+00
++5.8200e-01 +1.4200e-01 3.0000e+00
++5.9800e-01 +1.3800e-01 3.0000e+00
++6.0200e-01 +1.3800e-01 3.0000e+00
++5.9800e-01 +1.4200e-01 3.0000e+00
++6.0200e-01 +1.4200e-01 3.0000e+00
++6.1800e-01 +1.3800e-01 3.0000e+00
++6.2200e-01 +1.3800e-01 3.0000e+00
++6.1800e-01 +1.4200e-01 3.0000e+00
++6.2200e-01 +1.4200e-01 3.0000e+00
++6.3800e-01 +1.3800e-01 3.0000e+00
++6.4200e-01 +1.3800e-01 3.0000e+00
++6.3800e-01 +1.4200e-01 3.0000e+00
++6.4200e-01 +1.4200e-01 3.0000e+00
++6.5800e-01 +1.3800e-01 3.0000e+00
++6.6200e-01 +1.3800e-01 3.0000e+00
++6.5800e-01 +1.4200e-01 3.0000e+00
++6.6200e-01 +1.4200e-01 3.0000e+00
++6.7800e-01 +1.3800e-01 3.0000e+00
++6.8200e-01 +1.3800e-01 3.0000e+00
++6.7800e-01 +1.4200e-01 3.0000e+00
++6.8200e-01 +1.4200e-01 3.0000e+00
++6.9800e-01 +1.3800e-01 3.0000e+00
++7.0200e-01 +1.3800e-01 3.0000e+00
++6.9800e-01 +1.4200e-01 3.0000e+00
++7.0200e-01 +1.4200e-01 3.0000e+00
++7.1800e-01 +1.3800e-01 3.0000e+00
++7.2200e-01 +1.3800e-01 3.0000e+00
++7.1800e-01 +1.4200e-01 3.0000e+00
++7.2200e-01 +1.4200e-01 3.0000e+00
++7.3800e-01 +1.3800e-01 3.0000e+00
++7.4200e-01 +1.3800e-01 3.0000e+00
++7.3800e-01 +1.4200e-01 3.0000e+00
++7.4200e-01 +1.4200e-01 3.0000e+00
++7.5800e-01 +1.3800e-01 3.0000e+00
++7.6200e-01 +1.3800e-01 3.0000e+00
++7.5800e-01 +1.4200e-01 3.0000e+00
++7.6200e-01 +1.4200e-01 3.0000e+00
++7.7800e-01 +1.3800e-01 3.0000e+00
++7.8200e-01 +1.3800e-01 3.0000e+00
++7.7800e-01 +1.4200e-01 3.0000e+00
++7.8200e-01 +1.4200e-01 3.0000e+00
++7.9800e-01 +1.3800e-01 3.0000e+00
++8.0200e-01 +1.3800e-01 3.0000e+00
++7.9800e-01 +1.4200e-01 3.0000e+00
++8.0200e-01 +1.4200e-01 3.0000e+00
++8.1800e-01 +1.3800e-01 3.0000e+00
++8.2200e-01 +1.3800e-01 3.0000e+00
++8.1800e-01 +1.4200e-01 3.0000e+00
++8.2200e-01 +1.4200e-01 3.0000e+00
++8.3800e-01 +1.3800e-01 3.0000e+00
++8.4200e-01 +1.3800e-01 3.0000e+00
++8.3800e-01 +1.4200e-01 3.0000e+00
++8.4200e-01 +1.4200e-01 3.0000e+00
++8.5800e-01 +1.3800e-01 3.0000e+00
++8.6200e-01 +1.3800e-01 3.0000e+00
++8.5800e-01 +1.4200e-01 3.0000e+00
++8.6200e-01 +1.4200e-01 3.0000e+00
++8.7800e-01 +1.3800e-01 3.0000e+00
++8.8200e-01 +1.3800e-01 3.0000e+00
++8.7800e-01 +1.4200e-01 3.0000e+00
++8.8200e-01 +1.4200e-01 3.0000e+00
++8.9800e-01 +1.3800e-01 3.0000e+00
++9.0200e-01 +1.3800e-01 3.0000e+00
++8.9800e-01 +1.4200e-01 3.0000e+00
++9.0200e-01 +1.4200e-01 3.0000e+00
++9.1800e-01 +1.3800e-01 3.0000e+00
++9.2200e-01 +1.3800e-01 3.0000e+00
++9.1800e-01 +1.4200e-01 3.0000e+00
++9.2200e-01 +1.4200e-01 3.0000e+00
++9.3800e-01 +1.3800e-01 3.0000e+00
++9.4200e-01 +1.3800e-01 3.0000e+00
++9.3800e-01 +1.4200e-01 3.0000e+00
++9.4200e-01 +1.4200e-01 3.0000e+00
++9.5800e-01 +1.3800e-01 3.0000e+00
++9.6200e-01 +1.3800e-01 3.0000e+00
++9.5800e-01 +1.4200e-01 3.0000e+00
++9.6200e-01 +1.4200e-01 3.0000e+00
++9.7800e-01 +1.3800e-01 3.0000e+00
++9.8200e-01 +1.3800e-01 3.0000e+00
++9.7800e-01 +1.4200e-01 3.0000e+00
++9.8200e-01 +1.4200e-01 3.0000e+00
++9.9800e-01 +1.3800e-01 3.0000e+00
++1.0020e+00 +1.3800e-01 3.0000e+00
++9.9800e-01 +1.4200e-01 3.0000e+00
++1.0020e+00 +1.4200e-01 3.0000e+00
++1.8000e-02 +1.5800e-01 3.0000e+00
++2.2000e-02 +1.5800e-01 3.0000e+00
++1.8000e-02 +1.6200e-01 3.0000e+00
++2.2000e-02 +1.6200e-01 3.0000e+00
++3.8000e-02 +1.5800e-01 3.0000e+00
++4.2000e-02 +1.5800e-01 3.0000e+00
++3.8000e-02 +1.6200e-01 3.0000e+00
++4.2000e-02 +1.6200e-01 3.0000e+00
++5.8000e-02 +1.5800e-01 3.0000e+00
++6.2000e-02 +1.5800e-01 3.0000e+00
++5.8000e-02 +1.6200e-01 3.0000e+00
++6.2000e-02 +1.6200e-01 3.0000e+00
++7.8000e-02 +1.5800e-01 3.0000e+00
++8.2000e-02 +1.5800e-01 3.0000e+00
++7.8000e-02 +1.6200e-01 3.0000e+00
++8.2000e-02 +1.6200e-01 3.0000e+00
++9.8000e-02 +1.5800e-01 3.0000e+00
++1.0200e-01 +1.5800e-01 3.0000e+00
++9.8000e-02 +1.6200e-01 3.0000e+00
++1.0200e-01 +1.6200e-01 3.0000e+00
++1.1800e-01 +1.5800e-01 3.0000e+00
++1.2200e-01 +1.5800e-01 3.0000e+00
++1.1800e-01 +1.6200e-01 3.0000e+00
++1.2200e-01 +1.6200e-01 3.0000e+00
++1.3800e-01 +1.5800e-01 3.0000e+00
++1.4200e-01 +1.5800e-01 3.0000e+00
++1.3800e-01 +1.6200e-01 3.0000e+00
++1.4200e-01 +1.6200e-01 3.0000e+00
++1.5800e-01 +1.5800e-01 3.0000e+00
++1.6200e-01 +1.5800e-01 3.0000e+00
++1.5800e-01 +1.6200e-01 3.0000e+00
++1.6200e-01 +1.6200e-01 3.0000e+00
++1.7800e-01 +1.5800e-01 3.0000e+00
++1.8200e-01 +1.5800e-01 3.0000e+00
++1.7800e-01 +1.6200e-01 3.0000e+00
++1.8200e-01 +1.6200e-01 3.0000e+00
++1.9800e-01 +1.5800e-01 3.0000e+00
++2.0200e-01 +1.5800e-01 3.0000e+00
++1.9800e-01 +1.6200e-01 3.0000e+00
++2.0200e-01 +1.6200e-01 3.0000e+00
++2.1800e-01 +1.5800e-01 3.0000e+00
++2.2200e-01 +1.5800e-01 3.0000e+00
++2.1800e-01 +1.6200e-01 3.0000e+00
++2.2200e-01 +1.6200e-01 3.0000e+00
++2.3800e-01 +1.5800e-01 3.0000e+00
++2.4200e-01 +1.5800e-01 3.0000e+00
++2.3800e-01 +1.6200e-01 3.0000e+00
++2.4200e-01 +1.6200e-01 3.0000e+00
++2.5800e-01 +1.5800e-01 3.0000e+00
++2.6200e-01 +1.5800e-01 3.0000e+00
++2.5800e-01 +1.6200e-01 3.0000e+00
++2.6200e-01 +1.6200e-01 3.0000e+00
++2.7800e-01 +1.5800e-01 3.0000e+00
++2.8200e-01 +1.5800e-01 3.0000e+00
++2.7800e-01 +1.6200e-01 3.0000e+00
++2.8200e-01 +1.6200e-01 3.0000e+00
++2.9800e-01 +1.5800e-01 3.0000e+00
++3.0200e-01 +1.5800e-01 3.0000e+00
++2.9800e-01 +1.6200e-01 3.0000e+00
++3.0200e-01 +1.6200e-01 3.0000e+00
++3.1800e-01 +1.5800e-01 3.0000e+00
++3.2200e-01 +1.5800e-01 3.0000e+00
++3.1800e-01 +1.6200e-01 3.0000e+00
++3.2200e-01 +1.6200e-01 3.0000e+00
++3.3800e-01 +1.5800e-01 3.0000e+00
++3.4200e-01 +1.5800e-01 3.0000e+00
++3.3800e-01 +1.6200e-01 3.0000e+00
++3.4200e-01 +1.6200e-01 3.0000e+00
++3.5800e-01 +1.5800e-01 3.0000e+00
++3.6200e-01 +1.5800e-01 3.0000e+00
++3.5800e-01 +1.6200e-01 3.0000e+00
++3.6200e-01 +1.6200e-01 3.0000e+00
++3.7800e-01 +1.5800e-01 3.0000e+00
++3.8200e-01 +1.5800e-01 3.0000e+00
++3.7800e-01 +1.6200e-01 3.0000e+00
++3.8200e-01 +1.6200e-01 3.0000e+00
++3.9800e-01 +1.5800e-01 3.0000e+00
++4.0200e-01 +1.5800e-01 3.0000e+00
++3.9800e-01 +1.6200e-01 3.0000e+00
++4.0200e-01 +1.6200e-01 3.0000e+00
++4.1800e-01 +1.5800e-01 3.0000e+00
++4.2200e-01 +1.5800e-01 3.0000e+00
++4.1800e-01 +1.6200e-01 3.0000e+00
++4.2200e-01 +1.6200e-01 3.0000e+00
++4.3800e-01 +1.5800e-01 3.0000e+00
++4.4200e-01 +1.5800e-01 3.0000e+00
++4.3800e-01 +1.6200e-01 3.0000e+00
++4.4200e-01 +1.6200e-01 3.0000e+00
++4.5800e-01 +1.5800e-01 3.0000e+00
++4.6200e-01 +1.5800e-01 3.0000e+00
++4.5800e-01 +1.6200e-01 3.0000e+00
++4.6200e-01 +1.6200e-01 3.0000e+00
++4.7800e-01 +1.5800e-01 3.0000e+00
++4.8200e-01 +1.5800e-01 3.0000e+00
++4.7800e-01 +1.6200e-01 3.0000e+00
++4.8200e-01 +1.6200e-01 3.0000e+00
++4.9800e-01 +1.5800e-01 3.0000e+00
++5.0200e-01 +1.5800e-01 3.0000e+00
++4.9800e-01 +1.6200e-01 3.0000e+00
++5.0200e-01 +1.6200e-01 3.0000e+00
++5.1800e-01 +1.5800e-01 3.0000e+00
++5.2200e-01 +1.5800e-01 3.0000e+00
++5.1800e-01 +1.6200e-01 3.0000e+00
++5.2200e-01 +1.6200e-01 3.0000e+00
++5.3800e-01 +1.5800e-01 3.0000e+00
++5.4200e-01 +1.5800e-01 3.0000e+00
++5.3800e-01 +1.6200e-01 3.0000e+00
++5.4200e-01 +1.6200e-01 3.0000e+00
++5.5800e-01 +1.5800e-01 3.0000e+00
++5.6200e-01 +1.5800e-01 3.0000e+00
++5.5800e-01 +1.6200e-01 3.0000e+00
++5.6200e-01 +1.6200e-01 3.0000e+00
++5.7800e-01 +1.5800e-01 3.0000e+00
++5.8200e-01 +1.5800e-01 3.0000e+00
++5.7800e-01 +1.6200e-01 3.0000e+00
++5.8200e-01 +1.6200e-01 3.0000e+00
++5.9800e-01 +1.5800e-01 3.0000e+00
++6.0200e-01 +1.5800e-01 3.0000e+00
++5.9800e-01 +1.6200e-01 3.0000e+00
++6.0200e-01 +1.6200e-01 3.0000e+00
++6.1800e-01 +1.5800e-01 3.0000e+00
++6.2200e-01 +1.5800e-01 3.0000e+00
++6.1800e-01 +1.6200e-01 3.0000e+00
++6.2200e-01 +1.6200e-01 3.0000e+00
++6.3800e-01 +1.5800e-01 3.0000e+00
++6.4200e-01 +1.5800e-01 3.0000e+00
++6.3800e-01 +1.6200e-01 3.0000e+00
++6.4200e-01 +1.6200e-01 3.0000e+00
++6.5800e-01 +1.5800e-01 3.0000e+00
++6.6200e-01 +1.5800e-01 3.0000e+00
++6.5800e-01 +1.6200e-01 3.0000e+00
++6.6200e-01 +1.6200e-01 3.0000e+00
++6.7800e-01 +1.5800e-01 3.0000e+00
++6.8200e-01 +1.5800e-01 3.0000e+00
++6.7800e-01 +1.6200e-01 3.0000e+00
++6.8200e-01 +1.6200e-01 3.0000e+00
++6.9800e-01 +1.5800e-01 3.0000e+00
++7.0200e-01 +1.5800e-01 3.0000e+00
++6.9800e-01 +1.6200e-01 3.0000e+00
++7.0200e-01 +1.6200e-01 3.0000e+00
++7.1800e-01 +1.5800e-01 3.0000e+00
++7.2200e-01 +1.5800e-01 3.0000e+00
++7.1800e-01 +1.6200e-01 3.0000e+00
++7.2200e-01 +1.6200e-01 3.0000e+00
++7.3800e-01 +1.5800e-01 3.0000e+00
++7.4200e-01 +1.5800e-01 3.0000e+00
++7.3800e-01 +1.6200e-01 3.0000e+00
++7.4200e-01 +1.6200e-01 3.0000e+00
++7.5800e-01 +1.5800e-01 3.0000e+00
++7.6200e-01 +1.5800e-01 3.0000e+00
++7.5800e-01 +1.6200e-01 3.0000e+00
++7.6200e-01 +1.6200e-01 3.0000e+00
++7.7800e-01 +1.5800e-01 3.0000e+00
++7.8200e-01 +1.5800e-01 3.0000e+00
++7.7800e-01 +1.6200e-01 3.0000e+00
++7.8200e-01 +1.6200e-01 3.0000e+00
++7.9800e-01 +1.5800e-01 3.0000e+00
++8.0200e-01 +1.5800e-01 3.0000e+00
++7.9800e-01 +1.6200e-01 3.0000e+00
++8.0200e-01 +1.6200e-01 3.0000e+00
++8.1800e-01 +1.5800e-01 3.0000e+00
++8.2200e-01 +1.5800e-01 3.0000e+00
++8.1800e-01 +1.6200e-01 3.0000e+00
++8.2200e-01 +1.6200e-01 3.0000e+00
++8.3800e-01 +1.5800e-01 3.0000e+00
++8.4200e-01 +1.5800e-01 3.0000e+00
++8.3800e-01 +1.6200e-01 3.0000e+00
++8.4200e-01 +1.6200e-01 3.0000e+00
++8.5800e-01 +1.5800e-01 3.0000e+00
++8.6200e-01 +1.5800e-01 3.0000e+00
++8.5800e-01 +1.6200e-01 3.0000e+00
++8.6200e-01 +1.6200e-01 3.0000e+00
++8.7800e-01 +1.5800e-01 3.0000e+00
++8.8200e-01 +1.5800e-01 3.0000e+00
++8.7800e-01 +1.6200e-01 3.0000e+00
++8.8200e-01 +1.6200e-01 3.0000e+00
++8.9800e-01 +1.5800e-01 3.0000e+00
++9.0200e-01 +1.5800e-01 3.0000e+00
++8.9800e-01 +1.6200e-01 3.0000e+00
++9.0200e-01 +1.6200e-01 3.0000e+00
++9.1800e-01 +1.5800e-01 3.0000e+00
++9.2200e-01 +1.5800e-01 3.0000e+00
++9.1800e-01 +1.6200e-01 3.0000e+00
++9.2200e-01 +1.6200e-01 3.0000e+00
++9.3800e-01 +1.5800e-01 3.0000e+00
++9.4200e-01 +1.5800e-01 3.0000e+00
++9.3800e-01 +1.6200e-01 3.0000e+00
++9.4200e-01 +1.6200e-01 3.0000e+00
++9.5800e-01 +1.5800e-01 3.0000e+00
++9.6200e-01 +1.5800e-01 3.0000e+00
++9.5800e-01 +1.6200e-01 3.0000e+00
++9.6200e-01 +1.6200e-01 3.0000e+00
++9.7800e-01 +1.5800e-01 3.0000e+00
++9.8200e-01 +1.5800e-01 3.0000e+00
++9.7800e-01 +1.6200e-01 3.0000e+00
++9.8200e-01 +1.6200e-01 3.0000e+00
++9.9800e-01 +1.5800e-01 3.0000e+00
++1.0020e+00 +1.5800e-01 3.0000e+00
++9.9800e-01 +1.6200e-01 3.0000e+00
++1.0020e+00 +1.6200e-01 3.0000e+00
++1.8000e-02 +1.7800e-01 3.0000e+00
++2.2000e-02 +1.7800e-01 3.0000e+00
++1.8000e-02 +1.8200e-01 3.0000e+00
++2.2000e-02 +1.8200e-01 3.0000e+00
++3.8000e-02 +1.7800e-01 3.0000e+00
++4.2000e-02 +1.7800e-01 3.0000e+00
++3.8000e-02 +1.8200e-01 3.0000e+00
++4.2000e-02 +1.8200e-01 3.0000e+00
++5.8000e-02 +1.7800e-01 3.0000e+00
++6.2000e-02 +1.7800e-01 3.0000e+00
++5.8000e-02 +1.8200e-01 3.0000e+00
++6.2000e-02 +1.8200e-01 3.0000e+00
++7.8000e-02 +1.7800e-01 3.0000e+00
++8.2000e-02 +1.7800e-01 3.0000e+00
++7.8000e-02 +1.8200e-01 3.0000e+00
++8.2000e-02 +1.8200e-01 3.0000e+00
++9.8000e-02 +1.7800e-01 3.0000e+00
++1.0200e-01 +1.7800e-01 3.0000e+00
++9.8000e-02 +1.8200e-01 3.0000e+00
++1.0200e-01 +1.8200e-01 3.0000e+00
++1.1800e-01 +1.7800e-01 3.0000e+00
++1.2200e-01 +1.7800e-01 3.0000e+00
++1.1800e-01 +1.8200e-01 3.0000e+00
++1.2200e-01 +1.8200e-01 3.0000e+00
++1.3800e-01 +1.7800e-01 3.0000e+00
++1.4200e-01 +1.7800e-01 3.0000e+00
++1.3800e-01 +1.8200e-01 3.0000e+00
++1.4200e-01 +1.8200e-01 3.0000e+00
++1.5800e-01 +1.7800e-01 3.0000e+00
++1.6200e-01 +1.7800e-01 3.0000e+00
++1.5800e-01 +1.8200e-01 3.0000e+00
++1.6200e-01 +1.8200e-01 3.0000e+00
++1.7800e-01 +1.7800e-01 3.0000e+00
++1.8200e-01 +1.7800e-01 3.0000e+00
++1.7800e-01 +1.8200e-01 3.0000e+00
++1.8200e-01 +1.8200e-01 3.0000e+00
++1.9800e-01 +1.7800e-01 3.0000e+00
++2.0200e-01 +1.7800e-01 3.0000e+00
++1.9800e-01 +1.8200e-01 3.0000e+00
++2.0200e-01 +1.8200e-01 3.0000e+00
++2.1800e-01 +1.7800e-01 3.0000e+00
++2.2200e-01 +1.7800e-01 3.0000e+00
++2.1800e-01 +1.8200e-01 3.0000e+00
++2.2200e-01 +1.8200e-01 3.0000e+00
++2.3800e-01 +1.7800e-01 3.0000e+00
++2.4200e-01 +1.7800e-01 3.0000e+00
++2.3800e-01 +1.8200e-01 3.0000e+00
++2.4200e-01 +1.8200e-01 3.0000e+00
++2.5800e-01 +1.7800e-01 3.0000e+00
++2.6200e-01 +1.7800e-01 3.0000e+00
++2.5800e-01 +1.8200e-01 3.0000e+00
++2.6200e-01 +1.8200e-01 3.0000e+00
++2.7800e-01 +1.7800e-01 3.0000e+00
++2.8200e-01 +1.7800e-01 3.0000e+00
++2.7800e-01 +1.8200e-01 3.0000e+00
++2.8200e-01 +1.8200e-01 3.0000e+00
++2.9800e-01 +1.7800e-01 3.0000e+00
++3.0200e-01 +1.7800e-01 3.0000e+00
++2.9800e-01 +1.8200e-01 3.0000e+00
++3.0200e-01 +1.8200e-01 3.0000e+00
++3.1800e-01 +1.7800e-01 3.0000e+00
++3.2200e-01 +1.7800e-01 3.0000e+00
++3.1800e-01 +1.8200e-01 3.0000e+00
++3.2200e-01 +1.8200e-01 3.0000e+00
++3.3800e-01 +1.7800e-01 3.0000e+00
++3.4200e-01 +1.7800e-01 3.0000e+00
++3.3800e-01 +1.8200e-01 3.0000e+00
++3.4200e-01 +1.8200e-01 3.0000e+00
++3.5800e-01 +1.7800e-01 3.0000e+00
++3.6200e-01 +1.7800e-01 3.0000e+00
++3.5800e-01 +1.8200e-01 3.0000e+00
++3.6200e-01 +1.8200e-01 3.0000e+00
++3.7800e-01 +1.7800e-01 3.0000e+00
++3.8200e-01 +1.7800e-01 3.0000e+00
++3.7800e-01 +1.8200e-01 3.0000e+00
++3.8200e-01 +1.8200e-01 3.0000e+00
++3.9800e-01 +1.7800e-01 3.0000e+00
++4.0200e-01 +1.7800e-01 3.0000e+00
++3.9800e-01 +1.8200e-01 3.0000e+00
++4.0200e-01 +1.8200e-01 3.0000e+00
++4.1800e-01 +1.7800e-01 3.0000e+00
++4.2200e-01 +1.7800e-01 3.0000e+00
++4.1800e-01 +1.8200e-01 3.0000e+00
++4.2200e-01 +1.8200e-01 3.0000e+00
++4.3800e-01 +1.7800e-01 3.0000e+00
++4.4200e-01 +1.7800e-01 3.0000e+00
++4.3800e-01 +1.8200e-01 3.0000e+00
++4.4200e-01 +1.8200e-01 3.0000e+00
++4.5800e-01 +1.7800e-01 3.0000e+00
++4.6200e-01 +1.7800e-01 3.0000e+00
++4.5800e-01 +1.8200e-01 3.0000e+00
++4.6200e-01 +1.8200e-01 3.0000e+00
++4.7800e-01 +1.7800e-01 3.0000e+00
++4.8200e-01 +1.7800e-01 3.0000e+00
++4.7800e-01 +1.8200e-01 3.0000e+00
++4.8200e-01 +1.8200e-01 3.0000e+00
++4.9800e-01 +1.7800e-01 3.0000e+00
++5.0200e-01 +1.7800e-01 3.0000e+00
++4.9800e-01 +1.8200e-01 3.0000e+00
++5.0200e-01 +1.8200e-01 3.0000e+00
++5.1800e-01 +1.7800e-01 3.0000e+00
++5.2200e-01 +1.7800e-01 3.0000e+00
++5.1800e-01 +1.8200e-01 3.0000e+00
++5.2200e-01 +1.8200e-01 3.0000e+00
++5.3800e-01 +1.7800e-01 3.0000e+00
++5.4200e-01 +1.7800e-01 3.0000e+00
++5.3800e-01 +1.8200e-01 3.0000e+00
++5.4200e-01 +1.8200e-01 3.0000e+00
++5.5800e-01 +1.7800e-01 3.0000e+00
++5.6200e-01 +1.7800e-01 3.0000e+00
++5.5800e-01 +1.8200e-01 3.0000e+00
++5.6200e-01 +1.8200e-01 3.0000e+00
++5.7800e-01 +1.7800e-01 3.0000e+00
++5.8200e-01 +1.7800e-01 3.0000e+00
++5.7800e-01 +1.8200e-01 3.0000e+00
++5.8200e-01 +1.8200e-01 3.0000e+00
++5.9800e-01 +1.7800e-01 3.0000e+00
++6.0200e-01 +1.7800e-01 3.0000e+00
++5.9800e-01 +1.8200e-01 3.0000e+00
++6.0200e-01 +1.8200e-01 3.0000e+00
++6.1800e-01 +1.7800e-01 3.0000e+00
++6.2200e-01 +1.7800e-01 3.0000e+00
++6.1800e-01 +1.8200e-01 3.0000e+00
++6.2200e-01 +1.8200e-01 3.0000e+00
++6.3800e-01 +1.7800e-01 3.0000e+00
++6.4200e-01 +1.7800e-01 3.0000e+00
++6.3800e-01 +1.8200e-01 3.0000e+00
++6.4200e-01 +1.8200e-01 3.0000e+00
++6.5800e-01 +1.7800e-01 3.0000e+00
++6.6200e-01 +1.7800e-01 3.0000e+00
++6.5800e-01 +1.8200e-01 3.0000e+00
++6.6200e-01 +1.8200e-01 3.0000e+00
++6.7800e-01 +1.7800e-01 3.0000e+00
++6.8200e-01 +1.7800e-01 3.0000e+00
++6.7800e-01 +1.8200e-01 3.0000e+00
++6.8200e-01 +1.8200e-01 3.0000e+00
++6.9800e-01 +1.7800e-01 3.0000e+00
++7.0200e-01 +1.7800e-01 3.0000e+00
++6.9800e-01 +1.8200e-01 3.0000e+00
++7.0200e-01 +1.8200e-01 3.0000e+00
++7.1800e-01 +1.7800e-01 3.0000e+00
++7.2200e-01 +1.7800e-01 3.0000e+00
++7.1800e-01 +1.8200e-01 3.0000e+00
++7.2200e-01 +1.8200e-01 3.0000e+00
++7.3800e-01 +1.7800e-01 3.0000e+00
++7.4200e-01 +1.7800e-01 3.0000e+00
++7.3800e-01 +1.8200e-01 3.0000e+00
++7.4200e-01 +1.8200e-01 3.0000e+00
++7.5800e-01 +1.7800e-01 3.0000e+00
++7.6200e-01 +1.7800e-01 3.0000e+00
++7.5800e-01 +1.8200e-01 3.0000e+00
++7.6200e-01 +1.8200e-01 3.0000e+00
++7.7800e-01 +1.7800e-01 3.0000e+00
++7.8200e-01 +1.7800e-01 3.0000e+00
++7.7800e-01 +1.8200e-01 3.0000e+00
++7.8200e-01 +1.8200e-01 3.0000e+00
++7.9800e-01 +1.7800e-01 3.0000e+00
++8.0200e-01 +1.7800e-01 3.0000e+00
++7.9800e-01 +1.8200e-01 3.0000e+00
++8.0200e-01 +1.8200e-01 3.0000e+00
++8.1800e-01 +1.7800e-01 3.0000e+00
++8.2200e-01 +1.7800e-01 3.0000e+00
++8.1800e-01 +1.8200e-01 3.0000e+00
++8.2200e-01 +1.8200e-01 3.0000e+00
++8.3800e-01 +1.7800e-01 3.0000e+00
++8.4200e-01 +1.7800e-01 3.0000e+00
++8.3800e-01 +1.8200e-01 3.0000e+00
++8.4200e-01 +1.8200e-01 3.0000e+00
++8.5800e-01 +1.7800e-01 3.0000e+00
++8.6200e-01 +1.7800e-01 3.0000e+00
++8.5800e-01 +1.8200e-01 3.0000e+00
++8.6200e-01 +1.8200e-01 3.0000e+00
++8.7800e-01 +1.7800e-01 3.0000e+00
++8.8200e-01 +1.7800e-01 3.0000e+00
++8.7800e-01 +1.8200e-01 3.0000e+00
++8.8200e-01 +1.8200e-01 3.0000e+00
++8.9800e-01 +1.7800e-01 3.0000e+00
++9.0200e-01 +1.7800e-01 3.0000e+00
++8.9800e-01 +1.8200e-01 3.0000e+00
++9.0200e-01 +1.8200e-01 3.0000e+00
++9.1800e-01 +1.7800e-01 3.0000e+00
++9.2200e-01 +1.7800e-01 3.0000e+00
++9.1800e-01 +1.8200e-01 3.0000e+00
++9.2200e-01 +1.8200e-01 3.0000e+00
++9.3800e-01 +1.7800e-01 3.0000e+00
++9.4200e-01 +1.7800e-01 3.0000e+00
++9.3800e-01 +1.8200e-01 3.0000e+00
++9.4200e-01 +1.8200e-01 3.0000e+00
++9.5800e-01 +1.7800e-01 3.0000e+00
++9.6200e-01 +1.7800e-01 3.0000e+00
++9.5800e-01 +1.8200e-01 3.0000e+00
++9.6200e-01 +1.8200e-01 3.0000e+00
++9.7800e-01 +1.7800e-01 3.0000e+00
++9.8200e-01 +1.7800e-01 3.0000e+00
++9.7800e-01 +1.8200e-01 3.0000e+00
++9.8200e-01 +1.8200e-01 3.0000e+00
++9.9800e-01 +1.7800e-01 3.0000e+00
++1.0020e+00 +1.7800e-01 3.0000e+00
++9.9800e-01 +1.8200e-01 3.0000e+00
++1.0020e+00 +1.8200e-01 3.0000e+00
++1.8000e-02 +1.9800e-01 3.0000e+00
++2.2000e-02 +1.9800e-01 3.0000e+00
++1.8000e-02 +2.0200e-01 3.0000e+00
++2.2000e-02 +2.0200e-01 3.0000e+00
++3.8000e-02 +1.9800e-01 3.0000e+00
++4.2000e-02 +1.9800e-01 3.0000e+00
++3.8000e-02 +2.0200e-01 3.0000e+00
++4.2000e-02 +2.0200e-01 3.0000e+00
++5.8000e-02 +1.9800e-01 3.0000e+00
++6.2000e-02 +1.9800e-01 3.0000e+00
++5.8000e-02 +2.0200e-01 3.0000e+00
++6.2000e-02 +2.0200e-01 3.0000e+00
++7.8000e-02 +1.9800e-01 3.0000e+00
++8.2000e-02 +1.9800e-01 3.0000e+00
++7.8000e-02 +2.0200e-01 3.0000e+00
++8.2000e-02 +2.0200e-01 3.0000e+00
++9.8000e-02 +1.9800e-01 3.0000e+00
++1.0200e-01 +1.9800e-01 3.0000e+00
++9.8000e-02 +2.0200e-01 3.0000e+00
++1.0200e-01 +2.0200e-01 3.0000e+00
++1.1800e-01 +1.9800e-01 3.0000e+00
++1.2200e-01 +1.9800e-01 3.0000e+00
++1.1800e-01 +2.0200e-01 3.0000e+00
++1.2200e-01 +2.0200e-01 3.0000e+00
++1.3800e-01 +1.9800e-01 3.0000e+00
++1.4200e-01 +1.9800e-01 3.0000e+00
++1.3800e-01 +2.0200e-01 3.0000e+00
++1.4200e-01 +2.0200e-01 3.0000e+00
++1.5800e-01 +1.9800e-01 3.0000e+00
++1.6200e-01 +1.9800e-01 3.0000e+00
++1.5800e-01 +2.0200e-01 3.0000e+00
++1.6200e-01 +2.0200e-01 3.0000e+00
++1.7800e-01 +1.9800e-01 3.0000e+00
++1.8200e-01 +1.9800e-01 3.0000e+00
++1.7800e-01 +2.0200e-01 3.0000e+00
++1.8200e-01 +2.0200e-01 3.0000e+00
++1.9800e-01 +1.9800e-01 3.0000e+00
++2.0200e-01 +1.9800e-01 3.0000e+00
++1.9800e-01 +2.0200e-01 3.0000e+00
++2.0200e-01 +2.0200e-01 3.0000e+00
++2.1800e-01 +1.9800e-01 3.0000e+00
++2.2200e-01 +1.9800e-01 3.0000e+00
++2.1800e-01 +2.0200e-01 3.0000e+00
++2.2200e-01 +2.0200e-01 3.0000e+00
++2.3800e-01 +1.9800e-01 3.0000e+00
++2.4200e-01 +1.9800e-01 3.0000e+00
++2.3800e-01 +2.0200e-01 3.0000e+00
++2.4200e-01 +2.0200e-01 3.0000e+00
++2.5800e-01 +1.9800e-01 3.0000e+00
++2.6200e-01 +1.9800e-01 3.0000e+00
++2.5800e-01 +2.0200e-01 3.0000e+00
++2.6200e-01 +2.0200e-01 3.0000e+00
++2.7800e-01 +1.9800e-01 3.0000e+00
++2.8200e-01 +1.9800e-01 3.0000e+00
++2.7800e-01 +2.0200e-01 3.0000e+00
++2.8200e-01 +2.0200e-01 3.0000e+00
++2.9800e-01 +1.9800e-01 3.0000e+00
++3.0200e-01 +1.9800e-01 3.0000e+00
++2.9800e-01 +2.0200e-01 3.0000e+00
++3.0200e-01 +2.0200e-01 3.0000e+00
++3.1800e-01 +1.9800e-01 3.0000e+00
++3.2200e-01 +1.9800e-01 3.0000e+00
++3.1800e-01 +2.0200e-01 3.0000e+00
++3.2200e-01 +2.0200e-01 3.0000e+00
++3.3800e-01 +1.9800e-01 3.0000e+00
++3.4200e-01 +1.9800e-01 3.0000e+00
++3.3800e-01 +2.0200e-01 3.0000e+00
++3.4200e-01 +2.0200e-01 3.0000e+00
++3.5800e-01 +1.9800e-01 3.0000e+00
++3.6200e-01 +1.9800e-01 3.0000e+00
++3.5800e-01 +2.0200e-01 3.0000e+00
++3.6200e-01 +2.0200e-01 3.0000e+00
++3.7800e-01 +1.9800e-01 3.0000e+00
++3.8200e-01 +1.9800e-01 3.0000e+00
++3.7800e-01 +2.0200e-01 3.0000e+00
++3.8200e-01 +2.0200e-01 3.0000e+00
++3.9800e-01 +1.9800e-01 3.0000e+00
++4.0200e-01 +1.9800e-01 3.0000e+00
++3.9800e-01 +2.0200e-01 3.0000e+00
++4.0200e-01 +2.0200e-01 3.0000e+00
++4.1800e-01 +1.9800e-01 3.0000e+00
++4.2200e-01 +1.9800e-01 3.0000e+00
++4.1800e-01 +2.0200e-01 3.0000e+00
++4.2200e-01 +2.0200e-01 3.0000e+00
++4.3800e-01 +1.9800e-01 3.0000e+00
++4.4200e-01 +1.9800e-01 3.0000e+00
++4.3800e-01 +2.0200e-01 3.0000e+00
++4.4200e-01 +2.0200e-01 3.0000e+00
++4.5800e-01 +1.9800e-01 3.0000e+00
++4.6200e-01 +1.9800e-01 3.0000e+00
++4.5800e-01 +2.0200e-01 3.0000e+00
++4.6200e-01 +2.0200e-01 3.0000e+00
++4.7800e-01 +1.9800e-01 3.0000e+00
++4.8200e-01 +1.9800e-01 3.0000e+00
++4.7800e-01 +2.0200e-01 3.0000e+00
++4.8200e-01 +2.0200e-01 3.0000e+00
++4.9800e-01 +1.9800e-01 3.0000e+00
++5.0200e-01 +1.9800e-01 3.0000e+00
++4.9800e-01 +2.0200e-01 3.0000e+00
++5.0200e-01 +2.0200e-01 3.0000e+00
++5.1800e-01 +1.9800e-01 3.0000e+00
++5.2200e-01 +1.9800e-01 3.0000e+00
++5.1800e-01 +2.0200e-01 3.0000e+00
++5.2200e-01 +2.0200e-01 3.0000e+00
++5.3800e-01 +1.9800e-01 3.0000e+00
++5.4200e-01 +1.9800e-01 3.0000e+00
++5.3800e-01 +2.0200e-01 3.0000e+00
++5.4200e-01 +2.0200e-01 3.0000e+00
++5.5800e-01 +1.9800e-01 3.0000e+00
++5.6200e-01 +1.9800e-01 3.0000e+00
++5.5800e-01 +2.0200e-01 3.0000e+00
++5.6200e-01 +2.0200e-01 3.0000e+00
++5.7800e-01 +1.9800e-01 3.0000e+00
++5.8200e-01 +1.9800e-01 3.0000e+00
++5.7800e-01 +2.0200e-01 3.0000e+00
++5.8200e-01 +2.0200e-01 3.0000e+00
++5.9800e-01 +1.9800e-01 3.0000e+00
++6.0200e-01 +1.9800e-01 3.0000e+00
++5.9800e-01 +2.0200e-01 3.0000e+00
++6.0200e-01 +2.0200e-01 3.0000e+00
++6.1800e-01 +1.9800e-01 3.0000e+00
++6.2200e-01 +1.9800e-01 3.0000e+00
++6.1800e-01 +2.0200e-01 3.0000e+00
++6.2200e-01 +2.0200e-01 3.0000e+00
++6.3800e-01 +1.9800e-01 3.0000e+00
++6.4200e-01 +1.9800e-01 3.0000e+00
++6.3800e-01 +2.0200e-01 3.0000e+00
++6.4200e-01 +2.0200e-01 3.0000e+00
++6.5800e-01 +1.9800e-01 3.0000e+00
++6.6200e-01 +1.9800e-01 3.0000e+00
++6.5800e-01 +2.0200e-01 3.0000e+00
++6.6200e-01 +2.0200e-01 3.0000e+00
++6.7800e-01 +1.9800e-01 3.0000e+00
++6.8200e-01 +1.9800e-01 3.0000e+00
++6.7800e-01 +2.0200e-01 3.0000e+00
++6.8200e-01 +2.0200e-01 3.0000e+00
++6.9800e-01 +1.9800e-01 3.0000e+00
++7.0200e-01 +1.9800e-01 3.0000e+00
++6.9800e-01 +2.0200e-01 3.0000e+00
++7.0200e-01 +2.0200e-01 3.0000e+00
++7.1800e-01 +1.9800e-01 3.0000e+00
++7.2200e-01 +1.9800e-01 3.0000e+00
++7.1800e-01 +2.0200e-01 3.0000e+00
++7.2200e-01 +2.0200e-01 3.0000e+00
++7.3800e-01 +1.9800e-01 3.0000e+00
++7.4200e-01 +1.9800e-01 3.0000e+00
++7.3800e-01 +2.0200e-01 3.0000e+00
++7.4200e-01 +2.0200e-01 3.0000e+00
++7.5800e-01 +1.9800e-01 3.0000e+00
++7.6200e-01 +1.9800e-01 3.0000e+00
++7.5800e-01 +2.0200e-01 3.0000e+00
++7.6200e-01 +2.0200e-01 3.0000e+00
++7.7800e-01 +1.9800e-01 3.0000e+00
++7.8200e-01 +1.9800e-01 3.0000e+00
++7.7800e-01 +2.0200e-01 3.0000e+00
++7.8200e-01 +2.0200e-01 3.0000e+00
++7.9800e-01 +1.9800e-01 3.0000e+00
++8.0200e-01 +1.9800e-01 3.0000e+00
++7.9800e-01 +2.0200e-01 3.0000e+00
++8.0200e-01 +2.0200e-01 3.0000e+00
++8.1800e-01 +1.9800e-01 3.0000e+00
++8.2200e-01 +1.9800e-01 3.0000e+00
++8.1800e-01 +2.0200e-01 3.0000e+00
++8.2200e-01 +2.0200e-01 3.0000e+00
++8.3800e-01 +1.9800e-01 3.0000e+00
++8.4200e-01 +1.9800e-01 3.0000e+00
++8.3800e-01 +2.0200e-01 3.0000e+00
++8.4200e-01 +2.0200e-01 3.0000e+00
++8.5800e-01 +1.9800e-01 3.0000e+00
++8.6200e-01 +1.9800e-01 3.0000e+00
++8.5800e-01 +2.0200e-01 3.0000e+00
++8.6200e-01 +2.0200e-01 3.0000e+00
++8.7800e-01 +1.9800e-01 3.0000e+00
++8.8200e-01 +1.9800e-01 3.0000e+00
++8.7800e-01 +2.0200e-01 3.0000e+00
++8.8200e-01 +2.0200e-01 3.0000e+00
++8.9800e-01 +1.9800e-01 3.0000e+00
++9.0200e-01 +1.9800e-01 3.0000e+00
++8.9800e-01 +2.0200e-01 3.0000e+00
++9.0200e-01 +2.0200e-01 3.0000e+00
++9.1800e-01 +1.9800e-01 3.0000e+00
++9.2200e-01 +1.9800e-01 3.0000e+00
++9.1800e-01 +2.0200e-01 3.0000e+00
++9.2200e-01 +2.0200e-01 3.0000e+00
++9.3800e-01 +1.9800e-01 3.0000e+00
++9.4200e-01 +1.9800e-01 3.0000e+00
++9.3800e-01 +2.0200e-01 3.0000e+00
++9.4200e-01 +2.0200e-01 3.0000e+00
++9.5800e-01 +1.9800e-01 3.0000e+00
++9.6200e-01 +1.9800e-01 3.0000e+00
++9.5800e-01 +2.0200e-01 3.0000e+00
++9.6200e-01 +2.0200e-01 3.0000e+00
++9.7800e-01 +1.9800e-01 3.0000e+00
++9.8200e-01 +1.9800e-01 3.0000e+00
++9.7800e-01 +2.0200e-01 3.0000e+00
++9.8200e-01 +2.0200e-01 3.0000e+00
++9.9800e-01 +1.9800e-01 3.0000e+00
++1.0020e+00 +1.9800e-01 3.0000e+00
++9.9800e-01 +2.0200e-01 3.0000e+00
++1.0020e+00 +2.0200e-01 3.0000e+00
++1.8000e-02 +2.1800e-01 3.0000e+00
++2.2000e-02 +2.1800e-01 3.0000e+00
++1.8000e-02 +2.2200e-01 3.0000e+00
++2.2000e-02 +2.2200e-01 3.0000e+00
++3.8000e-02 +2.1800e-01 3.0000e+00
++4.2000e-02 +2.1800e-01 3.0000e+00
++3.8000e-02 +2.2200e-01 3.0000e+00
++4.2000e-02 +2.2200e-01 3.0000e+00
++5.8000e-02 +2.1800e-01 3.0000e+00
++6.2000e-02 +2.1800e-01 3.0000e+00
++5.8000e-02 +2.2200e-01 3.0000e+00
++6.2000e-02 +2.2200e-01 3.0000e+00
++7.8000e-02 +2.1800e-01 3.0000e+00
++8.2000e-02 +2.1800e-01 3.0000e+00
++7.8000e-02 +2.2200e-01 3.0000e+00
++8.2000e-02 +2.2200e-01 3.0000e+00
++9.8000e-02 +2.1800e-01 3.0000e+00
++1.0200e-01 +2.1800e-01 3.0000e+00
++9.8000e-02 +2.2200e-01 3.0000e+00
++1.0200e-01 +2.2200e-01 3.0000e+00
++1.1800e-01 +2.1800e-01 3.0000e+00
++1.2200e-01 +2.1800e-01 3.0000e+00
++1.1800e-01 +2.2200e-01 3.0000e+00
++1.2200e-01 +2.2200e-01 3.0000e+00
++1.3800e-01 +2.1800e-01 3.0000e+00
++1.4200e-01 +2.1800e-01 3.0000e+00
++1.3800e-01 +2.2200e-01 3.0000e+00
++1.4200e-01 +2.2200e-01 3.0000e+00
++1.5800e-01 +2.1800e-01 3.0000e+00
++1.6200e-01 +2.1800e-01 3.0000e+00
++1.5800e-01 +2.2200e-01 3.0000e+00
++1.6200e-01 +2.2200e-01 3.0000e+00
++1.7800e-01 +2.1800e-01 3.0000e+00
++1.8200e-01 +2.1800e-01 3.0000e+00
++1.7800e-01 +2.2200e-01 3.0000e+00
++1.8200e-01 +2.2200e-01 3.0000e+00
++1.9800e-01 +2.1800e-01 3.0000e+00
++2.0200e-01 +2.1800e-01 3.0000e+00
++1.9800e-01 +2.2200e-01 3.0000e+00
++2.0200e-01 +2.2200e-01 3.0000e+00
++2.1800e-01 +2.1800e-01 3.0000e+00
++2.2200e-01 +2.1800e-01 3.0000e+00
++2.1800e-01 +2.2200e-01 3.0000e+00
++2.2200e-01 +2.2200e-01 3.0000e+00
++2.3800e-01 +2.1800e-01 3.0000e+00
++2.4200e-01 +2.1800e-01 3.0000e+00
++2.3800e-01 +2.2200e-01 3.0000e+00
++2.4200e-01 +2.2200e-01 3.0000e+00
++2.5800e-01 +2.1800e-01 3.0000e+00
++2.6200e-01 +2.1800e-01 3.0000e+00
++2.5800e-01 +2.2200e-01 3.0000e+00
++2.6200e-01 +2.2200e-01 3.0000e+00
++2.7800e-01 +2.1800e-01 3.0000e+00
++2.8200e-01 +2.1800e-01 3.0000e+00
++2.7800e-01 +2.2200e-01 3.0000e+00
++2.8200e-01 +2.2200e-01 3.0000e+00
++2.9800e-01 +2.1800e-01 3.0000e+00
++3.0200e-01 +2.1800e-01 3.0000e+00
++2.9800e-01 +2.2200e-01 3.0000e+00
++3.0200e-01 +2.2200e-01 3.0000e+00
++3.1800e-01 +2.1800e-01 3.0000e+00
++3.2200e-01 +2.1800e-01 3.0000e+00
++3.1800e-01 +2.2200e-01 3.0000e+00
++3.2200e-01 +2.2200e-01 3.0000e+00
++3.3800e-01 +2.1800e-01 3.0000e+00
++3.4200e-01 +2.1800e-01 3.0000e+00
++3.3800e-01 +2.2200e-01 3.0000e+00
++3.4200e-01 +2.2200e-01 3.0000e+00
++3.5800e-01 +2.1800e-01 3.0000e+00
++3.6200e-01 +2.1800e-01 3.0000e+00
++3.5800e-01 +2.2200e-01 3.0000e+00
++3.6200e-01 +2.2200e-01 3.0000e+00
++3.7800e-01 +2.1800e-01 3.0000e+00
++3.8200e-01 +2.1800e-01 3.0000e+00
++3.7800e-01 +2.2200e-01 3.0000e+00
++3.8200e-01 +2.2200e-01 3.0000e+00
++3.9800e-01 +2.1800e-01 3.0000e+00
++4.0200e-01 +2.1800e-01 3.0000e+00
++3.9800e-01 +2.2200e-01 3.0000e+00
++4.0200e-01 +2.2200e-01 3.0000e+00
++4.1800e-01 +2.1800e-01 3.0000e+00
++4.2200e-01 +2.1800e-01 3.0000e+00
++4.1800e-01 +2.2200e-01 3.0000e+00
++4.2200e-01 +2.2200e-01 3.0000e+00
++4.3800e-01 +2.1800e-01 3.0000e+00
++4.4200e-01 +2.1800e-01 3.0000e+00
++4.3800e-01 +2.2200e-01 3.0000e+00
++4.4200e-01 +2.2200e-01 3.0000e+00
++4.5800e-01 +2.1800e-01 3.0000e+00
++4.6200e-01 +2.1800e-01 3.0000e+00
++4.5800e-01 +2.2200e-01 3.0000e+00
++4.6200e-01 +2.2200e-01 3.0000e+00
++4.7800e-01 +2.1800e-01 3.0000e+00
++4.8200e-01 +2.1800e-01 3.0000e+00
++4.7800e-01 +2.2200e-01 3.0000e+00
++4.8200e-01 +2.2200e-01 3.0000e+00
++4.9800e-01 +2.1800e-01 3.0000e+00
++5.0200e-01 +2.1800e-01 3.0000e+00
++4.9800e-01 +2.2200e-01 3.0000e+00
++5.0200e-01 +2.2200e-01 3.0000e+00
++5.1800e-01 +2.1800e-01 3.0000e+00
++5.2200e-01 +2.1800e-01 3.0000e+00
++5.1800e-01 +2.2200e-01 3.0000e+00
++5.2200e-01 +2.2200e-01 3.0000e+00
++5.3800e-01 +2.1800e-01 3.0000e+00
++5.4200e-01 +2.1800e-01 3.0000e+00
++5.3800e-01 +2.2200e-01 3.0000e+00
++5.4200e-01 +2.2200e-01 3.0000e+00
++5.5800e-01 +2.1800e-01 3.0000e+00
++5.6200e-01 +2.1800e-01 3.0000e+00
++5.5800e-01 +2.2200e-01 3.0000e+00
++5.6200e-01 +2.2200e-01 3.0000e+00
++5.7800e-01 +2.1800e-01 3.0000e+00
++5.8200e-01 +2.1800e-01 3.0000e+00
++5.7800e-01 +2.2200e-01 3.0000e+00
++5.8200e-01 +2.2200e-01 3.0000e+00
++5.9800e-01 +2.1800e-01 3.0000e+00
++6.0200e-01 +2.1800e-01 3.0000e+00
++5.9800e-01 +2.2200e-01 3.0000e+00
++6.0200e-01 +2.2200e-01 3.0000e+00
++6.1800e-01 +2.1800e-01 3.0000e+00
++6.2200e-01 +2.1800e-01 3.0000e+00
++6.1800e-01 +2.2200e-01 3.0000e+00
++6.2200e-01 +2.2200e-01 3.0000e+00
++6.3800e-01 +2.1800e-01 3.0000e+00
++6.4200e-01 +2.1800e-01 3.0000e+00
++6.3800e-01 +2.2200e-01 3.0000e+00
++6.4200e-01 +2.2200e-01 3.0000e+00
++6.5800e-01 +2.1800e-01 3.0000e+00
++6.6200e-01 +2.1800e-01 3.0000e+00
++6.5800e-01 +2.2200e-01 3.0000e+00
++6.6200e-01 +2.2200e-01 3.0000e+00
++6.7800e-01 +2.1800e-01 3.0000e+00
++6.8200e-01 +2.1800e-01 3.0000e+00
++6.7800e-01 +2.2200e-01 3.0000e+00
++6.8200e-01 +2.2200e-01 3.0000e+00
++6.9800e-01 +2.1800e-01 3.0000e+00
++7.0200e-01 +2.1800e-01 3.0000e+00
++6.9800e-01 +2.2200e-01 3.0000e+00
++7.0200e-01 +2.2200e-01 3.0000e+00
++7.1800e-01 +2.1800e-01 3.0000e+00
++7.2200e-01 +2.1800e-01 3.0000e+00
++7.1800e-01 +2.2200e-01 3.0000e+00
++7.2200e-01 +2.2200e-01 3.0000e+00
++7.3800e-01 +2.1800e-01 3.0000e+00
++7.4200e-01 +2.1800e-01 3.0000e+00
++7.3800e-01 +2.2200e-01 3.0000e+00
++7.4200e-01 +2.2200e-01 3.0000e+00
++7.5800e-01 +2.1800e-01 3.0000e+00
++7.6200e-01 +2.1800e-01 3.0000e+00
++7.5800e-01 +2.2200e-01 3.0000e+00
++7.6200e-01 +2.2200e-01 3.0000e+00
++7.7800e-01 +2.1800e-01 3.0000e+00
++7.8200e-01 +2.1800e-01 3.0000e+00
++7.7800e-01 +2.2200e-01 3.0000e+00
++7.8200e-01 +2.2200e-01 3.0000e+00
++7.9800e-01 +2.1800e-01 3.0000e+00
++8.0200e-01 +2.1800e-01 3.0000e+00
++7.9800e-01 +2.2200e-01 3.0000e+00
++8.0200e-01 +2.2200e-01 3.0000e+00
++8.1800e-01 +2.1800e-01 3.0000e+00
++8.2200e-01 +2.1800e-01 3.0000e+00
++8.1800e-01 +2.2200e-01 3.0000e+00
++8.2200e-01 +2.2200e-01 3.0000e+00
++8.3800e-01 +2.1800e-01 3.0000e+00
++8.4200e-01 +2.1800e-01 3.0000e+00
++8.3800e-01 +2.2200e-01 3.0000e+00
++8.4200e-01 +2.2200e-01 3.0000e+00
++8.5800e-01 +2.1800e-01 3.0000e+00
++8.6200e-01 +2.1800e-01 3.0000e+00
++8.5800e-01 +2.2200e-01 3.0000e+00
++8.6200e-01 +2.2200e-01 3.0000e+00
++8.7800e-01 +2.1800e-01 3.0000e+00
++8.8200e-01 +2.1800e-01 3.0000e+00
++8.7800e-01 +2.2200e-01 3.0000e+00
++8.8200e-01 +2.2200e-01 3.0000e+00
++8.9800e-01 +2.1800e-01 3.0000e+00
++9.0200e-01 +2.1800e-01 3.0000e+00
++8.9800e-01 +2.2200e-01 3.0000e+00
++9.0200e-01 +2.2200e-01 3.0000e+00
++9.1800e-01 +2.1800e-01 3.0000e+00
++9.2200e-01 +2.1800e-01 3.0000e+00
++9.1800e-01 +2.2200e-01 3.0000e+00
++9.2200e-01 +2.2200e-01 3.0000e+00
++9.3800e-01 +2.1800e-01 3.0000e+00
++9.4200e-01 +2.1800e-01 3.0000e+00
++9.3800e-01 +2.2200e-01 3.0000e+00
++9.4200e-01 +2.2200e-01 3.0000e+00
++9.5800e-01 +2.1800e-01 3.0000e+00
++9.6200e-01 +2.1800e-01 3.0000e+00
++9.5800e-01 +2.2200e-01 3.0000e+00
++9.6200e-01 +2.2200e-01 3.0000e+00
++9.7800e-01 +2.1800e-01 3.0000e+00
++9.8200e-01 +2.1800e-01 3.0000e+00
++9.7800e-01 +2.2200e-01 3.0000e+00
++9.8200e-01 +2.2200e-01 3.0000e+00
++9.9800e-01 +2.1800e-01 3.0000e+00
++1.0020e+00 +2.1800e-01 3.0000e+00
++9.9800e-01 +2.2200e-01 3.0000e+00
++1.0020e+00 +2.2200e-01 3.0000e+00
++1.8000e-02 +2.3800e-01 3.0000e+00
++2.2000e-02 +2.3800e-01 3.0000e+00
++1.8000e-02 +2.4200e-01 3.0000e+00
++2.2000e-02 +2.4200e-01 3.0000e+00
++3.8000e-02 +2.3800e-01 3.0000e+00
++4.2000e-02 +2.3800e-01 3.0000e+00
++3.8000e-02 +2.4200e-01 3.0000e+00
++4.2000e-02 +2.4200e-01 3.0000e+00
++5.8000e-02 +2.3800e-01 3.0000e+00
++6.2000e-02 +2.3800e-01 3.0000e+00
++5.8000e-02 +2.4200e-01 3.0000e+00
++6.2000e-02 +2.4200e-01 3.0000e+00
++7.8000e-02 +2.3800e-01 3.0000e+00
++8.2000e-02 +2.3800e-01 3.0000e+00
++7.8000e-02 +2.4200e-01 3.0000e+00
++8.2000e-02 +2.4200e-01 3.0000e+00
++9.8000e-02 +2.3800e-01 3.0000e+00
++1.0200e-01 +2.3800e-01 3.0000e+00
++9.8000e-02 +2.4200e-01 3.0000e+00
++1.0200e-01 +2.4200e-01 3.0000e+00
++1.1800e-01 +2.3800e-01 3.0000e+00
++1.2200e-01 +2.3800e-01 3.0000e+00
++1.1800e-01 +2.4200e-01 3.0000e+00
++1.2200e-01 +2.4200e-01 3.0000e+00
++1.3800e-01 +2.3800e-01 3.0000e+00
++1.4200e-01 +2.3800e-01 3.0000e+00
++1.3800e-01 +2.4200e-01 3.0000e+00
++1.4200e-01 +2.4200e-01 3.0000e+00
++1.5800e-01 +2.3800e-01 3.0000e+00
++1.6200e-01 +2.3800e-01 3.0000e+00
++1.5800e-01 +2.4200e-01 3.0000e+00
++1.6200e-01 +2.4200e-01 3.0000e+00
++1.7800e-01 +2.3800e-01 3.0000e+00
++1.8200e-01 +2.3800e-01 3.0000e+00
++1.7800e-01 +2.4200e-01 3.0000e+00
++1.8200e-01 +2.4200e-01 3.0000e+00
++1.9800e-01 +2.3800e-01 3.0000e+00
++2.0200e-01 +2.3800e-01 3.0000e+00
++1.9800e-01 +2.4200e-01 3.0000e+00
++2.0200e-01 +2.4200e-01 3.0000e+00
++2.1800e-01 +2.3800e-01 3.0000e+00
++2.2200e-01 +2.3800e-01 3.0000e+00
++2.1800e-01 +2.4200e-01 3.0000e+00
++2.2200e-01 +2.4200e-01 3.0000e+00
++2.3800e-01 +2.3800e-01 3.0000e+00
++2.4200e-01 +2.3800e-01 3.0000e+00
++2.3800e-01 +2.4200e-01 3.0000e+00
++2.4200e-01 +2.4200e-01 3.0000e+00
++2.5800e-01 +2.3800e-01 3.0000e+00
++2.6200e-01 +2.3800e-01 3.0000e+00
++2.5800e-01 +2.4200e-01 3.0000e+00
++2.6200e-01 +2.4200e-01 3.0000e+00
++2.7800e-01 +2.3800e-01 3.0000e+00
++2.8200e-01 +2.3800e-01 3.0000e+00
++2.7800e-01 +2.4200e-01 3.0000e+00
++2.8200e-01 +2.4200e-01 3.0000e+00
++2.9800e-01 +2.3800e-01 3.0000e+00
++3.0200e-01 +2.3800e-01 3.0000e+00
++2.9800e-01 +2.4200e-01 3.0000e+00
++3.0200e-01 +2.4200e-01 3.0000e+00
++3.1800e-01 +2.3800e-01 3.0000e+00
++3.2200e-01 +2.3800e-01 3.0000e+00
++3.1800e-01 +2.4200e-01 3.0000e+00
++3.2200e-01 +2.4200e-01 3.0000e+00
++3.3800e-01 +2.3800e-01 3.0000e+00
++3.4200e-01 +2.3800e-01 3.0000e+00
++3.3800e-01 +2.4200e-01 3.0000e+00
++3.4200e-01 +2.4200e-01 3.0000e+00
++3.5800e-01 +2.3800e-01 3.0000e+00
++3.6200e-01 +2.3800e-01 3.0000e+00
++3.5800e-01 +2.4200e-01 3.0000e+00
++3.6200e-01 +2.4200e-01 3.0000e+00
++3.7800e-01 +2.3800e-01 3.0000e+00
++3.8200e-01 +2.3800e-01 3.0000e+00
++3.7800e-01 +2.4200e-01 3.0000e+00
++3.8200e-01 +2.4200e-01 3.0000e+00
++3.9800e-01 +2.3800e-01 3.0000e+00
++4.0200e-01 +2.3800e-01 3.0000e+00
++3.9800e-01 +2.4200e-01 3.0000e+00
++4.0200e-01 +2.4200e-01 3.0000e+00
++4.1800e-01 +2.3800e-01 3.0000e+00
++4.2200e-01 +2.3800e-01 3.0000e+00
++4.1800e-01 +2.4200e-01 3.0000e+00
++4.2200e-01 +2.4200e-01 3.0000e+00
++4.3800e-01 +2.3800e-01 3.0000e+00
++4.4200e-01 +2.3800e-01 3.0000e+00
++4.3800e-01 +2.4200e-01 3.0000e+00
++4.4200e-01 +2.4200e-01 3.0000e+00
++4.5800e-01 +2.3800e-01 3.0000e+00
++4.6200e-01 +2.3800e-01 3.0000e+00
++4.5800e-01 +2.4200e-01 3.0000e+00
++4.6200e-01 +2.4200e-01 3.0000e+00
++4.7800e-01 +2.3800e-01 3.0000e+00
++4.8200e-01 +2.3800e-01 3.0000e+00
++4.7800e-01 +2.4200e-01 3.0000e+00
++4.8200e-01 +2.4200e-01 3.0000e+00
++4.9800e-01 +2.3800e-01 3.0000e+00
++5.0200e-01 +2.3800e-01 3.0000e+00
++4.9800e-01 +2.4200e-01 3.0000e+00
++5.0200e-01 +2.4200e-01 3.0000e+00
++5.1800e-01 +2.3800e-01 3.0000e+00
++5.2200e-01 +2.3800e-01 3.0000e+00
++5.1800e-01 +2.4200e-01 3.0000e+00
++5.2200e-01 +2.4200e-01 3.0000e+00
++5.3800e-01 +2.3800e-01 3.0000e+00
++5.4200e-01 +2.3800e-01 3.0000e+00
++5.3800e-01 +2.4200e-01 3.0000e+00
++5.4200e-01 +2.4200e-01 3.0000e+00
++5.5800e-01 +2.3800e-01 3.0000e+00
++5.6200e-01 +2.3800e-01 3.0000e+00
++5.5800e-01 +2.4200e-01 3.0000e+00
++5.6200e-01 +2.4200e-01 3.0000e+00
++5.7800e-01 +2.3800e-01 3.0000e+00
++5.8200e-01 +2.3800e-01 3.0000e+00
++5.7800e-01 +2.4200e-01 3.0000e+00
++5.8200e-01 +2.4200e-01 3.0000e+00
++5.9800e-01 +2.3800e-01 3.0000e+00
++6.0200e-01 +2.3800e-01 3.0000e+00
++5.9800e-01 +2.4200e-01 3.0000e+00
++6.0200e-01 +2.4200e-01 3.0000e+00
++6.1800e-01 +2.3800e-01 3.0000e+00
++6.2200e-01 +2.3800e-01 3.0000e+00
++6.1800e-01 +2.4200e-01 3.0000e+00
++6.2200e-01 +2.4200e-01 3.0000e+00
++6.3800e-01 +2.3800e-01 3.0000e+00
++6.4200e-01 +2.3800e-01 3.0000e+00
++6.3800e-01 +2.4200e-01 3.0000e+00
++6.4200e-01 +2.4200e-01 3.0000e+00
++6.5800e-01 +2.3800e-01 3.0000e+00
++6.6200e-01 +2.3800e-01 3.0000e+00
++6.5800e-01 +2.4200e-01 3.0000e+00
++6.6200e-01 +2.4200e-01 3.0000e+00
++6.7800e-01 +2.3800e-01 3.0000e+00
++6.8200e-01 +2.3800e-01 3.0000e+00
++6.7800e-01 +2.4200e-01 3.0000e+00
++6.8200e-01 +2.4200e-01 3.0000e+00
++6.9800e-01 +2.3800e-01 3.0000e+00
++7.0200e-01 +2.3800e-01 3.0000e+00
++6.9800e-01 +2.4200e-01 3.0000e+00
++7.0200e-01 +2.4200e-01 3.0000e+00
++7.1800e-01 +2.3800e-01 3.0000e+00
++7.2200e-01 +2.3800e-01 3.0000e+00
++7.1800e-01 +2.4200e-01 3.0000e+00
++7.2200e-01 +2.4200e-01 3.0000e+00
++7.3800e-01 +2.3800e-01 3.0000e+00
++7.4200e-01 +2.3800e-01 3.0000e+00
++7.3800e-01 +2.4200e-01 3.0000e+00
++7.4200e-01 +2.4200e-01 3.0000e+00
++7.5800e-01 +2.3800e-01 3.0000e+00
++7.6200e-01 +2.3800e-01 3.0000e+00
++7.5800e-01 +2.4200e-01 3.0000e+00
++7.6200e-01 +2.4200e-01 3.0000e+00
++7.7800e-01 +2.3800e-01 3.0000e+00
++7.8200e-01 +2.3800e-01 3.0000e+00
++7.7800e-01 +2.4200e-01 3.0000e+00
++7.8200e-01 +2.4200e-01 3.0000e+00
++7.9800e-01 +2.3800e-01 3.0000e+00
++8.0200e-01 +2.3800e-01 3.0000e+00
++7.9800e-01 +2.4200e-01 3.0000e+00
++8.0200e-01 +2.4200e-01 3.0000e+00
++8.1800e-01 +2.3800e-01 3.0000e+00
++8.2200e-01 +2.3800e-01 3.0000e+00
++8.1800e-01 +2.4200e-01 3.0000e+00
++8.2200e-01 +2.4200e-01 3.0000e+00
++8.3800e-01 +2.3800e-01 3.0000e+00
++8.4200e-01 +2.3800e-01 3.0000e+00
++8.3800e-01 +2.4200e-01 3.0000e+00
++8.4200e-01 +2.4200e-01 3.0000e+00
++8.5800e-01 +2.3800e-01 3.0000e+00
++8.6200e-01 +2.3800e-01 3.0000e+00
++8.5800e-01 +2.4200e-01 3.0000e+00
++8.6200e-01 +2.4200e-01 3.0000e+00
++8.7800e-01 +2.3800e-01 3.0000e+00
++8.8200e-01 +2.3800e-01 3.0000e+00
++8.7800e-01 +2.4200e-01 3.0000e+00
++8.8200e-01 +2.4200e-01 3.0000e+00
++8.9800e-01 +2.3800e-01 3.0000e+00
++9.0200e-01 +2.3800e-01 3.0000e+00
++8.9800e-01 +2.4200e-01 3.0000e+00
++9.0200e-01 +2.4200e-01 3.0000e+00
++9.1800e-01 +2.3800e-01 3.0000e+00
++9.2200e-01 +2.3800e-01 3.0000e+00
++9.1800e-01 +2.4200e-01 3.0000e+00
++9.2200e-01 +2.4200e-01 3.0000e+00
++9.3800e-01 +2.3800e-01 3.0000e+00
++9.4200e-01 +2.3800e-01 3.0000e+00
++9.3800e-01 +2.4200e-01 3.0000e+00
++9.4200e-01 +2.4200e-01 3.0000e+00
++9.5800e-01 +2.3800e-01 3.0000e+00
++9.6200e-01 +2.3800e-01 3.0000e+00
++9.5800e-01 +2.4200e-01 3.0000e+00
++9.6200e-01 +2.4200e-01 3.0000e+00
++9.7800e-01 +2.3800e-01 3.0000e+00
++9.8200e-01 +2.3800e-01 3.0000e+00
++9.7800e-01 +2.4200e-01 3.0000e+00
++9.8200e-01 +2.4200e-01 3.0000e+00
++9.9800e-01 +2.3800e-01 3.0000e+00
++1.0020e+00 +2.3800e-01 3.0000e+00
++9.9800e-01 +2.4200e-01 3.0000e+00
++1.0020e+00 +2.4200e-01 3.0000e+00
++1.8000e-02 +2.5800e-01 3.0000e+00
++2.2000e-02 +2.5800e-01 3.0000e+00
++1.8000e-02 +2.6200e-01 3.0000e+00
++2.2000e-02 +2.6200e-01 3.0000e+00
++3.8000e-02 +2.5800e-01 3.0000e+00
++4.2000e-02 +2.5800e-01 3.0000e+00
++3.8000e-02 +2.6200e-01 3.0000e+00
++4.2000e-02 +2.6200e-01 3.0000e+00
++5.8000e-02 +2.5800e-01 3.0000e+00
++6.2000e-02 +2.5800e-01 3.0000e+00
++5.8000e-02 +2.6200e-01 3.0000e+00
++6.2000e-02 +2.6200e-01 3.0000e+00
++7.8000e-02 +2.5800e-01 3.0000e+00
++8.2000e-02 +2.5800e-01 3.0000e+00
++7.8000e-02 +2.6200e-01 3.0000e+00
++8.2000e-02 +2.6200e-01 3.0000e+00
++9.8000e-02 +2.5800e-01 3.0000e+00
++1.0200e-01 +2.5800e-01 3.0000e+00
++9.8000e-02 +2.6200e-01 3.0000e+00
++1.0200e-01 +2.6200e-01 3.0000e+00
++1.1800e-01 +2.5800e-01 3.0000e+00
++1.2200e-01 +2.5800e-01 3.0000e+00
++1.1800e-01 +2.6200e-01 3.0000e+00
++1.2200e-01 +2.6200e-01 3.0000e+00
++1.3800e-01 +2.5800e-01 3.0000e+00
++1.4200e-01 +2.5800e-01 3.0000e+00
++1.3800e-01 +2.6200e-01 3.0000e+00
++1.4200e-01 +2.6200e-01 3.0000e+00
++1.5800e-01 +2.5800e-01 3.0000e+00
++1.6200e-01 +2.5800e-01 3.0000e+00
++1.5800e-01 +2.6200e-01 3.0000e+00
++1.6200e-01 +2.6200e-01 3.0000e+00
++1.7800e-01 +2.5800e-01 3.0000e+00
++1.8200e-01 +2.5800e-01 3.0000e+00
++1.7800e-01 +2.6200e-01 3.0000e+00
++1.8200e-01 +2.6200e-01 3.0000e+00
++1.9800e-01 +2.5800e-01 3.0000e+00
++2.0200e-01 +2.5800e-01 3.0000e+00
++1.9800e-01 +2.6200e-01 3.0000e+00
++2.0200e-01 +2.6200e-01 3.0000e+00
++2.1800e-01 +2.5800e-01 3.0000e+00
++2.2200e-01 +2.5800e-01 3.0000e+00
++2.1800e-01 +2.6200e-01 3.0000e+00
++2.2200e-01 +2.6200e-01 3.0000e+00
++2.3800e-01 +2.5800e-01 3.0000e+00
++2.4200e-01 +2.5800e-01 3.0000e+00
++2.3800e-01 +2.6200e-01 3.0000e+00
++2.4200e-01 +2.6200e-01 3.0000e+00
++2.5800e-01 +2.5800e-01 3.0000e+00
++2.6200e-01 +2.5800e-01 3.0000e+00
++2.5800e-01 +2.6200e-01 3.0000e+00
++2.6200e-01 +2.6200e-01 3.0000e+00
++2.7800e-01 +2.5800e-01 3.0000e+00
++2.8200e-01 +2.5800e-01 3.0000e+00
++2.7800e-01 +2.6200e-01 3.0000e+00
++2.8200e-01 +2.6200e-01 3.0000e+00
++2.9800e-01 +2.5800e-01 3.0000e+00
++3.0200e-01 +2.5800e-01 3.0000e+00
++2.9800e-01 +2.6200e-01 3.0000e+00
++3.0200e-01 +2.6200e-01 3.0000e+00
++3.1800e-01 +2.5800e-01 3.0000e+00
++3.2200e-01 +2.5800e-01 3.0000e+00
++3.1800e-01 +2.6200e-01 3.0000e+00
++3.2200e-01 +2.6200e-01 3.0000e+00
++3.3800e-01 +2.5800e-01 3.0000e+00
++3.4200e-01 +2.5800e-01 3.0000e+00
++3.3800e-01 +2.6200e-01 3.0000e+00
++3.4200e-01 +2.6200e-01 3.0000e+00
++3.5800e-01 +2.5800e-01 3.0000e+00
++3.6200e-01 +2.5800e-01 3.0000e+00
++3.5800e-01 +2.6200e-01 3.0000e+00
++3.6200e-01 +2.6200e-01 3.0000e+00
++3.7800e-01 +2.5800e-01 3.0000e+00
++3.8200e-01 +2.5800e-01 3.0000e+00
++3.7800e-01 +2.6200e-01 3.0000e+00
++3.8200e-01 +2.6200e-01 3.0000e+00
++3.9800e-01 +2.5800e-01 3.0000e+00
++4.0200e-01 +2.5800e-01 3.0000e+00
++3.9800e-01 +2.6200e-01 3.0000e+00
++4.0200e-01 +2.6200e-01 3.0000e+00
++4.1800e-01 +2.5800e-01 3.0000e+00
++4.2200e-01 +2.5800e-01 3.0000e+00
++4.1800e-01 +2.6200e-01 3.0000e+00
++4.2200e-01 +2.6200e-01 3.0000e+00
++4.3800e-01 +2.5800e-01 3.0000e+00
++4.4200e-01 +2.5800e-01 3.0000e+00
++4.3800e-01 +2.6200e-01 3.0000e+00
++4.4200e-01 +2.6200e-01 3.0000e+00
++4.5800e-01 +2.5800e-01 3.0000e+00
++4.6200e-01 +2.5800e-01 3.0000e+00
++4.5800e-01 +2.6200e-01 3.0000e+00
++4.6200e-01 +2.6200e-01 3.0000e+00
++4.7800e-01 +2.5800e-01 3.0000e+00
++4.8200e-01 +2.5800e-01 3.0000e+00
++4.7800e-01 +2.6200e-01 3.0000e+00
++4.8200e-01 +2.6200e-01 3.0000e+00
++4.9800e-01 +2.5800e-01 3.0000e+00
++5.0200e-01 +2.5800e-01 3.0000e+00
++4.9800e-01 +2.6200e-01 3.0000e+00
++5.0200e-01 +2.6200e-01 3.0000e+00
++5.1800e-01 +2.5800e-01 3.0000e+00
++5.2200e-01 +2.5800e-01 3.0000e+00
++5.1800e-01 +2.6200e-01 3.0000e+00
++5.2200e-01 +2.6200e-01 3.0000e+00
++5.3800e-01 +2.5800e-01 3.0000e+00
++5.4200e-01 +2.5800e-01 3.0000e+00
++5.3800e-01 +2.6200e-01 3.0000e+00
++5.4200e-01 +2.6200e-01 3.0000e+00
++5.5800e-01 +2.5800e-01 3.0000e+00
++5.6200e-01 +2.5800e-01 3.0000e+00
++5.5800e-01 +2.6200e-01 3.0000e+00
++5.6200e-01 +2.6200e-01 3.0000e+00
++5.7800e-01 +2.5800e-01 3.0000e+00
++5.8200e-01 +2.5800e-01 3.0000e+00
++5.7800e-01 +2.6200e-01 3.0000e+00
++5.8200e-01 +2.6200e-01 3.0000e+00
++5.9800e-01 +2.5800e-01 3.0000e+00
++6.0200e-01 +2.5800e-01 3.0000e+00
++5.9800e-01 +2.6200e-01 3.0000e+00
++6.0200e-01 +2.6200e-01 3.0000e+00
++6.1800e-01 +2.5800e-01 3.0000e+00
++6.2200e-01 +2.5800e-01 3.0000e+00
++6.1800e-01 +2.6200e-01 3.0000e+00
++6.2200e-01 +2.6200e-01 3.0000e+00
++6.3800e-01 +2.5800e-01 3.0000e+00
++6.4200e-01 +2.5800e-01 3.0000e+00
++6.3800e-01 +2.6200e-01 3.0000e+00
++6.4200e-01 +2.6200e-01 3.0000e+00
++6.5800e-01 +2.5800e-01 3.0000e+00
++6.6200e-01 +2.5800e-01 3.0000e+00
++6.5800e-01 +2.6200e-01 3.0000e+00
++6.6200e-01 +2.6200e-01 3.0000e+00
++6.7800e-01 +2.5800e-01 3.0000e+00
++6.8200e-01 +2.5800e-01 3.0000e+00
++6.7800e-01 +2.6200e-01 3.0000e+00
++6.8200e-01 +2.6200e-01 3.0000e+00
++6.9800e-01 +2.5800e-01 3.0000e+00
++7.0200e-01 +2.5800e-01 3.0000e+00
++6.9800e-01 +2.6200e-01 3.0000e+00
++7.0200e-01 +2.6200e-01 3.0000e+00
++7.1800e-01 +2.5800e-01 3.0000e+00
++7.2200e-01 +2.5800e-01 3.0000e+00
++7.1800e-01 +2.6200e-01 3.0000e+00
++7.2200e-01 +2.6200e-01 3.0000e+00
++7.3800e-01 +2.5800e-01 3.0000e+00
++7.4200e-01 +2.5800e-01 3.0000e+00
++7.3800e-01 +2.6200e-01 3.0000e+00
++7.4200e-01 +2.6200e-01 3.0000e+00
++7.5800e-01 +2.5800e-01 3.0000e+00
++7.6200e-01 +2.5800e-01 3.0000e+00
++7.5800e-01 +2.6200e-01 3.0000e+00
++7.6200e-01 +2.6200e-01 3.0000e+00
++7.7800e-01 +2.5800e-01 3.0000e+00
++7.8200e-01 +2.5800e-01 3.0000e+00
++7.7800e-01 +2.6200e-01 3.0000e+00
++7.8200e-01 +2.6200e-01 3.0000e+00
++7.9800e-01 +2.5800e-01 3.0000e+00
++8.0200e-01 +2.5800e-01 3.0000e+00
++7.9800e-01 +2.6200e-01 3.0000e+00
++8.0200e-01 +2.6200e-01 3.0000e+00
++8.1800e-01 +2.5800e-01 3.0000e+00
++8.2200e-01 +2.5800e-01 3.0000e+00
++8.1800e-01 +2.6200e-01 3.0000e+00
++8.2200e-01 +2.6200e-01 3.0000e+00
++8.3800e-01 +2.5800e-01 3.0000e+00
++8.4200e-01 +2.5800e-01 3.0000e+00
++8.3800e-01 +2.6200e-01 3.0000e+00
++8.4200e-01 +2.6200e-01 3.0000e+00
++8.5800e-01 +2.5800e-01 3.0000e+00
++8.6200e-01 +2.5800e-01 3.0000e+00
++8.5800e-01 +2.6200e-01 3.0000e+00
++8.6200e-01 +2.6200e-01 3.0000e+00
++8.7800e-01 +2.5800e-01 3.0000e+00
++8.8200e-01 +2.5800e-01 3.0000e+00
++8.7800e-01 +2.6200e-01 3.0000e+00
++8.8200e-01 +2.6200e-01 3.0000e+00
++8.9800e-01 +2.5800e-01 3.0000e+00
++9.0200e-01 +2.5800e-01 3.0000e+00
++8.9800e-01 +2.6200e-01 3.0000e+00
++9.0200e-01 +2.6200e-01 3.0000e+00
++9.1800e-01 +2.5800e-01 3.0000e+00
++9.2200e-01 +2.5800e-01 3.0000e+00
++9.1800e-01 +2.6200e-01 3.0000e+00
++9.2200e-01 +2.6200e-01 3.0000e+00
++9.3800e-01 +2.5800e-01 3.0000e+00
++9.4200e-01 +2.5800e-01 3.0000e+00
++9.3800e-01 +2.6200e-01 3.0000e+00
++9.4200e-01 +2.6200e-01 3.0000e+00
++9.5800e-01 +2.5800e-01 3.0000e+00
++9.6200e-01 +2.5800e-01 3.0000e+00
++9.5800e-01 +2.6200e-01 3.0000e+00
++9.6200e-01 +2.6200e-01 3.0000e+00
++9.7800e-01 +2.5800e-01 3.0000e+00
++9.8200e-01 +2.5800e-01 3.0000e+00
++9.7800e-01 +2.6200e-01 3.0000e+00
++9.8200e-01 +2.6200e-01 3.0000e+00
++9.9800e-01 +2.5800e-01 3.0000e+00
++1.0020e+00 +2.5800e-01 3.0000e+00
++9.9800e-01 +2.6200e-01 3.0000e+00
++1.0020e+00 +2.6200e-01 3.0000e+00
++1.8000e-02 +2.7800e-01 3.0000e+00
++2.2000e-02 +2.7800e-01 3.0000e+00
++1.8000e-02 +2.8200e-01 3.0000e+00
++2.2000e-02 +2.8200e-01 3.0000e+00
++3.8000e-02 +2.7800e-01 3.0000e+00
++4.2000e-02 +2.7800e-01 3.0000e+00
++3.8000e-02 +2.8200e-01 3.0000e+00
++4.2000e-02 +2.8200e-01 3.0000e+00
++5.8000e-02 +2.7800e-01 3.0000e+00
++6.2000e-02 +2.7800e-01 3.0000e+00
++5.8000e-02 +2.8200e-01 3.0000e+00
++6.2000e-02 +2.8200e-01 3.0000e+00
++7.8000e-02 +2.7800e-01 3.0000e+00
++8.2000e-02 +2.7800e-01 3.0000e+00
++7.8000e-02 +2.8200e-01 3.0000e+00
++8.2000e-02 +2.8200e-01 3.0000e+00
++9.8000e-02 +2.7800e-01 3.0000e+00
++1.0200e-01 +2.7800e-01 3.0000e+00
++9.8000e-02 +2.8200e-01 3.0000e+00
++1.0200e-01 +2.8200e-01 3.0000e+00
++1.1800e-01 +2.7800e-01 3.0000e+00
++1.2200e-01 +2.7800e-01 3.0000e+00
++1.1800e-01 +2.8200e-01 3.0000e+00
++1.2200e-01 +2.8200e-01 3.0000e+00
++1.3800e-01 +2.7800e-01 3.0000e+00
++1.4200e-01 +2.7800e-01 3.0000e+00
++1.3800e-01 +2.8200e-01 3.0000e+00
++1.4200e-01 +2.8200e-01 3.0000e+00
++1.5800e-01 +2.7800e-01 3.0000e+00
++1.6200e-01 +2.7800e-01 3.0000e+00
++1.5800e-01 +2.8200e-01 3.0000e+00
++1.6200e-01 +2.8200e-01 3.0000e+00
++1.7800e-01 +2.7800e-01 3.0000e+00
++1.8200e-01 +2.7800e-01 3.0000e+00
++1.7800e-01 +2.8200e-01 3.0000e+00
++1.8200e-01 +2.8200e-01 3.0000e+00
++1.9800e-01 +2.7800e-01 3.0000e+00
++2.0200e-01 +2.7800e-01 3.0000e+00
++1.9800e-01 +2.8200e-01 3.0000e+00
++2.0200e-01 +2.8200e-01 3.0000e+00
++2.1800e-01 +2.7800e-01 3.0000e+00
++2.2200e-01 +2.7800e-01 3.0000e+00
++2.1800e-01 +2.8200e-01 3.0000e+00
++2.2200e-01 +2.8200e-01 3.0000e+00
++2.3800e-01 +2.7800e-01 3.0000e+00
++2.4200e-01 +2.7800e-01 3.0000e+00
++2.3800e-01 +2.8200e-01 3.0000e+00
++2.4200e-01 +2.8200e-01 3.0000e+00
++2.5800e-01 +2.7800e-01 3.0000e+00
++2.6200e-01 +2.7800e-01 3.0000e+00
++2.5800e-01 +2.8200e-01 3.0000e+00
++2.6200e-01 +2.8200e-01 3.0000e+00
++2.7800e-01 +2.7800e-01 3.0000e+00
++2.8200e-01 +2.7800e-01 3.0000e+00
++2.7800e-01 +2.8200e-01 3.0000e+00
++2.8200e-01 +2.8200e-01 3.0000e+00
++2.9800e-01 +2.7800e-01 3.0000e+00
++3.0200e-01 +2.7800e-01 3.0000e+00
++2.9800e-01 +2.8200e-01 3.0000e+00
++3.0200e-01 +2.8200e-01 3.0000e+00
++3.1800e-01 +2.7800e-01 3.0000e+00
++3.2200e-01 +2.7800e-01 3.0000e+00
++3.1800e-01 +2.8200e-01 3.0000e+00
++3.2200e-01 +2.8200e-01 3.0000e+00
++3.3800e-01 +2.7800e-01 3.0000e+00
++3.4200e-01 +2.7800e-01 3.0000e+00
++3.3800e-01 +2.8200e-01 3.0000e+00
++3.4200e-01 +2.8200e-01 3.0000e+00
++3.5800e-01 +2.7800e-01 3.0000e+00
++3.6200e-01 +2.7800e-01 3.0000e+00
++3.5800e-01 +2.8200e-01 3.0000e+00
++3.6200e-01 +2.8200e-01 3.0000e+00
++3.7800e-01 +2.7800e-01 3.0000e+00
++3.8200e-01 +2.7800e-01 3.0000e+00
++3.7800e-01 +2.8200e-01 3.0000e+00
++3.8200e-01 +2.8200e-01 3.0000e+00
++3.9800e-01 +2.7800e-01 3.0000e+00
++4.0200e-01 +2.7800e-01 3.0000e+00
++3.9800e-01 +2.8200e-01 3.0000e+00
++4.0200e-01 +2.8200e-01 3.0000e+00
++4.1800e-01 +2.7800e-01 3.0000e+00
++4.2200e-01 +2.7800e-01 3.0000e+00
++4.1800e-01 +2.8200e-01 3.0000e+00
++4.2200e-01 +2.8200e-01 3.0000e+00
++4.3800e-01 +2.7800e-01 3.0000e+00
++4.4200e-01 +2.7800e-01 3.0000e+00
++4.3800e-01 +2.8200e-01 3.0000e+00
++4.4200e-01 +2.8200e-01 3.0000e+00
++4.5800e-01 +2.7800e-01 3.0000e+00
++4.6200e-01 +2.7800e-01 3.0000e+00
++4.5800e-01 +2.8200e-01 3.0000e+00
++4.6200e-01 +2.8200e-01 3.0000e+00
++4.7800e-01 +2.7800e-01 3.0000e+00
++4.8200e-01 +2.7800e-01 3.0000e+00
++4.7800e-01 +2.8200e-01 3.0000e+00
++4.8200e-01 +2.8200e-01 3.0000e+00
++4.9800e-01 +2.7800e-01 3.0000e+00
++5.0200e-01 +2.7800e-01 3.0000e+00
++4.9800e-01 +2.8200e-01 3.0000e+00
++5.0200e-01 +2.8200e-01 3.0000e+00
++5.1800e-01 +2.7800e-01 3.0000e+00
++5.2200e-01 +2.7800e-01 3.0000e+00
++5.1800e-01 +2.8200e-01 3.0000e+00
++5.2200e-01 +2.8200e-01 3.0000e+00
++5.3800e-01 +2.7800e-01 3.0000e+00
++5.4200e-01 +2.7800e-01 3.0000e+00
++5.3800e-01 +2.8200e-01 3.0000e+00
++5.4200e-01 +2.8200e-01 3.0000e+00
++5.5800e-01 +2.7800e-01 3.0000e+00
++5.6200e-01 +2.7800e-01 3.0000e+00
++5.5800e-01 +2.8200e-01 3.0000e+00
++5.6200e-01 +2.8200e-01 3.0000e+00
++5.7800e-01 +2.7800e-01 3.0000e+00
++5.8200e-01 +2.7800e-01 3.0000e+00
++5.7800e-01 +2.8200e-01 3.0000e+00
++5.8200e-01 +2.8200e-01 3.0000e+00
++5.9800e-01 +2.7800e-01 3.0000e+00
++6.0200e-01 +2.7800e-01 3.0000e+00
++5.9800e-01 +2.8200e-01 3.0000e+00
++6.0200e-01 +2.8200e-01 3.0000e+00
++6.1800e-01 +2.7800e-01 3.0000e+00
++6.2200e-01 +2.7800e-01 3.0000e+00
++6.1800e-01 +2.8200e-01 3.0000e+00
++6.2200e-01 +2.8200e-01 3.0000e+00
++6.3800e-01 +2.7800e-01 3.0000e+00
++6.4200e-01 +2.7800e-01 3.0000e+00
++6.3800e-01 +2.8200e-01 3.0000e+00
++6.4200e-01 +2.8200e-01 3.0000e+00
++6.5800e-01 +2.7800e-01 3.0000e+00
++6.6200e-01 +2.7800e-01 3.0000e+00
++6.5800e-01 +2.8200e-01 3.0000e+00
++6.6200e-01 +2.8200e-01 3.0000e+00
++6.7800e-01 +2.7800e-01 3.0000e+00
++6.8200e-01 +2.7800e-01 3.0000e+00
++6.7800e-01 +2.8200e-01 3.0000e+00
++6.8200e-01 +2.8200e-01 3.0000e+00
++6.9800e-01 +2.7800e-01 3.0000e+00
++7.0200e-01 +2.7800e-01 3.0000e+00
++6.9800e-01 +2.8200e-01 3.0000e+00
++7.0200e-01 +2.8200e-01 3.0000e+00
++7.1800e-01 +2.7800e-01 3.0000e+00
++7.2200e-01 +2.7800e-01 3.0000e+00
++7.1800e-01 +2.8200e-01 3.0000e+00
++7.2200e-01 +2.8200e-01 3.0000e+00
++7.3800e-01 +2.7800e-01 3.0000e+00
++7.4200e-01 +2.7800e-01 3.0000e+00
++7.3800e-01 +2.8200e-01 3.0000e+00
++7.4200e-01 +2.8200e-01 3.0000e+00
++7.5800e-01 +2.7800e-01 3.0000e+00
++7.6200e-01 +2.7800e-01 3.0000e+00
++7.5800e-01 +2.8200e-01 3.0000e+00
++7.6200e-01 +2.8200e-01 3.0000e+00
++7.7800e-01 +2.7800e-01 3.0000e+00
++7.8200e-01 +2.7800e-01 3.0000e+00
++7.7800e-01 +2.8200e-01 3.0000e+00
++7.8200e-01 +2.8200e-01 3.0000e+00
++7.9800e-01 +2.7800e-01 3.0000e+00
++8.0200e-01 +2.7800e-01 3.0000e+00
++7.9800e-01 +2.8200e-01 3.0000e+00
++8.0200e-01 +2.8200e-01 3.0000e+00
++8.1800e-01 +2.7800e-01 3.0000e+00
++8.2200e-01 +2.7800e-01 3.0000e+00
++8.1800e-01 +2.8200e-01 3.0000e+00
++8.2200e-01 +2.8200e-01 3.0000e+00
++8.3800e-01 +2.7800e-01 3.0000e+00
++8.4200e-01 +2.7800e-01 3.0000e+00
++8.3800e-01 +2.8200e-01 3.0000e+00
++8.4200e-01 +2.8200e-01 3.0000e+00
++8.5800e-01 +2.7800e-01 3.0000e+00
++8.6200e-01 +2.7800e-01 3.0000e+00
++8.5800e-01 +2.8200e-01 3.0000e+00
++8.6200e-01 +2.8200e-01 3.0000e+00
++8.7800e-01 +2.7800e-01 3.0000e+00
++8.8200e-01 +2.7800e-01 3.0000e+00
++8.7800e-01 +2.8200e-01 3.0000e+00
++8.8200e-01 +2.8200e-01 3.0000e+00
++8.9800e-01 +2.7800e-01 3.0000e+00
++9.0200e-01 +2.7800e-01 3.0000e+00
++8.9800e-01 +2.8200e-01 3.0000e+00
++9.0200e-01 +2.8200e-01 3.0000e+00
++9.1800e-01 +2.7800e-01 3.0000e+00
++9.2200e-01 +2.7800e-01 3.0000e+00
++9.1800e-01 +2.8200e-01 3.0000e+00
++9.2200e-01 +2.8200e-01 3.0000e+00
++9.3800e-01 +2.7800e-01 3.0000e+00
++9.4200e-01 +2.7800e-01 3.0000e+00
++9.3800e-01 +2.8200e-01 3.0000e+00
++9.4200e-01 +2.8200e-01 3.0000e+00
++9.5800e-01 +2.7800e-01 3.0000e+00
++9.6200e-01 +2.7800e-01 3.0000e+00
++9.5800e-01 +2.8200e-01 3.0000e+00
++9.6200e-01 +2.8200e-01 3.0000e+00
++9.7800e-01 +2.7800e-01 3.0000e+00
++9.8200e-01 +2.7800e-01 3.0000e+00
++9.7800e-01 +2.8200e-01 3.0000e+00
++9.8200e-01 +2.8200e-01 3.0000e+00
++9.9800e-01 +2.7800e-01 3.0000e+00
++1.0020e+00 +2.7800e-01 3.0000e+00
++9.9800e-01 +2.8200e-01 3.0000e+00
++1.0020e+00 +2.8200e-01 3.0000e+00
++1.8000e-02 +2.9800e-01 3.0000e+00
++2.2000e-02 +2.9800e-01 3.0000e+00
++1.8000e-02 +3.0200e-01 3.0000e+00
++2.2000e-02 +3.0200e-01 3.0000e+00
++3.8000e-02 +2.9800e-01 3.0000e+00
++4.2000e-02 +2.9800e-01 3.0000e+00
++3.8000e-02 +3.0200e-01 3.0000e+00
++4.2000e-02 +3.0200e-01 3.0000e+00
++5.8000e-02 +2.9800e-01 3.0000e+00
++6.2000e-02 +2.9800e-01 3.0000e+00
++5.8000e-02 +3.0200e-01 3.0000e+00
++6.2000e-02 +3.0200e-01 3.0000e+00
++7.8000e-02 +2.9800e-01 3.0000e+00
++8.2000e-02 +2.9800e-01 3.0000e+00
++7.8000e-02 +3.0200e-01 3.0000e+00
++8.2000e-02 +3.0200e-01 3.0000e+00
++9.8000e-02 +2.9800e-01 3.0000e+00
++1.0200e-01 +2.9800e-01 3.0000e+00
++9.8000e-02 +3.0200e-01 3.0000e+00
++1.0200e-01 +3.0200e-01 3.0000e+00
++1.1800e-01 +2.9800e-01 3.0000e+00
++1.2200e-01 +2.9800e-01 3.0000e+00
++1.1800e-01 +3.0200e-01 3.0000e+00
++1.2200e-01 +3.0200e-01 3.0000e+00
++1.3800e-01 +2.9800e-01 3.0000e+00
++1.4200e-01 +2.9800e-01 3.0000e+00
++1.3800e-01 +3.0200e-01 3.0000e+00
++1.4200e-01 +3.0200e-01 3.0000e+00
++1.5800e-01 +2.9800e-01 3.0000e+00
++1.6200e-01 +2.9800e-01 3.0000e+00
++1.5800e-01 +3.0200e-01 3.0000e+00
++1.6200e-01 +3.0200e-01 3.0000e+00
++1.7800e-01 +2.9800e-01 3.0000e+00
++1.8200e-01 +2.9800e-01 3.0000e+00
++1.7800e-01 +3.0200e-01 3.0000e+00
++1.8200e-01 +3.0200e-01 3.0000e+00
++1.9800e-01 +2.9800e-01 3.0000e+00
++2.0200e-01 +2.9800e-01 3.0000e+00
++1.9800e-01 +3.0200e-01 3.0000e+00
++2.0200e-01 +3.0200e-01 3.0000e+00
++2.1800e-01 +2.9800e-01 3.0000e+00
++2.2200e-01 +2.9800e-01 3.0000e+00
++2.1800e-01 +3.0200e-01 3.0000e+00
++2.2200e-01 +3.0200e-01 3.0000e+00
++2.3800e-01 +2.9800e-01 3.0000e+00
++2.4200e-01 +2.9800e-01 3.0000e+00
++2.3800e-01 +3.0200e-01 3.0000e+00
++2.4200e-01 +3.0200e-01 3.0000e+00
++2.5800e-01 +2.9800e-01 3.0000e+00
++2.6200e-01 +2.9800e-01 3.0000e+00
++2.5800e-01 +3.0200e-01 3.0000e+00
++2.6200e-01 +3.0200e-01 3.0000e+00
++2.7800e-01 +2.9800e-01 3.0000e+00
++2.8200e-01 +2.9800e-01 3.0000e+00
++2.7800e-01 +3.0200e-01 3.0000e+00
++2.8200e-01 +3.0200e-01 3.0000e+00
++2.9800e-01 +2.9800e-01 3.0000e+00
++3.0200e-01 +2.9800e-01 3.0000e+00
++2.9800e-01 +3.0200e-01 3.0000e+00
++3.0200e-01 +3.0200e-01 3.0000e+00
++3.1800e-01 +2.9800e-01 3.0000e+00
++3.2200e-01 +2.9800e-01 3.0000e+00
++3.1800e-01 +3.0200e-01 3.0000e+00
++3.2200e-01 +3.0200e-01 3.0000e+00
++3.3800e-01 +2.9800e-01 3.0000e+00
++3.4200e-01 +2.9800e-01 3.0000e+00
++3.3800e-01 +3.0200e-01 3.0000e+00
++3.4200e-01 +3.0200e-01 3.0000e+00
++3.5800e-01 +2.9800e-01 3.0000e+00
++3.6200e-01 +2.9800e-01 3.0000e+00
++3.5800e-01 +3.0200e-01 3.0000e+00
++3.6200e-01 +3.0200e-01 3.0000e+00
++3.7800e-01 +2.9800e-01 3.0000e+00
++3.8200e-01 +2.9800e-01 3.0000e+00
++3.7800e-01 +3.0200e-01 3.0000e+00
++3.8200e-01 +3.0200e-01 3.0000e+00
++3.9800e-01 +2.9800e-01 3.0000e+00
++4.0200e-01 +2.9800e-01 3.0000e+00
++3.9800e-01 +3.0200e-01 3.0000e+00
++4.0200e-01 +3.0200e-01 3.0000e+00
++4.1800e-01 +2.9800e-01 3.0000e+00
++4.2200e-01 +2.9800e-01 3.0000e+00
++4.1800e-01 +3.0200e-01 3.0000e+00
++4.2200e-01 +3.0200e-01 3.0000e+00
++4.3800e-01 +2.9800e-01 3.0000e+00
++4.4200e-01 +2.9800e-01 3.0000e+00
++4.3800e-01 +3.0200e-01 3.0000e+00
++4.4200e-01 +3.0200e-01 3.0000e+00
++4.5800e-01 +2.9800e-01 3.0000e+00
++4.6200e-01 +2.9800e-01 3.0000e+00
++4.5800e-01 +3.0200e-01 3.0000e+00
++4.6200e-01 +3.0200e-01 3.0000e+00
++4.7800e-01 +2.9800e-01 3.0000e+00
++4.8200e-01 +2.9800e-01 3.0000e+00
++4.7800e-01 +3.0200e-01 3.0000e+00
++4.8200e-01 +3.0200e-01 3.0000e+00
++4.9800e-01 +2.9800e-01 3.0000e+00
++5.0200e-01 +2.9800e-01 3.0000e+00
++4.9800e-01 +3.0200e-01 3.0000e+00
++5.0200e-01 +3.0200e-01 3.0000e+00
++5.1800e-01 +2.9800e-01 3.0000e+00
++5.2200e-01 +2.9800e-01 3.0000e+00
++5.1800e-01 +3.0200e-01 3.0000e+00
++5.2200e-01 +3.0200e-01 3.0000e+00
++5.3800e-01 +2.9800e-01 3.0000e+00
++5.4200e-01 +2.9800e-01 3.0000e+00
++5.3800e-01 +3.0200e-01 3.0000e+00
++5.4200e-01 +3.0200e-01 3.0000e+00
++5.5800e-01 +2.9800e-01 3.0000e+00
++5.6200e-01 +2.9800e-01 3.0000e+00
++5.5800e-01 +3.0200e-01 3.0000e+00
++5.6200e-01 +3.0200e-01 3.0000e+00
++5.7800e-01 +2.9800e-01 3.0000e+00
++5.8200e-01 +2.9800e-01 3.0000e+00
++5.7800e-01 +3.0200e-01 3.0000e+00
++5.8200e-01 +3.0200e-01 3.0000e+00
++5.9800e-01 +2.9800e-01 3.0000e+00
++6.0200e-01 +2.9800e-01 3.0000e+00
++5.9800e-01 +3.0200e-01 3.0000e+00
++6.0200e-01 +3.0200e-01 3.0000e+00
++6.1800e-01 +2.9800e-01 3.0000e+00
++6.2200e-01 +2.9800e-01 3.0000e+00
++6.1800e-01 +3.0200e-01 3.0000e+00
++6.2200e-01 +3.0200e-01 3.0000e+00
++6.3800e-01 +2.9800e-01 3.0000e+00
++6.4200e-01 +2.9800e-01 3.0000e+00
++6.3800e-01 +3.0200e-01 3.0000e+00
++6.4200e-01 +3.0200e-01 3.0000e+00
++6.5800e-01 +2.9800e-01 3.0000e+00
++6.6200e-01 +2.9800e-01 3.0000e+00
++6.5800e-01 +3.0200e-01 3.0000e+00
++6.6200e-01 +3.0200e-01 3.0000e+00
++6.7800e-01 +2.9800e-01 3.0000e+00
++6.8200e-01 +2.9800e-01 3.0000e+00
++6.7800e-01 +3.0200e-01 3.0000e+00
++6.8200e-01 +3.0200e-01 3.0000e+00
++6.9800e-01 +2.9800e-01 3.0000e+00
++7.0200e-01 +2.9800e-01 3.0000e+00
++6.9800e-01 +3.0200e-01 3.0000e+00
++7.0200e-01 +3.0200e-01 3.0000e+00
++7.1800e-01 +2.9800e-01 3.0000e+00
++7.2200e-01 +2.9800e-01 3.0000e+00
++7.1800e-01 +3.0200e-01 3.0000e+00
++7.2200e-01 +3.0200e-01 3.0000e+00
++7.3800e-01 +2.9800e-01 3.0000e+00
++7.4200e-01 +2.9800e-01 3.0000e+00
++7.3800e-01 +3.0200e-01 3.0000e+00
++7.4200e-01 +3.0200e-01 3.0000e+00
++7.5800e-01 +2.9800e-01 3.0000e+00
++7.6200e-01 +2.9800e-01 3.0000e+00
++7.5800e-01 +3.0200e-01 3.0000e+00
++7.6200e-01 +3.0200e-01 3.0000e+00
++7.7800e-01 +2.9800e-01 3.0000e+00
++7.8200e-01 +2.9800e-01 3.0000e+00
++7.7800e-01 +3.0200e-01 3.0000e+00
++7.8200e-01 +3.0200e-01 3.0000e+00
++7.9800e-01 +2.9800e-01 3.0000e+00
++8.0200e-01 +2.9800e-01 3.0000e+00
++7.9800e-01 +3.0200e-01 3.0000e+00
++8.0200e-01 +3.0200e-01 3.0000e+00
++8.1800e-01 +2.9800e-01 3.0000e+00
++8.2200e-01 +2.9800e-01 3.0000e+00
++8.1800e-01 +3.0200e-01 3.0000e+00
++8.2200e-01 +3.0200e-01 3.0000e+00
++8.3800e-01 +2.9800e-01 3.0000e+00
++8.4200e-01 +2.9800e-01 3.0000e+00
++8.3800e-01 +3.0200e-01 3.0000e+00
++8.4200e-01 +3.0200e-01 3.0000e+00
++8.5800e-01 +2.9800e-01 3.0000e+00
++8.6200e-01 +2.9800e-01 3.0000e+00
++8.5800e-01 +3.0200e-01 3.0000e+00
++8.6200e-01 +3.0200e-01 3.0000e+00
++8.7800e-01 +2.9800e-01 3.0000e+00
++8.8200e-01 +2.9800e-01 3.0000e+00
++8.7800e-01 +3.0200e-01 3.0000e+00
++8.8200e-01 +3.0200e-01 3.0000e+00
++8.9800e-01 +2.9800e-01 3.0000e+00
++9.0200e-01 +2.9800e-01 3.0000e+00
++8.9800e-01 +3.0200e-01 3.0000e+00
++9.0200e-01 +3.0200e-01 3.0000e+00
++9.1800e-01 +2.9800e-01 3.0000e+00
++9.2200e-01 +2.9800e-01 3.0000e+00
++9.1800e-01 +3.0200e-01 3.0000e+00
++9.2200e-01 +3.0200e-01 3.0000e+00
++9.3800e-01 +2.9800e-01 3.0000e+00
++9.4200e-01 +2.9800e-01 3.0000e+00
++9.3800e-01 +3.0200e-01 3.0000e+00
++9.4200e-01 +3.0200e-01 3.0000e+00
++9.5800e-01 +2.9800e-01 3.0000e+00
++9.6200e-01 +2.9800e-01 3.0000e+00
++9.5800e-01 +3.0200e-01 3.0000e+00
++9.6200e-01 +3.0200e-01 3.0000e+00
++9.7800e-01 +2.9800e-01 3.0000e+00
++9.8200e-01 +2.9800e-01 3.0000e+00
++9.7800e-01 +3.0200e-01 3.0000e+00
++9.8200e-01 +3.0200e-01 3.0000e+00
++9.9800e-01 +2.9800e-01 3.0000e+00
++1.0020e+00 +2.9800e-01 3.0000e+00
++9.9800e-01 +3.0200e-01 3.0000e+00
++1.0020e+00 +3.0200e-01 3.0000e+00
++1.8000e-02 +3.1800e-01 3.0000e+00
++2.2000e-02 +3.1800e-01 3.0000e+00
++1.8000e-02 +3.2200e-01 3.0000e+00
++2.2000e-02 +3.2200e-01 3.0000e+00
++3.8000e-02 +3.1800e-01 3.0000e+00
++4.2000e-02 +3.1800e-01 3.0000e+00
++3.8000e-02 +3.2200e-01 3.0000e+00
++4.2000e-02 +3.2200e-01 3.0000e+00
++5.8000e-02 +3.1800e-01 3.0000e+00
++6.2000e-02 +3.1800e-01 3.0000e+00
++5.8000e-02 +3.2200e-01 3.0000e+00
++6.2000e-02 +3.2200e-01 3.0000e+00
++7.8000e-02 +3.1800e-01 3.0000e+00
++8.2000e-02 +3.1800e-01 3.0000e+00
++7.8000e-02 +3.2200e-01 3.0000e+00
++8.2000e-02 +3.2200e-01 3.0000e+00
++9.8000e-02 +3.1800e-01 3.0000e+00
++1.0200e-01 +3.1800e-01 3.0000e+00
++9.8000e-02 +3.2200e-01 3.0000e+00
++1.0200e-01 +3.2200e-01 3.0000e+00
++1.1800e-01 +3.1800e-01 3.0000e+00
++1.2200e-01 +3.1800e-01 3.0000e+00
++1.1800e-01 +3.2200e-01 3.0000e+00
++1.2200e-01 +3.2200e-01 3.0000e+00
++1.3800e-01 +3.1800e-01 3.0000e+00
++1.4200e-01 +3.1800e-01 3.0000e+00
++1.3800e-01 +3.2200e-01 3.0000e+00
++1.4200e-01 +3.2200e-01 3.0000e+00
++1.5800e-01 +3.1800e-01 3.0000e+00
++1.6200e-01 +3.1800e-01 3.0000e+00
++1.5800e-01 +3.2200e-01 3.0000e+00
++1.6200e-01 +3.2200e-01 3.0000e+00
++1.7800e-01 +3.1800e-01 3.0000e+00
++1.8200e-01 +3.1800e-01 3.0000e+00
++1.7800e-01 +3.2200e-01 3.0000e+00
++1.8200e-01 +3.2200e-01 3.0000e+00
++1.9800e-01 +3.1800e-01 3.0000e+00
++2.0200e-01 +3.1800e-01 3.0000e+00
++1.9800e-01 +3.2200e-01 3.0000e+00
++2.0200e-01 +3.2200e-01 3.0000e+00
++2.1800e-01 +3.1800e-01 3.0000e+00
++2.2200e-01 +3.1800e-01 3.0000e+00
++2.1800e-01 +3.2200e-01 3.0000e+00
++2.2200e-01 +3.2200e-01 3.0000e+00
++2.3800e-01 +3.1800e-01 3.0000e+00
++2.4200e-01 +3.1800e-01 3.0000e+00
++2.3800e-01 +3.2200e-01 3.0000e+00
++2.4200e-01 +3.2200e-01 3.0000e+00
++2.5800e-01 +3.1800e-01 3.0000e+00
++2.6200e-01 +3.1800e-01 3.0000e+00
++2.5800e-01 +3.2200e-01 3.0000e+00
++2.6200e-01 +3.2200e-01 3.0000e+00
++2.7800e-01 +3.1800e-01 3.0000e+00
++2.8200e-01 +3.1800e-01 3.0000e+00
++2.7800e-01 +3.2200e-01 3.0000e+00
++2.8200e-01 +3.2200e-01 3.0000e+00
++2.9800e-01 +3.1800e-01 3.0000e+00
++3.0200e-01 +3.1800e-01 3.0000e+00
++2.9800e-01 +3.2200e-01 3.0000e+00
++3.0200e-01 +3.2200e-01 3.0000e+00
++3.1800e-01 +3.1800e-01 3.0000e+00
++3.2200e-01 +3.1800e-01 3.0000e+00
++3.1800e-01 +3.2200e-01 3.0000e+00
++3.2200e-01 +3.2200e-01 3.0000e+00
++3.3800e-01 +3.1800e-01 3.0000e+00
++3.4200e-01 +3.1800e-01 3.0000e+00
++3.3800e-01 +3.2200e-01 3.0000e+00
++3.4200e-01 +3.2200e-01 3.0000e+00
++3.5800e-01 +3.1800e-01 3.0000e+00
++3.6200e-01 +3.1800e-01 3.0000e+00
++3.5800e-01 +3.2200e-01 3.0000e+00
++3.6200e-01 +3.2200e-01 3.0000e+00
++3.7800e-01 +3.1800e-01 3.0000e+00
++3.8200e-01 +3.1800e-01 3.0000e+00
++3.7800e-01 +3.2200e-01 3.0000e+00
++3.8200e-01 +3.2200e-01 3.0000e+00
++3.9800e-01 +3.1800e-01 3.0000e+00
++4.0200e-01 +3.1800e-01 3.0000e+00
++3.9800e-01 +3.2200e-01 3.0000e+00
++4.0200e-01 +3.2200e-01 3.0000e+00
++4.1800e-01 +3.1800e-01 3.0000e+00
++4.2200e-01 +3.1800e-01 3.0000e+00
++4.1800e-01 +3.2200e-01 3.0000e+00
++4.2200e-01 +3.2200e-01 3.0000e+00
++4.3800e-01 +3.1800e-01 3.0000e+00
++4.4200e-01 +3.1800e-01 3.0000e+00
++4.3800e-01 +3.2200e-01 3.0000e+00
++4.4200e-01 +3.2200e-01 3.0000e+00
++4.5800e-01 +3.1800e-01 3.0000e+00
++4.6200e-01 +3.1800e-01 3.0000e+00
++4.5800e-01 +3.2200e-01 3.0000e+00
++4.6200e-01 +3.2200e-01 3.0000e+00
++4.7800e-01 +3.1800e-01 3.0000e+00
++4.8200e-01 +3.1800e-01 3.0000e+00
++4.7800e-01 +3.2200e-01 3.0000e+00
++4.8200e-01 +3.2200e-01 3.0000e+00
++4.9800e-01 +3.1800e-01 3.0000e+00
++5.0200e-01 +3.1800e-01 3.0000e+00
++4.9800e-01 +3.2200e-01 3.0000e+00
++5.0200e-01 +3.2200e-01 3.0000e+00
++5.1800e-01 +3.1800e-01 3.0000e+00
++5.2200e-01 +3.1800e-01 3.0000e+00
++5.1800e-01 +3.2200e-01 3.0000e+00
++5.2200e-01 +3.2200e-01 3.0000e+00
++5.3800e-01 +3.1800e-01 3.0000e+00
++5.4200e-01 +3.1800e-01 3.0000e+00
++5.3800e-01 +3.2200e-01 3.0000e+00
++5.4200e-01 +3.2200e-01 3.0000e+00
++5.5800e-01 +3.1800e-01 3.0000e+00
++5.6200e-01 +3.1800e-01 3.0000e+00
++5.5800e-01 +3.2200e-01 3.0000e+00
++5.6200e-01 +3.2200e-01 3.0000e+00
++5.7800e-01 +3.1800e-01 3.0000e+00
++5.8200e-01 +3.1800e-01 3.0000e+00
++5.7800e-01 +3.2200e-01 3.0000e+00
++5.8200e-01 +3.2200e-01 3.0000e+00
++5.9800e-01 +3.1800e-01 3.0000e+00
++6.0200e-01 +3.1800e-01 3.0000e+00
++5.9800e-01 +3.2200e-01 3.0000e+00
++6.0200e-01 +3.2200e-01 3.0000e+00
++6.1800e-01 +3.1800e-01 3.0000e+00
++6.2200e-01 +3.1800e-01 3.0000e+00
++6.1800e-01 +3.2200e-01 3.0000e+00
++6.2200e-01 +3.2200e-01 3.0000e+00
++6.3800e-01 +3.1800e-01 3.0000e+00
++6.4200e-01 +3.1800e-01 3.0000e+00
++6.3800e-01 +3.2200e-01 3.0000e+00
++6.4200e-01 +3.2200e-01 3.0000e+00
++6.5800e-01 +3.1800e-01 3.0000e+00
++6.6200e-01 +3.1800e-01 3.0000e+00
++6.5800e-01 +3.2200e-01 3.0000e+00
++6.6200e-01 +3.2200e-01 3.0000e+00
++6.7800e-01 +3.1800e-01 3.0000e+00
++6.8200e-01 +3.1800e-01 3.0000e+00
++6.7800e-01 +3.2200e-01 3.0000e+00
++6.8200e-01 +3.2200e-01 3.0000e+00
++6.9800e-01 +3.1800e-01 3.0000e+00
++7.0200e-01 +3.1800e-01 3.0000e+00
++6.9800e-01 +3.2200e-01 3.0000e+00
++7.0200e-01 +3.2200e-01 3.0000e+00
++7.1800e-01 +3.1800e-01 3.0000e+00
++7.2200e-01 +3.1800e-01 3.0000e+00
++7.1800e-01 +3.2200e-01 3.0000e+00
++7.2200e-01 +3.2200e-01 3.0000e+00
++7.3800e-01 +3.1800e-01 3.0000e+00
++7.4200e-01 +3.1800e-01 3.0000e+00
++7.3800e-01 +3.2200e-01 3.0000e+00
++7.4200e-01 +3.2200e-01 3.0000e+00
++7.5800e-01 +3.1800e-01 3.0000e+00
++7.6200e-01 +3.1800e-01 3.0000e+00
++7.5800e-01 +3.2200e-01 3.0000e+00
++7.6200e-01 +3.2200e-01 3.0000e+00
++7.7800e-01 +3.1800e-01 3.0000e+00
++7.8200e-01 +3.1800e-01 3.0000e+00
++7.7800e-01 +3.2200e-01 3.0000e+00
++7.8200e-01 +3.2200e-01 3.0000e+00
++7.9800e-01 +3.1800e-01 3.0000e+00
++8.0200e-01 +3.1800e-01 3.0000e+00
++7.9800e-01 +3.2200e-01 3.0000e+00
++8.0200e-01 +3.2200e-01 3.0000e+00
++8.1800e-01 +3.1800e-01 3.0000e+00
++8.2200e-01 +3.1800e-01 3.0000e+00
++8.1800e-01 +3.2200e-01 3.0000e+00
++8.2200e-01 +3.2200e-01 3.0000e+00
++8.3800e-01 +3.1800e-01 3.0000e+00
++8.4200e-01 +3.1800e-01 3.0000e+00
++8.3800e-01 +3.2200e-01 3.0000e+00
++8.4200e-01 +3.2200e-01 3.0000e+00
++8.5800e-01 +3.1800e-01 3.0000e+00
++8.6200e-01 +3.1800e-01 3.0000e+00
++8.5800e-01 +3.2200e-01 3.0000e+00
++8.6200e-01 +3.2200e-01 3.0000e+00
++8.7800e-01 +3.1800e-01 3.0000e+00
++8.8200e-01 +3.1800e-01 3.0000e+00
++8.7800e-01 +3.2200e-01 3.0000e+00
++8.8200e-01 +3.2200e-01 3.0000e+00
++8.9800e-01 +3.1800e-01 3.0000e+00
++9.0200e-01 +3.1800e-01 3.0000e+00
++8.9800e-01 +3.2200e-01 3.0000e+00
++9.0200e-01 +3.2200e-01 3.0000e+00
++9.1800e-01 +3.1800e-01 3.0000e+00
++9.2200e-01 +3.1800e-01 3.0000e+00
++9.1800e-01 +3.2200e-01 3.0000e+00
++9.2200e-01 +3.2200e-01 3.0000e+00
++9.3800e-01 +3.1800e-01 3.0000e+00
++9.4200e-01 +3.1800e-01 3.0000e+00
++9.3800e-01 +3.2200e-01 3.0000e+00
++9.4200e-01 +3.2200e-01 3.0000e+00
++9.5800e-01 +3.1800e-01 3.0000e+00
++9.6200e-01 +3.1800e-01 3.0000e+00
++9.5800e-01 +3.2200e-01 3.0000e+00
++9.6200e-01 +3.2200e-01 3.0000e+00
++9.7800e-01 +3.1800e-01 3.0000e+00
++9.8200e-01 +3.1800e-01 3.0000e+00
++9.7800e-01 +3.2200e-01 3.0000e+00
++9.8200e-01 +3.2200e-01 3.0000e+00
++9.9800e-01 +3.1800e-01 3.0000e+00
++1.0020e+00 +3.1800e-01 3.0000e+00
++9.9800e-01 +3.2200e-01 3.0000e+00
++1.0020e+00 +3.2200e-01 3.0000e+00
++1.8000e-02 +3.3800e-01 3.0000e+00
++2.2000e-02 +3.3800e-01 3.0000e+00
++1.8000e-02 +3.4200e-01 3.0000e+00
++2.2000e-02 +3.4200e-01 3.0000e+00
++3.8000e-02 +3.3800e-01 3.0000e+00
++4.2000e-02 +3.3800e-01 3.0000e+00
++3.8000e-02 +3.4200e-01 3.0000e+00
++4.2000e-02 +3.4200e-01 3.0000e+00
++5.8000e-02 +3.3800e-01 3.0000e+00
++6.2000e-02 +3.3800e-01 3.0000e+00
++5.8000e-02 +3.4200e-01 3.0000e+00
++6.2000e-02 +3.4200e-01 3.0000e+00
++7.8000e-02 +3.3800e-01 3.0000e+00
++8.2000e-02 +3.3800e-01 3.0000e+00
++7.8000e-02 +3.4200e-01 3.0000e+00
++8.2000e-02 +3.4200e-01 3.0000e+00
++9.8000e-02 +3.3800e-01 3.0000e+00
++1.0200e-01 +3.3800e-01 3.0000e+00
++9.8000e-02 +3.4200e-01 3.0000e+00
++1.0200e-01 +3.4200e-01 3.0000e+00
++1.1800e-01 +3.3800e-01 3.0000e+00
++1.2200e-01 +3.3800e-01 3.0000e+00
++1.1800e-01 +3.4200e-01 3.0000e+00
++1.2200e-01 +3.4200e-01 3.0000e+00
++1.3800e-01 +3.3800e-01 3.0000e+00
++1.4200e-01 +3.3800e-01 3.0000e+00
++1.3800e-01 +3.4200e-01 3.0000e+00
++1.4200e-01 +3.4200e-01 3.0000e+00
++1.5800e-01 +3.3800e-01 3.0000e+00
++1.6200e-01 +3.3800e-01 3.0000e+00
++1.5800e-01 +3.4200e-01 3.0000e+00
++1.6200e-01 +3.4200e-01 3.0000e+00
++1.7800e-01 +3.3800e-01 3.0000e+00
++1.8200e-01 +3.3800e-01 3.0000e+00
++1.7800e-01 +3.4200e-01 3.0000e+00
++1.8200e-01 +3.4200e-01 3.0000e+00
++1.9800e-01 +3.3800e-01 3.0000e+00
++2.0200e-01 +3.3800e-01 3.0000e+00
++1.9800e-01 +3.4200e-01 3.0000e+00
++2.0200e-01 +3.4200e-01 3.0000e+00
++2.1800e-01 +3.3800e-01 3.0000e+00
++2.2200e-01 +3.3800e-01 3.0000e+00
++2.1800e-01 +3.4200e-01 3.0000e+00
++2.2200e-01 +3.4200e-01 3.0000e+00
++2.3800e-01 +3.3800e-01 3.0000e+00
++2.4200e-01 +3.3800e-01 3.0000e+00
++2.3800e-01 +3.4200e-01 3.0000e+00
++2.4200e-01 +3.4200e-01 3.0000e+00
++2.5800e-01 +3.3800e-01 3.0000e+00
++2.6200e-01 +3.3800e-01 3.0000e+00
++2.5800e-01 +3.4200e-01 3.0000e+00
++2.6200e-01 +3.4200e-01 3.0000e+00
++2.7800e-01 +3.3800e-01 3.0000e+00
++2.8200e-01 +3.3800e-01 3.0000e+00
++2.7800e-01 +3.4200e-01 3.0000e+00
++2.8200e-01 +3.4200e-01 3.0000e+00
++2.9800e-01 +3.3800e-01 3.0000e+00
++3.0200e-01 +3.3800e-01 3.0000e+00
++2.9800e-01 +3.4200e-01 3.0000e+00
++3.0200e-01 +3.4200e-01 3.0000e+00
++3.1800e-01 +3.3800e-01 3.0000e+00
++3.2200e-01 +3.3800e-01 3.0000e+00
++3.1800e-01 +3.4200e-01 3.0000e+00
++3.2200e-01 +3.4200e-01 3.0000e+00
++3.3800e-01 +3.3800e-01 3.0000e+00
++3.4200e-01 +3.3800e-01 3.0000e+00
++3.3800e-01 +3.4200e-01 3.0000e+00
++3.4200e-01 +3.4200e-01 3.0000e+00
++3.5800e-01 +3.3800e-01 3.0000e+00
++3.6200e-01 +3.3800e-01 3.0000e+00
++3.5800e-01 +3.4200e-01 3.0000e+00
++3.6200e-01 +3.4200e-01 3.0000e+00
++3.7800e-01 +3.3800e-01 3.0000e+00
++3.8200e-01 +3.3800e-01 3.0000e+00
++3.7800e-01 +3.4200e-01 3.0000e+00
++3.8200e-01 +3.4200e-01 3.0000e+00
++3.9800e-01 +3.3800e-01 3.0000e+00
++4.0200e-01 +3.3800e-01 3.0000e+00
++3.9800e-01 +3.4200e-01 3.0000e+00
++4.0200e-01 +3.4200e-01 3.0000e+00
++4.1800e-01 +3.3800e-01 3.0000e+00
++4.2200e-01 +3.3800e-01 3.0000e+00
++4.1800e-01 +3.4200e-01 3.0000e+00
++4.2200e-01 +3.4200e-01 3.0000e+00
++4.3800e-01 +3.3800e-01 3.0000e+00
++4.4200e-01 +3.3800e-01 3.0000e+00
++4.3800e-01 +3.4200e-01 3.0000e+00
++4.4200e-01 +3.4200e-01 3.0000e+00
++4.5800e-01 +3.3800e-01 3.0000e+00
++4.6200e-01 +3.3800e-01 3.0000e+00
++4.5800e-01 +3.4200e-01 3.0000e+00
++4.6200e-01 +3.4200e-01 3.0000e+00
++4.7800e-01 +3.3800e-01 3.0000e+00
++4.8200e-01 +3.3800e-01 3.0000e+00
++4.7800e-01 +3.4200e-01 3.0000e+00
++4.8200e-01 +3.4200e-01 3.0000e+00
++4.9800e-01 +3.3800e-01 3.0000e+00
++5.0200e-01 +3.3800e-01 3.0000e+00
++4.9800e-01 +3.4200e-01 3.0000e+00
++5.0200e-01 +3.4200e-01 3.0000e+00
++5.1800e-01 +3.3800e-01 3.0000e+00
++5.2200e-01 +3.3800e-01 3.0000e+00
++5.1800e-01 +3.4200e-01 3.0000e+00
++5.2200e-01 +3.4200e-01 3.0000e+00
++5.3800e-01 +3.3800e-01 3.0000e+00
++5.4200e-01 +3.3800e-01 3.0000e+00
++5.3800e-01 +3.4200e-01 3.0000e+00
++5.4200e-01 +3.4200e-01 3.0000e+00
++5.5800e-01 +3.3800e-01 3.0000e+00
++5.6200e-01 +3.3800e-01 3.0000e+00
++5.5800e-01 +3.4200e-01 3.0000e+00
++5.6200e-01 +3.4200e-01 3.0000e+00
++5.7800e-01 +3.3800e-01 3.0000e+00
++5.8200e-01 +3.3800e-01 3.0000e+00
++5.7800e-01 +3.4200e-01 3.0000e+00
++5.8200e-01 +3.4200e-01 3.0000e+00
++5.9800e-01 +3.3800e-01 3.0000e+00
++6.0200e-01 +3.3800e-01 3.0000e+00
++5.9800e-01 +3.4200e-01 3.0000e+00
++6.0200e-01 +3.4200e-01 3.0000e+00
++6.1800e-01 +3.3800e-01 3.0000e+00
++6.2200e-01 +3.3800e-01 3.0000e+00
++6.1800e-01 +3.4200e-01 3.0000e+00
++6.2200e-01 +3.4200e-01 3.0000e+00
++6.3800e-01 +3.3800e-01 3.0000e+00
++6.4200e-01 +3.3800e-01 3.0000e+00
++6.3800e-01 +3.4200e-01 3.0000e+00
++6.4200e-01 +3.4200e-01 3.0000e+00
++6.5800e-01 +3.3800e-01 3.0000e+00
++6.6200e-01 +3.3800e-01 3.0000e+00
++6.5800e-01 +3.4200e-01 3.0000e+00
++6.6200e-01 +3.4200e-01 3.0000e+00
++6.7800e-01 +3.3800e-01 3.0000e+00
++6.8200e-01 +3.3800e-01 3.0000e+00
++6.7800e-01 +3.4200e-01 3.0000e+00
++6.8200e-01 +3.4200e-01 3.0000e+00
++6.9800e-01 +3.3800e-01 3.0000e+00
++7.0200e-01 +3.3800e-01 3.0000e+00
++6.9800e-01 +3.4200e-01 3.0000e+00
++7.0200e-01 +3.4200e-01 3.0000e+00
++7.1800e-01 +3.3800e-01 3.0000e+00
++7.2200e-01 +3.3800e-01 3.0000e+00
++7.1800e-01 +3.4200e-01 3.0000e+00
++7.2200e-01 +3.4200e-01 3.0000e+00
++7.3800e-01 +3.3800e-01 3.0000e+00
++7.4200e-01 +3.3800e-01 3.0000e+00
++7.3800e-01 +3.4200e-01 3.0000e+00
++7.4200e-01 +3.4200e-01 3.0000e+00
++7.5800e-01 +3.3800e-01 3.0000e+00
++7.6200e-01 +3.3800e-01 3.0000e+00
++7.5800e-01 +3.4200e-01 3.0000e+00
++7.6200e-01 +3.4200e-01 3.0000e+00
++7.7800e-01 +3.3800e-01 3.0000e+00
++7.8200e-01 +3.3800e-01 3.0000e+00
++7.7800e-01 +3.4200e-01 3.0000e+00
++7.8200e-01 +3.4200e-01 3.0000e+00
++7.9800e-01 +3.3800e-01 3.0000e+00
++8.0200e-01 +3.3800e-01 3.0000e+00
++7.9800e-01 +3.4200e-01 3.0000e+00
++8.0200e-01 +3.4200e-01 3.0000e+00
++8.1800e-01 +3.3800e-01 3.0000e+00
++8.2200e-01 +3.3800e-01 3.0000e+00
++8.1800e-01 +3.4200e-01 3.0000e+00
++8.2200e-01 +3.4200e-01 3.0000e+00
++8.3800e-01 +3.3800e-01 3.0000e+00
++8.4200e-01 +3.3800e-01 3.0000e+00
++8.3800e-01 +3.4200e-01 3.0000e+00
++8.4200e-01 +3.4200e-01 3.0000e+00
++8.5800e-01 +3.3800e-01 3.0000e+00
++8.6200e-01 +3.3800e-01 3.0000e+00
++8.5800e-01 +3.4200e-01 3.0000e+00
++8.6200e-01 +3.4200e-01 3.0000e+00
++8.7800e-01 +3.3800e-01 3.0000e+00
++8.8200e-01 +3.3800e-01 3.0000e+00
++8.7800e-01 +3.4200e-01 3.0000e+00
++8.8200e-01 +3.4200e-01 3.0000e+00
++8.9800e-01 +3.3800e-01 3.0000e+00
++9.0200e-01 +3.3800e-01 3.0000e+00
++8.9800e-01 +3.4200e-01 3.0000e+00
++9.0200e-01 +3.4200e-01 3.0000e+00
++9.1800e-01 +3.3800e-01 3.0000e+00
++9.2200e-01 +3.3800e-01 3.0000e+00
++9.1800e-01 +3.4200e-01 3.0000e+00
++9.2200e-01 +3.4200e-01 3.0000e+00
++9.3800e-01 +3.3800e-01 3.0000e+00
++9.4200e-01 +3.3800e-01 3.0000e+00
++9.3800e-01 +3.4200e-01 3.0000e+00
++9.4200e-01 +3.4200e-01 3.0000e+00
++9.5800e-01 +3.3800e-01 3.0000e+00
++9.6200e-01 +3.3800e-01 3.0000e+00
++9.5800e-01 +3.4200e-01 3.0000e+00
++9.6200e-01 +3.4200e-01 3.0000e+00
++9.7800e-01 +3.3800e-01 3.0000e+00
++9.8200e-01 +3.3800e-01 3.0000e+00
++9.7800e-01 +3.4200e-01 3.0000e+00
++9.8200e-01 +3.4200e-01 3.0000e+00
++9.9800e-01 +3.3800e-01 3.0000e+00
++1.0020e+00 +3.3800e-01 3.0000e+00
++9.9800e-01 +3.4200e-01 3.0000e+00
++1.0020e+00 +3.4200e-01 3.0000e+00
++1.8000e-02 +3.5800e-01 3.0000e+00
++2.2000e-02 +3.5800e-01 3.0000e+00
++1.8000e-02 +3.6200e-01 3.0000e+00
++2.2000e-02 +3.6200e-01 3.0000e+00
++3.8000e-02 +3.5800e-01 3.0000e+00
++4.2000e-02 +3.5800e-01 3.0000e+00
++3.8000e-02 +3.6200e-01 3.0000e+00
++4.2000e-02 +3.6200e-01 3.0000e+00
++5.8000e-02 +3.5800e-01 3.0000e+00
++6.2000e-02 +3.5800e-01 3.0000e+00
++5.8000e-02 +3.6200e-01 3.0000e+00
++6.2000e-02 +3.6200e-01 3.0000e+00
++7.8000e-02 +3.5800e-01 3.0000e+00
++8.2000e-02 +3.5800e-01 3.0000e+00
++7.8000e-02 +3.6200e-01 3.0000e+00
++8.2000e-02 +3.6200e-01 3.0000e+00
++9.8000e-02 +3.5800e-01 3.0000e+00
++1.0200e-01 +3.5800e-01 3.0000e+00
++9.8000e-02 +3.6200e-01 3.0000e+00
++1.0200e-01 +3.6200e-01 3.0000e+00
++1.1800e-01 +3.5800e-01 3.0000e+00
++1.2200e-01 +3.5800e-01 3.0000e+00
++1.1800e-01 +3.6200e-01 3.0000e+00
++1.2200e-01 +3.6200e-01 3.0000e+00
++1.3800e-01 +3.5800e-01 3.0000e+00
++1.4200e-01 +3.5800e-01 3.0000e+00
++1.3800e-01 +3.6200e-01 3.0000e+00
++1.4200e-01 +3.6200e-01 3.0000e+00
++1.5800e-01 +3.5800e-01 3.0000e+00
++1.6200e-01 +3.5800e-01 3.0000e+00
++1.5800e-01 +3.6200e-01 3.0000e+00
++1.6200e-01 +3.6200e-01 3.0000e+00
++1.7800e-01 +3.5800e-01 3.0000e+00
++1.8200e-01 +3.5800e-01 3.0000e+00
++1.7800e-01 +3.6200e-01 3.0000e+00
++1.8200e-01 +3.6200e-01 3.0000e+00
++1.9800e-01 +3.5800e-01 3.0000e+00
++2.0200e-01 +3.5800e-01 3.0000e+00
++1.9800e-01 +3.6200e-01 3.0000e+00
++2.0200e-01 +3.6200e-01 3.0000e+00
++2.1800e-01 +3.5800e-01 3.0000e+00
++2.2200e-01 +3.5800e-01 3.0000e+00
++2.1800e-01 +3.6200e-01 3.0000e+00
++2.2200e-01 +3.6200e-01 3.0000e+00
++2.3800e-01 +3.5800e-01 3.0000e+00
++2.4200e-01 +3.5800e-01 3.0000e+00
++2.3800e-01 +3.6200e-01 3.0000e+00
++2.4200e-01 +3.6200e-01 3.0000e+00
++2.5800e-01 +3.5800e-01 3.0000e+00
++2.6200e-01 +3.5800e-01 3.0000e+00
++2.5800e-01 +3.6200e-01 3.0000e+00
++2.6200e-01 +3.6200e-01 3.0000e+00
++2.7800e-01 +3.5800e-01 3.0000e+00
++2.8200e-01 +3.5800e-01 3.0000e+00
++2.7800e-01 +3.6200e-01 3.0000e+00
++2.8200e-01 +3.6200e-01 3.0000e+00
++2.9800e-01 +3.5800e-01 3.0000e+00
++3.0200e-01 +3.5800e-01 3.0000e+00
++2.9800e-01 +3.6200e-01 3.0000e+00
++3.0200e-01 +3.6200e-01 3.0000e+00
++3.1800e-01 +3.5800e-01 3.0000e+00
++3.2200e-01 +3.5800e-01 3.0000e+00
++3.1800e-01 +3.6200e-01 3.0000e+00
++3.2200e-01 +3.6200e-01 3.0000e+00
++3.3800e-01 +3.5800e-01 3.0000e+00
++3.4200e-01 +3.5800e-01 3.0000e+00
++3.3800e-01 +3.6200e-01 3.0000e+00
++3.4200e-01 +3.6200e-01 3.0000e+00
++3.5800e-01 +3.5800e-01 3.0000e+00
++3.6200e-01 +3.5800e-01 3.0000e+00
++3.5800e-01 +3.6200e-01 3.0000e+00
++3.6200e-01 +3.6200e-01 3.0000e+00
++3.7800e-01 +3.5800e-01 3.0000e+00
++3.8200e-01 +3.5800e-01 3.0000e+00
++3.7800e-01 +3.6200e-01 3.0000e+00
++3.8200e-01 +3.6200e-01 3.0000e+00
++3.9800e-01 +3.5800e-01 3.0000e+00
++4.0200e-01 +3.5800e-01 3.0000e+00
++3.9800e-01 +3.6200e-01 3.0000e+00
++4.0200e-01 +3.6200e-01 3.0000e+00
++4.1800e-01 +3.5800e-01 3.0000e+00
++4.2200e-01 +3.5800e-01 3.0000e+00
++4.1800e-01 +3.6200e-01 3.0000e+00
++4.2200e-01 +3.6200e-01 3.0000e+00
++4.3800e-01 +3.5800e-01 3.0000e+00
++4.4200e-01 +3.5800e-01 3.0000e+00
++4.3800e-01 +3.6200e-01 3.0000e+00
++4.4200e-01 +3.6200e-01 3.0000e+00
++4.5800e-01 +3.5800e-01 3.0000e+00
++4.6200e-01 +3.5800e-01 3.0000e+00
++4.5800e-01 +3.6200e-01 3.0000e+00
++4.6200e-01 +3.6200e-01 3.0000e+00
++4.7800e-01 +3.5800e-01 3.0000e+00
++4.8200e-01 +3.5800e-01 3.0000e+00
++4.7800e-01 +3.6200e-01 3.0000e+00
++4.8200e-01 +3.6200e-01 3.0000e+00
++4.9800e-01 +3.5800e-01 3.0000e+00
++5.0200e-01 +3.5800e-01 3.0000e+00
++4.9800e-01 +3.6200e-01 3.0000e+00
++5.0200e-01 +3.6200e-01 3.0000e+00
++5.1800e-01 +3.5800e-01 3.0000e+00
++5.2200e-01 +3.5800e-01 3.0000e+00
++5.1800e-01 +3.6200e-01 3.0000e+00
++5.2200e-01 +3.6200e-01 3.0000e+00
++5.3800e-01 +3.5800e-01 3.0000e+00
++5.4200e-01 +3.5800e-01 3.0000e+00
++5.3800e-01 +3.6200e-01 3.0000e+00
++5.4200e-01 +3.6200e-01 3.0000e+00
++5.5800e-01 +3.5800e-01 3.0000e+00
++5.6200e-01 +3.5800e-01 3.0000e+00
++5.5800e-01 +3.6200e-01 3.0000e+00
++5.6200e-01 +3.6200e-01 3.0000e+00
++5.7800e-01 +3.5800e-01 3.0000e+00
++5.8200e-01 +3.5800e-01 3.0000e+00
++5.7800e-01 +3.6200e-01 3.0000e+00
++5.8200e-01 +3.6200e-01 3.0000e+00
++5.9800e-01 +3.5800e-01 3.0000e+00
++6.0200e-01 +3.5800e-01 3.0000e+00
++5.9800e-01 +3.6200e-01 3.0000e+00
++6.0200e-01 +3.6200e-01 3.0000e+00
++6.1800e-01 +3.5800e-01 3.0000e+00
++6.2200e-01 +3.5800e-01 3.0000e+00
++6.1800e-01 +3.6200e-01 3.0000e+00
++6.2200e-01 +3.6200e-01 3.0000e+00
++6.3800e-01 +3.5800e-01 3.0000e+00
++6.4200e-01 +3.5800e-01 3.0000e+00
++6.3800e-01 +3.6200e-01 3.0000e+00
++6.4200e-01 +3.6200e-01 3.0000e+00
++6.5800e-01 +3.5800e-01 3.0000e+00
++6.6200e-01 +3.5800e-01 3.0000e+00
++6.5800e-01 +3.6200e-01 3.0000e+00
++6.6200e-01 +3.6200e-01 3.0000e+00
++6.7800e-01 +3.5800e-01 3.0000e+00
++6.8200e-01 +3.5800e-01 3.0000e+00
++6.7800e-01 +3.6200e-01 3.0000e+00
++6.8200e-01 +3.6200e-01 3.0000e+00
++6.9800e-01 +3.5800e-01 3.0000e+00
++7.0200e-01 +3.5800e-01 3.0000e+00
++6.9800e-01 +3.6200e-01 3.0000e+00
++7.0200e-01 +3.6200e-01 3.0000e+00
++7.1800e-01 +3.5800e-01 3.0000e+00
++7.2200e-01 +3.5800e-01 3.0000e+00
++7.1800e-01 +3.6200e-01 3.0000e+00
++7.2200e-01 +3.6200e-01 3.0000e+00
++7.3800e-01 +3.5800e-01 3.0000e+00
++7.4200e-01 +3.5800e-01 3.0000e+00
++7.3800e-01 +3.6200e-01 3.0000e+00
++7.4200e-01 +3.6200e-01 3.0000e+00
++7.5800e-01 +3.5800e-01 3.0000e+00
++7.6200e-01 +3.5800e-01 3.0000e+00
++7.5800e-01 +3.6200e-01 3.0000e+00
++7.6200e-01 +3.6200e-01 3.0000e+00
++7.7800e-01 +3.5800e-01 3.0000e+00
++7.8200e-01 +3.5800e-01 3.0000e+00
++7.7800e-01 +3.6200e-01 3.0000e+00
++7.8200e-01 +3.6200e-01 3.0000e+00
++7.9800e-01 +3.5800e-01 3.0000e+00
++8.0200e-01 +3.5800e-01 3.0000e+00
++7.9800e-01 +3.6200e-01 3.0000e+00
++8.0200e-01 +3.6200e-01 3.0000e+00
++8.1800e-01 +3.5800e-01 3.0000e+00
++8.2200e-01 +3.5800e-01 3.0000e+00
++8.1800e-01 +3.6200e-01 3.0000e+00
++8.2200e-01 +3.6200e-01 3.0000e+00
++8.3800e-01 +3.5800e-01 3.0000e+00
++8.4200e-01 +3.5800e-01 3.0000e+00
++8.3800e-01 +3.6200e-01 3.0000e+00
++8.4200e-01 +3.6200e-01 3.0000e+00
++8.5800e-01 +3.5800e-01 3.0000e+00
++8.6200e-01 +3.5800e-01 3.0000e+00
++8.5800e-01 +3.6200e-01 3.0000e+00
++8.6200e-01 +3.6200e-01 3.0000e+00
++8.7800e-01 +3.5800e-01 3.0000e+00
++8.8200e-01 +3.5800e-01 3.0000e+00
++8.7800e-01 +3.6200e-01 3.0000e+00
++8.8200e-01 +3.6200e-01 3.0000e+00
++8.9800e-01 +3.5800e-01 3.0000e+00
++9.0200e-01 +3.5800e-01 3.0000e+00
++8.9800e-01 +3.6200e-01 3.0000e+00
++9.0200e-01 +3.6200e-01 3.0000e+00
++9.1800e-01 +3.5800e-01 3.0000e+00
++9.2200e-01 +3.5800e-01 3.0000e+00
++9.1800e-01 +3.6200e-01 3.0000e+00
++9.2200e-01 +3.6200e-01 3.0000e+00
++9.3800e-01 +3.5800e-01 3.0000e+00
++9.4200e-01 +3.5800e-01 3.0000e+00
++9.3800e-01 +3.6200e-01 3.0000e+00
++9.4200e-01 +3.6200e-01 3.0000e+00
++9.5800e-01 +3.5800e-01 3.0000e+00
++9.6200e-01 +3.5800e-01 3.0000e+00
++9.5800e-01 +3.6200e-01 3.0000e+00
++9.6200e-01 +3.6200e-01 3.0000e+00
++9.7800e-01 +3.5800e-01 3.0000e+00
++9.8200e-01 +3.5800e-01 3.0000e+00
++9.7800e-01 +3.6200e-01 3.0000e+00
++9.8200e-01 +3.6200e-01 3.0000e+00
++9.9800e-01 +3.5800e-01 3.0000e+00
++1.0020e+00 +3.5800e-01 3.0000e+00
++9.9800e-01 +3.6200e-01 3.0000e+00
++1.0020e+00 +3.6200e-01 3.0000e+00
++1.8000e-02 +3.7800e-01 3.0000e+00
++2.2000e-02 +3.7800e-01 3.0000e+00
++1.8000e-02 +3.8200e-01 3.0000e+00
++2.2000e-02 +3.8200e-01 3.0000e+00
++3.8000e-02 +3.7800e-01 3.0000e+00
++4.2000e-02 +3.7800e-01 3.0000e+00
++3.8000e-02 +3.8200e-01 3.0000e+00
++4.2000e-02 +3.8200e-01 3.0000e+00
++5.8000e-02 +3.7800e-01 3.0000e+00
++6.2000e-02 +3.7800e-01 3.0000e+00
++5.8000e-02 +3.8200e-01 3.0000e+00
++6.2000e-02 +3.8200e-01 3.0000e+00
++7.8000e-02 +3.7800e-01 3.0000e+00
++8.2000e-02 +3.7800e-01 3.0000e+00
++7.8000e-02 +3.8200e-01 3.0000e+00
++8.2000e-02 +3.8200e-01 3.0000e+00
++9.8000e-02 +3.7800e-01 3.0000e+00
++1.0200e-01 +3.7800e-01 3.0000e+00
++9.8000e-02 +3.8200e-01 3.0000e+00
++1.0200e-01 +3.8200e-01 3.0000e+00
++1.1800e-01 +3.7800e-01 3.0000e+00
++1.2200e-01 +3.7800e-01 3.0000e+00
++1.1800e-01 +3.8200e-01 3.0000e+00
++1.2200e-01 +3.8200e-01 3.0000e+00
++1.3800e-01 +3.7800e-01 3.0000e+00
++1.4200e-01 +3.7800e-01 3.0000e+00
++1.3800e-01 +3.8200e-01 3.0000e+00
++1.4200e-01 +3.8200e-01 3.0000e+00
++1.5800e-01 +3.7800e-01 3.0000e+00
++1.6200e-01 +3.7800e-01 3.0000e+00
++1.5800e-01 +3.8200e-01 3.0000e+00
++1.6200e-01 +3.8200e-01 3.0000e+00
++1.7800e-01 +3.7800e-01 3.0000e+00
++1.8200e-01 +3.7800e-01 3.0000e+00
++1.7800e-01 +3.8200e-01 3.0000e+00
++1.8200e-01 +3.8200e-01 3.0000e+00
++1.9800e-01 +3.7800e-01 3.0000e+00
++2.0200e-01 +3.7800e-01 3.0000e+00
++1.9800e-01 +3.8200e-01 3.0000e+00
++2.0200e-01 +3.8200e-01 3.0000e+00
++2.1800e-01 +3.7800e-01 3.0000e+00
++2.2200e-01 +3.7800e-01 3.0000e+00
++2.1800e-01 +3.8200e-01 3.0000e+00
++2.2200e-01 +3.8200e-01 3.0000e+00
++2.3800e-01 +3.7800e-01 3.0000e+00
++2.4200e-01 +3.7800e-01 3.0000e+00
++2.3800e-01 +3.8200e-01 3.0000e+00
++2.4200e-01 +3.8200e-01 3.0000e+00
++2.5800e-01 +3.7800e-01 3.0000e+00
++2.6200e-01 +3.7800e-01 3.0000e+00
++2.5800e-01 +3.8200e-01 3.0000e+00
++2.6200e-01 +3.8200e-01 3.0000e+00
++2.7800e-01 +3.7800e-01 3.0000e+00
++2.8200e-01 +3.7800e-01 3.0000e+00
++2.7800e-01 +3.8200e-01 3.0000e+00
++2.8200e-01 +3.8200e-01 3.0000e+00
++2.9800e-01 +3.7800e-01 3.0000e+00
++3.0200e-01 +3.7800e-01 3.0000e+00
++2.9800e-01 +3.8200e-01 3.0000e+00
++3.0200e-01 +3.8200e-01 3.0000e+00
++3.1800e-01 +3.7800e-01 3.0000e+00
++3.2200e-01 +3.7800e-01 3.0000e+00
++3.1800e-01 +3.8200e-01 3.0000e+00
++3.2200e-01 +3.8200e-01 3.0000e+00
++3.3800e-01 +3.7800e-01 3.0000e+00
++3.4200e-01 +3.7800e-01 3.0000e+00
++3.3800e-01 +3.8200e-01 3.0000e+00
++3.4200e-01 +3.8200e-01 3.0000e+00
++3.5800e-01 +3.7800e-01 3.0000e+00
++3.6200e-01 +3.7800e-01 3.0000e+00
++3.5800e-01 +3.8200e-01 3.0000e+00
++3.6200e-01 +3.8200e-01 3.0000e+00
++3.7800e-01 +3.7800e-01 3.0000e+00
++3.8200e-01 +3.7800e-01 3.0000e+00
++3.7800e-01 +3.8200e-01 3.0000e+00
++3.8200e-01 +3.8200e-01 3.0000e+00
++3.9800e-01 +3.7800e-01 3.0000e+00
++4.0200e-01 +3.7800e-01 3.0000e+00
++3.9800e-01 +3.8200e-01 3.0000e+00
++4.0200e-01 +3.8200e-01 3.0000e+00
++4.1800e-01 +3.7800e-01 3.0000e+00
++4.2200e-01 +3.7800e-01 3.0000e+00
++4.1800e-01 +3.8200e-01 3.0000e+00
++4.2200e-01 +3.8200e-01 3.0000e+00
++4.3800e-01 +3.7800e-01 3.0000e+00
++4.4200e-01 +3.7800e-01 3.0000e+00
++4.3800e-01 +3.8200e-01 3.0000e+00
++4.4200e-01 +3.8200e-01 3.0000e+00
++4.5800e-01 +3.7800e-01 3.0000e+00
++4.6200e-01 +3.7800e-01 3.0000e+00
++4.5800e-01 +3.8200e-01 3.0000e+00
++4.6200e-01 +3.8200e-01 3.0000e+00
++4.7800e-01 +3.7800e-01 3.0000e+00
++4.8200e-01 +3.7800e-01 3.0000e+00
++4.7800e-01 +3.8200e-01 3.0000e+00
++4.8200e-01 +3.8200e-01 3.0000e+00
++4.9800e-01 +3.7800e-01 3.0000e+00
++5.0200e-01 +3.7800e-01 3.0000e+00
++4.9800e-01 +3.8200e-01 3.0000e+00
++5.0200e-01 +3.8200e-01 3.0000e+00
++5.1800e-01 +3.7800e-01 3.0000e+00
++5.2200e-01 +3.7800e-01 3.0000e+00
++5.1800e-01 +3.8200e-01 3.0000e+00
++5.2200e-01 +3.8200e-01 3.0000e+00
++5.3800e-01 +3.7800e-01 3.0000e+00
++5.4200e-01 +3.7800e-01 3.0000e+00
++5.3800e-01 +3.8200e-01 3.0000e+00
++5.4200e-01 +3.8200e-01 3.0000e+00
++5.5800e-01 +3.7800e-01 3.0000e+00
++5.6200e-01 +3.7800e-01 3.0000e+00
++5.5800e-01 +3.8200e-01 3.0000e+00
++5.6200e-01 +3.8200e-01 3.0000e+00
++5.7800e-01 +3.7800e-01 3.0000e+00
++5.8200e-01 +3.7800e-01 3.0000e+00
++5.7800e-01 +3.8200e-01 3.0000e+00
++5.8200e-01 +3.8200e-01 3.0000e+00
++5.9800e-01 +3.7800e-01 3.0000e+00
++6.0200e-01 +3.7800e-01 3.0000e+00
++5.9800e-01 +3.8200e-01 3.0000e+00
++6.0200e-01 +3.8200e-01 3.0000e+00
++6.1800e-01 +3.7800e-01 3.0000e+00
++6.2200e-01 +3.7800e-01 3.0000e+00
++6.1800e-01 +3.8200e-01 3.0000e+00
++6.2200e-01 +3.8200e-01 3.0000e+00
++6.3800e-01 +3.7800e-01 3.0000e+00
++6.4200e-01 +3.7800e-01 3.0000e+00
++6.3800e-01 +3.8200e-01 3.0000e+00
++6.4200e-01 +3.8200e-01 3.0000e+00
++6.5800e-01 +3.7800e-01 3.0000e+00
++6.6200e-01 +3.7800e-01 3.0000e+00
++6.5800e-01 +3.8200e-01 3.0000e+00
++6.6200e-01 +3.8200e-01 3.0000e+00
++6.7800e-01 +3.7800e-01 3.0000e+00
++6.8200e-01 +3.7800e-01 3.0000e+00
++6.7800e-01 +3.8200e-01 3.0000e+00
++6.8200e-01 +3.8200e-01 3.0000e+00
++6.9800e-01 +3.7800e-01 3.0000e+00
++7.0200e-01 +3.7800e-01 3.0000e+00
++6.9800e-01 +3.8200e-01 3.0000e+00
++7.0200e-01 +3.8200e-01 3.0000e+00
++7.1800e-01 +3.7800e-01 3.0000e+00
++7.2200e-01 +3.7800e-01 3.0000e+00
++7.1800e-01 +3.8200e-01 3.0000e+00
++7.2200e-01 +3.8200e-01 3.0000e+00
++7.3800e-01 +3.7800e-01 3.0000e+00
++7.4200e-01 +3.7800e-01 3.0000e+00
++7.3800e-01 +3.8200e-01 3.0000e+00
++7.4200e-01 +3.8200e-01 3.0000e+00
++7.5800e-01 +3.7800e-01 3.0000e+00
++7.6200e-01 +3.7800e-01 3.0000e+00
++7.5800e-01 +3.8200e-01 3.0000e+00
++7.6200e-01 +3.8200e-01 3.0000e+00
++7.7800e-01 +3.7800e-01 3.0000e+00
++7.8200e-01 +3.7800e-01 3.0000e+00
++7.7800e-01 +3.8200e-01 3.0000e+00
++7.8200e-01 +3.8200e-01 3.0000e+00
++7.9800e-01 +3.7800e-01 3.0000e+00
++8.0200e-01 +3.7800e-01 3.0000e+00
++7.9800e-01 +3.8200e-01 3.0000e+00
++8.0200e-01 +3.8200e-01 3.0000e+00
++8.1800e-01 +3.7800e-01 3.0000e+00
++8.2200e-01 +3.7800e-01 3.0000e+00
++8.1800e-01 +3.8200e-01 3.0000e+00
++8.2200e-01 +3.8200e-01 3.0000e+00
++8.3800e-01 +3.7800e-01 3.0000e+00
++8.4200e-01 +3.7800e-01 3.0000e+00
++8.3800e-01 +3.8200e-01 3.0000e+00
++8.4200e-01 +3.8200e-01 3.0000e+00
++8.5800e-01 +3.7800e-01 3.0000e+00
++8.6200e-01 +3.7800e-01 3.0000e+00
++8.5800e-01 +3.8200e-01 3.0000e+00
++8.6200e-01 +3.8200e-01 3.0000e+00
++8.7800e-01 +3.7800e-01 3.0000e+00
++8.8200e-01 +3.7800e-01 3.0000e+00
++8.7800e-01 +3.8200e-01 3.0000e+00
++8.8200e-01 +3.8200e-01 3.0000e+00
++8.9800e-01 +3.7800e-01 3.0000e+00
++9.0200e-01 +3.7800e-01 3.0000e+00
++8.9800e-01 +3.8200e-01 3.0000e+00
++9.0200e-01 +3.8200e-01 3.0000e+00
++9.1800e-01 +3.7800e-01 3.0000e+00
++9.2200e-01 +3.7800e-01 3.0000e+00
++9.1800e-01 +3.8200e-01 3.0000e+00
++9.2200e-01 +3.8200e-01 3.0000e+00
++9.3800e-01 +3.7800e-01 3.0000e+00
++9.4200e-01 +3.7800e-01 3.0000e+00
++9.3800e-01 +3.8200e-01 3.0000e+00
++9.4200e-01 +3.8200e-01 3.0000e+00
++9.5800e-01 +3.7800e-01 3.0000e+00
++9.6200e-01 +3.7800e-01 3.0000e+00
++9.5800e-01 +3.8200e-01 3.0000e+00
++9.6200e-01 +3.8200e-01 3.0000e+00
++9.7800e-01 +3.7800e-01 3.0000e+00
++9.8200e-01 +3.7800e-01 3.0000e+00
++9.7800e-01 +3.8200e-01 3.0000e+00
++9.8200e-01 +3.8200e-01 3.0000e+00
++9.9800e-01 +3.7800e-01 3.0000e+00
++1.0020e+00 +3.7800e-01 3.0000e+00
++9.9800e-01 +3.8200e-01 3.0000e+00
++1.0020e+00 +3.8200e-01 3.0000e+00
++1.8000e-02 +3.9800e-01 3.0000e+00
++2.2000e-02 +3.9800e-01 3.0000e+00
++1.8000e-02 +4.0200e-01 3.0000e+00
++2.2000e-02 +4.0200e-01 3.0000e+00
++3.8000e-02 +3.9800e-01 3.0000e+00
++4.2000e-02 +3.9800e-01 3.0000e+00
++3.8000e-02 +4.0200e-01 3.0000e+00
++4.2000e-02 +4.0200e-01 3.0000e+00
++5.8000e-02 +3.9800e-01 3.0000e+00
++6.2000e-02 +3.9800e-01 3.0000e+00
++5.8000e-02 +4.0200e-01 3.0000e+00
++6.2000e-02 +4.0200e-01 3.0000e+00
++7.8000e-02 +3.9800e-01 3.0000e+00
++8.2000e-02 +3.9800e-01 3.0000e+00
++7.8000e-02 +4.0200e-01 3.0000e+00
++8.2000e-02 +4.0200e-01 3.0000e+00
++9.8000e-02 +3.9800e-01 3.0000e+00
++1.0200e-01 +3.9800e-01 3.0000e+00
++9.8000e-02 +4.0200e-01 3.0000e+00
++1.0200e-01 +4.0200e-01 3.0000e+00
++1.1800e-01 +3.9800e-01 3.0000e+00
++1.2200e-01 +3.9800e-01 3.0000e+00
++1.1800e-01 +4.0200e-01 3.0000e+00
++1.2200e-01 +4.0200e-01 3.0000e+00
++1.3800e-01 +3.9800e-01 3.0000e+00
++1.4200e-01 +3.9800e-01 3.0000e+00
++1.3800e-01 +4.0200e-01 3.0000e+00
++1.4200e-01 +4.0200e-01 3.0000e+00
++1.5800e-01 +3.9800e-01 3.0000e+00
++1.6200e-01 +3.9800e-01 3.0000e+00
++1.5800e-01 +4.0200e-01 3.0000e+00
++1.6200e-01 +4.0200e-01 3.0000e+00
++1.7800e-01 +3.9800e-01 3.0000e+00
++1.8200e-01 +3.9800e-01 3.0000e+00
++1.7800e-01 +4.0200e-01 3.0000e+00
++1.8200e-01 +4.0200e-01 3.0000e+00
++1.9800e-01 +3.9800e-01 3.0000e+00
++2.0200e-01 +3.9800e-01 3.0000e+00
++1.9800e-01 +4.0200e-01 3.0000e+00
++2.0200e-01 +4.0200e-01 3.0000e+00
++2.1800e-01 +3.9800e-01 3.0000e+00
++2.2200e-01 +3.9800e-01 3.0000e+00
++2.1800e-01 +4.0200e-01 3.0000e+00
++2.2200e-01 +4.0200e-01 3.0000e+00
++2.3800e-01 +3.9800e-01 3.0000e+00
++2.4200e-01 +3.9800e-01 3.0000e+00
++2.3800e-01 +4.0200e-01 3.0000e+00
++2.4200e-01 +4.0200e-01 3.0000e+00
++2.5800e-01 +3.9800e-01 3.0000e+00
++2.6200e-01 +3.9800e-01 3.0000e+00
++2.5800e-01 +4.0200e-01 3.0000e+00
++2.6200e-01 +4.0200e-01 3.0000e+00
++2.7800e-01 +3.9800e-01 3.0000e+00
++2.8200e-01 +3.9800e-01 3.0000e+00
++2.7800e-01 +4.0200e-01 3.0000e+00
++2.8200e-01 +4.0200e-01 3.0000e+00
++2.9800e-01 +3.9800e-01 3.0000e+00
++3.0200e-01 +3.9800e-01 3.0000e+00
++2.9800e-01 +4.0200e-01 3.0000e+00
++3.0200e-01 +4.0200e-01 3.0000e+00
++3.1800e-01 +3.9800e-01 3.0000e+00
++3.2200e-01 +3.9800e-01 3.0000e+00
++3.1800e-01 +4.0200e-01 3.0000e+00
++3.2200e-01 +4.0200e-01 3.0000e+00
++3.3800e-01 +3.9800e-01 3.0000e+00
++3.4200e-01 +3.9800e-01 3.0000e+00
++3.3800e-01 +4.0200e-01 3.0000e+00
++3.4200e-01 +4.0200e-01 3.0000e+00
++3.5800e-01 +3.9800e-01 3.0000e+00
++3.6200e-01 +3.9800e-01 3.0000e+00
++3.5800e-01 +4.0200e-01 3.0000e+00
++3.6200e-01 +4.0200e-01 3.0000e+00
++3.7800e-01 +3.9800e-01 3.0000e+00
++3.8200e-01 +3.9800e-01 3.0000e+00
++3.7800e-01 +4.0200e-01 3.0000e+00
++3.8200e-01 +4.0200e-01 3.0000e+00
++3.9800e-01 +3.9800e-01 3.0000e+00
++4.0200e-01 +3.9800e-01 3.0000e+00
++3.9800e-01 +4.0200e-01 3.0000e+00
++4.0200e-01 +4.0200e-01 3.0000e+00
++4.1800e-01 +3.9800e-01 3.0000e+00
++4.2200e-01 +3.9800e-01 3.0000e+00
++4.1800e-01 +4.0200e-01 3.0000e+00
++4.2200e-01 +4.0200e-01 3.0000e+00
++4.3800e-01 +3.9800e-01 3.0000e+00
++4.4200e-01 +3.9800e-01 3.0000e+00
++4.3800e-01 +4.0200e-01 3.0000e+00
++4.4200e-01 +4.0200e-01 3.0000e+00
++4.5800e-01 +3.9800e-01 3.0000e+00
++4.6200e-01 +3.9800e-01 3.0000e+00
++4.5800e-01 +4.0200e-01 3.0000e+00
++4.6200e-01 +4.0200e-01 3.0000e+00
++4.7800e-01 +3.9800e-01 3.0000e+00
++4.8200e-01 +3.9800e-01 3.0000e+00
++4.7800e-01 +4.0200e-01 3.0000e+00
++4.8200e-01 +4.0200e-01 3.0000e+00
++4.9800e-01 +3.9800e-01 3.0000e+00
++5.0200e-01 +3.9800e-01 3.0000e+00
++4.9800e-01 +4.0200e-01 3.0000e+00
++5.0200e-01 +4.0200e-01 3.0000e+00
++5.1800e-01 +3.9800e-01 3.0000e+00
++5.2200e-01 +3.9800e-01 3.0000e+00
++5.1800e-01 +4.0200e-01 3.0000e+00
++5.2200e-01 +4.0200e-01 3.0000e+00
++5.3800e-01 +3.9800e-01 3.0000e+00
++5.4200e-01 +3.9800e-01 3.0000e+00
++5.3800e-01 +4.0200e-01 3.0000e+00
++5.4200e-01 +4.0200e-01 3.0000e+00
++5.5800e-01 +3.9800e-01 3.0000e+00
++5.6200e-01 +3.9800e-01 3.0000e+00
++5.5800e-01 +4.0200e-01 3.0000e+00
++5.6200e-01 +4.0200e-01 3.0000e+00
++5.7800e-01 +3.9800e-01 3.0000e+00
++5.8200e-01 +3.9800e-01 3.0000e+00
++5.7800e-01 +4.0200e-01 3.0000e+00
++5.8200e-01 +4.0200e-01 3.0000e+00
++5.9800e-01 +3.9800e-01 3.0000e+00
++6.0200e-01 +3.9800e-01 3.0000e+00
++5.9800e-01 +4.0200e-01 3.0000e+00
++6.0200e-01 +4.0200e-01 3.0000e+00
++6.1800e-01 +3.9800e-01 3.0000e+00
++6.2200e-01 +3.9800e-01 3.0000e+00
++6.1800e-01 +4.0200e-01 3.0000e+00
++6.2200e-01 +4.0200e-01 3.0000e+00
++6.3800e-01 +3.9800e-01 3.0000e+00
++6.4200e-01 +3.9800e-01 3.0000e+00
++6.3800e-01 +4.0200e-01 3.0000e+00
++6.4200e-01 +4.0200e-01 3.0000e+00
++6.5800e-01 +3.9800e-01 3.0000e+00
++6.6200e-01 +3.9800e-01 3.0000e+00
++6.5800e-01 +4.0200e-01 3.0000e+00
++6.6200e-01 +4.0200e-01 3.0000e+00
++6.7800e-01 +3.9800e-01 3.0000e+00
++6.8200e-01 +3.9800e-01 3.0000e+00
++6.7800e-01 +4.0200e-01 3.0000e+00
++6.8200e-01 +4.0200e-01 3.0000e+00
++6.9800e-01 +3.9800e-01 3.0000e+00
++7.0200e-01 +3.9800e-01 3.0000e+00
++6.9800e-01 +4.0200e-01 3.0000e+00
++7.0200e-01 +4.0200e-01 3.0000e+00
++7.1800e-01 +3.9800e-01 3.0000e+00
++7.2200e-01 +3.9800e-01 3.0000e+00
++7.1800e-01 +4.0200e-01 3.0000e+00
++7.2200e-01 +4.0200e-01 3.0000e+00
++7.3800e-01 +3.9800e-01 3.0000e+00
++7.4200e-01 +3.9800e-01 3.0000e+00
++7.3800e-01 +4.0200e-01 3.0000e+00
++7.4200e-01 +4.0200e-01 3.0000e+00
++7.5800e-01 +3.9800e-01 3.0000e+00
++7.6200e-01 +3.9800e-01 3.0000e+00
++7.5800e-01 +4.0200e-01 3.0000e+00
++7.6200e-01 +4.0200e-01 3.0000e+00
++7.7800e-01 +3.9800e-01 3.0000e+00
++7.8200e-01 +3.9800e-01 3.0000e+00
++7.7800e-01 +4.0200e-01 3.0000e+00
++7.8200e-01 +4.0200e-01 3.0000e+00
++7.9800e-01 +3.9800e-01 3.0000e+00
++8.0200e-01 +3.9800e-01 3.0000e+00
++7.9800e-01 +4.0200e-01 3.0000e+00
++8.0200e-01 +4.0200e-01 3.0000e+00
++8.1800e-01 +3.9800e-01 3.0000e+00
++8.2200e-01 +3.9800e-01 3.0000e+00
++8.1800e-01 +4.0200e-01 3.0000e+00
++8.2200e-01 +4.0200e-01 3.0000e+00
++8.3800e-01 +3.9800e-01 3.0000e+00
++8.4200e-01 +3.9800e-01 3.0000e+00
++8.3800e-01 +4.0200e-01 3.0000e+00
++8.4200e-01 +4.0200e-01 3.0000e+00
++8.5800e-01 +3.9800e-01 3.0000e+00
++8.6200e-01 +3.9800e-01 3.0000e+00
++8.5800e-01 +4.0200e-01 3.0000e+00
++8.6200e-01 +4.0200e-01 3.0000e+00
++8.7800e-01 +3.9800e-01 3.0000e+00
++8.8200e-01 +3.9800e-01 3.0000e+00
++8.7800e-01 +4.0200e-01 3.0000e+00
++8.8200e-01 +4.0200e-01 3.0000e+00
++8.9800e-01 +3.9800e-01 3.0000e+00
++9.0200e-01 +3.9800e-01 3.0000e+00
++8.9800e-01 +4.0200e-01 3.0000e+00
++9.0200e-01 +4.0200e-01 3.0000e+00
++9.1800e-01 +3.9800e-01 3.0000e+00
++9.2200e-01 +3.9800e-01 3.0000e+00
++9.1800e-01 +4.0200e-01 3.0000e+00
++9.2200e-01 +4.0200e-01 3.0000e+00
++9.3800e-01 +3.9800e-01 3.0000e+00
++9.4200e-01 +3.9800e-01 3.0000e+00
++9.3800e-01 +4.0200e-01 3.0000e+00
++9.4200e-01 +4.0200e-01 3.0000e+00
++9.5800e-01 +3.9800e-01 3.0000e+00
++9.6200e-01 +3.9800e-01 3.0000e+00
++9.5800e-01 +4.0200e-01 3.0000e+00
++9.6200e-01 +4.0200e-01 3.0000e+00
++9.7800e-01 +3.9800e-01 3.0000e+00
++9.8200e-01 +3.9800e-01 3.0000e+00
++9.7800e-01 +4.0200e-01 3.0000e+00
++9.8200e-01 +4.0200e-01 3.0000e+00
++9.9800e-01 +3.9800e-01 3.0000e+00
++1.0020e+00 +3.9800e-01 3.0000e+00
++9.9800e-01 +4.0200e-01 3.0000e+00
++1.0020e+00 +4.0200e-01 3.0000e+00
++1.8000e-02 +4.1800e-01 3.0000e+00
++2.2000e-02 +4.1800e-01 3.0000e+00
++1.8000e-02 +4.2200e-01 3.0000e+00
++2.2000e-02 +4.2200e-01 3.0000e+00
++3.8000e-02 +4.1800e-01 3.0000e+00
++4.2000e-02 +4.1800e-01 3.0000e+00
++3.8000e-02 +4.2200e-01 3.0000e+00
++4.2000e-02 +4.2200e-01 3.0000e+00
++5.8000e-02 +4.1800e-01 3.0000e+00
++6.2000e-02 +4.1800e-01 3.0000e+00
++5.8000e-02 +4.2200e-01 3.0000e+00
++6.2000e-02 +4.2200e-01 3.0000e+00
++7.8000e-02 +4.1800e-01 3.0000e+00
++8.2000e-02 +4.1800e-01 3.0000e+00
++7.8000e-02 +4.2200e-01 3.0000e+00
++8.2000e-02 +4.2200e-01 3.0000e+00
++9.8000e-02 +4.1800e-01 3.0000e+00
++1.0200e-01 +4.1800e-01 3.0000e+00
++9.8000e-02 +4.2200e-01 3.0000e+00
++1.0200e-01 +4.2200e-01 3.0000e+00
++1.1800e-01 +4.1800e-01 3.0000e+00
++1.2200e-01 +4.1800e-01 3.0000e+00
++1.1800e-01 +4.2200e-01 3.0000e+00
++1.2200e-01 +4.2200e-01 3.0000e+00
++1.3800e-01 +4.1800e-01 3.0000e+00
++1.4200e-01 +4.1800e-01 3.0000e+00
++1.3800e-01 +4.2200e-01 3.0000e+00
++1.4200e-01 +4.2200e-01 3.0000e+00
++1.5800e-01 +4.1800e-01 3.0000e+00
++1.6200e-01 +4.1800e-01 3.0000e+00
++1.5800e-01 +4.2200e-01 3.0000e+00
++1.6200e-01 +4.2200e-01 3.0000e+00
++1.7800e-01 +4.1800e-01 3.0000e+00
++1.8200e-01 +4.1800e-01 3.0000e+00
++1.7800e-01 +4.2200e-01 3.0000e+00
++1.8200e-01 +4.2200e-01 3.0000e+00
++1.9800e-01 +4.1800e-01 3.0000e+00
++2.0200e-01 +4.1800e-01 3.0000e+00
++1.9800e-01 +4.2200e-01 3.0000e+00
++2.0200e-01 +4.2200e-01 3.0000e+00
++2.1800e-01 +4.1800e-01 3.0000e+00
++2.2200e-01 +4.1800e-01 3.0000e+00
++2.1800e-01 +4.2200e-01 3.0000e+00
++2.2200e-01 +4.2200e-01 3.0000e+00
++2.3800e-01 +4.1800e-01 3.0000e+00
++2.4200e-01 +4.1800e-01 3.0000e+00
++2.3800e-01 +4.2200e-01 3.0000e+00
++2.4200e-01 +4.2200e-01 3.0000e+00
++2.5800e-01 +4.1800e-01 3.0000e+00
++2.6200e-01 +4.1800e-01 3.0000e+00
++2.5800e-01 +4.2200e-01 3.0000e+00
++2.6200e-01 +4.2200e-01 3.0000e+00
++2.7800e-01 +4.1800e-01 3.0000e+00
++2.8200e-01 +4.1800e-01 3.0000e+00
++2.7800e-01 +4.2200e-01 3.0000e+00
++2.8200e-01 +4.2200e-01 3.0000e+00
++2.9800e-01 +4.1800e-01 3.0000e+00
++3.0200e-01 +4.1800e-01 3.0000e+00
++2.9800e-01 +4.2200e-01 3.0000e+00
++3.0200e-01 +4.2200e-01 3.0000e+00
++3.1800e-01 +4.1800e-01 3.0000e+00
++3.2200e-01 +4.1800e-01 3.0000e+00
++3.1800e-01 +4.2200e-01 3.0000e+00
++3.2200e-01 +4.2200e-01 3.0000e+00
++3.3800e-01 +4.1800e-01 3.0000e+00
++3.4200e-01 +4.1800e-01 3.0000e+00
++3.3800e-01 +4.2200e-01 3.0000e+00
++3.4200e-01 +4.2200e-01 3.0000e+00
++3.5800e-01 +4.1800e-01 3.0000e+00
++3.6200e-01 +4.1800e-01 3.0000e+00
++3.5800e-01 +4.2200e-01 3.0000e+00
++3.6200e-01 +4.2200e-01 3.0000e+00
++3.7800e-01 +4.1800e-01 3.0000e+00
++3.8200e-01 +4.1800e-01 3.0000e+00
++3.7800e-01 +4.2200e-01 3.0000e+00
++3.8200e-01 +4.2200e-01 3.0000e+00
++3.9800e-01 +4.1800e-01 3.0000e+00
++4.0200e-01 +4.1800e-01 3.0000e+00
++3.9800e-01 +4.2200e-01 3.0000e+00
++4.0200e-01 +4.2200e-01 3.0000e+00
++4.1800e-01 +4.1800e-01 3.0000e+00
++4.2200e-01 +4.1800e-01 3.0000e+00
++4.1800e-01 +4.2200e-01 3.0000e+00
++4.2200e-01 +4.2200e-01 3.0000e+00
++4.3800e-01 +4.1800e-01 3.0000e+00
++4.4200e-01 +4.1800e-01 3.0000e+00
++4.3800e-01 +4.2200e-01 3.0000e+00
++4.4200e-01 +4.2200e-01 3.0000e+00
++4.5800e-01 +4.1800e-01 3.0000e+00
++4.6200e-01 +4.1800e-01 3.0000e+00
++4.5800e-01 +4.2200e-01 3.0000e+00
++4.6200e-01 +4.2200e-01 3.0000e+00
++4.7800e-01 +4.1800e-01 3.0000e+00
++4.8200e-01 +4.1800e-01 3.0000e+00
++4.7800e-01 +4.2200e-01 3.0000e+00
++4.8200e-01 +4.2200e-01 3.0000e+00
++4.9800e-01 +4.1800e-01 3.0000e+00
++5.0200e-01 +4.1800e-01 3.0000e+00
++4.9800e-01 +4.2200e-01 3.0000e+00
++5.0200e-01 +4.2200e-01 3.0000e+00
++5.1800e-01 +4.1800e-01 3.0000e+00
++5.2200e-01 +4.1800e-01 3.0000e+00
++5.1800e-01 +4.2200e-01 3.0000e+00
++5.2200e-01 +4.2200e-01 3.0000e+00
++5.3800e-01 +4.1800e-01 3.0000e+00
++5.4200e-01 +4.1800e-01 3.0000e+00
++5.3800e-01 +4.2200e-01 3.0000e+00
++5.4200e-01 +4.2200e-01 3.0000e+00
++5.5800e-01 +4.1800e-01 3.0000e+00
++5.6200e-01 +4.1800e-01 3.0000e+00
++5.5800e-01 +4.2200e-01 3.0000e+00
++5.6200e-01 +4.2200e-01 3.0000e+00
++5.7800e-01 +4.1800e-01 3.0000e+00
++5.8200e-01 +4.1800e-01 3.0000e+00
++5.7800e-01 +4.2200e-01 3.0000e+00
++5.8200e-01 +4.2200e-01 3.0000e+00
++5.9800e-01 +4.1800e-01 3.0000e+00
++6.0200e-01 +4.1800e-01 3.0000e+00
++5.9800e-01 +4.2200e-01 3.0000e+00
++6.0200e-01 +4.2200e-01 3.0000e+00
++6.1800e-01 +4.1800e-01 3.0000e+00
++6.2200e-01 +4.1800e-01 3.0000e+00
++6.1800e-01 +4.2200e-01 3.0000e+00
++6.2200e-01 +4.2200e-01 3.0000e+00
++6.3800e-01 +4.1800e-01 3.0000e+00
++6.4200e-01 +4.1800e-01 3.0000e+00
++6.3800e-01 +4.2200e-01 3.0000e+00
++6.4200e-01 +4.2200e-01 3.0000e+00
++6.5800e-01 +4.1800e-01 3.0000e+00
++6.6200e-01 +4.1800e-01 3.0000e+00
++6.5800e-01 +4.2200e-01 3.0000e+00
++6.6200e-01 +4.2200e-01 3.0000e+00
++6.7800e-01 +4.1800e-01 3.0000e+00
++6.8200e-01 +4.1800e-01 3.0000e+00
++6.7800e-01 +4.2200e-01 3.0000e+00
++6.8200e-01 +4.2200e-01 3.0000e+00
++6.9800e-01 +4.1800e-01 3.0000e+00
++7.0200e-01 +4.1800e-01 3.0000e+00
++6.9800e-01 +4.2200e-01 3.0000e+00
++7.0200e-01 +4.2200e-01 3.0000e+00
++7.1800e-01 +4.1800e-01 3.0000e+00
++7.2200e-01 +4.1800e-01 3.0000e+00
++7.1800e-01 +4.2200e-01 3.0000e+00
++7.2200e-01 +4.2200e-01 3.0000e+00
++7.3800e-01 +4.1800e-01 3.0000e+00
++7.4200e-01 +4.1800e-01 3.0000e+00
++7.3800e-01 +4.2200e-01 3.0000e+00
++7.4200e-01 +4.2200e-01 3.0000e+00
++7.5800e-01 +4.1800e-01 3.0000e+00
++7.6200e-01 +4.1800e-01 3.0000e+00
++7.5800e-01 +4.2200e-01 3.0000e+00
++7.6200e-01 +4.2200e-01 3.0000e+00
++7.7800e-01 +4.1800e-01 3.0000e+00
++7.8200e-01 +4.1800e-01 3.0000e+00
++7.7800e-01 +4.2200e-01 3.0000e+00
++7.8200e-01 +4.2200e-01 3.0000e+00
++7.9800e-01 +4.1800e-01 3.0000e+00
++8.0200e-01 +4.1800e-01 3.0000e+00
++7.9800e-01 +4.2200e-01 3.0000e+00
++8.0200e-01 +4.2200e-01 3.0000e+00
++8.1800e-01 +4.1800e-01 3.0000e+00
++8.2200e-01 +4.1800e-01 3.0000e+00
++8.1800e-01 +4.2200e-01 3.0000e+00
++8.2200e-01 +4.2200e-01 3.0000e+00
++8.3800e-01 +4.1800e-01 3.0000e+00
++8.4200e-01 +4.1800e-01 3.0000e+00
++8.3800e-01 +4.2200e-01 3.0000e+00
++8.4200e-01 +4.2200e-01 3.0000e+00
++8.5800e-01 +4.1800e-01 3.0000e+00
++8.6200e-01 +4.1800e-01 3.0000e+00
++8.5800e-01 +4.2200e-01 3.0000e+00
++8.6200e-01 +4.2200e-01 3.0000e+00
++8.7800e-01 +4.1800e-01 3.0000e+00
++8.8200e-01 +4.1800e-01 3.0000e+00
++8.7800e-01 +4.2200e-01 3.0000e+00
++8.8200e-01 +4.2200e-01 3.0000e+00
++8.9800e-01 +4.1800e-01 3.0000e+00
++9.0200e-01 +4.1800e-01 3.0000e+00
++8.9800e-01 +4.2200e-01 3.0000e+00
++9.0200e-01 +4.2200e-01 3.0000e+00
++9.1800e-01 +4.1800e-01 3.0000e+00
++9.2200e-01 +4.1800e-01 3.0000e+00
++9.1800e-01 +4.2200e-01 3.0000e+00
++9.2200e-01 +4.2200e-01 3.0000e+00
++9.3800e-01 +4.1800e-01 3.0000e+00
++9.4200e-01 +4.1800e-01 3.0000e+00
++9.3800e-01 +4.2200e-01 3.0000e+00
++9.4200e-01 +4.2200e-01 3.0000e+00
++9.5800e-01 +4.1800e-01 3.0000e+00
++9.6200e-01 +4.1800e-01 3.0000e+00
++9.5800e-01 +4.2200e-01 3.0000e+00
++9.6200e-01 +4.2200e-01 3.0000e+00
++9.7800e-01 +4.1800e-01 3.0000e+00
++9.8200e-01 +4.1800e-01 3.0000e+00
++9.7800e-01 +4.2200e-01 3.0000e+00
++9.8200e-01 +4.2200e-01 3.0000e+00
++9.9800e-01 +4.1800e-01 3.0000e+00
++1.0020e+00 +4.1800e-01 3.0000e+00
++9.9800e-01 +4.2200e-01 3.0000e+00
++1.0020e+00 +4.2200e-01 3.0000e+00
++1.8000e-02 +4.3800e-01 3.0000e+00
++2.2000e-02 +4.3800e-01 3.0000e+00
++1.8000e-02 +4.4200e-01 3.0000e+00
++2.2000e-02 +4.4200e-01 3.0000e+00
++3.8000e-02 +4.3800e-01 3.0000e+00
++4.2000e-02 +4.3800e-01 3.0000e+00
++3.8000e-02 +4.4200e-01 3.0000e+00
++4.2000e-02 +4.4200e-01 3.0000e+00
++5.8000e-02 +4.3800e-01 3.0000e+00
++6.2000e-02 +4.3800e-01 3.0000e+00
++5.8000e-02 +4.4200e-01 3.0000e+00
++6.2000e-02 +4.4200e-01 3.0000e+00
++7.8000e-02 +4.3800e-01 3.0000e+00
++8.2000e-02 +4.3800e-01 3.0000e+00
++7.8000e-02 +4.4200e-01 3.0000e+00
++8.2000e-02 +4.4200e-01 3.0000e+00
++9.8000e-02 +4.3800e-01 3.0000e+00
++1.0200e-01 +4.3800e-01 3.0000e+00
++9.8000e-02 +4.4200e-01 3.0000e+00
++1.0200e-01 +4.4200e-01 3.0000e+00
++1.1800e-01 +4.3800e-01 3.0000e+00
++1.2200e-01 +4.3800e-01 3.0000e+00
++1.1800e-01 +4.4200e-01 3.0000e+00
++1.2200e-01 +4.4200e-01 3.0000e+00
++1.3800e-01 +4.3800e-01 3.0000e+00
++1.4200e-01 +4.3800e-01 3.0000e+00
++1.3800e-01 +4.4200e-01 3.0000e+00
++1.4200e-01 +4.4200e-01 3.0000e+00
++1.5800e-01 +4.3800e-01 3.0000e+00
++1.6200e-01 +4.3800e-01 3.0000e+00
++1.5800e-01 +4.4200e-01 3.0000e+00
++1.6200e-01 +4.4200e-01 3.0000e+00
++1.7800e-01 +4.3800e-01 3.0000e+00
++1.8200e-01 +4.3800e-01 3.0000e+00
++1.7800e-01 +4.4200e-01 3.0000e+00
++1.8200e-01 +4.4200e-01 3.0000e+00
++1.9800e-01 +4.3800e-01 3.0000e+00
++2.0200e-01 +4.3800e-01 3.0000e+00
++1.9800e-01 +4.4200e-01 3.0000e+00
++2.0200e-01 +4.4200e-01 3.0000e+00
++2.1800e-01 +4.3800e-01 3.0000e+00
++2.2200e-01 +4.3800e-01 3.0000e+00
++2.1800e-01 +4.4200e-01 3.0000e+00
++2.2200e-01 +4.4200e-01 3.0000e+00
++2.3800e-01 +4.3800e-01 3.0000e+00
++2.4200e-01 +4.3800e-01 3.0000e+00
++2.3800e-01 +4.4200e-01 3.0000e+00
++2.4200e-01 +4.4200e-01 3.0000e+00
++2.5800e-01 +4.3800e-01 3.0000e+00
++2.6200e-01 +4.3800e-01 3.0000e+00
++2.5800e-01 +4.4200e-01 3.0000e+00
++2.6200e-01 +4.4200e-01 3.0000e+00
++2.7800e-01 +4.3800e-01 3.0000e+00
++2.8200e-01 +4.3800e-01 3.0000e+00
++2.7800e-01 +4.4200e-01 3.0000e+00
++2.8200e-01 +4.4200e-01 3.0000e+00
++2.9800e-01 +4.3800e-01 3.0000e+00
++3.0200e-01 +4.3800e-01 3.0000e+00
++2.9800e-01 +4.4200e-01 3.0000e+00
++3.0200e-01 +4.4200e-01 3.0000e+00
++3.1800e-01 +4.3800e-01 3.0000e+00
++3.2200e-01 +4.3800e-01 3.0000e+00
++3.1800e-01 +4.4200e-01 3.0000e+00
++3.2200e-01 +4.4200e-01 3.0000e+00
++3.3800e-01 +4.3800e-01 3.0000e+00
++3.4200e-01 +4.3800e-01 3.0000e+00
++3.3800e-01 +4.4200e-01 3.0000e+00
++3.4200e-01 +4.4200e-01 3.0000e+00
++3.5800e-01 +4.3800e-01 3.0000e+00
++3.6200e-01 +4.3800e-01 3.0000e+00
++3.5800e-01 +4.4200e-01 3.0000e+00
++3.6200e-01 +4.4200e-01 3.0000e+00
++3.7800e-01 +4.3800e-01 3.0000e+00
++3.8200e-01 +4.3800e-01 3.0000e+00
++3.7800e-01 +4.4200e-01 3.0000e+00
++3.8200e-01 +4.4200e-01 3.0000e+00
++3.9800e-01 +4.3800e-01 3.0000e+00
++4.0200e-01 +4.3800e-01 3.0000e+00
++3.9800e-01 +4.4200e-01 3.0000e+00
++4.0200e-01 +4.4200e-01 3.0000e+00
++4.1800e-01 +4.3800e-01 3.0000e+00
++4.2200e-01 +4.3800e-01 3.0000e+00
++4.1800e-01 +4.4200e-01 3.0000e+00
++4.2200e-01 +4.4200e-01 3.0000e+00
++4.3800e-01 +4.3800e-01 3.0000e+00
++4.4200e-01 +4.3800e-01 3.0000e+00
++4.3800e-01 +4.4200e-01 3.0000e+00
++4.4200e-01 +4.4200e-01 3.0000e+00
++4.5800e-01 +4.3800e-01 3.0000e+00
++4.6200e-01 +4.3800e-01 3.0000e+00
++4.5800e-01 +4.4200e-01 3.0000e+00
++4.6200e-01 +4.4200e-01 3.0000e+00
++4.7800e-01 +4.3800e-01 3.0000e+00
++4.8200e-01 +4.3800e-01 3.0000e+00
++4.7800e-01 +4.4200e-01 3.0000e+00
++4.8200e-01 +4.4200e-01 3.0000e+00
++4.9800e-01 +4.3800e-01 3.0000e+00
++5.0200e-01 +4.3800e-01 3.0000e+00
++4.9800e-01 +4.4200e-01 3.0000e+00
++5.0200e-01 +4.4200e-01 3.0000e+00
++5.1800e-01 +4.3800e-01 3.0000e+00
++5.2200e-01 +4.3800e-01 3.0000e+00
++5.1800e-01 +4.4200e-01 3.0000e+00
++5.2200e-01 +4.4200e-01 3.0000e+00
++5.3800e-01 +4.3800e-01 3.0000e+00
++5.4200e-01 +4.3800e-01 3.0000e+00
++5.3800e-01 +4.4200e-01 3.0000e+00
++5.4200e-01 +4.4200e-01 3.0000e+00
++5.5800e-01 +4.3800e-01 3.0000e+00
++5.6200e-01 +4.3800e-01 3.0000e+00
++5.5800e-01 +4.4200e-01 3.0000e+00
++5.6200e-01 +4.4200e-01 3.0000e+00
++5.7800e-01 +4.3800e-01 3.0000e+00
++5.8200e-01 +4.3800e-01 3.0000e+00
++5.7800e-01 +4.4200e-01 3.0000e+00
++5.8200e-01 +4.4200e-01 3.0000e+00
++5.9800e-01 +4.3800e-01 3.0000e+00
++6.0200e-01 +4.3800e-01 3.0000e+00
++5.9800e-01 +4.4200e-01 3.0000e+00
++6.0200e-01 +4.4200e-01 3.0000e+00
++6.1800e-01 +4.3800e-01 3.0000e+00
++6.2200e-01 +4.3800e-01 3.0000e+00
++6.1800e-01 +4.4200e-01 3.0000e+00
++6.2200e-01 +4.4200e-01 3.0000e+00
++6.3800e-01 +4.3800e-01 3.0000e+00
++6.4200e-01 +4.3800e-01 3.0000e+00
++6.3800e-01 +4.4200e-01 3.0000e+00
++6.4200e-01 +4.4200e-01 3.0000e+00
++6.5800e-01 +4.3800e-01 3.0000e+00
++6.6200e-01 +4.3800e-01 3.0000e+00
++6.5800e-01 +4.4200e-01 3.0000e+00
++6.6200e-01 +4.4200e-01 3.0000e+00
++6.7800e-01 +4.3800e-01 3.0000e+00
++6.8200e-01 +4.3800e-01 3.0000e+00
++6.7800e-01 +4.4200e-01 3.0000e+00
++6.8200e-01 +4.4200e-01 3.0000e+00
++6.9800e-01 +4.3800e-01 3.0000e+00
++7.0200e-01 +4.3800e-01 3.0000e+00
++6.9800e-01 +4.4200e-01 3.0000e+00
++7.0200e-01 +4.4200e-01 3.0000e+00
++7.1800e-01 +4.3800e-01 3.0000e+00
++7.2200e-01 +4.3800e-01 3.0000e+00
++7.1800e-01 +4.4200e-01 3.0000e+00
++7.2200e-01 +4.4200e-01 3.0000e+00
++7.3800e-01 +4.3800e-01 3.0000e+00
++7.4200e-01 +4.3800e-01 3.0000e+00
++7.3800e-01 +4.4200e-01 3.0000e+00
++7.4200e-01 +4.4200e-01 3.0000e+00
++7.5800e-01 +4.3800e-01 3.0000e+00
++7.6200e-01 +4.3800e-01 3.0000e+00
++7.5800e-01 +4.4200e-01 3.0000e+00
++7.6200e-01 +4.4200e-01 3.0000e+00
++7.7800e-01 +4.3800e-01 3.0000e+00
++7.8200e-01 +4.3800e-01 3.0000e+00
++7.7800e-01 +4.4200e-01 3.0000e+00
++7.8200e-01 +4.4200e-01 3.0000e+00
++7.9800e-01 +4.3800e-01 3.0000e+00
++8.0200e-01 +4.3800e-01 3.0000e+00
++7.9800e-01 +4.4200e-01 3.0000e+00
++8.0200e-01 +4.4200e-01 3.0000e+00
++8.1800e-01 +4.3800e-01 3.0000e+00
++8.2200e-01 +4.3800e-01 3.0000e+00
++8.1800e-01 +4.4200e-01 3.0000e+00
++8.2200e-01 +4.4200e-01 3.0000e+00
++8.3800e-01 +4.3800e-01 3.0000e+00
++8.4200e-01 +4.3800e-01 3.0000e+00
++8.3800e-01 +4.4200e-01 3.0000e+00
++8.4200e-01 +4.4200e-01 3.0000e+00
++8.5800e-01 +4.3800e-01 3.0000e+00
++8.6200e-01 +4.3800e-01 3.0000e+00
++8.5800e-01 +4.4200e-01 3.0000e+00
++8.6200e-01 +4.4200e-01 3.0000e+00
++8.7800e-01 +4.3800e-01 3.0000e+00
++8.8200e-01 +4.3800e-01 3.0000e+00
++8.7800e-01 +4.4200e-01 3.0000e+00
++8.8200e-01 +4.4200e-01 3.0000e+00
++8.9800e-01 +4.3800e-01 3.0000e+00
++9.0200e-01 +4.3800e-01 3.0000e+00
++8.9800e-01 +4.4200e-01 3.0000e+00
++9.0200e-01 +4.4200e-01 3.0000e+00
++9.1800e-01 +4.3800e-01 3.0000e+00
++9.2200e-01 +4.3800e-01 3.0000e+00
++9.1800e-01 +4.4200e-01 3.0000e+00
++9.2200e-01 +4.4200e-01 3.0000e+00
++9.3800e-01 +4.3800e-01 3.0000e+00
++9.4200e-01 +4.3800e-01 3.0000e+00
++9.3800e-01 +4.4200e-01 3.0000e+00
++9.4200e-01 +4.4200e-01 3.0000e+00
++9.5800e-01 +4.3800e-01 3.0000e+00
++9.6200e-01 +4.3800e-01 3.0000e+00
++9.5800e-01 +4.4200e-01 3.0000e+00
++9.6200e-01 +4.4200e-01 3.0000e+00
++9.7800e-01 +4.3800e-01 3.0000e+00
++9.8200e-01 +4.3800e-01 3.0000e+00
++9.7800e-01 +4.4200e-01 3.0000e+00
++9.8200e-01 +4.4200e-01 3.0000e+00
++9.9800e-01 +4.3800e-01 3.0000e+00
++1.0020e+00 +4.3800e-01 3.0000e+00
++9.9800e-01 +4.4200e-01 3.0000e+00
++1.0020e+00 +4.4200e-01 3.0000e+00
++1.8000e-02 +4.5800e-01 3.0000e+00
++2.2000e-02 +4.5800e-01 3.0000e+00
++1.8000e-02 +4.6200e-01 3.0000e+00
++2.2000e-02 +4.6200e-01 3.0000e+00
++3.8000e-02 +4.5800e-01 3.0000e+00
++4.2000e-02 +4.5800e-01 3.0000e+00
++3.8000e-02 +4.6200e-01 3.0000e+00
++4.2000e-02 +4.6200e-01 3.0000e+00
++5.8000e-02 +4.5800e-01 3.0000e+00
++6.2000e-02 +4.5800e-01 3.0000e+00
++5.8000e-02 +4.6200e-01 3.0000e+00
++6.2000e-02 +4.6200e-01 3.0000e+00
++7.8000e-02 +4.5800e-01 3.0000e+00
++8.2000e-02 +4.5800e-01 3.0000e+00
++7.8000e-02 +4.6200e-01 3.0000e+00
++8.2000e-02 +4.6200e-01 3.0000e+00
++9.8000e-02 +4.5800e-01 3.0000e+00
++1.0200e-01 +4.5800e-01 3.0000e+00
++9.8000e-02 +4.6200e-01 3.0000e+00
++1.0200e-01 +4.6200e-01 3.0000e+00
++1.1800e-01 +4.5800e-01 3.0000e+00
++1.2200e-01 +4.5800e-01 3.0000e+00
++1.1800e-01 +4.6200e-01 3.0000e+00
++1.2200e-01 +4.6200e-01 3.0000e+00
++1.3800e-01 +4.5800e-01 3.0000e+00
++1.4200e-01 +4.5800e-01 3.0000e+00
++1.3800e-01 +4.6200e-01 3.0000e+00
++1.4200e-01 +4.6200e-01 3.0000e+00
++1.5800e-01 +4.5800e-01 3.0000e+00
++1.6200e-01 +4.5800e-01 3.0000e+00
++1.5800e-01 +4.6200e-01 3.0000e+00
++1.6200e-01 +4.6200e-01 3.0000e+00
++1.7800e-01 +4.5800e-01 3.0000e+00
++1.8200e-01 +4.5800e-01 3.0000e+00
++1.7800e-01 +4.6200e-01 3.0000e+00
++1.8200e-01 +4.6200e-01 3.0000e+00
++1.9800e-01 +4.5800e-01 3.0000e+00
++2.0200e-01 +4.5800e-01 3.0000e+00
++1.9800e-01 +4.6200e-01 3.0000e+00
++2.0200e-01 +4.6200e-01 3.0000e+00
++2.1800e-01 +4.5800e-01 3.0000e+00
++2.2200e-01 +4.5800e-01 3.0000e+00
++2.1800e-01 +4.6200e-01 3.0000e+00
++2.2200e-01 +4.6200e-01 3.0000e+00
++2.3800e-01 +4.5800e-01 3.0000e+00
++2.4200e-01 +4.5800e-01 3.0000e+00
++2.3800e-01 +4.6200e-01 3.0000e+00
++2.4200e-01 +4.6200e-01 3.0000e+00
++2.5800e-01 +4.5800e-01 3.0000e+00
++2.6200e-01 +4.5800e-01 3.0000e+00
++2.5800e-01 +4.6200e-01 3.0000e+00
++2.6200e-01 +4.6200e-01 3.0000e+00
++2.7800e-01 +4.5800e-01 3.0000e+00
++2.8200e-01 +4.5800e-01 3.0000e+00
++2.7800e-01 +4.6200e-01 3.0000e+00
++2.8200e-01 +4.6200e-01 3.0000e+00
++2.9800e-01 +4.5800e-01 3.0000e+00
++3.0200e-01 +4.5800e-01 3.0000e+00
++2.9800e-01 +4.6200e-01 3.0000e+00
++3.0200e-01 +4.6200e-01 3.0000e+00
++3.1800e-01 +4.5800e-01 3.0000e+00
++3.2200e-01 +4.5800e-01 3.0000e+00
++3.1800e-01 +4.6200e-01 3.0000e+00
++3.2200e-01 +4.6200e-01 3.0000e+00
++3.3800e-01 +4.5800e-01 3.0000e+00
++3.4200e-01 +4.5800e-01 3.0000e+00
++3.3800e-01 +4.6200e-01 3.0000e+00
++3.4200e-01 +4.6200e-01 3.0000e+00
++3.5800e-01 +4.5800e-01 3.0000e+00
++3.6200e-01 +4.5800e-01 3.0000e+00
++3.5800e-01 +4.6200e-01 3.0000e+00
++3.6200e-01 +4.6200e-01 3.0000e+00
++3.7800e-01 +4.5800e-01 3.0000e+00
++3.8200e-01 +4.5800e-01 3.0000e+00
++3.7800e-01 +4.6200e-01 3.0000e+00
++3.8200e-01 +4.6200e-01 3.0000e+00
++3.9800e-01 +4.5800e-01 3.0000e+00
++4.0200e-01 +4.5800e-01 3.0000e+00
++3.9800e-01 +4.6200e-01 3.0000e+00
++4.0200e-01 +4.6200e-01 3.0000e+00
++4.1800e-01 +4.5800e-01 3.0000e+00
++4.2200e-01 +4.5800e-01 3.0000e+00
++4.1800e-01 +4.6200e-01 3.0000e+00
++4.2200e-01 +4.6200e-01 3.0000e+00
++4.3800e-01 +4.5800e-01 3.0000e+00
++4.4200e-01 +4.5800e-01 3.0000e+00
++4.3800e-01 +4.6200e-01 3.0000e+00
++4.4200e-01 +4.6200e-01 3.0000e+00
++4.5800e-01 +4.5800e-01 3.0000e+00
++4.6200e-01 +4.5800e-01 3.0000e+00
++4.5800e-01 +4.6200e-01 3.0000e+00
++4.6200e-01 +4.6200e-01 3.0000e+00
++4.7800e-01 +4.5800e-01 3.0000e+00
++4.8200e-01 +4.5800e-01 3.0000e+00
++4.7800e-01 +4.6200e-01 3.0000e+00
++4.8200e-01 +4.6200e-01 3.0000e+00
++4.9800e-01 +4.5800e-01 3.0000e+00
++5.0200e-01 +4.5800e-01 3.0000e+00
++4.9800e-01 +4.6200e-01 3.0000e+00
++5.0200e-01 +4.6200e-01 3.0000e+00
++5.1800e-01 +4.5800e-01 3.0000e+00
++5.2200e-01 +4.5800e-01 3.0000e+00
++5.1800e-01 +4.6200e-01 3.0000e+00
++5.2200e-01 +4.6200e-01 3.0000e+00
++5.3800e-01 +4.5800e-01 3.0000e+00
++5.4200e-01 +4.5800e-01 3.0000e+00
++5.3800e-01 +4.6200e-01 3.0000e+00
++5.4200e-01 +4.6200e-01 3.0000e+00
++5.5800e-01 +4.5800e-01 3.0000e+00
++5.6200e-01 +4.5800e-01 3.0000e+00
++5.5800e-01 +4.6200e-01 3.0000e+00
++5.6200e-01 +4.6200e-01 3.0000e+00
++5.7800e-01 +4.5800e-01 3.0000e+00
++5.8200e-01 +4.5800e-01 3.0000e+00
++5.7800e-01 +4.6200e-01 3.0000e+00
++5.8200e-01 +4.6200e-01 3.0000e+00
++5.9800e-01 +4.5800e-01 3.0000e+00
++6.0200e-01 +4.5800e-01 3.0000e+00
++5.9800e-01 +4.6200e-01 3.0000e+00
++6.0200e-01 +4.6200e-01 3.0000e+00
++6.1800e-01 +4.5800e-01 3.0000e+00
++6.2200e-01 +4.5800e-01 3.0000e+00
++6.1800e-01 +4.6200e-01 3.0000e+00
++6.2200e-01 +4.6200e-01 3.0000e+00
++6.3800e-01 +4.5800e-01 3.0000e+00
++6.4200e-01 +4.5800e-01 3.0000e+00
++6.3800e-01 +4.6200e-01 3.0000e+00
++6.4200e-01 +4.6200e-01 3.0000e+00
++6.5800e-01 +4.5800e-01 3.0000e+00
++6.6200e-01 +4.5800e-01 3.0000e+00
++6.5800e-01 +4.6200e-01 3.0000e+00
++6.6200e-01 +4.6200e-01 3.0000e+00
++6.7800e-01 +4.5800e-01 3.0000e+00
++6.8200e-01 +4.5800e-01 3.0000e+00
++6.7800e-01 +4.6200e-01 3.0000e+00
++6.8200e-01 +4.6200e-01 3.0000e+00
++6.9800e-01 +4.5800e-01 3.0000e+00
++7.0200e-01 +4.5800e-01 3.0000e+00
++6.9800e-01 +4.6200e-01 3.0000e+00
++7.0200e-01 +4.6200e-01 3.0000e+00
++7.1800e-01 +4.5800e-01 3.0000e+00
++7.2200e-01 +4.5800e-01 3.0000e+00
++7.1800e-01 +4.6200e-01 3.0000e+00
++7.2200e-01 +4.6200e-01 3.0000e+00
++7.3800e-01 +4.5800e-01 3.0000e+00
++7.4200e-01 +4.5800e-01 3.0000e+00
++7.3800e-01 +4.6200e-01 3.0000e+00
++7.4200e-01 +4.6200e-01 3.0000e+00
++7.5800e-01 +4.5800e-01 3.0000e+00
++7.6200e-01 +4.5800e-01 3.0000e+00
++7.5800e-01 +4.6200e-01 3.0000e+00
++7.6200e-01 +4.6200e-01 3.0000e+00
++7.7800e-01 +4.5800e-01 3.0000e+00
++7.8200e-01 +4.5800e-01 3.0000e+00
++7.7800e-01 +4.6200e-01 3.0000e+00
++7.8200e-01 +4.6200e-01 3.0000e+00
++7.9800e-01 +4.5800e-01 3.0000e+00
++8.0200e-01 +4.5800e-01 3.0000e+00
++7.9800e-01 +4.6200e-01 3.0000e+00
++8.0200e-01 +4.6200e-01 3.0000e+00
++8.1800e-01 +4.5800e-01 3.0000e+00
++8.2200e-01 +4.5800e-01 3.0000e+00
++8.1800e-01 +4.6200e-01 3.0000e+00
++8.2200e-01 +4.6200e-01 3.0000e+00
++8.3800e-01 +4.5800e-01 3.0000e+00
++8.4200e-01 +4.5800e-01 3.0000e+00
++8.3800e-01 +4.6200e-01 3.0000e+00
++8.4200e-01 +4.6200e-01 3.0000e+00
++8.5800e-01 +4.5800e-01 3.0000e+00
++8.6200e-01 +4.5800e-01 3.0000e+00
++8.5800e-01 +4.6200e-01 3.0000e+00
++8.6200e-01 +4.6200e-01 3.0000e+00
++8.7800e-01 +4.5800e-01 3.0000e+00
++8.8200e-01 +4.5800e-01 3.0000e+00
++8.7800e-01 +4.6200e-01 3.0000e+00
++8.8200e-01 +4.6200e-01 3.0000e+00
++8.9800e-01 +4.5800e-01 3.0000e+00
++9.0200e-01 +4.5800e-01 3.0000e+00
++8.9800e-01 +4.6200e-01 3.0000e+00
++9.0200e-01 +4.6200e-01 3.0000e+00
++9.1800e-01 +4.5800e-01 3.0000e+00
++9.2200e-01 +4.5800e-01 3.0000e+00
++9.1800e-01 +4.6200e-01 3.0000e+00
++9.2200e-01 +4.6200e-01 3.0000e+00
++9.3800e-01 +4.5800e-01 3.0000e+00
++9.4200e-01 +4.5800e-01 3.0000e+00
++9.3800e-01 +4.6200e-01 3.0000e+00
++9.4200e-01 +4.6200e-01 3.0000e+00
++9.5800e-01 +4.5800e-01 3.0000e+00
++9.6200e-01 +4.5800e-01 3.0000e+00
++9.5800e-01 +4.6200e-01 3.0000e+00
++9.6200e-01 +4.6200e-01 3.0000e+00
++9.7800e-01 +4.5800e-01 3.0000e+00
++9.8200e-01 +4.5800e-01 3.0000e+00
++9.7800e-01 +4.6200e-01 3.0000e+00
++9.8200e-01 +4.6200e-01 3.0000e+00
++9.9800e-01 +4.5800e-01 3.0000e+00
++1.0020e+00 +4.5800e-01 3.0000e+00
++9.9800e-01 +4.6200e-01 3.0000e+00
++1.0020e+00 +4.6200e-01 3.0000e+00
++1.8000e-02 +4.7800e-01 3.0000e+00
++2.2000e-02 +4.7800e-01 3.0000e+00
++1.8000e-02 +4.8200e-01 3.0000e+00
++2.2000e-02 +4.8200e-01 3.0000e+00
++3.8000e-02 +4.7800e-01 3.0000e+00
++4.2000e-02 +4.7800e-01 3.0000e+00
++3.8000e-02 +4.8200e-01 3.0000e+00
++4.2000e-02 +4.8200e-01 3.0000e+00
++5.8000e-02 +4.7800e-01 3.0000e+00
++6.2000e-02 +4.7800e-01 3.0000e+00
++5.8000e-02 +4.8200e-01 3.0000e+00
++6.2000e-02 +4.8200e-01 3.0000e+00
++7.8000e-02 +4.7800e-01 3.0000e+00
++8.2000e-02 +4.7800e-01 3.0000e+00
++7.8000e-02 +4.8200e-01 3.0000e+00
++8.2000e-02 +4.8200e-01 3.0000e+00
++9.8000e-02 +4.7800e-01 3.0000e+00
++1.0200e-01 +4.7800e-01 3.0000e+00
++9.8000e-02 +4.8200e-01 3.0000e+00
++1.0200e-01 +4.8200e-01 3.0000e+00
++1.1800e-01 +4.7800e-01 3.0000e+00
++1.2200e-01 +4.7800e-01 3.0000e+00
++1.1800e-01 +4.8200e-01 3.0000e+00
++1.2200e-01 +4.8200e-01 3.0000e+00
++1.3800e-01 +4.7800e-01 3.0000e+00
++1.4200e-01 +4.7800e-01 3.0000e+00
++1.3800e-01 +4.8200e-01 3.0000e+00
++1.4200e-01 +4.8200e-01 3.0000e+00
++1.5800e-01 +4.7800e-01 3.0000e+00
++1.6200e-01 +4.7800e-01 3.0000e+00
++1.5800e-01 +4.8200e-01 3.0000e+00
++1.6200e-01 +4.8200e-01 3.0000e+00
++1.7800e-01 +4.7800e-01 3.0000e+00
++1.8200e-01 +4.7800e-01 3.0000e+00
++1.7800e-01 +4.8200e-01 3.0000e+00
++1.8200e-01 +4.8200e-01 3.0000e+00
++1.9800e-01 +4.7800e-01 3.0000e+00
++2.0200e-01 +4.7800e-01 3.0000e+00
++1.9800e-01 +4.8200e-01 3.0000e+00
++2.0200e-01 +4.8200e-01 3.0000e+00
++2.1800e-01 +4.7800e-01 3.0000e+00
++2.2200e-01 +4.7800e-01 3.0000e+00
++2.1800e-01 +4.8200e-01 3.0000e+00
++2.2200e-01 +4.8200e-01 3.0000e+00
++2.3800e-01 +4.7800e-01 3.0000e+00
++2.4200e-01 +4.7800e-01 3.0000e+00
++2.3800e-01 +4.8200e-01 3.0000e+00
++2.4200e-01 +4.8200e-01 3.0000e+00
++2.5800e-01 +4.7800e-01 3.0000e+00
++2.6200e-01 +4.7800e-01 3.0000e+00
++2.5800e-01 +4.8200e-01 3.0000e+00
++2.6200e-01 +4.8200e-01 3.0000e+00
++2.7800e-01 +4.7800e-01 3.0000e+00
++2.8200e-01 +4.7800e-01 3.0000e+00
++2.7800e-01 +4.8200e-01 3.0000e+00
++2.8200e-01 +4.8200e-01 3.0000e+00
++2.9800e-01 +4.7800e-01 3.0000e+00
++3.0200e-01 +4.7800e-01 3.0000e+00
++2.9800e-01 +4.8200e-01 3.0000e+00
++3.0200e-01 +4.8200e-01 3.0000e+00
++3.1800e-01 +4.7800e-01 3.0000e+00
++3.2200e-01 +4.7800e-01 3.0000e+00
++3.1800e-01 +4.8200e-01 3.0000e+00
++3.2200e-01 +4.8200e-01 3.0000e+00
++3.3800e-01 +4.7800e-01 3.0000e+00
++3.4200e-01 +4.7800e-01 3.0000e+00
++3.3800e-01 +4.8200e-01 3.0000e+00
++3.4200e-01 +4.8200e-01 3.0000e+00
++3.5800e-01 +4.7800e-01 3.0000e+00
++3.6200e-01 +4.7800e-01 3.0000e+00
++3.5800e-01 +4.8200e-01 3.0000e+00
++3.6200e-01 +4.8200e-01 3.0000e+00
++3.7800e-01 +4.7800e-01 3.0000e+00
++3.8200e-01 +4.7800e-01 3.0000e+00
++3.7800e-01 +4.8200e-01 3.0000e+00
++3.8200e-01 +4.8200e-01 3.0000e+00
++3.9800e-01 +4.7800e-01 3.0000e+00
++4.0200e-01 +4.7800e-01 3.0000e+00
++3.9800e-01 +4.8200e-01 3.0000e+00
++4.0200e-01 +4.8200e-01 3.0000e+00
++4.1800e-01 +4.7800e-01 3.0000e+00
++4.2200e-01 +4.7800e-01 3.0000e+00
++4.1800e-01 +4.8200e-01 3.0000e+00
++4.2200e-01 +4.8200e-01 3.0000e+00
++4.3800e-01 +4.7800e-01 3.0000e+00
++4.4200e-01 +4.7800e-01 3.0000e+00
++4.3800e-01 +4.8200e-01 3.0000e+00
++4.4200e-01 +4.8200e-01 3.0000e+00
++4.5800e-01 +4.7800e-01 3.0000e+00
++4.6200e-01 +4.7800e-01 3.0000e+00
++4.5800e-01 +4.8200e-01 3.0000e+00
++4.6200e-01 +4.8200e-01 3.0000e+00
++4.7800e-01 +4.7800e-01 3.0000e+00
++4.8200e-01 +4.7800e-01 3.0000e+00
++4.7800e-01 +4.8200e-01 3.0000e+00
++4.8200e-01 +4.8200e-01 3.0000e+00
++4.9800e-01 +4.7800e-01 3.0000e+00
++5.0200e-01 +4.7800e-01 3.0000e+00
++4.9800e-01 +4.8200e-01 3.0000e+00
++5.0200e-01 +4.8200e-01 3.0000e+00
++5.1800e-01 +4.7800e-01 3.0000e+00
++5.2200e-01 +4.7800e-01 3.0000e+00
++5.1800e-01 +4.8200e-01 3.0000e+00
++5.2200e-01 +4.8200e-01 3.0000e+00
++5.3800e-01 +4.7800e-01 3.0000e+00
++5.4200e-01 +4.7800e-01 3.0000e+00
++5.3800e-01 +4.8200e-01 3.0000e+00
++5.4200e-01 +4.8200e-01 3.0000e+00
++5.5800e-01 +4.7800e-01 3.0000e+00
++5.6200e-01 +4.7800e-01 3.0000e+00
++5.5800e-01 +4.8200e-01 3.0000e+00
++5.6200e-01 +4.8200e-01 3.0000e+00
++5.7800e-01 +4.7800e-01 3.0000e+00
++5.8200e-01 +4.7800e-01 3.0000e+00
++5.7800e-01 +4.8200e-01 3.0000e+00
++5.8200e-01 +4.8200e-01 3.0000e+00
++5.9800e-01 +4.7800e-01 3.0000e+00
++6.0200e-01 +4.7800e-01 3.0000e+00
++5.9800e-01 +4.8200e-01 3.0000e+00
++6.0200e-01 +4.8200e-01 3.0000e+00
++6.1800e-01 +4.7800e-01 3.0000e+00
++6.2200e-01 +4.7800e-01 3.0000e+00
++6.1800e-01 +4.8200e-01 3.0000e+00
++6.2200e-01 +4.8200e-01 3.0000e+00
++6.3800e-01 +4.7800e-01 3.0000e+00
++6.4200e-01 +4.7800e-01 3.0000e+00
++6.3800e-01 +4.8200e-01 3.0000e+00
++6.4200e-01 +4.8200e-01 3.0000e+00
++6.5800e-01 +4.7800e-01 3.0000e+00
++6.6200e-01 +4.7800e-01 3.0000e+00
++6.5800e-01 +4.8200e-01 3.0000e+00
++6.6200e-01 +4.8200e-01 3.0000e+00
++6.7800e-01 +4.7800e-01 3.0000e+00
++6.8200e-01 +4.7800e-01 3.0000e+00
++6.7800e-01 +4.8200e-01 3.0000e+00
++6.8200e-01 +4.8200e-01 3.0000e+00
++6.9800e-01 +4.7800e-01 3.0000e+00
++7.0200e-01 +4.7800e-01 3.0000e+00
++6.9800e-01 +4.8200e-01 3.0000e+00
++7.0200e-01 +4.8200e-01 3.0000e+00
++7.1800e-01 +4.7800e-01 3.0000e+00
++7.2200e-01 +4.7800e-01 3.0000e+00
++7.1800e-01 +4.8200e-01 3.0000e+00
++7.2200e-01 +4.8200e-01 3.0000e+00
++7.3800e-01 +4.7800e-01 3.0000e+00
++7.4200e-01 +4.7800e-01 3.0000e+00
++7.3800e-01 +4.8200e-01 3.0000e+00
++7.4200e-01 +4.8200e-01 3.0000e+00
++7.5800e-01 +4.7800e-01 3.0000e+00
++7.6200e-01 +4.7800e-01 3.0000e+00
++7.5800e-01 +4.8200e-01 3.0000e+00
++7.6200e-01 +4.8200e-01 3.0000e+00
++7.7800e-01 +4.7800e-01 3.0000e+00
++7.8200e-01 +4.7800e-01 3.0000e+00
++7.7800e-01 +4.8200e-01 3.0000e+00
++7.8200e-01 +4.8200e-01 3.0000e+00
++7.9800e-01 +4.7800e-01 3.0000e+00
++8.0200e-01 +4.7800e-01 3.0000e+00
++7.9800e-01 +4.8200e-01 3.0000e+00
++8.0200e-01 +4.8200e-01 3.0000e+00
++8.1800e-01 +4.7800e-01 3.0000e+00
++8.2200e-01 +4.7800e-01 3.0000e+00
++8.1800e-01 +4.8200e-01 3.0000e+00
++8.2200e-01 +4.8200e-01 3.0000e+00
++8.3800e-01 +4.7800e-01 3.0000e+00
++8.4200e-01 +4.7800e-01 3.0000e+00
++8.3800e-01 +4.8200e-01 3.0000e+00
++8.4200e-01 +4.8200e-01 3.0000e+00
++8.5800e-01 +4.7800e-01 3.0000e+00
++8.6200e-01 +4.7800e-01 3.0000e+00
++8.5800e-01 +4.8200e-01 3.0000e+00
++8.6200e-01 +4.8200e-01 3.0000e+00
++8.7800e-01 +4.7800e-01 3.0000e+00
++8.8200e-01 +4.7800e-01 3.0000e+00
++8.7800e-01 +4.8200e-01 3.0000e+00
++8.8200e-01 +4.8200e-01 3.0000e+00
++8.9800e-01 +4.7800e-01 3.0000e+00
++9.0200e-01 +4.7800e-01 3.0000e+00
++8.9800e-01 +4.8200e-01 3.0000e+00
++9.0200e-01 +4.8200e-01 3.0000e+00
++9.1800e-01 +4.7800e-01 3.0000e+00
++9.2200e-01 +4.7800e-01 3.0000e+00
++9.1800e-01 +4.8200e-01 3.0000e+00
++9.2200e-01 +4.8200e-01 3.0000e+00
++9.3800e-01 +4.7800e-01 3.0000e+00
++9.4200e-01 +4.7800e-01 3.0000e+00
++9.3800e-01 +4.8200e-01 3.0000e+00
++9.4200e-01 +4.8200e-01 3.0000e+00
++9.5800e-01 +4.7800e-01 3.0000e+00
++9.6200e-01 +4.7800e-01 3.0000e+00
++9.5800e-01 +4.8200e-01 3.0000e+00
++9.6200e-01 +4.8200e-01 3.0000e+00
++9.7800e-01 +4.7800e-01 3.0000e+00
++9.8200e-01 +4.7800e-01 3.0000e+00
++9.7800e-01 +4.8200e-01 3.0000e+00
++9.8200e-01 +4.8200e-01 3.0000e+00
++9.9800e-01 +4.7800e-01 3.0000e+00
++1.0020e+00 +4.7800e-01 3.0000e+00
++9.9800e-01 +4.8200e-01 3.0000e+00
++1.0020e+00 +4.8200e-01 3.0000e+00
++1.8000e-02 +4.9800e-01 3.0000e+00
++2.2000e-02 +4.9800e-01 3.0000e+00
++1.8000e-02 +5.0200e-01 3.0000e+00
++2.2000e-02 +5.0200e-01 3.0000e+00
++3.8000e-02 +4.9800e-01 3.0000e+00
++4.2000e-02 +4.9800e-01 3.0000e+00
++3.8000e-02 +5.0200e-01 3.0000e+00
++4.2000e-02 +5.0200e-01 3.0000e+00
++5.8000e-02 +4.9800e-01 3.0000e+00
++6.2000e-02 +4.9800e-01 3.0000e+00
++5.8000e-02 +5.0200e-01 3.0000e+00
++6.2000e-02 +5.0200e-01 3.0000e+00
++7.8000e-02 +4.9800e-01 3.0000e+00
++8.2000e-02 +4.9800e-01 3.0000e+00
++7.8000e-02 +5.0200e-01 3.0000e+00
++8.2000e-02 +5.0200e-01 3.0000e+00
++9.8000e-02 +4.9800e-01 3.0000e+00
++1.0200e-01 +4.9800e-01 3.0000e+00
++9.8000e-02 +5.0200e-01 3.0000e+00
++1.0200e-01 +5.0200e-01 3.0000e+00
++1.1800e-01 +4.9800e-01 3.0000e+00
++1.2200e-01 +4.9800e-01 3.0000e+00
++1.1800e-01 +5.0200e-01 3.0000e+00
++1.2200e-01 +5.0200e-01 3.0000e+00
++1.3800e-01 +4.9800e-01 3.0000e+00
++1.4200e-01 +4.9800e-01 3.0000e+00
++1.3800e-01 +5.0200e-01 3.0000e+00
++1.4200e-01 +5.0200e-01 3.0000e+00
++1.5800e-01 +4.9800e-01 3.0000e+00
++1.6200e-01 +4.9800e-01 3.0000e+00
++1.5800e-01 +5.0200e-01 3.0000e+00
++1.6200e-01 +5.0200e-01 3.0000e+00
++1.7800e-01 +4.9800e-01 3.0000e+00
++1.8200e-01 +4.9800e-01 3.0000e+00
++1.7800e-01 +5.0200e-01 3.0000e+00
++1.8200e-01 +5.0200e-01 3.0000e+00
++1.9800e-01 +4.9800e-01 3.0000e+00
++2.0200e-01 +4.9800e-01 3.0000e+00
++1.9800e-01 +5.0200e-01 3.0000e+00
++2.0200e-01 +5.0200e-01 3.0000e+00
++2.1800e-01 +4.9800e-01 3.0000e+00
++2.2200e-01 +4.9800e-01 3.0000e+00
++2.1800e-01 +5.0200e-01 3.0000e+00
++2.2200e-01 +5.0200e-01 3.0000e+00
++2.3800e-01 +4.9800e-01 3.0000e+00
++2.4200e-01 +4.9800e-01 3.0000e+00
++2.3800e-01 +5.0200e-01 3.0000e+00
++2.4200e-01 +5.0200e-01 3.0000e+00
++2.5800e-01 +4.9800e-01 3.0000e+00
++2.6200e-01 +4.9800e-01 3.0000e+00
++2.5800e-01 +5.0200e-01 3.0000e+00
++2.6200e-01 +5.0200e-01 3.0000e+00
++2.7800e-01 +4.9800e-01 3.0000e+00
++2.8200e-01 +4.9800e-01 3.0000e+00
++2.7800e-01 +5.0200e-01 3.0000e+00
++2.8200e-01 +5.0200e-01 3.0000e+00
++2.9800e-01 +4.9800e-01 3.0000e+00
++3.0200e-01 +4.9800e-01 3.0000e+00
++2.9800e-01 +5.0200e-01 3.0000e+00
++3.0200e-01 +5.0200e-01 3.0000e+00
++3.1800e-01 +4.9800e-01 3.0000e+00
++3.2200e-01 +4.9800e-01 3.0000e+00
++3.1800e-01 +5.0200e-01 3.0000e+00
++3.2200e-01 +5.0200e-01 3.0000e+00
++3.3800e-01 +4.9800e-01 3.0000e+00
++3.4200e-01 +4.9800e-01 3.0000e+00
++3.3800e-01 +5.0200e-01 3.0000e+00
++3.4200e-01 +5.0200e-01 3.0000e+00
++3.5800e-01 +4.9800e-01 3.0000e+00
++3.6200e-01 +4.9800e-01 3.0000e+00
++3.5800e-01 +5.0200e-01 3.0000e+00
++3.6200e-01 +5.0200e-01 3.0000e+00
++3.7800e-01 +4.9800e-01 3.0000e+00
++3.8200e-01 +4.9800e-01 3.0000e+00
++3.7800e-01 +5.0200e-01 3.0000e+00
++3.8200e-01 +5.0200e-01 3.0000e+00
++3.9800e-01 +4.9800e-01 3.0000e+00
++4.0200e-01 +4.9800e-01 3.0000e+00
++3.9800e-01 +5.0200e-01 3.0000e+00
++4.0200e-01 +5.0200e-01 3.0000e+00
++4.1800e-01 +4.9800e-01 3.0000e+00
++4.2200e-01 +4.9800e-01 3.0000e+00
++4.1800e-01 +5.0200e-01 3.0000e+00
++4.2200e-01 +5.0200e-01 3.0000e+00
++4.3800e-01 +4.9800e-01 3.0000e+00
++4.4200e-01 +4.9800e-01 3.0000e+00
++4.3800e-01 +5.0200e-01 3.0000e+00
++4.4200e-01 +5.0200e-01 3.0000e+00
++4.5800e-01 +4.9800e-01 3.0000e+00
++4.6200e-01 +4.9800e-01 3.0000e+00
++4.5800e-01 +5.0200e-01 3.0000e+00
++4.6200e-01 +5.0200e-01 3.0000e+00
++4.7800e-01 +4.9800e-01 3.0000e+00
++4.8200e-01 +4.9800e-01 3.0000e+00
++4.7800e-01 +5.0200e-01 3.0000e+00
++4.8200e-01 +5.0200e-01 3.0000e+00
++4.9800e-01 +4.9800e-01 3.0000e+00
++5.0200e-01 +4.9800e-01 3.0000e+00
++4.9800e-01 +5.0200e-01 3.0000e+00
++5.0200e-01 +5.0200e-01 3.0000e+00
++5.1800e-01 +4.9800e-01 3.0000e+00
++5.2200e-01 +4.9800e-01 3.0000e+00
++5.1800e-01 +5.0200e-01 3.0000e+00
++5.2200e-01 +5.0200e-01 3.0000e+00
++5.3800e-01 +4.9800e-01 3.0000e+00
++5.4200e-01 +4.9800e-01 3.0000e+00
++5.3800e-01 +5.0200e-01 3.0000e+00
++5.4200e-01 +5.0200e-01 3.0000e+00
++5.5800e-01 +4.9800e-01 3.0000e+00
++5.6200e-01 +4.9800e-01 3.0000e+00
++5.5800e-01 +5.0200e-01 3.0000e+00
++5.6200e-01 +5.0200e-01 3.0000e+00
++5.7800e-01 +4.9800e-01 3.0000e+00
++5.8200e-01 +4.9800e-01 3.0000e+00
++5.7800e-01 +5.0200e-01 3.0000e+00
++5.8200e-01 +5.0200e-01 3.0000e+00
++5.9800e-01 +4.9800e-01 3.0000e+00
++6.0200e-01 +4.9800e-01 3.0000e+00
++5.9800e-01 +5.0200e-01 3.0000e+00
++6.0200e-01 +5.0200e-01 3.0000e+00
++6.1800e-01 +4.9800e-01 3.0000e+00
++6.2200e-01 +4.9800e-01 3.0000e+00
++6.1800e-01 +5.0200e-01 3.0000e+00
++6.2200e-01 +5.0200e-01 3.0000e+00
++6.3800e-01 +4.9800e-01 3.0000e+00
++6.4200e-01 +4.9800e-01 3.0000e+00
++6.3800e-01 +5.0200e-01 3.0000e+00
++6.4200e-01 +5.0200e-01 3.0000e+00
++6.5800e-01 +4.9800e-01 3.0000e+00
++6.6200e-01 +4.9800e-01 3.0000e+00
++6.5800e-01 +5.0200e-01 3.0000e+00
++6.6200e-01 +5.0200e-01 3.0000e+00
++6.7800e-01 +4.9800e-01 3.0000e+00
++6.8200e-01 +4.9800e-01 3.0000e+00
++6.7800e-01 +5.0200e-01 3.0000e+00
++6.8200e-01 +5.0200e-01 3.0000e+00
++6.9800e-01 +4.9800e-01 3.0000e+00
++7.0200e-01 +4.9800e-01 3.0000e+00
++6.9800e-01 +5.0200e-01 3.0000e+00
++7.0200e-01 +5.0200e-01 3.0000e+00
++7.1800e-01 +4.9800e-01 3.0000e+00
++7.2200e-01 +4.9800e-01 3.0000e+00
++7.1800e-01 +5.0200e-01 3.0000e+00
++7.2200e-01 +5.0200e-01 3.0000e+00
++7.3800e-01 +4.9800e-01 3.0000e+00
++7.4200e-01 +4.9800e-01 3.0000e+00
++7.3800e-01 +5.0200e-01 3.0000e+00
++7.4200e-01 +5.0200e-01 3.0000e+00
++7.5800e-01 +4.9800e-01 3.0000e+00
++7.6200e-01 +4.9800e-01 3.0000e+00
++7.5800e-01 +5.0200e-01 3.0000e+00
++7.6200e-01 +5.0200e-01 3.0000e+00
++7.7800e-01 +4.9800e-01 3.0000e+00
++7.8200e-01 +4.9800e-01 3.0000e+00
++7.7800e-01 +5.0200e-01 3.0000e+00
++7.8200e-01 +5.0200e-01 3.0000e+00
++7.9800e-01 +4.9800e-01 3.0000e+00
++8.0200e-01 +4.9800e-01 3.0000e+00
++7.9800e-01 +5.0200e-01 3.0000e+00
++8.0200e-01 +5.0200e-01 3.0000e+00
++8.1800e-01 +4.9800e-01 3.0000e+00
++8.2200e-01 +4.9800e-01 3.0000e+00
++8.1800e-01 +5.0200e-01 3.0000e+00
++8.2200e-01 +5.0200e-01 3.0000e+00
++8.3800e-01 +4.9800e-01 3.0000e+00
++8.4200e-01 +4.9800e-01 3.0000e+00
++8.3800e-01 +5.0200e-01 3.0000e+00
++8.4200e-01 +5.0200e-01 3.0000e+00
++8.5800e-01 +4.9800e-01 3.0000e+00
++8.6200e-01 +4.9800e-01 3.0000e+00
++8.5800e-01 +5.0200e-01 3.0000e+00
++8.6200e-01 +5.0200e-01 3.0000e+00
++8.7800e-01 +4.9800e-01 3.0000e+00
++8.8200e-01 +4.9800e-01 3.0000e+00
++8.7800e-01 +5.0200e-01 3.0000e+00
++8.8200e-01 +5.0200e-01 3.0000e+00
++8.9800e-01 +4.9800e-01 3.0000e+00
++9.0200e-01 +4.9800e-01 3.0000e+00
++8.9800e-01 +5.0200e-01 3.0000e+00
++9.0200e-01 +5.0200e-01 3.0000e+00
++9.1800e-01 +4.9800e-01 3.0000e+00
++9.2200e-01 +4.9800e-01 3.0000e+00
++9.1800e-01 +5.0200e-01 3.0000e+00
++9.2200e-01 +5.0200e-01 3.0000e+00
++9.3800e-01 +4.9800e-01 3.0000e+00
++9.4200e-01 +4.9800e-01 3.0000e+00
++9.3800e-01 +5.0200e-01 3.0000e+00
++9.4200e-01 +5.0200e-01 3.0000e+00
++9.5800e-01 +4.9800e-01 3.0000e+00
++9.6200e-01 +4.9800e-01 3.0000e+00
++9.5800e-01 +5.0200e-01 3.0000e+00
++9.6200e-01 +5.0200e-01 3.0000e+00
++9.7800e-01 +4.9800e-01 3.0000e+00
++9.8200e-01 +4.9800e-01 3.0000e+00
++9.7800e-01 +5.0200e-01 3.0000e+00
++9.8200e-01 +5.0200e-01 3.0000e+00
++9.9800e-01 +4.9800e-01 3.0000e+00
++1.0020e+00 +4.9800e-01 3.0000e+00
++9.9800e-01 +5.0200e-01 3.0000e+00
++1.0020e+00 +5.0200e-01 3.0000e+00
++1.8000e-02 +5.1800e-01 3.0000e+00
++2.2000e-02 +5.1800e-01 3.0000e+00
++1.8000e-02 +5.2200e-01 3.0000e+00
++2.2000e-02 +5.2200e-01 3.0000e+00
++3.8000e-02 +5.1800e-01 3.0000e+00
++4.2000e-02 +5.1800e-01 3.0000e+00
++3.8000e-02 +5.2200e-01 3.0000e+00
++4.2000e-02 +5.2200e-01 3.0000e+00
++5.8000e-02 +5.1800e-01 3.0000e+00
++6.2000e-02 +5.1800e-01 3.0000e+00
++5.8000e-02 +5.2200e-01 3.0000e+00
++6.2000e-02 +5.2200e-01 3.0000e+00
++7.8000e-02 +5.1800e-01 3.0000e+00
++8.2000e-02 +5.1800e-01 3.0000e+00
++7.8000e-02 +5.2200e-01 3.0000e+00
++8.2000e-02 +5.2200e-01 3.0000e+00
++9.8000e-02 +5.1800e-01 3.0000e+00
++1.0200e-01 +5.1800e-01 3.0000e+00
++9.8000e-02 +5.2200e-01 3.0000e+00
++1.0200e-01 +5.2200e-01 3.0000e+00
++1.1800e-01 +5.1800e-01 3.0000e+00
++1.2200e-01 +5.1800e-01 3.0000e+00
++1.1800e-01 +5.2200e-01 3.0000e+00
++1.2200e-01 +5.2200e-01 3.0000e+00
++1.3800e-01 +5.1800e-01 3.0000e+00
++1.4200e-01 +5.1800e-01 3.0000e+00
++1.3800e-01 +5.2200e-01 3.0000e+00
++1.4200e-01 +5.2200e-01 3.0000e+00
++1.5800e-01 +5.1800e-01 3.0000e+00
++1.6200e-01 +5.1800e-01 3.0000e+00
++1.5800e-01 +5.2200e-01 3.0000e+00
++1.6200e-01 +5.2200e-01 3.0000e+00
++1.7800e-01 +5.1800e-01 3.0000e+00
++1.8200e-01 +5.1800e-01 3.0000e+00
++1.7800e-01 +5.2200e-01 3.0000e+00
++1.8200e-01 +5.2200e-01 3.0000e+00
++1.9800e-01 +5.1800e-01 3.0000e+00
++2.0200e-01 +5.1800e-01 3.0000e+00
++1.9800e-01 +5.2200e-01 3.0000e+00
++2.0200e-01 +5.2200e-01 3.0000e+00
++2.1800e-01 +5.1800e-01 3.0000e+00
++2.2200e-01 +5.1800e-01 3.0000e+00
++2.1800e-01 +5.2200e-01 3.0000e+00
++2.2200e-01 +5.2200e-01 3.0000e+00
++2.3800e-01 +5.1800e-01 3.0000e+00
++2.4200e-01 +5.1800e-01 3.0000e+00
++2.3800e-01 +5.2200e-01 3.0000e+00
++2.4200e-01 +5.2200e-01 3.0000e+00
++2.5800e-01 +5.1800e-01 3.0000e+00
++2.6200e-01 +5.1800e-01 3.0000e+00
++2.5800e-01 +5.2200e-01 3.0000e+00
++2.6200e-01 +5.2200e-01 3.0000e+00
++2.7800e-01 +5.1800e-01 3.0000e+00
++2.8200e-01 +5.1800e-01 3.0000e+00
++2.7800e-01 +5.2200e-01 3.0000e+00
++2.8200e-01 +5.2200e-01 3.0000e+00
++2.9800e-01 +5.1800e-01 3.0000e+00
++3.0200e-01 +5.1800e-01 3.0000e+00
++2.9800e-01 +5.2200e-01 3.0000e+00
++3.0200e-01 +5.2200e-01 3.0000e+00
++3.1800e-01 +5.1800e-01 3.0000e+00
++3.2200e-01 +5.1800e-01 3.0000e+00
++3.1800e-01 +5.2200e-01 3.0000e+00
++3.2200e-01 +5.2200e-01 3.0000e+00
++3.3800e-01 +5.1800e-01 3.0000e+00
++3.4200e-01 +5.1800e-01 3.0000e+00
++3.3800e-01 +5.2200e-01 3.0000e+00
++3.4200e-01 +5.2200e-01 3.0000e+00
++3.5800e-01 +5.1800e-01 3.0000e+00
++3.6200e-01 +5.1800e-01 3.0000e+00
++3.5800e-01 +5.2200e-01 3.0000e+00
++3.6200e-01 +5.2200e-01 3.0000e+00
++3.7800e-01 +5.1800e-01 3.0000e+00
++3.8200e-01 +5.1800e-01 3.0000e+00
++3.7800e-01 +5.2200e-01 3.0000e+00
++3.8200e-01 +5.2200e-01 3.0000e+00
++3.9800e-01 +5.1800e-01 3.0000e+00
++4.0200e-01 +5.1800e-01 3.0000e+00
++3.9800e-01 +5.2200e-01 3.0000e+00
++4.0200e-01 +5.2200e-01 3.0000e+00
++4.1800e-01 +5.1800e-01 3.0000e+00
++4.2200e-01 +5.1800e-01 3.0000e+00
++4.1800e-01 +5.2200e-01 3.0000e+00
++4.2200e-01 +5.2200e-01 3.0000e+00
++4.3800e-01 +5.1800e-01 3.0000e+00
++4.4200e-01 +5.1800e-01 3.0000e+00
++4.3800e-01 +5.2200e-01 3.0000e+00
++4.4200e-01 +5.2200e-01 3.0000e+00
++4.5800e-01 +5.1800e-01 3.0000e+00
++4.6200e-01 +5.1800e-01 3.0000e+00
++4.5800e-01 +5.2200e-01 3.0000e+00
++4.6200e-01 +5.2200e-01 3.0000e+00
++4.7800e-01 +5.1800e-01 3.0000e+00
++4.8200e-01 +5.1800e-01 3.0000e+00
++4.7800e-01 +5.2200e-01 3.0000e+00
++4.8200e-01 +5.2200e-01 3.0000e+00
++4.9800e-01 +5.1800e-01 3.0000e+00
++5.0200e-01 +5.1800e-01 3.0000e+00
++4.9800e-01 +5.2200e-01 3.0000e+00
++5.0200e-01 +5.2200e-01 3.0000e+00
++5.1800e-01 +5.1800e-01 3.0000e+00
++5.2200e-01 +5.1800e-01 3.0000e+00
++5.1800e-01 +5.2200e-01 3.0000e+00
++5.2200e-01 +5.2200e-01 3.0000e+00
++5.3800e-01 +5.1800e-01 3.0000e+00
++5.4200e-01 +5.1800e-01 3.0000e+00
++5.3800e-01 +5.2200e-01 3.0000e+00
++5.4200e-01 +5.2200e-01 3.0000e+00
++5.5800e-01 +5.1800e-01 3.0000e+00
++5.6200e-01 +5.1800e-01 3.0000e+00
++5.5800e-01 +5.2200e-01 3.0000e+00
++5.6200e-01 +5.2200e-01 3.0000e+00
++5.7800e-01 +5.1800e-01 3.0000e+00
++5.8200e-01 +5.1800e-01 3.0000e+00
++5.7800e-01 +5.2200e-01 3.0000e+00
++5.8200e-01 +5.2200e-01 3.0000e+00
++5.9800e-01 +5.1800e-01 3.0000e+00
++6.0200e-01 +5.1800e-01 3.0000e+00
++5.9800e-01 +5.2200e-01 3.0000e+00
++6.0200e-01 +5.2200e-01 3.0000e+00
++6.1800e-01 +5.1800e-01 3.0000e+00
++6.2200e-01 +5.1800e-01 3.0000e+00
++6.1800e-01 +5.2200e-01 3.0000e+00
++6.2200e-01 +5.2200e-01 3.0000e+00
++6.3800e-01 +5.1800e-01 3.0000e+00
++6.4200e-01 +5.1800e-01 3.0000e+00
++6.3800e-01 +5.2200e-01 3.0000e+00
++6.4200e-01 +5.2200e-01 3.0000e+00
++6.5800e-01 +5.1800e-01 3.0000e+00
++6.6200e-01 +5.1800e-01 3.0000e+00
++6.5800e-01 +5.2200e-01 3.0000e+00
++6.6200e-01 +5.2200e-01 3.0000e+00
++6.7800e-01 +5.1800e-01 3.0000e+00
++6.8200e-01 +5.1800e-01 3.0000e+00
++6.7800e-01 +5.2200e-01 3.0000e+00
++6.8200e-01 +5.2200e-01 3.0000e+00
++6.9800e-01 +5.1800e-01 3.0000e+00
++7.0200e-01 +5.1800e-01 3.0000e+00
++6.9800e-01 +5.2200e-01 3.0000e+00
++7.0200e-01 +5.2200e-01 3.0000e+00
++7.1800e-01 +5.1800e-01 3.0000e+00
++7.2200e-01 +5.1800e-01 3.0000e+00
++7.1800e-01 +5.2200e-01 3.0000e+00
++7.2200e-01 +5.2200e-01 3.0000e+00
++7.3800e-01 +5.1800e-01 3.0000e+00
++7.4200e-01 +5.1800e-01 3.0000e+00
++7.3800e-01 +5.2200e-01 3.0000e+00
++7.4200e-01 +5.2200e-01 3.0000e+00
++7.5800e-01 +5.1800e-01 3.0000e+00
++7.6200e-01 +5.1800e-01 3.0000e+00
++7.5800e-01 +5.2200e-01 3.0000e+00
++7.6200e-01 +5.2200e-01 3.0000e+00
++7.7800e-01 +5.1800e-01 3.0000e+00
++7.8200e-01 +5.1800e-01 3.0000e+00
++7.7800e-01 +5.2200e-01 3.0000e+00
++7.8200e-01 +5.2200e-01 3.0000e+00
++7.9800e-01 +5.1800e-01 3.0000e+00
++8.0200e-01 +5.1800e-01 3.0000e+00
++7.9800e-01 +5.2200e-01 3.0000e+00
++8.0200e-01 +5.2200e-01 3.0000e+00
++8.1800e-01 +5.1800e-01 3.0000e+00
++8.2200e-01 +5.1800e-01 3.0000e+00
++8.1800e-01 +5.2200e-01 3.0000e+00
++8.2200e-01 +5.2200e-01 3.0000e+00
++8.3800e-01 +5.1800e-01 3.0000e+00
++8.4200e-01 +5.1800e-01 3.0000e+00
++8.3800e-01 +5.2200e-01 3.0000e+00
++8.4200e-01 +5.2200e-01 3.0000e+00
++8.5800e-01 +5.1800e-01 3.0000e+00
++8.6200e-01 +5.1800e-01 3.0000e+00
++8.5800e-01 +5.2200e-01 3.0000e+00
++8.6200e-01 +5.2200e-01 3.0000e+00
++8.7800e-01 +5.1800e-01 3.0000e+00
++8.8200e-01 +5.1800e-01 3.0000e+00
++8.7800e-01 +5.2200e-01 3.0000e+00
++8.8200e-01 +5.2200e-01 3.0000e+00
++8.9800e-01 +5.1800e-01 3.0000e+00
++9.0200e-01 +5.1800e-01 3.0000e+00
++8.9800e-01 +5.2200e-01 3.0000e+00
++9.0200e-01 +5.2200e-01 3.0000e+00
++9.1800e-01 +5.1800e-01 3.0000e+00
++9.2200e-01 +5.1800e-01 3.0000e+00
++9.1800e-01 +5.2200e-01 3.0000e+00
++9.2200e-01 +5.2200e-01 3.0000e+00
++9.3800e-01 +5.1800e-01 3.0000e+00
++9.4200e-01 +5.1800e-01 3.0000e+00
++9.3800e-01 +5.2200e-01 3.0000e+00
++9.4200e-01 +5.2200e-01 3.0000e+00
++9.5800e-01 +5.1800e-01 3.0000e+00
++9.6200e-01 +5.1800e-01 3.0000e+00
++9.5800e-01 +5.2200e-01 3.0000e+00
++9.6200e-01 +5.2200e-01 3.0000e+00
++9.7800e-01 +5.1800e-01 3.0000e+00
++9.8200e-01 +5.1800e-01 3.0000e+00
++9.7800e-01 +5.2200e-01 3.0000e+00
++9.8200e-01 +5.2200e-01 3.0000e+00
++9.9800e-01 +5.1800e-01 3.0000e+00
++1.0020e+00 +5.1800e-01 3.0000e+00
++9.9800e-01 +5.2200e-01 3.0000e+00
++1.0020e+00 +5.2200e-01 3.0000e+00
++1.8000e-02 +5.3800e-01 3.0000e+00
++2.2000e-02 +5.3800e-01 3.0000e+00
++1.8000e-02 +5.4200e-01 3.0000e+00
++2.2000e-02 +5.4200e-01 3.0000e+00
++3.8000e-02 +5.3800e-01 3.0000e+00
++4.2000e-02 +5.3800e-01 3.0000e+00
++3.8000e-02 +5.4200e-01 3.0000e+00
++4.2000e-02 +5.4200e-01 3.0000e+00
++5.8000e-02 +5.3800e-01 3.0000e+00
++6.2000e-02 +5.3800e-01 3.0000e+00
++5.8000e-02 +5.4200e-01 3.0000e+00
++6.2000e-02 +5.4200e-01 3.0000e+00
++7.8000e-02 +5.3800e-01 3.0000e+00
++8.2000e-02 +5.3800e-01 3.0000e+00
++7.8000e-02 +5.4200e-01 3.0000e+00
++8.2000e-02 +5.4200e-01 3.0000e+00
++9.8000e-02 +5.3800e-01 3.0000e+00
++1.0200e-01 +5.3800e-01 3.0000e+00
++9.8000e-02 +5.4200e-01 3.0000e+00
++1.0200e-01 +5.4200e-01 3.0000e+00
++1.1800e-01 +5.3800e-01 3.0000e+00
++1.2200e-01 +5.3800e-01 3.0000e+00
++1.1800e-01 +5.4200e-01 3.0000e+00
++1.2200e-01 +5.4200e-01 3.0000e+00
++1.3800e-01 +5.3800e-01 3.0000e+00
++1.4200e-01 +5.3800e-01 3.0000e+00
++1.3800e-01 +5.4200e-01 3.0000e+00
++1.4200e-01 +5.4200e-01 3.0000e+00
++1.5800e-01 +5.3800e-01 3.0000e+00
++1.6200e-01 +5.3800e-01 3.0000e+00
++1.5800e-01 +5.4200e-01 3.0000e+00
++1.6200e-01 +5.4200e-01 3.0000e+00
++1.7800e-01 +5.3800e-01 3.0000e+00
++1.8200e-01 +5.3800e-01 3.0000e+00
++1.7800e-01 +5.4200e-01 3.0000e+00
++1.8200e-01 +5.4200e-01 3.0000e+00
++1.9800e-01 +5.3800e-01 3.0000e+00
++2.0200e-01 +5.3800e-01 3.0000e+00
++1.9800e-01 +5.4200e-01 3.0000e+00
++2.0200e-01 +5.4200e-01 3.0000e+00
++2.1800e-01 +5.3800e-01 3.0000e+00
++2.2200e-01 +5.3800e-01 3.0000e+00
++2.1800e-01 +5.4200e-01 3.0000e+00
++2.2200e-01 +5.4200e-01 3.0000e+00
++2.3800e-01 +5.3800e-01 3.0000e+00
++2.4200e-01 +5.3800e-01 3.0000e+00
++2.3800e-01 +5.4200e-01 3.0000e+00
++2.4200e-01 +5.4200e-01 3.0000e+00
++2.5800e-01 +5.3800e-01 3.0000e+00
++2.6200e-01 +5.3800e-01 3.0000e+00
++2.5800e-01 +5.4200e-01 3.0000e+00
++2.6200e-01 +5.4200e-01 3.0000e+00
++2.7800e-01 +5.3800e-01 3.0000e+00
++2.8200e-01 +5.3800e-01 3.0000e+00
++2.7800e-01 +5.4200e-01 3.0000e+00
++2.8200e-01 +5.4200e-01 3.0000e+00
++2.9800e-01 +5.3800e-01 3.0000e+00
++3.0200e-01 +5.3800e-01 3.0000e+00
++2.9800e-01 +5.4200e-01 3.0000e+00
++3.0200e-01 +5.4200e-01 3.0000e+00
++3.1800e-01 +5.3800e-01 3.0000e+00
++3.2200e-01 +5.3800e-01 3.0000e+00
++3.1800e-01 +5.4200e-01 3.0000e+00
++3.2200e-01 +5.4200e-01 3.0000e+00
++3.3800e-01 +5.3800e-01 3.0000e+00
++3.4200e-01 +5.3800e-01 3.0000e+00
++3.3800e-01 +5.4200e-01 3.0000e+00
++3.4200e-01 +5.4200e-01 3.0000e+00
++3.5800e-01 +5.3800e-01 3.0000e+00
++3.6200e-01 +5.3800e-01 3.0000e+00
++3.5800e-01 +5.4200e-01 3.0000e+00
++3.6200e-01 +5.4200e-01 3.0000e+00
++3.7800e-01 +5.3800e-01 3.0000e+00
++3.8200e-01 +5.3800e-01 3.0000e+00
++3.7800e-01 +5.4200e-01 3.0000e+00
++3.8200e-01 +5.4200e-01 3.0000e+00
++3.9800e-01 +5.3800e-01 3.0000e+00
++4.0200e-01 +5.3800e-01 3.0000e+00
++3.9800e-01 +5.4200e-01 3.0000e+00
++4.0200e-01 +5.4200e-01 3.0000e+00
++4.1800e-01 +5.3800e-01 3.0000e+00
++4.2200e-01 +5.3800e-01 3.0000e+00
++4.1800e-01 +5.4200e-01 3.0000e+00
++4.2200e-01 +5.4200e-01 3.0000e+00
++4.3800e-01 +5.3800e-01 3.0000e+00
++4.4200e-01 +5.3800e-01 3.0000e+00
++4.3800e-01 +5.4200e-01 3.0000e+00
++4.4200e-01 +5.4200e-01 3.0000e+00
++4.5800e-01 +5.3800e-01 3.0000e+00
++4.6200e-01 +5.3800e-01 3.0000e+00
++4.5800e-01 +5.4200e-01 3.0000e+00
++4.6200e-01 +5.4200e-01 3.0000e+00
++4.7800e-01 +5.3800e-01 3.0000e+00
++4.8200e-01 +5.3800e-01 3.0000e+00
++4.7800e-01 +5.4200e-01 3.0000e+00
++4.8200e-01 +5.4200e-01 3.0000e+00
++4.9800e-01 +5.3800e-01 3.0000e+00
++5.0200e-01 +5.3800e-01 3.0000e+00
++4.9800e-01 +5.4200e-01 3.0000e+00
++5.0200e-01 +5.4200e-01 3.0000e+00
++5.1800e-01 +5.3800e-01 3.0000e+00
++5.2200e-01 +5.3800e-01 3.0000e+00
++5.1800e-01 +5.4200e-01 3.0000e+00
++5.2200e-01 +5.4200e-01 3.0000e+00
++5.3800e-01 +5.3800e-01 3.0000e+00
++5.4200e-01 +5.3800e-01 3.0000e+00
++5.3800e-01 +5.4200e-01 3.0000e+00
++5.4200e-01 +5.4200e-01 3.0000e+00
++5.5800e-01 +5.3800e-01 3.0000e+00
++5.6200e-01 +5.3800e-01 3.0000e+00
++5.5800e-01 +5.4200e-01 3.0000e+00
++5.6200e-01 +5.4200e-01 3.0000e+00
++5.7800e-01 +5.3800e-01 3.0000e+00
++5.8200e-01 +5.3800e-01 3.0000e+00
++5.7800e-01 +5.4200e-01 3.0000e+00
++5.8200e-01 +5.4200e-01 3.0000e+00
++5.9800e-01 +5.3800e-01 3.0000e+00
++6.0200e-01 +5.3800e-01 3.0000e+00
++5.9800e-01 +5.4200e-01 3.0000e+00
++6.0200e-01 +5.4200e-01 3.0000e+00
++6.1800e-01 +5.3800e-01 3.0000e+00
++6.2200e-01 +5.3800e-01 3.0000e+00
++6.1800e-01 +5.4200e-01 3.0000e+00
++6.2200e-01 +5.4200e-01 3.0000e+00
++6.3800e-01 +5.3800e-01 3.0000e+00
++6.4200e-01 +5.3800e-01 3.0000e+00
++6.3800e-01 +5.4200e-01 3.0000e+00
++6.4200e-01 +5.4200e-01 3.0000e+00
++6.5800e-01 +5.3800e-01 3.0000e+00
++6.6200e-01 +5.3800e-01 3.0000e+00
++6.5800e-01 +5.4200e-01 3.0000e+00
++6.6200e-01 +5.4200e-01 3.0000e+00
++6.7800e-01 +5.3800e-01 3.0000e+00
++6.8200e-01 +5.3800e-01 3.0000e+00
++6.7800e-01 +5.4200e-01 3.0000e+00
++6.8200e-01 +5.4200e-01 3.0000e+00
++6.9800e-01 +5.3800e-01 3.0000e+00
++7.0200e-01 +5.3800e-01 3.0000e+00
++6.9800e-01 +5.4200e-01 3.0000e+00
++7.0200e-01 +5.4200e-01 3.0000e+00
++7.1800e-01 +5.3800e-01 3.0000e+00
++7.2200e-01 +5.3800e-01 3.0000e+00
++7.1800e-01 +5.4200e-01 3.0000e+00
++7.2200e-01 +5.4200e-01 3.0000e+00
++7.3800e-01 +5.3800e-01 3.0000e+00
++7.4200e-01 +5.3800e-01 3.0000e+00
++7.3800e-01 +5.4200e-01 3.0000e+00
++7.4200e-01 +5.4200e-01 3.0000e+00
++7.5800e-01 +5.3800e-01 3.0000e+00
++7.6200e-01 +5.3800e-01 3.0000e+00
++7.5800e-01 +5.4200e-01 3.0000e+00
++7.6200e-01 +5.4200e-01 3.0000e+00
++7.7800e-01 +5.3800e-01 3.0000e+00
++7.8200e-01 +5.3800e-01 3.0000e+00
++7.7800e-01 +5.4200e-01 3.0000e+00
++7.8200e-01 +5.4200e-01 3.0000e+00
++7.9800e-01 +5.3800e-01 3.0000e+00
++8.0200e-01 +5.3800e-01 3.0000e+00
++7.9800e-01 +5.4200e-01 3.0000e+00
++8.0200e-01 +5.4200e-01 3.0000e+00
++8.1800e-01 +5.3800e-01 3.0000e+00
++8.2200e-01 +5.3800e-01 3.0000e+00
++8.1800e-01 +5.4200e-01 3.0000e+00
++8.2200e-01 +5.4200e-01 3.0000e+00
++8.3800e-01 +5.3800e-01 3.0000e+00
++8.4200e-01 +5.3800e-01 3.0000e+00
++8.3800e-01 +5.4200e-01 3.0000e+00
++8.4200e-01 +5.4200e-01 3.0000e+00
++8.5800e-01 +5.3800e-01 3.0000e+00
++8.6200e-01 +5.3800e-01 3.0000e+00
++8.5800e-01 +5.4200e-01 3.0000e+00
++8.6200e-01 +5.4200e-01 3.0000e+00
++8.7800e-01 +5.3800e-01 3.0000e+00
++8.8200e-01 +5.3800e-01 3.0000e+00
++8.7800e-01 +5.4200e-01 3.0000e+00
++8.8200e-01 +5.4200e-01 3.0000e+00
++8.9800e-01 +5.3800e-01 3.0000e+00
++9.0200e-01 +5.3800e-01 3.0000e+00
++8.9800e-01 +5.4200e-01 3.0000e+00
++9.0200e-01 +5.4200e-01 3.0000e+00
++9.1800e-01 +5.3800e-01 3.0000e+00
++9.2200e-01 +5.3800e-01 3.0000e+00
++9.1800e-01 +5.4200e-01 3.0000e+00
++9.2200e-01 +5.4200e-01 3.0000e+00
++9.3800e-01 +5.3800e-01 3.0000e+00
++9.4200e-01 +5.3800e-01 3.0000e+00
++9.3800e-01 +5.4200e-01 3.0000e+00
++9.4200e-01 +5.4200e-01 3.0000e+00
++9.5800e-01 +5.3800e-01 3.0000e+00
++9.6200e-01 +5.3800e-01 3.0000e+00
++9.5800e-01 +5.4200e-01 3.0000e+00
++9.6200e-01 +5.4200e-01 3.0000e+00
++9.7800e-01 +5.3800e-01 3.0000e+00
++9.8200e-01 +5.3800e-01 3.0000e+00
++9.7800e-01 +5.4200e-01 3.0000e+00
++9.8200e-01 +5.4200e-01 3.0000e+00
++9.9800e-01 +5.3800e-01 3.0000e+00
++1.0020e+00 +5.3800e-01 3.0000e+00
++9.9800e-01 +5.4200e-01 3.0000e+00
++1.0020e+00 +5.4200e-01 3.0000e+00
++1.8000e-02 +5.5800e-01 3.0000e+00
++2.2000e-02 +5.5800e-01 3.0000e+00
++1.8000e-02 +5.6200e-01 3.0000e+00
++2.2000e-02 +5.6200e-01 3.0000e+00
++3.8000e-02 +5.5800e-01 3.0000e+00
++4.2000e-02 +5.5800e-01 3.0000e+00
++3.8000e-02 +5.6200e-01 3.0000e+00
++4.2000e-02 +5.6200e-01 3.0000e+00
++5.8000e-02 +5.5800e-01 3.0000e+00
++6.2000e-02 +5.5800e-01 3.0000e+00
++5.8000e-02 +5.6200e-01 3.0000e+00
++6.2000e-02 +5.6200e-01 3.0000e+00
++7.8000e-02 +5.5800e-01 3.0000e+00
++8.2000e-02 +5.5800e-01 3.0000e+00
++7.8000e-02 +5.6200e-01 3.0000e+00
++8.2000e-02 +5.6200e-01 3.0000e+00
++9.8000e-02 +5.5800e-01 3.0000e+00
++1.0200e-01 +5.5800e-01 3.0000e+00
++9.8000e-02 +5.6200e-01 3.0000e+00
++1.0200e-01 +5.6200e-01 3.0000e+00
++1.1800e-01 +5.5800e-01 3.0000e+00
++1.2200e-01 +5.5800e-01 3.0000e+00
++1.1800e-01 +5.6200e-01 3.0000e+00
++1.2200e-01 +5.6200e-01 3.0000e+00
++1.3800e-01 +5.5800e-01 3.0000e+00
++1.4200e-01 +5.5800e-01 3.0000e+00
++1.3800e-01 +5.6200e-01 3.0000e+00
++1.4200e-01 +5.6200e-01 3.0000e+00
++1.5800e-01 +5.5800e-01 3.0000e+00
++1.6200e-01 +5.5800e-01 3.0000e+00
++1.5800e-01 +5.6200e-01 3.0000e+00
++1.6200e-01 +5.6200e-01 3.0000e+00
++1.7800e-01 +5.5800e-01 3.0000e+00
++1.8200e-01 +5.5800e-01 3.0000e+00
++1.7800e-01 +5.6200e-01 3.0000e+00
++1.8200e-01 +5.6200e-01 3.0000e+00
++1.9800e-01 +5.5800e-01 3.0000e+00
++2.0200e-01 +5.5800e-01 3.0000e+00
++1.9800e-01 +5.6200e-01 3.0000e+00
++2.0200e-01 +5.6200e-01 3.0000e+00
++2.1800e-01 +5.5800e-01 3.0000e+00
++2.2200e-01 +5.5800e-01 3.0000e+00
++2.1800e-01 +5.6200e-01 3.0000e+00
++2.2200e-01 +5.6200e-01 3.0000e+00
++2.3800e-01 +5.5800e-01 3.0000e+00
++2.4200e-01 +5.5800e-01 3.0000e+00
++2.3800e-01 +5.6200e-01 3.0000e+00
++2.4200e-01 +5.6200e-01 3.0000e+00
++2.5800e-01 +5.5800e-01 3.0000e+00
++2.6200e-01 +5.5800e-01 3.0000e+00
++2.5800e-01 +5.6200e-01 3.0000e+00
++2.6200e-01 +5.6200e-01 3.0000e+00
++2.7800e-01 +5.5800e-01 3.0000e+00
++2.8200e-01 +5.5800e-01 3.0000e+00
++2.7800e-01 +5.6200e-01 3.0000e+00
++2.8200e-01 +5.6200e-01 3.0000e+00
++2.9800e-01 +5.5800e-01 3.0000e+00
++3.0200e-01 +5.5800e-01 3.0000e+00
++2.9800e-01 +5.6200e-01 3.0000e+00
++3.0200e-01 +5.6200e-01 3.0000e+00
++3.1800e-01 +5.5800e-01 3.0000e+00
++3.2200e-01 +5.5800e-01 3.0000e+00
++3.1800e-01 +5.6200e-01 3.0000e+00
++3.2200e-01 +5.6200e-01 3.0000e+00
++3.3800e-01 +5.5800e-01 3.0000e+00
++3.4200e-01 +5.5800e-01 3.0000e+00
++3.3800e-01 +5.6200e-01 3.0000e+00
++3.4200e-01 +5.6200e-01 3.0000e+00
++3.5800e-01 +5.5800e-01 3.0000e+00
++3.6200e-01 +5.5800e-01 3.0000e+00
++3.5800e-01 +5.6200e-01 3.0000e+00
++3.6200e-01 +5.6200e-01 3.0000e+00
++3.7800e-01 +5.5800e-01 3.0000e+00
++3.8200e-01 +5.5800e-01 3.0000e+00
++3.7800e-01 +5.6200e-01 3.0000e+00
++3.8200e-01 +5.6200e-01 3.0000e+00
++3.9800e-01 +5.5800e-01 3.0000e+00
++4.0200e-01 +5.5800e-01 3.0000e+00
++3.9800e-01 +5.6200e-01 3.0000e+00
++4.0200e-01 +5.6200e-01 3.0000e+00
++4.1800e-01 +5.5800e-01 3.0000e+00
++4.2200e-01 +5.5800e-01 3.0000e+00
++4.1800e-01 +5.6200e-01 3.0000e+00
++4.2200e-01 +5.6200e-01 3.0000e+00
++4.3800e-01 +5.5800e-01 3.0000e+00
++4.4200e-01 +5.5800e-01 3.0000e+00
++4.3800e-01 +5.6200e-01 3.0000e+00
++4.4200e-01 +5.6200e-01 3.0000e+00
++4.5800e-01 +5.5800e-01 3.0000e+00
++4.6200e-01 +5.5800e-01 3.0000e+00
++4.5800e-01 +5.6200e-01 3.0000e+00
++4.6200e-01 +5.6200e-01 3.0000e+00
++4.7800e-01 +5.5800e-01 3.0000e+00
++4.8200e-01 +5.5800e-01 3.0000e+00
++4.7800e-01 +5.6200e-01 3.0000e+00
++4.8200e-01 +5.6200e-01 3.0000e+00
++4.9800e-01 +5.5800e-01 3.0000e+00
++5.0200e-01 +5.5800e-01 3.0000e+00
++4.9800e-01 +5.6200e-01 3.0000e+00
++5.0200e-01 +5.6200e-01 3.0000e+00
++5.1800e-01 +5.5800e-01 3.0000e+00
++5.2200e-01 +5.5800e-01 3.0000e+00
++5.1800e-01 +5.6200e-01 3.0000e+00
++5.2200e-01 +5.6200e-01 3.0000e+00
++5.3800e-01 +5.5800e-01 3.0000e+00
++5.4200e-01 +5.5800e-01 3.0000e+00
++5.3800e-01 +5.6200e-01 3.0000e+00
++5.4200e-01 +5.6200e-01 3.0000e+00
++5.5800e-01 +5.5800e-01 3.0000e+00
++5.6200e-01 +5.5800e-01 3.0000e+00
++5.5800e-01 +5.6200e-01 3.0000e+00
++5.6200e-01 +5.6200e-01 3.0000e+00
++5.7800e-01 +5.5800e-01 3.0000e+00
++5.8200e-01 +5.5800e-01 3.0000e+00
++5.7800e-01 +5.6200e-01 3.0000e+00
++5.8200e-01 +5.6200e-01 3.0000e+00
++5.9800e-01 +5.5800e-01 3.0000e+00
++6.0200e-01 +5.5800e-01 3.0000e+00
++5.9800e-01 +5.6200e-01 3.0000e+00
++6.0200e-01 +5.6200e-01 3.0000e+00
++6.1800e-01 +5.5800e-01 3.0000e+00
++6.2200e-01 +5.5800e-01 3.0000e+00
++6.1800e-01 +5.6200e-01 3.0000e+00
++6.2200e-01 +5.6200e-01 3.0000e+00
++6.3800e-01 +5.5800e-01 3.0000e+00
++6.4200e-01 +5.5800e-01 3.0000e+00
++6.3800e-01 +5.6200e-01 3.0000e+00
++6.4200e-01 +5.6200e-01 3.0000e+00
++6.5800e-01 +5.5800e-01 3.0000e+00
++6.6200e-01 +5.5800e-01 3.0000e+00
++6.5800e-01 +5.6200e-01 3.0000e+00
++6.6200e-01 +5.6200e-01 3.0000e+00
++6.7800e-01 +5.5800e-01 3.0000e+00
++6.8200e-01 +5.5800e-01 3.0000e+00
++6.7800e-01 +5.6200e-01 3.0000e+00
++6.8200e-01 +5.6200e-01 3.0000e+00
++6.9800e-01 +5.5800e-01 3.0000e+00
++7.0200e-01 +5.5800e-01 3.0000e+00
++6.9800e-01 +5.6200e-01 3.0000e+00
++7.0200e-01 +5.6200e-01 3.0000e+00
++7.1800e-01 +5.5800e-01 3.0000e+00
++7.2200e-01 +5.5800e-01 3.0000e+00
++7.1800e-01 +5.6200e-01 3.0000e+00
++7.2200e-01 +5.6200e-01 3.0000e+00
++7.3800e-01 +5.5800e-01 3.0000e+00
++7.4200e-01 +5.5800e-01 3.0000e+00
++7.3800e-01 +5.6200e-01 3.0000e+00
++7.4200e-01 +5.6200e-01 3.0000e+00
++7.5800e-01 +5.5800e-01 3.0000e+00
++7.6200e-01 +5.5800e-01 3.0000e+00
++7.5800e-01 +5.6200e-01 3.0000e+00
++7.6200e-01 +5.6200e-01 3.0000e+00
++7.7800e-01 +5.5800e-01 3.0000e+00
++7.8200e-01 +5.5800e-01 3.0000e+00
++7.7800e-01 +5.6200e-01 3.0000e+00
++7.8200e-01 +5.6200e-01 3.0000e+00
++7.9800e-01 +5.5800e-01 3.0000e+00
++8.0200e-01 +5.5800e-01 3.0000e+00
++7.9800e-01 +5.6200e-01 3.0000e+00
++8.0200e-01 +5.6200e-01 3.0000e+00
++8.1800e-01 +5.5800e-01 3.0000e+00
++8.2200e-01 +5.5800e-01 3.0000e+00
++8.1800e-01 +5.6200e-01 3.0000e+00
++8.2200e-01 +5.6200e-01 3.0000e+00
++8.3800e-01 +5.5800e-01 3.0000e+00
++8.4200e-01 +5.5800e-01 3.0000e+00
++8.3800e-01 +5.6200e-01 3.0000e+00
++8.4200e-01 +5.6200e-01 3.0000e+00
++8.5800e-01 +5.5800e-01 3.0000e+00
++8.6200e-01 +5.5800e-01 3.0000e+00
++8.5800e-01 +5.6200e-01 3.0000e+00
++8.6200e-01 +5.6200e-01 3.0000e+00
++8.7800e-01 +5.5800e-01 3.0000e+00
++8.8200e-01 +5.5800e-01 3.0000e+00
++8.7800e-01 +5.6200e-01 3.0000e+00
++8.8200e-01 +5.6200e-01 3.0000e+00
++8.9800e-01 +5.5800e-01 3.0000e+00
++9.0200e-01 +5.5800e-01 3.0000e+00
++8.9800e-01 +5.6200e-01 3.0000e+00
++9.0200e-01 +5.6200e-01 3.0000e+00
++9.1800e-01 +5.5800e-01 3.0000e+00
++9.2200e-01 +5.5800e-01 3.0000e+00
++9.1800e-01 +5.6200e-01 3.0000e+00
++9.2200e-01 +5.6200e-01 3.0000e+00
++9.3800e-01 +5.5800e-01 3.0000e+00
++9.4200e-01 +5.5800e-01 3.0000e+00
++9.3800e-01 +5.6200e-01 3.0000e+00
++9.4200e-01 +5.6200e-01 3.0000e+00
++9.5800e-01 +5.5800e-01 3.0000e+00
++9.6200e-01 +5.5800e-01 3.0000e+00
++9.5800e-01 +5.6200e-01 3.0000e+00
++9.6200e-01 +5.6200e-01 3.0000e+00
++9.7800e-01 +5.5800e-01 3.0000e+00
++9.8200e-01 +5.5800e-01 3.0000e+00
++9.7800e-01 +5.6200e-01 3.0000e+00
++9.8200e-01 +5.6200e-01 3.0000e+00
++9.9800e-01 +5.5800e-01 3.0000e+00
++1.0020e+00 +5.5800e-01 3.0000e+00
++9.9800e-01 +5.6200e-01 3.0000e+00
++1.0020e+00 +5.6200e-01 3.0000e+00
++1.8000e-02 +5.7800e-01 3.0000e+00
++2.2000e-02 +5.7800e-01 3.0000e+00
++1.8000e-02 +5.8200e-01 3.0000e+00
++2.2000e-02 +5.8200e-01 3.0000e+00
++3.8000e-02 +5.7800e-01 3.0000e+00
++4.2000e-02 +5.7800e-01 3.0000e+00
++3.8000e-02 +5.8200e-01 3.0000e+00
++4.2000e-02 +5.8200e-01 3.0000e+00
++5.8000e-02 +5.7800e-01 3.0000e+00
++6.2000e-02 +5.7800e-01 3.0000e+00
++5.8000e-02 +5.8200e-01 3.0000e+00
++6.2000e-02 +5.8200e-01 3.0000e+00
++7.8000e-02 +5.7800e-01 3.0000e+00
++8.2000e-02 +5.7800e-01 3.0000e+00
++7.8000e-02 +5.8200e-01 3.0000e+00
++8.2000e-02 +5.8200e-01 3.0000e+00
++9.8000e-02 +5.7800e-01 3.0000e+00
++1.0200e-01 +5.7800e-01 3.0000e+00
++9.8000e-02 +5.8200e-01 3.0000e+00
++1.0200e-01 +5.8200e-01 3.0000e+00
++1.1800e-01 +5.7800e-01 3.0000e+00
++1.2200e-01 +5.7800e-01 3.0000e+00
++1.1800e-01 +5.8200e-01 3.0000e+00
++1.2200e-01 +5.8200e-01 3.0000e+00
++1.3800e-01 +5.7800e-01 3.0000e+00
++1.4200e-01 +5.7800e-01 3.0000e+00
++1.3800e-01 +5.8200e-01 3.0000e+00
++1.4200e-01 +5.8200e-01 3.0000e+00
++1.5800e-01 +5.7800e-01 3.0000e+00
++1.6200e-01 +5.7800e-01 3.0000e+00
++1.5800e-01 +5.8200e-01 3.0000e+00
++1.6200e-01 +5.8200e-01 3.0000e+00
++1.7800e-01 +5.7800e-01 3.0000e+00
++1.8200e-01 +5.7800e-01 3.0000e+00
++1.7800e-01 +5.8200e-01 3.0000e+00
++1.8200e-01 +5.8200e-01 3.0000e+00
++1.9800e-01 +5.7800e-01 3.0000e+00
++2.0200e-01 +5.7800e-01 3.0000e+00
++1.9800e-01 +5.8200e-01 3.0000e+00
++2.0200e-01 +5.8200e-01 3.0000e+00
++2.1800e-01 +5.7800e-01 3.0000e+00
++2.2200e-01 +5.7800e-01 3.0000e+00
++2.1800e-01 +5.8200e-01 3.0000e+00
++2.2200e-01 +5.8200e-01 3.0000e+00
++2.3800e-01 +5.7800e-01 3.0000e+00
++2.4200e-01 +5.7800e-01 3.0000e+00
++2.3800e-01 +5.8200e-01 3.0000e+00
++2.4200e-01 +5.8200e-01 3.0000e+00
++2.5800e-01 +5.7800e-01 3.0000e+00
++2.6200e-01 +5.7800e-01 3.0000e+00
++2.5800e-01 +5.8200e-01 3.0000e+00
++2.6200e-01 +5.8200e-01 3.0000e+00
++2.7800e-01 +5.7800e-01 3.0000e+00
++2.8200e-01 +5.7800e-01 3.0000e+00
++2.7800e-01 +5.8200e-01 3.0000e+00
++2.8200e-01 +5.8200e-01 3.0000e+00
++2.9800e-01 +5.7800e-01 3.0000e+00
++3.0200e-01 +5.7800e-01 3.0000e+00
++2.9800e-01 +5.8200e-01 3.0000e+00
++3.0200e-01 +5.8200e-01 3.0000e+00
++3.1800e-01 +5.7800e-01 3.0000e+00
++3.2200e-01 +5.7800e-01 3.0000e+00
++3.1800e-01 +5.8200e-01 3.0000e+00
++3.2200e-01 +5.8200e-01 3.0000e+00
++3.3800e-01 +5.7800e-01 3.0000e+00
++3.4200e-01 +5.7800e-01 3.0000e+00
++3.3800e-01 +5.8200e-01 3.0000e+00
++3.4200e-01 +5.8200e-01 3.0000e+00
++3.5800e-01 +5.7800e-01 3.0000e+00
++3.6200e-01 +5.7800e-01 3.0000e+00
++3.5800e-01 +5.8200e-01 3.0000e+00
++3.6200e-01 +5.8200e-01 3.0000e+00
++3.7800e-01 +5.7800e-01 3.0000e+00
++3.8200e-01 +5.7800e-01 3.0000e+00
++3.7800e-01 +5.8200e-01 3.0000e+00
++3.8200e-01 +5.8200e-01 3.0000e+00
++3.9800e-01 +5.7800e-01 3.0000e+00
++4.0200e-01 +5.7800e-01 3.0000e+00
++3.9800e-01 +5.8200e-01 3.0000e+00
++4.0200e-01 +5.8200e-01 3.0000e+00
++4.1800e-01 +5.7800e-01 3.0000e+00
++4.2200e-01 +5.7800e-01 3.0000e+00
++4.1800e-01 +5.8200e-01 3.0000e+00
++4.2200e-01 +5.8200e-01 3.0000e+00
++4.3800e-01 +5.7800e-01 3.0000e+00
++4.4200e-01 +5.7800e-01 3.0000e+00
++4.3800e-01 +5.8200e-01 3.0000e+00
++4.4200e-01 +5.8200e-01 3.0000e+00
++4.5800e-01 +5.7800e-01 3.0000e+00
++4.6200e-01 +5.7800e-01 3.0000e+00
++4.5800e-01 +5.8200e-01 3.0000e+00
++4.6200e-01 +5.8200e-01 3.0000e+00
++4.7800e-01 +5.7800e-01 3.0000e+00
++4.8200e-01 +5.7800e-01 3.0000e+00
++4.7800e-01 +5.8200e-01 3.0000e+00
++4.8200e-01 +5.8200e-01 3.0000e+00
++4.9800e-01 +5.7800e-01 3.0000e+00
++5.0200e-01 +5.7800e-01 3.0000e+00
++4.9800e-01 +5.8200e-01 3.0000e+00
++5.0200e-01 +5.8200e-01 3.0000e+00
++5.1800e-01 +5.7800e-01 3.0000e+00
++5.2200e-01 +5.7800e-01 3.0000e+00
++5.1800e-01 +5.8200e-01 3.0000e+00
++5.2200e-01 +5.8200e-01 3.0000e+00
++5.3800e-01 +5.7800e-01 3.0000e+00
++5.4200e-01 +5.7800e-01 3.0000e+00
++5.3800e-01 +5.8200e-01 3.0000e+00
++5.4200e-01 +5.8200e-01 3.0000e+00
++5.5800e-01 +5.7800e-01 3.0000e+00
++5.6200e-01 +5.7800e-01 3.0000e+00
++5.5800e-01 +5.8200e-01 3.0000e+00
++5.6200e-01 +5.8200e-01 3.0000e+00
++5.7800e-01 +5.7800e-01 3.0000e+00
++5.8200e-01 +5.7800e-01 3.0000e+00
++5.7800e-01 +5.8200e-01 3.0000e+00
++5.8200e-01 +5.8200e-01 3.0000e+00
++5.9800e-01 +5.7800e-01 3.0000e+00
++6.0200e-01 +5.7800e-01 3.0000e+00
++5.9800e-01 +5.8200e-01 3.0000e+00
++6.0200e-01 +5.8200e-01 3.0000e+00
++6.1800e-01 +5.7800e-01 3.0000e+00
++6.2200e-01 +5.7800e-01 3.0000e+00
++6.1800e-01 +5.8200e-01 3.0000e+00
++6.2200e-01 +5.8200e-01 3.0000e+00
++6.3800e-01 +5.7800e-01 3.0000e+00
++6.4200e-01 +5.7800e-01 3.0000e+00
++6.3800e-01 +5.8200e-01 3.0000e+00
++6.4200e-01 +5.8200e-01 3.0000e+00
++6.5800e-01 +5.7800e-01 3.0000e+00
++6.6200e-01 +5.7800e-01 3.0000e+00
++6.5800e-01 +5.8200e-01 3.0000e+00
++6.6200e-01 +5.8200e-01 3.0000e+00
++6.7800e-01 +5.7800e-01 3.0000e+00
++6.8200e-01 +5.7800e-01 3.0000e+00
++6.7800e-01 +5.8200e-01 3.0000e+00
++6.8200e-01 +5.8200e-01 3.0000e+00
++6.9800e-01 +5.7800e-01 3.0000e+00
++7.0200e-01 +5.7800e-01 3.0000e+00
++6.9800e-01 +5.8200e-01 3.0000e+00
++7.0200e-01 +5.8200e-01 3.0000e+00
++7.1800e-01 +5.7800e-01 3.0000e+00
++7.2200e-01 +5.7800e-01 3.0000e+00
++7.1800e-01 +5.8200e-01 3.0000e+00
++7.2200e-01 +5.8200e-01 3.0000e+00
++7.3800e-01 +5.7800e-01 3.0000e+00
++7.4200e-01 +5.7800e-01 3.0000e+00
++7.3800e-01 +5.8200e-01 3.0000e+00
++7.4200e-01 +5.8200e-01 3.0000e+00
++7.5800e-01 +5.7800e-01 3.0000e+00
++7.6200e-01 +5.7800e-01 3.0000e+00
++7.5800e-01 +5.8200e-01 3.0000e+00
++7.6200e-01 +5.8200e-01 3.0000e+00
++7.7800e-01 +5.7800e-01 3.0000e+00
++7.8200e-01 +5.7800e-01 3.0000e+00
++7.7800e-01 +5.8200e-01 3.0000e+00
++7.8200e-01 +5.8200e-01 3.0000e+00
++7.9800e-01 +5.7800e-01 3.0000e+00
++8.0200e-01 +5.7800e-01 3.0000e+00
++7.9800e-01 +5.8200e-01 3.0000e+00
++8.0200e-01 +5.8200e-01 3.0000e+00
++8.1800e-01 +5.7800e-01 3.0000e+00
++8.2200e-01 +5.7800e-01 3.0000e+00
++8.1800e-01 +5.8200e-01 3.0000e+00
++8.2200e-01 +5.8200e-01 3.0000e+00
++8.3800e-01 +5.7800e-01 3.0000e+00
++8.4200e-01 +5.7800e-01 3.0000e+00
++8.3800e-01 +5.8200e-01 3.0000e+00
++8.4200e-01 +5.8200e-01 3.0000e+00
++8.5800e-01 +5.7800e-01 3.0000e+00
++8.6200e-01 +5.7800e-01 3.0000e+00
++8.5800e-01 +5.8200e-01 3.0000e+00
++8.6200e-01 +5.8200e-01 3.0000e+00
++8.7800e-01 +5.7800e-01 3.0000e+00
++8.8200e-01 +5.7800e-01 3.0000e+00
++8.7800e-01 +5.8200e-01 3.0000e+00
++8.8200e-01 +5.8200e-01 3.0000e+00
++8.9800e-01 +5.7800e-01 3.0000e+00
++9.0200e-01 +5.7800e-01 3.0000e+00
++8.9800e-01 +5.8200e-01 3.0000e+00
++9.0200e-01 +5.8200e-01 3.0000e+00
++9.1800e-01 +5.7800e-01 3.0000e+00
++9.2200e-01 +5.7800e-01 3.0000e+00
++9.1800e-01 +5.8200e-01 3.0000e+00
++9.2200e-01 +5.8200e-01 3.0000e+00
++9.3800e-01 +5.7800e-01 3.0000e+00
++9.4200e-01 +5.7800e-01 3.0000e+00
++9.3800e-01 +5.8200e-01 3.0000e+00
++9.4200e-01 +5.8200e-01 3.0000e+00
++9.5800e-01 +5.7800e-01 3.0000e+00
++9.6200e-01 +5.7800e-01 3.0000e+00
++9.5800e-01 +5.8200e-01 3.0000e+00
++9.6200e-01 +5.8200e-01 3.0000e+00
++9.7800e-01 +5.7800e-01 3.0000e+00
++9.8200e-01 +5.7800e-01 3.0000e+00
++9.7800e-01 +5.8200e-01 3.0000e+00
++9.8200e-01 +5.8200e-01 3.0000e+00
++9.9800e-01 +5.7800e-01 3.0000e+00
++1.0020e+00 +5.7800e-01 3.0000e+00
++9.9800e-01 +5.8200e-01 3.0000e+00
++1.0020e+00 +5.8200e-01 3.0000e+00
++1.8000e-02 +5.9800e-01 3.0000e+00
++2.2000e-02 +5.9800e-01 3.0000e+00
++1.8000e-02 +6.0200e-01 3.0000e+00
++2.2000e-02 +6.0200e-01 3.0000e+00
++3.8000e-02 +5.9800e-01 3.0000e+00
++4.2000e-02 +5.9800e-01 3.0000e+00
++3.8000e-02 +6.0200e-01 3.0000e+00
++4.2000e-02 +6.0200e-01 3.0000e+00
++5.8000e-02 +5.9800e-01 3.0000e+00
++6.2000e-02 +5.9800e-01 3.0000e+00
++5.8000e-02 +6.0200e-01 3.0000e+00
++6.2000e-02 +6.0200e-01 3.0000e+00
++7.8000e-02 +5.9800e-01 3.0000e+00
++8.2000e-02 +5.9800e-01 3.0000e+00
++7.8000e-02 +6.0200e-01 3.0000e+00
++8.2000e-02 +6.0200e-01 3.0000e+00
++9.8000e-02 +5.9800e-01 3.0000e+00
++1.0200e-01 +5.9800e-01 3.0000e+00
++9.8000e-02 +6.0200e-01 3.0000e+00
++1.0200e-01 +6.0200e-01 3.0000e+00
++1.1800e-01 +5.9800e-01 3.0000e+00
++1.2200e-01 +5.9800e-01 3.0000e+00
++1.1800e-01 +6.0200e-01 3.0000e+00
++1.2200e-01 +6.0200e-01 3.0000e+00
++1.3800e-01 +5.9800e-01 3.0000e+00
++1.4200e-01 +5.9800e-01 3.0000e+00
++1.3800e-01 +6.0200e-01 3.0000e+00
++1.4200e-01 +6.0200e-01 3.0000e+00
++1.5800e-01 +5.9800e-01 3.0000e+00
++1.6200e-01 +5.9800e-01 3.0000e+00
++1.5800e-01 +6.0200e-01 3.0000e+00
++1.6200e-01 +6.0200e-01 3.0000e+00
++1.7800e-01 +5.9800e-01 3.0000e+00
++1.8200e-01 +5.9800e-01 3.0000e+00
++1.7800e-01 +6.0200e-01 3.0000e+00
++1.8200e-01 +6.0200e-01 3.0000e+00
++1.9800e-01 +5.9800e-01 3.0000e+00
++2.0200e-01 +5.9800e-01 3.0000e+00
++1.9800e-01 +6.0200e-01 3.0000e+00
++2.0200e-01 +6.0200e-01 3.0000e+00
++2.1800e-01 +5.9800e-01 3.0000e+00
++2.2200e-01 +5.9800e-01 3.0000e+00
++2.1800e-01 +6.0200e-01 3.0000e+00
++2.2200e-01 +6.0200e-01 3.0000e+00
++2.3800e-01 +5.9800e-01 3.0000e+00
++2.4200e-01 +5.9800e-01 3.0000e+00
++2.3800e-01 +6.0200e-01 3.0000e+00
++2.4200e-01 +6.0200e-01 3.0000e+00
++2.5800e-01 +5.9800e-01 3.0000e+00
++2.6200e-01 +5.9800e-01 3.0000e+00
++2.5800e-01 +6.0200e-01 3.0000e+00
++2.6200e-01 +6.0200e-01 3.0000e+00
++2.7800e-01 +5.9800e-01 3.0000e+00
++2.8200e-01 +5.9800e-01 3.0000e+00
++2.7800e-01 +6.0200e-01 3.0000e+00
++2.8200e-01 +6.0200e-01 3.0000e+00
++2.9800e-01 +5.9800e-01 3.0000e+00
++3.0200e-01 +5.9800e-01 3.0000e+00
++2.9800e-01 +6.0200e-01 3.0000e+00
++3.0200e-01 +6.0200e-01 3.0000e+00
++3.1800e-01 +5.9800e-01 3.0000e+00
++3.2200e-01 +5.9800e-01 3.0000e+00
++3.1800e-01 +6.0200e-01 3.0000e+00
++3.2200e-01 +6.0200e-01 3.0000e+00
++3.3800e-01 +5.9800e-01 3.0000e+00
++3.4200e-01 +5.9800e-01 3.0000e+00
++3.3800e-01 +6.0200e-01 3.0000e+00
++3.4200e-01 +6.0200e-01 3.0000e+00
++3.5800e-01 +5.9800e-01 3.0000e+00
++3.6200e-01 +5.9800e-01 3.0000e+00
++3.5800e-01 +6.0200e-01 3.0000e+00
++3.6200e-01 +6.0200e-01 3.0000e+00
++3.7800e-01 +5.9800e-01 3.0000e+00
++3.8200e-01 +5.9800e-01 3.0000e+00
++3.7800e-01 +6.0200e-01 3.0000e+00
++3.8200e-01 +6.0200e-01 3.0000e+00
++3.9800e-01 +5.9800e-01 3.0000e+00
++4.0200e-01 +5.9800e-01 3.0000e+00
++3.9800e-01 +6.0200e-01 3.0000e+00
++4.0200e-01 +6.0200e-01 3.0000e+00
++4.1800e-01 +5.9800e-01 3.0000e+00
++4.2200e-01 +5.9800e-01 3.0000e+00
++4.1800e-01 +6.0200e-01 3.0000e+00
++4.2200e-01 +6.0200e-01 3.0000e+00
++4.3800e-01 +5.9800e-01 3.0000e+00
++4.4200e-01 +5.9800e-01 3.0000e+00
++4.3800e-01 +6.0200e-01 3.0000e+00
++4.4200e-01 +6.0200e-01 3.0000e+00
++4.5800e-01 +5.9800e-01 3.0000e+00
++4.6200e-01 +5.9800e-01 3.0000e+00
++4.5800e-01 +6.0200e-01 3.0000e+00
++4.6200e-01 +6.0200e-01 3.0000e+00
++4.7800e-01 +5.9800e-01 3.0000e+00
++4.8200e-01 +5.9800e-01 3.0000e+00
++4.7800e-01 +6.0200e-01 3.0000e+00
++4.8200e-01 +6.0200e-01 3.0000e+00
++4.9800e-01 +5.9800e-01 3.0000e+00
++5.0200e-01 +5.9800e-01 3.0000e+00
++4.9800e-01 +6.0200e-01 3.0000e+00
++5.0200e-01 +6.0200e-01 3.0000e+00
++5.1800e-01 +5.9800e-01 3.0000e+00
++5.2200e-01 +5.9800e-01 3.0000e+00
++5.1800e-01 +6.0200e-01 3.0000e+00
++5.2200e-01 +6.0200e-01 3.0000e+00
++5.3800e-01 +5.9800e-01 3.0000e+00
++5.4200e-01 +5.9800e-01 3.0000e+00
++5.3800e-01 +6.0200e-01 3.0000e+00
++5.4200e-01 +6.0200e-01 3.0000e+00
++5.5800e-01 +5.9800e-01 3.0000e+00
++5.6200e-01 +5.9800e-01 3.0000e+00
++5.5800e-01 +6.0200e-01 3.0000e+00
++5.6200e-01 +6.0200e-01 3.0000e+00
++5.7800e-01 +5.9800e-01 3.0000e+00
++5.8200e-01 +5.9800e-01 3.0000e+00
++5.7800e-01 +6.0200e-01 3.0000e+00
++5.8200e-01 +6.0200e-01 3.0000e+00
++5.9800e-01 +5.9800e-01 3.0000e+00
++6.0200e-01 +5.9800e-01 3.0000e+00
++5.9800e-01 +6.0200e-01 3.0000e+00
++6.0200e-01 +6.0200e-01 3.0000e+00
++6.1800e-01 +5.9800e-01 3.0000e+00
++6.2200e-01 +5.9800e-01 3.0000e+00
++6.1800e-01 +6.0200e-01 3.0000e+00
++6.2200e-01 +6.0200e-01 3.0000e+00
++6.3800e-01 +5.9800e-01 3.0000e+00
++6.4200e-01 +5.9800e-01 3.0000e+00
++6.3800e-01 +6.0200e-01 3.0000e+00
++6.4200e-01 +6.0200e-01 3.0000e+00
++6.5800e-01 +5.9800e-01 3.0000e+00
++6.6200e-01 +5.9800e-01 3.0000e+00
++6.5800e-01 +6.0200e-01 3.0000e+00
++6.6200e-01 +6.0200e-01 3.0000e+00
++6.7800e-01 +5.9800e-01 3.0000e+00
++6.8200e-01 +5.9800e-01 3.0000e+00
++6.7800e-01 +6.0200e-01 3.0000e+00
++6.8200e-01 +6.0200e-01 3.0000e+00
++6.9800e-01 +5.9800e-01 3.0000e+00
++7.0200e-01 +5.9800e-01 3.0000e+00
++6.9800e-01 +6.0200e-01 3.0000e+00
++7.0200e-01 +6.0200e-01 3.0000e+00
++7.1800e-01 +5.9800e-01 3.0000e+00
++7.2200e-01 +5.9800e-01 3.0000e+00
++7.1800e-01 +6.0200e-01 3.0000e+00
++7.2200e-01 +6.0200e-01 3.0000e+00
++7.3800e-01 +5.9800e-01 3.0000e+00
++7.4200e-01 +5.9800e-01 3.0000e+00
++7.3800e-01 +6.0200e-01 3.0000e+00
++7.4200e-01 +6.0200e-01 3.0000e+00
++7.5800e-01 +5.9800e-01 3.0000e+00
++7.6200e-01 +5.9800e-01 3.0000e+00
++7.5800e-01 +6.0200e-01 3.0000e+00
++7.6200e-01 +6.0200e-01 3.0000e+00
++7.7800e-01 +5.9800e-01 3.0000e+00
++7.8200e-01 +5.9800e-01 3.0000e+00
++7.7800e-01 +6.0200e-01 3.0000e+00
++7.8200e-01 +6.0200e-01 3.0000e+00
++7.9800e-01 +5.9800e-01 3.0000e+00
++8.0200e-01 +5.9800e-01 3.0000e+00
++7.9800e-01 +6.0200e-01 3.0000e+00
++8.0200e-01 +6.0200e-01 3.0000e+00
++8.1800e-01 +5.9800e-01 3.0000e+00
++8.2200e-01 +5.9800e-01 3.0000e+00
++8.1800e-01 +6.0200e-01 3.0000e+00
++8.2200e-01 +6.0200e-01 3.0000e+00
++8.3800e-01 +5.9800e-01 3.0000e+00
++8.4200e-01 +5.9800e-01 3.0000e+00
++8.3800e-01 +6.0200e-01 3.0000e+00
++8.4200e-01 +6.0200e-01 3.0000e+00
++8.5800e-01 +5.9800e-01 3.0000e+00
++8.6200e-01 +5.9800e-01 3.0000e+00
++8.5800e-01 +6.0200e-01 3.0000e+00
++8.6200e-01 +6.0200e-01 3.0000e+00
++8.7800e-01 +5.9800e-01 3.0000e+00
++8.8200e-01 +5.9800e-01 3.0000e+00
++8.7800e-01 +6.0200e-01 3.0000e+00
++8.8200e-01 +6.0200e-01 3.0000e+00
++8.9800e-01 +5.9800e-01 3.0000e+00
++9.0200e-01 +5.9800e-01 3.0000e+00
++8.9800e-01 +6.0200e-01 3.0000e+00
++9.0200e-01 +6.0200e-01 3.0000e+00
++9.1800e-01 +5.9800e-01 3.0000e+00
++9.2200e-01 +5.9800e-01 3.0000e+00
++9.1800e-01 +6.0200e-01 3.0000e+00
++9.2200e-01 +6.0200e-01 3.0000e+00
++9.3800e-01 +5.9800e-01 3.0000e+00
++9.4200e-01 +5.9800e-01 3.0000e+00
++9.3800e-01 +6.0200e-01 3.0000e+00
++9.4200e-01 +6.0200e-01 3.0000e+00
++9.5800e-01 +5.9800e-01 3.0000e+00
++9.6200e-01 +5.9800e-01 3.0000e+00
++9.5800e-01 +6.0200e-01 3.0000e+00
++9.6200e-01 +6.0200e-01 3.0000e+00
++9.7800e-01 +5.9800e-01 3.0000e+00
++9.8200e-01 +5.9800e-01 3.0000e+00
++9.7800e-01 +6.0200e-01 3.0000e+00
++9.8200e-01 +6.0200e-01 3.0000e+00
++9.9800e-01 +5.9800e-01 3.0000e+00
++1.0020e+00 +5.9800e-01 3.0000e+00
++9.9800e-01 +6.0200e-01 3.0000e+00
++1.0020e+00 +6.0200e-01 3.0000e+00
++1.8000e-02 +6.1800e-01 3.0000e+00
++2.2000e-02 +6.1800e-01 3.0000e+00
++1.8000e-02 +6.2200e-01 3.0000e+00
++2.2000e-02 +6.2200e-01 3.0000e+00
++3.8000e-02 +6.1800e-01 3.0000e+00
++4.2000e-02 +6.1800e-01 3.0000e+00
++3.8000e-02 +6.2200e-01 3.0000e+00
++4.2000e-02 +6.2200e-01 3.0000e+00
++5.8000e-02 +6.1800e-01 3.0000e+00
++6.2000e-02 +6.1800e-01 3.0000e+00
++5.8000e-02 +6.2200e-01 3.0000e+00
++6.2000e-02 +6.2200e-01 3.0000e+00
++7.8000e-02 +6.1800e-01 3.0000e+00
++8.2000e-02 +6.1800e-01 3.0000e+00
++7.8000e-02 +6.2200e-01 3.0000e+00
++8.2000e-02 +6.2200e-01 3.0000e+00
++9.8000e-02 +6.1800e-01 3.0000e+00
++1.0200e-01 +6.1800e-01 3.0000e+00
++9.8000e-02 +6.2200e-01 3.0000e+00
++1.0200e-01 +6.2200e-01 3.0000e+00
++1.1800e-01 +6.1800e-01 3.0000e+00
++1.2200e-01 +6.1800e-01 3.0000e+00
++1.1800e-01 +6.2200e-01 3.0000e+00
++1.2200e-01 +6.2200e-01 3.0000e+00
++1.3800e-01 +6.1800e-01 3.0000e+00
++1.4200e-01 +6.1800e-01 3.0000e+00
++1.3800e-01 +6.2200e-01 3.0000e+00
++1.4200e-01 +6.2200e-01 3.0000e+00
++1.5800e-01 +6.1800e-01 3.0000e+00
++1.6200e-01 +6.1800e-01 3.0000e+00
++1.5800e-01 +6.2200e-01 3.0000e+00
++1.6200e-01 +6.2200e-01 3.0000e+00
++1.7800e-01 +6.1800e-01 3.0000e+00
++1.8200e-01 +6.1800e-01 3.0000e+00
++1.7800e-01 +6.2200e-01 3.0000e+00
++1.8200e-01 +6.2200e-01 3.0000e+00
++1.9800e-01 +6.1800e-01 3.0000e+00
++2.0200e-01 +6.1800e-01 3.0000e+00
++1.9800e-01 +6.2200e-01 3.0000e+00
++2.0200e-01 +6.2200e-01 3.0000e+00
++2.1800e-01 +6.1800e-01 3.0000e+00
++2.2200e-01 +6.1800e-01 3.0000e+00
++2.1800e-01 +6.2200e-01 3.0000e+00
++2.2200e-01 +6.2200e-01 3.0000e+00
++2.3800e-01 +6.1800e-01 3.0000e+00
++2.4200e-01 +6.1800e-01 3.0000e+00
++2.3800e-01 +6.2200e-01 3.0000e+00
++2.4200e-01 +6.2200e-01 3.0000e+00
++2.5800e-01 +6.1800e-01 3.0000e+00
++2.6200e-01 +6.1800e-01 3.0000e+00
++2.5800e-01 +6.2200e-01 3.0000e+00
++2.6200e-01 +6.2200e-01 3.0000e+00
++2.7800e-01 +6.1800e-01 3.0000e+00
++2.8200e-01 +6.1800e-01 3.0000e+00
++2.7800e-01 +6.2200e-01 3.0000e+00
++2.8200e-01 +6.2200e-01 3.0000e+00
++2.9800e-01 +6.1800e-01 3.0000e+00
++3.0200e-01 +6.1800e-01 3.0000e+00
++2.9800e-01 +6.2200e-01 3.0000e+00
++3.0200e-01 +6.2200e-01 3.0000e+00
++3.1800e-01 +6.1800e-01 3.0000e+00
++3.2200e-01 +6.1800e-01 3.0000e+00
++3.1800e-01 +6.2200e-01 3.0000e+00
++3.2200e-01 +6.2200e-01 3.0000e+00
++3.3800e-01 +6.1800e-01 3.0000e+00
++3.4200e-01 +6.1800e-01 3.0000e+00
++3.3800e-01 +6.2200e-01 3.0000e+00
++3.4200e-01 +6.2200e-01 3.0000e+00
++3.5800e-01 +6.1800e-01 3.0000e+00
++3.6200e-01 +6.1800e-01 3.0000e+00
++3.5800e-01 +6.2200e-01 3.0000e+00
++3.6200e-01 +6.2200e-01 3.0000e+00
++3.7800e-01 +6.1800e-01 3.0000e+00
++3.8200e-01 +6.1800e-01 3.0000e+00
++3.7800e-01 +6.2200e-01 3.0000e+00
++3.8200e-01 +6.2200e-01 3.0000e+00
++3.9800e-01 +6.1800e-01 3.0000e+00
++4.0200e-01 +6.1800e-01 3.0000e+00
++3.9800e-01 +6.2200e-01 3.0000e+00
++4.0200e-01 +6.2200e-01 3.0000e+00
++4.1800e-01 +6.1800e-01 3.0000e+00
++4.2200e-01 +6.1800e-01 3.0000e+00
++4.1800e-01 +6.2200e-01 3.0000e+00
++4.2200e-01 +6.2200e-01 3.0000e+00
++4.3800e-01 +6.1800e-01 3.0000e+00
++4.4200e-01 +6.1800e-01 3.0000e+00
++4.3800e-01 +6.2200e-01 3.0000e+00
++4.4200e-01 +6.2200e-01 3.0000e+00
++4.5800e-01 +6.1800e-01 3.0000e+00
++4.6200e-01 +6.1800e-01 3.0000e+00
++4.5800e-01 +6.2200e-01 3.0000e+00
++4.6200e-01 +6.2200e-01 3.0000e+00
++4.7800e-01 +6.1800e-01 3.0000e+00
++4.8200e-01 +6.1800e-01 3.0000e+00
++4.7800e-01 +6.2200e-01 3.0000e+00
++4.8200e-01 +6.2200e-01 3.0000e+00
++4.9800e-01 +6.1800e-01 3.0000e+00
++5.0200e-01 +6.1800e-01 3.0000e+00
++4.9800e-01 +6.2200e-01 3.0000e+00
++5.0200e-01 +6.2200e-01 3.0000e+00
++5.1800e-01 +6.1800e-01 3.0000e+00
++5.2200e-01 +6.1800e-01 3.0000e+00
++5.1800e-01 +6.2200e-01 3.0000e+00
++5.2200e-01 +6.2200e-01 3.0000e+00
++5.3800e-01 +6.1800e-01 3.0000e+00
++5.4200e-01 +6.1800e-01 3.0000e+00
++5.3800e-01 +6.2200e-01 3.0000e+00
++5.4200e-01 +6.2200e-01 3.0000e+00
++5.5800e-01 +6.1800e-01 3.0000e+00
++5.6200e-01 +6.1800e-01 3.0000e+00
++5.5800e-01 +6.2200e-01 3.0000e+00
++5.6200e-01 +6.2200e-01 3.0000e+00
++5.7800e-01 +6.1800e-01 3.0000e+00
++5.8200e-01 +6.1800e-01 3.0000e+00
++5.7800e-01 +6.2200e-01 3.0000e+00
++5.8200e-01 +6.2200e-01 3.0000e+00
++5.9800e-01 +6.1800e-01 3.0000e+00
++6.0200e-01 +6.1800e-01 3.0000e+00
++5.9800e-01 +6.2200e-01 3.0000e+00
++6.0200e-01 +6.2200e-01 3.0000e+00
++6.1800e-01 +6.1800e-01 3.0000e+00
++6.2200e-01 +6.1800e-01 3.0000e+00
++6.1800e-01 +6.2200e-01 3.0000e+00
++6.2200e-01 +6.2200e-01 3.0000e+00
++6.3800e-01 +6.1800e-01 3.0000e+00
++6.4200e-01 +6.1800e-01 3.0000e+00
++6.3800e-01 +6.2200e-01 3.0000e+00
++6.4200e-01 +6.2200e-01 3.0000e+00
++6.5800e-01 +6.1800e-01 3.0000e+00
++6.6200e-01 +6.1800e-01 3.0000e+00
++6.5800e-01 +6.2200e-01 3.0000e+00
++6.6200e-01 +6.2200e-01 3.0000e+00
++6.7800e-01 +6.1800e-01 3.0000e+00
++6.8200e-01 +6.1800e-01 3.0000e+00
++6.7800e-01 +6.2200e-01 3.0000e+00
++6.8200e-01 +6.2200e-01 3.0000e+00
++6.9800e-01 +6.1800e-01 3.0000e+00
++7.0200e-01 +6.1800e-01 3.0000e+00
++6.9800e-01 +6.2200e-01 3.0000e+00
++7.0200e-01 +6.2200e-01 3.0000e+00
++7.1800e-01 +6.1800e-01 3.0000e+00
++7.2200e-01 +6.1800e-01 3.0000e+00
++7.1800e-01 +6.2200e-01 3.0000e+00
++7.2200e-01 +6.2200e-01 3.0000e+00
++7.3800e-01 +6.1800e-01 3.0000e+00
++7.4200e-01 +6.1800e-01 3.0000e+00
++7.3800e-01 +6.2200e-01 3.0000e+00
++7.4200e-01 +6.2200e-01 3.0000e+00
++7.5800e-01 +6.1800e-01 3.0000e+00
++7.6200e-01 +6.1800e-01 3.0000e+00
++7.5800e-01 +6.2200e-01 3.0000e+00
++7.6200e-01 +6.2200e-01 3.0000e+00
++7.7800e-01 +6.1800e-01 3.0000e+00
++7.8200e-01 +6.1800e-01 3.0000e+00
++7.7800e-01 +6.2200e-01 3.0000e+00
++7.8200e-01 +6.2200e-01 3.0000e+00
++7.9800e-01 +6.1800e-01 3.0000e+00
++8.0200e-01 +6.1800e-01 3.0000e+00
++7.9800e-01 +6.2200e-01 3.0000e+00
++8.0200e-01 +6.2200e-01 3.0000e+00
++8.1800e-01 +6.1800e-01 3.0000e+00
++8.2200e-01 +6.1800e-01 3.0000e+00
++8.1800e-01 +6.2200e-01 3.0000e+00
++8.2200e-01 +6.2200e-01 3.0000e+00
++8.3800e-01 +6.1800e-01 3.0000e+00
++8.4200e-01 +6.1800e-01 3.0000e+00
++8.3800e-01 +6.2200e-01 3.0000e+00
++8.4200e-01 +6.2200e-01 3.0000e+00
++8.5800e-01 +6.1800e-01 3.0000e+00
++8.6200e-01 +6.1800e-01 3.0000e+00
++8.5800e-01 +6.2200e-01 3.0000e+00
++8.6200e-01 +6.2200e-01 3.0000e+00
++8.7800e-01 +6.1800e-01 3.0000e+00
++8.8200e-01 +6.1800e-01 3.0000e+00
++8.7800e-01 +6.2200e-01 3.0000e+00
++8.8200e-01 +6.2200e-01 3.0000e+00
++8.9800e-01 +6.1800e-01 3.0000e+00
++9.0200e-01 +6.1800e-01 3.0000e+00
++8.9800e-01 +6.2200e-01 3.0000e+00
++9.0200e-01 +6.2200e-01 3.0000e+00
++9.1800e-01 +6.1800e-01 3.0000e+00
++9.2200e-01 +6.1800e-01 3.0000e+00
++9.1800e-01 +6.2200e-01 3.0000e+00
++9.2200e-01 +6.2200e-01 3.0000e+00
++9.3800e-01 +6.1800e-01 3.0000e+00
++9.4200e-01 +6.1800e-01 3.0000e+00
++9.3800e-01 +6.2200e-01 3.0000e+00
++9.4200e-01 +6.2200e-01 3.0000e+00
++9.5800e-01 +6.1800e-01 3.0000e+00
++9.6200e-01 +6.1800e-01 3.0000e+00
++9.5800e-01 +6.2200e-01 3.0000e+00
++9.6200e-01 +6.2200e-01 3.0000e+00
++9.7800e-01 +6.1800e-01 3.0000e+00
++9.8200e-01 +6.1800e-01 3.0000e+00
++9.7800e-01 +6.2200e-01 3.0000e+00
++9.8200e-01 +6.2200e-01 3.0000e+00
++9.9800e-01 +6.1800e-01 3.0000e+00
++1.0020e+00 +6.1800e-01 3.0000e+00
++9.9800e-01 +6.2200e-01 3.0000e+00
++1.0020e+00 +6.2200e-01 3.0000e+00
++1.8000e-02 +6.3800e-01 3.0000e+00
++2.2000e-02 +6.3800e-01 3.0000e+00
++1.8000e-02 +6.4200e-01 3.0000e+00
++2.2000e-02 +6.4200e-01 3.0000e+00
++3.8000e-02 +6.3800e-01 3.0000e+00
++4.2000e-02 +6.3800e-01 3.0000e+00
++3.8000e-02 +6.4200e-01 3.0000e+00
++4.2000e-02 +6.4200e-01 3.0000e+00
++5.8000e-02 +6.3800e-01 3.0000e+00
++6.2000e-02 +6.3800e-01 3.0000e+00
++5.8000e-02 +6.4200e-01 3.0000e+00
++6.2000e-02 +6.4200e-01 3.0000e+00
++7.8000e-02 +6.3800e-01 3.0000e+00
++8.2000e-02 +6.3800e-01 3.0000e+00
++7.8000e-02 +6.4200e-01 3.0000e+00
++8.2000e-02 +6.4200e-01 3.0000e+00
++9.8000e-02 +6.3800e-01 3.0000e+00
++1.0200e-01 +6.3800e-01 3.0000e+00
++9.8000e-02 +6.4200e-01 3.0000e+00
++1.0200e-01 +6.4200e-01 3.0000e+00
++1.1800e-01 +6.3800e-01 3.0000e+00
++1.2200e-01 +6.3800e-01 3.0000e+00
++1.1800e-01 +6.4200e-01 3.0000e+00
++1.2200e-01 +6.4200e-01 3.0000e+00
++1.3800e-01 +6.3800e-01 3.0000e+00
++1.4200e-01 +6.3800e-01 3.0000e+00
++1.3800e-01 +6.4200e-01 3.0000e+00
++1.4200e-01 +6.4200e-01 3.0000e+00
++1.5800e-01 +6.3800e-01 3.0000e+00
++1.6200e-01 +6.3800e-01 3.0000e+00
++1.5800e-01 +6.4200e-01 3.0000e+00
++1.6200e-01 +6.4200e-01 3.0000e+00
++1.7800e-01 +6.3800e-01 3.0000e+00
++1.8200e-01 +6.3800e-01 3.0000e+00
++1.7800e-01 +6.4200e-01 3.0000e+00
++1.8200e-01 +6.4200e-01 3.0000e+00
++1.9800e-01 +6.3800e-01 3.0000e+00
++2.0200e-01 +6.3800e-01 3.0000e+00
++1.9800e-01 +6.4200e-01 3.0000e+00
++2.0200e-01 +6.4200e-01 3.0000e+00
++2.1800e-01 +6.3800e-01 3.0000e+00
++2.2200e-01 +6.3800e-01 3.0000e+00
++2.1800e-01 +6.4200e-01 3.0000e+00
++2.2200e-01 +6.4200e-01 3.0000e+00
++2.3800e-01 +6.3800e-01 3.0000e+00
++2.4200e-01 +6.3800e-01 3.0000e+00
++2.3800e-01 +6.4200e-01 3.0000e+00
++2.4200e-01 +6.4200e-01 3.0000e+00
++2.5800e-01 +6.3800e-01 3.0000e+00
++2.6200e-01 +6.3800e-01 3.0000e+00
++2.5800e-01 +6.4200e-01 3.0000e+00
++2.6200e-01 +6.4200e-01 3.0000e+00
++2.7800e-01 +6.3800e-01 3.0000e+00
++2.8200e-01 +6.3800e-01 3.0000e+00
++2.7800e-01 +6.4200e-01 3.0000e+00
++2.8200e-01 +6.4200e-01 3.0000e+00
++2.9800e-01 +6.3800e-01 3.0000e+00
++3.0200e-01 +6.3800e-01 3.0000e+00
++2.9800e-01 +6.4200e-01 3.0000e+00
++3.0200e-01 +6.4200e-01 3.0000e+00
++3.1800e-01 +6.3800e-01 3.0000e+00
++3.2200e-01 +6.3800e-01 3.0000e+00
++3.1800e-01 +6.4200e-01 3.0000e+00
++3.2200e-01 +6.4200e-01 3.0000e+00
++3.3800e-01 +6.3800e-01 3.0000e+00
++3.4200e-01 +6.3800e-01 3.0000e+00
++3.3800e-01 +6.4200e-01 3.0000e+00
++3.4200e-01 +6.4200e-01 3.0000e+00
++3.5800e-01 +6.3800e-01 3.0000e+00
++3.6200e-01 +6.3800e-01 3.0000e+00
++3.5800e-01 +6.4200e-01 3.0000e+00
++3.6200e-01 +6.4200e-01 3.0000e+00
++3.7800e-01 +6.3800e-01 3.0000e+00
++3.8200e-01 +6.3800e-01 3.0000e+00
++3.7800e-01 +6.4200e-01 3.0000e+00
++3.8200e-01 +6.4200e-01 3.0000e+00
++3.9800e-01 +6.3800e-01 3.0000e+00
++4.0200e-01 +6.3800e-01 3.0000e+00
++3.9800e-01 +6.4200e-01 3.0000e+00
++4.0200e-01 +6.4200e-01 3.0000e+00
++4.1800e-01 +6.3800e-01 3.0000e+00
++4.2200e-01 +6.3800e-01 3.0000e+00
++4.1800e-01 +6.4200e-01 3.0000e+00
++4.2200e-01 +6.4200e-01 3.0000e+00
++4.3800e-01 +6.3800e-01 3.0000e+00
++4.4200e-01 +6.3800e-01 3.0000e+00
++4.3800e-01 +6.4200e-01 3.0000e+00
++4.4200e-01 +6.4200e-01 3.0000e+00
++4.5800e-01 +6.3800e-01 3.0000e+00
++4.6200e-01 +6.3800e-01 3.0000e+00
++4.5800e-01 +6.4200e-01 3.0000e+00
++4.6200e-01 +6.4200e-01 3.0000e+00
++4.7800e-01 +6.3800e-01 3.0000e+00
++4.8200e-01 +6.3800e-01 3.0000e+00
++4.7800e-01 +6.4200e-01 3.0000e+00
++4.8200e-01 +6.4200e-01 3.0000e+00
++4.9800e-01 +6.3800e-01 3.0000e+00
++5.0200e-01 +6.3800e-01 3.0000e+00
++4.9800e-01 +6.4200e-01 3.0000e+00
++5.0200e-01 +6.4200e-01 3.0000e+00
++5.1800e-01 +6.3800e-01 3.0000e+00
++5.2200e-01 +6.3800e-01 3.0000e+00
++5.1800e-01 +6.4200e-01 3.0000e+00
++5.2200e-01 +6.4200e-01 3.0000e+00
++5.3800e-01 +6.3800e-01 3.0000e+00
++5.4200e-01 +6.3800e-01 3.0000e+00
++5.3800e-01 +6.4200e-01 3.0000e+00
++5.4200e-01 +6.4200e-01 3.0000e+00
++5.5800e-01 +6.3800e-01 3.0000e+00
++5.6200e-01 +6.3800e-01 3.0000e+00
++5.5800e-01 +6.4200e-01 3.0000e+00
++5.6200e-01 +6.4200e-01 3.0000e+00
++5.7800e-01 +6.3800e-01 3.0000e+00
++5.8200e-01 +6.3800e-01 3.0000e+00
++5.7800e-01 +6.4200e-01 3.0000e+00
++5.8200e-01 +6.4200e-01 3.0000e+00
++5.9800e-01 +6.3800e-01 3.0000e+00
++6.0200e-01 +6.3800e-01 3.0000e+00
++5.9800e-01 +6.4200e-01 3.0000e+00
++6.0200e-01 +6.4200e-01 3.0000e+00
++6.1800e-01 +6.3800e-01 3.0000e+00
++6.2200e-01 +6.3800e-01 3.0000e+00
++6.1800e-01 +6.4200e-01 3.0000e+00
++6.2200e-01 +6.4200e-01 3.0000e+00
++6.3800e-01 +6.3800e-01 3.0000e+00
++6.4200e-01 +6.3800e-01 3.0000e+00
++6.3800e-01 +6.4200e-01 3.0000e+00
++6.4200e-01 +6.4200e-01 3.0000e+00
++6.5800e-01 +6.3800e-01 3.0000e+00
++6.6200e-01 +6.3800e-01 3.0000e+00
++6.5800e-01 +6.4200e-01 3.0000e+00
++6.6200e-01 +6.4200e-01 3.0000e+00
++6.7800e-01 +6.3800e-01 3.0000e+00
++6.8200e-01 +6.3800e-01 3.0000e+00
++6.7800e-01 +6.4200e-01 3.0000e+00
++6.8200e-01 +6.4200e-01 3.0000e+00
++6.9800e-01 +6.3800e-01 3.0000e+00
++7.0200e-01 +6.3800e-01 3.0000e+00
++6.9800e-01 +6.4200e-01 3.0000e+00
++7.0200e-01 +6.4200e-01 3.0000e+00
++7.1800e-01 +6.3800e-01 3.0000e+00
++7.2200e-01 +6.3800e-01 3.0000e+00
++7.1800e-01 +6.4200e-01 3.0000e+00
++7.2200e-01 +6.4200e-01 3.0000e+00
++7.3800e-01 +6.3800e-01 3.0000e+00
++7.4200e-01 +6.3800e-01 3.0000e+00
++7.3800e-01 +6.4200e-01 3.0000e+00
++7.4200e-01 +6.4200e-01 3.0000e+00
++7.5800e-01 +6.3800e-01 3.0000e+00
++7.6200e-01 +6.3800e-01 3.0000e+00
++7.5800e-01 +6.4200e-01 3.0000e+00
++7.6200e-01 +6.4200e-01 3.0000e+00
++7.7800e-01 +6.3800e-01 3.0000e+00
++7.8200e-01 +6.3800e-01 3.0000e+00
++7.7800e-01 +6.4200e-01 3.0000e+00
++7.8200e-01 +6.4200e-01 3.0000e+00
++7.9800e-01 +6.3800e-01 3.0000e+00
++8.0200e-01 +6.3800e-01 3.0000e+00
++7.9800e-01 +6.4200e-01 3.0000e+00
++8.0200e-01 +6.4200e-01 3.0000e+00
++8.1800e-01 +6.3800e-01 3.0000e+00
++8.2200e-01 +6.3800e-01 3.0000e+00
++8.1800e-01 +6.4200e-01 3.0000e+00
++8.2200e-01 +6.4200e-01 3.0000e+00
++8.3800e-01 +6.3800e-01 3.0000e+00
++8.4200e-01 +6.3800e-01 3.0000e+00
++8.3800e-01 +6.4200e-01 3.0000e+00
++8.4200e-01 +6.4200e-01 3.0000e+00
++8.5800e-01 +6.3800e-01 3.0000e+00
++8.6200e-01 +6.3800e-01 3.0000e+00
++8.5800e-01 +6.4200e-01 3.0000e+00
++8.6200e-01 +6.4200e-01 3.0000e+00
++8.7800e-01 +6.3800e-01 3.0000e+00
++8.8200e-01 +6.3800e-01 3.0000e+00
++8.7800e-01 +6.4200e-01 3.0000e+00
++8.8200e-01 +6.4200e-01 3.0000e+00
++8.9800e-01 +6.3800e-01 3.0000e+00
++9.0200e-01 +6.3800e-01 3.0000e+00
++8.9800e-01 +6.4200e-01 3.0000e+00
++9.0200e-01 +6.4200e-01 3.0000e+00
++9.1800e-01 +6.3800e-01 3.0000e+00
++9.2200e-01 +6.3800e-01 3.0000e+00
++9.1800e-01 +6.4200e-01 3.0000e+00
++9.2200e-01 +6.4200e-01 3.0000e+00
++9.3800e-01 +6.3800e-01 3.0000e+00
++9.4200e-01 +6.3800e-01 3.0000e+00
++9.3800e-01 +6.4200e-01 3.0000e+00
++9.4200e-01 +6.4200e-01 3.0000e+00
++9.5800e-01 +6.3800e-01 3.0000e+00
++9.6200e-01 +6.3800e-01 3.0000e+00
++9.5800e-01 +6.4200e-01 3.0000e+00
++9.6200e-01 +6.4200e-01 3.0000e+00
++9.7800e-01 +6.3800e-01 3.0000e+00
++9.8200e-01 +6.3800e-01 3.0000e+00
++9.7800e-01 +6.4200e-01 3.0000e+00
++9.8200e-01 +6.4200e-01 3.0000e+00
++9.9800e-01 +6.3800e-01 3.0000e+00
++1.0020e+00 +6.3800e-01 3.0000e+00
++9.9800e-01 +6.4200e-01 3.0000e+00
++1.0020e+00 +6.4200e-01 3.0000e+00
++1.8000e-02 +6.5800e-01 3.0000e+00
++2.2000e-02 +6.5800e-01 3.0000e+00
++1.8000e-02 +6.6200e-01 3.0000e+00
++2.2000e-02 +6.6200e-01 3.0000e+00
++3.8000e-02 +6.5800e-01 3.0000e+00
++4.2000e-02 +6.5800e-01 3.0000e+00
++3.8000e-02 +6.6200e-01 3.0000e+00
++4.2000e-02 +6.6200e-01 3.0000e+00
++5.8000e-02 +6.5800e-01 3.0000e+00
++6.2000e-02 +6.5800e-01 3.0000e+00
++5.8000e-02 +6.6200e-01 3.0000e+00
++6.2000e-02 +6.6200e-01 3.0000e+00
++7.8000e-02 +6.5800e-01 3.0000e+00
++8.2000e-02 +6.5800e-01 3.0000e+00
++7.8000e-02 +6.6200e-01 3.0000e+00
++8.2000e-02 +6.6200e-01 3.0000e+00
++9.8000e-02 +6.5800e-01 3.0000e+00
++1.0200e-01 +6.5800e-01 3.0000e+00
++9.8000e-02 +6.6200e-01 3.0000e+00
++1.0200e-01 +6.6200e-01 3.0000e+00
++1.1800e-01 +6.5800e-01 3.0000e+00
++1.2200e-01 +6.5800e-01 3.0000e+00
++1.1800e-01 +6.6200e-01 3.0000e+00
++1.2200e-01 +6.6200e-01 3.0000e+00
++1.3800e-01 +6.5800e-01 3.0000e+00
++1.4200e-01 +6.5800e-01 3.0000e+00
++1.3800e-01 +6.6200e-01 3.0000e+00
++1.4200e-01 +6.6200e-01 3.0000e+00
++1.5800e-01 +6.5800e-01 3.0000e+00
++1.6200e-01 +6.5800e-01 3.0000e+00
++1.5800e-01 +6.6200e-01 3.0000e+00
++1.6200e-01 +6.6200e-01 3.0000e+00
++1.7800e-01 +6.5800e-01 3.0000e+00
++1.8200e-01 +6.5800e-01 3.0000e+00
++1.7800e-01 +6.6200e-01 3.0000e+00
++1.8200e-01 +6.6200e-01 3.0000e+00
++1.9800e-01 +6.5800e-01 3.0000e+00
++2.0200e-01 +6.5800e-01 3.0000e+00
++1.9800e-01 +6.6200e-01 3.0000e+00
++2.0200e-01 +6.6200e-01 3.0000e+00
++2.1800e-01 +6.5800e-01 3.0000e+00
++2.2200e-01 +6.5800e-01 3.0000e+00
++2.1800e-01 +6.6200e-01 3.0000e+00
++2.2200e-01 +6.6200e-01 3.0000e+00
++2.3800e-01 +6.5800e-01 3.0000e+00
++2.4200e-01 +6.5800e-01 3.0000e+00
++2.3800e-01 +6.6200e-01 3.0000e+00
++2.4200e-01 +6.6200e-01 3.0000e+00
++2.5800e-01 +6.5800e-01 3.0000e+00
++2.6200e-01 +6.5800e-01 3.0000e+00
++2.5800e-01 +6.6200e-01 3.0000e+00
++2.6200e-01 +6.6200e-01 3.0000e+00
++2.7800e-01 +6.5800e-01 3.0000e+00
++2.8200e-01 +6.5800e-01 3.0000e+00
++2.7800e-01 +6.6200e-01 3.0000e+00
++2.8200e-01 +6.6200e-01 3.0000e+00
++2.9800e-01 +6.5800e-01 3.0000e+00
++3.0200e-01 +6.5800e-01 3.0000e+00
++2.9800e-01 +6.6200e-01 3.0000e+00
++3.0200e-01 +6.6200e-01 3.0000e+00
++3.1800e-01 +6.5800e-01 3.0000e+00
++3.2200e-01 +6.5800e-01 3.0000e+00
++3.1800e-01 +6.6200e-01 3.0000e+00
++3.2200e-01 +6.6200e-01 3.0000e+00
++3.3800e-01 +6.5800e-01 3.0000e+00
++3.4200e-01 +6.5800e-01 3.0000e+00
++3.3800e-01 +6.6200e-01 3.0000e+00
++3.4200e-01 +6.6200e-01 3.0000e+00
++3.5800e-01 +6.5800e-01 3.0000e+00
++3.6200e-01 +6.5800e-01 3.0000e+00
++3.5800e-01 +6.6200e-01 3.0000e+00
++3.6200e-01 +6.6200e-01 3.0000e+00
++3.7800e-01 +6.5800e-01 3.0000e+00
++3.8200e-01 +6.5800e-01 3.0000e+00
++3.7800e-01 +6.6200e-01 3.0000e+00
++3.8200e-01 +6.6200e-01 3.0000e+00
++3.9800e-01 +6.5800e-01 3.0000e+00
++4.0200e-01 +6.5800e-01 3.0000e+00
++3.9800e-01 +6.6200e-01 3.0000e+00
++4.0200e-01 +6.6200e-01 3.0000e+00
++4.1800e-01 +6.5800e-01 3.0000e+00
++4.2200e-01 +6.5800e-01 3.0000e+00
++4.1800e-01 +6.6200e-01 3.0000e+00
++4.2200e-01 +6.6200e-01 3.0000e+00
++4.3800e-01 +6.5800e-01 3.0000e+00
++4.4200e-01 +6.5800e-01 3.0000e+00
++4.3800e-01 +6.6200e-01 3.0000e+00
++4.4200e-01 +6.6200e-01 3.0000e+00
++4.5800e-01 +6.5800e-01 3.0000e+00
++4.6200e-01 +6.5800e-01 3.0000e+00
++4.5800e-01 +6.6200e-01 3.0000e+00
++4.6200e-01 +6.6200e-01 3.0000e+00
++4.7800e-01 +6.5800e-01 3.0000e+00
++4.8200e-01 +6.5800e-01 3.0000e+00
++4.7800e-01 +6.6200e-01 3.0000e+00
++4.8200e-01 +6.6200e-01 3.0000e+00
++4.9800e-01 +6.5800e-01 3.0000e+00
++5.0200e-01 +6.5800e-01 3.0000e+00
++4.9800e-01 +6.6200e-01 3.0000e+00
++5.0200e-01 +6.6200e-01 3.0000e+00
++5.1800e-01 +6.5800e-01 3.0000e+00
++5.2200e-01 +6.5800e-01 3.0000e+00
++5.1800e-01 +6.6200e-01 3.0000e+00
++5.2200e-01 +6.6200e-01 3.0000e+00
++5.3800e-01 +6.5800e-01 3.0000e+00
++5.4200e-01 +6.5800e-01 3.0000e+00
++5.3800e-01 +6.6200e-01 3.0000e+00
++5.4200e-01 +6.6200e-01 3.0000e+00
++5.5800e-01 +6.5800e-01 3.0000e+00
++5.6200e-01 +6.5800e-01 3.0000e+00
++5.5800e-01 +6.6200e-01 3.0000e+00
++5.6200e-01 +6.6200e-01 3.0000e+00
++5.7800e-01 +6.5800e-01 3.0000e+00
++5.8200e-01 +6.5800e-01 3.0000e+00
++5.7800e-01 +6.6200e-01 3.0000e+00
++5.8200e-01 +6.6200e-01 3.0000e+00
++5.9800e-01 +6.5800e-01 3.0000e+00
++6.0200e-01 +6.5800e-01 3.0000e+00
++5.9800e-01 +6.6200e-01 3.0000e+00
++6.0200e-01 +6.6200e-01 3.0000e+00
++6.1800e-01 +6.5800e-01 3.0000e+00
++6.2200e-01 +6.5800e-01 3.0000e+00
++6.1800e-01 +6.6200e-01 3.0000e+00
++6.2200e-01 +6.6200e-01 3.0000e+00
++6.3800e-01 +6.5800e-01 3.0000e+00
++6.4200e-01 +6.5800e-01 3.0000e+00
++6.3800e-01 +6.6200e-01 3.0000e+00
++6.4200e-01 +6.6200e-01 3.0000e+00
++6.5800e-01 +6.5800e-01 3.0000e+00
++6.6200e-01 +6.5800e-01 3.0000e+00
++6.5800e-01 +6.6200e-01 3.0000e+00
++6.6200e-01 +6.6200e-01 3.0000e+00
++6.7800e-01 +6.5800e-01 3.0000e+00
++6.8200e-01 +6.5800e-01 3.0000e+00
++6.7800e-01 +6.6200e-01 3.0000e+00
++6.8200e-01 +6.6200e-01 3.0000e+00
++6.9800e-01 +6.5800e-01 3.0000e+00
++7.0200e-01 +6.5800e-01 3.0000e+00
++6.9800e-01 +6.6200e-01 3.0000e+00
++7.0200e-01 +6.6200e-01 3.0000e+00
++7.1800e-01 +6.5800e-01 3.0000e+00
++7.2200e-01 +6.5800e-01 3.0000e+00
++7.1800e-01 +6.6200e-01 3.0000e+00
++7.2200e-01 +6.6200e-01 3.0000e+00
++7.3800e-01 +6.5800e-01 3.0000e+00
++7.4200e-01 +6.5800e-01 3.0000e+00
++7.3800e-01 +6.6200e-01 3.0000e+00
++7.4200e-01 +6.6200e-01 3.0000e+00
++7.5800e-01 +6.5800e-01 3.0000e+00
++7.6200e-01 +6.5800e-01 3.0000e+00
++7.5800e-01 +6.6200e-01 3.0000e+00
++7.6200e-01 +6.6200e-01 3.0000e+00
++7.7800e-01 +6.5800e-01 3.0000e+00
++7.8200e-01 +6.5800e-01 3.0000e+00
++7.7800e-01 +6.6200e-01 3.0000e+00
++7.8200e-01 +6.6200e-01 3.0000e+00
++7.9800e-01 +6.5800e-01 3.0000e+00
++8.0200e-01 +6.5800e-01 3.0000e+00
++7.9800e-01 +6.6200e-01 3.0000e+00
++8.0200e-01 +6.6200e-01 3.0000e+00
++8.1800e-01 +6.5800e-01 3.0000e+00
++8.2200e-01 +6.5800e-01 3.0000e+00
++8.1800e-01 +6.6200e-01 3.0000e+00
++8.2200e-01 +6.6200e-01 3.0000e+00
++8.3800e-01 +6.5800e-01 3.0000e+00
++8.4200e-01 +6.5800e-01 3.0000e+00
++8.3800e-01 +6.6200e-01 3.0000e+00
++8.4200e-01 +6.6200e-01 3.0000e+00
++8.5800e-01 +6.5800e-01 3.0000e+00
++8.6200e-01 +6.5800e-01 3.0000e+00
++8.5800e-01 +6.6200e-01 3.0000e+00
++8.6200e-01 +6.6200e-01 3.0000e+00
++8.7800e-01 +6.5800e-01 3.0000e+00
++8.8200e-01 +6.5800e-01 3.0000e+00
++8.7800e-01 +6.6200e-01 3.0000e+00
++8.8200e-01 +6.6200e-01 3.0000e+00
++8.9800e-01 +6.5800e-01 3.0000e+00
++9.0200e-01 +6.5800e-01 3.0000e+00
++8.9800e-01 +6.6200e-01 3.0000e+00
++9.0200e-01 +6.6200e-01 3.0000e+00
++9.1800e-01 +6.5800e-01 3.0000e+00
++9.2200e-01 +6.5800e-01 3.0000e+00
++9.1800e-01 +6.6200e-01 3.0000e+00
++9.2200e-01 +6.6200e-01 3.0000e+00
++9.3800e-01 +6.5800e-01 3.0000e+00
++9.4200e-01 +6.5800e-01 3.0000e+00
++9.3800e-01 +6.6200e-01 3.0000e+00
++9.4200e-01 +6.6200e-01 3.0000e+00
++9.5800e-01 +6.5800e-01 3.0000e+00
++9.6200e-01 +6.5800e-01 3.0000e+00
++9.5800e-01 +6.6200e-01 3.0000e+00
++9.6200e-01 +6.6200e-01 3.0000e+00
++9.7800e-01 +6.5800e-01 3.0000e+00
++9.8200e-01 +6.5800e-01 3.0000e+00
++9.7800e-01 +6.6200e-01 3.0000e+00
++9.8200e-01 +6.6200e-01 3.0000e+00
++9.9800e-01 +6.5800e-01 3.0000e+00
++1.0020e+00 +6.5800e-01 3.0000e+00
++9.9800e-01 +6.6200e-01 3.0000e+00
++1.0020e+00 +6.6200e-01 3.0000e+00
++1.8000e-02 +6.7800e-01 3.0000e+00
++2.2000e-02 +6.7800e-01 3.0000e+00
++1.8000e-02 +6.8200e-01 3.0000e+00
++2.2000e-02 +6.8200e-01 3.0000e+00
++3.8000e-02 +6.7800e-01 3.0000e+00
++4.2000e-02 +6.7800e-01 3.0000e+00
++3.8000e-02 +6.8200e-01 3.0000e+00
++4.2000e-02 +6.8200e-01 3.0000e+00
++5.8000e-02 +6.7800e-01 3.0000e+00
++6.2000e-02 +6.7800e-01 3.0000e+00
++5.8000e-02 +6.8200e-01 3.0000e+00
++6.2000e-02 +6.8200e-01 3.0000e+00
++7.8000e-02 +6.7800e-01 3.0000e+00
++8.2000e-02 +6.7800e-01 3.0000e+00
++7.8000e-02 +6.8200e-01 3.0000e+00
++8.2000e-02 +6.8200e-01 3.0000e+00
++9.8000e-02 +6.7800e-01 3.0000e+00
++1.0200e-01 +6.7800e-01 3.0000e+00
++9.8000e-02 +6.8200e-01 3.0000e+00
++1.0200e-01 +6.8200e-01 3.0000e+00
++1.1800e-01 +6.7800e-01 3.0000e+00
++1.2200e-01 +6.7800e-01 3.0000e+00
++1.1800e-01 +6.8200e-01 3.0000e+00
++1.2200e-01 +6.8200e-01 3.0000e+00
++1.3800e-01 +6.7800e-01 3.0000e+00
++1.4200e-01 +6.7800e-01 3.0000e+00
++1.3800e-01 +6.8200e-01 3.0000e+00
++1.4200e-01 +6.8200e-01 3.0000e+00
++1.5800e-01 +6.7800e-01 3.0000e+00
++1.6200e-01 +6.7800e-01 3.0000e+00
++1.5800e-01 +6.8200e-01 3.0000e+00
++1.6200e-01 +6.8200e-01 3.0000e+00
++1.7800e-01 +6.7800e-01 3.0000e+00
++1.8200e-01 +6.7800e-01 3.0000e+00
++1.7800e-01 +6.8200e-01 3.0000e+00
++1.8200e-01 +6.8200e-01 3.0000e+00
++1.9800e-01 +6.7800e-01 3.0000e+00
++2.0200e-01 +6.7800e-01 3.0000e+00
++1.9800e-01 +6.8200e-01 3.0000e+00
++2.0200e-01 +6.8200e-01 3.0000e+00
++2.1800e-01 +6.7800e-01 3.0000e+00
++2.2200e-01 +6.7800e-01 3.0000e+00
++2.1800e-01 +6.8200e-01 3.0000e+00
++2.2200e-01 +6.8200e-01 3.0000e+00
++2.3800e-01 +6.7800e-01 3.0000e+00
++2.4200e-01 +6.7800e-01 3.0000e+00
++2.3800e-01 +6.8200e-01 3.0000e+00
++2.4200e-01 +6.8200e-01 3.0000e+00
++2.5800e-01 +6.7800e-01 3.0000e+00
++2.6200e-01 +6.7800e-01 3.0000e+00
++2.5800e-01 +6.8200e-01 3.0000e+00
++2.6200e-01 +6.8200e-01 3.0000e+00
++2.7800e-01 +6.7800e-01 3.0000e+00
++2.8200e-01 +6.7800e-01 3.0000e+00
++2.7800e-01 +6.8200e-01 3.0000e+00
++2.8200e-01 +6.8200e-01 3.0000e+00
++2.9800e-01 +6.7800e-01 3.0000e+00
++3.0200e-01 +6.7800e-01 3.0000e+00
++2.9800e-01 +6.8200e-01 3.0000e+00
++3.0200e-01 +6.8200e-01 3.0000e+00
++3.1800e-01 +6.7800e-01 3.0000e+00
++3.2200e-01 +6.7800e-01 3.0000e+00
++3.1800e-01 +6.8200e-01 3.0000e+00
++3.2200e-01 +6.8200e-01 3.0000e+00
++3.3800e-01 +6.7800e-01 3.0000e+00
++3.4200e-01 +6.7800e-01 3.0000e+00
++3.3800e-01 +6.8200e-01 3.0000e+00
++3.4200e-01 +6.8200e-01 3.0000e+00
++3.5800e-01 +6.7800e-01 3.0000e+00
++3.6200e-01 +6.7800e-01 3.0000e+00
++3.5800e-01 +6.8200e-01 3.0000e+00
++3.6200e-01 +6.8200e-01 3.0000e+00
++3.7800e-01 +6.7800e-01 3.0000e+00
++3.8200e-01 +6.7800e-01 3.0000e+00
++3.7800e-01 +6.8200e-01 3.0000e+00
++3.8200e-01 +6.8200e-01 3.0000e+00
++3.9800e-01 +6.7800e-01 3.0000e+00
++4.0200e-01 +6.7800e-01 3.0000e+00
++3.9800e-01 +6.8200e-01 3.0000e+00
++4.0200e-01 +6.8200e-01 3.0000e+00
++4.1800e-01 +6.7800e-01 3.0000e+00
++4.2200e-01 +6.7800e-01 3.0000e+00
++4.1800e-01 +6.8200e-01 3.0000e+00
++4.2200e-01 +6.8200e-01 3.0000e+00
++4.3800e-01 +6.7800e-01 3.0000e+00
++4.4200e-01 +6.7800e-01 3.0000e+00
++4.3800e-01 +6.8200e-01 3.0000e+00
++4.4200e-01 +6.8200e-01 3.0000e+00
++4.5800e-01 +6.7800e-01 3.0000e+00
++4.6200e-01 +6.7800e-01 3.0000e+00
++4.5800e-01 +6.8200e-01 3.0000e+00
++4.6200e-01 +6.8200e-01 3.0000e+00
++4.7800e-01 +6.7800e-01 3.0000e+00
++4.8200e-01 +6.7800e-01 3.0000e+00
++4.7800e-01 +6.8200e-01 3.0000e+00
++4.8200e-01 +6.8200e-01 3.0000e+00
++4.9800e-01 +6.7800e-01 3.0000e+00
++5.0200e-01 +6.7800e-01 3.0000e+00
++4.9800e-01 +6.8200e-01 3.0000e+00
++5.0200e-01 +6.8200e-01 3.0000e+00
++5.1800e-01 +6.7800e-01 3.0000e+00
++5.2200e-01 +6.7800e-01 3.0000e+00
++5.1800e-01 +6.8200e-01 3.0000e+00
++5.2200e-01 +6.8200e-01 3.0000e+00
++5.3800e-01 +6.7800e-01 3.0000e+00
++5.4200e-01 +6.7800e-01 3.0000e+00
++5.3800e-01 +6.8200e-01 3.0000e+00
++5.4200e-01 +6.8200e-01 3.0000e+00
++5.5800e-01 +6.7800e-01 3.0000e+00
++5.6200e-01 +6.7800e-01 3.0000e+00
++5.5800e-01 +6.8200e-01 3.0000e+00
++5.6200e-01 +6.8200e-01 3.0000e+00
++5.7800e-01 +6.7800e-01 3.0000e+00
++5.8200e-01 +6.7800e-01 3.0000e+00
++5.7800e-01 +6.8200e-01 3.0000e+00
++5.8200e-01 +6.8200e-01 3.0000e+00
++5.9800e-01 +6.7800e-01 3.0000e+00
++6.0200e-01 +6.7800e-01 3.0000e+00
++5.9800e-01 +6.8200e-01 3.0000e+00
++6.0200e-01 +6.8200e-01 3.0000e+00
++6.1800e-01 +6.7800e-01 3.0000e+00
++6.2200e-01 +6.7800e-01 3.0000e+00
++6.1800e-01 +6.8200e-01 3.0000e+00
++6.2200e-01 +6.8200e-01 3.0000e+00
++6.3800e-01 +6.7800e-01 3.0000e+00
++6.4200e-01 +6.7800e-01 3.0000e+00
++6.3800e-01 +6.8200e-01 3.0000e+00
++6.4200e-01 +6.8200e-01 3.0000e+00
++6.5800e-01 +6.7800e-01 3.0000e+00
++6.6200e-01 +6.7800e-01 3.0000e+00
++6.5800e-01 +6.8200e-01 3.0000e+00
++6.6200e-01 +6.8200e-01 3.0000e+00
++6.7800e-01 +6.7800e-01 3.0000e+00
++6.8200e-01 +6.7800e-01 3.0000e+00
++6.7800e-01 +6.8200e-01 3.0000e+00
++6.8200e-01 +6.8200e-01 3.0000e+00
++6.9800e-01 +6.7800e-01 3.0000e+00
++7.0200e-01 +6.7800e-01 3.0000e+00
++6.9800e-01 +6.8200e-01 3.0000e+00
++7.0200e-01 +6.8200e-01 3.0000e+00
++7.1800e-01 +6.7800e-01 3.0000e+00
++7.2200e-01 +6.7800e-01 3.0000e+00
++7.1800e-01 +6.8200e-01 3.0000e+00
++7.2200e-01 +6.8200e-01 3.0000e+00
++7.3800e-01 +6.7800e-01 3.0000e+00
++7.4200e-01 +6.7800e-01 3.0000e+00
++7.3800e-01 +6.8200e-01 3.0000e+00
++7.4200e-01 +6.8200e-01 3.0000e+00
++7.5800e-01 +6.7800e-01 3.0000e+00
++7.6200e-01 +6.7800e-01 3.0000e+00
++7.5800e-01 +6.8200e-01 3.0000e+00
++7.6200e-01 +6.8200e-01 3.0000e+00
++7.7800e-01 +6.7800e-01 3.0000e+00
++7.8200e-01 +6.7800e-01 3.0000e+00
++7.7800e-01 +6.8200e-01 3.0000e+00
++7.8200e-01 +6.8200e-01 3.0000e+00
++7.9800e-01 +6.7800e-01 3.0000e+00
++8.0200e-01 +6.7800e-01 3.0000e+00
++7.9800e-01 +6.8200e-01 3.0000e+00
++8.0200e-01 +6.8200e-01 3.0000e+00
++8.1800e-01 +6.7800e-01 3.0000e+00
++8.2200e-01 +6.7800e-01 3.0000e+00
++8.1800e-01 +6.8200e-01 3.0000e+00
++8.2200e-01 +6.8200e-01 3.0000e+00
++8.3800e-01 +6.7800e-01 3.0000e+00
++8.4200e-01 +6.7800e-01 3.0000e+00
++8.3800e-01 +6.8200e-01 3.0000e+00
++8.4200e-01 +6.8200e-01 3.0000e+00
++8.5800e-01 +6.7800e-01 3.0000e+00
++8.6200e-01 +6.7800e-01 3.0000e+00
++8.5800e-01 +6.8200e-01 3.0000e+00
++8.6200e-01 +6.8200e-01 3.0000e+00
++8.7800e-01 +6.7800e-01 3.0000e+00
++8.8200e-01 +6.7800e-01 3.0000e+00
++8.7800e-01 +6.8200e-01 3.0000e+00
++8.8200e-01 +6.8200e-01 3.0000e+00
++8.9800e-01 +6.7800e-01 3.0000e+00
++9.0200e-01 +6.7800e-01 3.0000e+00
++8.9800e-01 +6.8200e-01 3.0000e+00
++9.0200e-01 +6.8200e-01 3.0000e+00
++9.1800e-01 +6.7800e-01 3.0000e+00
++9.2200e-01 +6.7800e-01 3.0000e+00
++9.1800e-01 +6.8200e-01 3.0000e+00
++9.2200e-01 +6.8200e-01 3.0000e+00
++9.3800e-01 +6.7800e-01 3.0000e+00
++9.4200e-01 +6.7800e-01 3.0000e+00
++9.3800e-01 +6.8200e-01 3.0000e+00
++9.4200e-01 +6.8200e-01 3.0000e+00
++9.5800e-01 +6.7800e-01 3.0000e+00
++9.6200e-01 +6.7800e-01 3.0000e+00
++9.5800e-01 +6.8200e-01 3.0000e+00
++9.6200e-01 +6.8200e-01 3.0000e+00
++9.7800e-01 +6.7800e-01 3.0000e+00
++9.8200e-01 +6.7800e-01 3.0000e+00
++9.7800e-01 +6.8200e-01 3.0000e+00
++9.8200e-01 +6.8200e-01 3.0000e+00
++9.9800e-01 +6.7800e-01 3.0000e+00
++1.0020e+00 +6.7800e-01 3.0000e+00
++9.9800e-01 +6.8200e-01 3.0000e+00
++1.0020e+00 +6.8200e-01 3.0000e+00
++1.8000e-02 +6.9800e-01 3.0000e+00
++2.2000e-02 +6.9800e-01 3.0000e+00
++1.8000e-02 +7.0200e-01 3.0000e+00
++2.2000e-02 +7.0200e-01 3.0000e+00
++3.8000e-02 +6.9800e-01 3.0000e+00
++4.2000e-02 +6.9800e-01 3.0000e+00
++3.8000e-02 +7.0200e-01 3.0000e+00
++4.2000e-02 +7.0200e-01 3.0000e+00
++5.8000e-02 +6.9800e-01 3.0000e+00
++6.2000e-02 +6.9800e-01 3.0000e+00
++5.8000e-02 +7.0200e-01 3.0000e+00
++6.2000e-02 +7.0200e-01 3.0000e+00
++7.8000e-02 +6.9800e-01 3.0000e+00
++8.2000e-02 +6.9800e-01 3.0000e+00
++7.8000e-02 +7.0200e-01 3.0000e+00
++8.2000e-02 +7.0200e-01 3.0000e+00
++9.8000e-02 +6.9800e-01 3.0000e+00
++1.0200e-01 +6.9800e-01 3.0000e+00
++9.8000e-02 +7.0200e-01 3.0000e+00
++1.0200e-01 +7.0200e-01 3.0000e+00
++1.1800e-01 +6.9800e-01 3.0000e+00
++1.2200e-01 +6.9800e-01 3.0000e+00
++1.1800e-01 +7.0200e-01 3.0000e+00
++1.2200e-01 +7.0200e-01 3.0000e+00
++1.3800e-01 +6.9800e-01 3.0000e+00
++1.4200e-01 +6.9800e-01 3.0000e+00
++1.3800e-01 +7.0200e-01 3.0000e+00
++1.4200e-01 +7.0200e-01 3.0000e+00
++1.5800e-01 +6.9800e-01 3.0000e+00
++1.6200e-01 +6.9800e-01 3.0000e+00
++1.5800e-01 +7.0200e-01 3.0000e+00
++1.6200e-01 +7.0200e-01 3.0000e+00
++1.7800e-01 +6.9800e-01 3.0000e+00
++1.8200e-01 +6.9800e-01 3.0000e+00
++1.7800e-01 +7.0200e-01 3.0000e+00
++1.8200e-01 +7.0200e-01 3.0000e+00
++1.9800e-01 +6.9800e-01 3.0000e+00
++2.0200e-01 +6.9800e-01 3.0000e+00
++1.9800e-01 +7.0200e-01 3.0000e+00
++2.0200e-01 +7.0200e-01 3.0000e+00
++2.1800e-01 +6.9800e-01 3.0000e+00
++2.2200e-01 +6.9800e-01 3.0000e+00
++2.1800e-01 +7.0200e-01 3.0000e+00
++2.2200e-01 +7.0200e-01 3.0000e+00
++2.3800e-01 +6.9800e-01 3.0000e+00
++2.4200e-01 +6.9800e-01 3.0000e+00
++2.3800e-01 +7.0200e-01 3.0000e+00
++2.4200e-01 +7.0200e-01 3.0000e+00
++2.5800e-01 +6.9800e-01 3.0000e+00
++2.6200e-01 +6.9800e-01 3.0000e+00
++2.5800e-01 +7.0200e-01 3.0000e+00
++2.6200e-01 +7.0200e-01 3.0000e+00
++2.7800e-01 +6.9800e-01 3.0000e+00
++2.8200e-01 +6.9800e-01 3.0000e+00
++2.7800e-01 +7.0200e-01 3.0000e+00
++2.8200e-01 +7.0200e-01 3.0000e+00
++2.9800e-01 +6.9800e-01 3.0000e+00
++3.0200e-01 +6.9800e-01 3.0000e+00
++2.9800e-01 +7.0200e-01 3.0000e+00
++3.0200e-01 +7.0200e-01 3.0000e+00
++3.1800e-01 +6.9800e-01 3.0000e+00
++3.2200e-01 +6.9800e-01 3.0000e+00
++3.1800e-01 +7.0200e-01 3.0000e+00
++3.2200e-01 +7.0200e-01 3.0000e+00
++3.3800e-01 +6.9800e-01 3.0000e+00
++3.4200e-01 +6.9800e-01 3.0000e+00
++3.3800e-01 +7.0200e-01 3.0000e+00
++3.4200e-01 +7.0200e-01 3.0000e+00
++3.5800e-01 +6.9800e-01 3.0000e+00
++3.6200e-01 +6.9800e-01 3.0000e+00
++3.5800e-01 +7.0200e-01 3.0000e+00
++3.6200e-01 +7.0200e-01 3.0000e+00
++3.7800e-01 +6.9800e-01 3.0000e+00
++3.8200e-01 +6.9800e-01 3.0000e+00
++3.7800e-01 +7.0200e-01 3.0000e+00
++3.8200e-01 +7.0200e-01 3.0000e+00
++3.9800e-01 +6.9800e-01 3.0000e+00
++4.0200e-01 +6.9800e-01 3.0000e+00
++3.9800e-01 +7.0200e-01 3.0000e+00
++4.0200e-01 +7.0200e-01 3.0000e+00
++4.1800e-01 +6.9800e-01 3.0000e+00
++4.2200e-01 +6.9800e-01 3.0000e+00
++4.1800e-01 +7.0200e-01 3.0000e+00
++4.2200e-01 +7.0200e-01 3.0000e+00
++4.3800e-01 +6.9800e-01 3.0000e+00
++4.4200e-01 +6.9800e-01 3.0000e+00
++4.3800e-01 +7.0200e-01 3.0000e+00
++4.4200e-01 +7.0200e-01 3.0000e+00
++4.5800e-01 +6.9800e-01 3.0000e+00
++4.6200e-01 +6.9800e-01 3.0000e+00
++4.5800e-01 +7.0200e-01 3.0000e+00
++4.6200e-01 +7.0200e-01 3.0000e+00
++4.7800e-01 +6.9800e-01 3.0000e+00
++4.8200e-01 +6.9800e-01 3.0000e+00
++4.7800e-01 +7.0200e-01 3.0000e+00
++4.8200e-01 +7.0200e-01 3.0000e+00
++4.9800e-01 +6.9800e-01 3.0000e+00
++5.0200e-01 +6.9800e-01 3.0000e+00
++4.9800e-01 +7.0200e-01 3.0000e+00
++5.0200e-01 +7.0200e-01 3.0000e+00
++5.1800e-01 +6.9800e-01 3.0000e+00
++5.2200e-01 +6.9800e-01 3.0000e+00
++5.1800e-01 +7.0200e-01 3.0000e+00
++5.2200e-01 +7.0200e-01 3.0000e+00
++5.3800e-01 +6.9800e-01 3.0000e+00
++5.4200e-01 +6.9800e-01 3.0000e+00
++5.3800e-01 +7.0200e-01 3.0000e+00
++5.4200e-01 +7.0200e-01 3.0000e+00
++5.5800e-01 +6.9800e-01 3.0000e+00
++5.6200e-01 +6.9800e-01 3.0000e+00
++5.5800e-01 +7.0200e-01 3.0000e+00
++5.6200e-01 +7.0200e-01 3.0000e+00
++5.7800e-01 +6.9800e-01 3.0000e+00
++5.8200e-01 +6.9800e-01 3.0000e+00
++5.7800e-01 +7.0200e-01 3.0000e+00
++5.8200e-01 +7.0200e-01 3.0000e+00
++5.9800e-01 +6.9800e-01 3.0000e+00
++6.0200e-01 +6.9800e-01 3.0000e+00
++5.9800e-01 +7.0200e-01 3.0000e+00
++6.0200e-01 +7.0200e-01 3.0000e+00
++6.1800e-01 +6.9800e-01 3.0000e+00
++6.2200e-01 +6.9800e-01 3.0000e+00
++6.1800e-01 +7.0200e-01 3.0000e+00
++6.2200e-01 +7.0200e-01 3.0000e+00
++6.3800e-01 +6.9800e-01 3.0000e+00
++6.4200e-01 +6.9800e-01 3.0000e+00
++6.3800e-01 +7.0200e-01 3.0000e+00
++6.4200e-01 +7.0200e-01 3.0000e+00
++6.5800e-01 +6.9800e-01 3.0000e+00
++6.6200e-01 +6.9800e-01 3.0000e+00
++6.5800e-01 +7.0200e-01 3.0000e+00
++6.6200e-01 +7.0200e-01 3.0000e+00
++6.7800e-01 +6.9800e-01 3.0000e+00
++6.8200e-01 +6.9800e-01 3.0000e+00
++6.7800e-01 +7.0200e-01 3.0000e+00
++6.8200e-01 +7.0200e-01 3.0000e+00
++6.9800e-01 +6.9800e-01 3.0000e+00
++7.0200e-01 +6.9800e-01 3.0000e+00
++6.9800e-01 +7.0200e-01 3.0000e+00
++7.0200e-01 +7.0200e-01 3.0000e+00
++7.1800e-01 +6.9800e-01 3.0000e+00
++7.2200e-01 +6.9800e-01 3.0000e+00
++7.1800e-01 +7.0200e-01 3.0000e+00
++7.2200e-01 +7.0200e-01 3.0000e+00
++7.3800e-01 +6.9800e-01 3.0000e+00
++7.4200e-01 +6.9800e-01 3.0000e+00
++7.3800e-01 +7.0200e-01 3.0000e+00
++7.4200e-01 +7.0200e-01 3.0000e+00
++7.5800e-01 +6.9800e-01 3.0000e+00
++7.6200e-01 +6.9800e-01 3.0000e+00
++7.5800e-01 +7.0200e-01 3.0000e+00
++7.6200e-01 +7.0200e-01 3.0000e+00
++7.7800e-01 +6.9800e-01 3.0000e+00
++7.8200e-01 +6.9800e-01 3.0000e+00
++7.7800e-01 +7.0200e-01 3.0000e+00
++7.8200e-01 +7.0200e-01 3.0000e+00
++7.9800e-01 +6.9800e-01 3.0000e+00
++8.0200e-01 +6.9800e-01 3.0000e+00
++7.9800e-01 +7.0200e-01 3.0000e+00
++8.0200e-01 +7.0200e-01 3.0000e+00
++8.1800e-01 +6.9800e-01 3.0000e+00
++8.2200e-01 +6.9800e-01 3.0000e+00
++8.1800e-01 +7.0200e-01 3.0000e+00
++8.2200e-01 +7.0200e-01 3.0000e+00
++8.3800e-01 +6.9800e-01 3.0000e+00
++8.4200e-01 +6.9800e-01 3.0000e+00
++8.3800e-01 +7.0200e-01 3.0000e+00
++8.4200e-01 +7.0200e-01 3.0000e+00
++8.5800e-01 +6.9800e-01 3.0000e+00
++8.6200e-01 +6.9800e-01 3.0000e+00
++8.5800e-01 +7.0200e-01 3.0000e+00
++8.6200e-01 +7.0200e-01 3.0000e+00
++8.7800e-01 +6.9800e-01 3.0000e+00
++8.8200e-01 +6.9800e-01 3.0000e+00
++8.7800e-01 +7.0200e-01 3.0000e+00
++8.8200e-01 +7.0200e-01 3.0000e+00
++8.9800e-01 +6.9800e-01 3.0000e+00
++9.0200e-01 +6.9800e-01 3.0000e+00
++8.9800e-01 +7.0200e-01 3.0000e+00
++9.0200e-01 +7.0200e-01 3.0000e+00
++9.1800e-01 +6.9800e-01 3.0000e+00
++9.2200e-01 +6.9800e-01 3.0000e+00
++9.1800e-01 +7.0200e-01 3.0000e+00
++9.2200e-01 +7.0200e-01 3.0000e+00
++9.3800e-01 +6.9800e-01 3.0000e+00
++9.4200e-01 +6.9800e-01 3.0000e+00
++9.3800e-01 +7.0200e-01 3.0000e+00
++9.4200e-01 +7.0200e-01 3.0000e+00
++9.5800e-01 +6.9800e-01 3.0000e+00
++9.6200e-01 +6.9800e-01 3.0000e+00
++9.5800e-01 +7.0200e-01 3.0000e+00
++9.6200e-01 +7.0200e-01 3.0000e+00
++9.7800e-01 +6.9800e-01 3.0000e+00
++9.8200e-01 +6.9800e-01 3.0000e+00
++9.7800e-01 +7.0200e-01 3.0000e+00
++9.8200e-01 +7.0200e-01 3.0000e+00
++9.9800e-01 +6.9800e-01 3.0000e+00
++1.0020e+00 +6.9800e-01 3.0000e+00
++9.9800e-01 +7.0200e-01 3.0000e+00
++1.0020e+00 +7.0200e-01 3.0000e+00
++1.8000e-02 +7.1800e-01 3.0000e+00
++2.2000e-02 +7.1800e-01 3.0000e+00
++1.8000e-02 +7.2200e-01 3.0000e+00
++2.2000e-02 +7.2200e-01 3.0000e+00
++3.8000e-02 +7.1800e-01 3.0000e+00
++4.2000e-02 +7.1800e-01 3.0000e+00
++3.8000e-02 +7.2200e-01 3.0000e+00
++4.2000e-02 +7.2200e-01 3.0000e+00
++5.8000e-02 +7.1800e-01 3.0000e+00
++6.2000e-02 +7.1800e-01 3.0000e+00
++5.8000e-02 +7.2200e-01 3.0000e+00
++6.2000e-02 +7.2200e-01 3.0000e+00
++7.8000e-02 +7.1800e-01 3.0000e+00
++8.2000e-02 +7.1800e-01 3.0000e+00
++7.8000e-02 +7.2200e-01 3.0000e+00
++8.2000e-02 +7.2200e-01 3.0000e+00
++9.8000e-02 +7.1800e-01 3.0000e+00
++1.0200e-01 +7.1800e-01 3.0000e+00
++9.8000e-02 +7.2200e-01 3.0000e+00
++1.0200e-01 +7.2200e-01 3.0000e+00
++1.1800e-01 +7.1800e-01 3.0000e+00
++1.2200e-01 +7.1800e-01 3.0000e+00
++1.1800e-01 +7.2200e-01 3.0000e+00
++1.2200e-01 +7.2200e-01 3.0000e+00
++1.3800e-01 +7.1800e-01 3.0000e+00
++1.4200e-01 +7.1800e-01 3.0000e+00
++1.3800e-01 +7.2200e-01 3.0000e+00
++1.4200e-01 +7.2200e-01 3.0000e+00
++1.5800e-01 +7.1800e-01 3.0000e+00
++1.6200e-01 +7.1800e-01 3.0000e+00
++1.5800e-01 +7.2200e-01 3.0000e+00
++1.6200e-01 +7.2200e-01 3.0000e+00
++1.7800e-01 +7.1800e-01 3.0000e+00
++1.8200e-01 +7.1800e-01 3.0000e+00
++1.7800e-01 +7.2200e-01 3.0000e+00
++1.8200e-01 +7.2200e-01 3.0000e+00
++1.9800e-01 +7.1800e-01 3.0000e+00
++2.0200e-01 +7.1800e-01 3.0000e+00
++1.9800e-01 +7.2200e-01 3.0000e+00
++2.0200e-01 +7.2200e-01 3.0000e+00
++2.1800e-01 +7.1800e-01 3.0000e+00
++2.2200e-01 +7.1800e-01 3.0000e+00
++2.1800e-01 +7.2200e-01 3.0000e+00
++2.2200e-01 +7.2200e-01 3.0000e+00
++2.3800e-01 +7.1800e-01 3.0000e+00
++2.4200e-01 +7.1800e-01 3.0000e+00
++2.3800e-01 +7.2200e-01 3.0000e+00
++2.4200e-01 +7.2200e-01 3.0000e+00
++2.5800e-01 +7.1800e-01 3.0000e+00
++2.6200e-01 +7.1800e-01 3.0000e+00
++2.5800e-01 +7.2200e-01 3.0000e+00
++2.6200e-01 +7.2200e-01 3.0000e+00
++2.7800e-01 +7.1800e-01 3.0000e+00
++2.8200e-01 +7.1800e-01 3.0000e+00
++2.7800e-01 +7.2200e-01 3.0000e+00
++2.8200e-01 +7.2200e-01 3.0000e+00
++2.9800e-01 +7.1800e-01 3.0000e+00
++3.0200e-01 +7.1800e-01 3.0000e+00
++2.9800e-01 +7.2200e-01 3.0000e+00
++3.0200e-01 +7.2200e-01 3.0000e+00
++3.1800e-01 +7.1800e-01 3.0000e+00
++3.2200e-01 +7.1800e-01 3.0000e+00
++3.1800e-01 +7.2200e-01 3.0000e+00
++3.2200e-01 +7.2200e-01 3.0000e+00
++3.3800e-01 +7.1800e-01 3.0000e+00
++3.4200e-01 +7.1800e-01 3.0000e+00
++3.3800e-01 +7.2200e-01 3.0000e+00
++3.4200e-01 +7.2200e-01 3.0000e+00
++3.5800e-01 +7.1800e-01 3.0000e+00
++3.6200e-01 +7.1800e-01 3.0000e+00
++3.5800e-01 +7.2200e-01 3.0000e+00
++3.6200e-01 +7.2200e-01 3.0000e+00
++3.7800e-01 +7.1800e-01 3.0000e+00
++3.8200e-01 +7.1800e-01 3.0000e+00
++3.7800e-01 +7.2200e-01 3.0000e+00
++3.8200e-01 +7.2200e-01 3.0000e+00
++3.9800e-01 +7.1800e-01 3.0000e+00
++4.0200e-01 +7.1800e-01 3.0000e+00
++3.9800e-01 +7.2200e-01 3.0000e+00
++4.0200e-01 +7.2200e-01 3.0000e+00
++4.1800e-01 +7.1800e-01 3.0000e+00
++4.2200e-01 +7.1800e-01 3.0000e+00
++4.1800e-01 +7.2200e-01 3.0000e+00
++4.2200e-01 +7.2200e-01 3.0000e+00
++4.3800e-01 +7.1800e-01 3.0000e+00
++4.4200e-01 +7.1800e-01 3.0000e+00
++4.3800e-01 +7.2200e-01 3.0000e+00
++4.4200e-01 +7.2200e-01 3.0000e+00
++4.5800e-01 +7.1800e-01 3.0000e+00
++4.6200e-01 +7.1800e-01 3.0000e+00
++4.5800e-01 +7.2200e-01 3.0000e+00
++4.6200e-01 +7.2200e-01 3.0000e+00
++4.7800e-01 +7.1800e-01 3.0000e+00
++4.8200e-01 +7.1800e-01 3.0000e+00
++4.7800e-01 +7.2200e-01 3.0000e+00
++4.8200e-01 +7.2200e-01 3.0000e+00
++4.9800e-01 +7.1800e-01 3.0000e+00
++5.0200e-01 +7.1800e-01 3.0000e+00
++4.9800e-01 +7.2200e-01 3.0000e+00
++5.0200e-01 +7.2200e-01 3.0000e+00
++5.1800e-01 +7.1800e-01 3.0000e+00
++5.2200e-01 +7.1800e-01 3.0000e+00
++5.1800e-01 +7.2200e-01 3.0000e+00
++5.2200e-01 +7.2200e-01 3.0000e+00
++5.3800e-01 +7.1800e-01 3.0000e+00
++5.4200e-01 +7.1800e-01 3.0000e+00
++5.3800e-01 +7.2200e-01 3.0000e+00
++5.4200e-01 +7.2200e-01 3.0000e+00
++5.5800e-01 +7.1800e-01 3.0000e+00
++5.6200e-01 +7.1800e-01 3.0000e+00
++5.5800e-01 +7.2200e-01 3.0000e+00
++5.6200e-01 +7.2200e-01 3.0000e+00
++5.7800e-01 +7.1800e-01 3.0000e+00
++5.8200e-01 +7.1800e-01 3.0000e+00
++5.7800e-01 +7.2200e-01 3.0000e+00
++5.8200e-01 +7.2200e-01 3.0000e+00
++5.9800e-01 +7.1800e-01 3.0000e+00
++6.0200e-01 +7.1800e-01 3.0000e+00
++5.9800e-01 +7.2200e-01 3.0000e+00
++6.0200e-01 +7.2200e-01 3.0000e+00
++6.1800e-01 +7.1800e-01 3.0000e+00
++6.2200e-01 +7.1800e-01 3.0000e+00
++6.1800e-01 +7.2200e-01 3.0000e+00
++6.2200e-01 +7.2200e-01 3.0000e+00
++6.3800e-01 +7.1800e-01 3.0000e+00
++6.4200e-01 +7.1800e-01 3.0000e+00
++6.3800e-01 +7.2200e-01 3.0000e+00
++6.4200e-01 +7.2200e-01 3.0000e+00
++6.5800e-01 +7.1800e-01 3.0000e+00
++6.6200e-01 +7.1800e-01 3.0000e+00
++6.5800e-01 +7.2200e-01 3.0000e+00
++6.6200e-01 +7.2200e-01 3.0000e+00
++6.7800e-01 +7.1800e-01 3.0000e+00
++6.8200e-01 +7.1800e-01 3.0000e+00
++6.7800e-01 +7.2200e-01 3.0000e+00
++6.8200e-01 +7.2200e-01 3.0000e+00
++6.9800e-01 +7.1800e-01 3.0000e+00
++7.0200e-01 +7.1800e-01 3.0000e+00
++6.9800e-01 +7.2200e-01 3.0000e+00
++7.0200e-01 +7.2200e-01 3.0000e+00
++7.1800e-01 +7.1800e-01 3.0000e+00
++7.2200e-01 +7.1800e-01 3.0000e+00
++7.1800e-01 +7.2200e-01 3.0000e+00
++7.2200e-01 +7.2200e-01 3.0000e+00
++7.3800e-01 +7.1800e-01 3.0000e+00
++7.4200e-01 +7.1800e-01 3.0000e+00
++7.3800e-01 +7.2200e-01 3.0000e+00
++7.4200e-01 +7.2200e-01 3.0000e+00
++7.5800e-01 +7.1800e-01 3.0000e+00
++7.6200e-01 +7.1800e-01 3.0000e+00
++7.5800e-01 +7.2200e-01 3.0000e+00
++7.6200e-01 +7.2200e-01 3.0000e+00
++7.7800e-01 +7.1800e-01 3.0000e+00
++7.8200e-01 +7.1800e-01 3.0000e+00
++7.7800e-01 +7.2200e-01 3.0000e+00
++7.8200e-01 +7.2200e-01 3.0000e+00
++7.9800e-01 +7.1800e-01 3.0000e+00
++8.0200e-01 +7.1800e-01 3.0000e+00
++7.9800e-01 +7.2200e-01 3.0000e+00
++8.0200e-01 +7.2200e-01 3.0000e+00
++8.1800e-01 +7.1800e-01 3.0000e+00
++8.2200e-01 +7.1800e-01 3.0000e+00
++8.1800e-01 +7.2200e-01 3.0000e+00
++8.2200e-01 +7.2200e-01 3.0000e+00
++8.3800e-01 +7.1800e-01 3.0000e+00
++8.4200e-01 +7.1800e-01 3.0000e+00
++8.3800e-01 +7.2200e-01 3.0000e+00
++8.4200e-01 +7.2200e-01 3.0000e+00
++8.5800e-01 +7.1800e-01 3.0000e+00
++8.6200e-01 +7.1800e-01 3.0000e+00
++8.5800e-01 +7.2200e-01 3.0000e+00
++8.6200e-01 +7.2200e-01 3.0000e+00
++8.7800e-01 +7.1800e-01 3.0000e+00
++8.8200e-01 +7.1800e-01 3.0000e+00
++8.7800e-01 +7.2200e-01 3.0000e+00
++8.8200e-01 +7.2200e-01 3.0000e+00
++8.9800e-01 +7.1800e-01 3.0000e+00
++9.0200e-01 +7.1800e-01 3.0000e+00
++8.9800e-01 +7.2200e-01 3.0000e+00
++9.0200e-01 +7.2200e-01 3.0000e+00
++9.1800e-01 +7.1800e-01 3.0000e+00
++9.2200e-01 +7.1800e-01 3.0000e+00
++9.1800e-01 +7.2200e-01 3.0000e+00
++9.2200e-01 +7.2200e-01 3.0000e+00
++9.3800e-01 +7.1800e-01 3.0000e+00
++9.4200e-01 +7.1800e-01 3.0000e+00
++9.3800e-01 +7.2200e-01 3.0000e+00
++9.4200e-01 +7.2200e-01 3.0000e+00
++9.5800e-01 +7.1800e-01 3.0000e+00
++9.6200e-01 +7.1800e-01 3.0000e+00
++9.5800e-01 +7.2200e-01 3.0000e+00
++9.6200e-01 +7.2200e-01 3.0000e+00
++9.7800e-01 +7.1800e-01 3.0000e+00
++9.8200e-01 +7.1800e-01 3.0000e+00
++9.7800e-01 +7.2200e-01 3.0000e+00
++9.8200e-01 +7.2200e-01 3.0000e+00
++9.9800e-01 +7.1800e-01 3.0000e+00
++1.0020e+00 +7.1800e-01 3.0000e+00
++9.9800e-01 +7.2200e-01 3.0000e+00
++1.0020e+00 +7.2200e-01 3.0000e+00
++1.8000e-02 +7.3800e-01 3.0000e+00
++2.2000e-02 +7.3800e-01 3.0000e+00
++1.8000e-02 +7.4200e-01 3.0000e+00
++2.2000e-02 +7.4200e-01 3.0000e+00
++3.8000e-02 +7.3800e-01 3.0000e+00
++4.2000e-02 +7.3800e-01 3.0000e+00
++3.8000e-02 +7.4200e-01 3.0000e+00
++4.2000e-02 +7.4200e-01 3.0000e+00
++5.8000e-02 +7.3800e-01 3.0000e+00
++6.2000e-02 +7.3800e-01 3.0000e+00
++5.8000e-02 +7.4200e-01 3.0000e+00
++6.2000e-02 +7.4200e-01 3.0000e+00
++7.8000e-02 +7.3800e-01 3.0000e+00
++8.2000e-02 +7.3800e-01 3.0000e+00
++7.8000e-02 +7.4200e-01 3.0000e+00
++8.2000e-02 +7.4200e-01 3.0000e+00
++9.8000e-02 +7.3800e-01 3.0000e+00
++1.0200e-01 +7.3800e-01 3.0000e+00
++9.8000e-02 +7.4200e-01 3.0000e+00
++1.0200e-01 +7.4200e-01 3.0000e+00
++1.1800e-01 +7.3800e-01 3.0000e+00
++1.2200e-01 +7.3800e-01 3.0000e+00
++1.1800e-01 +7.4200e-01 3.0000e+00
++1.2200e-01 +7.4200e-01 3.0000e+00
++1.3800e-01 +7.3800e-01 3.0000e+00
++1.4200e-01 +7.3800e-01 3.0000e+00
++1.3800e-01 +7.4200e-01 3.0000e+00
++1.4200e-01 +7.4200e-01 3.0000e+00
++1.5800e-01 +7.3800e-01 3.0000e+00
++1.6200e-01 +7.3800e-01 3.0000e+00
++1.5800e-01 +7.4200e-01 3.0000e+00
++1.6200e-01 +7.4200e-01 3.0000e+00
++1.7800e-01 +7.3800e-01 3.0000e+00
++1.8200e-01 +7.3800e-01 3.0000e+00
++1.7800e-01 +7.4200e-01 3.0000e+00
++1.8200e-01 +7.4200e-01 3.0000e+00
++1.9800e-01 +7.3800e-01 3.0000e+00
++2.0200e-01 +7.3800e-01 3.0000e+00
++1.9800e-01 +7.4200e-01 3.0000e+00
++2.0200e-01 +7.4200e-01 3.0000e+00
++2.1800e-01 +7.3800e-01 3.0000e+00
++2.2200e-01 +7.3800e-01 3.0000e+00
++2.1800e-01 +7.4200e-01 3.0000e+00
++2.2200e-01 +7.4200e-01 3.0000e+00
++2.3800e-01 +7.3800e-01 3.0000e+00
++2.4200e-01 +7.3800e-01 3.0000e+00
++2.3800e-01 +7.4200e-01 3.0000e+00
++2.4200e-01 +7.4200e-01 3.0000e+00
++2.5800e-01 +7.3800e-01 3.0000e+00
++2.6200e-01 +7.3800e-01 3.0000e+00
++2.5800e-01 +7.4200e-01 3.0000e+00
++2.6200e-01 +7.4200e-01 3.0000e+00
++2.7800e-01 +7.3800e-01 3.0000e+00
++2.8200e-01 +7.3800e-01 3.0000e+00
++2.7800e-01 +7.4200e-01 3.0000e+00
++2.8200e-01 +7.4200e-01 3.0000e+00
++2.9800e-01 +7.3800e-01 3.0000e+00
++3.0200e-01 +7.3800e-01 3.0000e+00
++2.9800e-01 +7.4200e-01 3.0000e+00
++3.0200e-01 +7.4200e-01 3.0000e+00
++3.1800e-01 +7.3800e-01 3.0000e+00
++3.2200e-01 +7.3800e-01 3.0000e+00
++3.1800e-01 +7.4200e-01 3.0000e+00
++3.2200e-01 +7.4200e-01 3.0000e+00
++3.3800e-01 +7.3800e-01 3.0000e+00
++3.4200e-01 +7.3800e-01 3.0000e+00
++3.3800e-01 +7.4200e-01 3.0000e+00
++3.4200e-01 +7.4200e-01 3.0000e+00
++3.5800e-01 +7.3800e-01 3.0000e+00
++3.6200e-01 +7.3800e-01 3.0000e+00
++3.5800e-01 +7.4200e-01 3.0000e+00
++3.6200e-01 +7.4200e-01 3.0000e+00
++3.7800e-01 +7.3800e-01 3.0000e+00
++3.8200e-01 +7.3800e-01 3.0000e+00
++3.7800e-01 +7.4200e-01 3.0000e+00
++3.8200e-01 +7.4200e-01 3.0000e+00
++3.9800e-01 +7.3800e-01 3.0000e+00
++4.0200e-01 +7.3800e-01 3.0000e+00
++3.9800e-01 +7.4200e-01 3.0000e+00
++4.0200e-01 +7.4200e-01 3.0000e+00
++4.1800e-01 +7.3800e-01 3.0000e+00
++4.2200e-01 +7.3800e-01 3.0000e+00
++4.1800e-01 +7.4200e-01 3.0000e+00
++4.2200e-01 +7.4200e-01 3.0000e+00
++4.3800e-01 +7.3800e-01 3.0000e+00
++4.4200e-01 +7.3800e-01 3.0000e+00
++4.3800e-01 +7.4200e-01 3.0000e+00
++4.4200e-01 +7.4200e-01 3.0000e+00
++4.5800e-01 +7.3800e-01 3.0000e+00
++4.6200e-01 +7.3800e-01 3.0000e+00
++4.5800e-01 +7.4200e-01 3.0000e+00
++4.6200e-01 +7.4200e-01 3.0000e+00
++4.7800e-01 +7.3800e-01 3.0000e+00
++4.8200e-01 +7.3800e-01 3.0000e+00
++4.7800e-01 +7.4200e-01 3.0000e+00
++4.8200e-01 +7.4200e-01 3.0000e+00
++4.9800e-01 +7.3800e-01 3.0000e+00
++5.0200e-01 +7.3800e-01 3.0000e+00
++4.9800e-01 +7.4200e-01 3.0000e+00
++5.0200e-01 +7.4200e-01 3.0000e+00
++5.1800e-01 +7.3800e-01 3.0000e+00
++5.2200e-01 +7.3800e-01 3.0000e+00
++5.1800e-01 +7.4200e-01 3.0000e+00
++5.2200e-01 +7.4200e-01 3.0000e+00
++5.3800e-01 +7.3800e-01 3.0000e+00
++5.4200e-01 +7.3800e-01 3.0000e+00
++5.3800e-01 +7.4200e-01 3.0000e+00
++5.4200e-01 +7.4200e-01 3.0000e+00
++5.5800e-01 +7.3800e-01 3.0000e+00
++5.6200e-01 +7.3800e-01 3.0000e+00
++5.5800e-01 +7.4200e-01 3.0000e+00
++5.6200e-01 +7.4200e-01 3.0000e+00
++5.7800e-01 +7.3800e-01 3.0000e+00
++5.8200e-01 +7.3800e-01 3.0000e+00
++5.7800e-01 +7.4200e-01 3.0000e+00
++5.8200e-01 +7.4200e-01 3.0000e+00
++5.9800e-01 +7.3800e-01 3.0000e+00
++6.0200e-01 +7.3800e-01 3.0000e+00
++5.9800e-01 +7.4200e-01 3.0000e+00
++6.0200e-01 +7.4200e-01 3.0000e+00
++6.1800e-01 +7.3800e-01 3.0000e+00
++6.2200e-01 +7.3800e-01 3.0000e+00
++6.1800e-01 +7.4200e-01 3.0000e+00
++6.2200e-01 +7.4200e-01 3.0000e+00
++6.3800e-01 +7.3800e-01 3.0000e+00
++6.4200e-01 +7.3800e-01 3.0000e+00
++6.3800e-01 +7.4200e-01 3.0000e+00
++6.4200e-01 +7.4200e-01 3.0000e+00
++6.5800e-01 +7.3800e-01 3.0000e+00
++6.6200e-01 +7.3800e-01 3.0000e+00
++6.5800e-01 +7.4200e-01 3.0000e+00
++6.6200e-01 +7.4200e-01 3.0000e+00
++6.7800e-01 +7.3800e-01 3.0000e+00
++6.8200e-01 +7.3800e-01 3.0000e+00
++6.7800e-01 +7.4200e-01 3.0000e+00
++6.8200e-01 +7.4200e-01 3.0000e+00
++6.9800e-01 +7.3800e-01 3.0000e+00
++7.0200e-01 +7.3800e-01 3.0000e+00
++6.9800e-01 +7.4200e-01 3.0000e+00
++7.0200e-01 +7.4200e-01 3.0000e+00
++7.1800e-01 +7.3800e-01 3.0000e+00
++7.2200e-01 +7.3800e-01 3.0000e+00
++7.1800e-01 +7.4200e-01 3.0000e+00
++7.2200e-01 +7.4200e-01 3.0000e+00
++7.3800e-01 +7.3800e-01 3.0000e+00
++7.4200e-01 +7.3800e-01 3.0000e+00
++7.3800e-01 +7.4200e-01 3.0000e+00
++7.4200e-01 +7.4200e-01 3.0000e+00
++7.5800e-01 +7.3800e-01 3.0000e+00
++7.6200e-01 +7.3800e-01 3.0000e+00
++7.5800e-01 +7.4200e-01 3.0000e+00
++7.6200e-01 +7.4200e-01 3.0000e+00
++7.7800e-01 +7.3800e-01 3.0000e+00
++7.8200e-01 +7.3800e-01 3.0000e+00
++7.7800e-01 +7.4200e-01 3.0000e+00
++7.8200e-01 +7.4200e-01 3.0000e+00
++7.9800e-01 +7.3800e-01 3.0000e+00
++8.0200e-01 +7.3800e-01 3.0000e+00
++7.9800e-01 +7.4200e-01 3.0000e+00
++8.0200e-01 +7.4200e-01 3.0000e+00
++8.1800e-01 +7.3800e-01 3.0000e+00
++8.2200e-01 +7.3800e-01 3.0000e+00
++8.1800e-01 +7.4200e-01 3.0000e+00
++8.2200e-01 +7.4200e-01 3.0000e+00
++8.3800e-01 +7.3800e-01 3.0000e+00
++8.4200e-01 +7.3800e-01 3.0000e+00
++8.3800e-01 +7.4200e-01 3.0000e+00
++8.4200e-01 +7.4200e-01 3.0000e+00
++8.5800e-01 +7.3800e-01 3.0000e+00
++8.6200e-01 +7.3800e-01 3.0000e+00
++8.5800e-01 +7.4200e-01 3.0000e+00
++8.6200e-01 +7.4200e-01 3.0000e+00
++8.7800e-01 +7.3800e-01 3.0000e+00
++8.8200e-01 +7.3800e-01 3.0000e+00
++8.7800e-01 +7.4200e-01 3.0000e+00
++8.8200e-01 +7.4200e-01 3.0000e+00
++8.9800e-01 +7.3800e-01 3.0000e+00
++9.0200e-01 +7.3800e-01 3.0000e+00
++8.9800e-01 +7.4200e-01 3.0000e+00
++9.0200e-01 +7.4200e-01 3.0000e+00
++9.1800e-01 +7.3800e-01 3.0000e+00
++9.2200e-01 +7.3800e-01 3.0000e+00
++9.1800e-01 +7.4200e-01 3.0000e+00
++9.2200e-01 +7.4200e-01 3.0000e+00
++9.3800e-01 +7.3800e-01 3.0000e+00
++9.4200e-01 +7.3800e-01 3.0000e+00
++9.3800e-01 +7.4200e-01 3.0000e+00
++9.4200e-01 +7.4200e-01 3.0000e+00
++9.5800e-01 +7.3800e-01 3.0000e+00
++9.6200e-01 +7.3800e-01 3.0000e+00
++9.5800e-01 +7.4200e-01 3.0000e+00
++9.6200e-01 +7.4200e-01 3.0000e+00
++9.7800e-01 +7.3800e-01 3.0000e+00
++9.8200e-01 +7.3800e-01 3.0000e+00
++9.7800e-01 +7.4200e-01 3.0000e+00
++9.8200e-01 +7.4200e-01 3.0000e+00
++9.9800e-01 +7.3800e-01 3.0000e+00
++1.0020e+00 +7.3800e-01 3.0000e+00
++9.9800e-01 +7.4200e-01 3.0000e+00
++1.0020e+00 +7.4200e-01 3.0000e+00
++1.8000e-02 +7.5800e-01 3.0000e+00
++2.2000e-02 +7.5800e-01 3.0000e+00
++1.8000e-02 +7.6200e-01 3.0000e+00
++2.2000e-02 +7.6200e-01 3.0000e+00
++3.8000e-02 +7.5800e-01 3.0000e+00
++4.2000e-02 +7.5800e-01 3.0000e+00
++3.8000e-02 +7.6200e-01 3.0000e+00
++4.2000e-02 +7.6200e-01 3.0000e+00
++5.8000e-02 +7.5800e-01 3.0000e+00
++6.2000e-02 +7.5800e-01 3.0000e+00
++5.8000e-02 +7.6200e-01 3.0000e+00
++6.2000e-02 +7.6200e-01 3.0000e+00
++7.8000e-02 +7.5800e-01 3.0000e+00
++8.2000e-02 +7.5800e-01 3.0000e+00
++7.8000e-02 +7.6200e-01 3.0000e+00
++8.2000e-02 +7.6200e-01 3.0000e+00
++9.8000e-02 +7.5800e-01 3.0000e+00
++1.0200e-01 +7.5800e-01 3.0000e+00
++9.8000e-02 +7.6200e-01 3.0000e+00
++1.0200e-01 +7.6200e-01 3.0000e+00
++1.1800e-01 +7.5800e-01 3.0000e+00
++1.2200e-01 +7.5800e-01 3.0000e+00
++1.1800e-01 +7.6200e-01 3.0000e+00
++1.2200e-01 +7.6200e-01 3.0000e+00
++1.3800e-01 +7.5800e-01 3.0000e+00
++1.4200e-01 +7.5800e-01 3.0000e+00
++1.3800e-01 +7.6200e-01 3.0000e+00
++1.4200e-01 +7.6200e-01 3.0000e+00
++1.5800e-01 +7.5800e-01 3.0000e+00
++1.6200e-01 +7.5800e-01 3.0000e+00
++1.5800e-01 +7.6200e-01 3.0000e+00
++1.6200e-01 +7.6200e-01 3.0000e+00
++1.7800e-01 +7.5800e-01 3.0000e+00
++1.8200e-01 +7.5800e-01 3.0000e+00
++1.7800e-01 +7.6200e-01 3.0000e+00
++1.8200e-01 +7.6200e-01 3.0000e+00
++1.9800e-01 +7.5800e-01 3.0000e+00
++2.0200e-01 +7.5800e-01 3.0000e+00
++1.9800e-01 +7.6200e-01 3.0000e+00
++2.0200e-01 +7.6200e-01 3.0000e+00
++2.1800e-01 +7.5800e-01 3.0000e+00
++2.2200e-01 +7.5800e-01 3.0000e+00
++2.1800e-01 +7.6200e-01 3.0000e+00
++2.2200e-01 +7.6200e-01 3.0000e+00
++2.3800e-01 +7.5800e-01 3.0000e+00
++2.4200e-01 +7.5800e-01 3.0000e+00
++2.3800e-01 +7.6200e-01 3.0000e+00
++2.4200e-01 +7.6200e-01 3.0000e+00
++2.5800e-01 +7.5800e-01 3.0000e+00
++2.6200e-01 +7.5800e-01 3.0000e+00
++2.5800e-01 +7.6200e-01 3.0000e+00
++2.6200e-01 +7.6200e-01 3.0000e+00
++2.7800e-01 +7.5800e-01 3.0000e+00
++2.8200e-01 +7.5800e-01 3.0000e+00
++2.7800e-01 +7.6200e-01 3.0000e+00
++2.8200e-01 +7.6200e-01 3.0000e+00
++2.9800e-01 +7.5800e-01 3.0000e+00
++3.0200e-01 +7.5800e-01 3.0000e+00
++2.9800e-01 +7.6200e-01 3.0000e+00
++3.0200e-01 +7.6200e-01 3.0000e+00
++3.1800e-01 +7.5800e-01 3.0000e+00
++3.2200e-01 +7.5800e-01 3.0000e+00
++3.1800e-01 +7.6200e-01 3.0000e+00
++3.2200e-01 +7.6200e-01 3.0000e+00
++3.3800e-01 +7.5800e-01 3.0000e+00
++3.4200e-01 +7.5800e-01 3.0000e+00
++3.3800e-01 +7.6200e-01 3.0000e+00
++3.4200e-01 +7.6200e-01 3.0000e+00
++3.5800e-01 +7.5800e-01 3.0000e+00
++3.6200e-01 +7.5800e-01 3.0000e+00
++3.5800e-01 +7.6200e-01 3.0000e+00
++3.6200e-01 +7.6200e-01 3.0000e+00
++3.7800e-01 +7.5800e-01 3.0000e+00
++3.8200e-01 +7.5800e-01 3.0000e+00
++3.7800e-01 +7.6200e-01 3.0000e+00
++3.8200e-01 +7.6200e-01 3.0000e+00
++3.9800e-01 +7.5800e-01 3.0000e+00
++4.0200e-01 +7.5800e-01 3.0000e+00
++3.9800e-01 +7.6200e-01 3.0000e+00
++4.0200e-01 +7.6200e-01 3.0000e+00
++4.1800e-01 +7.5800e-01 3.0000e+00
++4.2200e-01 +7.5800e-01 3.0000e+00
++4.1800e-01 +7.6200e-01 3.0000e+00
++4.2200e-01 +7.6200e-01 3.0000e+00
++4.3800e-01 +7.5800e-01 3.0000e+00
++4.4200e-01 +7.5800e-01 3.0000e+00
++4.3800e-01 +7.6200e-01 3.0000e+00
++4.4200e-01 +7.6200e-01 3.0000e+00
++4.5800e-01 +7.5800e-01 3.0000e+00
++4.6200e-01 +7.5800e-01 3.0000e+00
++4.5800e-01 +7.6200e-01 3.0000e+00
++4.6200e-01 +7.6200e-01 3.0000e+00
++4.7800e-01 +7.5800e-01 3.0000e+00
++4.8200e-01 +7.5800e-01 3.0000e+00
++4.7800e-01 +7.6200e-01 3.0000e+00
++4.8200e-01 +7.6200e-01 3.0000e+00
++4.9800e-01 +7.5800e-01 3.0000e+00
++5.0200e-01 +7.5800e-01 3.0000e+00
++4.9800e-01 +7.6200e-01 3.0000e+00
++5.0200e-01 +7.6200e-01 3.0000e+00
++5.1800e-01 +7.5800e-01 3.0000e+00
++5.2200e-01 +7.5800e-01 3.0000e+00
++5.1800e-01 +7.6200e-01 3.0000e+00
++5.2200e-01 +7.6200e-01 3.0000e+00
++5.3800e-01 +7.5800e-01 3.0000e+00
++5.4200e-01 +7.5800e-01 3.0000e+00
++5.3800e-01 +7.6200e-01 3.0000e+00
++5.4200e-01 +7.6200e-01 3.0000e+00
++5.5800e-01 +7.5800e-01 3.0000e+00
++5.6200e-01 +7.5800e-01 3.0000e+00
++5.5800e-01 +7.6200e-01 3.0000e+00
++5.6200e-01 +7.6200e-01 3.0000e+00
++5.7800e-01 +7.5800e-01 3.0000e+00
++5.8200e-01 +7.5800e-01 3.0000e+00
++5.7800e-01 +7.6200e-01 3.0000e+00
++5.8200e-01 +7.6200e-01 3.0000e+00
++5.9800e-01 +7.5800e-01 3.0000e+00
++6.0200e-01 +7.5800e-01 3.0000e+00
++5.9800e-01 +7.6200e-01 3.0000e+00
++6.0200e-01 +7.6200e-01 3.0000e+00
++6.1800e-01 +7.5800e-01 3.0000e+00
++6.2200e-01 +7.5800e-01 3.0000e+00
++6.1800e-01 +7.6200e-01 3.0000e+00
++6.2200e-01 +7.6200e-01 3.0000e+00
++6.3800e-01 +7.5800e-01 3.0000e+00
++6.4200e-01 +7.5800e-01 3.0000e+00
++6.3800e-01 +7.6200e-01 3.0000e+00
++6.4200e-01 +7.6200e-01 3.0000e+00
++6.5800e-01 +7.5800e-01 3.0000e+00
++6.6200e-01 +7.5800e-01 3.0000e+00
++6.5800e-01 +7.6200e-01 3.0000e+00
++6.6200e-01 +7.6200e-01 3.0000e+00
++6.7800e-01 +7.5800e-01 3.0000e+00
++6.8200e-01 +7.5800e-01 3.0000e+00
++6.7800e-01 +7.6200e-01 3.0000e+00
++6.8200e-01 +7.6200e-01 3.0000e+00
++6.9800e-01 +7.5800e-01 3.0000e+00
++7.0200e-01 +7.5800e-01 3.0000e+00
++6.9800e-01 +7.6200e-01 3.0000e+00
++7.0200e-01 +7.6200e-01 3.0000e+00
++7.1800e-01 +7.5800e-01 3.0000e+00
++7.2200e-01 +7.5800e-01 3.0000e+00
++7.1800e-01 +7.6200e-01 3.0000e+00
++7.2200e-01 +7.6200e-01 3.0000e+00
++7.3800e-01 +7.5800e-01 3.0000e+00
++7.4200e-01 +7.5800e-01 3.0000e+00
++7.3800e-01 +7.6200e-01 3.0000e+00
++7.4200e-01 +7.6200e-01 3.0000e+00
++7.5800e-01 +7.5800e-01 3.0000e+00
++7.6200e-01 +7.5800e-01 3.0000e+00
++7.5800e-01 +7.6200e-01 3.0000e+00
++7.6200e-01 +7.6200e-01 3.0000e+00
++7.7800e-01 +7.5800e-01 3.0000e+00
++7.8200e-01 +7.5800e-01 3.0000e+00
++7.7800e-01 +7.6200e-01 3.0000e+00
++7.8200e-01 +7.6200e-01 3.0000e+00
++7.9800e-01 +7.5800e-01 3.0000e+00
++8.0200e-01 +7.5800e-01 3.0000e+00
++7.9800e-01 +7.6200e-01 3.0000e+00
++8.0200e-01 +7.6200e-01 3.0000e+00
++8.1800e-01 +7.5800e-01 3.0000e+00
++8.2200e-01 +7.5800e-01 3.0000e+00
++8.1800e-01 +7.6200e-01 3.0000e+00
++8.2200e-01 +7.6200e-01 3.0000e+00
++8.3800e-01 +7.5800e-01 3.0000e+00
++8.4200e-01 +7.5800e-01 3.0000e+00
++8.3800e-01 +7.6200e-01 3.0000e+00
++8.4200e-01 +7.6200e-01 3.0000e+00
++8.5800e-01 +7.5800e-01 3.0000e+00
++8.6200e-01 +7.5800e-01 3.0000e+00
++8.5800e-01 +7.6200e-01 3.0000e+00
++8.6200e-01 +7.6200e-01 3.0000e+00
++8.7800e-01 +7.5800e-01 3.0000e+00
++8.8200e-01 +7.5800e-01 3.0000e+00
++8.7800e-01 +7.6200e-01 3.0000e+00
++8.8200e-01 +7.6200e-01 3.0000e+00
++8.9800e-01 +7.5800e-01 3.0000e+00
++9.0200e-01 +7.5800e-01 3.0000e+00
++8.9800e-01 +7.6200e-01 3.0000e+00
++9.0200e-01 +7.6200e-01 3.0000e+00
++9.1800e-01 +7.5800e-01 3.0000e+00
++9.2200e-01 +7.5800e-01 3.0000e+00
++9.1800e-01 +7.6200e-01 3.0000e+00
++9.2200e-01 +7.6200e-01 3.0000e+00
++9.3800e-01 +7.5800e-01 3.0000e+00
++9.4200e-01 +7.5800e-01 3.0000e+00
++9.3800e-01 +7.6200e-01 3.0000e+00
++9.4200e-01 +7.6200e-01 3.0000e+00
++9.5800e-01 +7.5800e-01 3.0000e+00
++9.6200e-01 +7.5800e-01 3.0000e+00
++9.5800e-01 +7.6200e-01 3.0000e+00
++9.6200e-01 +7.6200e-01 3.0000e+00
++9.7800e-01 +7.5800e-01 3.0000e+00
++9.8200e-01 +7.5800e-01 3.0000e+00
++9.7800e-01 +7.6200e-01 3.0000e+00
++9.8200e-01 +7.6200e-01 3.0000e+00
++9.9800e-01 +7.5800e-01 3.0000e+00
++1.0020e+00 +7.5800e-01 3.0000e+00
++9.9800e-01 +7.6200e-01 3.0000e+00
++1.0020e+00 +7.6200e-01 3.0000e+00
++1.8000e-02 +7.7800e-01 3.0000e+00
++2.2000e-02 +7.7800e-01 3.0000e+00
++1.8000e-02 +7.8200e-01 3.0000e+00
++2.2000e-02 +7.8200e-01 3.0000e+00
++3.8000e-02 +7.7800e-01 3.0000e+00
++4.2000e-02 +7.7800e-01 3.0000e+00
++3.8000e-02 +7.8200e-01 3.0000e+00
++4.2000e-02 +7.8200e-01 3.0000e+00
++5.8000e-02 +7.7800e-01 3.0000e+00
++6.2000e-02 +7.7800e-01 3.0000e+00
++5.8000e-02 +7.8200e-01 3.0000e+00
++6.2000e-02 +7.8200e-01 3.0000e+00
++7.8000e-02 +7.7800e-01 3.0000e+00
++8.2000e-02 +7.7800e-01 3.0000e+00
++7.8000e-02 +7.8200e-01 3.0000e+00
++8.2000e-02 +7.8200e-01 3.0000e+00
++9.8000e-02 +7.7800e-01 3.0000e+00
++1.0200e-01 +7.7800e-01 3.0000e+00
++9.8000e-02 +7.8200e-01 3.0000e+00
++1.0200e-01 +7.8200e-01 3.0000e+00
++1.1800e-01 +7.7800e-01 3.0000e+00
++1.2200e-01 +7.7800e-01 3.0000e+00
++1.1800e-01 +7.8200e-01 3.0000e+00
++1.2200e-01 +7.8200e-01 3.0000e+00
++1.3800e-01 +7.7800e-01 3.0000e+00
++1.4200e-01 +7.7800e-01 3.0000e+00
++1.3800e-01 +7.8200e-01 3.0000e+00
++1.4200e-01 +7.8200e-01 3.0000e+00
++1.5800e-01 +7.7800e-01 3.0000e+00
++1.6200e-01 +7.7800e-01 3.0000e+00
++1.5800e-01 +7.8200e-01 3.0000e+00
++1.6200e-01 +7.8200e-01 3.0000e+00
++1.7800e-01 +7.7800e-01 3.0000e+00
++1.8200e-01 +7.7800e-01 3.0000e+00
++1.7800e-01 +7.8200e-01 3.0000e+00
++1.8200e-01 +7.8200e-01 3.0000e+00
++1.9800e-01 +7.7800e-01 3.0000e+00
++2.0200e-01 +7.7800e-01 3.0000e+00
++1.9800e-01 +7.8200e-01 3.0000e+00
++2.0200e-01 +7.8200e-01 3.0000e+00
++2.1800e-01 +7.7800e-01 3.0000e+00
++2.2200e-01 +7.7800e-01 3.0000e+00
++2.1800e-01 +7.8200e-01 3.0000e+00
++2.2200e-01 +7.8200e-01 3.0000e+00
++2.3800e-01 +7.7800e-01 3.0000e+00
++2.4200e-01 +7.7800e-01 3.0000e+00
++2.3800e-01 +7.8200e-01 3.0000e+00
++2.4200e-01 +7.8200e-01 3.0000e+00
++2.5800e-01 +7.7800e-01 3.0000e+00
++2.6200e-01 +7.7800e-01 3.0000e+00
++2.5800e-01 +7.8200e-01 3.0000e+00
++2.6200e-01 +7.8200e-01 3.0000e+00
++2.7800e-01 +7.7800e-01 3.0000e+00
++2.8200e-01 +7.7800e-01 3.0000e+00
++2.7800e-01 +7.8200e-01 3.0000e+00
++2.8200e-01 +7.8200e-01 3.0000e+00
++2.9800e-01 +7.7800e-01 3.0000e+00
++3.0200e-01 +7.7800e-01 3.0000e+00
++2.9800e-01 +7.8200e-01 3.0000e+00
++3.0200e-01 +7.8200e-01 3.0000e+00
++3.1800e-01 +7.7800e-01 3.0000e+00
++3.2200e-01 +7.7800e-01 3.0000e+00
++3.1800e-01 +7.8200e-01 3.0000e+00
++3.2200e-01 +7.8200e-01 3.0000e+00
++3.3800e-01 +7.7800e-01 3.0000e+00
++3.4200e-01 +7.7800e-01 3.0000e+00
++3.3800e-01 +7.8200e-01 3.0000e+00
++3.4200e-01 +7.8200e-01 3.0000e+00
++3.5800e-01 +7.7800e-01 3.0000e+00
++3.6200e-01 +7.7800e-01 3.0000e+00
++3.5800e-01 +7.8200e-01 3.0000e+00
++3.6200e-01 +7.8200e-01 3.0000e+00
++3.7800e-01 +7.7800e-01 3.0000e+00
++3.8200e-01 +7.7800e-01 3.0000e+00
++3.7800e-01 +7.8200e-01 3.0000e+00
++3.8200e-01 +7.8200e-01 3.0000e+00
++3.9800e-01 +7.7800e-01 3.0000e+00
++4.0200e-01 +7.7800e-01 3.0000e+00
++3.9800e-01 +7.8200e-01 3.0000e+00
++4.0200e-01 +7.8200e-01 3.0000e+00
++4.1800e-01 +7.7800e-01 3.0000e+00
++4.2200e-01 +7.7800e-01 3.0000e+00
++4.1800e-01 +7.8200e-01 3.0000e+00
++4.2200e-01 +7.8200e-01 3.0000e+00
++4.3800e-01 +7.7800e-01 3.0000e+00
++4.4200e-01 +7.7800e-01 3.0000e+00
++4.3800e-01 +7.8200e-01 3.0000e+00
++4.4200e-01 +7.8200e-01 3.0000e+00
++4.5800e-01 +7.7800e-01 3.0000e+00
++4.6200e-01 +7.7800e-01 3.0000e+00
++4.5800e-01 +7.8200e-01 3.0000e+00
++4.6200e-01 +7.8200e-01 3.0000e+00
++4.7800e-01 +7.7800e-01 3.0000e+00
++4.8200e-01 +7.7800e-01 3.0000e+00
++4.7800e-01 +7.8200e-01 3.0000e+00
++4.8200e-01 +7.8200e-01 3.0000e+00
++4.9800e-01 +7.7800e-01 3.0000e+00
++5.0200e-01 +7.7800e-01 3.0000e+00
++4.9800e-01 +7.8200e-01 3.0000e+00
++5.0200e-01 +7.8200e-01 3.0000e+00
++5.1800e-01 +7.7800e-01 3.0000e+00
++5.2200e-01 +7.7800e-01 3.0000e+00
++5.1800e-01 +7.8200e-01 3.0000e+00
++5.2200e-01 +7.8200e-01 3.0000e+00
++5.3800e-01 +7.7800e-01 3.0000e+00
++5.4200e-01 +7.7800e-01 3.0000e+00
++5.3800e-01 +7.8200e-01 3.0000e+00
++5.4200e-01 +7.8200e-01 3.0000e+00
++5.5800e-01 +7.7800e-01 3.0000e+00
++5.6200e-01 +7.7800e-01 3.0000e+00
++5.5800e-01 +7.8200e-01 3.0000e+00
++5.6200e-01 +7.8200e-01 3.0000e+00
++5.7800e-01 +7.7800e-01 3.0000e+00
++5.8200e-01 +7.7800e-01 3.0000e+00
++5.7800e-01 +7.8200e-01 3.0000e+00
++5.8200e-01 +7.8200e-01 3.0000e+00
++5.9800e-01 +7.7800e-01 3.0000e+00
++6.0200e-01 +7.7800e-01 3.0000e+00
++5.9800e-01 +7.8200e-01 3.0000e+00
++6.0200e-01 +7.8200e-01 3.0000e+00
++6.1800e-01 +7.7800e-01 3.0000e+00
++6.2200e-01 +7.7800e-01 3.0000e+00
++6.1800e-01 +7.8200e-01 3.0000e+00
++6.2200e-01 +7.8200e-01 3.0000e+00
++6.3800e-01 +7.7800e-01 3.0000e+00
++6.4200e-01 +7.7800e-01 3.0000e+00
++6.3800e-01 +7.8200e-01 3.0000e+00
++6.4200e-01 +7.8200e-01 3.0000e+00
++6.5800e-01 +7.7800e-01 3.0000e+00
++6.6200e-01 +7.7800e-01 3.0000e+00
++6.5800e-01 +7.8200e-01 3.0000e+00
++6.6200e-01 +7.8200e-01 3.0000e+00
++6.7800e-01 +7.7800e-01 3.0000e+00
++6.8200e-01 +7.7800e-01 3.0000e+00
++6.7800e-01 +7.8200e-01 3.0000e+00
++6.8200e-01 +7.8200e-01 3.0000e+00
++6.9800e-01 +7.7800e-01 3.0000e+00
++7.0200e-01 +7.7800e-01 3.0000e+00
++6.9800e-01 +7.8200e-01 3.0000e+00
++7.0200e-01 +7.8200e-01 3.0000e+00
++7.1800e-01 +7.7800e-01 3.0000e+00
++7.2200e-01 +7.7800e-01 3.0000e+00
++7.1800e-01 +7.8200e-01 3.0000e+00
++7.2200e-01 +7.8200e-01 3.0000e+00
++7.3800e-01 +7.7800e-01 3.0000e+00
++7.4200e-01 +7.7800e-01 3.0000e+00
++7.3800e-01 +7.8200e-01 3.0000e+00
++7.4200e-01 +7.8200e-01 3.0000e+00
++7.5800e-01 +7.7800e-01 3.0000e+00
++7.6200e-01 +7.7800e-01 3.0000e+00
++7.5800e-01 +7.8200e-01 3.0000e+00
++7.6200e-01 +7.8200e-01 3.0000e+00
++7.7800e-01 +7.7800e-01 3.0000e+00
++7.8200e-01 +7.7800e-01 3.0000e+00
++7.7800e-01 +7.8200e-01 3.0000e+00
++7.8200e-01 +7.8200e-01 3.0000e+00
++7.9800e-01 +7.7800e-01 3.0000e+00
++8.0200e-01 +7.7800e-01 3.0000e+00
++7.9800e-01 +7.8200e-01 3.0000e+00
++8.0200e-01 +7.8200e-01 3.0000e+00
++8.1800e-01 +7.7800e-01 3.0000e+00
++8.2200e-01 +7.7800e-01 3.0000e+00
++8.1800e-01 +7.8200e-01 3.0000e+00
++8.2200e-01 +7.8200e-01 3.0000e+00
++8.3800e-01 +7.7800e-01 3.0000e+00
++8.4200e-01 +7.7800e-01 3.0000e+00
++8.3800e-01 +7.8200e-01 3.0000e+00
++8.4200e-01 +7.8200e-01 3.0000e+00
++8.5800e-01 +7.7800e-01 3.0000e+00
++8.6200e-01 +7.7800e-01 3.0000e+00
++8.5800e-01 +7.8200e-01 3.0000e+00
++8.6200e-01 +7.8200e-01 3.0000e+00
++8.7800e-01 +7.7800e-01 3.0000e+00
++8.8200e-01 +7.7800e-01 3.0000e+00
++8.7800e-01 +7.8200e-01 3.0000e+00
++8.8200e-01 +7.8200e-01 3.0000e+00
++8.9800e-01 +7.7800e-01 3.0000e+00
++9.0200e-01 +7.7800e-01 3.0000e+00
++8.9800e-01 +7.8200e-01 3.0000e+00
++9.0200e-01 +7.8200e-01 3.0000e+00
++9.1800e-01 +7.7800e-01 3.0000e+00
++9.2200e-01 +7.7800e-01 3.0000e+00
++9.1800e-01 +7.8200e-01 3.0000e+00
++9.2200e-01 +7.8200e-01 3.0000e+00
++9.3800e-01 +7.7800e-01 3.0000e+00
++9.4200e-01 +7.7800e-01 3.0000e+00
++9.3800e-01 +7.8200e-01 3.0000e+00
++9.4200e-01 +7.8200e-01 3.0000e+00
++9.5800e-01 +7.7800e-01 3.0000e+00
++9.6200e-01 +7.7800e-01 3.0000e+00
++9.5800e-01 +7.8200e-01 3.0000e+00
++9.6200e-01 +7.8200e-01 3.0000e+00
++9.7800e-01 +7.7800e-01 3.0000e+00
++9.8200e-01 +7.7800e-01 3.0000e+00
++9.7800e-01 +7.8200e-01 3.0000e+00
++9.8200e-01 +7.8200e-01 3.0000e+00
++9.9800e-01 +7.7800e-01 3.0000e+00
++1.0020e+00 +7.7800e-01 3.0000e+00
++9.9800e-01 +7.8200e-01 3.0000e+00
++1.0020e+00 +7.8200e-01 3.0000e+00
++1.8000e-02 +7.9800e-01 3.0000e+00
++2.2000e-02 +7.9800e-01 3.0000e+00
++1.8000e-02 +8.0200e-01 3.0000e+00
++2.2000e-02 +8.0200e-01 3.0000e+00
++3.8000e-02 +7.9800e-01 3.0000e+00
++4.2000e-02 +7.9800e-01 3.0000e+00
++3.8000e-02 +8.0200e-01 3.0000e+00
++4.2000e-02 +8.0200e-01 3.0000e+00
++5.8000e-02 +7.9800e-01 3.0000e+00
++6.2000e-02 +7.9800e-01 3.0000e+00
++5.8000e-02 +8.0200e-01 3.0000e+00
++6.2000e-02 +8.0200e-01 3.0000e+00
++7.8000e-02 +7.9800e-01 3.0000e+00
++8.2000e-02 +7.9800e-01 3.0000e+00
++7.8000e-02 +8.0200e-01 3.0000e+00
++8.2000e-02 +8.0200e-01 3.0000e+00
++9.8000e-02 +7.9800e-01 3.0000e+00
++1.0200e-01 +7.9800e-01 3.0000e+00
++9.8000e-02 +8.0200e-01 3.0000e+00
++1.0200e-01 +8.0200e-01 3.0000e+00
++1.1800e-01 +7.9800e-01 3.0000e+00
++1.2200e-01 +7.9800e-01 3.0000e+00
++1.1800e-01 +8.0200e-01 3.0000e+00
++1.2200e-01 +8.0200e-01 3.0000e+00
++1.3800e-01 +7.9800e-01 3.0000e+00
++1.4200e-01 +7.9800e-01 3.0000e+00
++1.3800e-01 +8.0200e-01 3.0000e+00
++1.4200e-01 +8.0200e-01 3.0000e+00
++1.5800e-01 +7.9800e-01 3.0000e+00
++1.6200e-01 +7.9800e-01 3.0000e+00
++1.5800e-01 +8.0200e-01 3.0000e+00
++1.6200e-01 +8.0200e-01 3.0000e+00
++1.7800e-01 +7.9800e-01 3.0000e+00
++1.8200e-01 +7.9800e-01 3.0000e+00
++1.7800e-01 +8.0200e-01 3.0000e+00
++1.8200e-01 +8.0200e-01 3.0000e+00
++1.9800e-01 +7.9800e-01 3.0000e+00
++2.0200e-01 +7.9800e-01 3.0000e+00
++1.9800e-01 +8.0200e-01 3.0000e+00
++2.0200e-01 +8.0200e-01 3.0000e+00
++2.1800e-01 +7.9800e-01 3.0000e+00
++2.2200e-01 +7.9800e-01 3.0000e+00
++2.1800e-01 +8.0200e-01 3.0000e+00
++2.2200e-01 +8.0200e-01 3.0000e+00
++2.3800e-01 +7.9800e-01 3.0000e+00
++2.4200e-01 +7.9800e-01 3.0000e+00
++2.3800e-01 +8.0200e-01 3.0000e+00
++2.4200e-01 +8.0200e-01 3.0000e+00
++2.5800e-01 +7.9800e-01 3.0000e+00
++2.6200e-01 +7.9800e-01 3.0000e+00
++2.5800e-01 +8.0200e-01 3.0000e+00
++2.6200e-01 +8.0200e-01 3.0000e+00
++2.7800e-01 +7.9800e-01 3.0000e+00
++2.8200e-01 +7.9800e-01 3.0000e+00
++2.7800e-01 +8.0200e-01 3.0000e+00
++2.8200e-01 +8.0200e-01 3.0000e+00
++2.9800e-01 +7.9800e-01 3.0000e+00
++3.0200e-01 +7.9800e-01 3.0000e+00
++2.9800e-01 +8.0200e-01 3.0000e+00
++3.0200e-01 +8.0200e-01 3.0000e+00
++3.1800e-01 +7.9800e-01 3.0000e+00
++3.2200e-01 +7.9800e-01 3.0000e+00
++3.1800e-01 +8.0200e-01 3.0000e+00
++3.2200e-01 +8.0200e-01 3.0000e+00
++3.3800e-01 +7.9800e-01 3.0000e+00
++3.4200e-01 +7.9800e-01 3.0000e+00
++3.3800e-01 +8.0200e-01 3.0000e+00
++3.4200e-01 +8.0200e-01 3.0000e+00
++3.5800e-01 +7.9800e-01 3.0000e+00
++3.6200e-01 +7.9800e-01 3.0000e+00
++3.5800e-01 +8.0200e-01 3.0000e+00
++3.6200e-01 +8.0200e-01 3.0000e+00
++3.7800e-01 +7.9800e-01 3.0000e+00
++3.8200e-01 +7.9800e-01 3.0000e+00
++3.7800e-01 +8.0200e-01 3.0000e+00
++3.8200e-01 +8.0200e-01 3.0000e+00
++3.9800e-01 +7.9800e-01 3.0000e+00
++4.0200e-01 +7.9800e-01 3.0000e+00
++3.9800e-01 +8.0200e-01 3.0000e+00
++4.0200e-01 +8.0200e-01 3.0000e+00
++4.1800e-01 +7.9800e-01 3.0000e+00
++4.2200e-01 +7.9800e-01 3.0000e+00
++4.1800e-01 +8.0200e-01 3.0000e+00
++4.2200e-01 +8.0200e-01 3.0000e+00
++4.3800e-01 +7.9800e-01 3.0000e+00
++4.4200e-01 +7.9800e-01 3.0000e+00
++4.3800e-01 +8.0200e-01 3.0000e+00
++4.4200e-01 +8.0200e-01 3.0000e+00
++4.5800e-01 +7.9800e-01 3.0000e+00
++4.6200e-01 +7.9800e-01 3.0000e+00
++4.5800e-01 +8.0200e-01 3.0000e+00
++4.6200e-01 +8.0200e-01 3.0000e+00
++4.7800e-01 +7.9800e-01 3.0000e+00
++4.8200e-01 +7.9800e-01 3.0000e+00
++4.7800e-01 +8.0200e-01 3.0000e+00
++4.8200e-01 +8.0200e-01 3.0000e+00
++4.9800e-01 +7.9800e-01 3.0000e+00
++5.0200e-01 +7.9800e-01 3.0000e+00
++4.9800e-01 +8.0200e-01 3.0000e+00
++5.0200e-01 +8.0200e-01 3.0000e+00
++5.1800e-01 +7.9800e-01 3.0000e+00
++5.2200e-01 +7.9800e-01 3.0000e+00
++5.1800e-01 +8.0200e-01 3.0000e+00
++5.2200e-01 +8.0200e-01 3.0000e+00
++5.3800e-01 +7.9800e-01 3.0000e+00
++5.4200e-01 +7.9800e-01 3.0000e+00
++5.3800e-01 +8.0200e-01 3.0000e+00
++5.4200e-01 +8.0200e-01 3.0000e+00
++5.5800e-01 +7.9800e-01 3.0000e+00
++5.6200e-01 +7.9800e-01 3.0000e+00
++5.5800e-01 +8.0200e-01 3.0000e+00
++5.6200e-01 +8.0200e-01 3.0000e+00
++5.7800e-01 +7.9800e-01 3.0000e+00
++5.8200e-01 +7.9800e-01 3.0000e+00
++5.7800e-01 +8.0200e-01 3.0000e+00
++5.8200e-01 +8.0200e-01 3.0000e+00
++5.9800e-01 +7.9800e-01 3.0000e+00
++6.0200e-01 +7.9800e-01 3.0000e+00
++5.9800e-01 +8.0200e-01 3.0000e+00
++6.0200e-01 +8.0200e-01 3.0000e+00
++6.1800e-01 +7.9800e-01 3.0000e+00
++6.2200e-01 +7.9800e-01 3.0000e+00
++6.1800e-01 +8.0200e-01 3.0000e+00
++6.2200e-01 +8.0200e-01 3.0000e+00
++6.3800e-01 +7.9800e-01 3.0000e+00
++6.4200e-01 +7.9800e-01 3.0000e+00
++6.3800e-01 +8.0200e-01 3.0000e+00
++6.4200e-01 +8.0200e-01 3.0000e+00
++6.5800e-01 +7.9800e-01 3.0000e+00
++6.6200e-01 +7.9800e-01 3.0000e+00
++6.5800e-01 +8.0200e-01 3.0000e+00
++6.6200e-01 +8.0200e-01 3.0000e+00
++6.7800e-01 +7.9800e-01 3.0000e+00
++6.8200e-01 +7.9800e-01 3.0000e+00
++6.7800e-01 +8.0200e-01 3.0000e+00
++6.8200e-01 +8.0200e-01 3.0000e+00
++6.9800e-01 +7.9800e-01 3.0000e+00
++7.0200e-01 +7.9800e-01 3.0000e+00
++6.9800e-01 +8.0200e-01 3.0000e+00
++7.0200e-01 +8.0200e-01 3.0000e+00
++7.1800e-01 +7.9800e-01 3.0000e+00
++7.2200e-01 +7.9800e-01 3.0000e+00
++7.1800e-01 +8.0200e-01 3.0000e+00
++7.2200e-01 +8.0200e-01 3.0000e+00
++7.3800e-01 +7.9800e-01 3.0000e+00
++7.4200e-01 +7.9800e-01 3.0000e+00
++7.3800e-01 +8.0200e-01 3.0000e+00
++7.4200e-01 +8.0200e-01 3.0000e+00
++7.5800e-01 +7.9800e-01 3.0000e+00
++7.6200e-01 +7.9800e-01 3.0000e+00
++7.5800e-01 +8.0200e-01 3.0000e+00
++7.6200e-01 +8.0200e-01 3.0000e+00
++7.7800e-01 +7.9800e-01 3.0000e+00
++7.8200e-01 +7.9800e-01 3.0000e+00
++7.7800e-01 +8.0200e-01 3.0000e+00
++7.8200e-01 +8.0200e-01 3.0000e+00
++7.9800e-01 +7.9800e-01 3.0000e+00
++8.0200e-01 +7.9800e-01 3.0000e+00
++7.9800e-01 +8.0200e-01 3.0000e+00
++8.0200e-01 +8.0200e-01 3.0000e+00
++8.1800e-01 +7.9800e-01 3.0000e+00
++8.2200e-01 +7.9800e-01 3.0000e+00
++8.1800e-01 +8.0200e-01 3.0000e+00
++8.2200e-01 +8.0200e-01 3.0000e+00
++8.3800e-01 +7.9800e-01 3.0000e+00
++8.4200e-01 +7.9800e-01 3.0000e+00
++8.3800e-01 +8.0200e-01 3.0000e+00
++8.4200e-01 +8.0200e-01 3.0000e+00
++8.5800e-01 +7.9800e-01 3.0000e+00
++8.6200e-01 +7.9800e-01 3.0000e+00
++8.5800e-01 +8.0200e-01 3.0000e+00
++8.6200e-01 +8.0200e-01 3.0000e+00
++8.7800e-01 +7.9800e-01 3.0000e+00
++8.8200e-01 +7.9800e-01 3.0000e+00
++8.7800e-01 +8.0200e-01 3.0000e+00
++8.8200e-01 +8.0200e-01 3.0000e+00
++8.9800e-01 +7.9800e-01 3.0000e+00
++9.0200e-01 +7.9800e-01 3.0000e+00
++8.9800e-01 +8.0200e-01 3.0000e+00
++9.0200e-01 +8.0200e-01 3.0000e+00
++9.1800e-01 +7.9800e-01 3.0000e+00
++9.2200e-01 +7.9800e-01 3.0000e+00
++9.1800e-01 +8.0200e-01 3.0000e+00
++9.2200e-01 +8.0200e-01 3.0000e+00
++9.3800e-01 +7.9800e-01 3.0000e+00
++9.4200e-01 +7.9800e-01 3.0000e+00
++9.3800e-01 +8.0200e-01 3.0000e+00
++9.4200e-01 +8.0200e-01 3.0000e+00
++9.5800e-01 +7.9800e-01 3.0000e+00
++9.6200e-01 +7.9800e-01 3.0000e+00
++9.5800e-01 +8.0200e-01 3.0000e+00
++9.6200e-01 +8.0200e-01 3.0000e+00
++9.7800e-01 +7.9800e-01 3.0000e+00
++9.8200e-01 +7.9800e-01 3.0000e+00
++9.7800e-01 +8.0200e-01 3.0000e+00
++9.8200e-01 +8.0200e-01 3.0000e+00
++9.9800e-01 +7.9800e-01 3.0000e+00
++1.0020e+00 +7.9800e-01 3.0000e+00
++9.9800e-01 +8.0200e-01 3.0000e+00
++1.0020e+00 +8.0200e-01 3.0000e+00
++1.8000e-02 +8.1800e-01 3.0000e+00
++2.2000e-02 +8.1800e-01 3.0000e+00
++1.8000e-02 +8.2200e-01 3.0000e+00
++2.2000e-02 +8.2200e-01 3.0000e+00
++3.8000e-02 +8.1800e-01 3.0000e+00
++4.2000e-02 +8.1800e-01 3.0000e+00
++3.8000e-02 +8.2200e-01 3.0000e+00
++4.2000e-02 +8.2200e-01 3.0000e+00
++5.8000e-02 +8.1800e-01 3.0000e+00
++6.2000e-02 +8.1800e-01 3.0000e+00
++5.8000e-02 +8.2200e-01 3.0000e+00
++6.2000e-02 +8.2200e-01 3.0000e+00
++7.8000e-02 +8.1800e-01 3.0000e+00
++8.2000e-02 +8.1800e-01 3.0000e+00
++7.8000e-02 +8.2200e-01 3.0000e+00
++8.2000e-02 +8.2200e-01 3.0000e+00
++9.8000e-02 +8.1800e-01 3.0000e+00
++1.0200e-01 +8.1800e-01 3.0000e+00
++9.8000e-02 +8.2200e-01 3.0000e+00
++1.0200e-01 +8.2200e-01 3.0000e+00
++1.1800e-01 +8.1800e-01 3.0000e+00
++1.2200e-01 +8.1800e-01 3.0000e+00
++1.1800e-01 +8.2200e-01 3.0000e+00
++1.2200e-01 +8.2200e-01 3.0000e+00
++1.3800e-01 +8.1800e-01 3.0000e+00
++1.4200e-01 +8.1800e-01 3.0000e+00
++1.3800e-01 +8.2200e-01 3.0000e+00
++1.4200e-01 +8.2200e-01 3.0000e+00
++1.5800e-01 +8.1800e-01 3.0000e+00
++1.6200e-01 +8.1800e-01 3.0000e+00
++1.5800e-01 +8.2200e-01 3.0000e+00
++1.6200e-01 +8.2200e-01 3.0000e+00
++1.7800e-01 +8.1800e-01 3.0000e+00
++1.8200e-01 +8.1800e-01 3.0000e+00
++1.7800e-01 +8.2200e-01 3.0000e+00
++1.8200e-01 +8.2200e-01 3.0000e+00
++1.9800e-01 +8.1800e-01 3.0000e+00
++2.0200e-01 +8.1800e-01 3.0000e+00
++1.9800e-01 +8.2200e-01 3.0000e+00
++2.0200e-01 +8.2200e-01 3.0000e+00
++2.1800e-01 +8.1800e-01 3.0000e+00
++2.2200e-01 +8.1800e-01 3.0000e+00
++2.1800e-01 +8.2200e-01 3.0000e+00
++2.2200e-01 +8.2200e-01 3.0000e+00
++2.3800e-01 +8.1800e-01 3.0000e+00
++2.4200e-01 +8.1800e-01 3.0000e+00
++2.3800e-01 +8.2200e-01 3.0000e+00
++2.4200e-01 +8.2200e-01 3.0000e+00
++2.5800e-01 +8.1800e-01 3.0000e+00
++2.6200e-01 +8.1800e-01 3.0000e+00
++2.5800e-01 +8.2200e-01 3.0000e+00
++2.6200e-01 +8.2200e-01 3.0000e+00
++2.7800e-01 +8.1800e-01 3.0000e+00
++2.8200e-01 +8.1800e-01 3.0000e+00
++2.7800e-01 +8.2200e-01 3.0000e+00
++2.8200e-01 +8.2200e-01 3.0000e+00
++2.9800e-01 +8.1800e-01 3.0000e+00
++3.0200e-01 +8.1800e-01 3.0000e+00
++2.9800e-01 +8.2200e-01 3.0000e+00
++3.0200e-01 +8.2200e-01 3.0000e+00
++3.1800e-01 +8.1800e-01 3.0000e+00
++3.2200e-01 +8.1800e-01 3.0000e+00
++3.1800e-01 +8.2200e-01 3.0000e+00
++3.2200e-01 +8.2200e-01 3.0000e+00
++3.3800e-01 +8.1800e-01 3.0000e+00
++3.4200e-01 +8.1800e-01 3.0000e+00
++3.3800e-01 +8.2200e-01 3.0000e+00
++3.4200e-01 +8.2200e-01 3.0000e+00
++3.5800e-01 +8.1800e-01 3.0000e+00
++3.6200e-01 +8.1800e-01 3.0000e+00
++3.5800e-01 +8.2200e-01 3.0000e+00
++3.6200e-01 +8.2200e-01 3.0000e+00
++3.7800e-01 +8.1800e-01 3.0000e+00
++3.8200e-01 +8.1800e-01 3.0000e+00
++3.7800e-01 +8.2200e-01 3.0000e+00
++3.8200e-01 +8.2200e-01 3.0000e+00
++3.9800e-01 +8.1800e-01 3.0000e+00
++4.0200e-01 +8.1800e-01 3.0000e+00
++3.9800e-01 +8.2200e-01 3.0000e+00
++4.0200e-01 +8.2200e-01 3.0000e+00
++4.1800e-01 +8.1800e-01 3.0000e+00
++4.2200e-01 +8.1800e-01 3.0000e+00
++4.1800e-01 +8.2200e-01 3.0000e+00
++4.2200e-01 +8.2200e-01 3.0000e+00
++4.3800e-01 +8.1800e-01 3.0000e+00
++4.4200e-01 +8.1800e-01 3.0000e+00
++4.3800e-01 +8.2200e-01 3.0000e+00
++4.4200e-01 +8.2200e-01 3.0000e+00
++4.5800e-01 +8.1800e-01 3.0000e+00
++4.6200e-01 +8.1800e-01 3.0000e+00
++4.5800e-01 +8.2200e-01 3.0000e+00
++4.6200e-01 +8.2200e-01 3.0000e+00
++4.7800e-01 +8.1800e-01 3.0000e+00
++4.8200e-01 +8.1800e-01 3.0000e+00
++4.7800e-01 +8.2200e-01 3.0000e+00
++4.8200e-01 +8.2200e-01 3.0000e+00
++4.9800e-01 +8.1800e-01 3.0000e+00
++5.0200e-01 +8.1800e-01 3.0000e+00
++4.9800e-01 +8.2200e-01 3.0000e+00
++5.0200e-01 +8.2200e-01 3.0000e+00
++5.1800e-01 +8.1800e-01 3.0000e+00
++5.2200e-01 +8.1800e-01 3.0000e+00
++5.1800e-01 +8.2200e-01 3.0000e+00
++5.2200e-01 +8.2200e-01 3.0000e+00
++5.3800e-01 +8.1800e-01 3.0000e+00
++5.4200e-01 +8.1800e-01 3.0000e+00
++5.3800e-01 +8.2200e-01 3.0000e+00
++5.4200e-01 +8.2200e-01 3.0000e+00
++5.5800e-01 +8.1800e-01 3.0000e+00
++5.6200e-01 +8.1800e-01 3.0000e+00
++5.5800e-01 +8.2200e-01 3.0000e+00
++5.6200e-01 +8.2200e-01 3.0000e+00
++5.7800e-01 +8.1800e-01 3.0000e+00
++5.8200e-01 +8.1800e-01 3.0000e+00
++5.7800e-01 +8.2200e-01 3.0000e+00
++5.8200e-01 +8.2200e-01 3.0000e+00
++5.9800e-01 +8.1800e-01 3.0000e+00
++6.0200e-01 +8.1800e-01 3.0000e+00
++5.9800e-01 +8.2200e-01 3.0000e+00
++6.0200e-01 +8.2200e-01 3.0000e+00
++6.1800e-01 +8.1800e-01 3.0000e+00
++6.2200e-01 +8.1800e-01 3.0000e+00
++6.1800e-01 +8.2200e-01 3.0000e+00
++6.2200e-01 +8.2200e-01 3.0000e+00
++6.3800e-01 +8.1800e-01 3.0000e+00
++6.4200e-01 +8.1800e-01 3.0000e+00
++6.3800e-01 +8.2200e-01 3.0000e+00
++6.4200e-01 +8.2200e-01 3.0000e+00
++6.5800e-01 +8.1800e-01 3.0000e+00
++6.6200e-01 +8.1800e-01 3.0000e+00
++6.5800e-01 +8.2200e-01 3.0000e+00
++6.6200e-01 +8.2200e-01 3.0000e+00
++6.7800e-01 +8.1800e-01 3.0000e+00
++6.8200e-01 +8.1800e-01 3.0000e+00
++6.7800e-01 +8.2200e-01 3.0000e+00
++6.8200e-01 +8.2200e-01 3.0000e+00
++6.9800e-01 +8.1800e-01 3.0000e+00
++7.0200e-01 +8.1800e-01 3.0000e+00
++6.9800e-01 +8.2200e-01 3.0000e+00
++7.0200e-01 +8.2200e-01 3.0000e+00
++7.1800e-01 +8.1800e-01 3.0000e+00
++7.2200e-01 +8.1800e-01 3.0000e+00
++7.1800e-01 +8.2200e-01 3.0000e+00
++7.2200e-01 +8.2200e-01 3.0000e+00
++7.3800e-01 +8.1800e-01 3.0000e+00
++7.4200e-01 +8.1800e-01 3.0000e+00
++7.3800e-01 +8.2200e-01 3.0000e+00
++7.4200e-01 +8.2200e-01 3.0000e+00
++7.5800e-01 +8.1800e-01 3.0000e+00
++7.6200e-01 +8.1800e-01 3.0000e+00
++7.5800e-01 +8.2200e-01 3.0000e+00
++7.6200e-01 +8.2200e-01 3.0000e+00
++7.7800e-01 +8.1800e-01 3.0000e+00
++7.8200e-01 +8.1800e-01 3.0000e+00
++7.7800e-01 +8.2200e-01 3.0000e+00
++7.8200e-01 +8.2200e-01 3.0000e+00
++7.9800e-01 +8.1800e-01 3.0000e+00
++8.0200e-01 +8.1800e-01 3.0000e+00
++7.9800e-01 +8.2200e-01 3.0000e+00
++8.0200e-01 +8.2200e-01 3.0000e+00
++8.1800e-01 +8.1800e-01 3.0000e+00
++8.2200e-01 +8.1800e-01 3.0000e+00
++8.1800e-01 +8.2200e-01 3.0000e+00
++8.2200e-01 +8.2200e-01 3.0000e+00
++8.3800e-01 +8.1800e-01 3.0000e+00
++8.4200e-01 +8.1800e-01 3.0000e+00
++8.3800e-01 +8.2200e-01 3.0000e+00
++8.4200e-01 +8.2200e-01 3.0000e+00
++8.5800e-01 +8.1800e-01 3.0000e+00
++8.6200e-01 +8.1800e-01 3.0000e+00
++8.5800e-01 +8.2200e-01 3.0000e+00
++8.6200e-01 +8.2200e-01 3.0000e+00
++8.7800e-01 +8.1800e-01 3.0000e+00
++8.8200e-01 +8.1800e-01 3.0000e+00
++8.7800e-01 +8.2200e-01 3.0000e+00
++8.8200e-01 +8.2200e-01 3.0000e+00
++8.9800e-01 +8.1800e-01 3.0000e+00
++9.0200e-01 +8.1800e-01 3.0000e+00
++8.9800e-01 +8.2200e-01 3.0000e+00
++9.0200e-01 +8.2200e-01 3.0000e+00
++9.1800e-01 +8.1800e-01 3.0000e+00
++9.2200e-01 +8.1800e-01 3.0000e+00
++9.1800e-01 +8.2200e-01 3.0000e+00
++9.2200e-01 +8.2200e-01 3.0000e+00
++9.3800e-01 +8.1800e-01 3.0000e+00
++9.4200e-01 +8.1800e-01 3.0000e+00
++9.3800e-01 +8.2200e-01 3.0000e+00
++9.4200e-01 +8.2200e-01 3.0000e+00
++9.5800e-01 +8.1800e-01 3.0000e+00
++9.6200e-01 +8.1800e-01 3.0000e+00
++9.5800e-01 +8.2200e-01 3.0000e+00
++9.6200e-01 +8.2200e-01 3.0000e+00
++9.7800e-01 +8.1800e-01 3.0000e+00
++9.8200e-01 +8.1800e-01 3.0000e+00
++9.7800e-01 +8.2200e-01 3.0000e+00
++9.8200e-01 +8.2200e-01 3.0000e+00
++9.9800e-01 +8.1800e-01 3.0000e+00
++1.0020e+00 +8.1800e-01 3.0000e+00
++9.9800e-01 +8.2200e-01 3.0000e+00
++1.0020e+00 +8.2200e-01 3.0000e+00
++1.8000e-02 +8.3800e-01 3.0000e+00
++2.2000e-02 +8.3800e-01 3.0000e+00
++1.8000e-02 +8.4200e-01 3.0000e+00
++2.2000e-02 +8.4200e-01 3.0000e+00
++3.8000e-02 +8.3800e-01 3.0000e+00
++4.2000e-02 +8.3800e-01 3.0000e+00
++3.8000e-02 +8.4200e-01 3.0000e+00
++4.2000e-02 +8.4200e-01 3.0000e+00
++5.8000e-02 +8.3800e-01 3.0000e+00
++6.2000e-02 +8.3800e-01 3.0000e+00
++5.8000e-02 +8.4200e-01 3.0000e+00
++6.2000e-02 +8.4200e-01 3.0000e+00
++7.8000e-02 +8.3800e-01 3.0000e+00
++8.2000e-02 +8.3800e-01 3.0000e+00
++7.8000e-02 +8.4200e-01 3.0000e+00
++8.2000e-02 +8.4200e-01 3.0000e+00
++9.8000e-02 +8.3800e-01 3.0000e+00
++1.0200e-01 +8.3800e-01 3.0000e+00
++9.8000e-02 +8.4200e-01 3.0000e+00
++1.0200e-01 +8.4200e-01 3.0000e+00
++1.1800e-01 +8.3800e-01 3.0000e+00
++1.2200e-01 +8.3800e-01 3.0000e+00
++1.1800e-01 +8.4200e-01 3.0000e+00
++1.2200e-01 +8.4200e-01 3.0000e+00
++1.3800e-01 +8.3800e-01 3.0000e+00
++1.4200e-01 +8.3800e-01 3.0000e+00
++1.3800e-01 +8.4200e-01 3.0000e+00
++1.4200e-01 +8.4200e-01 3.0000e+00
++1.5800e-01 +8.3800e-01 3.0000e+00
++1.6200e-01 +8.3800e-01 3.0000e+00
++1.5800e-01 +8.4200e-01 3.0000e+00
++1.6200e-01 +8.4200e-01 3.0000e+00
++1.7800e-01 +8.3800e-01 3.0000e+00
++1.8200e-01 +8.3800e-01 3.0000e+00
++1.7800e-01 +8.4200e-01 3.0000e+00
++1.8200e-01 +8.4200e-01 3.0000e+00
++1.9800e-01 +8.3800e-01 3.0000e+00
++2.0200e-01 +8.3800e-01 3.0000e+00
++1.9800e-01 +8.4200e-01 3.0000e+00
++2.0200e-01 +8.4200e-01 3.0000e+00
++2.1800e-01 +8.3800e-01 3.0000e+00
++2.2200e-01 +8.3800e-01 3.0000e+00
++2.1800e-01 +8.4200e-01 3.0000e+00
++2.2200e-01 +8.4200e-01 3.0000e+00
++2.3800e-01 +8.3800e-01 3.0000e+00
++2.4200e-01 +8.3800e-01 3.0000e+00
++2.3800e-01 +8.4200e-01 3.0000e+00
++2.4200e-01 +8.4200e-01 3.0000e+00
++2.5800e-01 +8.3800e-01 3.0000e+00
++2.6200e-01 +8.3800e-01 3.0000e+00
++2.5800e-01 +8.4200e-01 3.0000e+00
++2.6200e-01 +8.4200e-01 3.0000e+00
++2.7800e-01 +8.3800e-01 3.0000e+00
++2.8200e-01 +8.3800e-01 3.0000e+00
++2.7800e-01 +8.4200e-01 3.0000e+00
++2.8200e-01 +8.4200e-01 3.0000e+00
++2.9800e-01 +8.3800e-01 3.0000e+00
++3.0200e-01 +8.3800e-01 3.0000e+00
++2.9800e-01 +8.4200e-01 3.0000e+00
++3.0200e-01 +8.4200e-01 3.0000e+00
++3.1800e-01 +8.3800e-01 3.0000e+00
++3.2200e-01 +8.3800e-01 3.0000e+00
++3.1800e-01 +8.4200e-01 3.0000e+00
++3.2200e-01 +8.4200e-01 3.0000e+00
++3.3800e-01 +8.3800e-01 3.0000e+00
++3.4200e-01 +8.3800e-01 3.0000e+00
++3.3800e-01 +8.4200e-01 3.0000e+00
++3.4200e-01 +8.4200e-01 3.0000e+00
++3.5800e-01 +8.3800e-01 3.0000e+00
++3.6200e-01 +8.3800e-01 3.0000e+00
++3.5800e-01 +8.4200e-01 3.0000e+00
++3.6200e-01 +8.4200e-01 3.0000e+00
++3.7800e-01 +8.3800e-01 3.0000e+00
++3.8200e-01 +8.3800e-01 3.0000e+00
++3.7800e-01 +8.4200e-01 3.0000e+00
++3.8200e-01 +8.4200e-01 3.0000e+00
++3.9800e-01 +8.3800e-01 3.0000e+00
++4.0200e-01 +8.3800e-01 3.0000e+00
++3.9800e-01 +8.4200e-01 3.0000e+00
++4.0200e-01 +8.4200e-01 3.0000e+00
++4.1800e-01 +8.3800e-01 3.0000e+00
++4.2200e-01 +8.3800e-01 3.0000e+00
++4.1800e-01 +8.4200e-01 3.0000e+00
++4.2200e-01 +8.4200e-01 3.0000e+00
++4.3800e-01 +8.3800e-01 3.0000e+00
++4.4200e-01 +8.3800e-01 3.0000e+00
++4.3800e-01 +8.4200e-01 3.0000e+00
++4.4200e-01 +8.4200e-01 3.0000e+00
++4.5800e-01 +8.3800e-01 3.0000e+00
++4.6200e-01 +8.3800e-01 3.0000e+00
++4.5800e-01 +8.4200e-01 3.0000e+00
++4.6200e-01 +8.4200e-01 3.0000e+00
++4.7800e-01 +8.3800e-01 3.0000e+00
++4.8200e-01 +8.3800e-01 3.0000e+00
++4.7800e-01 +8.4200e-01 3.0000e+00
++4.8200e-01 +8.4200e-01 3.0000e+00
++4.9800e-01 +8.3800e-01 3.0000e+00
++5.0200e-01 +8.3800e-01 3.0000e+00
++4.9800e-01 +8.4200e-01 3.0000e+00
++5.0200e-01 +8.4200e-01 3.0000e+00
++5.1800e-01 +8.3800e-01 3.0000e+00
++5.2200e-01 +8.3800e-01 3.0000e+00
++5.1800e-01 +8.4200e-01 3.0000e+00
++5.2200e-01 +8.4200e-01 3.0000e+00
++5.3800e-01 +8.3800e-01 3.0000e+00
++5.4200e-01 +8.3800e-01 3.0000e+00
++5.3800e-01 +8.4200e-01 3.0000e+00
++5.4200e-01 +8.4200e-01 3.0000e+00
++5.5800e-01 +8.3800e-01 3.0000e+00
++5.6200e-01 +8.3800e-01 3.0000e+00
++5.5800e-01 +8.4200e-01 3.0000e+00
++5.6200e-01 +8.4200e-01 3.0000e+00
++5.7800e-01 +8.3800e-01 3.0000e+00
++5.8200e-01 +8.3800e-01 3.0000e+00
++5.7800e-01 +8.4200e-01 3.0000e+00
++5.8200e-01 +8.4200e-01 3.0000e+00
++5.9800e-01 +8.3800e-01 3.0000e+00
++6.0200e-01 +8.3800e-01 3.0000e+00
++5.9800e-01 +8.4200e-01 3.0000e+00
++6.0200e-01 +8.4200e-01 3.0000e+00
++6.1800e-01 +8.3800e-01 3.0000e+00
++6.2200e-01 +8.3800e-01 3.0000e+00
++6.1800e-01 +8.4200e-01 3.0000e+00
++6.2200e-01 +8.4200e-01 3.0000e+00
++6.3800e-01 +8.3800e-01 3.0000e+00
++6.4200e-01 +8.3800e-01 3.0000e+00
++6.3800e-01 +8.4200e-01 3.0000e+00
++6.4200e-01 +8.4200e-01 3.0000e+00
++6.5800e-01 +8.3800e-01 3.0000e+00
++6.6200e-01 +8.3800e-01 3.0000e+00
++6.5800e-01 +8.4200e-01 3.0000e+00
++6.6200e-01 +8.4200e-01 3.0000e+00
++6.7800e-01 +8.3800e-01 3.0000e+00
++6.8200e-01 +8.3800e-01 3.0000e+00
++6.7800e-01 +8.4200e-01 3.0000e+00
++6.8200e-01 +8.4200e-01 3.0000e+00
++6.9800e-01 +8.3800e-01 3.0000e+00
++7.0200e-01 +8.3800e-01 3.0000e+00
++6.9800e-01 +8.4200e-01 3.0000e+00
++7.0200e-01 +8.4200e-01 3.0000e+00
++7.1800e-01 +8.3800e-01 3.0000e+00
++7.2200e-01 +8.3800e-01 3.0000e+00
++7.1800e-01 +8.4200e-01 3.0000e+00
++7.2200e-01 +8.4200e-01 3.0000e+00
++7.3800e-01 +8.3800e-01 3.0000e+00
++7.4200e-01 +8.3800e-01 3.0000e+00
++7.3800e-01 +8.4200e-01 3.0000e+00
++7.4200e-01 +8.4200e-01 3.0000e+00
++7.5800e-01 +8.3800e-01 3.0000e+00
++7.6200e-01 +8.3800e-01 3.0000e+00
++7.5800e-01 +8.4200e-01 3.0000e+00
++7.6200e-01 +8.4200e-01 3.0000e+00
++7.7800e-01 +8.3800e-01 3.0000e+00
++7.8200e-01 +8.3800e-01 3.0000e+00
++7.7800e-01 +8.4200e-01 3.0000e+00
++7.8200e-01 +8.4200e-01 3.0000e+00
++7.9800e-01 +8.3800e-01 3.0000e+00
++8.0200e-01 +8.3800e-01 3.0000e+00
++7.9800e-01 +8.4200e-01 3.0000e+00
++8.0200e-01 +8.4200e-01 3.0000e+00
++8.1800e-01 +8.3800e-01 3.0000e+00
++8.2200e-01 +8.3800e-01 3.0000e+00
++8.1800e-01 +8.4200e-01 3.0000e+00
++8.2200e-01 +8.4200e-01 3.0000e+00
++8.3800e-01 +8.3800e-01 3.0000e+00
++8.4200e-01 +8.3800e-01 3.0000e+00
++8.3800e-01 +8.4200e-01 3.0000e+00
++8.4200e-01 +8.4200e-01 3.0000e+00
++8.5800e-01 +8.3800e-01 3.0000e+00
++8.6200e-01 +8.3800e-01 3.0000e+00
++8.5800e-01 +8.4200e-01 3.0000e+00
++8.6200e-01 +8.4200e-01 3.0000e+00
++8.7800e-01 +8.3800e-01 3.0000e+00
++8.8200e-01 +8.3800e-01 3.0000e+00
++8.7800e-01 +8.4200e-01 3.0000e+00
++8.8200e-01 +8.4200e-01 3.0000e+00
++8.9800e-01 +8.3800e-01 3.0000e+00
++9.0200e-01 +8.3800e-01 3.0000e+00
++8.9800e-01 +8.4200e-01 3.0000e+00
++9.0200e-01 +8.4200e-01 3.0000e+00
++9.1800e-01 +8.3800e-01 3.0000e+00
++9.2200e-01 +8.3800e-01 3.0000e+00
++9.1800e-01 +8.4200e-01 3.0000e+00
++9.2200e-01 +8.4200e-01 3.0000e+00
++9.3800e-01 +8.3800e-01 3.0000e+00
++9.4200e-01 +8.3800e-01 3.0000e+00
++9.3800e-01 +8.4200e-01 3.0000e+00
++9.4200e-01 +8.4200e-01 3.0000e+00
++9.5800e-01 +8.3800e-01 3.0000e+00
++9.6200e-01 +8.3800e-01 3.0000e+00
++9.5800e-01 +8.4200e-01 3.0000e+00
++9.6200e-01 +8.4200e-01 3.0000e+00
++9.7800e-01 +8.3800e-01 3.0000e+00
++9.8200e-01 +8.3800e-01 3.0000e+00
++9.7800e-01 +8.4200e-01 3.0000e+00
++9.8200e-01 +8.4200e-01 3.0000e+00
++9.9800e-01 +8.3800e-01 3.0000e+00
++1.0020e+00 +8.3800e-01 3.0000e+00
++9.9800e-01 +8.4200e-01 3.0000e+00
++1.0020e+00 +8.4200e-01 3.0000e+00
++1.8000e-02 +8.5800e-01 3.0000e+00
++2.2000e-02 +8.5800e-01 3.0000e+00
++1.8000e-02 +8.6200e-01 3.0000e+00
++2.2000e-02 +8.6200e-01 3.0000e+00
++3.8000e-02 +8.5800e-01 3.0000e+00
++4.2000e-02 +8.5800e-01 3.0000e+00
++3.8000e-02 +8.6200e-01 3.0000e+00
++4.2000e-02 +8.6200e-01 3.0000e+00
++5.8000e-02 +8.5800e-01 3.0000e+00
++6.2000e-02 +8.5800e-01 3.0000e+00
++5.8000e-02 +8.6200e-01 3.0000e+00
++6.2000e-02 +8.6200e-01 3.0000e+00
++7.8000e-02 +8.5800e-01 3.0000e+00
++8.2000e-02 +8.5800e-01 3.0000e+00
++7.8000e-02 +8.6200e-01 3.0000e+00
++8.2000e-02 +8.6200e-01 3.0000e+00
++9.8000e-02 +8.5800e-01 3.0000e+00
++1.0200e-01 +8.5800e-01 3.0000e+00
++9.8000e-02 +8.6200e-01 3.0000e+00
++1.0200e-01 +8.6200e-01 3.0000e+00
++1.1800e-01 +8.5800e-01 3.0000e+00
++1.2200e-01 +8.5800e-01 3.0000e+00
++1.1800e-01 +8.6200e-01 3.0000e+00
++1.2200e-01 +8.6200e-01 3.0000e+00
++1.3800e-01 +8.5800e-01 3.0000e+00
++1.4200e-01 +8.5800e-01 3.0000e+00
++1.3800e-01 +8.6200e-01 3.0000e+00
++1.4200e-01 +8.6200e-01 3.0000e+00
++1.5800e-01 +8.5800e-01 3.0000e+00
++1.6200e-01 +8.5800e-01 3.0000e+00
++1.5800e-01 +8.6200e-01 3.0000e+00
++1.6200e-01 +8.6200e-01 3.0000e+00
++1.7800e-01 +8.5800e-01 3.0000e+00
++1.8200e-01 +8.5800e-01 3.0000e+00
++1.7800e-01 +8.6200e-01 3.0000e+00
++1.8200e-01 +8.6200e-01 3.0000e+00
++1.9800e-01 +8.5800e-01 3.0000e+00
++2.0200e-01 +8.5800e-01 3.0000e+00
++1.9800e-01 +8.6200e-01 3.0000e+00
++2.0200e-01 +8.6200e-01 3.0000e+00
++2.1800e-01 +8.5800e-01 3.0000e+00
++2.2200e-01 +8.5800e-01 3.0000e+00
++2.1800e-01 +8.6200e-01 3.0000e+00
++2.2200e-01 +8.6200e-01 3.0000e+00
++2.3800e-01 +8.5800e-01 3.0000e+00
++2.4200e-01 +8.5800e-01 3.0000e+00
++2.3800e-01 +8.6200e-01 3.0000e+00
++2.4200e-01 +8.6200e-01 3.0000e+00
++2.5800e-01 +8.5800e-01 3.0000e+00
++2.6200e-01 +8.5800e-01 3.0000e+00
++2.5800e-01 +8.6200e-01 3.0000e+00
++2.6200e-01 +8.6200e-01 3.0000e+00
++2.7800e-01 +8.5800e-01 3.0000e+00
++2.8200e-01 +8.5800e-01 3.0000e+00
++2.7800e-01 +8.6200e-01 3.0000e+00
++2.8200e-01 +8.6200e-01 3.0000e+00
++2.9800e-01 +8.5800e-01 3.0000e+00
++3.0200e-01 +8.5800e-01 3.0000e+00
++2.9800e-01 +8.6200e-01 3.0000e+00
++3.0200e-01 +8.6200e-01 3.0000e+00
++3.1800e-01 +8.5800e-01 3.0000e+00
++3.2200e-01 +8.5800e-01 3.0000e+00
++3.1800e-01 +8.6200e-01 3.0000e+00
++3.2200e-01 +8.6200e-01 3.0000e+00
++3.3800e-01 +8.5800e-01 3.0000e+00
++3.4200e-01 +8.5800e-01 3.0000e+00
++3.3800e-01 +8.6200e-01 3.0000e+00
++3.4200e-01 +8.6200e-01 3.0000e+00
++3.5800e-01 +8.5800e-01 3.0000e+00
++3.6200e-01 +8.5800e-01 3.0000e+00
++3.5800e-01 +8.6200e-01 3.0000e+00
++3.6200e-01 +8.6200e-01 3.0000e+00
++3.7800e-01 +8.5800e-01 3.0000e+00
++3.8200e-01 +8.5800e-01 3.0000e+00
++3.7800e-01 +8.6200e-01 3.0000e+00
++3.8200e-01 +8.6200e-01 3.0000e+00
++3.9800e-01 +8.5800e-01 3.0000e+00
++4.0200e-01 +8.5800e-01 3.0000e+00
++3.9800e-01 +8.6200e-01 3.0000e+00
++4.0200e-01 +8.6200e-01 3.0000e+00
++4.1800e-01 +8.5800e-01 3.0000e+00
++4.2200e-01 +8.5800e-01 3.0000e+00
++4.1800e-01 +8.6200e-01 3.0000e+00
++4.2200e-01 +8.6200e-01 3.0000e+00
++4.3800e-01 +8.5800e-01 3.0000e+00
++4.4200e-01 +8.5800e-01 3.0000e+00
++4.3800e-01 +8.6200e-01 3.0000e+00
++4.4200e-01 +8.6200e-01 3.0000e+00
++4.5800e-01 +8.5800e-01 3.0000e+00
++4.6200e-01 +8.5800e-01 3.0000e+00
++4.5800e-01 +8.6200e-01 3.0000e+00
++4.6200e-01 +8.6200e-01 3.0000e+00
++4.7800e-01 +8.5800e-01 3.0000e+00
++4.8200e-01 +8.5800e-01 3.0000e+00
++4.7800e-01 +8.6200e-01 3.0000e+00
++4.8200e-01 +8.6200e-01 3.0000e+00
++4.9800e-01 +8.5800e-01 3.0000e+00
++5.0200e-01 +8.5800e-01 3.0000e+00
++4.9800e-01 +8.6200e-01 3.0000e+00
++5.0200e-01 +8.6200e-01 3.0000e+00
++5.1800e-01 +8.5800e-01 3.0000e+00
++5.2200e-01 +8.5800e-01 3.0000e+00
++5.1800e-01 +8.6200e-01 3.0000e+00
++5.2200e-01 +8.6200e-01 3.0000e+00
++5.3800e-01 +8.5800e-01 3.0000e+00
++5.4200e-01 +8.5800e-01 3.0000e+00
++5.3800e-01 +8.6200e-01 3.0000e+00
++5.4200e-01 +8.6200e-01 3.0000e+00
++5.5800e-01 +8.5800e-01 3.0000e+00
++5.6200e-01 +8.5800e-01 3.0000e+00
++5.5800e-01 +8.6200e-01 3.0000e+00
++5.6200e-01 +8.6200e-01 3.0000e+00
++5.7800e-01 +8.5800e-01 3.0000e+00
++5.8200e-01 +8.5800e-01 3.0000e+00
++5.7800e-01 +8.6200e-01 3.0000e+00
++5.8200e-01 +8.6200e-01 3.0000e+00
++5.9800e-01 +8.5800e-01 3.0000e+00
++6.0200e-01 +8.5800e-01 3.0000e+00
++5.9800e-01 +8.6200e-01 3.0000e+00
++6.0200e-01 +8.6200e-01 3.0000e+00
++6.1800e-01 +8.5800e-01 3.0000e+00
++6.2200e-01 +8.5800e-01 3.0000e+00
++6.1800e-01 +8.6200e-01 3.0000e+00
++6.2200e-01 +8.6200e-01 3.0000e+00
++6.3800e-01 +8.5800e-01 3.0000e+00
++6.4200e-01 +8.5800e-01 3.0000e+00
++6.3800e-01 +8.6200e-01 3.0000e+00
++6.4200e-01 +8.6200e-01 3.0000e+00
++6.5800e-01 +8.5800e-01 3.0000e+00
++6.6200e-01 +8.5800e-01 3.0000e+00
++6.5800e-01 +8.6200e-01 3.0000e+00
++6.6200e-01 +8.6200e-01 3.0000e+00
++6.7800e-01 +8.5800e-01 3.0000e+00
++6.8200e-01 +8.5800e-01 3.0000e+00
++6.7800e-01 +8.6200e-01 3.0000e+00
++6.8200e-01 +8.6200e-01 3.0000e+00
++6.9800e-01 +8.5800e-01 3.0000e+00
++7.0200e-01 +8.5800e-01 3.0000e+00
++6.9800e-01 +8.6200e-01 3.0000e+00
++7.0200e-01 +8.6200e-01 3.0000e+00
++7.1800e-01 +8.5800e-01 3.0000e+00
++7.2200e-01 +8.5800e-01 3.0000e+00
++7.1800e-01 +8.6200e-01 3.0000e+00
++7.2200e-01 +8.6200e-01 3.0000e+00
++7.3800e-01 +8.5800e-01 3.0000e+00
++7.4200e-01 +8.5800e-01 3.0000e+00
++7.3800e-01 +8.6200e-01 3.0000e+00
++7.4200e-01 +8.6200e-01 3.0000e+00
++7.5800e-01 +8.5800e-01 3.0000e+00
++7.6200e-01 +8.5800e-01 3.0000e+00
++7.5800e-01 +8.6200e-01 3.0000e+00
++7.6200e-01 +8.6200e-01 3.0000e+00
++7.7800e-01 +8.5800e-01 3.0000e+00
++7.8200e-01 +8.5800e-01 3.0000e+00
++7.7800e-01 +8.6200e-01 3.0000e+00
++7.8200e-01 +8.6200e-01 3.0000e+00
++7.9800e-01 +8.5800e-01 3.0000e+00
++8.0200e-01 +8.5800e-01 3.0000e+00
++7.9800e-01 +8.6200e-01 3.0000e+00
++8.0200e-01 +8.6200e-01 3.0000e+00
++8.1800e-01 +8.5800e-01 3.0000e+00
++8.2200e-01 +8.5800e-01 3.0000e+00
++8.1800e-01 +8.6200e-01 3.0000e+00
++8.2200e-01 +8.6200e-01 3.0000e+00
++8.3800e-01 +8.5800e-01 3.0000e+00
++8.4200e-01 +8.5800e-01 3.0000e+00
++8.3800e-01 +8.6200e-01 3.0000e+00
++8.4200e-01 +8.6200e-01 3.0000e+00
++8.5800e-01 +8.5800e-01 3.0000e+00
++8.6200e-01 +8.5800e-01 3.0000e+00
++8.5800e-01 +8.6200e-01 3.0000e+00
++8.6200e-01 +8.6200e-01 3.0000e+00
++8.7800e-01 +8.5800e-01 3.0000e+00
++8.8200e-01 +8.5800e-01 3.0000e+00
++8.7800e-01 +8.6200e-01 3.0000e+00
++8.8200e-01 +8.6200e-01 3.0000e+00
++8.9800e-01 +8.5800e-01 3.0000e+00
++9.0200e-01 +8.5800e-01 3.0000e+00
++8.9800e-01 +8.6200e-01 3.0000e+00
++9.0200e-01 +8.6200e-01 3.0000e+00
++9.1800e-01 +8.5800e-01 3.0000e+00
++9.2200e-01 +8.5800e-01 3.0000e+00
++9.1800e-01 +8.6200e-01 3.0000e+00
++9.2200e-01 +8.6200e-01 3.0000e+00
++9.3800e-01 +8.5800e-01 3.0000e+00
++9.4200e-01 +8.5800e-01 3.0000e+00
++9.3800e-01 +8.6200e-01 3.0000e+00
++9.4200e-01 +8.6200e-01 3.0000e+00
++9.5800e-01 +8.5800e-01 3.0000e+00
++9.6200e-01 +8.5800e-01 3.0000e+00
++9.5800e-01 +8.6200e-01 3.0000e+00
++9.6200e-01 +8.6200e-01 3.0000e+00
++9.7800e-01 +8.5800e-01 3.0000e+00
++9.8200e-01 +8.5800e-01 3.0000e+00
++9.7800e-01 +8.6200e-01 3.0000e+00
++9.8200e-01 +8.6200e-01 3.0000e+00
++9.9800e-01 +8.5800e-01 3.0000e+00
++1.0020e+00 +8.5800e-01 3.0000e+00
++9.9800e-01 +8.6200e-01 3.0000e+00
++1.0020e+00 +8.6200e-01 3.0000e+00
++1.8000e-02 +8.7800e-01 3.0000e+00
++2.2000e-02 +8.7800e-01 3.0000e+00
++1.8000e-02 +8.8200e-01 3.0000e+00
++2.2000e-02 +8.8200e-01 3.0000e+00
++3.8000e-02 +8.7800e-01 3.0000e+00
++4.2000e-02 +8.7800e-01 3.0000e+00
++3.8000e-02 +8.8200e-01 3.0000e+00
++4.2000e-02 +8.8200e-01 3.0000e+00
++5.8000e-02 +8.7800e-01 3.0000e+00
++6.2000e-02 +8.7800e-01 3.0000e+00
++5.8000e-02 +8.8200e-01 3.0000e+00
++6.2000e-02 +8.8200e-01 3.0000e+00
++7.8000e-02 +8.7800e-01 3.0000e+00
++8.2000e-02 +8.7800e-01 3.0000e+00
++7.8000e-02 +8.8200e-01 3.0000e+00
++8.2000e-02 +8.8200e-01 3.0000e+00
++9.8000e-02 +8.7800e-01 3.0000e+00
++1.0200e-01 +8.7800e-01 3.0000e+00
++9.8000e-02 +8.8200e-01 3.0000e+00
++1.0200e-01 +8.8200e-01 3.0000e+00
++1.1800e-01 +8.7800e-01 3.0000e+00
++1.2200e-01 +8.7800e-01 3.0000e+00
++1.1800e-01 +8.8200e-01 3.0000e+00
++1.2200e-01 +8.8200e-01 3.0000e+00
++1.3800e-01 +8.7800e-01 3.0000e+00
++1.4200e-01 +8.7800e-01 3.0000e+00
++1.3800e-01 +8.8200e-01 3.0000e+00
++1.4200e-01 +8.8200e-01 3.0000e+00
++1.5800e-01 +8.7800e-01 3.0000e+00
++1.6200e-01 +8.7800e-01 3.0000e+00
++1.5800e-01 +8.8200e-01 3.0000e+00
++1.6200e-01 +8.8200e-01 3.0000e+00
++1.7800e-01 +8.7800e-01 3.0000e+00
++1.8200e-01 +8.7800e-01 3.0000e+00
++1.7800e-01 +8.8200e-01 3.0000e+00
++1.8200e-01 +8.8200e-01 3.0000e+00
++1.9800e-01 +8.7800e-01 3.0000e+00
++2.0200e-01 +8.7800e-01 3.0000e+00
++1.9800e-01 +8.8200e-01 3.0000e+00
++2.0200e-01 +8.8200e-01 3.0000e+00
++2.1800e-01 +8.7800e-01 3.0000e+00
++2.2200e-01 +8.7800e-01 3.0000e+00
++2.1800e-01 +8.8200e-01 3.0000e+00
++2.2200e-01 +8.8200e-01 3.0000e+00
++2.3800e-01 +8.7800e-01 3.0000e+00
++2.4200e-01 +8.7800e-01 3.0000e+00
++2.3800e-01 +8.8200e-01 3.0000e+00
++2.4200e-01 +8.8200e-01 3.0000e+00
++2.5800e-01 +8.7800e-01 3.0000e+00
++2.6200e-01 +8.7800e-01 3.0000e+00
++2.5800e-01 +8.8200e-01 3.0000e+00
++2.6200e-01 +8.8200e-01 3.0000e+00
++2.7800e-01 +8.7800e-01 3.0000e+00
++2.8200e-01 +8.7800e-01 3.0000e+00
++2.7800e-01 +8.8200e-01 3.0000e+00
++2.8200e-01 +8.8200e-01 3.0000e+00
++2.9800e-01 +8.7800e-01 3.0000e+00
++3.0200e-01 +8.7800e-01 3.0000e+00
++2.9800e-01 +8.8200e-01 3.0000e+00
++3.0200e-01 +8.8200e-01 3.0000e+00
++3.1800e-01 +8.7800e-01 3.0000e+00
++3.2200e-01 +8.7800e-01 3.0000e+00
++3.1800e-01 +8.8200e-01 3.0000e+00
++3.2200e-01 +8.8200e-01 3.0000e+00
++3.3800e-01 +8.7800e-01 3.0000e+00
++3.4200e-01 +8.7800e-01 3.0000e+00
++3.3800e-01 +8.8200e-01 3.0000e+00
++3.4200e-01 +8.8200e-01 3.0000e+00
++3.5800e-01 +8.7800e-01 3.0000e+00
++3.6200e-01 +8.7800e-01 3.0000e+00
++3.5800e-01 +8.8200e-01 3.0000e+00
++3.6200e-01 +8.8200e-01 3.0000e+00
++3.7800e-01 +8.7800e-01 3.0000e+00
++3.8200e-01 +8.7800e-01 3.0000e+00
++3.7800e-01 +8.8200e-01 3.0000e+00
++3.8200e-01 +8.8200e-01 3.0000e+00
++3.9800e-01 +8.7800e-01 3.0000e+00
++4.0200e-01 +8.7800e-01 3.0000e+00
++3.9800e-01 +8.8200e-01 3.0000e+00
++4.0200e-01 +8.8200e-01 3.0000e+00
++4.1800e-01 +8.7800e-01 3.0000e+00
++4.2200e-01 +8.7800e-01 3.0000e+00
++4.1800e-01 +8.8200e-01 3.0000e+00
++4.2200e-01 +8.8200e-01 3.0000e+00
++4.3800e-01 +8.7800e-01 3.0000e+00
++4.4200e-01 +8.7800e-01 3.0000e+00
++4.3800e-01 +8.8200e-01 3.0000e+00
++4.4200e-01 +8.8200e-01 3.0000e+00
++4.5800e-01 +8.7800e-01 3.0000e+00
++4.6200e-01 +8.7800e-01 3.0000e+00
++4.5800e-01 +8.8200e-01 3.0000e+00
++4.6200e-01 +8.8200e-01 3.0000e+00
++4.7800e-01 +8.7800e-01 3.0000e+00
++4.8200e-01 +8.7800e-01 3.0000e+00
++4.7800e-01 +8.8200e-01 3.0000e+00
++4.8200e-01 +8.8200e-01 3.0000e+00
++4.9800e-01 +8.7800e-01 3.0000e+00
++5.0200e-01 +8.7800e-01 3.0000e+00
++4.9800e-01 +8.8200e-01 3.0000e+00
++5.0200e-01 +8.8200e-01 3.0000e+00
++5.1800e-01 +8.7800e-01 3.0000e+00
++5.2200e-01 +8.7800e-01 3.0000e+00
++5.1800e-01 +8.8200e-01 3.0000e+00
++5.2200e-01 +8.8200e-01 3.0000e+00
++5.3800e-01 +8.7800e-01 3.0000e+00
++5.4200e-01 +8.7800e-01 3.0000e+00
++5.3800e-01 +8.8200e-01 3.0000e+00
++5.4200e-01 +8.8200e-01 3.0000e+00
++5.5800e-01 +8.7800e-01 3.0000e+00
++5.6200e-01 +8.7800e-01 3.0000e+00
++5.5800e-01 +8.8200e-01 3.0000e+00
++5.6200e-01 +8.8200e-01 3.0000e+00
++5.7800e-01 +8.7800e-01 3.0000e+00
++5.8200e-01 +8.7800e-01 3.0000e+00
++5.7800e-01 +8.8200e-01 3.0000e+00
++5.8200e-01 +8.8200e-01 3.0000e+00
++5.9800e-01 +8.7800e-01 3.0000e+00
++6.0200e-01 +8.7800e-01 3.0000e+00
++5.9800e-01 +8.8200e-01 3.0000e+00
++6.0200e-01 +8.8200e-01 3.0000e+00
++6.1800e-01 +8.7800e-01 3.0000e+00
++6.2200e-01 +8.7800e-01 3.0000e+00
++6.1800e-01 +8.8200e-01 3.0000e+00
++6.2200e-01 +8.8200e-01 3.0000e+00
++6.3800e-01 +8.7800e-01 3.0000e+00
++6.4200e-01 +8.7800e-01 3.0000e+00
++6.3800e-01 +8.8200e-01 3.0000e+00
++6.4200e-01 +8.8200e-01 3.0000e+00
++6.5800e-01 +8.7800e-01 3.0000e+00
++6.6200e-01 +8.7800e-01 3.0000e+00
++6.5800e-01 +8.8200e-01 3.0000e+00
++6.6200e-01 +8.8200e-01 3.0000e+00
++6.7800e-01 +8.7800e-01 3.0000e+00
++6.8200e-01 +8.7800e-01 3.0000e+00
++6.7800e-01 +8.8200e-01 3.0000e+00
++6.8200e-01 +8.8200e-01 3.0000e+00
++6.9800e-01 +8.7800e-01 3.0000e+00
++7.0200e-01 +8.7800e-01 3.0000e+00
++6.9800e-01 +8.8200e-01 3.0000e+00
++7.0200e-01 +8.8200e-01 3.0000e+00
++7.1800e-01 +8.7800e-01 3.0000e+00
++7.2200e-01 +8.7800e-01 3.0000e+00
++7.1800e-01 +8.8200e-01 3.0000e+00
++7.2200e-01 +8.8200e-01 3.0000e+00
++7.3800e-01 +8.7800e-01 3.0000e+00
++7.4200e-01 +8.7800e-01 3.0000e+00
++7.3800e-01 +8.8200e-01 3.0000e+00
++7.4200e-01 +8.8200e-01 3.0000e+00
++7.5800e-01 +8.7800e-01 3.0000e+00
++7.6200e-01 +8.7800e-01 3.0000e+00
++7.5800e-01 +8.8200e-01 3.0000e+00
++7.6200e-01 +8.8200e-01 3.0000e+00
++7.7800e-01 +8.7800e-01 3.0000e+00
++7.8200e-01 +8.7800e-01 3.0000e+00
++7.7800e-01 +8.8200e-01 3.0000e+00
++7.8200e-01 +8.8200e-01 3.0000e+00
++7.9800e-01 +8.7800e-01 3.0000e+00
++8.0200e-01 +8.7800e-01 3.0000e+00
++7.9800e-01 +8.8200e-01 3.0000e+00
++8.0200e-01 +8.8200e-01 3.0000e+00
++8.1800e-01 +8.7800e-01 3.0000e+00
++8.2200e-01 +8.7800e-01 3.0000e+00
++8.1800e-01 +8.8200e-01 3.0000e+00
++8.2200e-01 +8.8200e-01 3.0000e+00
++8.3800e-01 +8.7800e-01 3.0000e+00
++8.4200e-01 +8.7800e-01 3.0000e+00
++8.3800e-01 +8.8200e-01 3.0000e+00
++8.4200e-01 +8.8200e-01 3.0000e+00
++8.5800e-01 +8.7800e-01 3.0000e+00
++8.6200e-01 +8.7800e-01 3.0000e+00
++8.5800e-01 +8.8200e-01 3.0000e+00
++8.6200e-01 +8.8200e-01 3.0000e+00
++8.7800e-01 +8.7800e-01 3.0000e+00
++8.8200e-01 +8.7800e-01 3.0000e+00
++8.7800e-01 +8.8200e-01 3.0000e+00
++8.8200e-01 +8.8200e-01 3.0000e+00
++8.9800e-01 +8.7800e-01 3.0000e+00
++9.0200e-01 +8.7800e-01 3.0000e+00
++8.9800e-01 +8.8200e-01 3.0000e+00
++9.0200e-01 +8.8200e-01 3.0000e+00
++9.1800e-01 +8.7800e-01 3.0000e+00
++9.2200e-01 +8.7800e-01 3.0000e+00
++9.1800e-01 +8.8200e-01 3.0000e+00
++9.2200e-01 +8.8200e-01 3.0000e+00
++9.3800e-01 +8.7800e-01 3.0000e+00
++9.4200e-01 +8.7800e-01 3.0000e+00
++9.3800e-01 +8.8200e-01 3.0000e+00
++9.4200e-01 +8.8200e-01 3.0000e+00
++9.5800e-01 +8.7800e-01 3.0000e+00
++9.6200e-01 +8.7800e-01 3.0000e+00
++9.5800e-01 +8.8200e-01 3.0000e+00
++9.6200e-01 +8.8200e-01 3.0000e+00
++9.7800e-01 +8.7800e-01 3.0000e+00
++9.8200e-01 +8.7800e-01 3.0000e+00
++9.7800e-01 +8.8200e-01 3.0000e+00
++9.8200e-01 +8.8200e-01 3.0000e+00
++9.9800e-01 +8.7800e-01 3.0000e+00
++1.0020e+00 +8.7800e-01 3.0000e+00
++9.9800e-01 +8.8200e-01 3.0000e+00
++1.0020e+00 +8.8200e-01 3.0000e+00
++1.8000e-02 +8.9800e-01 3.0000e+00
++2.2000e-02 +8.9800e-01 3.0000e+00
++1.8000e-02 +9.0200e-01 3.0000e+00
++2.2000e-02 +9.0200e-01 3.0000e+00
++3.8000e-02 +8.9800e-01 3.0000e+00
++4.2000e-02 +8.9800e-01 3.0000e+00
++3.8000e-02 +9.0200e-01 3.0000e+00
++4.2000e-02 +9.0200e-01 3.0000e+00
++5.8000e-02 +8.9800e-01 3.0000e+00
++6.2000e-02 +8.9800e-01 3.0000e+00
++5.8000e-02 +9.0200e-01 3.0000e+00
++6.2000e-02 +9.0200e-01 3.0000e+00
++7.8000e-02 +8.9800e-01 3.0000e+00
++8.2000e-02 +8.9800e-01 3.0000e+00
++7.8000e-02 +9.0200e-01 3.0000e+00
++8.2000e-02 +9.0200e-01 3.0000e+00
++9.8000e-02 +8.9800e-01 3.0000e+00
++1.0200e-01 +8.9800e-01 3.0000e+00
++9.8000e-02 +9.0200e-01 3.0000e+00
++1.0200e-01 +9.0200e-01 3.0000e+00
++1.1800e-01 +8.9800e-01 3.0000e+00
++1.2200e-01 +8.9800e-01 3.0000e+00
++1.1800e-01 +9.0200e-01 3.0000e+00
++1.2200e-01 +9.0200e-01 3.0000e+00
++1.3800e-01 +8.9800e-01 3.0000e+00
++1.4200e-01 +8.9800e-01 3.0000e+00
++1.3800e-01 +9.0200e-01 3.0000e+00
++1.4200e-01 +9.0200e-01 3.0000e+00
++1.5800e-01 +8.9800e-01 3.0000e+00
++1.6200e-01 +8.9800e-01 3.0000e+00
++1.5800e-01 +9.0200e-01 3.0000e+00
++1.6200e-01 +9.0200e-01 3.0000e+00
++1.7800e-01 +8.9800e-01 3.0000e+00
++1.8200e-01 +8.9800e-01 3.0000e+00
++1.7800e-01 +9.0200e-01 3.0000e+00
++1.8200e-01 +9.0200e-01 3.0000e+00
++1.9800e-01 +8.9800e-01 3.0000e+00
++2.0200e-01 +8.9800e-01 3.0000e+00
++1.9800e-01 +9.0200e-01 3.0000e+00
++2.0200e-01 +9.0200e-01 3.0000e+00
++2.1800e-01 +8.9800e-01 3.0000e+00
++2.2200e-01 +8.9800e-01 3.0000e+00
++2.1800e-01 +9.0200e-01 3.0000e+00
++2.2200e-01 +9.0200e-01 3.0000e+00
++2.3800e-01 +8.9800e-01 3.0000e+00
++2.4200e-01 +8.9800e-01 3.0000e+00
++2.3800e-01 +9.0200e-01 3.0000e+00
++2.4200e-01 +9.0200e-01 3.0000e+00
++2.5800e-01 +8.9800e-01 3.0000e+00
++2.6200e-01 +8.9800e-01 3.0000e+00
++2.5800e-01 +9.0200e-01 3.0000e+00
++2.6200e-01 +9.0200e-01 3.0000e+00
++2.7800e-01 +8.9800e-01 3.0000e+00
++2.8200e-01 +8.9800e-01 3.0000e+00
++2.7800e-01 +9.0200e-01 3.0000e+00
++2.8200e-01 +9.0200e-01 3.0000e+00
++2.9800e-01 +8.9800e-01 3.0000e+00
++3.0200e-01 +8.9800e-01 3.0000e+00
++2.9800e-01 +9.0200e-01 3.0000e+00
++3.0200e-01 +9.0200e-01 3.0000e+00
++3.1800e-01 +8.9800e-01 3.0000e+00
++3.2200e-01 +8.9800e-01 3.0000e+00
++3.1800e-01 +9.0200e-01 3.0000e+00
++3.2200e-01 +9.0200e-01 3.0000e+00
++3.3800e-01 +8.9800e-01 3.0000e+00
++3.4200e-01 +8.9800e-01 3.0000e+00
++3.3800e-01 +9.0200e-01 3.0000e+00
++3.4200e-01 +9.0200e-01 3.0000e+00
++3.5800e-01 +8.9800e-01 3.0000e+00
++3.6200e-01 +8.9800e-01 3.0000e+00
++3.5800e-01 +9.0200e-01 3.0000e+00
++3.6200e-01 +9.0200e-01 3.0000e+00
++3.7800e-01 +8.9800e-01 3.0000e+00
++3.8200e-01 +8.9800e-01 3.0000e+00
++3.7800e-01 +9.0200e-01 3.0000e+00
++3.8200e-01 +9.0200e-01 3.0000e+00
++3.9800e-01 +8.9800e-01 3.0000e+00
++4.0200e-01 +8.9800e-01 3.0000e+00
++3.9800e-01 +9.0200e-01 3.0000e+00
++4.0200e-01 +9.0200e-01 3.0000e+00
++4.1800e-01 +8.9800e-01 3.0000e+00
++4.2200e-01 +8.9800e-01 3.0000e+00
++4.1800e-01 +9.0200e-01 3.0000e+00
++4.2200e-01 +9.0200e-01 3.0000e+00
++4.3800e-01 +8.9800e-01 3.0000e+00
++4.4200e-01 +8.9800e-01 3.0000e+00
++4.3800e-01 +9.0200e-01 3.0000e+00
++4.4200e-01 +9.0200e-01 3.0000e+00
++4.5800e-01 +8.9800e-01 3.0000e+00
++4.6200e-01 +8.9800e-01 3.0000e+00
++4.5800e-01 +9.0200e-01 3.0000e+00
++4.6200e-01 +9.0200e-01 3.0000e+00
++4.7800e-01 +8.9800e-01 3.0000e+00
++4.8200e-01 +8.9800e-01 3.0000e+00
++4.7800e-01 +9.0200e-01 3.0000e+00
++4.8200e-01 +9.0200e-01 3.0000e+00
++4.9800e-01 +8.9800e-01 3.0000e+00
++5.0200e-01 +8.9800e-01 3.0000e+00
++4.9800e-01 +9.0200e-01 3.0000e+00
++5.0200e-01 +9.0200e-01 3.0000e+00
++5.1800e-01 +8.9800e-01 3.0000e+00
++5.2200e-01 +8.9800e-01 3.0000e+00
++5.1800e-01 +9.0200e-01 3.0000e+00
++5.2200e-01 +9.0200e-01 3.0000e+00
++5.3800e-01 +8.9800e-01 3.0000e+00
++5.4200e-01 +8.9800e-01 3.0000e+00
++5.3800e-01 +9.0200e-01 3.0000e+00
++5.4200e-01 +9.0200e-01 3.0000e+00
++5.5800e-01 +8.9800e-01 3.0000e+00
++5.6200e-01 +8.9800e-01 3.0000e+00
++5.5800e-01 +9.0200e-01 3.0000e+00
++5.6200e-01 +9.0200e-01 3.0000e+00
++5.7800e-01 +8.9800e-01 3.0000e+00
++5.8200e-01 +8.9800e-01 3.0000e+00
++5.7800e-01 +9.0200e-01 3.0000e+00
++5.8200e-01 +9.0200e-01 3.0000e+00
++5.9800e-01 +8.9800e-01 3.0000e+00
++6.0200e-01 +8.9800e-01 3.0000e+00
++5.9800e-01 +9.0200e-01 3.0000e+00
++6.0200e-01 +9.0200e-01 3.0000e+00
++6.1800e-01 +8.9800e-01 3.0000e+00
++6.2200e-01 +8.9800e-01 3.0000e+00
++6.1800e-01 +9.0200e-01 3.0000e+00
++6.2200e-01 +9.0200e-01 3.0000e+00
++6.3800e-01 +8.9800e-01 3.0000e+00
++6.4200e-01 +8.9800e-01 3.0000e+00
++6.3800e-01 +9.0200e-01 3.0000e+00
++6.4200e-01 +9.0200e-01 3.0000e+00
++6.5800e-01 +8.9800e-01 3.0000e+00
++6.6200e-01 +8.9800e-01 3.0000e+00
++6.5800e-01 +9.0200e-01 3.0000e+00
++6.6200e-01 +9.0200e-01 3.0000e+00
++6.7800e-01 +8.9800e-01 3.0000e+00
++6.8200e-01 +8.9800e-01 3.0000e+00
++6.7800e-01 +9.0200e-01 3.0000e+00
++6.8200e-01 +9.0200e-01 3.0000e+00
++6.9800e-01 +8.9800e-01 3.0000e+00
++7.0200e-01 +8.9800e-01 3.0000e+00
++6.9800e-01 +9.0200e-01 3.0000e+00
++7.0200e-01 +9.0200e-01 3.0000e+00
++7.1800e-01 +8.9800e-01 3.0000e+00
++7.2200e-01 +8.9800e-01 3.0000e+00
++7.1800e-01 +9.0200e-01 3.0000e+00
++7.2200e-01 +9.0200e-01 3.0000e+00
++7.3800e-01 +8.9800e-01 3.0000e+00
++7.4200e-01 +8.9800e-01 3.0000e+00
++7.3800e-01 +9.0200e-01 3.0000e+00
++7.4200e-01 +9.0200e-01 3.0000e+00
++7.5800e-01 +8.9800e-01 3.0000e+00
++7.6200e-01 +8.9800e-01 3.0000e+00
++7.5800e-01 +9.0200e-01 3.0000e+00
++7.6200e-01 +9.0200e-01 3.0000e+00
++7.7800e-01 +8.9800e-01 3.0000e+00
++7.8200e-01 +8.9800e-01 3.0000e+00
++7.7800e-01 +9.0200e-01 3.0000e+00
++7.8200e-01 +9.0200e-01 3.0000e+00
++7.9800e-01 +8.9800e-01 3.0000e+00
++8.0200e-01 +8.9800e-01 3.0000e+00
++7.9800e-01 +9.0200e-01 3.0000e+00
++8.0200e-01 +9.0200e-01 3.0000e+00
++8.1800e-01 +8.9800e-01 3.0000e+00
++8.2200e-01 +8.9800e-01 3.0000e+00
++8.1800e-01 +9.0200e-01 3.0000e+00
++8.2200e-01 +9.0200e-01 3.0000e+00
++8.3800e-01 +8.9800e-01 3.0000e+00
++8.4200e-01 +8.9800e-01 3.0000e+00
++8.3800e-01 +9.0200e-01 3.0000e+00
++8.4200e-01 +9.0200e-01 3.0000e+00
++8.5800e-01 +8.9800e-01 3.0000e+00
++8.6200e-01 +8.9800e-01 3.0000e+00
++8.5800e-01 +9.0200e-01 3.0000e+00
++8.6200e-01 +9.0200e-01 3.0000e+00
++8.7800e-01 +8.9800e-01 3.0000e+00
++8.8200e-01 +8.9800e-01 3.0000e+00
++8.7800e-01 +9.0200e-01 3.0000e+00
++8.8200e-01 +9.0200e-01 3.0000e+00
++8.9800e-01 +8.9800e-01 3.0000e+00
++9.0200e-01 +8.9800e-01 3.0000e+00
++8.9800e-01 +9.0200e-01 3.0000e+00
++9.0200e-01 +9.0200e-01 3.0000e+00
++9.1800e-01 +8.9800e-01 3.0000e+00
++9.2200e-01 +8.9800e-01 3.0000e+00
++9.1800e-01 +9.0200e-01 3.0000e+00
++9.2200e-01 +9.0200e-01 3.0000e+00
++9.3800e-01 +8.9800e-01 3.0000e+00
++9.4200e-01 +8.9800e-01 3.0000e+00
++9.3800e-01 +9.0200e-01 3.0000e+00
++9.4200e-01 +9.0200e-01 3.0000e+00
++9.5800e-01 +8.9800e-01 3.0000e+00
++9.6200e-01 +8.9800e-01 3.0000e+00
++9.5800e-01 +9.0200e-01 3.0000e+00
++9.6200e-01 +9.0200e-01 3.0000e+00
++9.7800e-01 +8.9800e-01 3.0000e+00
++9.8200e-01 +8.9800e-01 3.0000e+00
++9.7800e-01 +9.0200e-01 3.0000e+00
++9.8200e-01 +9.0200e-01 3.0000e+00
++9.9800e-01 +8.9800e-01 3.0000e+00
++1.0020e+00 +8.9800e-01 3.0000e+00
++9.9800e-01 +9.0200e-01 3.0000e+00
++1.0020e+00 +9.0200e-01 3.0000e+00
++1.8000e-02 +9.1800e-01 3.0000e+00
++2.2000e-02 +9.1800e-01 3.0000e+00
++1.8000e-02 +9.2200e-01 3.0000e+00
++2.2000e-02 +9.2200e-01 3.0000e+00
++3.8000e-02 +9.1800e-01 3.0000e+00
++4.2000e-02 +9.1800e-01 3.0000e+00
++3.8000e-02 +9.2200e-01 3.0000e+00
++4.2000e-02 +9.2200e-01 3.0000e+00
++5.8000e-02 +9.1800e-01 3.0000e+00
++6.2000e-02 +9.1800e-01 3.0000e+00
++5.8000e-02 +9.2200e-01 3.0000e+00
++6.2000e-02 +9.2200e-01 3.0000e+00
++7.8000e-02 +9.1800e-01 3.0000e+00
++8.2000e-02 +9.1800e-01 3.0000e+00
++7.8000e-02 +9.2200e-01 3.0000e+00
++8.2000e-02 +9.2200e-01 3.0000e+00
++9.8000e-02 +9.1800e-01 3.0000e+00
++1.0200e-01 +9.1800e-01 3.0000e+00
++9.8000e-02 +9.2200e-01 3.0000e+00
++1.0200e-01 +9.2200e-01 3.0000e+00
++1.1800e-01 +9.1800e-01 3.0000e+00
++1.2200e-01 +9.1800e-01 3.0000e+00
++1.1800e-01 +9.2200e-01 3.0000e+00
++1.2200e-01 +9.2200e-01 3.0000e+00
++1.3800e-01 +9.1800e-01 3.0000e+00
++1.4200e-01 +9.1800e-01 3.0000e+00
++1.3800e-01 +9.2200e-01 3.0000e+00
++1.4200e-01 +9.2200e-01 3.0000e+00
++1.5800e-01 +9.1800e-01 3.0000e+00
++1.6200e-01 +9.1800e-01 3.0000e+00
++1.5800e-01 +9.2200e-01 3.0000e+00
++1.6200e-01 +9.2200e-01 3.0000e+00
++1.7800e-01 +9.1800e-01 3.0000e+00
++1.8200e-01 +9.1800e-01 3.0000e+00
++1.7800e-01 +9.2200e-01 3.0000e+00
++1.8200e-01 +9.2200e-01 3.0000e+00
++1.9800e-01 +9.1800e-01 3.0000e+00
++2.0200e-01 +9.1800e-01 3.0000e+00
++1.9800e-01 +9.2200e-01 3.0000e+00
++2.0200e-01 +9.2200e-01 3.0000e+00
++2.1800e-01 +9.1800e-01 3.0000e+00
++2.2200e-01 +9.1800e-01 3.0000e+00
++2.1800e-01 +9.2200e-01 3.0000e+00
++2.2200e-01 +9.2200e-01 3.0000e+00
++2.3800e-01 +9.1800e-01 3.0000e+00
++2.4200e-01 +9.1800e-01 3.0000e+00
++2.3800e-01 +9.2200e-01 3.0000e+00
++2.4200e-01 +9.2200e-01 3.0000e+00
++2.5800e-01 +9.1800e-01 3.0000e+00
++2.6200e-01 +9.1800e-01 3.0000e+00
++2.5800e-01 +9.2200e-01 3.0000e+00
++2.6200e-01 +9.2200e-01 3.0000e+00
++2.7800e-01 +9.1800e-01 3.0000e+00
++2.8200e-01 +9.1800e-01 3.0000e+00
++2.7800e-01 +9.2200e-01 3.0000e+00
++2.8200e-01 +9.2200e-01 3.0000e+00
++2.9800e-01 +9.1800e-01 3.0000e+00
++3.0200e-01 +9.1800e-01 3.0000e+00
++2.9800e-01 +9.2200e-01 3.0000e+00
++3.0200e-01 +9.2200e-01 3.0000e+00
++3.1800e-01 +9.1800e-01 3.0000e+00
++3.2200e-01 +9.1800e-01 3.0000e+00
++3.1800e-01 +9.2200e-01 3.0000e+00
++3.2200e-01 +9.2200e-01 3.0000e+00
++3.3800e-01 +9.1800e-01 3.0000e+00
++3.4200e-01 +9.1800e-01 3.0000e+00
++3.3800e-01 +9.2200e-01 3.0000e+00
++3.4200e-01 +9.2200e-01 3.0000e+00
++3.5800e-01 +9.1800e-01 3.0000e+00
++3.6200e-01 +9.1800e-01 3.0000e+00
++3.5800e-01 +9.2200e-01 3.0000e+00
++3.6200e-01 +9.2200e-01 3.0000e+00
++3.7800e-01 +9.1800e-01 3.0000e+00
++3.8200e-01 +9.1800e-01 3.0000e+00
++3.7800e-01 +9.2200e-01 3.0000e+00
++3.8200e-01 +9.2200e-01 3.0000e+00
++3.9800e-01 +9.1800e-01 3.0000e+00
++4.0200e-01 +9.1800e-01 3.0000e+00
++3.9800e-01 +9.2200e-01 3.0000e+00
++4.0200e-01 +9.2200e-01 3.0000e+00
++4.1800e-01 +9.1800e-01 3.0000e+00
++4.2200e-01 +9.1800e-01 3.0000e+00
++4.1800e-01 +9.2200e-01 3.0000e+00
++4.2200e-01 +9.2200e-01 3.0000e+00
++4.3800e-01 +9.1800e-01 3.0000e+00
++4.4200e-01 +9.1800e-01 3.0000e+00
++4.3800e-01 +9.2200e-01 3.0000e+00
++4.4200e-01 +9.2200e-01 3.0000e+00
++4.5800e-01 +9.1800e-01 3.0000e+00
++4.6200e-01 +9.1800e-01 3.0000e+00
++4.5800e-01 +9.2200e-01 3.0000e+00
++4.6200e-01 +9.2200e-01 3.0000e+00
++4.7800e-01 +9.1800e-01 3.0000e+00
++4.8200e-01 +9.1800e-01 3.0000e+00
++4.7800e-01 +9.2200e-01 3.0000e+00
++4.8200e-01 +9.2200e-01 3.0000e+00
++4.9800e-01 +9.1800e-01 3.0000e+00
++5.0200e-01 +9.1800e-01 3.0000e+00
++4.9800e-01 +9.2200e-01 3.0000e+00
++5.0200e-01 +9.2200e-01 3.0000e+00
++5.1800e-01 +9.1800e-01 3.0000e+00
++5.2200e-01 +9.1800e-01 3.0000e+00
++5.1800e-01 +9.2200e-01 3.0000e+00
++5.2200e-01 +9.2200e-01 3.0000e+00
++5.3800e-01 +9.1800e-01 3.0000e+00
++5.4200e-01 +9.1800e-01 3.0000e+00
++5.3800e-01 +9.2200e-01 3.0000e+00
++5.4200e-01 +9.2200e-01 3.0000e+00
++5.5800e-01 +9.1800e-01 3.0000e+00
++5.6200e-01 +9.1800e-01 3.0000e+00
++5.5800e-01 +9.2200e-01 3.0000e+00
++5.6200e-01 +9.2200e-01 3.0000e+00
++5.7800e-01 +9.1800e-01 3.0000e+00
++5.8200e-01 +9.1800e-01 3.0000e+00
++5.7800e-01 +9.2200e-01 3.0000e+00
++5.8200e-01 +9.2200e-01 3.0000e+00
++5.9800e-01 +9.1800e-01 3.0000e+00
++6.0200e-01 +9.1800e-01 3.0000e+00
++5.9800e-01 +9.2200e-01 3.0000e+00
++6.0200e-01 +9.2200e-01 3.0000e+00
++6.1800e-01 +9.1800e-01 3.0000e+00
++6.2200e-01 +9.1800e-01 3.0000e+00
++6.1800e-01 +9.2200e-01 3.0000e+00
++6.2200e-01 +9.2200e-01 3.0000e+00
++6.3800e-01 +9.1800e-01 3.0000e+00
++6.4200e-01 +9.1800e-01 3.0000e+00
++6.3800e-01 +9.2200e-01 3.0000e+00
++6.4200e-01 +9.2200e-01 3.0000e+00
++6.5800e-01 +9.1800e-01 3.0000e+00
++6.6200e-01 +9.1800e-01 3.0000e+00
++6.5800e-01 +9.2200e-01 3.0000e+00
++6.6200e-01 +9.2200e-01 3.0000e+00
++6.7800e-01 +9.1800e-01 3.0000e+00
++6.8200e-01 +9.1800e-01 3.0000e+00
++6.7800e-01 +9.2200e-01 3.0000e+00
++6.8200e-01 +9.2200e-01 3.0000e+00
++6.9800e-01 +9.1800e-01 3.0000e+00
++7.0200e-01 +9.1800e-01 3.0000e+00
++6.9800e-01 +9.2200e-01 3.0000e+00
++7.0200e-01 +9.2200e-01 3.0000e+00
++7.1800e-01 +9.1800e-01 3.0000e+00
++7.2200e-01 +9.1800e-01 3.0000e+00
++7.1800e-01 +9.2200e-01 3.0000e+00
++7.2200e-01 +9.2200e-01 3.0000e+00
++7.3800e-01 +9.1800e-01 3.0000e+00
++7.4200e-01 +9.1800e-01 3.0000e+00
++7.3800e-01 +9.2200e-01 3.0000e+00
++7.4200e-01 +9.2200e-01 3.0000e+00
++7.5800e-01 +9.1800e-01 3.0000e+00
++7.6200e-01 +9.1800e-01 3.0000e+00
++7.5800e-01 +9.2200e-01 3.0000e+00
++7.6200e-01 +9.2200e-01 3.0000e+00
++7.7800e-01 +9.1800e-01 3.0000e+00
++7.8200e-01 +9.1800e-01 3.0000e+00
++7.7800e-01 +9.2200e-01 3.0000e+00
++7.8200e-01 +9.2200e-01 3.0000e+00
++7.9800e-01 +9.1800e-01 3.0000e+00
++8.0200e-01 +9.1800e-01 3.0000e+00
++7.9800e-01 +9.2200e-01 3.0000e+00
++8.0200e-01 +9.2200e-01 3.0000e+00
++8.1800e-01 +9.1800e-01 3.0000e+00
++8.2200e-01 +9.1800e-01 3.0000e+00
++8.1800e-01 +9.2200e-01 3.0000e+00
++8.2200e-01 +9.2200e-01 3.0000e+00
++8.3800e-01 +9.1800e-01 3.0000e+00
++8.4200e-01 +9.1800e-01 3.0000e+00
++8.3800e-01 +9.2200e-01 3.0000e+00
++8.4200e-01 +9.2200e-01 3.0000e+00
++8.5800e-01 +9.1800e-01 3.0000e+00
++8.6200e-01 +9.1800e-01 3.0000e+00
++8.5800e-01 +9.2200e-01 3.0000e+00
++8.6200e-01 +9.2200e-01 3.0000e+00
++8.7800e-01 +9.1800e-01 3.0000e+00
++8.8200e-01 +9.1800e-01 3.0000e+00
++8.7800e-01 +9.2200e-01 3.0000e+00
++8.8200e-01 +9.2200e-01 3.0000e+00
++8.9800e-01 +9.1800e-01 3.0000e+00
++9.0200e-01 +9.1800e-01 3.0000e+00
++8.9800e-01 +9.2200e-01 3.0000e+00
++9.0200e-01 +9.2200e-01 3.0000e+00
++9.1800e-01 +9.1800e-01 3.0000e+00
++9.2200e-01 +9.1800e-01 3.0000e+00
++9.1800e-01 +9.2200e-01 3.0000e+00
++9.2200e-01 +9.2200e-01 3.0000e+00
++9.3800e-01 +9.1800e-01 3.0000e+00
++9.4200e-01 +9.1800e-01 3.0000e+00
++9.3800e-01 +9.2200e-01 3.0000e+00
++9.4200e-01 +9.2200e-01 3.0000e+00
++9.5800e-01 +9.1800e-01 3.0000e+00
++9.6200e-01 +9.1800e-01 3.0000e+00
++9.5800e-01 +9.2200e-01 3.0000e+00
++9.6200e-01 +9.2200e-01 3.0000e+00
++9.7800e-01 +9.1800e-01 3.0000e+00
++9.8200e-01 +9.1800e-01 3.0000e+00
++9.7800e-01 +9.2200e-01 3.0000e+00
++9.8200e-01 +9.2200e-01 3.0000e+00
++9.9800e-01 +9.1800e-01 3.0000e+00
++1.0020e+00 +9.1800e-01 3.0000e+00
++9.9800e-01 +9.2200e-01 3.0000e+00
++1.0020e+00 +9.2200e-01 3.0000e+00
++1.8000e-02 +9.3800e-01 3.0000e+00
++2.2000e-02 +9.3800e-01 3.0000e+00
++1.8000e-02 +9.4200e-01 3.0000e+00
++2.2000e-02 +9.4200e-01 3.0000e+00
++3.8000e-02 +9.3800e-01 3.0000e+00
++4.2000e-02 +9.3800e-01 3.0000e+00
++3.8000e-02 +9.4200e-01 3.0000e+00
++4.2000e-02 +9.4200e-01 3.0000e+00
++5.8000e-02 +9.3800e-01 3.0000e+00
++6.2000e-02 +9.3800e-01 3.0000e+00
++5.8000e-02 +9.4200e-01 3.0000e+00
++6.2000e-02 +9.4200e-01 3.0000e+00
++7.8000e-02 +9.3800e-01 3.0000e+00
++8.2000e-02 +9.3800e-01 3.0000e+00
++7.8000e-02 +9.4200e-01 3.0000e+00
++8.2000e-02 +9.4200e-01 3.0000e+00
++9.8000e-02 +9.3800e-01 3.0000e+00
++1.0200e-01 +9.3800e-01 3.0000e+00
++9.8000e-02 +9.4200e-01 3.0000e+00
++1.0200e-01 +9.4200e-01 3.0000e+00
++1.1800e-01 +9.3800e-01 3.0000e+00
++1.2200e-01 +9.3800e-01 3.0000e+00
++1.1800e-01 +9.4200e-01 3.0000e+00
++1.2200e-01 +9.4200e-01 3.0000e+00
++1.3800e-01 +9.3800e-01 3.0000e+00
++1.4200e-01 +9.3800e-01 3.0000e+00
++1.3800e-01 +9.4200e-01 3.0000e+00
++1.4200e-01 +9.4200e-01 3.0000e+00
++1.5800e-01 +9.3800e-01 3.0000e+00
++1.6200e-01 +9.3800e-01 3.0000e+00
++1.5800e-01 +9.4200e-01 3.0000e+00
++1.6200e-01 +9.4200e-01 3.0000e+00
++1.7800e-01 +9.3800e-01 3.0000e+00
++1.8200e-01 +9.3800e-01 3.0000e+00
++1.7800e-01 +9.4200e-01 3.0000e+00
++1.8200e-01 +9.4200e-01 3.0000e+00
++1.9800e-01 +9.3800e-01 3.0000e+00
++2.0200e-01 +9.3800e-01 3.0000e+00
++1.9800e-01 +9.4200e-01 3.0000e+00
++2.0200e-01 +9.4200e-01 3.0000e+00
++2.1800e-01 +9.3800e-01 3.0000e+00
++2.2200e-01 +9.3800e-01 3.0000e+00
++2.1800e-01 +9.4200e-01 3.0000e+00
++2.2200e-01 +9.4200e-01 3.0000e+00
++2.3800e-01 +9.3800e-01 3.0000e+00
++2.4200e-01 +9.3800e-01 3.0000e+00
++2.3800e-01 +9.4200e-01 3.0000e+00
++2.4200e-01 +9.4200e-01 3.0000e+00
++2.5800e-01 +9.3800e-01 3.0000e+00
++2.6200e-01 +9.3800e-01 3.0000e+00
++2.5800e-01 +9.4200e-01 3.0000e+00
++2.6200e-01 +9.4200e-01 3.0000e+00
++2.7800e-01 +9.3800e-01 3.0000e+00
++2.8200e-01 +9.3800e-01 3.0000e+00
++2.7800e-01 +9.4200e-01 3.0000e+00
++2.8200e-01 +9.4200e-01 3.0000e+00
++2.9800e-01 +9.3800e-01 3.0000e+00
++3.0200e-01 +9.3800e-01 3.0000e+00
++2.9800e-01 +9.4200e-01 3.0000e+00
++3.0200e-01 +9.4200e-01 3.0000e+00
++3.1800e-01 +9.3800e-01 3.0000e+00
++3.2200e-01 +9.3800e-01 3.0000e+00
++3.1800e-01 +9.4200e-01 3.0000e+00
++3.2200e-01 +9.4200e-01 3.0000e+00
++3.3800e-01 +9.3800e-01 3.0000e+00
++3.4200e-01 +9.3800e-01 3.0000e+00
++3.3800e-01 +9.4200e-01 3.0000e+00
++3.4200e-01 +9.4200e-01 3.0000e+00
++3.5800e-01 +9.3800e-01 3.0000e+00
++3.6200e-01 +9.3800e-01 3.0000e+00
++3.5800e-01 +9.4200e-01 3.0000e+00
++3.6200e-01 +9.4200e-01 3.0000e+00
++3.7800e-01 +9.3800e-01 3.0000e+00
++3.8200e-01 +9.3800e-01 3.0000e+00
++3.7800e-01 +9.4200e-01 3.0000e+00
++3.8200e-01 +9.4200e-01 3.0000e+00
++3.9800e-01 +9.3800e-01 3.0000e+00
++4.0200e-01 +9.3800e-01 3.0000e+00
++3.9800e-01 +9.4200e-01 3.0000e+00
++4.0200e-01 +9.4200e-01 3.0000e+00
++4.1800e-01 +9.3800e-01 3.0000e+00
++4.2200e-01 +9.3800e-01 3.0000e+00
++4.1800e-01 +9.4200e-01 3.0000e+00
++4.2200e-01 +9.4200e-01 3.0000e+00
++4.3800e-01 +9.3800e-01 3.0000e+00
++4.4200e-01 +9.3800e-01 3.0000e+00
++4.3800e-01 +9.4200e-01 3.0000e+00
++4.4200e-01 +9.4200e-01 3.0000e+00
++4.5800e-01 +9.3800e-01 3.0000e+00
++4.6200e-01 +9.3800e-01 3.0000e+00
++4.5800e-01 +9.4200e-01 3.0000e+00
++4.6200e-01 +9.4200e-01 3.0000e+00
++4.7800e-01 +9.3800e-01 3.0000e+00
++4.8200e-01 +9.3800e-01 3.0000e+00
++4.7800e-01 +9.4200e-01 3.0000e+00
++4.8200e-01 +9.4200e-01 3.0000e+00
++4.9800e-01 +9.3800e-01 3.0000e+00
++5.0200e-01 +9.3800e-01 3.0000e+00
++4.9800e-01 +9.4200e-01 3.0000e+00
++5.0200e-01 +9.4200e-01 3.0000e+00
++5.1800e-01 +9.3800e-01 3.0000e+00
++5.2200e-01 +9.3800e-01 3.0000e+00
++5.1800e-01 +9.4200e-01 3.0000e+00
++5.2200e-01 +9.4200e-01 3.0000e+00
++5.3800e-01 +9.3800e-01 3.0000e+00
++5.4200e-01 +9.3800e-01 3.0000e+00
++5.3800e-01 +9.4200e-01 3.0000e+00
++5.4200e-01 +9.4200e-01 3.0000e+00
++5.5800e-01 +9.3800e-01 3.0000e+00
++5.6200e-01 +9.3800e-01 3.0000e+00
++5.5800e-01 +9.4200e-01 3.0000e+00
++5.6200e-01 +9.4200e-01 3.0000e+00
++5.7800e-01 +9.3800e-01 3.0000e+00
++5.8200e-01 +9.3800e-01 3.0000e+00
++5.7800e-01 +9.4200e-01 3.0000e+00
++5.8200e-01 +9.4200e-01 3.0000e+00
++5.9800e-01 +9.3800e-01 3.0000e+00
++6.0200e-01 +9.3800e-01 3.0000e+00
++5.9800e-01 +9.4200e-01 3.0000e+00
++6.0200e-01 +9.4200e-01 3.0000e+00
++6.1800e-01 +9.3800e-01 3.0000e+00
++6.2200e-01 +9.3800e-01 3.0000e+00
++6.1800e-01 +9.4200e-01 3.0000e+00
++6.2200e-01 +9.4200e-01 3.0000e+00
++6.3800e-01 +9.3800e-01 3.0000e+00
++6.4200e-01 +9.3800e-01 3.0000e+00
++6.3800e-01 +9.4200e-01 3.0000e+00
++6.4200e-01 +9.4200e-01 3.0000e+00
++6.5800e-01 +9.3800e-01 3.0000e+00
++6.6200e-01 +9.3800e-01 3.0000e+00
++6.5800e-01 +9.4200e-01 3.0000e+00
++6.6200e-01 +9.4200e-01 3.0000e+00
++6.7800e-01 +9.3800e-01 3.0000e+00
++6.8200e-01 +9.3800e-01 3.0000e+00
++6.7800e-01 +9.4200e-01 3.0000e+00
++6.8200e-01 +9.4200e-01 3.0000e+00
++6.9800e-01 +9.3800e-01 3.0000e+00
++7.0200e-01 +9.3800e-01 3.0000e+00
++6.9800e-01 +9.4200e-01 3.0000e+00
++7.0200e-01 +9.4200e-01 3.0000e+00
++7.1800e-01 +9.3800e-01 3.0000e+00
++7.2200e-01 +9.3800e-01 3.0000e+00
++7.1800e-01 +9.4200e-01 3.0000e+00
++7.2200e-01 +9.4200e-01 3.0000e+00
++7.3800e-01 +9.3800e-01 3.0000e+00
++7.4200e-01 +9.3800e-01 3.0000e+00
++7.3800e-01 +9.4200e-01 3.0000e+00
++7.4200e-01 +9.4200e-01 3.0000e+00
++7.5800e-01 +9.3800e-01 3.0000e+00
++7.6200e-01 +9.3800e-01 3.0000e+00
++7.5800e-01 +9.4200e-01 3.0000e+00
++7.6200e-01 +9.4200e-01 3.0000e+00
++7.7800e-01 +9.3800e-01 3.0000e+00
++7.8200e-01 +9.3800e-01 3.0000e+00
++7.7800e-01 +9.4200e-01 3.0000e+00
++7.8200e-01 +9.4200e-01 3.0000e+00
++7.9800e-01 +9.3800e-01 3.0000e+00
++8.0200e-01 +9.3800e-01 3.0000e+00
++7.9800e-01 +9.4200e-01 3.0000e+00
++8.0200e-01 +9.4200e-01 3.0000e+00
++8.1800e-01 +9.3800e-01 3.0000e+00
++8.2200e-01 +9.3800e-01 3.0000e+00
++8.1800e-01 +9.4200e-01 3.0000e+00
++8.2200e-01 +9.4200e-01 3.0000e+00
++8.3800e-01 +9.3800e-01 3.0000e+00
++8.4200e-01 +9.3800e-01 3.0000e+00
++8.3800e-01 +9.4200e-01 3.0000e+00
++8.4200e-01 +9.4200e-01 3.0000e+00
++8.5800e-01 +9.3800e-01 3.0000e+00
++8.6200e-01 +9.3800e-01 3.0000e+00
++8.5800e-01 +9.4200e-01 3.0000e+00
++8.6200e-01 +9.4200e-01 3.0000e+00
++8.7800e-01 +9.3800e-01 3.0000e+00
++8.8200e-01 +9.3800e-01 3.0000e+00
++8.7800e-01 +9.4200e-01 3.0000e+00
++8.8200e-01 +9.4200e-01 3.0000e+00
++8.9800e-01 +9.3800e-01 3.0000e+00
++9.0200e-01 +9.3800e-01 3.0000e+00
++8.9800e-01 +9.4200e-01 3.0000e+00
++9.0200e-01 +9.4200e-01 3.0000e+00
++9.1800e-01 +9.3800e-01 3.0000e+00
++9.2200e-01 +9.3800e-01 3.0000e+00
++9.1800e-01 +9.4200e-01 3.0000e+00
++9.2200e-01 +9.4200e-01 3.0000e+00
++9.3800e-01 +9.3800e-01 3.0000e+00
++9.4200e-01 +9.3800e-01 3.0000e+00
++9.3800e-01 +9.4200e-01 3.0000e+00
++9.4200e-01 +9.4200e-01 3.0000e+00
++9.5800e-01 +9.3800e-01 3.0000e+00
++9.6200e-01 +9.3800e-01 3.0000e+00
++9.5800e-01 +9.4200e-01 3.0000e+00
++9.6200e-01 +9.4200e-01 3.0000e+00
++9.7800e-01 +9.3800e-01 3.0000e+00
++9.8200e-01 +9.3800e-01 3.0000e+00
++9.7800e-01 +9.4200e-01 3.0000e+00
++9.8200e-01 +9.4200e-01 3.0000e+00
++9.9800e-01 +9.3800e-01 3.0000e+00
++1.0020e+00 +9.3800e-01 3.0000e+00
++9.9800e-01 +9.4200e-01 3.0000e+00
++1.0020e+00 +9.4200e-01 3.0000e+00
++1.8000e-02 +9.5800e-01 3.0000e+00
++2.2000e-02 +9.5800e-01 3.0000e+00
++1.8000e-02 +9.6200e-01 3.0000e+00
++2.2000e-02 +9.6200e-01 3.0000e+00
++3.8000e-02 +9.5800e-01 3.0000e+00
++4.2000e-02 +9.5800e-01 3.0000e+00
++3.8000e-02 +9.6200e-01 3.0000e+00
++4.2000e-02 +9.6200e-01 3.0000e+00
++5.8000e-02 +9.5800e-01 3.0000e+00
++6.2000e-02 +9.5800e-01 3.0000e+00
++5.8000e-02 +9.6200e-01 3.0000e+00
++6.2000e-02 +9.6200e-01 3.0000e+00
++7.8000e-02 +9.5800e-01 3.0000e+00
++8.2000e-02 +9.5800e-01 3.0000e+00
++7.8000e-02 +9.6200e-01 3.0000e+00
++8.2000e-02 +9.6200e-01 3.0000e+00
++9.8000e-02 +9.5800e-01 3.0000e+00
++1.0200e-01 +9.5800e-01 3.0000e+00
++9.8000e-02 +9.6200e-01 3.0000e+00
++1.0200e-01 +9.6200e-01 3.0000e+00
++1.1800e-01 +9.5800e-01 3.0000e+00
++1.2200e-01 +9.5800e-01 3.0000e+00
++1.1800e-01 +9.6200e-01 3.0000e+00
++1.2200e-01 +9.6200e-01 3.0000e+00
++1.3800e-01 +9.5800e-01 3.0000e+00
++1.4200e-01 +9.5800e-01 3.0000e+00
++1.3800e-01 +9.6200e-01 3.0000e+00
++1.4200e-01 +9.6200e-01 3.0000e+00
++1.5800e-01 +9.5800e-01 3.0000e+00
++1.6200e-01 +9.5800e-01 3.0000e+00
++1.5800e-01 +9.6200e-01 3.0000e+00
++1.6200e-01 +9.6200e-01 3.0000e+00
++1.7800e-01 +9.5800e-01 3.0000e+00
++1.8200e-01 +9.5800e-01 3.0000e+00
++1.7800e-01 +9.6200e-01 3.0000e+00
++1.8200e-01 +9.6200e-01 3.0000e+00
++1.9800e-01 +9.5800e-01 3.0000e+00
++2.0200e-01 +9.5800e-01 3.0000e+00
++1.9800e-01 +9.6200e-01 3.0000e+00
++2.0200e-01 +9.6200e-01 3.0000e+00
++2.1800e-01 +9.5800e-01 3.0000e+00
++2.2200e-01 +9.5800e-01 3.0000e+00
++2.1800e-01 +9.6200e-01 3.0000e+00
++2.2200e-01 +9.6200e-01 3.0000e+00
++2.3800e-01 +9.5800e-01 3.0000e+00
++2.4200e-01 +9.5800e-01 3.0000e+00
++2.3800e-01 +9.6200e-01 3.0000e+00
++2.4200e-01 +9.6200e-01 3.0000e+00
++2.5800e-01 +9.5800e-01 3.0000e+00
++2.6200e-01 +9.5800e-01 3.0000e+00
++2.5800e-01 +9.6200e-01 3.0000e+00
++2.6200e-01 +9.6200e-01 3.0000e+00
++2.7800e-01 +9.5800e-01 3.0000e+00
++2.8200e-01 +9.5800e-01 3.0000e+00
++2.7800e-01 +9.6200e-01 3.0000e+00
++2.8200e-01 +9.6200e-01 3.0000e+00
++2.9800e-01 +9.5800e-01 3.0000e+00
++3.0200e-01 +9.5800e-01 3.0000e+00
++2.9800e-01 +9.6200e-01 3.0000e+00
++3.0200e-01 +9.6200e-01 3.0000e+00
++3.1800e-01 +9.5800e-01 3.0000e+00
++3.2200e-01 +9.5800e-01 3.0000e+00
++3.1800e-01 +9.6200e-01 3.0000e+00
++3.2200e-01 +9.6200e-01 3.0000e+00
++3.3800e-01 +9.5800e-01 3.0000e+00
++3.4200e-01 +9.5800e-01 3.0000e+00
++3.3800e-01 +9.6200e-01 3.0000e+00
++3.4200e-01 +9.6200e-01 3.0000e+00
++3.5800e-01 +9.5800e-01 3.0000e+00
++3.6200e-01 +9.5800e-01 3.0000e+00
++3.5800e-01 +9.6200e-01 3.0000e+00
++3.6200e-01 +9.6200e-01 3.0000e+00
++3.7800e-01 +9.5800e-01 3.0000e+00
++3.8200e-01 +9.5800e-01 3.0000e+00
++3.7800e-01 +9.6200e-01 3.0000e+00
++3.8200e-01 +9.6200e-01 3.0000e+00
++3.9800e-01 +9.5800e-01 3.0000e+00
++4.0200e-01 +9.5800e-01 3.0000e+00
++3.9800e-01 +9.6200e-01 3.0000e+00
++4.0200e-01 +9.6200e-01 3.0000e+00
++4.1800e-01 +9.5800e-01 3.0000e+00
++4.2200e-01 +9.5800e-01 3.0000e+00
++4.1800e-01 +9.6200e-01 3.0000e+00
++4.2200e-01 +9.6200e-01 3.0000e+00
++4.3800e-01 +9.5800e-01 3.0000e+00
++4.4200e-01 +9.5800e-01 3.0000e+00
++4.3800e-01 +9.6200e-01 3.0000e+00
++4.4200e-01 +9.6200e-01 3.0000e+00
++4.5800e-01 +9.5800e-01 3.0000e+00
++4.6200e-01 +9.5800e-01 3.0000e+00
++4.5800e-01 +9.6200e-01 3.0000e+00
++4.6200e-01 +9.6200e-01 3.0000e+00
++4.7800e-01 +9.5800e-01 3.0000e+00
++4.8200e-01 +9.5800e-01 3.0000e+00
++4.7800e-01 +9.6200e-01 3.0000e+00
++4.8200e-01 +9.6200e-01 3.0000e+00
++4.9800e-01 +9.5800e-01 3.0000e+00
++5.0200e-01 +9.5800e-01 3.0000e+00
++4.9800e-01 +9.6200e-01 3.0000e+00
++5.0200e-01 +9.6200e-01 3.0000e+00
++5.1800e-01 +9.5800e-01 3.0000e+00
++5.2200e-01 +9.5800e-01 3.0000e+00
++5.1800e-01 +9.6200e-01 3.0000e+00
++5.2200e-01 +9.6200e-01 3.0000e+00
++5.3800e-01 +9.5800e-01 3.0000e+00
++5.4200e-01 +9.5800e-01 3.0000e+00
++5.3800e-01 +9.6200e-01 3.0000e+00
++5.4200e-01 +9.6200e-01 3.0000e+00
++5.5800e-01 +9.5800e-01 3.0000e+00
++5.6200e-01 +9.5800e-01 3.0000e+00
++5.5800e-01 +9.6200e-01 3.0000e+00
++5.6200e-01 +9.6200e-01 3.0000e+00
++5.7800e-01 +9.5800e-01 3.0000e+00
++5.8200e-01 +9.5800e-01 3.0000e+00
++5.7800e-01 +9.6200e-01 3.0000e+00
++5.8200e-01 +9.6200e-01 3.0000e+00
++5.9800e-01 +9.5800e-01 3.0000e+00
++6.0200e-01 +9.5800e-01 3.0000e+00
++5.9800e-01 +9.6200e-01 3.0000e+00
++6.0200e-01 +9.6200e-01 3.0000e+00
++6.1800e-01 +9.5800e-01 3.0000e+00
++6.2200e-01 +9.5800e-01 3.0000e+00
++6.1800e-01 +9.6200e-01 3.0000e+00
++6.2200e-01 +9.6200e-01 3.0000e+00
++6.3800e-01 +9.5800e-01 3.0000e+00
++6.4200e-01 +9.5800e-01 3.0000e+00
++6.3800e-01 +9.6200e-01 3.0000e+00
++6.4200e-01 +9.6200e-01 3.0000e+00
++6.5800e-01 +9.5800e-01 3.0000e+00
++6.6200e-01 +9.5800e-01 3.0000e+00
++6.5800e-01 +9.6200e-01 3.0000e+00
++6.6200e-01 +9.6200e-01 3.0000e+00
++6.7800e-01 +9.5800e-01 3.0000e+00
++6.8200e-01 +9.5800e-01 3.0000e+00
++6.7800e-01 +9.6200e-01 3.0000e+00
++6.8200e-01 +9.6200e-01 3.0000e+00
++6.9800e-01 +9.5800e-01 3.0000e+00
++7.0200e-01 +9.5800e-01 3.0000e+00
++6.9800e-01 +9.6200e-01 3.0000e+00
++7.0200e-01 +9.6200e-01 3.0000e+00
++7.1800e-01 +9.5800e-01 3.0000e+00
++7.2200e-01 +9.5800e-01 3.0000e+00
++7.1800e-01 +9.6200e-01 3.0000e+00
++7.2200e-01 +9.6200e-01 3.0000e+00
++7.3800e-01 +9.5800e-01 3.0000e+00
++7.4200e-01 +9.5800e-01 3.0000e+00
++7.3800e-01 +9.6200e-01 3.0000e+00
++7.4200e-01 +9.6200e-01 3.0000e+00
++7.5800e-01 +9.5800e-01 3.0000e+00
++7.6200e-01 +9.5800e-01 3.0000e+00
++7.5800e-01 +9.6200e-01 3.0000e+00
++7.6200e-01 +9.6200e-01 3.0000e+00
++7.7800e-01 +9.5800e-01 3.0000e+00
++7.8200e-01 +9.5800e-01 3.0000e+00
++7.7800e-01 +9.6200e-01 3.0000e+00
++7.8200e-01 +9.6200e-01 3.0000e+00
++7.9800e-01 +9.5800e-01 3.0000e+00
++8.0200e-01 +9.5800e-01 3.0000e+00
++7.9800e-01 +9.6200e-01 3.0000e+00
++8.0200e-01 +9.6200e-01 3.0000e+00
++8.1800e-01 +9.5800e-01 3.0000e+00
++8.2200e-01 +9.5800e-01 3.0000e+00
++8.1800e-01 +9.6200e-01 3.0000e+00
++8.2200e-01 +9.6200e-01 3.0000e+00
++8.3800e-01 +9.5800e-01 3.0000e+00
++8.4200e-01 +9.5800e-01 3.0000e+00
++8.3800e-01 +9.6200e-01 3.0000e+00
++8.4200e-01 +9.6200e-01 3.0000e+00
++8.5800e-01 +9.5800e-01 3.0000e+00
++8.6200e-01 +9.5800e-01 3.0000e+00
++8.5800e-01 +9.6200e-01 3.0000e+00
++8.6200e-01 +9.6200e-01 3.0000e+00
++8.7800e-01 +9.5800e-01 3.0000e+00
++8.8200e-01 +9.5800e-01 3.0000e+00
++8.7800e-01 +9.6200e-01 3.0000e+00
++8.8200e-01 +9.6200e-01 3.0000e+00
++8.9800e-01 +9.5800e-01 3.0000e+00
++9.0200e-01 +9.5800e-01 3.0000e+00
++8.9800e-01 +9.6200e-01 3.0000e+00
++9.0200e-01 +9.6200e-01 3.0000e+00
++9.1800e-01 +9.5800e-01 3.0000e+00
++9.2200e-01 +9.5800e-01 3.0000e+00
++9.1800e-01 +9.6200e-01 3.0000e+00
++9.2200e-01 +9.6200e-01 3.0000e+00
++9.3800e-01 +9.5800e-01 3.0000e+00
++9.4200e-01 +9.5800e-01 3.0000e+00
++9.3800e-01 +9.6200e-01 3.0000e+00
++9.4200e-01 +9.6200e-01 3.0000e+00
++9.5800e-01 +9.5800e-01 3.0000e+00
++9.6200e-01 +9.5800e-01 3.0000e+00
++9.5800e-01 +9.6200e-01 3.0000e+00
++9.6200e-01 +9.6200e-01 3.0000e+00
++9.7800e-01 +9.5800e-01 3.0000e+00
++9.8200e-01 +9.5800e-01 3.0000e+00
++9.7800e-01 +9.6200e-01 3.0000e+00
++9.8200e-01 +9.6200e-01 3.0000e+00
++9.9800e-01 +9.5800e-01 3.0000e+00
++1.0020e+00 +9.5800e-01 3.0000e+00
++9.9800e-01 +9.6200e-01 3.0000e+00
++1.0020e+00 +9.6200e-01 3.0000e+00
++1.8000e-02 +9.7800e-01 3.0000e+00
++2.2000e-02 +9.7800e-01 3.0000e+00
++1.8000e-02 +9.8200e-01 3.0000e+00
++2.2000e-02 +9.8200e-01 3.0000e+00
++3.8000e-02 +9.7800e-01 3.0000e+00
++4.2000e-02 +9.7800e-01 3.0000e+00
++3.8000e-02 +9.8200e-01 3.0000e+00
++4.2000e-02 +9.8200e-01 3.0000e+00
++5.8000e-02 +9.7800e-01 3.0000e+00
++6.2000e-02 +9.7800e-01 3.0000e+00
++5.8000e-02 +9.8200e-01 3.0000e+00
++6.2000e-02 +9.8200e-01 3.0000e+00
++7.8000e-02 +9.7800e-01 3.0000e+00
++8.2000e-02 +9.7800e-01 3.0000e+00
++7.8000e-02 +9.8200e-01 3.0000e+00
++8.2000e-02 +9.8200e-01 3.0000e+00
++9.8000e-02 +9.7800e-01 3.0000e+00
++1.0200e-01 +9.7800e-01 3.0000e+00
++9.8000e-02 +9.8200e-01 3.0000e+00
++1.0200e-01 +9.8200e-01 3.0000e+00
++1.1800e-01 +9.7800e-01 3.0000e+00
++1.2200e-01 +9.7800e-01 3.0000e+00
++1.1800e-01 +9.8200e-01 3.0000e+00
++1.2200e-01 +9.8200e-01 3.0000e+00
++1.3800e-01 +9.7800e-01 3.0000e+00
++1.4200e-01 +9.7800e-01 3.0000e+00
++1.3800e-01 +9.8200e-01 3.0000e+00
++1.4200e-01 +9.8200e-01 3.0000e+00
++1.5800e-01 +9.7800e-01 3.0000e+00
++1.6200e-01 +9.7800e-01 3.0000e+00
++1.5800e-01 +9.8200e-01 3.0000e+00
++1.6200e-01 +9.8200e-01 3.0000e+00
++1.7800e-01 +9.7800e-01 3.0000e+00
++1.8200e-01 +9.7800e-01 3.0000e+00
++1.7800e-01 +9.8200e-01 3.0000e+00
++1.8200e-01 +9.8200e-01 3.0000e+00
++1.9800e-01 +9.7800e-01 3.0000e+00
++2.0200e-01 +9.7800e-01 3.0000e+00
++1.9800e-01 +9.8200e-01 3.0000e+00
++2.0200e-01 +9.8200e-01 3.0000e+00
++2.1800e-01 +9.7800e-01 3.0000e+00
++2.2200e-01 +9.7800e-01 3.0000e+00
++2.1800e-01 +9.8200e-01 3.0000e+00
++2.2200e-01 +9.8200e-01 3.0000e+00
++2.3800e-01 +9.7800e-01 3.0000e+00
++2.4200e-01 +9.7800e-01 3.0000e+00
++2.3800e-01 +9.8200e-01 3.0000e+00
++2.4200e-01 +9.8200e-01 3.0000e+00
++2.5800e-01 +9.7800e-01 3.0000e+00
++2.6200e-01 +9.7800e-01 3.0000e+00
++2.5800e-01 +9.8200e-01 3.0000e+00
++2.6200e-01 +9.8200e-01 3.0000e+00
++2.7800e-01 +9.7800e-01 3.0000e+00
++2.8200e-01 +9.7800e-01 3.0000e+00
++2.7800e-01 +9.8200e-01 3.0000e+00
++2.8200e-01 +9.8200e-01 3.0000e+00
++2.9800e-01 +9.7800e-01 3.0000e+00
++3.0200e-01 +9.7800e-01 3.0000e+00
++2.9800e-01 +9.8200e-01 3.0000e+00
++3.0200e-01 +9.8200e-01 3.0000e+00
++3.1800e-01 +9.7800e-01 3.0000e+00
++3.2200e-01 +9.7800e-01 3.0000e+00
++3.1800e-01 +9.8200e-01 3.0000e+00
++3.2200e-01 +9.8200e-01 3.0000e+00
++3.3800e-01 +9.7800e-01 3.0000e+00
++3.4200e-01 +9.7800e-01 3.0000e+00
++3.3800e-01 +9.8200e-01 3.0000e+00
++3.4200e-01 +9.8200e-01 3.0000e+00
++3.5800e-01 +9.7800e-01 3.0000e+00
++3.6200e-01 +9.7800e-01 3.0000e+00
++3.5800e-01 +9.8200e-01 3.0000e+00
++3.6200e-01 +9.8200e-01 3.0000e+00
++3.7800e-01 +9.7800e-01 3.0000e+00
++3.8200e-01 +9.7800e-01 3.0000e+00
++3.7800e-01 +9.8200e-01 3.0000e+00
++3.8200e-01 +9.8200e-01 3.0000e+00
++3.9800e-01 +9.7800e-01 3.0000e+00
++4.0200e-01 +9.7800e-01 3.0000e+00
++3.9800e-01 +9.8200e-01 3.0000e+00
++4.0200e-01 +9.8200e-01 3.0000e+00
++4.1800e-01 +9.7800e-01 3.0000e+00
++4.2200e-01 +9.7800e-01 3.0000e+00
++4.1800e-01 +9.8200e-01 3.0000e+00
++4.2200e-01 +9.8200e-01 3.0000e+00
++4.3800e-01 +9.7800e-01 3.0000e+00
++4.4200e-01 +9.7800e-01 3.0000e+00
++4.3800e-01 +9.8200e-01 3.0000e+00
++4.4200e-01 +9.8200e-01 3.0000e+00
++4.5800e-01 +9.7800e-01 3.0000e+00
++4.6200e-01 +9.7800e-01 3.0000e+00
++4.5800e-01 +9.8200e-01 3.0000e+00
++4.6200e-01 +9.8200e-01 3.0000e+00
++4.7800e-01 +9.7800e-01 3.0000e+00
++4.8200e-01 +9.7800e-01 3.0000e+00
++4.7800e-01 +9.8200e-01 3.0000e+00
++4.8200e-01 +9.8200e-01 3.0000e+00
++4.9800e-01 +9.7800e-01 3.0000e+00
++5.0200e-01 +9.7800e-01 3.0000e+00
++4.9800e-01 +9.8200e-01 3.0000e+00
++5.0200e-01 +9.8200e-01 3.0000e+00
++5.1800e-01 +9.7800e-01 3.0000e+00
++5.2200e-01 +9.7800e-01 3.0000e+00
++5.1800e-01 +9.8200e-01 3.0000e+00
++5.2200e-01 +9.8200e-01 3.0000e+00
++5.3800e-01 +9.7800e-01 3.0000e+00
++5.4200e-01 +9.7800e-01 3.0000e+00
++5.3800e-01 +9.8200e-01 3.0000e+00
++5.4200e-01 +9.8200e-01 3.0000e+00
++5.5800e-01 +9.7800e-01 3.0000e+00
++5.6200e-01 +9.7800e-01 3.0000e+00
++5.5800e-01 +9.8200e-01 3.0000e+00
++5.6200e-01 +9.8200e-01 3.0000e+00
++5.7800e-01 +9.7800e-01 3.0000e+00
++5.8200e-01 +9.7800e-01 3.0000e+00
++5.7800e-01 +9.8200e-01 3.0000e+00
++5.8200e-01 +9.8200e-01 3.0000e+00
++5.9800e-01 +9.7800e-01 3.0000e+00
++6.0200e-01 +9.7800e-01 3.0000e+00
++5.9800e-01 +9.8200e-01 3.0000e+00
++6.0200e-01 +9.8200e-01 3.0000e+00
++6.1800e-01 +9.7800e-01 3.0000e+00
++6.2200e-01 +9.7800e-01 3.0000e+00
++6.1800e-01 +9.8200e-01 3.0000e+00
++6.2200e-01 +9.8200e-01 3.0000e+00
++6.3800e-01 +9.7800e-01 3.0000e+00
++6.4200e-01 +9.7800e-01 3.0000e+00
++6.3800e-01 +9.8200e-01 3.0000e+00
++6.4200e-01 +9.8200e-01 3.0000e+00
++6.5800e-01 +9.7800e-01 3.0000e+00
++6.6200e-01 +9.7800e-01 3.0000e+00
++6.5800e-01 +9.8200e-01 3.0000e+00
++6.6200e-01 +9.8200e-01 3.0000e+00
++6.7800e-01 +9.7800e-01 3.0000e+00
++6.8200e-01 +9.7800e-01 3.0000e+00
++6.7800e-01 +9.8200e-01 3.0000e+00
++6.8200e-01 +9.8200e-01 3.0000e+00
++6.9800e-01 +9.7800e-01 3.0000e+00
++7.0200e-01 +9.7800e-01 3.0000e+00
++6.9800e-01 +9.8200e-01 3.0000e+00
++7.0200e-01 +9.8200e-01 3.0000e+00
++7.1800e-01 +9.7800e-01 3.0000e+00
++7.2200e-01 +9.7800e-01 3.0000e+00
++7.1800e-01 +9.8200e-01 3.0000e+00
++7.2200e-01 +9.8200e-01 3.0000e+00
++7.3800e-01 +9.7800e-01 3.0000e+00
++7.4200e-01 +9.7800e-01 3.0000e+00
++7.3800e-01 +9.8200e-01 3.0000e+00
++7.4200e-01 +9.8200e-01 3.0000e+00
++7.5800e-01 +9.7800e-01 3.0000e+00
++7.6200e-01 +9.7800e-01 3.0000e+00
++7.5800e-01 +9.8200e-01 3.0000e+00
++7.6200e-01 +9.8200e-01 3.0000e+00
++7.7800e-01 +9.7800e-01 3.0000e+00
++7.8200e-01 +9.7800e-01 3.0000e+00
++7.7800e-01 +9.8200e-01 3.0000e+00
++7.8200e-01 +9.8200e-01 3.0000e+00
++7.9800e-01 +9.7800e-01 3.0000e+00
++8.0200e-01 +9.7800e-01 3.0000e+00
++7.9800e-01 +9.8200e-01 3.0000e+00
++8.0200e-01 +9.8200e-01 3.0000e+00
++8.1800e-01 +9.7800e-01 3.0000e+00
++8.2200e-01 +9.7800e-01 3.0000e+00
++8.1800e-01 +9.8200e-01 3.0000e+00
++8.2200e-01 +9.8200e-01 3.0000e+00
++8.3800e-01 +9.7800e-01 3.0000e+00
++8.4200e-01 +9.7800e-01 3.0000e+00
++8.3800e-01 +9.8200e-01 3.0000e+00
++8.4200e-01 +9.8200e-01 3.0000e+00
++8.5800e-01 +9.7800e-01 3.0000e+00
++8.6200e-01 +9.7800e-01 3.0000e+00
++8.5800e-01 +9.8200e-01 3.0000e+00
++8.6200e-01 +9.8200e-01 3.0000e+00
++8.7800e-01 +9.7800e-01 3.0000e+00
++8.8200e-01 +9.7800e-01 3.0000e+00
++8.7800e-01 +9.8200e-01 3.0000e+00
++8.8200e-01 +9.8200e-01 3.0000e+00
++8.9800e-01 +9.7800e-01 3.0000e+00
++9.0200e-01 +9.7800e-01 3.0000e+00
++8.9800e-01 +9.8200e-01 3.0000e+00
++9.0200e-01 +9.8200e-01 3.0000e+00
++9.1800e-01 +9.7800e-01 3.0000e+00
++9.2200e-01 +9.7800e-01 3.0000e+00
++9.1800e-01 +9.8200e-01 3.0000e+00
++9.2200e-01 +9.8200e-01 3.0000e+00
++9.3800e-01 +9.7800e-01 3.0000e+00
++9.4200e-01 +9.7800e-01 3.0000e+00
++9.3800e-01 +9.8200e-01 3.0000e+00
++9.4200e-01 +9.8200e-01 3.0000e+00
++9.5800e-01 +9.7800e-01 3.0000e+00
++9.6200e-01 +9.7800e-01 3.0000e+00
++9.5800e-01 +9.8200e-01 3.0000e+00
++9.6200e-01 +9.8200e-01 3.0000e+00
++9.7800e-01 +9.7800e-01 3.0000e+00
++9.8200e-01 +9.7800e-01 3.0000e+00
++9.7800e-01 +9.8200e-01 3.0000e+00
++9.8200e-01 +9.8200e-01 3.0000e+00
++9.9800e-01 +9.7800e-01 3.0000e+00
++1.0020e+00 +9.7800e-01 3.0000e+00
++9.9800e-01 +9.8200e-01 3.0000e+00
++1.0020e+00 +9.8200e-01 3.0000e+00
++1.8000e-02 +9.9800e-01 3.0000e+00
++2.2000e-02 +9.9800e-01 3.0000e+00
++1.8000e-02 +1.0020e+00 3.0000e+00
++2.2000e-02 +1.0020e+00 3.0000e+00
++3.8000e-02 +9.9800e-01 3.0000e+00
++4.2000e-02 +9.9800e-01 3.0000e+00
++3.8000e-02 +1.0020e+00 3.0000e+00
++4.2000e-02 +1.0020e+00 3.0000e+00
++5.8000e-02 +9.9800e-01 3.0000e+00
++6.2000e-02 +9.9800e-01 3.0000e+00
++5.8000e-02 +1.0020e+00 3.0000e+00
++6.2000e-02 +1.0020e+00 3.0000e+00
++7.8000e-02 +9.9800e-01 3.0000e+00
++8.2000e-02 +9.9800e-01 3.0000e+00
++7.8000e-02 +1.0020e+00 3.0000e+00
++8.2000e-02 +1.0020e+00 3.0000e+00
++9.8000e-02 +9.9800e-01 3.0000e+00
++1.0200e-01 +9.9800e-01 3.0000e+00
++9.8000e-02 +1.0020e+00 3.0000e+00
++1.0200e-01 +1.0020e+00 3.0000e+00
++1.1800e-01 +9.9800e-01 3.0000e+00
++1.2200e-01 +9.9800e-01 3.0000e+00
++1.1800e-01 +1.0020e+00 3.0000e+00
++1.2200e-01 +1.0020e+00 3.0000e+00
++1.3800e-01 +9.9800e-01 3.0000e+00
++1.4200e-01 +9.9800e-01 3.0000e+00
++1.3800e-01 +1.0020e+00 3.0000e+00
++1.4200e-01 +1.0020e+00 3.0000e+00
++1.5800e-01 +9.9800e-01 3.0000e+00
++1.6200e-01 +9.9800e-01 3.0000e+00
++1.5800e-01 +1.0020e+00 3.0000e+00
++1.6200e-01 +1.0020e+00 3.0000e+00
++1.7800e-01 +9.9800e-01 3.0000e+00
++1.8200e-01 +9.9800e-01 3.0000e+00
++1.7800e-01 +1.0020e+00 3.0000e+00
++1.8200e-01 +1.0020e+00 3.0000e+00
++1.9800e-01 +9.9800e-01 3.0000e+00
++2.0200e-01 +9.9800e-01 3.0000e+00
++1.9800e-01 +1.0020e+00 3.0000e+00
++2.0200e-01 +1.0020e+00 3.0000e+00
++2.1800e-01 +9.9800e-01 3.0000e+00
++2.2200e-01 +9.9800e-01 3.0000e+00
++2.1800e-01 +1.0020e+00 3.0000e+00
++2.2200e-01 +1.0020e+00 3.0000e+00
++2.3800e-01 +9.9800e-01 3.0000e+00
++2.4200e-01 +9.9800e-01 3.0000e+00
++2.3800e-01 +1.0020e+00 3.0000e+00
++2.4200e-01 +1.0020e+00 3.0000e+00
++2.5800e-01 +9.9800e-01 3.0000e+00
++2.6200e-01 +9.9800e-01 3.0000e+00
++2.5800e-01 +1.0020e+00 3.0000e+00
++2.6200e-01 +1.0020e+00 3.0000e+00
++2.7800e-01 +9.9800e-01 3.0000e+00
++2.8200e-01 +9.9800e-01 3.0000e+00
++2.7800e-01 +1.0020e+00 3.0000e+00
++2.8200e-01 +1.0020e+00 3.0000e+00
++2.9800e-01 +9.9800e-01 3.0000e+00
++3.0200e-01 +9.9800e-01 3.0000e+00
++2.9800e-01 +1.0020e+00 3.0000e+00
++3.0200e-01 +1.0020e+00 3.0000e+00
++3.1800e-01 +9.9800e-01 3.0000e+00
++3.2200e-01 +9.9800e-01 3.0000e+00
++3.1800e-01 +1.0020e+00 3.0000e+00
++3.2200e-01 +1.0020e+00 3.0000e+00
++3.3800e-01 +9.9800e-01 3.0000e+00
++3.4200e-01 +9.9800e-01 3.0000e+00
++3.3800e-01 +1.0020e+00 3.0000e+00
++3.4200e-01 +1.0020e+00 3.0000e+00
++3.5800e-01 +9.9800e-01 3.0000e+00
++3.6200e-01 +9.9800e-01 3.0000e+00
++3.5800e-01 +1.0020e+00 3.0000e+00
++3.6200e-01 +1.0020e+00 3.0000e+00
++3.7800e-01 +9.9800e-01 3.0000e+00
++3.8200e-01 +9.9800e-01 3.0000e+00
++3.7800e-01 +1.0020e+00 3.0000e+00
++3.8200e-01 +1.0020e+00 3.0000e+00
++3.9800e-01 +9.9800e-01 3.0000e+00
++4.0200e-01 +9.9800e-01 3.0000e+00
++3.9800e-01 +1.0020e+00 3.0000e+00
++4.0200e-01 +1.0020e+00 3.0000e+00
++4.1800e-01 +9.9800e-01 3.0000e+00
++4.2200e-01 +9.9800e-01 3.0000e+00
++4.1800e-01 +1.0020e+00 3.0000e+00
++4.2200e-01 +1.0020e+00 3.0000e+00
++4.3800e-01 +9.9800e-01 3.0000e+00
++4.4200e-01 +9.9800e-01 3.0000e+00
++4.3800e-01 +1.0020e+00 3.0000e+00
++4.4200e-01 +1.0020e+00 3.0000e+00
++4.5800e-01 +9.9800e-01 3.0000e+00
++4.6200e-01 +9.9800e-01 3.0000e+00
++4.5800e-01 +1.0020e+00 3.0000e+00
++4.6200e-01 +1.0020e+00 3.0000e+00
++4.7800e-01 +9.9800e-01 3.0000e+00
++4.8200e-01 +9.9800e-01 3.0000e+00
++4.7800e-01 +1.0020e+00 3.0000e+00
++4.8200e-01 +1.0020e+00 3.0000e+00
++4.9800e-01 +9.9800e-01 3.0000e+00
++5.0200e-01 +9.9800e-01 3.0000e+00
++4.9800e-01 +1.0020e+00 3.0000e+00
++5.0200e-01 +1.0020e+00 3.0000e+00
++5.1800e-01 +9.9800e-01 3.0000e+00
++5.2200e-01 +9.9800e-01 3.0000e+00
++5.1800e-01 +1.0020e+00 3.0000e+00
++5.2200e-01 +1.0020e+00 3.0000e+00
++5.3800e-01 +9.9800e-01 3.0000e+00
++5.4200e-01 +9.9800e-01 3.0000e+00
++5.3800e-01 +1.0020e+00 3.0000e+00
++5.4200e-01 +1.0020e+00 3.0000e+00
++5.5800e-01 +9.9800e-01 3.0000e+00
++5.6200e-01 +9.9800e-01 3.0000e+00
++5.5800e-01 +1.0020e+00 3.0000e+00
++5.6200e-01 +1.0020e+00 3.0000e+00
++5.7800e-01 +9.9800e-01 3.0000e+00
++5.8200e-01 +9.9800e-01 3.0000e+00
++5.7800e-01 +1.0020e+00 3.0000e+00
++5.8200e-01 +1.0020e+00 3.0000e+00
++5.9800e-01 +9.9800e-01 3.0000e+00
++6.0200e-01 +9.9800e-01 3.0000e+00
++5.9800e-01 +1.0020e+00 3.0000e+00
++6.0200e-01 +1.0020e+00 3.0000e+00
++6.1800e-01 +9.9800e-01 3.0000e+00
++6.2200e-01 +9.9800e-01 3.0000e+00
++6.1800e-01 +1.0020e+00 3.0000e+00
++6.2200e-01 +1.0020e+00 3.0000e+00
++6.3800e-01 +9.9800e-01 3.0000e+00
++6.4200e-01 +9.9800e-01 3.0000e+00
++6.3800e-01 +1.0020e+00 3.0000e+00
++6.4200e-01 +1.0020e+00 3.0000e+00
++6.5800e-01 +9.9800e-01 3.0000e+00
++6.6200e-01 +9.9800e-01 3.0000e+00
++6.5800e-01 +1.0020e+00 3.0000e+00
++6.6200e-01 +1.0020e+00 3.0000e+00
++6.7800e-01 +9.9800e-01 3.0000e+00
++6.8200e-01 +9.9800e-01 3.0000e+00
++6.7800e-01 +1.0020e+00 3.0000e+00
++6.8200e-01 +1.0020e+00 3.0000e+00
++6.9800e-01 +9.9800e-01 3.0000e+00
++7.0200e-01 +9.9800e-01 3.0000e+00
++6.9800e-01 +1.0020e+00 3.0000e+00
++7.0200e-01 +1.0020e+00 3.0000e+00
++7.1800e-01 +9.9800e-01 3.0000e+00
++7.2200e-01 +9.9800e-01 3.0000e+00
++7.1800e-01 +1.0020e+00 3.0000e+00
++7.2200e-01 +1.0020e+00 3.0000e+00
++7.3800e-01 +9.9800e-01 3.0000e+00
++7.4200e-01 +9.9800e-01 3.0000e+00
++7.3800e-01 +1.0020e+00 3.0000e+00
++7.4200e-01 +1.0020e+00 3.0000e+00
++7.5800e-01 +9.9800e-01 3.0000e+00
++7.6200e-01 +9.9800e-01 3.0000e+00
++7.5800e-01 +1.0020e+00 3.0000e+00
++7.6200e-01 +1.0020e+00 3.0000e+00
++7.7800e-01 +9.9800e-01 3.0000e+00
++7.8200e-01 +9.9800e-01 3.0000e+00
++7.7800e-01 +1.0020e+00 3.0000e+00
++7.8200e-01 +1.0020e+00 3.0000e+00
++7.9800e-01 +9.9800e-01 3.0000e+00
++8.0200e-01 +9.9800e-01 3.0000e+00
++7.9800e-01 +1.0020e+00 3.0000e+00
++8.0200e-01 +1.0020e+00 3.0000e+00
++8.1800e-01 +9.9800e-01 3.0000e+00
++8.2200e-01 +9.9800e-01 3.0000e+00
++8.1800e-01 +1.0020e+00 3.0000e+00
++8.2200e-01 +1.0020e+00 3.0000e+00
++8.3800e-01 +9.9800e-01 3.0000e+00
++8.4200e-01 +9.9800e-01 3.0000e+00
++8.3800e-01 +1.0020e+00 3.0000e+00
++8.4200e-01 +1.0020e+00 3.0000e+00
++8.5800e-01 +9.9800e-01 3.0000e+00
++8.6200e-01 +9.9800e-01 3.0000e+00
++8.5800e-01 +1.0020e+00 3.0000e+00
++8.6200e-01 +1.0020e+00 3.0000e+00
++8.7800e-01 +9.9800e-01 3.0000e+00
++8.8200e-01 +9.9800e-01 3.0000e+00
++8.7800e-01 +1.0020e+00 3.0000e+00
++8.8200e-01 +1.0020e+00 3.0000e+00
++8.9800e-01 +9.9800e-01 3.0000e+00
++9.0200e-01 +9.9800e-01 3.0000e+00
++8.9800e-01 +1.0020e+00 3.0000e+00
++9.0200e-01 +1.0020e+00 3.0000e+00
++9.1800e-01 +9.9800e-01 3.0000e+00
++9.2200e-01 +9.9800e-01 3.0000e+00
++9.1800e-01 +1.0020e+00 3.0000e+00
++9.2200e-01 +1.0020e+00 3.0000e+00
++9.3800e-01 +9.9800e-01 3.0000e+00
++9.4200e-01 +9.9800e-01 3.0000e+00
++9.3800e-01 +1.0020e+00 3.0000e+00
++9.4200e-01 +1.0020e+00 3.0000e+00
++9.5800e-01 +9.9800e-01 3.0000e+00
++9.6200e-01 +9.9800e-01 3.0000e+00
++9.5800e-01 +1.0020e+00 3.0000e+00
++9.6200e-01 +1.0020e+00 3.0000e+00
++9.7800e-01 +9.9800e-01 3.0000e+00
++9.8200e-01 +9.9800e-01 3.0000e+00
++9.7800e-01 +1.0020e+00 3.0000e+00
++9.8200e-01 +1.0020e+00 3.0000e+00
++9.9800e-01 +9.9800e-01 3.0000e+00
++1.0020e+00 +9.9800e-01 3.0000e+00
++9.9800e-01 +1.0020e+00 3.0000e+00
++1.0020e+00 +1.0020e+00 3.0000e+00
+-5.1800e-01 -5.9800e-01 3.0000e+00
+-5.0200e-01 -5.9800e-01 3.0000e+00
+-4.9800e-01 -5.9800e-01 3.0000e+00
+-4.8200e-01 -5.9800e-01 3.0000e+00
+-5.6200e-01 -5.7800e-01 3.0000e+00
+-5.5800e-01 -5.7800e-01 3.0000e+00
+-5.4200e-01 -5.8200e-01 3.0000e+00
+-5.3800e-01 -5.8200e-01 3.0000e+00
+-5.4200e-01 -5.7800e-01 3.0000e+00
+-5.3800e-01 -5.7800e-01 3.0000e+00
+-5.2200e-01 -5.8200e-01 3.0000e+00
+-5.1800e-01 -5.8200e-01 3.0000e+00
+-5.2200e-01 -5.7800e-01 3.0000e+00
+-5.1800e-01 -5.7800e-01 3.0000e+00
+-5.0200e-01 -5.8200e-01 3.0000e+00
+-4.9800e-01 -5.8200e-01 3.0000e+00
+-5.0200e-01 -5.7800e-01 3.0000e+00
+-4.9800e-01 -5.7800e-01 3.0000e+00
+-4.8200e-01 -5.8200e-01 3.0000e+00
+-4.7800e-01 -5.8200e-01 3.0000e+00
+-4.8200e-01 -5.7800e-01 3.0000e+00
+-4.7800e-01 -5.7800e-01 3.0000e+00
+-4.6200e-01 -5.8200e-01 3.0000e+00
+-4.5800e-01 -5.8200e-01 3.0000e+00
+-4.6200e-01 -5.7800e-01 3.0000e+00
+-4.5800e-01 -5.7800e-01 3.0000e+00
+-4.4200e-01 -5.7800e-01 3.0000e+00
+-4.3800e-01 -5.7800e-01 3.0000e+00
+-5.7800e-01 -5.6200e-01 3.0000e+00
+-5.7800e-01 -5.5800e-01 3.0000e+00
+-5.6200e-01 -5.6200e-01 3.0000e+00
+-5.5800e-01 -5.6200e-01 3.0000e+00
+-5.6200e-01 -5.5800e-01 3.0000e+00
+-5.5800e-01 -5.5800e-01 3.0000e+00
+-5.4200e-01 -5.6200e-01 3.0000e+00
+-5.3800e-01 -5.6200e-01 3.0000e+00
+-5.4200e-01 -5.5800e-01 3.0000e+00
+-5.3800e-01 -5.5800e-01 3.0000e+00
+-5.2200e-01 -5.6200e-01 3.0000e+00
+-5.1800e-01 -5.6200e-01 3.0000e+00
+-5.2200e-01 -5.5800e-01 3.0000e+00
+-5.1800e-01 -5.5800e-01 3.0000e+00
+-5.0200e-01 -5.6200e-01 3.0000e+00
+-4.9800e-01 -5.6200e-01 3.0000e+00
+-5.0200e-01 -5.5800e-01 3.0000e+00
+-4.9800e-01 -5.5800e-01 3.0000e+00
+-4.8200e-01 -5.6200e-01 3.0000e+00
+-4.7800e-01 -5.6200e-01 3.0000e+00
+-4.8200e-01 -5.5800e-01 3.0000e+00
+-4.7800e-01 -5.5800e-01 3.0000e+00
+-4.6200e-01 -5.6200e-01 3.0000e+00
+-4.5800e-01 -5.6200e-01 3.0000e+00
+-4.6200e-01 -5.5800e-01 3.0000e+00
+-4.5800e-01 -5.5800e-01 3.0000e+00
+-4.4200e-01 -5.6200e-01 3.0000e+00
+-4.3800e-01 -5.6200e-01 3.0000e+00
+-4.4200e-01 -5.5800e-01 3.0000e+00
+-4.3800e-01 -5.5800e-01 3.0000e+00
+-4.2200e-01 -5.6200e-01 3.0000e+00
+-4.2200e-01 -5.5800e-01 3.0000e+00
+-5.8200e-01 -5.4200e-01 3.0000e+00
+-5.7800e-01 -5.4200e-01 3.0000e+00
+-5.8200e-01 -5.3800e-01 3.0000e+00
+-5.7800e-01 -5.3800e-01 3.0000e+00
+-5.6200e-01 -5.4200e-01 3.0000e+00
+-5.5800e-01 -5.4200e-01 3.0000e+00
+-5.6200e-01 -5.3800e-01 3.0000e+00
+-5.5800e-01 -5.3800e-01 3.0000e+00
+-5.4200e-01 -5.4200e-01 3.0000e+00
+-5.3800e-01 -5.4200e-01 3.0000e+00
+-5.4200e-01 -5.3800e-01 3.0000e+00
+-5.3800e-01 -5.3800e-01 3.0000e+00
+-5.2200e-01 -5.4200e-01 3.0000e+00
+-5.1800e-01 -5.4200e-01 3.0000e+00
+-5.2200e-01 -5.3800e-01 3.0000e+00
+-5.1800e-01 -5.3800e-01 3.0000e+00
+-5.0200e-01 -5.4200e-01 3.0000e+00
+-4.9800e-01 -5.4200e-01 3.0000e+00
+-5.0200e-01 -5.3800e-01 3.0000e+00
+-4.9800e-01 -5.3800e-01 3.0000e+00
+-4.8200e-01 -5.4200e-01 3.0000e+00
+-4.7800e-01 -5.4200e-01 3.0000e+00
+-4.8200e-01 -5.3800e-01 3.0000e+00
+-4.7800e-01 -5.3800e-01 3.0000e+00
+-4.6200e-01 -5.4200e-01 3.0000e+00
+-4.5800e-01 -5.4200e-01 3.0000e+00
+-4.6200e-01 -5.3800e-01 3.0000e+00
+-4.5800e-01 -5.3800e-01 3.0000e+00
+-4.4200e-01 -5.4200e-01 3.0000e+00
+-4.3800e-01 -5.4200e-01 3.0000e+00
+-4.4200e-01 -5.3800e-01 3.0000e+00
+-4.3800e-01 -5.3800e-01 3.0000e+00
+-4.2200e-01 -5.4200e-01 3.0000e+00
+-4.1800e-01 -5.4200e-01 3.0000e+00
+-4.2200e-01 -5.3800e-01 3.0000e+00
+-4.1800e-01 -5.3800e-01 3.0000e+00
+-5.9800e-01 -5.1800e-01 3.0000e+00
+-5.8200e-01 -5.2200e-01 3.0000e+00
+-5.7800e-01 -5.2200e-01 3.0000e+00
+-5.8200e-01 -5.1800e-01 3.0000e+00
+-5.7800e-01 -5.1800e-01 3.0000e+00
+-5.6200e-01 -5.2200e-01 3.0000e+00
+-5.5800e-01 -5.2200e-01 3.0000e+00
+-5.6200e-01 -5.1800e-01 3.0000e+00
+-5.5800e-01 -5.1800e-01 3.0000e+00
+-5.4200e-01 -5.2200e-01 3.0000e+00
+-5.3800e-01 -5.2200e-01 3.0000e+00
+-5.4200e-01 -5.1800e-01 3.0000e+00
+-5.3800e-01 -5.1800e-01 3.0000e+00
+-5.2200e-01 -5.2200e-01 3.0000e+00
+-5.1800e-01 -5.2200e-01 3.0000e+00
+-5.2200e-01 -5.1800e-01 3.0000e+00
+-5.1800e-01 -5.1800e-01 3.0000e+00
+-5.0200e-01 -5.2200e-01 3.0000e+00
+-4.9800e-01 -5.2200e-01 3.0000e+00
+-5.0200e-01 -5.1800e-01 3.0000e+00
+-4.9800e-01 -5.1800e-01 3.0000e+00
+-4.8200e-01 -5.2200e-01 3.0000e+00
+-4.7800e-01 -5.2200e-01 3.0000e+00
+-4.8200e-01 -5.1800e-01 3.0000e+00
+-4.7800e-01 -5.1800e-01 3.0000e+00
+-4.6200e-01 -5.2200e-01 3.0000e+00
+-4.5800e-01 -5.2200e-01 3.0000e+00
+-4.6200e-01 -5.1800e-01 3.0000e+00
+-4.5800e-01 -5.1800e-01 3.0000e+00
+-4.4200e-01 -5.2200e-01 3.0000e+00
+-4.3800e-01 -5.2200e-01 3.0000e+00
+-4.4200e-01 -5.1800e-01 3.0000e+00
+-4.3800e-01 -5.1800e-01 3.0000e+00
+-4.2200e-01 -5.2200e-01 3.0000e+00
+-4.1800e-01 -5.2200e-01 3.0000e+00
+-4.2200e-01 -5.1800e-01 3.0000e+00
+-4.1800e-01 -5.1800e-01 3.0000e+00
+-4.0200e-01 -5.1800e-01 3.0000e+00
+-5.9800e-01 -5.0200e-01 3.0000e+00
+-5.9800e-01 -4.9800e-01 3.0000e+00
+-5.8200e-01 -5.0200e-01 3.0000e+00
+-5.7800e-01 -5.0200e-01 3.0000e+00
+-5.8200e-01 -4.9800e-01 3.0000e+00
+-5.7800e-01 -4.9800e-01 3.0000e+00
+-5.6200e-01 -5.0200e-01 3.0000e+00
+-5.5800e-01 -5.0200e-01 3.0000e+00
+-5.6200e-01 -4.9800e-01 3.0000e+00
+-5.5800e-01 -4.9800e-01 3.0000e+00
+-5.4200e-01 -5.0200e-01 3.0000e+00
+-5.3800e-01 -5.0200e-01 3.0000e+00
+-5.4200e-01 -4.9800e-01 3.0000e+00
+-5.3800e-01 -4.9800e-01 3.0000e+00
+-5.2200e-01 -5.0200e-01 3.0000e+00
+-5.1800e-01 -5.0200e-01 3.0000e+00
+-5.2200e-01 -4.9800e-01 3.0000e+00
+-5.1800e-01 -4.9800e-01 3.0000e+00
+-5.0200e-01 -5.0200e-01 3.0000e+00
+-4.9800e-01 -5.0200e-01 3.0000e+00
+-5.0200e-01 -4.9800e-01 3.0000e+00
+-4.9800e-01 -4.9800e-01 3.0000e+00
+-4.8200e-01 -5.0200e-01 3.0000e+00
+-4.7800e-01 -5.0200e-01 3.0000e+00
+-4.8200e-01 -4.9800e-01 3.0000e+00
+-4.7800e-01 -4.9800e-01 3.0000e+00
+-4.6200e-01 -5.0200e-01 3.0000e+00
+-4.5800e-01 -5.0200e-01 3.0000e+00
+-4.6200e-01 -4.9800e-01 3.0000e+00
+-4.5800e-01 -4.9800e-01 3.0000e+00
+-4.4200e-01 -5.0200e-01 3.0000e+00
+-4.3800e-01 -5.0200e-01 3.0000e+00
+-4.4200e-01 -4.9800e-01 3.0000e+00
+-4.3800e-01 -4.9800e-01 3.0000e+00
+-4.2200e-01 -5.0200e-01 3.0000e+00
+-4.1800e-01 -5.0200e-01 3.0000e+00
+-4.2200e-01 -4.9800e-01 3.0000e+00
+-4.1800e-01 -4.9800e-01 3.0000e+00
+-4.0200e-01 -5.0200e-01 3.0000e+00
+-4.0200e-01 -4.9800e-01 3.0000e+00
+-5.9800e-01 -4.8200e-01 3.0000e+00
+-5.8200e-01 -4.8200e-01 3.0000e+00
+-5.7800e-01 -4.8200e-01 3.0000e+00
+-5.8200e-01 -4.7800e-01 3.0000e+00
+-5.7800e-01 -4.7800e-01 3.0000e+00
+-5.6200e-01 -4.8200e-01 3.0000e+00
+-5.5800e-01 -4.8200e-01 3.0000e+00
+-5.6200e-01 -4.7800e-01 3.0000e+00
+-5.5800e-01 -4.7800e-01 3.0000e+00
+-5.4200e-01 -4.8200e-01 3.0000e+00
+-5.3800e-01 -4.8200e-01 3.0000e+00
+-5.4200e-01 -4.7800e-01 3.0000e+00
+-5.3800e-01 -4.7800e-01 3.0000e+00
+-5.2200e-01 -4.8200e-01 3.0000e+00
+-5.1800e-01 -4.8200e-01 3.0000e+00
+-5.2200e-01 -4.7800e-01 3.0000e+00
+-5.1800e-01 -4.7800e-01 3.0000e+00
+-5.0200e-01 -4.8200e-01 3.0000e+00
+-4.9800e-01 -4.8200e-01 3.0000e+00
+-5.0200e-01 -4.7800e-01 3.0000e+00
+-4.9800e-01 -4.7800e-01 3.0000e+00
+-4.8200e-01 -4.8200e-01 3.0000e+00
+-4.7800e-01 -4.8200e-01 3.0000e+00
+-4.8200e-01 -4.7800e-01 3.0000e+00
+-4.7800e-01 -4.7800e-01 3.0000e+00
+-4.6200e-01 -4.8200e-01 3.0000e+00
+-4.5800e-01 -4.8200e-01 3.0000e+00
+-4.6200e-01 -4.7800e-01 3.0000e+00
+-4.5800e-01 -4.7800e-01 3.0000e+00
+-4.4200e-01 -4.8200e-01 3.0000e+00
+-4.3800e-01 -4.8200e-01 3.0000e+00
+-4.4200e-01 -4.7800e-01 3.0000e+00
+-4.3800e-01 -4.7800e-01 3.0000e+00
+-4.2200e-01 -4.8200e-01 3.0000e+00
+-4.1800e-01 -4.8200e-01 3.0000e+00
+-4.2200e-01 -4.7800e-01 3.0000e+00
+-4.1800e-01 -4.7800e-01 3.0000e+00
+-4.0200e-01 -4.8200e-01 3.0000e+00
+-5.8200e-01 -4.6200e-01 3.0000e+00
+-5.7800e-01 -4.6200e-01 3.0000e+00
+-5.8200e-01 -4.5800e-01 3.0000e+00
+-5.7800e-01 -4.5800e-01 3.0000e+00
+-5.6200e-01 -4.6200e-01 3.0000e+00
+-5.5800e-01 -4.6200e-01 3.0000e+00
+-5.6200e-01 -4.5800e-01 3.0000e+00
+-5.5800e-01 -4.5800e-01 3.0000e+00
+-5.4200e-01 -4.6200e-01 3.0000e+00
+-5.3800e-01 -4.6200e-01 3.0000e+00
+-5.4200e-01 -4.5800e-01 3.0000e+00
+-5.3800e-01 -4.5800e-01 3.0000e+00
+-5.2200e-01 -4.6200e-01 3.0000e+00
+-5.1800e-01 -4.6200e-01 3.0000e+00
+-5.2200e-01 -4.5800e-01 3.0000e+00
+-5.1800e-01 -4.5800e-01 3.0000e+00
+-5.0200e-01 -4.6200e-01 3.0000e+00
+-4.9800e-01 -4.6200e-01 3.0000e+00
+-5.0200e-01 -4.5800e-01 3.0000e+00
+-4.9800e-01 -4.5800e-01 3.0000e+00
+-4.8200e-01 -4.6200e-01 3.0000e+00
+-4.7800e-01 -4.6200e-01 3.0000e+00
+-4.8200e-01 -4.5800e-01 3.0000e+00
+-4.7800e-01 -4.5800e-01 3.0000e+00
+-4.6200e-01 -4.6200e-01 3.0000e+00
+-4.5800e-01 -4.6200e-01 3.0000e+00
+-4.6200e-01 -4.5800e-01 3.0000e+00
+-4.5800e-01 -4.5800e-01 3.0000e+00
+-4.4200e-01 -4.6200e-01 3.0000e+00
+-4.3800e-01 -4.6200e-01 3.0000e+00
+-4.4200e-01 -4.5800e-01 3.0000e+00
+-4.3800e-01 -4.5800e-01 3.0000e+00
+-4.2200e-01 -4.6200e-01 3.0000e+00
+-4.1800e-01 -4.6200e-01 3.0000e+00
+-4.2200e-01 -4.5800e-01 3.0000e+00
+-4.1800e-01 -4.5800e-01 3.0000e+00
+-5.7800e-01 -4.4200e-01 3.0000e+00
+-5.7800e-01 -4.3800e-01 3.0000e+00
+-5.6200e-01 -4.4200e-01 3.0000e+00
+-5.5800e-01 -4.4200e-01 3.0000e+00
+-5.6200e-01 -4.3800e-01 3.0000e+00
+-5.5800e-01 -4.3800e-01 3.0000e+00
+-5.4200e-01 -4.4200e-01 3.0000e+00
+-5.3800e-01 -4.4200e-01 3.0000e+00
+-5.4200e-01 -4.3800e-01 3.0000e+00
+-5.3800e-01 -4.3800e-01 3.0000e+00
+-5.2200e-01 -4.4200e-01 3.0000e+00
+-5.1800e-01 -4.4200e-01 3.0000e+00
+-5.2200e-01 -4.3800e-01 3.0000e+00
+-5.1800e-01 -4.3800e-01 3.0000e+00
+-5.0200e-01 -4.4200e-01 3.0000e+00
+-4.9800e-01 -4.4200e-01 3.0000e+00
+-5.0200e-01 -4.3800e-01 3.0000e+00
+-4.9800e-01 -4.3800e-01 3.0000e+00
+-4.8200e-01 -4.4200e-01 3.0000e+00
+-4.7800e-01 -4.4200e-01 3.0000e+00
+-4.8200e-01 -4.3800e-01 3.0000e+00
+-4.7800e-01 -4.3800e-01 3.0000e+00
+-4.6200e-01 -4.4200e-01 3.0000e+00
+-4.5800e-01 -4.4200e-01 3.0000e+00
+-4.6200e-01 -4.3800e-01 3.0000e+00
+-4.5800e-01 -4.3800e-01 3.0000e+00
+-4.4200e-01 -4.4200e-01 3.0000e+00
+-4.3800e-01 -4.4200e-01 3.0000e+00
+-4.4200e-01 -4.3800e-01 3.0000e+00
+-4.3800e-01 -4.3800e-01 3.0000e+00
+-4.2200e-01 -4.4200e-01 3.0000e+00
+-4.2200e-01 -4.3800e-01 3.0000e+00
+-5.6200e-01 -4.2200e-01 3.0000e+00
+-5.5800e-01 -4.2200e-01 3.0000e+00
+-5.4200e-01 -4.2200e-01 3.0000e+00
+-5.3800e-01 -4.2200e-01 3.0000e+00
+-5.4200e-01 -4.1800e-01 3.0000e+00
+-5.3800e-01 -4.1800e-01 3.0000e+00
+-5.2200e-01 -4.2200e-01 3.0000e+00
+-5.1800e-01 -4.2200e-01 3.0000e+00
+-5.2200e-01 -4.1800e-01 3.0000e+00
+-5.1800e-01 -4.1800e-01 3.0000e+00
+-5.0200e-01 -4.2200e-01 3.0000e+00
+-4.9800e-01 -4.2200e-01 3.0000e+00
+-5.0200e-01 -4.1800e-01 3.0000e+00
+-4.9800e-01 -4.1800e-01 3.0000e+00
+-4.8200e-01 -4.2200e-01 3.0000e+00
+-4.7800e-01 -4.2200e-01 3.0000e+00
+-4.8200e-01 -4.1800e-01 3.0000e+00
+-4.7800e-01 -4.1800e-01 3.0000e+00
+-4.6200e-01 -4.2200e-01 3.0000e+00
+-4.5800e-01 -4.2200e-01 3.0000e+00
+-4.6200e-01 -4.1800e-01 3.0000e+00
+-4.5800e-01 -4.1800e-01 3.0000e+00
+-4.4200e-01 -4.2200e-01 3.0000e+00
+-4.3800e-01 -4.2200e-01 3.0000e+00
+-5.1800e-01 -4.0200e-01 3.0000e+00
+-5.0200e-01 -4.0200e-01 3.0000e+00
+-4.9800e-01 -4.0200e-01 3.0000e+00
+-4.8200e-01 -4.0200e-01 3.0000e+00
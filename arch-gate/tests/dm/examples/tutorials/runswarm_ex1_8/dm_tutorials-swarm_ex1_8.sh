@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../swarm_ex1 -test_mode 4  2>&1 | cat > swarm_ex1_8.tmp
+cat swarm_ex1_8.tmp | grep -v atomic > swarm_ex1_8.tmp.tmp 2>> runswarm_ex1_8.err && mv swarm_ex1_8.tmp.tmp swarm_ex1_8.tmp
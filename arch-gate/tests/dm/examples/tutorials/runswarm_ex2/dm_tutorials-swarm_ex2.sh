@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../swarm_ex2   2>&1 | cat > swarm_ex2.tmp
+cat swarm_ex2.tmp | grep -v atomic > swarm_ex2.tmp.tmp 2>> runswarm_ex2.err && mv swarm_ex2.tmp.tmp swarm_ex2.tmp
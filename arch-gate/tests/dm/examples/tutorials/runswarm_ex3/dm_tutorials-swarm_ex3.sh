@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../swarm_ex3   2>&1 | cat > swarm_ex3.tmp
+cat swarm_ex3.tmp | grep -v atomic > swarm_ex3.tmp.tmp 2>> runswarm_ex3.err && mv swarm_ex3.tmp.tmp swarm_ex3.tmp
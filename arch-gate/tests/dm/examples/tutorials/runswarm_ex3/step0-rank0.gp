@@ -0,0 +1,711 @@
+-1.7771e-01 -7.2426e-01 0.0000e+00
+-1.2064e-01 -7.2212e-01 0.0000e+00
+-7.1433e-02 -7.2805e-01 0.0000e+00
+-2.2615e-02 -7.2396e-01 0.0000e+00
++2.0063e-02 -7.2859e-01 0.0000e+00
++7.9806e-02 -7.2738e-01 0.0000e+00
++1.2823e-01 -7.2904e-01 0.0000e+00
++1.7851e-01 -7.2355e-01 0.0000e+00
+-3.2470e-01 -6.7591e-01 0.0000e+00
+-2.7254e-01 -6.7938e-01 0.0000e+00
+-2.2118e-01 -6.7927e-01 0.0000e+00
+-1.7184e-01 -6.7857e-01 0.0000e+00
+-1.2384e-01 -6.7668e-01 0.0000e+00
+-7.8165e-02 -6.7936e-01 0.0000e+00
+-2.6077e-02 -6.7973e-01 0.0000e+00
++2.1481e-02 -6.7489e-01 0.0000e+00
++7.8378e-02 -6.7299e-01 0.0000e+00
++1.2097e-01 -6.7267e-01 0.0000e+00
++1.7578e-01 -6.7646e-01 0.0000e+00
++2.2996e-01 -6.7636e-01 0.0000e+00
++2.7593e-01 -6.7305e-01 0.0000e+00
+-3.7935e-01 -6.2998e-01 0.0000e+00
+-3.2125e-01 -6.2984e-01 0.0000e+00
+-2.7760e-01 -6.2158e-01 0.0000e+00
+-2.2578e-01 -6.2833e-01 0.0000e+00
+-1.7769e-01 -6.2662e-01 0.0000e+00
+-1.2260e-01 -6.2429e-01 0.0000e+00
+-7.0846e-02 -6.2498e-01 0.0000e+00
+-2.6201e-02 -6.2876e-01 0.0000e+00
++2.5892e-02 -6.2711e-01 0.0000e+00
++7.8198e-02 -6.2255e-01 0.0000e+00
++1.2715e-01 -6.2653e-01 0.0000e+00
++1.7601e-01 -6.2714e-01 0.0000e+00
++2.2393e-01 -6.2389e-01 0.0000e+00
++2.7539e-01 -6.2719e-01 0.0000e+00
++3.2594e-01 -6.2008e-01 0.0000e+00
++3.7530e-01 -6.2619e-01 0.0000e+00
+-4.7258e-01 -5.7858e-01 0.0000e+00
+-4.2242e-01 -5.7785e-01 0.0000e+00
+-3.7851e-01 -5.7643e-01 0.0000e+00
+-3.2425e-01 -5.7038e-01 0.0000e+00
+-2.7574e-01 -5.7146e-01 0.0000e+00
+-2.2627e-01 -5.7445e-01 0.0000e+00
+-1.7781e-01 -5.7534e-01 0.0000e+00
+-1.2469e-01 -5.7813e-01 0.0000e+00
+-7.5783e-02 -5.7699e-01 0.0000e+00
+-2.6294e-02 -5.7064e-01 0.0000e+00
++2.6388e-02 -5.7394e-01 0.0000e+00
++7.0571e-02 -5.7023e-01 0.0000e+00
++1.2513e-01 -5.7305e-01 0.0000e+00
++1.7116e-01 -5.7236e-01 0.0000e+00
++2.2567e-01 -5.7156e-01 0.0000e+00
++2.7598e-01 -5.7995e-01 0.0000e+00
++3.2874e-01 -5.7670e-01 0.0000e+00
++3.7875e-01 -5.7116e-01 0.0000e+00
++4.2244e-01 -5.7641e-01 0.0000e+00
++4.7248e-01 -5.7707e-01 0.0000e+00
+-5.2427e-01 -5.2135e-01 0.0000e+00
+-4.7351e-01 -5.2756e-01 0.0000e+00
+-4.2479e-01 -5.2030e-01 0.0000e+00
+-3.7733e-01 -5.2113e-01 0.0000e+00
+-3.2369e-01 -5.2168e-01 0.0000e+00
+-2.7403e-01 -5.2881e-01 0.0000e+00
+-2.2038e-01 -5.2823e-01 0.0000e+00
+-1.7673e-01 -5.2632e-01 0.0000e+00
+-1.2608e-01 -5.2983e-01 0.0000e+00
+-7.9471e-02 -5.2102e-01 0.0000e+00
+-2.1705e-02 -5.2534e-01 0.0000e+00
++2.9492e-02 -5.2914e-01 0.0000e+00
++7.7686e-02 -5.2851e-01 0.0000e+00
++1.2672e-01 -5.2750e-01 0.0000e+00
++1.7990e-01 -5.2506e-01 0.0000e+00
++2.2811e-01 -5.2472e-01 0.0000e+00
++2.7811e-01 -5.2641e-01 0.0000e+00
++3.2292e-01 -5.2636e-01 0.0000e+00
++3.7484e-01 -5.2663e-01 0.0000e+00
++4.2176e-01 -5.2631e-01 0.0000e+00
++4.7849e-01 -5.2597e-01 0.0000e+00
++5.2683e-01 -5.2849e-01 0.0000e+00
+-5.7636e-01 -4.7468e-01 0.0000e+00
+-5.2937e-01 -4.7202e-01 0.0000e+00
+-4.7610e-01 -4.7858e-01 0.0000e+00
+-4.2177e-01 -4.7505e-01 0.0000e+00
+-3.7056e-01 -4.7188e-01 0.0000e+00
+-3.2087e-01 -4.7548e-01 0.0000e+00
+-2.7912e-01 -4.7746e-01 0.0000e+00
+-2.2274e-01 -4.7895e-01 0.0000e+00
+-1.7666e-01 -4.7932e-01 0.0000e+00
+-1.2160e-01 -4.7130e-01 0.0000e+00
+-7.3545e-02 -4.7777e-01 0.0000e+00
+-2.2642e-02 -4.7419e-01 0.0000e+00
++2.4788e-02 -4.7985e-01 0.0000e+00
++7.6119e-02 -4.7256e-01 0.0000e+00
++1.2595e-01 -4.7947e-01 0.0000e+00
++1.7557e-01 -4.7589e-01 0.0000e+00
++2.2270e-01 -4.7525e-01 0.0000e+00
++2.7263e-01 -4.7338e-01 0.0000e+00
++3.2813e-01 -4.7903e-01 0.0000e+00
++3.7691e-01 -4.7890e-01 0.0000e+00
++4.2918e-01 -4.7063e-01 0.0000e+00
++4.7010e-01 -4.7344e-01 0.0000e+00
++5.2866e-01 -4.7117e-01 0.0000e+00
++5.7838e-01 -4.7429e-01 0.0000e+00
+-5.7645e-01 -4.2920e-01 0.0000e+00
+-5.2824e-01 -4.2385e-01 0.0000e+00
+-4.7571e-01 -4.2521e-01 0.0000e+00
+-4.2168e-01 -4.2853e-01 0.0000e+00
+-3.7878e-01 -4.2134e-01 0.0000e+00
+-3.2400e-01 -4.2352e-01 0.0000e+00
+-2.7772e-01 -4.2116e-01 0.0000e+00
+-2.2220e-01 -4.2125e-01 0.0000e+00
+-1.7519e-01 -4.2131e-01 0.0000e+00
+-1.2982e-01 -4.2823e-01 0.0000e+00
+-7.6486e-02 -4.2930e-01 0.0000e+00
+-2.1432e-02 -4.2626e-01 0.0000e+00
++2.5108e-02 -4.2735e-01 0.0000e+00
++7.8901e-02 -4.2597e-01 0.0000e+00
++1.2013e-01 -4.2051e-01 0.0000e+00
++1.7155e-01 -4.2227e-01 0.0000e+00
++2.2424e-01 -4.2560e-01 0.0000e+00
++2.7129e-01 -4.2959e-01 0.0000e+00
++3.2241e-01 -4.2203e-01 0.0000e+00
++3.7830e-01 -4.2190e-01 0.0000e+00
++4.2115e-01 -4.2345e-01 0.0000e+00
++4.7932e-01 -4.2488e-01 0.0000e+00
++5.2200e-01 -4.2994e-01 0.0000e+00
++5.7105e-01 -4.2405e-01 0.0000e+00
+-6.2615e-01 -3.7657e-01 0.0000e+00
+-5.7516e-01 -3.7660e-01 0.0000e+00
+-5.2329e-01 -3.7165e-01 0.0000e+00
+-4.7758e-01 -3.7345e-01 0.0000e+00
+-4.2978e-01 -3.7543e-01 0.0000e+00
+-3.7635e-01 -3.7722e-01 0.0000e+00
+-3.2072e-01 -3.7751e-01 0.0000e+00
+-2.7890e-01 -3.7556e-01 0.0000e+00
+-2.2479e-01 -3.7277e-01 0.0000e+00
+-1.7357e-01 -3.7645e-01 0.0000e+00
+-1.2389e-01 -3.7529e-01 0.0000e+00
+-7.4870e-02 -3.7215e-01 0.0000e+00
+-2.5452e-02 -3.7213e-01 0.0000e+00
++2.0120e-02 -3.7931e-01 0.0000e+00
++7.5567e-02 -3.7191e-01 0.0000e+00
++1.2186e-01 -3.7397e-01 0.0000e+00
++1.7407e-01 -3.7053e-01 0.0000e+00
++2.2110e-01 -3.7922e-01 0.0000e+00
++2.7232e-01 -3.7419e-01 0.0000e+00
++3.2732e-01 -3.7048e-01 0.0000e+00
++3.7679e-01 -3.7603e-01 0.0000e+00
++4.2247e-01 -3.7826e-01 0.0000e+00
++4.7317e-01 -3.7974e-01 0.0000e+00
++5.2304e-01 -3.7143e-01 0.0000e+00
++5.7133e-01 -3.7877e-01 0.0000e+00
++6.2834e-01 -3.7325e-01 0.0000e+00
+-6.7005e-01 -3.2833e-01 0.0000e+00
+-6.2125e-01 -3.2255e-01 0.0000e+00
+-5.7056e-01 -3.2314e-01 0.0000e+00
+-5.2202e-01 -3.2950e-01 0.0000e+00
+-4.7457e-01 -3.2121e-01 0.0000e+00
+-4.2937e-01 -3.2255e-01 0.0000e+00
+-3.7257e-01 -3.2637e-01 0.0000e+00
+-3.2807e-01 -3.2045e-01 0.0000e+00
+-2.7965e-01 -3.2214e-01 0.0000e+00
+-2.2214e-01 -3.2851e-01 0.0000e+00
+-1.7113e-01 -3.2986e-01 0.0000e+00
+-1.2780e-01 -3.2079e-01 0.0000e+00
+-7.4413e-02 -3.2719e-01 0.0000e+00
+-2.4420e-02 -3.2450e-01 0.0000e+00
++2.8680e-02 -3.2016e-01 0.0000e+00
++7.2100e-02 -3.2090e-01 0.0000e+00
++1.2285e-01 -3.2065e-01 0.0000e+00
++1.7488e-01 -3.2438e-01 0.0000e+00
++2.2741e-01 -3.2804e-01 0.0000e+00
++2.7435e-01 -3.2869e-01 0.0000e+00
++3.2483e-01 -3.2700e-01 0.0000e+00
++3.7651e-01 -3.2208e-01 0.0000e+00
++4.2419e-01 -3.2614e-01 0.0000e+00
++4.7454e-01 -3.2934e-01 0.0000e+00
++5.2456e-01 -3.2658e-01 0.0000e+00
++5.7316e-01 -3.2486e-01 0.0000e+00
++6.2846e-01 -3.2490e-01 0.0000e+00
+-6.7037e-01 -2.7012e-01 0.0000e+00
+-6.2589e-01 -2.7966e-01 0.0000e+00
+-5.7873e-01 -2.7830e-01 0.0000e+00
+-5.2955e-01 -2.7832e-01 0.0000e+00
+-4.7383e-01 -2.7947e-01 0.0000e+00
+-4.2531e-01 -2.7811e-01 0.0000e+00
+-3.7094e-01 -2.7933e-01 0.0000e+00
+-3.2805e-01 -2.7078e-01 0.0000e+00
+-2.7288e-01 -2.7787e-01 0.0000e+00
+-2.2299e-01 -2.7518e-01 0.0000e+00
+-1.7961e-01 -2.7570e-01 0.0000e+00
+-1.2483e-01 -2.7570e-01 0.0000e+00
+-7.8602e-02 -2.7355e-01 0.0000e+00
+-2.8282e-02 -2.7260e-01 0.0000e+00
++2.7788e-02 -2.7398e-01 0.0000e+00
++7.5189e-02 -2.7420e-01 0.0000e+00
++1.2309e-01 -2.7121e-01 0.0000e+00
++1.7898e-01 -2.7053e-01 0.0000e+00
++2.2636e-01 -2.7469e-01 0.0000e+00
++2.7417e-01 -2.7479e-01 0.0000e+00
++3.2055e-01 -2.7541e-01 0.0000e+00
++3.7348e-01 -2.7508e-01 0.0000e+00
++4.2508e-01 -2.7563e-01 0.0000e+00
++4.7976e-01 -2.7044e-01 0.0000e+00
++5.2731e-01 -2.7664e-01 0.0000e+00
++5.7435e-01 -2.7305e-01 0.0000e+00
++6.2789e-01 -2.7681e-01 0.0000e+00
++6.7510e-01 -2.7443e-01 0.0000e+00
+-6.7472e-01 -2.2704e-01 0.0000e+00
+-6.2898e-01 -2.2423e-01 0.0000e+00
+-5.7396e-01 -2.2539e-01 0.0000e+00
+-5.2366e-01 -2.2904e-01 0.0000e+00
+-4.7027e-01 -2.2222e-01 0.0000e+00
+-4.2596e-01 -2.2354e-01 0.0000e+00
+-3.7842e-01 -2.2970e-01 0.0000e+00
+-3.2434e-01 -2.2816e-01 0.0000e+00
+-2.7433e-01 -2.2139e-01 0.0000e+00
+-2.2269e-01 -2.2623e-01 0.0000e+00
+-1.7803e-01 -2.2743e-01 0.0000e+00
+-1.2247e-01 -2.2988e-01 0.0000e+00
+-7.0177e-02 -2.2130e-01 0.0000e+00
+-2.9381e-02 -2.2499e-01 0.0000e+00
++2.8508e-02 -2.2132e-01 0.0000e+00
++7.7702e-02 -2.2902e-01 0.0000e+00
++1.2135e-01 -2.2403e-01 0.0000e+00
++1.7484e-01 -2.2968e-01 0.0000e+00
++2.2616e-01 -2.2510e-01 0.0000e+00
++2.7667e-01 -2.2840e-01 0.0000e+00
++3.2052e-01 -2.2067e-01 0.0000e+00
++3.7367e-01 -2.2972e-01 0.0000e+00
++4.2971e-01 -2.2352e-01 0.0000e+00
++4.7221e-01 -2.2861e-01 0.0000e+00
++5.2530e-01 -2.2077e-01 0.0000e+00
++5.7819e-01 -2.2074e-01 0.0000e+00
++6.2250e-01 -2.2578e-01 0.0000e+00
++6.7635e-01 -2.2385e-01 0.0000e+00
+-7.2918e-01 -1.7394e-01 0.0000e+00
+-6.7239e-01 -1.7475e-01 0.0000e+00
+-6.2854e-01 -1.7075e-01 0.0000e+00
+-5.7109e-01 -1.7171e-01 0.0000e+00
+-5.2693e-01 -1.7393e-01 0.0000e+00
+-4.7215e-01 -1.7012e-01 0.0000e+00
+-4.2753e-01 -1.7216e-01 0.0000e+00
+-3.7450e-01 -1.7987e-01 0.0000e+00
+-3.2327e-01 -1.7726e-01 0.0000e+00
+-2.7225e-01 -1.7455e-01 0.0000e+00
+-2.2314e-01 -1.7580e-01 0.0000e+00
+-1.7663e-01 -1.7573e-01 0.0000e+00
+-1.2576e-01 -1.7545e-01 0.0000e+00
+-7.8245e-02 -1.7535e-01 0.0000e+00
+-2.0138e-02 -1.7270e-01 0.0000e+00
++2.1702e-02 -1.7932e-01 0.0000e+00
++7.4811e-02 -1.7968e-01 0.0000e+00
++1.2539e-01 -1.7439e-01 0.0000e+00
++1.7717e-01 -1.7854e-01 0.0000e+00
++2.2278e-01 -1.7424e-01 0.0000e+00
++2.7750e-01 -1.7745e-01 0.0000e+00
++3.2138e-01 -1.7496e-01 0.0000e+00
++3.7474e-01 -1.7713e-01 0.0000e+00
++4.2837e-01 -1.7323e-01 0.0000e+00
++4.7403e-01 -1.7262e-01 0.0000e+00
++5.2618e-01 -1.7886e-01 0.0000e+00
++5.7297e-01 -1.7502e-01 0.0000e+00
++6.2569e-01 -1.7467e-01 0.0000e+00
++6.7583e-01 -1.7811e-01 0.0000e+00
++7.2293e-01 -1.7759e-01 0.0000e+00
+-7.2542e-01 -1.2179e-01 0.0000e+00
+-6.7621e-01 -1.2315e-01 0.0000e+00
+-6.2619e-01 -1.2579e-01 0.0000e+00
+-5.7882e-01 -1.2364e-01 0.0000e+00
+-5.2768e-01 -1.2628e-01 0.0000e+00
+-4.7147e-01 -1.2013e-01 0.0000e+00
+-4.2180e-01 -1.2680e-01 0.0000e+00
+-3.7718e-01 -1.2227e-01 0.0000e+00
+-3.2962e-01 -1.2348e-01 0.0000e+00
+-2.7173e-01 -1.2513e-01 0.0000e+00
+-2.2307e-01 -1.2742e-01 0.0000e+00
+-1.7574e-01 -1.2693e-01 0.0000e+00
+-1.2834e-01 -1.2503e-01 0.0000e+00
+-7.1283e-02 -1.2022e-01 0.0000e+00
+-2.4948e-02 -1.2216e-01 0.0000e+00
++2.8921e-02 -1.2172e-01 0.0000e+00
++7.2650e-02 -1.2576e-01 0.0000e+00
++1.2299e-01 -1.2878e-01 0.0000e+00
++1.7483e-01 -1.2623e-01 0.0000e+00
++2.2611e-01 -1.2557e-01 0.0000e+00
++2.7173e-01 -1.2844e-01 0.0000e+00
++3.2599e-01 -1.2715e-01 0.0000e+00
++3.7535e-01 -1.2977e-01 0.0000e+00
++4.2678e-01 -1.2485e-01 0.0000e+00
++4.7022e-01 -1.2875e-01 0.0000e+00
++5.2000e-01 -1.2042e-01 0.0000e+00
++5.7475e-01 -1.2724e-01 0.0000e+00
++6.2263e-01 -1.2789e-01 0.0000e+00
++6.7730e-01 -1.2635e-01 0.0000e+00
++7.2611e-01 -1.2097e-01 0.0000e+00
+-7.2082e-01 -7.9001e-02 0.0000e+00
+-6.7060e-01 -7.4592e-02 0.0000e+00
+-6.2497e-01 -7.0072e-02 0.0000e+00
+-5.7950e-01 -7.9674e-02 0.0000e+00
+-5.2908e-01 -7.5920e-02 0.0000e+00
+-4.7951e-01 -7.0946e-02 0.0000e+00
+-4.2607e-01 -7.5813e-02 0.0000e+00
+-3.7046e-01 -7.2968e-02 0.0000e+00
+-3.2530e-01 -7.1827e-02 0.0000e+00
+-2.7227e-01 -7.4402e-02 0.0000e+00
+-2.2633e-01 -7.0576e-02 0.0000e+00
+-1.7298e-01 -7.2495e-02 0.0000e+00
+-1.2801e-01 -7.9909e-02 0.0000e+00
+-7.3830e-02 -7.3146e-02 0.0000e+00
+-2.2498e-02 -7.4927e-02 0.0000e+00
++2.6326e-02 -7.3008e-02 0.0000e+00
++7.3959e-02 -7.6391e-02 0.0000e+00
++1.2723e-01 -7.5104e-02 0.0000e+00
++1.7884e-01 -7.5779e-02 0.0000e+00
++2.2857e-01 -7.2036e-02 0.0000e+00
++2.7397e-01 -7.4569e-02 0.0000e+00
++3.2942e-01 -7.0458e-02 0.0000e+00
++3.7834e-01 -7.9138e-02 0.0000e+00
++4.2578e-01 -7.8749e-02 0.0000e+00
++4.7207e-01 -7.1428e-02 0.0000e+00
++5.2245e-01 -7.8315e-02 0.0000e+00
++5.7071e-01 -7.7285e-02 0.0000e+00
++6.2045e-01 -7.6584e-02 0.0000e+00
++6.7482e-01 -7.8240e-02 0.0000e+00
++7.2374e-01 -7.0270e-02 0.0000e+00
+-7.2646e-01 -2.4216e-02 0.0000e+00
+-6.7731e-01 -2.6647e-02 0.0000e+00
+-6.2803e-01 -2.2227e-02 0.0000e+00
+-5.7908e-01 -2.1762e-02 0.0000e+00
+-5.2326e-01 -2.5930e-02 0.0000e+00
+-4.7524e-01 -2.1469e-02 0.0000e+00
+-4.2148e-01 -2.4553e-02 0.0000e+00
+-3.7560e-01 -2.1692e-02 0.0000e+00
+-3.2663e-01 -2.8045e-02 0.0000e+00
+-2.7551e-01 -2.0644e-02 0.0000e+00
+-2.2285e-01 -2.5992e-02 0.0000e+00
+-1.7967e-01 -2.7364e-02 0.0000e+00
+-1.2114e-01 -2.0826e-02 0.0000e+00
+-7.2110e-02 -2.0106e-02 0.0000e+00
+-2.2227e-02 -2.8802e-02 0.0000e+00
++2.1959e-02 -2.8277e-02 0.0000e+00
++7.7591e-02 -2.6902e-02 0.0000e+00
++1.2193e-01 -2.7577e-02 0.0000e+00
++1.7808e-01 -2.8845e-02 0.0000e+00
++2.2782e-01 -2.4086e-02 0.0000e+00
++2.7840e-01 -2.5371e-02 0.0000e+00
++3.2241e-01 -2.0666e-02 0.0000e+00
++3.7648e-01 -2.8104e-02 0.0000e+00
++4.2412e-01 -2.1700e-02 0.0000e+00
++4.7944e-01 -2.3985e-02 0.0000e+00
++5.2096e-01 -2.3283e-02 0.0000e+00
++5.7314e-01 -2.3312e-02 0.0000e+00
++6.2820e-01 -2.6404e-02 0.0000e+00
++6.7439e-01 -2.4926e-02 0.0000e+00
++7.2100e-01 -2.5825e-02 0.0000e+00
+-7.2099e-01 +2.5441e-02 0.0000e+00
+-6.7536e-01 +2.9375e-02 0.0000e+00
+-6.2307e-01 +2.5331e-02 0.0000e+00
+-5.7796e-01 +2.7067e-02 0.0000e+00
+-5.2477e-01 +2.7138e-02 0.0000e+00
+-4.7191e-01 +2.2760e-02 0.0000e+00
+-4.2348e-01 +2.3298e-02 0.0000e+00
+-3.7565e-01 +2.0079e-02 0.0000e+00
+-3.2307e-01 +2.1898e-02 0.0000e+00
+-2.7685e-01 +2.3011e-02 0.0000e+00
+-2.2499e-01 +2.2208e-02 0.0000e+00
+-1.7492e-01 +2.7303e-02 0.0000e+00
+-1.2786e-01 +2.8634e-02 0.0000e+00
+-7.1390e-02 +2.2663e-02 0.0000e+00
+-2.6135e-02 +2.7841e-02 0.0000e+00
++2.9245e-02 +2.1902e-02 0.0000e+00
++7.1325e-02 +2.8307e-02 0.0000e+00
++1.2581e-01 +2.7761e-02 0.0000e+00
++1.7274e-01 +2.0373e-02 0.0000e+00
++2.2770e-01 +2.2408e-02 0.0000e+00
++2.7916e-01 +2.4364e-02 0.0000e+00
++3.2199e-01 +2.5392e-02 0.0000e+00
++3.7215e-01 +2.2506e-02 0.0000e+00
++4.2933e-01 +2.7695e-02 0.0000e+00
++4.7358e-01 +2.8997e-02 0.0000e+00
++5.2472e-01 +2.7210e-02 0.0000e+00
++5.7681e-01 +2.9808e-02 0.0000e+00
++6.2341e-01 +2.1737e-02 0.0000e+00
++6.7956e-01 +2.6869e-02 0.0000e+00
++7.2415e-01 +2.2047e-02 0.0000e+00
+-7.2209e-01 +7.5041e-02 0.0000e+00
+-6.7920e-01 +7.5601e-02 0.0000e+00
+-6.2511e-01 +7.9939e-02 0.0000e+00
+-5.7120e-01 +7.3394e-02 0.0000e+00
+-5.2527e-01 +7.9164e-02 0.0000e+00
+-4.7457e-01 +7.2973e-02 0.0000e+00
+-4.2557e-01 +7.2486e-02 0.0000e+00
+-3.7055e-01 +7.3678e-02 0.0000e+00
+-3.2823e-01 +7.9898e-02 0.0000e+00
+-2.7266e-01 +7.0159e-02 0.0000e+00
+-2.2914e-01 +7.1658e-02 0.0000e+00
+-1.7320e-01 +7.4136e-02 0.0000e+00
+-1.2725e-01 +7.8281e-02 0.0000e+00
+-7.5320e-02 +7.2070e-02 0.0000e+00
+-2.4649e-02 +7.8879e-02 0.0000e+00
++2.2061e-02 +7.5004e-02 0.0000e+00
++7.9878e-02 +7.5209e-02 0.0000e+00
++1.2631e-01 +7.3337e-02 0.0000e+00
++1.7795e-01 +7.9012e-02 0.0000e+00
++2.2390e-01 +7.7827e-02 0.0000e+00
++2.7427e-01 +7.1395e-02 0.0000e+00
++3.2165e-01 +7.3701e-02 0.0000e+00
++3.7471e-01 +7.6161e-02 0.0000e+00
++4.2494e-01 +7.0069e-02 0.0000e+00
++4.7519e-01 +7.8980e-02 0.0000e+00
++5.2206e-01 +7.4682e-02 0.0000e+00
++5.7442e-01 +7.2581e-02 0.0000e+00
++6.2426e-01 +7.9916e-02 0.0000e+00
++6.7681e-01 +7.4831e-02 0.0000e+00
++7.2388e-01 +7.0418e-02 0.0000e+00
+-7.2564e-01 +1.2409e-01 0.0000e+00
+-6.7660e-01 +1.2446e-01 0.0000e+00
+-6.2738e-01 +1.2600e-01 0.0000e+00
+-5.7396e-01 +1.2947e-01 0.0000e+00
+-5.2861e-01 +1.2300e-01 0.0000e+00
+-4.7882e-01 +1.2057e-01 0.0000e+00
+-4.2506e-01 +1.2156e-01 0.0000e+00
+-3.7735e-01 +1.2385e-01 0.0000e+00
+-3.2114e-01 +1.2010e-01 0.0000e+00
+-2.7201e-01 +1.2869e-01 0.0000e+00
+-2.2998e-01 +1.2102e-01 0.0000e+00
+-1.7885e-01 +1.2184e-01 0.0000e+00
+-1.2940e-01 +1.2217e-01 0.0000e+00
+-7.5052e-02 +1.2909e-01 0.0000e+00
+-2.2759e-02 +1.2351e-01 0.0000e+00
++2.9223e-02 +1.2425e-01 0.0000e+00
++7.2549e-02 +1.2314e-01 0.0000e+00
++1.2656e-01 +1.2507e-01 0.0000e+00
++1.7282e-01 +1.2634e-01 0.0000e+00
++2.2357e-01 +1.2220e-01 0.0000e+00
++2.7889e-01 +1.2388e-01 0.0000e+00
++3.2561e-01 +1.2451e-01 0.0000e+00
++3.7189e-01 +1.2719e-01 0.0000e+00
++4.2405e-01 +1.2124e-01 0.0000e+00
++4.7436e-01 +1.2398e-01 0.0000e+00
++5.2113e-01 +1.2138e-01 0.0000e+00
++5.7796e-01 +1.2529e-01 0.0000e+00
++6.2894e-01 +1.2509e-01 0.0000e+00
++6.7881e-01 +1.2511e-01 0.0000e+00
++7.2931e-01 +1.2125e-01 0.0000e+00
+-7.2058e-01 +1.7896e-01 0.0000e+00
+-6.7537e-01 +1.7163e-01 0.0000e+00
+-6.2800e-01 +1.7278e-01 0.0000e+00
+-5.7562e-01 +1.7425e-01 0.0000e+00
+-5.2338e-01 +1.7652e-01 0.0000e+00
+-4.7852e-01 +1.7318e-01 0.0000e+00
+-4.2715e-01 +1.7986e-01 0.0000e+00
+-3.7773e-01 +1.7118e-01 0.0000e+00
+-3.2328e-01 +1.7069e-01 0.0000e+00
+-2.7948e-01 +1.7325e-01 0.0000e+00
+-2.2242e-01 +1.7262e-01 0.0000e+00
+-1.7840e-01 +1.7185e-01 0.0000e+00
+-1.2872e-01 +1.7142e-01 0.0000e+00
+-7.3388e-02 +1.7239e-01 0.0000e+00
+-2.0136e-02 +1.7501e-01 0.0000e+00
++2.8757e-02 +1.7881e-01 0.0000e+00
++7.7389e-02 +1.7492e-01 0.0000e+00
++1.2146e-01 +1.7356e-01 0.0000e+00
++1.7219e-01 +1.7325e-01 0.0000e+00
++2.2040e-01 +1.7489e-01 0.0000e+00
++2.7598e-01 +1.7415e-01 0.0000e+00
++3.2454e-01 +1.7905e-01 0.0000e+00
++3.7388e-01 +1.7965e-01 0.0000e+00
++4.2232e-01 +1.7381e-01 0.0000e+00
++4.7201e-01 +1.7846e-01 0.0000e+00
++5.2249e-01 +1.7200e-01 0.0000e+00
++5.7592e-01 +1.7896e-01 0.0000e+00
++6.2632e-01 +1.7165e-01 0.0000e+00
++6.7623e-01 +1.7278e-01 0.0000e+00
++7.2235e-01 +1.7916e-01 0.0000e+00
+-6.7531e-01 +2.2408e-01 0.0000e+00
+-6.2724e-01 +2.2204e-01 0.0000e+00
+-5.7340e-01 +2.2138e-01 0.0000e+00
+-5.2710e-01 +2.2146e-01 0.0000e+00
+-4.7778e-01 +2.2870e-01 0.0000e+00
+-4.2087e-01 +2.2165e-01 0.0000e+00
+-3.7245e-01 +2.2472e-01 0.0000e+00
+-3.2462e-01 +2.2675e-01 0.0000e+00
+-2.7312e-01 +2.2404e-01 0.0000e+00
+-2.2375e-01 +2.2017e-01 0.0000e+00
+-1.7917e-01 +2.2391e-01 0.0000e+00
+-1.2027e-01 +2.2885e-01 0.0000e+00
+-7.6753e-02 +2.2242e-01 0.0000e+00
+-2.6446e-02 +2.2329e-01 0.0000e+00
++2.4782e-02 +2.2735e-01 0.0000e+00
++7.1330e-02 +2.2022e-01 0.0000e+00
++1.2135e-01 +2.2549e-01 0.0000e+00
++1.7134e-01 +2.2480e-01 0.0000e+00
++2.2932e-01 +2.2757e-01 0.0000e+00
++2.7497e-01 +2.2683e-01 0.0000e+00
++3.2240e-01 +2.2170e-01 0.0000e+00
++3.7159e-01 +2.2909e-01 0.0000e+00
++4.2558e-01 +2.2776e-01 0.0000e+00
++4.7462e-01 +2.2118e-01 0.0000e+00
++5.2433e-01 +2.2184e-01 0.0000e+00
++5.7884e-01 +2.2965e-01 0.0000e+00
++6.2455e-01 +2.2430e-01 0.0000e+00
++6.7125e-01 +2.2358e-01 0.0000e+00
+-6.7951e-01 +2.7456e-01 0.0000e+00
+-6.2786e-01 +2.7707e-01 0.0000e+00
+-5.7397e-01 +2.7888e-01 0.0000e+00
+-5.2393e-01 +2.7312e-01 0.0000e+00
+-4.7997e-01 +2.7474e-01 0.0000e+00
+-4.2822e-01 +2.7538e-01 0.0000e+00
+-3.7992e-01 +2.7556e-01 0.0000e+00
+-3.2919e-01 +2.7028e-01 0.0000e+00
+-2.7894e-01 +2.7591e-01 0.0000e+00
+-2.2579e-01 +2.7594e-01 0.0000e+00
+-1.7989e-01 +2.7764e-01 0.0000e+00
+-1.2854e-01 +2.7786e-01 0.0000e+00
+-7.5247e-02 +2.7613e-01 0.0000e+00
+-2.0560e-02 +2.7160e-01 0.0000e+00
++2.2379e-02 +2.7817e-01 0.0000e+00
++7.8171e-02 +2.7088e-01 0.0000e+00
++1.2428e-01 +2.7147e-01 0.0000e+00
++1.7611e-01 +2.7233e-01 0.0000e+00
++2.2741e-01 +2.7022e-01 0.0000e+00
++2.7177e-01 +2.7717e-01 0.0000e+00
++3.2663e-01 +2.7037e-01 0.0000e+00
++3.7268e-01 +2.7004e-01 0.0000e+00
++4.2008e-01 +2.7587e-01 0.0000e+00
++4.7673e-01 +2.7224e-01 0.0000e+00
++5.2414e-01 +2.7030e-01 0.0000e+00
++5.7828e-01 +2.7532e-01 0.0000e+00
++6.2671e-01 +2.7316e-01 0.0000e+00
++6.7845e-01 +2.7439e-01 0.0000e+00
+-6.2860e-01 +3.2765e-01 0.0000e+00
+-5.7885e-01 +3.2733e-01 0.0000e+00
+-5.2523e-01 +3.2312e-01 0.0000e+00
+-4.7407e-01 +3.2406e-01 0.0000e+00
+-4.2518e-01 +3.2859e-01 0.0000e+00
+-3.7350e-01 +3.2470e-01 0.0000e+00
+-3.2816e-01 +3.2604e-01 0.0000e+00
+-2.7112e-01 +3.2417e-01 0.0000e+00
+-2.2462e-01 +3.2397e-01 0.0000e+00
+-1.7697e-01 +3.2973e-01 0.0000e+00
+-1.2539e-01 +3.2047e-01 0.0000e+00
+-7.8564e-02 +3.2491e-01 0.0000e+00
+-2.9886e-02 +3.2053e-01 0.0000e+00
++2.8285e-02 +3.2192e-01 0.0000e+00
++7.8850e-02 +3.2923e-01 0.0000e+00
++1.2031e-01 +3.2954e-01 0.0000e+00
++1.7342e-01 +3.2474e-01 0.0000e+00
++2.2004e-01 +3.2198e-01 0.0000e+00
++2.7559e-01 +3.2689e-01 0.0000e+00
++3.2641e-01 +3.2014e-01 0.0000e+00
++3.7176e-01 +3.2499e-01 0.0000e+00
++4.2558e-01 +3.2223e-01 0.0000e+00
++4.7811e-01 +3.2284e-01 0.0000e+00
++5.2249e-01 +3.2122e-01 0.0000e+00
++5.7676e-01 +3.2702e-01 0.0000e+00
++6.2502e-01 +3.2590e-01 0.0000e+00
++6.7122e-01 +3.2221e-01 0.0000e+00
+-6.2806e-01 +3.7743e-01 0.0000e+00
+-5.7707e-01 +3.7647e-01 0.0000e+00
+-5.2984e-01 +3.7022e-01 0.0000e+00
+-4.7602e-01 +3.7832e-01 0.0000e+00
+-4.2081e-01 +3.7147e-01 0.0000e+00
+-3.7969e-01 +3.7107e-01 0.0000e+00
+-3.2621e-01 +3.7428e-01 0.0000e+00
+-2.7439e-01 +3.7611e-01 0.0000e+00
+-2.2287e-01 +3.7871e-01 0.0000e+00
+-1.7704e-01 +3.7869e-01 0.0000e+00
+-1.2155e-01 +3.7174e-01 0.0000e+00
+-7.3047e-02 +3.7118e-01 0.0000e+00
+-2.3517e-02 +3.7481e-01 0.0000e+00
++2.7765e-02 +3.7496e-01 0.0000e+00
++7.0899e-02 +3.7310e-01 0.0000e+00
++1.2379e-01 +3.7556e-01 0.0000e+00
++1.7979e-01 +3.7037e-01 0.0000e+00
++2.2400e-01 +3.7167e-01 0.0000e+00
++2.7093e-01 +3.7763e-01 0.0000e+00
++3.2627e-01 +3.7805e-01 0.0000e+00
++3.7354e-01 +3.7261e-01 0.0000e+00
++4.2418e-01 +3.7475e-01 0.0000e+00
++4.7494e-01 +3.7395e-01 0.0000e+00
++5.2761e-01 +3.7393e-01 0.0000e+00
++5.7876e-01 +3.7869e-01 0.0000e+00
++6.2782e-01 +3.7371e-01 0.0000e+00
+-5.7598e-01 +4.2193e-01 0.0000e+00
+-5.2839e-01 +4.2648e-01 0.0000e+00
+-4.7052e-01 +4.2553e-01 0.0000e+00
+-4.2812e-01 +4.2458e-01 0.0000e+00
+-3.7684e-01 +4.2799e-01 0.0000e+00
+-3.2414e-01 +4.2416e-01 0.0000e+00
+-2.7254e-01 +4.2964e-01 0.0000e+00
+-2.2697e-01 +4.2087e-01 0.0000e+00
+-1.7444e-01 +4.2190e-01 0.0000e+00
+-1.2360e-01 +4.2070e-01 0.0000e+00
+-7.2641e-02 +4.2106e-01 0.0000e+00
+-2.0427e-02 +4.2076e-01 0.0000e+00
++2.0522e-02 +4.2443e-01 0.0000e+00
++7.6519e-02 +4.2361e-01 0.0000e+00
++1.2227e-01 +4.2454e-01 0.0000e+00
++1.7800e-01 +4.2399e-01 0.0000e+00
++2.2160e-01 +4.2485e-01 0.0000e+00
++2.7524e-01 +4.2412e-01 0.0000e+00
++3.2473e-01 +4.2906e-01 0.0000e+00
++3.7018e-01 +4.2588e-01 0.0000e+00
++4.2032e-01 +4.2492e-01 0.0000e+00
++4.7709e-01 +4.2253e-01 0.0000e+00
++5.2157e-01 +4.2158e-01 0.0000e+00
++5.7513e-01 +4.2232e-01 0.0000e+00
+-5.7857e-01 +4.7692e-01 0.0000e+00
+-5.2344e-01 +4.7880e-01 0.0000e+00
+-4.7593e-01 +4.7894e-01 0.0000e+00
+-4.2798e-01 +4.7873e-01 0.0000e+00
+-3.7159e-01 +4.7887e-01 0.0000e+00
+-3.2833e-01 +4.7376e-01 0.0000e+00
+-2.7470e-01 +4.7295e-01 0.0000e+00
+-2.2926e-01 +4.7457e-01 0.0000e+00
+-1.7934e-01 +4.7188e-01 0.0000e+00
+-1.2557e-01 +4.7995e-01 0.0000e+00
+-7.4041e-02 +4.7356e-01 0.0000e+00
+-2.1399e-02 +4.7512e-01 0.0000e+00
++2.0981e-02 +4.7822e-01 0.0000e+00
++7.1160e-02 +4.7441e-01 0.0000e+00
++1.2274e-01 +4.7935e-01 0.0000e+00
++1.7412e-01 +4.7542e-01 0.0000e+00
++2.2235e-01 +4.7716e-01 0.0000e+00
++2.7549e-01 +4.7220e-01 0.0000e+00
++3.2014e-01 +4.7602e-01 0.0000e+00
++3.7668e-01 +4.7312e-01 0.0000e+00
++4.2961e-01 +4.7062e-01 0.0000e+00
++4.7568e-01 +4.7635e-01 0.0000e+00
++5.2181e-01 +4.7553e-01 0.0000e+00
++5.7621e-01 +4.7769e-01 0.0000e+00
+-5.2484e-01 +5.2802e-01 0.0000e+00
+-4.7248e-01 +5.2739e-01 0.0000e+00
+-4.2470e-01 +5.2759e-01 0.0000e+00
+-3.7763e-01 +5.2552e-01 0.0000e+00
+-3.2513e-01 +5.2554e-01 0.0000e+00
+-2.7838e-01 +5.2176e-01 0.0000e+00
+-2.2264e-01 +5.2274e-01 0.0000e+00
+-1.7001e-01 +5.2144e-01 0.0000e+00
+-1.2222e-01 +5.2893e-01 0.0000e+00
+-7.3783e-02 +5.2875e-01 0.0000e+00
+-2.0928e-02 +5.2810e-01 0.0000e+00
++2.0813e-02 +5.2568e-01 0.0000e+00
++7.7048e-02 +5.2352e-01 0.0000e+00
++1.2889e-01 +5.2566e-01 0.0000e+00
++1.7034e-01 +5.2933e-01 0.0000e+00
++2.2138e-01 +5.2586e-01 0.0000e+00
++2.7929e-01 +5.2885e-01 0.0000e+00
++3.2859e-01 +5.2871e-01 0.0000e+00
++3.7052e-01 +5.2732e-01 0.0000e+00
++4.2714e-01 +5.2045e-01 0.0000e+00
++4.7808e-01 +5.2122e-01 0.0000e+00
++5.2358e-01 +5.2739e-01 0.0000e+00
+-4.7179e-01 +5.7996e-01 0.0000e+00
+-4.2959e-01 +5.7588e-01 0.0000e+00
+-3.7888e-01 +5.7486e-01 0.0000e+00
+-3.2586e-01 +5.7815e-01 0.0000e+00
+-2.7567e-01 +5.7298e-01 0.0000e+00
+-2.2245e-01 +5.7989e-01 0.0000e+00
+-1.7007e-01 +5.7974e-01 0.0000e+00
+-1.2812e-01 +5.7823e-01 0.0000e+00
+-7.2575e-02 +5.7032e-01 0.0000e+00
+-2.2775e-02 +5.7621e-01 0.0000e+00
++2.4047e-02 +5.7738e-01 0.0000e+00
++7.8554e-02 +5.7132e-01 0.0000e+00
++1.2537e-01 +5.7472e-01 0.0000e+00
++1.7084e-01 +5.7765e-01 0.0000e+00
++2.2616e-01 +5.7424e-01 0.0000e+00
++2.7881e-01 +5.7431e-01 0.0000e+00
++3.2102e-01 +5.7973e-01 0.0000e+00
++3.7443e-01 +5.7195e-01 0.0000e+00
++4.2778e-01 +5.7016e-01 0.0000e+00
++4.7954e-01 +5.7650e-01 0.0000e+00
+-3.7695e-01 +6.2230e-01 0.0000e+00
+-3.2537e-01 +6.2849e-01 0.0000e+00
+-2.7688e-01 +6.2629e-01 0.0000e+00
+-2.2828e-01 +6.2410e-01 0.0000e+00
+-1.7922e-01 +6.2389e-01 0.0000e+00
+-1.2455e-01 +6.2478e-01 0.0000e+00
+-7.9617e-02 +6.2005e-01 0.0000e+00
+-2.0416e-02 +6.2291e-01 0.0000e+00
++2.7612e-02 +6.2482e-01 0.0000e+00
++7.8831e-02 +6.2089e-01 0.0000e+00
++1.2732e-01 +6.2778e-01 0.0000e+00
++1.7086e-01 +6.2913e-01 0.0000e+00
++2.2562e-01 +6.2592e-01 0.0000e+00
++2.7799e-01 +6.2856e-01 0.0000e+00
++3.2925e-01 +6.2746e-01 0.0000e+00
++3.7352e-01 +6.2360e-01 0.0000e+00
+-2.7287e-01 +6.7757e-01 0.0000e+00
+-2.2544e-01 +6.7239e-01 0.0000e+00
+-1.7317e-01 +6.7303e-01 0.0000e+00
+-1.2346e-01 +6.7036e-01 0.0000e+00
+-7.7208e-02 +6.7453e-01 0.0000e+00
+-2.1073e-02 +6.7760e-01 0.0000e+00
++2.2675e-02 +6.7329e-01 0.0000e+00
++7.9619e-02 +6.7934e-01 0.0000e+00
++1.2639e-01 +6.7868e-01 0.0000e+00
++1.7154e-01 +6.7265e-01 0.0000e+00
++2.2830e-01 +6.7864e-01 0.0000e+00
++2.7639e-01 +6.7704e-01 0.0000e+00
+-1.7639e-01 +7.2460e-01 0.0000e+00
+-1.2531e-01 +7.2827e-01 0.0000e+00
+-7.3393e-02 +7.2672e-01 0.0000e+00
+-2.9547e-02 +7.2578e-01 0.0000e+00
++2.4617e-02 +7.2375e-01 0.0000e+00
++7.8654e-02 +7.2122e-01 0.0000e+00
++1.2658e-01 +7.2350e-01 0.0000e+00
++1.7548e-01 +7.2354e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-2.5013e-01 -7.0648e-01 0.0000e+00
+-1.9285e-01 -7.1005e-01 0.0000e+00
+-1.4424e-01 -7.2090e-01 0.0000e+00
+-9.5011e-02 -7.2170e-01 0.0000e+00
+-5.2796e-02 -7.3060e-01 0.0000e+00
++7.0678e-03 -7.3536e-01 0.0000e+00
++5.5331e-02 -7.4186e-01 0.0000e+00
++1.0616e-01 -7.4140e-01 0.0000e+00
+-3.9229e-01 -6.4344e-01 0.0000e+00
+-3.4048e-01 -6.5213e-01 0.0000e+00
+-2.8911e-01 -6.5715e-01 0.0000e+00
+-2.3969e-01 -6.6139e-01 0.0000e+00
+-1.9151e-01 -6.6430e-01 0.0000e+00
+-1.4610e-01 -6.7154e-01 0.0000e+00
+-9.4050e-02 -6.7712e-01 0.0000e+00
+-4.6008e-02 -6.7704e-01 0.0000e+00
++1.1079e-02 -6.8083e-01 0.0000e+00
++5.3699e-02 -6.8477e-01 0.0000e+00
++1.0814e-01 -6.9404e-01 0.0000e+00
++1.6232e-01 -6.9936e-01 0.0000e+00
++2.0862e-01 -7.0064e-01 0.0000e+00
+-4.4235e-01 -5.9204e-01 0.0000e+00
+-3.8423e-01 -5.9771e-01 0.0000e+00
+-3.3975e-01 -5.9382e-01 0.0000e+00
+-2.8861e-01 -6.0576e-01 0.0000e+00
+-2.4035e-01 -6.0885e-01 0.0000e+00
+-1.8503e-01 -6.1203e-01 0.0000e+00
+-1.3334e-01 -6.1789e-01 0.0000e+00
+-8.9077e-02 -6.2614e-01 0.0000e+00
+-3.6818e-02 -6.2970e-01 0.0000e+00
++1.5943e-02 -6.3037e-01 0.0000e+00
++6.4500e-02 -6.3924e-01 0.0000e+00
++1.1329e-01 -6.4474e-01 0.0000e+00
++1.6154e-01 -6.4628e-01 0.0000e+00
++2.1267e-01 -6.5473e-01 0.0000e+00
++2.6393e-01 -6.5268e-01 0.0000e+00
++3.1268e-01 -6.6372e-01 0.0000e+00
+-5.3044e-01 -5.3132e-01 0.0000e+00
+-4.8021e-01 -5.3561e-01 0.0000e+00
+-4.3615e-01 -5.3858e-01 0.0000e+00
+-3.8129e-01 -5.3796e-01 0.0000e+00
+-3.3289e-01 -5.4388e-01 0.0000e+00
+-2.8372e-01 -5.5182e-01 0.0000e+00
+-2.3535e-01 -5.5756e-01 0.0000e+00
+-1.8250e-01 -5.6566e-01 0.0000e+00
+-1.3348e-01 -5.6941e-01 0.0000e+00
+-8.3358e-02 -5.6801e-01 0.0000e+00
+-3.1006e-02 -5.7658e-01 0.0000e+00
++1.3548e-02 -5.7729e-01 0.0000e+00
++6.7826e-02 -5.8556e-01 0.0000e+00
++1.1392e-01 -5.8948e-01 0.0000e+00
++1.6851e-01 -5.9413e-01 0.0000e+00
++2.1798e-01 -6.0754e-01 0.0000e+00
++2.7107e-01 -6.0958e-01 0.0000e+00
++3.2163e-01 -6.0903e-01 0.0000e+00
++3.6480e-01 -6.1866e-01 0.0000e+00
++4.1478e-01 -6.2432e-01 0.0000e+00
+-5.7641e-01 -4.6892e-01 0.0000e+00
+-5.2626e-01 -4.8021e-01 0.0000e+00
+-4.7682e-01 -4.7782e-01 0.0000e+00
+-4.2944e-01 -4.8340e-01 0.0000e+00
+-3.7586e-01 -4.8931e-01 0.0000e+00
+-3.2691e-01 -5.0141e-01 0.0000e+00
+-2.7321e-01 -5.0619e-01 0.0000e+00
+-2.2937e-01 -5.0865e-01 0.0000e+00
+-1.7906e-01 -5.1722e-01 0.0000e+00
+-1.3157e-01 -5.1307e-01 0.0000e+00
+-7.4240e-02 -5.2317e-01 0.0000e+00
+-2.3422e-02 -5.3209e-01 0.0000e+00
++2.4835e-02 -5.3628e-01 0.0000e+00
++7.3974e-02 -5.4017e-01 0.0000e+00
++1.2739e-01 -5.4305e-01 0.0000e+00
++1.7564e-01 -5.4753e-01 0.0000e+00
++2.2547e-01 -5.5422e-01 0.0000e+00
++2.7028e-01 -5.5865e-01 0.0000e+00
++3.2217e-01 -5.6412e-01 0.0000e+00
++3.6913e-01 -5.6849e-01 0.0000e+00
++4.2590e-01 -5.7382e-01 0.0000e+00
++4.7398e-01 -5.8117e-01 0.0000e+00
+-6.2383e-01 -4.1705e-01 0.0000e+00
+-5.7657e-01 -4.1908e-01 0.0000e+00
+-5.2396e-01 -4.3097e-01 0.0000e+00
+-4.6927e-01 -4.3287e-01 0.0000e+00
+-4.1774e-01 -4.3483e-01 0.0000e+00
+-3.6841e-01 -4.4339e-01 0.0000e+00
+-3.2686e-01 -4.4955e-01 0.0000e+00
+-2.7063e-01 -4.5668e-01 0.0000e+00
+-2.2459e-01 -4.6166e-01 0.0000e+00
+-1.6873e-01 -4.5914e-01 0.0000e+00
+-1.2132e-01 -4.7041e-01 0.0000e+00
+-7.0061e-02 -4.7192e-01 0.0000e+00
+-2.3197e-02 -4.8233e-01 0.0000e+00
++2.8863e-02 -4.8017e-01 0.0000e+00
++7.8005e-02 -4.9207e-01 0.0000e+00
++1.2798e-01 -4.9345e-01 0.0000e+00
++1.7517e-01 -4.9752e-01 0.0000e+00
++2.2529e-01 -5.0064e-01 0.0000e+00
++2.8023e-01 -5.1185e-01 0.0000e+00
++3.2902e-01 -5.1659e-01 0.0000e+00
++3.8212e-01 -5.1355e-01 0.0000e+00
++4.2276e-01 -5.2045e-01 0.0000e+00
++4.8155e-01 -5.2404e-01 0.0000e+00
++5.3095e-01 -5.3213e-01 0.0000e+00
+-6.1937e-01 -3.7155e-01 0.0000e+00
+-5.7063e-01 -3.7103e-01 0.0000e+00
+-5.1823e-01 -3.7764e-01 0.0000e+00
+-4.6453e-01 -3.8636e-01 0.0000e+00
+-4.2092e-01 -3.8346e-01 0.0000e+00
+-3.6635e-01 -3.9112e-01 0.0000e+00
+-3.1984e-01 -3.9339e-01 0.0000e+00
+-2.6433e-01 -3.9903e-01 0.0000e+00
+-2.1733e-01 -4.0379e-01 0.0000e+00
+-1.7264e-01 -4.1525e-01 0.0000e+00
+-1.1942e-01 -4.2165e-01 0.0000e+00
+-6.4058e-02 -4.2411e-01 0.0000e+00
+-1.7628e-02 -4.2987e-01 0.0000e+00
++3.6305e-02 -4.3386e-01 0.0000e+00
++7.8080e-02 -4.3252e-01 0.0000e+00
++1.2933e-01 -4.3943e-01 0.0000e+00
++1.8168e-01 -4.4802e-01 0.0000e+00
++2.2833e-01 -4.5671e-01 0.0000e+00
++2.8021e-01 -4.5427e-01 0.0000e+00
++3.3611e-01 -4.5973e-01 0.0000e+00
++3.7880e-01 -4.6556e-01 0.0000e+00
++4.3684e-01 -4.7281e-01 0.0000e+00
++4.7901e-01 -4.8214e-01 0.0000e+00
++5.2864e-01 -4.8116e-01 0.0000e+00
+-6.6381e-01 -3.1396e-01 0.0000e+00
+-6.1282e-01 -3.1909e-01 0.0000e+00
+-5.6045e-01 -3.1932e-01 0.0000e+00
+-5.1492e-01 -3.2569e-01 0.0000e+00
+-4.6732e-01 -3.3246e-01 0.0000e+00
+-4.1407e-01 -3.3959e-01 0.0000e+00
+-3.5847e-01 -3.4543e-01 0.0000e+00
+-3.1646e-01 -3.4767e-01 0.0000e+00
+-2.6207e-01 -3.5029e-01 0.0000e+00
+-2.1122e-01 -3.5909e-01 0.0000e+00
+-1.6142e-01 -3.6291e-01 0.0000e+00
+-1.1208e-01 -3.6466e-01 0.0000e+00
+-6.2665e-02 -3.6959e-01 0.0000e+00
+-1.7811e-02 -3.8132e-01 0.0000e+00
++3.8376e-02 -3.7947e-01 0.0000e+00
++8.4460e-02 -3.8616e-01 0.0000e+00
++1.3702e-01 -3.8794e-01 0.0000e+00
++1.8318e-01 -4.0133e-01 0.0000e+00
++2.3490e-01 -4.0143e-01 0.0000e+00
++2.9027e-01 -4.0321e-01 0.0000e+00
++3.3919e-01 -4.1370e-01 0.0000e+00
++3.8465e-01 -4.2050e-01 0.0000e+00
++4.3520e-01 -4.2706e-01 0.0000e+00
++4.8589e-01 -4.2373e-01 0.0000e+00
++5.3345e-01 -4.3590e-01 0.0000e+00
++5.9101e-01 -4.3609e-01 0.0000e+00
+-7.0288e-01 -2.6133e-01 0.0000e+00
+-6.5350e-01 -2.6042e-01 0.0000e+00
+-6.0287e-01 -2.6608e-01 0.0000e+00
+-5.5497e-01 -2.7730e-01 0.0000e+00
+-5.0669e-01 -2.7376e-01 0.0000e+00
+-4.6163e-01 -2.7961e-01 0.0000e+00
+-4.0521e-01 -2.8911e-01 0.0000e+00
+-3.6012e-01 -2.8764e-01 0.0000e+00
+-3.1186e-01 -2.9418e-01 0.0000e+00
+-2.5499e-01 -3.0629e-01 0.0000e+00
+-2.0412e-01 -3.1275e-01 0.0000e+00
+-1.5988e-01 -3.0801e-01 0.0000e+00
+-1.0713e-01 -3.1975e-01 0.0000e+00
+-5.6870e-02 -3.2206e-01 0.0000e+00
+-3.3358e-03 -3.2303e-01 0.0000e+00
++4.0010e-02 -3.2811e-01 0.0000e+00
++9.0781e-02 -3.3293e-01 0.0000e+00
++1.4244e-01 -3.4186e-01 0.0000e+00
++1.9460e-01 -3.5078e-01 0.0000e+00
++2.4148e-01 -3.5613e-01 0.0000e+00
++2.9213e-01 -3.5948e-01 0.0000e+00
++3.4430e-01 -3.5973e-01 0.0000e+00
++3.9158e-01 -3.6856e-01 0.0000e+00
++4.4161e-01 -3.7679e-01 0.0000e+00
++4.9190e-01 -3.7904e-01 0.0000e+00
++5.4067e-01 -3.8218e-01 0.0000e+00
++5.9597e-01 -3.8774e-01 0.0000e+00
+-6.9738e-01 -2.0308e-01 0.0000e+00
+-6.5386e-01 -2.1707e-01 0.0000e+00
+-6.0656e-01 -2.2042e-01 0.0000e+00
+-5.5738e-01 -2.2536e-01 0.0000e+00
+-5.0178e-01 -2.3209e-01 0.0000e+00
+-4.5312e-01 -2.3558e-01 0.0000e+00
+-3.9887e-01 -2.4223e-01 0.0000e+00
+-3.5513e-01 -2.3798e-01 0.0000e+00
+-3.0067e-01 -2.5058e-01 0.0000e+00
+-2.5050e-01 -2.5288e-01 0.0000e+00
+-2.0718e-01 -2.5774e-01 0.0000e+00
+-1.5240e-01 -2.6322e-01 0.0000e+00
+-1.0596e-01 -2.6569e-01 0.0000e+00
+-5.5542e-02 -2.6977e-01 0.0000e+00
++3.9003e-04 -2.7676e-01 0.0000e+00
++4.7769e-02 -2.8171e-01 0.0000e+00
++9.5973e-02 -2.8352e-01 0.0000e+00
++1.5193e-01 -2.8843e-01 0.0000e+00
++1.9889e-01 -2.9733e-01 0.0000e+00
++2.4669e-01 -3.0220e-01 0.0000e+00
++2.9300e-01 -3.0746e-01 0.0000e+00
++3.4597e-01 -3.1243e-01 0.0000e+00
++3.9752e-01 -3.1813e-01 0.0000e+00
++4.5272e-01 -3.1841e-01 0.0000e+00
++4.9964e-01 -3.2937e-01 0.0000e+00
++5.4705e-01 -3.3049e-01 0.0000e+00
++6.0021e-01 -3.3960e-01 0.0000e+00
++6.4766e-01 -3.4194e-01 0.0000e+00
+-6.9742e-01 -1.5957e-01 0.0000e+00
+-6.5140e-01 -1.6133e-01 0.0000e+00
+-5.9650e-01 -1.6799e-01 0.0000e+00
+-5.4656e-01 -1.7667e-01 0.0000e+00
+-4.9249e-01 -1.7519e-01 0.0000e+00
+-4.4831e-01 -1.8094e-01 0.0000e+00
+-4.0139e-01 -1.9186e-01 0.0000e+00
+-3.4716e-01 -1.9573e-01 0.0000e+00
+-2.9647e-01 -1.9396e-01 0.0000e+00
+-2.4531e-01 -2.0396e-01 0.0000e+00
+-2.0078e-01 -2.0963e-01 0.0000e+00
+-1.4546e-01 -2.1764e-01 0.0000e+00
+-9.2307e-02 -2.1428e-01 0.0000e+00
+-5.1880e-02 -2.2205e-01 0.0000e+00
++6.3762e-03 -2.2417e-01 0.0000e+00
++5.4800e-02 -2.3679e-01 0.0000e+00
++9.8950e-02 -2.3616e-01 0.0000e+00
++1.5187e-01 -2.4716e-01 0.0000e+00
++2.0365e-01 -2.4771e-01 0.0000e+00
++2.5383e-01 -2.5607e-01 0.0000e+00
++2.9845e-01 -2.5272e-01 0.0000e+00
++3.5070e-01 -2.6709e-01 0.0000e+00
++4.0735e-01 -2.6649e-01 0.0000e+00
++4.4935e-01 -2.7583e-01 0.0000e+00
++5.0322e-01 -2.7330e-01 0.0000e+00
++5.5612e-01 -2.7856e-01 0.0000e+00
++5.9992e-01 -2.8803e-01 0.0000e+00
++6.5396e-01 -2.9148e-01 0.0000e+00
+-7.4658e-01 -1.0102e-01 0.0000e+00
+-6.8986e-01 -1.0751e-01 0.0000e+00
+-6.4562e-01 -1.0790e-01 0.0000e+00
+-5.8826e-01 -1.1460e-01 0.0000e+00
+-5.4432e-01 -1.2124e-01 0.0000e+00
+-4.8916e-01 -1.2290e-01 0.0000e+00
+-4.4475e-01 -1.2941e-01 0.0000e+00
+-3.9248e-01 -1.4242e-01 0.0000e+00
+-3.4100e-01 -1.4494e-01 0.0000e+00
+-2.8971e-01 -1.4733e-01 0.0000e+00
+-2.4072e-01 -1.5348e-01 0.0000e+00
+-1.9421e-01 -1.5806e-01 0.0000e+00
+-1.4330e-01 -1.6287e-01 0.0000e+00
+-9.5779e-02 -1.6752e-01 0.0000e+00
+-3.7409e-02 -1.7069e-01 0.0000e+00
++3.7697e-03 -1.8149e-01 0.0000e+00
++5.6843e-02 -1.8716e-01 0.0000e+00
++1.0795e-01 -1.8693e-01 0.0000e+00
++1.5931e-01 -1.9625e-01 0.0000e+00
++2.0536e-01 -1.9651e-01 0.0000e+00
++2.5976e-01 -2.0520e-01 0.0000e+00
++3.0388e-01 -2.0710e-01 0.0000e+00
++3.5703e-01 -2.1461e-01 0.0000e+00
++4.1105e-01 -2.1606e-01 0.0000e+00
++4.5677e-01 -2.2002e-01 0.0000e+00
++5.0829e-01 -2.3148e-01 0.0000e+00
++5.5547e-01 -2.3231e-01 0.0000e+00
++6.0822e-01 -2.3724e-01 0.0000e+00
++6.5802e-01 -2.4569e-01 0.0000e+00
++7.0517e-01 -2.4988e-01 0.0000e+00
+-7.3759e-01 -4.9247e-02 0.0000e+00
+-6.8852e-01 -5.5526e-02 0.0000e+00
+-6.3877e-01 -6.3168e-02 0.0000e+00
+-5.9118e-01 -6.5758e-02 0.0000e+00
+-5.4031e-01 -7.3507e-02 0.0000e+00
+-4.8348e-01 -7.2985e-02 0.0000e+00
+-4.3448e-01 -8.4619e-02 0.0000e+00
+-3.8940e-01 -8.4549e-02 0.0000e+00
+-3.4196e-01 -9.0515e-02 0.0000e+00
+-2.8424e-01 -9.7953e-02 0.0000e+00
+-2.3581e-01 -1.0511e-01 0.0000e+00
+-1.8844e-01 -1.0936e-01 0.0000e+00
+-1.4084e-01 -1.1219e-01 0.0000e+00
+-8.3306e-02 -1.1310e-01 0.0000e+00
+-3.7164e-02 -1.1966e-01 0.0000e+00
++1.6749e-02 -1.2461e-01 0.0000e+00
++6.0074e-02 -1.3302e-01 0.0000e+00
++1.1011e-01 -1.4108e-01 0.0000e+00
++1.6220e-01 -1.4372e-01 0.0000e+00
++2.1355e-01 -1.4818e-01 0.0000e+00
++2.5888e-01 -1.5562e-01 0.0000e+00
++3.1327e-01 -1.5975e-01 0.0000e+00
++3.6237e-01 -1.6731e-01 0.0000e+00
++4.1429e-01 -1.6752e-01 0.0000e+00
++4.5734e-01 -1.7577e-01 0.0000e+00
++5.0796e-01 -1.7242e-01 0.0000e+00
++5.6203e-01 -1.8471e-01 0.0000e+00
++6.0984e-01 -1.9015e-01 0.0000e+00
++6.6466e-01 -1.9408e-01 0.0000e+00
++7.1401e-01 -1.9358e-01 0.0000e+00
+-7.2872e-01 -6.9192e-03 0.0000e+00
+-6.7806e-01 -7.5319e-03 0.0000e+00
+-6.3198e-01 -7.5751e-03 0.0000e+00
+-5.8746e-01 -2.1725e-02 0.0000e+00
+-5.3667e-01 -2.3013e-02 0.0000e+00
+-4.8661e-01 -2.2995e-02 0.0000e+00
+-4.3365e-01 -3.3206e-02 0.0000e+00
+-3.7776e-01 -3.5922e-02 0.0000e+00
+-3.3249e-01 -3.9297e-02 0.0000e+00
+-2.7971e-01 -4.7175e-02 0.0000e+00
+-2.3339e-01 -4.7943e-02 0.0000e+00
+-1.8023e-01 -5.5197e-02 0.0000e+00
+-1.3600e-01 -6.7108e-02 0.0000e+00
+-8.1145e-02 -6.5763e-02 0.0000e+00
+-2.9990e-02 -7.2678e-02 0.0000e+00
++1.9026e-02 -7.5641e-02 0.0000e+00
++6.6320e-02 -8.3787e-02 0.0000e+00
++1.1972e-01 -8.7827e-02 0.0000e+00
++1.7126e-01 -9.3663e-02 0.0000e+00
++2.2136e-01 -9.4892e-02 0.0000e+00
++2.6651e-01 -1.0197e-01 0.0000e+00
++3.2238e-01 -1.0340e-01 0.0000e+00
++3.7042e-01 -1.1697e-01 0.0000e+00
++4.1791e-01 -1.2133e-01 0.0000e+00
++4.6493e-01 -1.1864e-01 0.0000e+00
++5.1462e-01 -1.3056e-01 0.0000e+00
++5.6298e-01 -1.3436e-01 0.0000e+00
++6.1279e-01 -1.3863e-01 0.0000e+00
++6.6700e-01 -1.4572e-01 0.0000e+00
++7.1671e-01 -1.4264e-01 0.0000e+00
+-7.2888e-01 +4.8431e-02 0.0000e+00
+-6.7998e-01 +4.1085e-02 0.0000e+00
+-6.3025e-01 +4.0576e-02 0.0000e+00
+-5.8126e-01 +3.6146e-02 0.0000e+00
+-5.2585e-01 +2.6395e-02 0.0000e+00
+-4.7739e-01 +2.6055e-02 0.0000e+00
+-4.2394e-01 +1.7595e-02 0.0000e+00
+-3.7777e-01 +1.5868e-02 0.0000e+00
+-3.2943e-01 +4.6175e-03 0.0000e+00
+-2.7757e-01 +6.9072e-03 0.0000e+00
+-2.2545e-01 -3.7073e-03 0.0000e+00
+-1.8240e-01 -9.3975e-03 0.0000e+00
+-1.2322e-01 -8.7117e-03 0.0000e+00
+-7.4121e-02 -1.2895e-02 0.0000e+00
+-2.5107e-02 -2.6579e-02 0.0000e+00
++1.9132e-02 -3.0473e-02 0.0000e+00
++7.4901e-02 -3.4661e-02 0.0000e+00
++1.1917e-01 -3.9771e-02 0.0000e+00
++1.7520e-01 -4.6653e-02 0.0000e+00
++2.2541e-01 -4.6868e-02 0.0000e+00
++2.7587e-01 -5.3211e-02 0.0000e+00
++3.2034e-01 -5.2908e-02 0.0000e+00
++3.7367e-01 -6.5751e-02 0.0000e+00
++4.2195e-01 -6.4111e-02 0.0000e+00
++4.7704e-01 -7.1929e-02 0.0000e+00
++5.1864e-01 -7.5380e-02 0.0000e+00
++5.7081e-01 -8.0627e-02 0.0000e+00
++6.2555e-01 -8.9224e-02 0.0000e+00
++6.7190e-01 -9.2365e-02 0.0000e+00
++7.1842e-01 -9.7925e-02 0.0000e+00
+-7.1845e-01 +9.7540e-02 0.0000e+00
+-6.7243e-01 +9.6911e-02 0.0000e+00
+-6.2054e-01 +8.7638e-02 0.0000e+00
+-5.7525e-01 +8.4864e-02 0.0000e+00
+-5.2206e-01 +7.9615e-02 0.0000e+00
+-4.6963e-01 +6.9951e-02 0.0000e+00
+-4.2115e-01 +6.5646e-02 0.0000e+00
+-3.7364e-01 +5.7644e-02 0.0000e+00
+-3.2088e-01 +5.4205e-02 0.0000e+00
+-2.7455e-01 +5.0696e-02 0.0000e+00
+-2.2277e-01 +4.4707e-02 0.0000e+00
+-1.7219e-01 +4.4795e-02 0.0000e+00
+-1.2500e-01 +4.1420e-02 0.0000e+00
+-6.9124e-02 +2.9802e-02 0.0000e+00
+-2.3351e-02 +3.0454e-02 0.0000e+00
++3.1435e-02 +1.8977e-02 0.0000e+00
++7.4155e-02 +2.1174e-02 0.0000e+00
++1.2859e-01 +1.5180e-02 0.0000e+00
++1.7477e-01 +3.0996e-03 0.0000e+00
++2.2995e-01 -3.6224e-04 0.0000e+00
++2.8160e-01 -3.5522e-03 0.0000e+00
++3.2453e-01 -6.8074e-03 0.0000e+00
++3.7440e-01 -1.4708e-02 0.0000e+00
++4.3209e-01 -1.5238e-02 0.0000e+00
++4.7648e-01 -1.8361e-02 0.0000e+00
++5.2745e-01 -2.5262e-02 0.0000e+00
++5.7979e-01 -2.7873e-02 0.0000e+00
++6.2558e-01 -4.0603e-02 0.0000e+00
++6.8225e-01 -4.1087e-02 0.0000e+00
++7.2636e-01 -5.0369e-02 0.0000e+00
+-7.1458e-01 +1.4725e-01 0.0000e+00
+-6.7164e-01 +1.4352e-01 0.0000e+00
+-6.1711e-01 +1.4245e-01 0.0000e+00
+-5.6386e-01 +1.3051e-01 0.0000e+00
+-5.1736e-01 +1.3169e-01 0.0000e+00
+-4.6727e-01 +1.2043e-01 0.0000e+00
+-4.1832e-01 +1.1504e-01 0.0000e+00
+-3.6318e-01 +1.1073e-01 0.0000e+00
+-3.2024e-01 +1.1272e-01 0.0000e+00
+-2.6565e-01 +9.7425e-02 0.0000e+00
+-2.2198e-01 +9.4572e-02 0.0000e+00
+-1.6579e-01 +9.1456e-02 0.0000e+00
+-1.1943e-01 +9.1006e-02 0.0000e+00
+-6.8113e-02 +7.9602e-02 0.0000e+00
+-1.6762e-02 +8.1344e-02 0.0000e+00
++2.9561e-02 +7.2798e-02 0.0000e+00
++8.7399e-02 +6.7221e-02 0.0000e+00
++1.3364e-01 +6.0706e-02 0.0000e+00
++1.8585e-01 +6.1217e-02 0.0000e+00
++2.3169e-01 +5.5437e-02 0.0000e+00
++2.8141e-01 +4.3968e-02 0.0000e+00
++3.2902e-01 +4.1536e-02 0.0000e+00
++3.8233e-01 +3.8690e-02 0.0000e+00
++4.3194e-01 +2.7576e-02 0.0000e+00
++4.8309e-01 +3.1461e-02 0.0000e+00
++5.2953e-01 +2.2476e-02 0.0000e+00
++5.8168e-01 +1.5139e-02 0.0000e+00
++6.3225e-01 +1.7490e-02 0.0000e+00
++6.8429e-01 +7.1509e-03 0.0000e+00
++7.3092e-01 -1.9694e-03 0.0000e+00
+-7.1323e-01 +1.9666e-01 0.0000e+00
+-6.6415e-01 +1.9212e-01 0.0000e+00
+-6.1478e-01 +1.8873e-01 0.0000e+00
+-5.6101e-01 +1.8687e-01 0.0000e+00
+-5.1631e-01 +1.7587e-01 0.0000e+00
+-4.6676e-01 +1.6845e-01 0.0000e+00
+-4.1290e-01 +1.6406e-01 0.0000e+00
+-3.6497e-01 +1.6158e-01 0.0000e+00
+-3.0913e-01 +1.5221e-01 0.0000e+00
+-2.5914e-01 +1.5589e-01 0.0000e+00
+-2.1787e-01 +1.4402e-01 0.0000e+00
+-1.6667e-01 +1.3973e-01 0.0000e+00
+-1.1719e-01 +1.3511e-01 0.0000e+00
+-6.2144e-02 +1.3659e-01 0.0000e+00
+-1.0408e-02 +1.2578e-01 0.0000e+00
++4.1648e-02 +1.2133e-01 0.0000e+00
++8.4863e-02 +1.1589e-01 0.0000e+00
++1.3907e-01 +1.1241e-01 0.0000e+00
++1.8545e-01 +1.0905e-01 0.0000e+00
++2.3579e-01 +9.9846e-02 0.0000e+00
++2.9128e-01 +9.5989e-02 0.0000e+00
++3.3806e-01 +9.1948e-02 0.0000e+00
++3.8461e-01 +8.9998e-02 0.0000e+00
++4.3618e-01 +7.8835e-02 0.0000e+00
++4.8676e-01 +7.6546e-02 0.0000e+00
++5.3327e-01 +6.9266e-02 0.0000e+00
++5.9049e-01 +6.7493e-02 0.0000e+00
++6.4145e-01 +6.2191e-02 0.0000e+00
++6.9132e-01 +5.7230e-02 0.0000e+00
++7.4143e-01 +4.8316e-02 0.0000e+00
+-7.0268e-01 +2.5102e-01 0.0000e+00
+-6.5821e-01 +2.3916e-01 0.0000e+00
+-6.1072e-01 +2.3558e-01 0.0000e+00
+-5.5819e-01 +2.3181e-01 0.0000e+00
+-5.0573e-01 +2.2886e-01 0.0000e+00
+-4.6120e-01 +2.2104e-01 0.0000e+00
+-4.0917e-01 +2.2257e-01 0.0000e+00
+-3.6061e-01 +2.0895e-01 0.0000e+00
+-3.0621e-01 +2.0301e-01 0.0000e+00
+-2.6216e-01 +2.0120e-01 0.0000e+00
+-2.0516e-01 +1.9486e-01 0.0000e+00
+-1.6122e-01 +1.8969e-01 0.0000e+00
+-1.1157e-01 +1.8429e-01 0.0000e+00
+-5.6150e-02 +1.7972e-01 0.0000e+00
+-2.6350e-03 +1.7703e-01 0.0000e+00
++4.6638e-02 +1.7593e-01 0.0000e+00
++9.4881e-02 +1.6718e-01 0.0000e+00
++1.3881e-01 +1.6142e-01 0.0000e+00
++1.8951e-01 +1.5604e-01 0.0000e+00
++2.3789e-01 +1.5285e-01 0.0000e+00
++2.9340e-01 +1.4655e-01 0.0000e+00
++3.4244e-01 +1.4659e-01 0.0000e+00
++3.9185e-01 +1.4226e-01 0.0000e+00
++4.3970e-01 +1.3158e-01 0.0000e+00
++4.8986e-01 +1.3126e-01 0.0000e+00
++5.3969e-01 +1.1975e-01 0.0000e+00
++5.9382e-01 +1.2137e-01 0.0000e+00
++6.4348e-01 +1.0902e-01 0.0000e+00
++6.9351e-01 +1.0515e-01 0.0000e+00
++7.4027e-01 +1.0692e-01 0.0000e+00
+-6.5290e-01 +2.9161e-01 0.0000e+00
+-6.0504e-01 +2.8476e-01 0.0000e+00
+-5.5126e-01 +2.7872e-01 0.0000e+00
+-5.0496e-01 +2.7417e-01 0.0000e+00
+-4.5491e-01 +2.7647e-01 0.0000e+00
+-3.9871e-01 +2.6374e-01 0.0000e+00
+-3.4998e-01 +2.6197e-01 0.0000e+00
+-3.0195e-01 +2.5921e-01 0.0000e+00
+-2.5072e-01 +2.5135e-01 0.0000e+00
+-2.0174e-01 +2.4255e-01 0.0000e+00
+-1.5678e-01 +2.4182e-01 0.0000e+00
+-9.7385e-02 +2.4087e-01 0.0000e+00
+-5.4511e-02 +2.3010e-01 0.0000e+00
+-4.1169e-03 +2.2594e-01 0.0000e+00
++4.7517e-02 +2.2487e-01 0.0000e+00
++9.3352e-02 +2.1309e-01 0.0000e+00
++1.4390e-01 +2.1335e-01 0.0000e+00
++1.9382e-01 +2.0766e-01 0.0000e+00
++2.5208e-01 +2.0464e-01 0.0000e+00
++2.9766e-01 +1.9934e-01 0.0000e+00
++3.4457e-01 +1.8946e-01 0.0000e+00
++3.9450e-01 +1.9193e-01 0.0000e+00
++4.4835e-01 +1.8520e-01 0.0000e+00
++4.9674e-01 +1.7371e-01 0.0000e+00
++5.4651e-01 +1.6941e-01 0.0000e+00
++6.0181e-01 +1.7177e-01 0.0000e+00
++6.4698e-01 +1.6184e-01 0.0000e+00
++6.9361e-01 +1.5645e-01 0.0000e+00
+-6.5206e-01 +3.4251e-01 0.0000e+00
+-6.0016e-01 +3.3986e-01 0.0000e+00
+-5.4609e-01 +3.3627e-01 0.0000e+00
+-4.9662e-01 +3.2551e-01 0.0000e+00
+-4.5250e-01 +3.2274e-01 0.0000e+00
+-4.0068e-01 +3.1820e-01 0.0000e+00
+-3.5236e-01 +3.1355e-01 0.0000e+00
+-3.0216e-01 +3.0320e-01 0.0000e+00
+-2.5135e-01 +3.0380e-01 0.0000e+00
+-1.9819e-01 +2.9852e-01 0.0000e+00
+-1.5213e-01 +2.9563e-01 0.0000e+00
+-1.0076e-01 +2.9072e-01 0.0000e+00
+-4.7634e-02 +2.8366e-01 0.0000e+00
++6.5993e-03 +2.7365e-01 0.0000e+00
++5.0197e-02 +2.7594e-01 0.0000e+00
++1.0526e-01 +2.6306e-01 0.0000e+00
++1.5143e-01 +2.5904e-01 0.0000e+00
++2.0335e-01 +2.5472e-01 0.0000e+00
++2.5443e-01 +2.4748e-01 0.0000e+00
++2.9948e-01 +2.4999e-01 0.0000e+00
++3.5366e-01 +2.3771e-01 0.0000e+00
++3.9969e-01 +2.3277e-01 0.0000e+00
++4.4767e-01 +2.3386e-01 0.0000e+00
++5.0396e-01 +2.2456e-01 0.0000e+00
++5.5117e-01 +2.1789e-01 0.0000e+00
++6.0581e-01 +2.1750e-01 0.0000e+00
++6.5403e-01 +2.1049e-01 0.0000e+00
++7.0589e-01 +2.0654e-01 0.0000e+00
+-5.9583e-01 +3.9051e-01 0.0000e+00
+-5.4612e-01 +3.8522e-01 0.0000e+00
+-4.9291e-01 +3.7565e-01 0.0000e+00
+-4.4166e-01 +3.7147e-01 0.0000e+00
+-3.9232e-01 +3.7111e-01 0.0000e+00
+-3.4103e-01 +3.6205e-01 0.0000e+00
+-2.9555e-01 +3.5885e-01 0.0000e+00
+-2.3871e-01 +3.5128e-01 0.0000e+00
+-1.9222e-01 +3.4643e-01 0.0000e+00
+-1.4400e-01 +3.4742e-01 0.0000e+00
+-9.3342e-02 +3.3300e-01 0.0000e+00
+-4.6073e-02 +3.3277e-01 0.0000e+00
++2.1673e-03 +3.2352e-01 0.0000e+00
++6.0477e-02 +3.1910e-01 0.0000e+00
++1.1177e-01 +3.2135e-01 0.0000e+00
++1.5326e-01 +3.1751e-01 0.0000e+00
++2.0589e-01 +3.0740e-01 0.0000e+00
++2.5223e-01 +2.9998e-01 0.0000e+00
++3.0828e-01 +2.9933e-01 0.0000e+00
++3.5842e-01 +2.8750e-01 0.0000e+00
++4.0426e-01 +2.8782e-01 0.0000e+00
++4.5780e-01 +2.7967e-01 0.0000e+00
++5.1039e-01 +2.7503e-01 0.0000e+00
++5.5462e-01 +2.6897e-01 0.0000e+00
++6.0946e-01 +2.6935e-01 0.0000e+00
++6.5761e-01 +2.6340e-01 0.0000e+00
++7.0344e-01 +2.5509e-01 0.0000e+00
+-5.9032e-01 +4.4023e-01 0.0000e+00
+-5.3942e-01 +4.3418e-01 0.0000e+00
+-4.9282e-01 +4.2320e-01 0.0000e+00
+-4.3818e-01 +4.2592e-01 0.0000e+00
+-3.8366e-01 +4.1355e-01 0.0000e+00
+-3.4258e-01 +4.0904e-01 0.0000e+00
+-2.8878e-01 +4.0690e-01 0.0000e+00
+-2.3678e-01 +4.0355e-01 0.0000e+00
+-1.8500e-01 +4.0100e-01 0.0000e+00
+-1.3917e-01 +3.9639e-01 0.0000e+00
+-8.4378e-02 +3.8389e-01 0.0000e+00
+-3.5929e-02 +3.7848e-01 0.0000e+00
++1.3964e-02 +3.7716e-01 0.0000e+00
++6.5261e-02 +3.7219e-01 0.0000e+00
++1.0821e-01 +3.6601e-01 0.0000e+00
++1.6135e-01 +3.6318e-01 0.0000e+00
++2.1683e-01 +3.5239e-01 0.0000e+00
++2.6117e-01 +3.4927e-01 0.0000e+00
++3.0869e-01 +3.5053e-01 0.0000e+00
++3.6408e-01 +3.4542e-01 0.0000e+00
++4.1080e-01 +3.3526e-01 0.0000e+00
++4.6166e-01 +3.3233e-01 0.0000e+00
++5.1234e-01 +3.2646e-01 0.0000e+00
++5.6500e-01 +3.2117e-01 0.0000e+00
++6.1663e-01 +3.2082e-01 0.0000e+00
++6.6519e-01 +3.1093e-01 0.0000e+00
+-5.3379e-01 +4.7953e-01 0.0000e+00
+-4.8574e-01 +4.7932e-01 0.0000e+00
+-4.2797e-01 +4.7258e-01 0.0000e+00
+-3.8566e-01 +4.6739e-01 0.0000e+00
+-3.3404e-01 +4.6567e-01 0.0000e+00
+-2.8173e-01 +4.5657e-01 0.0000e+00
+-2.2958e-01 +4.5689e-01 0.0000e+00
+-1.8488e-01 +4.4357e-01 0.0000e+00
+-1.3225e-01 +4.3934e-01 0.0000e+00
+-8.1528e-02 +4.3306e-01 0.0000e+00
+-3.0535e-02 +4.2832e-01 0.0000e+00
++2.1649e-02 +4.2280e-01 0.0000e+00
++6.2965e-02 +4.2238e-01 0.0000e+00
++1.1888e-01 +4.1595e-01 0.0000e+00
++1.6473e-01 +4.1232e-01 0.0000e+00
++2.2040e-01 +4.0619e-01 0.0000e+00
++2.6409e-01 +4.0269e-01 0.0000e+00
++3.1766e-01 +3.9660e-01 0.0000e+00
++3.6764e-01 +3.9659e-01 0.0000e+00
++4.1277e-01 +3.8886e-01 0.0000e+00
++4.6281e-01 +3.8288e-01 0.0000e+00
++5.1934e-01 +3.7482e-01 0.0000e+00
++5.6373e-01 +3.6942e-01 0.0000e+00
++6.1737e-01 +3.6481e-01 0.0000e+00
+-5.3088e-01 +5.3478e-01 0.0000e+00
+-4.7556e-01 +5.3114e-01 0.0000e+00
+-4.2803e-01 +5.2653e-01 0.0000e+00
+-3.8011e-01 +5.2153e-01 0.0000e+00
+-3.2371e-01 +5.1603e-01 0.0000e+00
+-2.8095e-01 +5.0660e-01 0.0000e+00
+-2.2741e-01 +5.0042e-01 0.0000e+00
+-1.8180e-01 +4.9750e-01 0.0000e+00
+-1.3215e-01 +4.8981e-01 0.0000e+00
+-7.7576e-02 +4.9251e-01 0.0000e+00
+-2.6685e-02 +4.8097e-01 0.0000e+00
++2.6113e-02 +4.7726e-01 0.0000e+00
++6.8803e-02 +4.7612e-01 0.0000e+00
++1.1860e-01 +4.6729e-01 0.0000e+00
++1.7067e-01 +4.6708e-01 0.0000e+00
++2.2166e-01 +4.5801e-01 0.0000e+00
++2.7007e-01 +4.5492e-01 0.0000e+00
++3.2271e-01 +4.4465e-01 0.0000e+00
++3.6774e-01 +4.4401e-01 0.0000e+00
++4.2399e-01 +4.3545e-01 0.0000e+00
++4.7667e-01 +4.2766e-01 0.0000e+00
++5.2332e-01 +4.2878e-01 0.0000e+00
++5.6936e-01 +4.2335e-01 0.0000e+00
++6.2397e-01 +4.2007e-01 0.0000e+00
+-4.7204e-01 +5.8050e-01 0.0000e+00
+-4.1974e-01 +5.7464e-01 0.0000e+00
+-3.7194e-01 +5.7006e-01 0.0000e+00
+-3.2508e-01 +5.6329e-01 0.0000e+00
+-2.7257e-01 +5.5805e-01 0.0000e+00
+-2.2620e-01 +5.4959e-01 0.0000e+00
+-1.7036e-01 +5.4501e-01 0.0000e+00
+-1.1786e-01 +5.3844e-01 0.0000e+00
+-6.9325e-02 +5.4115e-01 0.0000e+00
+-2.0908e-02 +5.3613e-01 0.0000e+00
++3.1882e-02 +5.3019e-01 0.0000e+00
++7.3381e-02 +5.2360e-01 0.0000e+00
++1.2940e-01 +5.1582e-01 0.0000e+00
++1.8146e-01 +5.1277e-01 0.0000e+00
++2.2327e-01 +5.1229e-01 0.0000e+00
++2.7397e-01 +5.0372e-01 0.0000e+00
++3.3218e-01 +5.0092e-01 0.0000e+00
++3.8146e-01 +4.9585e-01 0.0000e+00
++4.2325e-01 +4.9026e-01 0.0000e+00
++4.7919e-01 +4.7773e-01 0.0000e+00
++5.3020e-01 +4.7341e-01 0.0000e+00
++5.7632e-01 +4.7503e-01 0.0000e+00
+-4.1380e-01 +6.2714e-01 0.0000e+00
+-3.7200e-01 +6.1884e-01 0.0000e+00
+-3.2140e-01 +6.1275e-01 0.0000e+00
+-2.6805e-01 +6.1074e-01 0.0000e+00
+-2.1837e-01 +6.0054e-01 0.0000e+00
+-1.6446e-01 +6.0214e-01 0.0000e+00
+-1.1210e-01 +5.9675e-01 0.0000e+00
+-7.0294e-02 +5.9104e-01 0.0000e+00
+-1.5543e-02 +5.7758e-01 0.0000e+00
++3.4845e-02 +5.7848e-01 0.0000e+00
++8.1785e-02 +5.7498e-01 0.0000e+00
++1.3569e-01 +5.6346e-01 0.0000e+00
++1.8284e-01 +5.6218e-01 0.0000e+00
++2.2860e-01 +5.6056e-01 0.0000e+00
++2.8358e-01 +5.5162e-01 0.0000e+00
++3.3624e-01 +5.4643e-01 0.0000e+00
++3.7900e-01 +5.4762e-01 0.0000e+00
++4.3162e-01 +5.3450e-01 0.0000e+00
++4.8479e-01 +5.2738e-01 0.0000e+00
++5.3719e-01 +5.2855e-01 0.0000e+00
+-3.1471e-01 +6.6000e-01 0.0000e+00
+-2.6252e-01 +6.6103e-01 0.0000e+00
+-2.1426e-01 +6.5398e-01 0.0000e+00
+-1.6587e-01 +6.4692e-01 0.0000e+00
+-1.1683e-01 +6.4181e-01 0.0000e+00
+-6.2074e-02 +6.3723e-01 0.0000e+00
+-1.7612e-02 +6.2801e-01 0.0000e+00
++4.1875e-02 +6.2496e-01 0.0000e+00
++9.0094e-02 +6.2206e-01 0.0000e+00
++1.4092e-01 +6.1301e-01 0.0000e+00
++1.9009e-01 +6.1505e-01 0.0000e+00
++2.3377e-01 +6.1204e-01 0.0000e+00
++2.8821e-01 +6.0336e-01 0.0000e+00
++3.4085e-01 +6.0076e-01 0.0000e+00
++3.9200e-01 +5.9454e-01 0.0000e+00
++4.3588e-01 +5.8625e-01 0.0000e+00
+-2.0511e-01 +7.0486e-01 0.0000e+00
+-1.5820e-01 +6.9493e-01 0.0000e+00
+-1.0587e-01 +6.9034e-01 0.0000e+00
+-5.6428e-02 +6.8270e-01 0.0000e+00
+-9.7546e-03 +6.8225e-01 0.0000e+00
++4.6687e-02 +6.7971e-01 0.0000e+00
++9.0004e-02 +6.7102e-01 0.0000e+00
++1.4755e-01 +6.7138e-01 0.0000e+00
++1.9425e-01 +6.6604e-01 0.0000e+00
++2.3881e-01 +6.5549e-01 0.0000e+00
++2.9616e-01 +6.5581e-01 0.0000e+00
++3.4409e-01 +6.4940e-01 0.0000e+00
+-1.0393e-01 +7.4224e-01 0.0000e+00
+-5.2483e-02 +7.4080e-01 0.0000e+00
+-7.2034e-04 +7.3406e-01 0.0000e+00
++4.3031e-02 +7.2874e-01 0.0000e+00
++9.6992e-02 +7.2129e-01 0.0000e+00
++1.5078e-01 +7.1335e-01 0.0000e+00
++1.9893e-01 +7.1084e-01 0.0000e+00
++2.4783e-01 +7.0599e-01 0.0000e+00
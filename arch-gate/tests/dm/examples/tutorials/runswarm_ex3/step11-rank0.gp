@@ -0,0 +1,711 @@
+-7.6625e-01 -1.8251e-01 0.0000e+00
+-7.3670e-01 -2.3510e-01 0.0000e+00
+-7.1853e-01 -2.8419e-01 0.0000e+00
+-6.9114e-01 -3.2809e-01 0.0000e+00
+-6.7489e-01 -3.7043e-01 0.0000e+00
+-6.4493e-01 -4.2598e-01 0.0000e+00
+-6.2312e-01 -4.7228e-01 0.0000e+00
+-5.9370e-01 -5.1687e-01 0.0000e+00
+-7.9176e-01 -2.1071e-02 0.0000e+00
+-7.6985e-01 -7.1751e-02 0.0000e+00
+-7.4496e-01 -1.1996e-01 0.0000e+00
+-7.2050e-01 -1.6598e-01 0.0000e+00
+-6.9556e-01 -2.1016e-01 0.0000e+00
+-6.7604e-01 -2.5438e-01 0.0000e+00
+-6.5125e-01 -3.0349e-01 0.0000e+00
+-6.2376e-01 -3.4585e-01 0.0000e+00
+-5.9451e-01 -3.9839e-01 0.0000e+00
+-5.7366e-01 -4.3825e-01 0.0000e+00
+-5.5077e-01 -4.9158e-01 0.0000e+00
+-5.2454e-01 -5.4244e-01 0.0000e+00
+-4.9924e-01 -5.8403e-01 0.0000e+00
+-7.7497e-01 +5.2442e-02 0.0000e+00
+-7.4680e-01 -2.0819e-03 0.0000e+00
+-7.1798e-01 -3.9110e-02 0.0000e+00
+-6.9932e-01 -9.1060e-02 0.0000e+00
+-6.7450e-01 -1.3541e-01 0.0000e+00
+-6.4573e-01 -1.8605e-01 0.0000e+00
+-6.2141e-01 -2.3501e-01 0.0000e+00
+-6.0341e-01 -2.7878e-01 0.0000e+00
+-5.7673e-01 -3.2693e-01 0.0000e+00
+-5.4721e-01 -3.7388e-01 0.0000e+00
+-5.2732e-01 -4.2180e-01 0.0000e+00
+-5.0432e-01 -4.6799e-01 0.0000e+00
+-4.7814e-01 -5.1145e-01 0.0000e+00
+-4.5641e-01 -5.6140e-01 0.0000e+00
+-4.2534e-01 -6.0546e-01 0.0000e+00
+-4.0727e-01 -6.5479e-01 0.0000e+00
+-7.7167e-01 +1.6484e-01 0.0000e+00
+-7.4678e-01 +1.1807e-01 0.0000e+00
+-7.2425e-01 +7.7491e-02 0.0000e+00
+-6.9239e-01 +2.9425e-02 0.0000e+00
+-6.6999e-01 -1.6667e-02 0.0000e+00
+-6.4893e-01 -6.4591e-02 0.0000e+00
+-6.2638e-01 -1.1056e-01 0.0000e+00
+-6.0337e-01 -1.6181e-01 0.0000e+00
+-5.7870e-01 -2.0722e-01 0.0000e+00
+-5.4886e-01 -2.5065e-01 0.0000e+00
+-5.2654e-01 -3.0174e-01 0.0000e+00
+-5.0173e-01 -3.4147e-01 0.0000e+00
+-4.7805e-01 -3.9409e-01 0.0000e+00
+-4.5519e-01 -4.3701e-01 0.0000e+00
+-4.2814e-01 -4.8784e-01 0.0000e+00
+-4.1174e-01 -5.3915e-01 0.0000e+00
+-3.8323e-01 -5.8717e-01 0.0000e+00
+-3.5389e-01 -6.3147e-01 0.0000e+00
+-3.3775e-01 -6.7506e-01 0.0000e+00
+-3.1422e-01 -7.2240e-01 0.0000e+00
+-7.4283e-01 +2.4103e-01 0.0000e+00
+-7.2417e-01 +1.9033e-01 0.0000e+00
+-6.9385e-01 +1.4807e-01 0.0000e+00
+-6.7172e-01 +1.0306e-01 0.0000e+00
+-6.4636e-01 +5.2399e-02 0.0000e+00
+-6.2910e-01 +2.3018e-03 0.0000e+00
+-6.0266e-01 -4.7822e-02 0.0000e+00
+-5.7981e-01 -8.7915e-02 0.0000e+00
+-5.5866e-01 -1.3720e-01 0.0000e+00
+-5.2789e-01 -1.7674e-01 0.0000e+00
+-5.0408e-01 -2.3311e-01 0.0000e+00
+-4.8294e-01 -2.8304e-01 0.0000e+00
+-4.5910e-01 -3.2802e-01 0.0000e+00
+-4.3448e-01 -3.7361e-01 0.0000e+00
+-4.0653e-01 -4.2240e-01 0.0000e+00
+-3.8295e-01 -4.6753e-01 0.0000e+00
+-3.6041e-01 -5.1532e-01 0.0000e+00
+-3.3874e-01 -5.5740e-01 0.0000e+00
+-3.1394e-01 -6.0631e-01 0.0000e+00
+-2.9100e-01 -6.5025e-01 0.0000e+00
+-2.6331e-01 -7.0339e-01 0.0000e+00
+-2.4235e-01 -7.5002e-01 0.0000e+00
+-7.2412e-01 +3.1248e-01 0.0000e+00
+-6.9894e-01 +2.6962e-01 0.0000e+00
+-6.7940e-01 +2.1641e-01 0.0000e+00
+-6.4987e-01 +1.6706e-01 0.0000e+00
+-6.2218e-01 +1.2047e-01 0.0000e+00
+-6.0158e-01 +7.2045e-02 0.0000e+00
+-5.8330e-01 +3.1861e-02 0.0000e+00
+-5.5749e-01 -2.1832e-02 0.0000e+00
+-5.3561e-01 -6.5308e-02 0.0000e+00
+-5.0151e-01 -1.1317e-01 0.0000e+00
+-4.8439e-01 -1.6144e-01 0.0000e+00
+-4.5647e-01 -2.0754e-01 0.0000e+00
+-4.3890e-01 -2.5484e-01 0.0000e+00
+-4.0728e-01 -2.9955e-01 0.0000e+00
+-3.8973e-01 -3.4971e-01 0.0000e+00
+-3.6242e-01 -3.9460e-01 0.0000e+00
+-3.3908e-01 -4.3857e-01 0.0000e+00
+-3.1323e-01 -4.8459e-01 0.0000e+00
+-2.9176e-01 -5.3946e-01 0.0000e+00
+-2.6809e-01 -5.8523e-01 0.0000e+00
+-2.3510e-01 -6.3035e-01 0.0000e+00
+-2.1799e-01 -6.7016e-01 0.0000e+00
+-1.8761e-01 -7.2408e-01 0.0000e+00
+-1.6655e-01 -7.7230e-01 0.0000e+00
+-6.8143e-01 +3.3452e-01 0.0000e+00
+-6.5314e-01 +2.9180e-01 0.0000e+00
+-6.2907e-01 +2.4179e-01 0.0000e+00
+-6.0612e-01 +1.8942e-01 0.0000e+00
+-5.7867e-01 +1.5259e-01 0.0000e+00
+-5.5427e-01 +1.0006e-01 0.0000e+00
+-5.2973e-01 +5.7717e-02 0.0000e+00
+-5.0302e-01 +5.5085e-03 0.0000e+00
+-4.8040e-01 -3.8690e-02 0.0000e+00
+-4.6500e-01 -8.4663e-02 0.0000e+00
+-4.4027e-01 -1.3529e-01 0.0000e+00
+-4.1085e-01 -1.8555e-01 0.0000e+00
+-3.8942e-01 -2.2981e-01 0.0000e+00
+-3.6216e-01 -2.7968e-01 0.0000e+00
+-3.3714e-01 -3.1579e-01 0.0000e+00
+-3.1398e-01 -3.6495e-01 0.0000e+00
+-2.9168e-01 -4.1606e-01 0.0000e+00
+-2.7273e-01 -4.6219e-01 0.0000e+00
+-2.4096e-01 -5.0658e-01 0.0000e+00
+-2.1387e-01 -5.5903e-01 0.0000e+00
+-1.9464e-01 -6.0003e-01 0.0000e+00
+-1.6792e-01 -6.5539e-01 0.0000e+00
+-1.5208e-01 -6.9793e-01 0.0000e+00
+-1.2288e-01 -7.4117e-01 0.0000e+00
+-6.5596e-01 +4.0661e-01 0.0000e+00
+-6.3139e-01 +3.5869e-01 0.0000e+00
+-6.0171e-01 +3.1234e-01 0.0000e+00
+-5.8134e-01 +2.6852e-01 0.0000e+00
+-5.6014e-01 +2.2265e-01 0.0000e+00
+-5.3604e-01 +1.7159e-01 0.0000e+00
+-5.0946e-01 +1.1919e-01 0.0000e+00
+-4.8745e-01 +8.0829e-02 0.0000e+00
+-4.5872e-01 +3.1337e-02 0.0000e+00
+-4.3746e-01 -1.8567e-02 0.0000e+00
+-4.1240e-01 -6.4693e-02 0.0000e+00
+-3.8579e-01 -1.0923e-01 0.0000e+00
+-3.6193e-01 -1.5565e-01 0.0000e+00
+-3.4668e-01 -2.0194e-01 0.0000e+00
+-3.1298e-01 -2.5046e-01 0.0000e+00
+-2.9258e-01 -2.9495e-01 0.0000e+00
+-2.6415e-01 -3.4235e-01 0.0000e+00
+-2.4962e-01 -3.9073e-01 0.0000e+00
+-2.2018e-01 -4.3643e-01 0.0000e+00
+-1.9015e-01 -4.8631e-01 0.0000e+00
+-1.7149e-01 -5.3548e-01 0.0000e+00
+-1.5155e-01 -5.7947e-01 0.0000e+00
+-1.2848e-01 -6.2783e-01 0.0000e+00
+-9.6605e-02 -6.7067e-01 0.0000e+00
+-8.0200e-02 -7.1959e-01 0.0000e+00
+-4.7507e-02 -7.7049e-01 0.0000e+00
+-6.3182e-01 +4.7113e-01 0.0000e+00
+-6.0284e-01 +4.2807e-01 0.0000e+00
+-5.7893e-01 +3.8016e-01 0.0000e+00
+-5.6149e-01 +3.3149e-01 0.0000e+00
+-5.3081e-01 +2.9090e-01 0.0000e+00
+-5.1025e-01 +2.4779e-01 0.0000e+00
+-4.8643e-01 +1.9258e-01 0.0000e+00
+-4.5940e-01 +1.5362e-01 0.0000e+00
+-4.3762e-01 +1.0731e-01 0.0000e+00
+-4.1585e-01 +5.0199e-02 0.0000e+00
+-3.9251e-01 +1.6242e-03 0.0000e+00
+-3.6308e-01 -3.4713e-02 0.0000e+00
+-3.4333e-01 -8.7965e-02 0.0000e+00
+-3.1668e-01 -1.3364e-01 0.0000e+00
+-2.8698e-01 -1.8144e-01 0.0000e+00
+-2.6673e-01 -2.2259e-01 0.0000e+00
+-2.4200e-01 -2.7015e-01 0.0000e+00
+-2.2039e-01 -3.2084e-01 0.0000e+00
+-1.9849e-01 -3.7196e-01 0.0000e+00
+-1.7645e-01 -4.1638e-01 0.0000e+00
+-1.5050e-01 -4.6299e-01 0.0000e+00
+-1.2094e-01 -5.0918e-01 0.0000e+00
+-1.0174e-01 -5.5594e-01 0.0000e+00
+-8.0457e-02 -6.0480e-01 0.0000e+00
+-5.3731e-02 -6.5046e-01 0.0000e+00
+-2.8664e-02 -6.9529e-01 0.0000e+00
+-2.0105e-03 -7.4727e-01 0.0000e+00
+-5.7728e-01 +4.9953e-01 0.0000e+00
+-5.6478e-01 +4.5313e-01 0.0000e+00
+-5.4075e-01 +4.0948e-01 0.0000e+00
+-5.1703e-01 +3.6326e-01 0.0000e+00
+-4.9123e-01 +3.1035e-01 0.0000e+00
+-4.6653e-01 +2.6542e-01 0.0000e+00
+-4.4144e-01 +2.1374e-01 0.0000e+00
+-4.1272e-01 +1.7757e-01 0.0000e+00
+-3.9276e-01 +1.2232e-01 0.0000e+00
+-3.6615e-01 +7.6730e-02 0.0000e+00
+-3.4571e-01 +3.5727e-02 0.0000e+00
+-3.1928e-01 -1.5747e-02 0.0000e+00
+-2.9495e-01 -5.8145e-02 0.0000e+00
+-2.6978e-01 -1.0497e-01 0.0000e+00
+-2.4402e-01 -1.5832e-01 0.0000e+00
+-2.2135e-01 -2.0296e-01 0.0000e+00
+-1.9543e-01 -2.4653e-01 0.0000e+00
+-1.6782e-01 -2.9871e-01 0.0000e+00
+-1.4887e-01 -3.4523e-01 0.0000e+00
+-1.2589e-01 -3.9020e-01 0.0000e+00
+-1.0410e-01 -4.3408e-01 0.0000e+00
+-7.8241e-02 -4.8366e-01 0.0000e+00
+-5.3857e-02 -5.3240e-01 0.0000e+00
+-2.2595e-02 -5.8127e-01 0.0000e+00
+-5.4790e-03 -6.2894e-01 0.0000e+00
++2.0590e-02 -6.7141e-01 0.0000e+00
++4.2895e-02 -7.2353e-01 0.0000e+00
++6.7910e-02 -7.6674e-01 0.0000e+00
+-5.3891e-01 +5.2440e-01 0.0000e+00
+-5.1419e-01 +4.8278e-01 0.0000e+00
+-4.8873e-01 +4.3052e-01 0.0000e+00
+-4.6789e-01 +3.8150e-01 0.0000e+00
+-4.3572e-01 +3.3463e-01 0.0000e+00
+-4.1558e-01 +2.9236e-01 0.0000e+00
+-3.9843e-01 +2.4471e-01 0.0000e+00
+-3.7088e-01 +1.9465e-01 0.0000e+00
+-3.4039e-01 +1.5092e-01 0.0000e+00
+-3.2002e-01 +1.0007e-01 0.0000e+00
+-2.9960e-01 +5.7533e-02 0.0000e+00
+-2.7509e-01 +4.1413e-03 0.0000e+00
+-2.4179e-01 -4.0848e-02 0.0000e+00
+-2.2558e-01 -8.0961e-02 0.0000e+00
+-1.9419e-01 -1.3358e-01 0.0000e+00
+-1.7769e-01 -1.8352e-01 0.0000e+00
+-1.5194e-01 -2.2212e-01 0.0000e+00
+-1.3143e-01 -2.7510e-01 0.0000e+00
+-1.0237e-01 -3.2111e-01 0.0000e+00
+-8.1101e-02 -3.7016e-01 0.0000e+00
+-5.2675e-02 -4.0764e-01 0.0000e+00
+-3.5534e-02 -4.6195e-01 0.0000e+00
+-2.6688e-03 -5.1161e-01 0.0000e+00
++1.3065e-02 -5.5399e-01 0.0000e+00
++4.6040e-02 -6.0010e-01 0.0000e+00
++7.1594e-02 -6.4978e-01 0.0000e+00
++8.8240e-02 -6.9384e-01 0.0000e+00
++1.1604e-01 -7.4350e-01 0.0000e+00
+-5.1529e-01 +6.0120e-01 0.0000e+00
+-4.8864e-01 +5.4745e-01 0.0000e+00
+-4.6373e-01 +5.0817e-01 0.0000e+00
+-4.3691e-01 +4.5373e-01 0.0000e+00
+-4.1769e-01 +4.1117e-01 0.0000e+00
+-3.8767e-01 +3.6154e-01 0.0000e+00
+-3.6806e-01 +3.1863e-01 0.0000e+00
+-3.4972e-01 +2.6508e-01 0.0000e+00
+-3.2255e-01 +2.1820e-01 0.0000e+00
+-2.9538e-01 +1.7158e-01 0.0000e+00
+-2.7285e-01 +1.2483e-01 0.0000e+00
+-2.5034e-01 +8.1166e-02 0.0000e+00
+-2.2553e-01 +3.3499e-02 0.0000e+00
+-2.0251e-01 -1.1094e-02 0.0000e+00
+-1.7199e-01 -6.4415e-02 0.0000e+00
+-1.5801e-01 -1.0692e-01 0.0000e+00
+-1.3272e-01 -1.5699e-01 0.0000e+00
+-1.0335e-01 -2.0196e-01 0.0000e+00
+-8.2260e-02 -2.5262e-01 0.0000e+00
+-5.6209e-02 -2.9340e-01 0.0000e+00
+-3.2824e-02 -3.4637e-01 0.0000e+00
+-9.3156e-03 -3.8639e-01 0.0000e+00
++1.4395e-02 -4.3757e-01 0.0000e+00
++4.3946e-02 -4.8608e-01 0.0000e+00
++6.6549e-02 -5.2869e-01 0.0000e+00
++8.5845e-02 -5.8070e-01 0.0000e+00
++1.1204e-01 -6.2281e-01 0.0000e+00
++1.3780e-01 -6.7217e-01 0.0000e+00
++1.5876e-01 -7.2094e-01 0.0000e+00
++1.8198e-01 -7.6495e-01 0.0000e+00
+-4.6447e-01 +6.2282e-01 0.0000e+00
+-4.4200e-01 +5.7593e-01 0.0000e+00
+-4.2035e-01 +5.2766e-01 0.0000e+00
+-3.9547e-01 +4.8419e-01 0.0000e+00
+-3.7327e-01 +4.3487e-01 0.0000e+00
+-3.4038e-01 +3.8502e-01 0.0000e+00
+-3.2267e-01 +3.3513e-01 0.0000e+00
+-2.9688e-01 +2.9539e-01 0.0000e+00
+-2.7507e-01 +2.5012e-01 0.0000e+00
+-2.4868e-01 +1.9493e-01 0.0000e+00
+-2.2736e-01 +1.4811e-01 0.0000e+00
+-2.0407e-01 +1.0388e-01 0.0000e+00
+-1.7940e-01 +6.0258e-02 0.0000e+00
+-1.4736e-01 +8.9640e-03 0.0000e+00
+-1.2682e-01 -3.5506e-02 0.0000e+00
+-1.0041e-01 -8.5910e-02 0.0000e+00
+-8.3102e-02 -1.2894e-01 0.0000e+00
+-6.1655e-02 -1.7770e-01 0.0000e+00
+-3.4247e-02 -2.2518e-01 0.0000e+00
+-8.8727e-03 -2.7304e-01 0.0000e+00
++1.0434e-02 -3.1729e-01 0.0000e+00
++3.7833e-02 -3.6765e-01 0.0000e+00
++5.9187e-02 -4.1529e-01 0.0000e+00
++8.8632e-02 -4.6124e-01 0.0000e+00
++1.0592e-01 -5.0394e-01 0.0000e+00
++1.3778e-01 -5.4669e-01 0.0000e+00
++1.5779e-01 -6.0143e-01 0.0000e+00
++1.8028e-01 -6.4673e-01 0.0000e+00
++2.0811e-01 -6.9735e-01 0.0000e+00
++2.3671e-01 -7.4062e-01 0.0000e+00
+-4.2205e-01 +6.3915e-01 0.0000e+00
+-3.9368e-01 +5.9409e-01 0.0000e+00
+-3.6741e-01 +5.5340e-01 0.0000e+00
+-3.5449e-01 +5.0604e-01 0.0000e+00
+-3.2664e-01 +4.6048e-01 0.0000e+00
+-2.9804e-01 +4.1631e-01 0.0000e+00
+-2.7683e-01 +3.6374e-01 0.0000e+00
+-2.4732e-01 +3.1287e-01 0.0000e+00
+-2.2446e-01 +2.7099e-01 0.0000e+00
+-2.0129e-01 +2.1992e-01 0.0000e+00
+-1.7553e-01 +1.7860e-01 0.0000e+00
+-1.5158e-01 +1.2755e-01 0.0000e+00
+-1.3685e-01 +8.1715e-02 0.0000e+00
+-1.0435e-01 +3.4074e-02 0.0000e+00
+-8.1257e-02 -1.5017e-02 0.0000e+00
+-5.5894e-02 -5.9965e-02 0.0000e+00
+-3.6088e-02 -1.0635e-01 0.0000e+00
+-9.1731e-03 -1.5578e-01 0.0000e+00
++1.5095e-02 -2.0460e-01 0.0000e+00
++4.2609e-02 -2.4952e-01 0.0000e+00
++6.2136e-02 -2.9340e-01 0.0000e+00
++9.2758e-02 -3.4352e-01 0.0000e+00
++1.0821e-01 -3.9367e-01 0.0000e+00
++1.3147e-01 -4.3806e-01 0.0000e+00
++1.6068e-01 -4.7802e-01 0.0000e+00
++1.7852e-01 -5.2868e-01 0.0000e+00
++2.0277e-01 -5.7352e-01 0.0000e+00
++2.2743e-01 -6.1992e-01 0.0000e+00
++2.5211e-01 -6.7181e-01 0.0000e+00
++2.8321e-01 -7.1392e-01 0.0000e+00
+-3.7330e-01 +6.7089e-01 0.0000e+00
+-3.5187e-01 +6.2354e-01 0.0000e+00
+-3.2393e-01 +5.7936e-01 0.0000e+00
+-2.9988e-01 +5.3359e-01 0.0000e+00
+-2.7685e-01 +4.7913e-01 0.0000e+00
+-2.4949e-01 +4.3617e-01 0.0000e+00
+-2.2645e-01 +3.8417e-01 0.0000e+00
+-2.0162e-01 +3.4244e-01 0.0000e+00
+-1.8396e-01 +2.9336e-01 0.0000e+00
+-1.5234e-01 +2.4890e-01 0.0000e+00
+-1.3195e-01 +1.9684e-01 0.0000e+00
+-1.1241e-01 +1.5561e-01 0.0000e+00
+-7.8021e-02 +1.0377e-01 0.0000e+00
+-5.3687e-02 +5.8052e-02 0.0000e+00
+-3.7787e-02 +6.9861e-03 0.0000e+00
+-1.5972e-02 -3.4278e-02 0.0000e+00
++1.2164e-02 -8.5885e-02 0.0000e+00
++3.2925e-02 -1.2787e-01 0.0000e+00
++5.8829e-02 -1.8124e-01 0.0000e+00
++8.7302e-02 -2.2568e-01 0.0000e+00
++1.1050e-01 -2.7383e-01 0.0000e+00
++1.3616e-01 -3.1291e-01 0.0000e+00
++1.5526e-01 -3.6729e-01 0.0000e+00
++1.8426e-01 -4.0896e-01 0.0000e+00
++2.0881e-01 -4.6205e-01 0.0000e+00
++2.2951e-01 -5.0073e-01 0.0000e+00
++2.5466e-01 -5.4977e-01 0.0000e+00
++2.7832e-01 -6.0299e-01 0.0000e+00
++3.0200e-01 -6.4568e-01 0.0000e+00
++3.2365e-01 -6.8990e-01 0.0000e+00
+-3.2400e-01 +6.8971e-01 0.0000e+00
+-2.9829e-01 +6.4874e-01 0.0000e+00
+-2.7686e-01 +5.9766e-01 0.0000e+00
+-2.5346e-01 +5.5611e-01 0.0000e+00
+-2.2773e-01 +5.0617e-01 0.0000e+00
+-2.0633e-01 +4.5438e-01 0.0000e+00
+-1.8246e-01 +4.0914e-01 0.0000e+00
+-1.6240e-01 +3.6264e-01 0.0000e+00
+-1.3532e-01 +3.1411e-01 0.0000e+00
+-1.1197e-01 +2.7123e-01 0.0000e+00
+-8.7701e-02 +2.2211e-01 0.0000e+00
+-5.8754e-02 +1.7753e-01 0.0000e+00
+-3.4795e-02 +1.3396e-01 0.0000e+00
+-1.3155e-02 +7.8013e-02 0.0000e+00
++1.3547e-02 +3.7991e-02 0.0000e+00
++3.4691e-02 -1.6910e-02 0.0000e+00
++6.1014e-02 -5.3357e-02 0.0000e+00
++8.6792e-02 -1.0481e-01 0.0000e+00
++1.0250e-01 -1.5247e-01 0.0000e+00
++1.3093e-01 -2.0314e-01 0.0000e+00
++1.5760e-01 -2.5054e-01 0.0000e+00
++1.7923e-01 -2.9029e-01 0.0000e+00
++2.0072e-01 -3.3880e-01 0.0000e+00
++2.3319e-01 -3.9002e-01 0.0000e+00
++2.5577e-01 -4.3098e-01 0.0000e+00
++2.7877e-01 -4.7989e-01 0.0000e+00
++3.0634e-01 -5.2758e-01 0.0000e+00
++3.2124e-01 -5.7526e-01 0.0000e+00
++3.5316e-01 -6.2554e-01 0.0000e+00
++3.7015e-01 -6.6976e-01 0.0000e+00
+-2.7793e-01 +7.1467e-01 0.0000e+00
+-2.5671e-01 +6.7465e-01 0.0000e+00
+-2.2653e-01 +6.2592e-01 0.0000e+00
+-2.0667e-01 +5.7211e-01 0.0000e+00
+-1.7908e-01 +5.3174e-01 0.0000e+00
+-1.6043e-01 +4.8111e-01 0.0000e+00
+-1.3725e-01 +4.3484e-01 0.0000e+00
+-1.0958e-01 +3.8372e-01 0.0000e+00
+-8.3314e-02 +3.4696e-01 0.0000e+00
+-6.5650e-02 +2.9004e-01 0.0000e+00
+-4.3242e-02 +2.4988e-01 0.0000e+00
+-1.3920e-02 +1.9851e-01 0.0000e+00
++1.2146e-02 +1.5734e-01 0.0000e+00
++3.1371e-02 +1.0555e-01 0.0000e+00
++6.2219e-02 +6.1222e-02 0.0000e+00
++8.1118e-02 +1.5464e-02 0.0000e+00
++1.0921e-01 -3.8761e-02 0.0000e+00
++1.2986e-01 -8.3291e-02 0.0000e+00
++1.6011e-01 -1.2908e-01 0.0000e+00
++1.8117e-01 -1.7282e-01 0.0000e+00
++1.9943e-01 -2.2325e-01 0.0000e+00
++2.2446e-01 -2.6665e-01 0.0000e+00
++2.5237e-01 -3.1532e-01 0.0000e+00
++2.7088e-01 -3.6545e-01 0.0000e+00
++3.0351e-01 -4.0838e-01 0.0000e+00
++3.2208e-01 -4.5448e-01 0.0000e+00
++3.4538e-01 -5.0469e-01 0.0000e+00
++3.7632e-01 -5.4799e-01 0.0000e+00
++3.9690e-01 -5.9981e-01 0.0000e+00
++4.1546e-01 -6.4617e-01 0.0000e+00
+-2.3355e-01 +7.4168e-01 0.0000e+00
+-2.0955e-01 +6.9578e-01 0.0000e+00
+-1.8435e-01 +6.5027e-01 0.0000e+00
+-1.5531e-01 +6.0176e-01 0.0000e+00
+-1.3950e-01 +5.5603e-01 0.0000e+00
+-1.1777e-01 +5.0807e-01 0.0000e+00
+-9.0894e-02 +4.5804e-01 0.0000e+00
+-6.5722e-02 +4.1432e-01 0.0000e+00
+-4.2122e-02 +3.5969e-01 0.0000e+00
+-1.0338e-02 +3.1767e-01 0.0000e+00
++2.7361e-03 +2.7448e-01 0.0000e+00
++2.8179e-02 +2.2684e-01 0.0000e+00
++5.2350e-02 +1.8054e-01 0.0000e+00
++8.5071e-02 +1.3281e-01 0.0000e+00
++1.0506e-01 +8.0981e-02 0.0000e+00
++1.3084e-01 +3.2497e-02 0.0000e+00
++1.5071e-01 -8.7451e-03 0.0000e+00
++1.7858e-01 -5.8564e-02 0.0000e+00
++2.0210e-01 -1.0142e-01 0.0000e+00
++2.2270e-01 -1.5110e-01 0.0000e+00
++2.5097e-01 -2.0227e-01 0.0000e+00
++2.7410e-01 -2.4585e-01 0.0000e+00
++2.9895e-01 -2.8805e-01 0.0000e+00
++3.1854e-01 -3.3993e-01 0.0000e+00
++3.4539e-01 -3.8588e-01 0.0000e+00
++3.6551e-01 -4.3108e-01 0.0000e+00
++3.9661e-01 -4.8259e-01 0.0000e+00
++4.2102e-01 -5.3059e-01 0.0000e+00
++4.4510e-01 -5.7743e-01 0.0000e+00
++4.6584e-01 -6.2674e-01 0.0000e+00
+-1.7956e-01 +7.6340e-01 0.0000e+00
+-1.6463e-01 +7.1739e-01 0.0000e+00
+-1.4069e-01 +6.7343e-01 0.0000e+00
+-1.1404e-01 +6.2492e-01 0.0000e+00
+-8.6699e-02 +5.7694e-01 0.0000e+00
+-6.8182e-02 +5.3318e-01 0.0000e+00
+-3.7125e-02 +4.8814e-01 0.0000e+00
+-2.1430e-02 +4.3751e-01 0.0000e+00
++4.3802e-03 +3.8611e-01 0.0000e+00
++2.7925e-02 +3.4620e-01 0.0000e+00
++5.4861e-02 +2.9228e-01 0.0000e+00
++7.5384e-02 +2.5055e-01 0.0000e+00
++9.8954e-02 +2.0366e-01 0.0000e+00
++1.2656e-01 +1.5214e-01 0.0000e+00
++1.5472e-01 +1.0337e-01 0.0000e+00
++1.8188e-01 +5.9263e-02 0.0000e+00
++2.0170e-01 +1.1691e-02 0.0000e+00
++2.2169e-01 -3.0368e-02 0.0000e+00
++2.4587e-01 -7.8182e-02 0.0000e+00
++2.7067e-01 -1.2269e-01 0.0000e+00
++2.9680e-01 -1.7528e-01 0.0000e+00
++3.2483e-01 -2.1853e-01 0.0000e+00
++3.4921e-01 -2.6461e-01 0.0000e+00
++3.6709e-01 -3.1293e-01 0.0000e+00
++3.9544e-01 -3.5738e-01 0.0000e+00
++4.1373e-01 -4.0792e-01 0.0000e+00
++4.4606e-01 -4.5478e-01 0.0000e+00
++4.6350e-01 -5.0565e-01 0.0000e+00
++4.8865e-01 -5.5201e-01 0.0000e+00
++5.1690e-01 -5.9226e-01 0.0000e+00
+-1.1533e-01 +7.4264e-01 0.0000e+00
+-9.4045e-02 +6.9649e-01 0.0000e+00
+-6.8679e-02 +6.4559e-01 0.0000e+00
+-4.6269e-02 +6.0212e-01 0.0000e+00
+-1.5667e-02 +5.5927e-01 0.0000e+00
++5.1726e-03 +5.0240e-01 0.0000e+00
++3.1427e-02 +4.5839e-01 0.0000e+00
++5.6407e-02 +4.1443e-01 0.0000e+00
++7.8717e-02 +3.6473e-01 0.0000e+00
++9.8901e-02 +3.1648e-01 0.0000e+00
++1.2393e-01 +2.7639e-01 0.0000e+00
++1.5699e-01 +2.2343e-01 0.0000e+00
++1.7195e-01 +1.7944e-01 0.0000e+00
++1.9704e-01 +1.3260e-01 0.0000e+00
++2.2557e-01 +8.6418e-02 0.0000e+00
++2.4133e-01 +3.9244e-02 0.0000e+00
++2.7042e-01 -5.2110e-03 0.0000e+00
++2.9390e-01 -5.2517e-02 0.0000e+00
++3.2448e-01 -1.0565e-01 0.0000e+00
++3.4582e-01 -1.4891e-01 0.0000e+00
++3.6388e-01 -1.9594e-01 0.0000e+00
++3.9456e-01 -2.3860e-01 0.0000e+00
++4.1936e-01 -2.8996e-01 0.0000e+00
++4.3684e-01 -3.3922e-01 0.0000e+00
++4.6145e-01 -3.8560e-01 0.0000e+00
++4.9509e-01 -4.3306e-01 0.0000e+00
++5.1212e-01 -4.7859e-01 0.0000e+00
++5.3398e-01 -5.2282e-01 0.0000e+00
+-6.9917e-02 +7.7095e-01 0.0000e+00
+-4.2639e-02 +7.2363e-01 0.0000e+00
+-1.4936e-02 +6.7387e-01 0.0000e+00
++3.8027e-03 +6.2407e-01 0.0000e+00
++2.6537e-02 +5.8355e-01 0.0000e+00
++5.2113e-02 +5.3523e-01 0.0000e+00
++7.5588e-02 +4.8994e-01 0.0000e+00
++9.5110e-02 +4.3972e-01 0.0000e+00
++1.2464e-01 +3.9522e-01 0.0000e+00
++1.5032e-01 +3.4530e-01 0.0000e+00
++1.7406e-01 +3.0300e-01 0.0000e+00
++1.9905e-01 +2.5486e-01 0.0000e+00
++2.2314e-01 +2.0394e-01 0.0000e+00
++2.4527e-01 +1.5037e-01 0.0000e+00
++2.7217e-01 +1.1320e-01 0.0000e+00
++2.9224e-01 +5.7262e-02 0.0000e+00
++3.1504e-01 +1.4218e-02 0.0000e+00
++3.4086e-01 -3.4064e-02 0.0000e+00
++3.6363e-01 -8.3276e-02 0.0000e+00
++3.9156e-01 -1.2160e-01 0.0000e+00
++4.1165e-01 -1.7643e-01 0.0000e+00
++4.3356e-01 -2.1986e-01 0.0000e+00
++4.6191e-01 -2.6158e-01 0.0000e+00
++4.8583e-01 -3.1657e-01 0.0000e+00
++5.0689e-01 -3.6204e-01 0.0000e+00
++5.3773e-01 -4.1049e-01 0.0000e+00
++5.5907e-01 -4.5704e-01 0.0000e+00
++5.8519e-01 -5.0506e-01 0.0000e+00
++4.5311e-03 +7.4872e-01 0.0000e+00
++2.8238e-02 +7.0183e-01 0.0000e+00
++5.0161e-02 +6.4941e-01 0.0000e+00
++7.5730e-02 +6.0180e-01 0.0000e+00
++1.0357e-01 +5.5805e-01 0.0000e+00
++1.2485e-01 +5.0762e-01 0.0000e+00
++1.4799e-01 +4.6566e-01 0.0000e+00
++1.7375e-01 +4.1117e-01 0.0000e+00
++1.9601e-01 +3.6737e-01 0.0000e+00
++2.2441e-01 +3.2538e-01 0.0000e+00
++2.4060e-01 +2.7245e-01 0.0000e+00
++2.6737e-01 +2.3060e-01 0.0000e+00
++2.8675e-01 +1.8275e-01 0.0000e+00
++3.1612e-01 +1.2877e-01 0.0000e+00
++3.4739e-01 +8.4782e-02 0.0000e+00
++3.6768e-01 +4.5975e-02 0.0000e+00
++3.8880e-01 -6.2405e-03 0.0000e+00
++4.0871e-01 -5.1373e-02 0.0000e+00
++4.4012e-01 -1.0120e-01 0.0000e+00
++4.5830e-01 -1.5221e-01 0.0000e+00
++4.8475e-01 -1.9248e-01 0.0000e+00
++5.0812e-01 -2.4438e-01 0.0000e+00
++5.3404e-01 -2.9344e-01 0.0000e+00
++5.5394e-01 -3.3593e-01 0.0000e+00
++5.8558e-01 -3.8412e-01 0.0000e+00
++6.0781e-01 -4.3000e-01 0.0000e+00
++6.2663e-01 -4.7519e-01 0.0000e+00
++5.1558e-02 +7.7224e-01 0.0000e+00
++7.5268e-02 +7.2387e-01 0.0000e+00
++9.2185e-02 +6.7648e-01 0.0000e+00
++1.2576e-01 +6.2981e-01 0.0000e+00
++1.4597e-01 +5.7464e-01 0.0000e+00
++1.6543e-01 +5.3581e-01 0.0000e+00
++1.9426e-01 +4.8711e-01 0.0000e+00
++2.2098e-01 +4.3930e-01 0.0000e+00
++2.4828e-01 +3.9215e-01 0.0000e+00
++2.7038e-01 +3.4908e-01 0.0000e+00
++2.9063e-01 +2.9359e-01 0.0000e+00
++3.1350e-01 +2.4774e-01 0.0000e+00
++3.4082e-01 +2.0296e-01 0.0000e+00
++3.6571e-01 +1.5485e-01 0.0000e+00
++3.8477e-01 +1.1342e-01 0.0000e+00
++4.1260e-01 +6.4905e-02 0.0000e+00
++4.3476e-01 +9.7865e-03 0.0000e+00
++4.5730e-01 -3.1124e-02 0.0000e+00
++4.8555e-01 -7.2345e-02 0.0000e+00
++5.1265e-01 -1.2414e-01 0.0000e+00
++5.3035e-01 -1.7117e-01 0.0000e+00
++5.5680e-01 -2.1773e-01 0.0000e+00
++5.8054e-01 -2.6580e-01 0.0000e+00
++6.0593e-01 -3.1529e-01 0.0000e+00
++6.3509e-01 -3.6106e-01 0.0000e+00
++6.5408e-01 -4.0956e-01 0.0000e+00
++1.1851e-01 +7.4478e-01 0.0000e+00
++1.4575e-01 +7.0226e-01 0.0000e+00
++1.7278e-01 +6.4743e-01 0.0000e+00
++1.9234e-01 +6.0713e-01 0.0000e+00
++2.2029e-01 +5.6059e-01 0.0000e+00
++2.4212e-01 +5.0923e-01 0.0000e+00
++2.7217e-01 +4.6339e-01 0.0000e+00
++2.8592e-01 +4.1634e-01 0.0000e+00
++3.1224e-01 +3.6749e-01 0.0000e+00
++3.3564e-01 +3.1913e-01 0.0000e+00
++3.6057e-01 +2.7143e-01 0.0000e+00
++3.8548e-01 +2.2223e-01 0.0000e+00
++4.0869e-01 +1.8552e-01 0.0000e+00
++4.3494e-01 +1.3251e-01 0.0000e+00
++4.5790e-01 +8.9972e-02 0.0000e+00
++4.8426e-01 +3.7344e-02 0.0000e+00
++5.0611e-01 -3.2086e-03 0.0000e+00
++5.3132e-01 -5.3959e-02 0.0000e+00
++5.5984e-01 -9.8073e-02 0.0000e+00
++5.7878e-01 -1.4231e-01 0.0000e+00
++6.0206e-01 -1.8988e-01 0.0000e+00
++6.2721e-01 -2.4438e-01 0.0000e+00
++6.4779e-01 -2.8664e-01 0.0000e+00
++6.7433e-01 -3.3660e-01 0.0000e+00
++1.6893e-01 +7.7375e-01 0.0000e+00
++1.9729e-01 +7.2286e-01 0.0000e+00
++2.2035e-01 +6.7828e-01 0.0000e+00
++2.4329e-01 +6.3313e-01 0.0000e+00
++2.7063e-01 +5.8022e-01 0.0000e+00
++2.8671e-01 +5.3710e-01 0.0000e+00
++3.1182e-01 +4.8632e-01 0.0000e+00
++3.3528e-01 +4.4441e-01 0.0000e+00
++3.5683e-01 +3.9621e-01 0.0000e+00
++3.9036e-01 +3.4958e-01 0.0000e+00
++4.0922e-01 +2.9808e-01 0.0000e+00
++4.3609e-01 +2.4937e-01 0.0000e+00
++4.5946e-01 +2.1105e-01 0.0000e+00
++4.8008e-01 +1.6206e-01 0.0000e+00
++5.0962e-01 +1.1599e-01 0.0000e+00
++5.3072e-01 +6.5808e-02 0.0000e+00
++5.5563e-01 +2.1329e-02 0.0000e+00
++5.7661e-01 -3.0988e-02 0.0000e+00
++6.0174e-01 -7.1095e-02 0.0000e+00
++6.2630e-01 -1.2563e-01 0.0000e+00
++6.4949e-01 -1.7656e-01 0.0000e+00
++6.7711e-01 -2.1709e-01 0.0000e+00
++6.9859e-01 -2.6082e-01 0.0000e+00
++7.2688e-01 -3.1089e-01 0.0000e+00
++2.4286e-01 +7.4793e-01 0.0000e+00
++2.6754e-01 +6.9842e-01 0.0000e+00
++2.9078e-01 +6.5363e-01 0.0000e+00
++3.1156e-01 +6.0840e-01 0.0000e+00
++3.3690e-01 +5.5908e-01 0.0000e+00
++3.5591e-01 +5.1333e-01 0.0000e+00
++3.8373e-01 +4.6143e-01 0.0000e+00
++4.0790e-01 +4.1135e-01 0.0000e+00
++4.3800e-01 +3.7006e-01 0.0000e+00
++4.6121e-01 +3.2447e-01 0.0000e+00
++4.8610e-01 +2.7449e-01 0.0000e+00
++5.0396e-01 +2.3410e-01 0.0000e+00
++5.2907e-01 +1.8023e-01 0.0000e+00
++5.5610e-01 +1.3255e-01 0.0000e+00
++5.7954e-01 +9.5371e-02 0.0000e+00
++6.0092e-01 +4.5742e-02 0.0000e+00
++6.3167e-01 -7.2258e-03 0.0000e+00
++6.5532e-01 -5.3616e-02 0.0000e+00
++6.7425e-01 -9.3685e-02 0.0000e+00
++6.9512e-01 -1.5020e-01 0.0000e+00
++7.2042e-01 -1.9769e-01 0.0000e+00
++7.4818e-01 -2.3746e-01 0.0000e+00
++3.1727e-01 +7.2314e-01 0.0000e+00
++3.3379e-01 +6.8152e-01 0.0000e+00
++3.5730e-01 +6.3339e-01 0.0000e+00
++3.8598e-01 +5.8516e-01 0.0000e+00
++4.0534e-01 +5.3550e-01 0.0000e+00
++4.3752e-01 +4.8884e-01 0.0000e+00
++4.6265e-01 +4.3955e-01 0.0000e+00
++4.8147e-01 +3.9939e-01 0.0000e+00
++5.0085e-01 +3.4339e-01 0.0000e+00
++5.3041e-01 +2.9944e-01 0.0000e+00
++5.5410e-01 +2.5601e-01 0.0000e+00
++5.7471e-01 +2.0188e-01 0.0000e+00
++6.0049e-01 +1.5953e-01 0.0000e+00
++6.2518e-01 +1.1822e-01 0.0000e+00
++6.4868e-01 +6.4598e-02 0.0000e+00
++6.7416e-01 +1.5163e-02 0.0000e+00
++6.9961e-01 -2.1889e-02 0.0000e+00
++7.1807e-01 -7.5818e-02 0.0000e+00
++7.4213e-01 -1.2681e-01 0.0000e+00
++7.7307e-01 -1.7238e-01 0.0000e+00
++4.0282e-01 +6.5446e-01 0.0000e+00
++4.3352e-01 +6.0898e-01 0.0000e+00
++4.5484e-01 +5.6237e-01 0.0000e+00
++4.7624e-01 +5.1564e-01 0.0000e+00
++4.9972e-01 +4.6945e-01 0.0000e+00
++5.2693e-01 +4.1851e-01 0.0000e+00
++5.4417e-01 +3.7401e-01 0.0000e+00
++5.7543e-01 +3.1976e-01 0.0000e+00
++6.0040e-01 +2.7556e-01 0.0000e+00
++6.2142e-01 +2.2554e-01 0.0000e+00
++6.5129e-01 +1.8330e-01 0.0000e+00
++6.7357e-01 +1.4304e-01 0.0000e+00
++6.9697e-01 +9.0043e-02 0.0000e+00
++7.2473e-01 +4.2108e-02 0.0000e+00
++7.4843e-01 -6.5830e-03 0.0000e+00
++7.6616e-01 -5.0041e-02 0.0000e+00
++5.0497e-01 +5.8334e-01 0.0000e+00
++5.2299e-01 +5.3627e-01 0.0000e+00
++5.4880e-01 +4.8747e-01 0.0000e+00
++5.7028e-01 +4.3948e-01 0.0000e+00
++5.9653e-01 +3.9803e-01 0.0000e+00
++6.2649e-01 +3.4677e-01 0.0000e+00
++6.4356e-01 +3.0358e-01 0.0000e+00
++6.7672e-01 +2.5300e-01 0.0000e+00
++6.9867e-01 +2.0874e-01 0.0000e+00
++7.1479e-01 +1.6340e-01 0.0000e+00
++7.4781e-01 +1.1297e-01 0.0000e+00
++7.6951e-01 +6.7007e-02 0.0000e+00
++5.9571e-01 +5.1538e-01 0.0000e+00
++6.2380e-01 +4.6916e-01 0.0000e+00
++6.4740e-01 +4.1963e-01 0.0000e+00
++6.6768e-01 +3.7798e-01 0.0000e+00
++6.9190e-01 +3.2611e-01 0.0000e+00
++7.1560e-01 +2.7411e-01 0.0000e+00
++7.4087e-01 +2.3018e-01 0.0000e+00
++7.6450e-01 +1.8426e-01 0.0000e+00
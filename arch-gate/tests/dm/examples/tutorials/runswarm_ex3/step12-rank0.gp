@@ -0,0 +1,711 @@
+-7.8450e-01 -1.0589e-01 0.0000e+00
+-7.6021e-01 -1.6143e-01 0.0000e+00
+-7.4695e-01 -2.1234e-01 0.0000e+00
+-7.2395e-01 -2.5898e-01 0.0000e+00
+-7.1194e-01 -3.0294e-01 0.0000e+00
+-6.8753e-01 -3.6148e-01 0.0000e+00
+-6.7035e-01 -4.0997e-01 0.0000e+00
+-6.4538e-01 -4.5750e-01 0.0000e+00
+-7.9387e-01 +5.8105e-02 0.0000e+00
+-7.7703e-01 +5.2337e-03 0.0000e+00
+-7.5696e-01 -4.5462e-02 0.0000e+00
+-7.3709e-01 -9.3934e-02 0.0000e+00
+-7.1658e-01 -1.4061e-01 0.0000e+00
+-7.0147e-01 -1.8677e-01 0.0000e+00
+-6.8160e-01 -2.3837e-01 0.0000e+00
+-6.5834e-01 -2.8347e-01 0.0000e+00
+-6.3435e-01 -3.3894e-01 0.0000e+00
+-6.1749e-01 -3.8088e-01 0.0000e+00
+-5.9993e-01 -4.3651e-01 0.0000e+00
+-5.7878e-01 -4.8998e-01 0.0000e+00
+-5.5765e-01 -5.3410e-01 0.0000e+00
+-7.6973e-01 +1.2994e-01 0.0000e+00
+-7.4701e-01 +7.2598e-02 0.0000e+00
+-7.2189e-01 +3.2688e-02 0.0000e+00
+-7.0843e-01 -2.1128e-02 0.0000e+00
+-6.8804e-01 -6.7965e-02 0.0000e+00
+-6.6434e-01 -1.2147e-01 0.0000e+00
+-6.4491e-01 -1.7287e-01 0.0000e+00
+-6.3129e-01 -2.1844e-01 0.0000e+00
+-6.0942e-01 -2.6926e-01 0.0000e+00
+-5.8460e-01 -3.1916e-01 0.0000e+00
+-5.6950e-01 -3.6906e-01 0.0000e+00
+-5.5112e-01 -4.1756e-01 0.0000e+00
+-5.2929e-01 -4.6364e-01 0.0000e+00
+-5.1255e-01 -5.1576e-01 0.0000e+00
+-4.8589e-01 -5.6292e-01 0.0000e+00
+-4.7275e-01 -6.1406e-01 0.0000e+00
+-7.5518e-01 +2.4201e-01 0.0000e+00
+-7.3497e-01 +1.9274e-01 0.0000e+00
+-7.1650e-01 +1.4992e-01 0.0000e+00
+-6.8945e-01 +9.8664e-02 0.0000e+00
+-6.7166e-01 +5.0332e-02 0.0000e+00
+-6.5539e-01 +3.0203e-04 0.0000e+00
+-6.3744e-01 -4.7917e-02 0.0000e+00
+-6.1955e-01 -1.0147e-01 0.0000e+00
+-5.9943e-01 -1.4935e-01 0.0000e+00
+-5.7392e-01 -1.9577e-01 0.0000e+00
+-5.5671e-01 -2.4909e-01 0.0000e+00
+-5.3587e-01 -2.9129e-01 0.0000e+00
+-5.1746e-01 -3.4628e-01 0.0000e+00
+-4.9889e-01 -3.9149e-01 0.0000e+00
+-4.7692e-01 -4.4502e-01 0.0000e+00
+-4.6566e-01 -4.9798e-01 0.0000e+00
+-4.4195e-01 -5.4884e-01 0.0000e+00
+-4.1704e-01 -5.9609e-01 0.0000e+00
+-4.0525e-01 -6.4129e-01 0.0000e+00
+-3.8646e-01 -6.9098e-01 0.0000e+00
+-7.1873e-01 +3.1531e-01 0.0000e+00
+-7.0514e-01 +2.6275e-01 0.0000e+00
+-6.7904e-01 +2.1745e-01 0.0000e+00
+-6.6142e-01 +1.7024e-01 0.0000e+00
+-6.4112e-01 +1.1703e-01 0.0000e+00
+-6.2887e-01 +6.5211e-02 0.0000e+00
+-6.0744e-01 +1.2444e-02 0.0000e+00
+-5.8860e-01 -2.9935e-02 0.0000e+00
+-5.7238e-01 -8.1336e-02 0.0000e+00
+-5.4556e-01 -1.2395e-01 0.0000e+00
+-5.2739e-01 -1.8270e-01 0.0000e+00
+-5.1125e-01 -2.3475e-01 0.0000e+00
+-4.9190e-01 -2.8211e-01 0.0000e+00
+-4.7184e-01 -3.3016e-01 0.0000e+00
+-4.4877e-01 -3.8174e-01 0.0000e+00
+-4.2970e-01 -4.2923e-01 0.0000e+00
+-4.1194e-01 -4.7928e-01 0.0000e+00
+-3.9448e-01 -5.2352e-01 0.0000e+00
+-3.7458e-01 -5.7492e-01 0.0000e+00
+-3.5603e-01 -6.2115e-01 0.0000e+00
+-3.3364e-01 -6.7706e-01 0.0000e+00
+-3.1735e-01 -7.2578e-01 0.0000e+00
+-6.9287e-01 +3.8490e-01 0.0000e+00
+-6.7198e-01 +3.3951e-01 0.0000e+00
+-6.5776e-01 +2.8435e-01 0.0000e+00
+-6.3316e-01 +2.3205e-01 0.0000e+00
+-6.1014e-01 +1.8268e-01 0.0000e+00
+-5.9438e-01 +1.3220e-01 0.0000e+00
+-5.8011e-01 +9.0191e-02 0.0000e+00
+-5.5968e-01 +3.3918e-02 0.0000e+00
+-5.4214e-01 -1.1748e-02 0.0000e+00
+-5.1283e-01 -6.3017e-02 0.0000e+00
+-5.0054e-01 -1.1300e-01 0.0000e+00
+-4.7722e-01 -1.6189e-01 0.0000e+00
+-4.6438e-01 -2.1095e-01 0.0000e+00
+-4.3723e-01 -2.5882e-01 0.0000e+00
+-4.2470e-01 -3.1073e-01 0.0000e+00
+-4.0188e-01 -3.5836e-01 0.0000e+00
+-3.8294e-01 -4.0467e-01 0.0000e+00
+-3.6168e-01 -4.5326e-01 0.0000e+00
+-3.4570e-01 -5.1029e-01 0.0000e+00
+-3.2662e-01 -5.5842e-01 0.0000e+00
+-2.9814e-01 -6.0684e-01 0.0000e+00
+-2.8501e-01 -6.4836e-01 0.0000e+00
+-2.6002e-01 -7.0532e-01 0.0000e+00
+-2.4378e-01 -7.5565e-01 0.0000e+00
+-6.4797e-01 +4.0266e-01 0.0000e+00
+-6.2396e-01 +3.5712e-01 0.0000e+00
+-6.0490e-01 +3.0469e-01 0.0000e+00
+-5.8718e-01 +2.5003e-01 0.0000e+00
+-5.6341e-01 +2.1045e-01 0.0000e+00
+-5.4427e-01 +1.5549e-01 0.0000e+00
+-5.2396e-01 +1.1069e-01 0.0000e+00
+-5.0247e-01 +5.5811e-02 0.0000e+00
+-4.8427e-01 +9.3502e-03 0.0000e+00
+-4.7347e-01 -3.8163e-02 0.0000e+00
+-4.5380e-01 -9.1261e-02 0.0000e+00
+-4.2940e-01 -1.4446e-01 0.0000e+00
+-4.1240e-01 -1.9086e-01 0.0000e+00
+-3.9013e-01 -2.4347e-01 0.0000e+00
+-3.6872e-01 -2.8207e-01 0.0000e+00
+-3.5048e-01 -3.3356e-01 0.0000e+00
+-3.3329e-01 -3.8689e-01 0.0000e+00
+-3.1894e-01 -4.3492e-01 0.0000e+00
+-2.9162e-01 -4.8248e-01 0.0000e+00
+-2.6977e-01 -5.3765e-01 0.0000e+00
+-2.5465e-01 -5.8057e-01 0.0000e+00
+-2.3345e-01 -6.3859e-01 0.0000e+00
+-2.2187e-01 -6.8272e-01 0.0000e+00
+-1.9700e-01 -7.2888e-01 0.0000e+00
+-6.1530e-01 +4.7221e-01 0.0000e+00
+-5.9552e-01 +4.2183e-01 0.0000e+00
+-5.7047e-01 +3.7251e-01 0.0000e+00
+-5.5449e-01 +3.2666e-01 0.0000e+00
+-5.3787e-01 +2.7866e-01 0.0000e+00
+-5.1888e-01 +2.2519e-01 0.0000e+00
+-4.9754e-01 +1.7013e-01 0.0000e+00
+-4.7937e-01 +1.2957e-01 0.0000e+00
+-4.5558e-01 +7.7209e-02 0.0000e+00
+-4.3932e-01 +2.5179e-02 0.0000e+00
+-4.1887e-01 -2.3453e-02 0.0000e+00
+-3.9671e-01 -7.0649e-02 0.0000e+00
+-3.7750e-01 -1.1946e-01 0.0000e+00
+-3.6688e-01 -1.6727e-01 0.0000e+00
+-3.3802e-01 -2.1917e-01 0.0000e+00
+-3.2207e-01 -2.6569e-01 0.0000e+00
+-2.9839e-01 -3.1594e-01 0.0000e+00
+-2.8869e-01 -3.6577e-01 0.0000e+00
+-2.6383e-01 -4.1442e-01 0.0000e+00
+-2.3879e-01 -4.6730e-01 0.0000e+00
+-2.2504e-01 -5.1833e-01 0.0000e+00
+-2.0949e-01 -5.6432e-01 0.0000e+00
+-1.9126e-01 -6.1498e-01 0.0000e+00
+-1.6367e-01 -6.6101e-01 0.0000e+00
+-1.5216e-01 -7.1157e-01 0.0000e+00
+-1.2456e-01 -7.6574e-01 0.0000e+00
+-5.8471e-01 +5.3432e-01 0.0000e+00
+-5.6003e-01 +4.8836e-01 0.0000e+00
+-5.4092e-01 +4.3805e-01 0.0000e+00
+-5.2834e-01 +3.8764e-01 0.0000e+00
+-5.0172e-01 +3.4398e-01 0.0000e+00
+-4.8547e-01 +2.9882e-01 0.0000e+00
+-4.6717e-01 +2.4122e-01 0.0000e+00
+-4.4404e-01 +1.9956e-01 0.0000e+00
+-4.2689e-01 +1.5107e-01 0.0000e+00
+-4.1083e-01 +9.1784e-02 0.0000e+00
+-3.9235e-01 +4.0875e-02 0.0000e+00
+-3.6655e-01 +1.5956e-03 0.0000e+00
+-3.5213e-01 -5.3632e-02 0.0000e+00
+-3.3004e-01 -1.0197e-01 0.0000e+00
+-3.0512e-01 -1.5274e-01 0.0000e+00
+-2.8899e-01 -1.9592e-01 0.0000e+00
+-2.6901e-01 -2.4595e-01 0.0000e+00
+-2.5248e-01 -2.9880e-01 0.0000e+00
+-2.3568e-01 -3.5211e-01 0.0000e+00
+-2.1809e-01 -3.9874e-01 0.0000e+00
+-1.9680e-01 -4.4794e-01 0.0000e+00
+-1.7186e-01 -4.9708e-01 0.0000e+00
+-1.5734e-01 -5.4576e-01 0.0000e+00
+-1.4094e-01 -5.9675e-01 0.0000e+00
+-1.1878e-01 -6.4509e-01 0.0000e+00
+-9.8192e-02 -6.9242e-01 0.0000e+00
+-7.6738e-02 -7.4707e-01 0.0000e+00
+-5.2733e-01 +5.5726e-01 0.0000e+00
+-5.1947e-01 +5.0961e-01 0.0000e+00
+-4.9980e-01 +4.6356e-01 0.0000e+00
+-4.8071e-01 +4.1496e-01 0.0000e+00
+-4.6020e-01 +3.5947e-01 0.0000e+00
+-4.3999e-01 +3.1207e-01 0.0000e+00
+-4.2007e-01 +2.5789e-01 0.0000e+00
+-3.9496e-01 +2.1884e-01 0.0000e+00
+-3.8053e-01 +1.6159e-01 0.0000e+00
+-3.5848e-01 +1.1335e-01 0.0000e+00
+-3.4214e-01 +7.0298e-02 0.0000e+00
+-3.2086e-01 +1.6181e-02 0.0000e+00
+-3.0077e-01 -2.8650e-02 0.0000e+00
+-2.8027e-01 -7.7988e-02 0.0000e+00
+-2.5985e-01 -1.3391e-01 0.0000e+00
+-2.4165e-01 -1.8082e-01 0.0000e+00
+-2.2008e-01 -2.2699e-01 0.0000e+00
+-1.9769e-01 -2.8193e-01 0.0000e+00
+-1.8339e-01 -3.3035e-01 0.0000e+00
+-1.6491e-01 -3.7761e-01 0.0000e+00
+-1.4750e-01 -4.2367e-01 0.0000e+00
+-1.2661e-01 -4.7583e-01 0.0000e+00
+-1.0710e-01 -5.2702e-01 0.0000e+00
+-8.0722e-02 -5.7901e-01 0.0000e+00
+-6.8373e-02 -6.2839e-01 0.0000e+00
+-4.6552e-02 -6.7347e-01 0.0000e+00
+-2.9458e-02 -7.2782e-01 0.0000e+00
+-8.7641e-03 -7.7353e-01 0.0000e+00
+-4.8647e-01 +5.7829e-01 0.0000e+00
+-4.6591e-01 +5.3420e-01 0.0000e+00
+-4.4568e-01 +4.7940e-01 0.0000e+00
+-4.2974e-01 +4.2829e-01 0.0000e+00
+-4.0226e-01 +3.7820e-01 0.0000e+00
+-3.8634e-01 +3.3392e-01 0.0000e+00
+-3.7396e-01 +2.8456e-01 0.0000e+00
+-3.5142e-01 +2.3174e-01 0.0000e+00
+-3.2530e-01 +1.8496e-01 0.0000e+00
+-3.1001e-01 +1.3208e-01 0.0000e+00
+-2.9384e-01 +8.7493e-02 0.0000e+00
+-2.7467e-01 +3.1650e-02 0.0000e+00
+-2.4588e-01 -1.6669e-02 0.0000e+00
+-2.3367e-01 -5.8403e-02 0.0000e+00
+-2.0755e-01 -1.1416e-01 0.0000e+00
+-1.9604e-01 -1.6575e-01 0.0000e+00
+-1.7415e-01 -2.0693e-01 0.0000e+00
+-1.5895e-01 -2.6196e-01 0.0000e+00
+-1.3448e-01 -3.1088e-01 0.0000e+00
+-1.1812e-01 -3.6205e-01 0.0000e+00
+-9.3440e-02 -4.0237e-01 0.0000e+00
+-8.1729e-02 -4.5840e-01 0.0000e+00
+-5.3829e-02 -5.1134e-01 0.0000e+00
+-4.2335e-02 -5.5530e-01 0.0000e+00
+-1.3970e-02 -6.0470e-01 0.0000e+00
++6.6162e-03 -6.5693e-01 0.0000e+00
++1.8855e-02 -7.0267e-01 0.0000e+00
++4.1687e-02 -7.5511e-01 0.0000e+00
+-4.5517e-01 +6.5273e-01 0.0000e+00
+-4.3390e-01 +5.9631e-01 0.0000e+00
+-4.1292e-01 +5.5455e-01 0.0000e+00
+-3.9154e-01 +4.9742e-01 0.0000e+00
+-3.7657e-01 +4.5294e-01 0.0000e+00
+-3.5152e-01 +4.0030e-01 0.0000e+00
+-3.3620e-01 +3.5543e-01 0.0000e+00
+-3.2321e-01 +3.0005e-01 0.0000e+00
+-3.0073e-01 +2.5046e-01 0.0000e+00
+-2.7822e-01 +2.0111e-01 0.0000e+00
+-2.6037e-01 +1.5211e-01 0.0000e+00
+-2.4223e-01 +1.0620e-01 0.0000e+00
+-2.2218e-01 +5.6053e-02 0.0000e+00
+-2.0362e-01 +9.1571e-03 0.0000e+00
+-1.7843e-01 -4.7216e-02 0.0000e+00
+-1.6871e-01 -9.1117e-02 0.0000e+00
+-1.4842e-01 -1.4372e-01 0.0000e+00
+-1.2355e-01 -1.9163e-01 0.0000e+00
+-1.0752e-01 -2.4439e-01 0.0000e+00
+-8.5549e-02 -2.8777e-01 0.0000e+00
+-6.7461e-02 -3.4308e-01 0.0000e+00
+-4.7954e-02 -3.8546e-01 0.0000e+00
+-2.9362e-02 -4.3901e-01 0.0000e+00
+-4.6624e-03 -4.9047e-01 0.0000e+00
++1.3681e-02 -5.3534e-01 0.0000e+00
++2.7775e-02 -5.8928e-01 0.0000e+00
++4.9756e-02 -6.3401e-01 0.0000e+00
++7.0585e-02 -6.8595e-01 0.0000e+00
++8.6670e-02 -7.3682e-01 0.0000e+00
++1.0549e-01 -7.8315e-01 0.0000e+00
+-4.0219e-01 +6.6927e-01 0.0000e+00
+-3.8441e-01 +6.2013e-01 0.0000e+00
+-3.6758e-01 +5.6970e-01 0.0000e+00
+-3.4705e-01 +5.2374e-01 0.0000e+00
+-3.2979e-01 +4.7220e-01 0.0000e+00
+-3.0188e-01 +4.1906e-01 0.0000e+00
+-2.8916e-01 +3.6740e-01 0.0000e+00
+-2.6734e-01 +3.2508e-01 0.0000e+00
+-2.5006e-01 +2.7763e-01 0.0000e+00
+-2.2919e-01 +2.1980e-01 0.0000e+00
+-2.1255e-01 +1.7085e-01 0.0000e+00
+-1.9368e-01 +1.2428e-01 0.0000e+00
+-1.7338e-01 +7.8198e-02 0.0000e+00
+-1.4646e-01 +2.3700e-02 0.0000e+00
+-1.3037e-01 -2.2824e-02 0.0000e+00
+-1.0900e-01 -7.5868e-02 0.0000e+00
+-9.5996e-02 -1.2063e-01 0.0000e+00
+-7.9425e-02 -1.7154e-01 0.0000e+00
+-5.6765e-02 -2.2175e-01 0.0000e+00
+-3.6177e-02 -2.7215e-01 0.0000e+00
+-2.1295e-02 -3.1833e-01 0.0000e+00
++1.0686e-03 -3.7143e-01 0.0000e+00
++1.7658e-02 -4.2121e-01 0.0000e+00
++4.2509e-02 -4.7010e-01 0.0000e+00
++5.5530e-02 -5.1453e-01 0.0000e+00
++8.3108e-02 -5.6047e-01 0.0000e+00
++9.7648e-02 -6.1721e-01 0.0000e+00
++1.1561e-01 -6.6476e-01 0.0000e+00
++1.3837e-01 -7.1816e-01 0.0000e+00
++1.6265e-01 -7.6429e-01 0.0000e+00
+-3.5814e-01 +6.8135e-01 0.0000e+00
+-3.3427e-01 +6.3346e-01 0.0000e+00
+-3.1207e-01 +5.9014e-01 0.0000e+00
+-3.0389e-01 +5.4149e-01 0.0000e+00
+-2.8059e-01 +4.9314e-01 0.0000e+00
+-2.5641e-01 +4.4611e-01 0.0000e+00
+-2.4045e-01 +3.9143e-01 0.0000e+00
+-2.1604e-01 +3.3761e-01 0.0000e+00
+-1.9736e-01 +2.9344e-01 0.0000e+00
+-1.7930e-01 +2.4005e-01 0.0000e+00
+-1.5767e-01 +1.9615e-01 0.0000e+00
+-1.3883e-01 +1.4270e-01 0.0000e+00
+-1.2868e-01 +9.5399e-02 0.0000e+00
+-1.0095e-01 +4.4509e-02 0.0000e+00
+-8.2758e-02 -6.8912e-03 0.0000e+00
+-6.1891e-02 -5.4376e-02 0.0000e+00
+-4.6723e-02 -1.0274e-01 0.0000e+00
+-2.4752e-02 -1.5487e-01 0.0000e+00
+-5.3648e-03 -2.0611e-01 0.0000e+00
++1.7657e-02 -2.5378e-01 0.0000e+00
++3.2796e-02 -2.9961e-01 0.0000e+00
++5.8406e-02 -3.5280e-01 0.0000e+00
++6.8839e-02 -4.0449e-01 0.0000e+00
++8.7660e-02 -4.5121e-01 0.0000e+00
++1.1288e-01 -4.9409e-01 0.0000e+00
++1.2565e-01 -5.4653e-01 0.0000e+00
++1.4542e-01 -5.9380e-01 0.0000e+00
++1.6544e-01 -6.4267e-01 0.0000e+00
++1.8493e-01 -6.9702e-01 0.0000e+00
++2.1181e-01 -7.4224e-01 0.0000e+00
+-3.0621e-01 +7.0822e-01 0.0000e+00
+-2.8951e-01 +6.5872e-01 0.0000e+00
+-2.6600e-01 +6.1176e-01 0.0000e+00
+-2.4652e-01 +5.6358e-01 0.0000e+00
+-2.2894e-01 +5.0682e-01 0.0000e+00
+-2.0588e-01 +4.6112e-01 0.0000e+00
+-1.8803e-01 +4.0682e-01 0.0000e+00
+-1.6738e-01 +3.6261e-01 0.0000e+00
+-1.5463e-01 +3.1176e-01 0.0000e+00
+-1.2745e-01 +2.6414e-01 0.0000e+00
+-1.1227e-01 +2.1004e-01 0.0000e+00
+-9.6847e-02 +1.6685e-01 0.0000e+00
+-6.7644e-02 +1.1157e-01 0.0000e+00
+-4.7882e-02 +6.3421e-02 0.0000e+00
+-3.7088e-02 +1.0765e-02 0.0000e+00
+-1.9400e-02 -3.2680e-02 0.0000e+00
++3.5759e-03 -8.7101e-02 0.0000e+00
++2.0138e-02 -1.3116e-01 0.0000e+00
++4.0705e-02 -1.8712e-01 0.0000e+00
++6.4734e-02 -2.3441e-01 0.0000e+00
++8.3120e-02 -2.8488e-01 0.0000e+00
++1.0487e-01 -3.2652e-01 0.0000e+00
++1.1853e-01 -3.8282e-01 0.0000e+00
++1.4337e-01 -4.2739e-01 0.0000e+00
++1.6261e-01 -4.8293e-01 0.0000e+00
++1.7944e-01 -5.2368e-01 0.0000e+00
++1.9968e-01 -5.7523e-01 0.0000e+00
++2.1802e-01 -6.3082e-01 0.0000e+00
++2.3743e-01 -6.7588e-01 0.0000e+00
++2.5466e-01 -7.2227e-01 0.0000e+00
+-2.5503e-01 +7.2211e-01 0.0000e+00
+-2.3342e-01 +6.7857e-01 0.0000e+00
+-2.1709e-01 +6.2534e-01 0.0000e+00
+-1.9785e-01 +5.8145e-01 0.0000e+00
+-1.7711e-01 +5.2894e-01 0.0000e+00
+-1.6089e-01 +4.7501e-01 0.0000e+00
+-1.4154e-01 +4.2739e-01 0.0000e+00
+-1.2614e-01 +3.7888e-01 0.0000e+00
+-1.0391e-01 +3.2765e-01 0.0000e+00
+-8.4848e-02 +2.8243e-01 0.0000e+00
+-6.5489e-02 +2.3089e-01 0.0000e+00
+-4.1001e-02 +1.8340e-01 0.0000e+00
+-2.1400e-02 +1.3743e-01 0.0000e+00
+-5.3536e-03 +7.9328e-02 0.0000e+00
++1.7346e-02 +3.6636e-02 0.0000e+00
++3.3000e-02 -2.0379e-02 0.0000e+00
++5.5678e-02 -5.9458e-02 0.0000e+00
++7.6311e-02 -1.1349e-01 0.0000e+00
++8.7248e-02 -1.6272e-01 0.0000e+00
++1.1062e-01 -2.1623e-01 0.0000e+00
++1.3254e-01 -2.6630e-01 0.0000e+00
++1.5020e-01 -3.0821e-01 0.0000e+00
++1.6684e-01 -3.5888e-01 0.0000e+00
++1.9419e-01 -4.1334e-01 0.0000e+00
++2.1267e-01 -4.5656e-01 0.0000e+00
++2.3078e-01 -5.0777e-01 0.0000e+00
++2.5358e-01 -5.5822e-01 0.0000e+00
++2.6372e-01 -6.0738e-01 0.0000e+00
++2.9061e-01 -6.6086e-01 0.0000e+00
++3.0317e-01 -7.0678e-01 0.0000e+00
+-2.0646e-01 +7.4247e-01 0.0000e+00
+-1.8924e-01 +7.0032e-01 0.0000e+00
+-1.6394e-01 +6.4857e-01 0.0000e+00
+-1.4946e-01 +5.9277e-01 0.0000e+00
+-1.2591e-01 +5.4965e-01 0.0000e+00
+-1.1232e-01 +4.9715e-01 0.0000e+00
+-9.3763e-02 +4.4856e-01 0.0000e+00
+-7.1206e-02 +3.9467e-01 0.0000e+00
+-4.8618e-02 +3.5529e-01 0.0000e+00
+-3.6645e-02 +2.9661e-01 0.0000e+00
+-1.8254e-02 +2.5420e-01 0.0000e+00
++5.9309e-03 +1.9991e-01 0.0000e+00
++2.7880e-02 +1.5613e-01 0.0000e+00
++4.1925e-02 +1.0241e-01 0.0000e+00
++6.8341e-02 +5.5000e-02 0.0000e+00
++8.2664e-02 +7.3527e-03 0.0000e+00
++1.0533e-01 -4.9682e-02 0.0000e+00
++1.2153e-01 -9.6277e-02 0.0000e+00
++1.4720e-01 -1.4509e-01 0.0000e+00
++1.6389e-01 -1.9094e-01 0.0000e+00
++1.7710e-01 -2.4319e-01 0.0000e+00
++1.9779e-01 -2.8910e-01 0.0000e+00
++2.2084e-01 -3.4056e-01 0.0000e+00
++2.3434e-01 -3.9254e-01 0.0000e+00
++2.6267e-01 -4.3873e-01 0.0000e+00
++2.7664e-01 -4.8669e-01 0.0000e+00
++2.9491e-01 -5.3923e-01 0.0000e+00
++3.2152e-01 -5.8562e-01 0.0000e+00
++3.3692e-01 -6.3950e-01 0.0000e+00
++3.5085e-01 -6.8771e-01 0.0000e+00
+-1.5939e-01 +7.6503e-01 0.0000e+00
+-1.3997e-01 +7.1673e-01 0.0000e+00
+-1.1932e-01 +6.6871e-01 0.0000e+00
+-9.5131e-02 +6.1729e-01 0.0000e+00
+-8.3899e-02 +5.6998e-01 0.0000e+00
+-6.6960e-02 +5.1985e-01 0.0000e+00
+-4.5090e-02 +4.6713e-01 0.0000e+00
+-2.4290e-02 +4.2089e-01 0.0000e+00
+-6.1529e-03 +3.6390e-01 0.0000e+00
++2.1430e-02 +3.1871e-01 0.0000e+00
++3.0184e-02 +2.7421e-01 0.0000e+00
++5.0863e-02 +2.2402e-01 0.0000e+00
++7.0404e-02 +1.7530e-01 0.0000e+00
++9.8352e-02 +1.2430e-01 0.0000e+00
++1.1316e-01 +7.0475e-02 0.0000e+00
++1.3409e-01 +1.9413e-02 0.0000e+00
++1.4984e-01 -2.3816e-02 0.0000e+00
++1.7272e-01 -7.6423e-02 0.0000e+00
++1.9195e-01 -1.2163e-01 0.0000e+00
++2.0759e-01 -1.7337e-01 0.0000e+00
++2.3074e-01 -2.2737e-01 0.0000e+00
++2.4952e-01 -2.7326e-01 0.0000e+00
++2.7015e-01 -3.1794e-01 0.0000e+00
++2.8454e-01 -3.7178e-01 0.0000e+00
++3.0680e-01 -4.2042e-01 0.0000e+00
++3.2241e-01 -4.6763e-01 0.0000e+00
++3.4835e-01 -5.2225e-01 0.0000e+00
++3.6796e-01 -5.7269e-01 0.0000e+00
++3.8736e-01 -6.2194e-01 0.0000e+00
++4.0317e-01 -6.7332e-01 0.0000e+00
+-1.0322e-01 +7.8136e-01 0.0000e+00
+-9.2896e-02 +7.3385e-01 0.0000e+00
+-7.3348e-02 +6.8750e-01 0.0000e+00
+-5.1543e-02 +6.3633e-01 0.0000e+00
+-2.9005e-02 +5.8561e-01 0.0000e+00
+-1.4864e-02 +5.4000e-01 0.0000e+00
++1.1688e-02 +4.9185e-01 0.0000e+00
++2.2321e-02 +4.3965e-01 0.0000e+00
++4.2991e-02 +3.8567e-01 0.0000e+00
++6.2545e-02 +3.4341e-01 0.0000e+00
++8.4089e-02 +2.8679e-01 0.0000e+00
++1.0044e-01 +2.4301e-01 0.0000e+00
++1.1932e-01 +1.9376e-01 0.0000e+00
++1.4177e-01 +1.3948e-01 0.0000e+00
++1.6506e-01 +8.7898e-02 0.0000e+00
++1.8781e-01 +4.1075e-02 0.0000e+00
++2.0286e-01 -8.4781e-03 0.0000e+00
++2.1865e-01 -5.2537e-02 0.0000e+00
++2.3806e-01 -1.0277e-01 0.0000e+00
++2.5840e-01 -1.4976e-01 0.0000e+00
++2.7927e-01 -2.0496e-01 0.0000e+00
++3.0298e-01 -2.5102e-01 0.0000e+00
++3.2275e-01 -2.9953e-01 0.0000e+00
++3.3580e-01 -3.4964e-01 0.0000e+00
++3.5970e-01 -3.9693e-01 0.0000e+00
++3.7294e-01 -4.4930e-01 0.0000e+00
++4.0058e-01 -4.9938e-01 0.0000e+00
++4.1294e-01 -5.5200e-01 0.0000e+00
++4.3345e-01 -6.0087e-01 0.0000e+00
++4.5767e-01 -6.4395e-01 0.0000e+00
+-4.1062e-02 +7.5417e-01 0.0000e+00
+-2.4397e-02 +7.0589e-01 0.0000e+00
+-4.1199e-03 +6.5245e-01 0.0000e+00
++1.3942e-02 +6.0675e-01 0.0000e+00
++4.0260e-02 +5.6084e-01 0.0000e+00
++5.5413e-02 +5.0188e-01 0.0000e+00
++7.7266e-02 +4.5524e-01 0.0000e+00
++9.7850e-02 +4.0878e-01 0.0000e+00
++1.1519e-01 +3.5686e-01 0.0000e+00
++1.3055e-01 +3.0659e-01 0.0000e+00
++1.5156e-01 +2.6399e-01 0.0000e+00
++1.7933e-01 +2.0773e-01 0.0000e+00
++1.8990e-01 +1.6225e-01 0.0000e+00
++2.1030e-01 +1.1289e-01 0.0000e+00
++2.3421e-01 +6.3861e-02 0.0000e+00
++2.4526e-01 +1.5110e-02 0.0000e+00
++2.6990e-01 -3.2253e-02 0.0000e+00
++2.8864e-01 -8.1907e-02 0.0000e+00
++3.1392e-01 -1.3810e-01 0.0000e+00
++3.3092e-01 -1.8349e-01 0.0000e+00
++3.4428e-01 -2.3233e-01 0.0000e+00
++3.7070e-01 -2.7806e-01 0.0000e+00
++3.9036e-01 -3.3190e-01 0.0000e+00
++4.0292e-01 -3.8290e-01 0.0000e+00
++4.2289e-01 -4.3175e-01 0.0000e+00
++4.5179e-01 -4.8257e-01 0.0000e+00
++4.6426e-01 -5.2980e-01 0.0000e+00
++4.8169e-01 -5.7622e-01 0.0000e+00
++7.1777e-03 +7.7794e-01 0.0000e+00
++2.9724e-02 +7.2789e-01 0.0000e+00
++5.2451e-02 +6.7536e-01 0.0000e+00
++6.6209e-02 +6.2369e-01 0.0000e+00
++8.4892e-02 +5.8090e-01 0.0000e+00
++1.0564e-01 +5.3002e-01 0.0000e+00
++1.2458e-01 +4.8238e-01 0.0000e+00
++1.3908e-01 +4.3021e-01 0.0000e+00
++1.6416e-01 +3.8276e-01 0.0000e+00
++1.8485e-01 +3.3027e-01 0.0000e+00
++2.0436e-01 +2.8559e-01 0.0000e+00
++2.2453e-01 +2.3495e-01 0.0000e+00
++2.4353e-01 +1.8163e-01 0.0000e+00
++2.6030e-01 +1.2585e-01 0.0000e+00
++2.8349e-01 +8.5986e-02 0.0000e+00
++2.9796e-01 +2.8038e-02 0.0000e+00
++3.1646e-01 -1.7286e-02 0.0000e+00
++3.3745e-01 -6.8150e-02 0.0000e+00
++3.5530e-01 -1.1964e-01 0.0000e+00
++3.7940e-01 -1.6076e-01 0.0000e+00
++3.9400e-01 -2.1759e-01 0.0000e+00
++4.1157e-01 -2.6322e-01 0.0000e+00
++4.3575e-01 -3.0778e-01 0.0000e+00
++4.5418e-01 -3.6515e-01 0.0000e+00
++4.7069e-01 -4.1273e-01 0.0000e+00
++4.9668e-01 -4.6426e-01 0.0000e+00
++5.1337e-01 -5.1294e-01 0.0000e+00
++5.3468e-01 -5.6358e-01 0.0000e+00
++7.9404e-02 +7.4827e-01 0.0000e+00
++9.8421e-02 +6.9901e-01 0.0000e+00
++1.1510e-01 +6.4440e-01 0.0000e+00
++1.3591e-01 +5.9423e-01 0.0000e+00
++1.5938e-01 +5.4769e-01 0.0000e+00
++1.7561e-01 +4.9513e-01 0.0000e+00
++1.9456e-01 +4.5086e-01 0.0000e+00
++2.1487e-01 +3.9379e-01 0.0000e+00
++2.3274e-01 +3.4777e-01 0.0000e+00
++2.5695e-01 +3.0294e-01 0.0000e+00
++2.6785e-01 +2.4839e-01 0.0000e+00
++2.9043e-01 +2.0386e-01 0.0000e+00
++3.0502e-01 +1.5407e-01 0.0000e+00
++3.2900e-01 +9.7153e-02 0.0000e+00
++3.5587e-01 +5.0043e-02 0.0000e+00
++3.7228e-01 +9.2066e-03 0.0000e+00
++3.8817e-01 -4.5120e-02 0.0000e+00
++4.0357e-01 -9.2244e-02 0.0000e+00
++4.3000e-01 -1.4521e-01 0.0000e+00
++4.4308e-01 -1.9804e-01 0.0000e+00
++4.6550e-01 -2.4095e-01 0.0000e+00
++4.8368e-01 -2.9519e-01 0.0000e+00
++5.0470e-01 -3.4685e-01 0.0000e+00
++5.2034e-01 -3.9132e-01 0.0000e+00
++5.4717e-01 -4.4267e-01 0.0000e+00
++5.6481e-01 -4.9078e-01 0.0000e+00
++5.7912e-01 -5.3785e-01 0.0000e+00
++1.2878e-01 +7.6709e-01 0.0000e+00
++1.4765e-01 +7.1634e-01 0.0000e+00
++1.5983e-01 +6.6726e-01 0.0000e+00
++1.8875e-01 +6.1724e-01 0.0000e+00
++2.0343e-01 +5.6004e-01 0.0000e+00
++2.1902e-01 +5.1926e-01 0.0000e+00
++2.4297e-01 +4.6768e-01 0.0000e+00
++2.6491e-01 +4.1721e-01 0.0000e+00
++2.8750e-01 +3.6732e-01 0.0000e+00
++3.0529e-01 +3.2204e-01 0.0000e+00
++3.1998e-01 +2.6452e-01 0.0000e+00
++3.3828e-01 +2.1639e-01 0.0000e+00
++3.6111e-01 +1.6887e-01 0.0000e+00
++3.8119e-01 +1.1828e-01 0.0000e+00
++3.9611e-01 +7.4943e-02 0.0000e+00
++4.1909e-01 +2.3644e-02 0.0000e+00
++4.3573e-01 -3.3689e-02 0.0000e+00
++4.5419e-01 -7.6854e-02 0.0000e+00
++4.7831e-01 -1.2090e-01 0.0000e+00
++5.0024e-01 -1.7540e-01 0.0000e+00
++5.1323e-01 -2.2421e-01 0.0000e+00
++5.3502e-01 -2.7341e-01 0.0000e+00
++5.5396e-01 -3.2386e-01 0.0000e+00
++5.7440e-01 -3.7589e-01 0.0000e+00
++5.9898e-01 -4.2457e-01 0.0000e+00
++6.1312e-01 -4.7497e-01 0.0000e+00
++1.9298e-01 +7.3293e-01 0.0000e+00
++2.1597e-01 +6.8769e-01 0.0000e+00
++2.3752e-01 +6.3016e-01 0.0000e+00
++2.5305e-01 +5.8790e-01 0.0000e+00
++2.7635e-01 +5.3857e-01 0.0000e+00
++2.9304e-01 +4.8502e-01 0.0000e+00
++3.1851e-01 +4.3618e-01 0.0000e+00
++3.2756e-01 +3.8775e-01 0.0000e+00
++3.4899e-01 +3.3626e-01 0.0000e+00
++3.6756e-01 +2.8557e-01 0.0000e+00
++3.8771e-01 +2.3537e-01 0.0000e+00
++4.0771e-01 +1.8368e-01 0.0000e+00
++4.2725e-01 +1.4465e-01 0.0000e+00
++4.4819e-01 +8.9016e-02 0.0000e+00
++4.6690e-01 +4.4182e-02 0.0000e+00
++4.8800e-01 -1.1082e-02 0.0000e+00
++5.0579e-01 -5.3820e-02 0.0000e+00
++5.2592e-01 -1.0709e-01 0.0000e+00
++5.5003e-01 -1.5406e-01 0.0000e+00
++5.6455e-01 -2.0019e-01 0.0000e+00
++5.8308e-01 -2.5009e-01 0.0000e+00
++6.0277e-01 -3.0710e-01 0.0000e+00
++6.1913e-01 -3.5141e-01 0.0000e+00
++6.4067e-01 -4.0403e-01 0.0000e+00
++2.4630e-01 +7.5686e-01 0.0000e+00
++2.6958e-01 +7.0313e-01 0.0000e+00
++2.8818e-01 +6.5625e-01 0.0000e+00
++3.0661e-01 +6.0880e-01 0.0000e+00
++3.2865e-01 +5.5316e-01 0.0000e+00
++3.4042e-01 +5.0843e-01 0.0000e+00
++3.6045e-01 +4.5514e-01 0.0000e+00
++3.7972e-01 +4.1088e-01 0.0000e+00
++3.9645e-01 +3.6052e-01 0.0000e+00
++4.2532e-01 +3.1054e-01 0.0000e+00
++4.3903e-01 +2.5716e-01 0.0000e+00
++4.6103e-01 +2.0576e-01 0.0000e+00
++4.8056e-01 +1.6510e-01 0.0000e+00
++4.9629e-01 +1.1405e-01 0.0000e+00
++5.2121e-01 +6.5024e-02 0.0000e+00
++5.3730e-01 +1.2737e-02 0.0000e+00
++5.5776e-01 -3.4234e-02 0.0000e+00
++5.7351e-01 -8.8649e-02 0.0000e+00
++5.9464e-01 -1.3127e-01 0.0000e+00
++6.1374e-01 -1.8826e-01 0.0000e+00
++6.3184e-01 -2.4151e-01 0.0000e+00
++6.5540e-01 -2.8480e-01 0.0000e+00
++6.7251e-01 -3.3068e-01 0.0000e+00
++6.9579e-01 -3.8358e-01 0.0000e+00
++3.1765e-01 +7.2364e-01 0.0000e+00
++3.3738e-01 +6.7167e-01 0.0000e+00
++3.5615e-01 +6.2455e-01 0.0000e+00
++3.7240e-01 +5.7724e-01 0.0000e+00
++3.9281e-01 +5.2539e-01 0.0000e+00
++4.0724e-01 +4.7774e-01 0.0000e+00
++4.2988e-01 +4.2306e-01 0.0000e+00
++4.4903e-01 +3.7056e-01 0.0000e+00
++4.7501e-01 +3.2626e-01 0.0000e+00
++4.9365e-01 +2.7835e-01 0.0000e+00
++5.1355e-01 +2.2588e-01 0.0000e+00
++5.2737e-01 +1.8371e-01 0.0000e+00
++5.4709e-01 +1.2732e-01 0.0000e+00
++5.6935e-01 +7.6938e-02 0.0000e+00
++5.8908e-01 +3.7416e-02 0.0000e+00
++6.0549e-01 -1.4350e-02 0.0000e+00
++6.3095e-01 -7.0393e-02 0.0000e+00
++6.4996e-01 -1.1915e-01 0.0000e+00
++6.6488e-01 -1.6111e-01 0.0000e+00
++6.8010e-01 -2.1971e-01 0.0000e+00
++7.0065e-01 -2.6973e-01 0.0000e+00
++7.2443e-01 -3.1228e-01 0.0000e+00
++3.8958e-01 +6.9142e-01 0.0000e+00
++4.0195e-01 +6.4814e-01 0.0000e+00
++4.2064e-01 +5.9766e-01 0.0000e+00
++4.4450e-01 +5.4656e-01 0.0000e+00
++4.5889e-01 +4.9497e-01 0.0000e+00
++4.8640e-01 +4.4509e-01 0.0000e+00
++5.0661e-01 +3.9328e-01 0.0000e+00
++5.2141e-01 +3.5125e-01 0.0000e+00
++5.3519e-01 +2.9331e-01 0.0000e+00
++5.6035e-01 +2.4640e-01 0.0000e+00
++5.7970e-01 +2.0060e-01 0.0000e+00
++5.9490e-01 +1.4440e-01 0.0000e+00
++6.1644e-01 +9.9480e-02 0.0000e+00
++6.3701e-01 +5.5702e-02 0.0000e+00
++6.5514e-01 -2.6991e-04 0.0000e+00
++6.7567e-01 -5.2252e-02 0.0000e+00
++6.9742e-01 -9.1850e-02 0.0000e+00
++7.1049e-01 -1.4763e-01 0.0000e+00
++7.2945e-01 -2.0102e-01 0.0000e+00
++7.5583e-01 -2.4969e-01 0.0000e+00
++4.6826e-01 +6.1418e-01 0.0000e+00
++4.9441e-01 +5.6563e-01 0.0000e+00
++5.1108e-01 +5.1688e-01 0.0000e+00
++5.2780e-01 +4.6801e-01 0.0000e+00
++5.4666e-01 +4.1947e-01 0.0000e+00
++5.6878e-01 +3.6581e-01 0.0000e+00
++5.8157e-01 +3.1959e-01 0.0000e+00
++6.0741e-01 +2.6222e-01 0.0000e+00
++6.2796e-01 +2.1552e-01 0.0000e+00
++6.4397e-01 +1.6339e-01 0.0000e+00
++6.6962e-01 +1.1818e-01 0.0000e+00
++6.8787e-01 +7.5686e-02 0.0000e+00
++7.0598e-01 +2.0346e-02 0.0000e+00
++7.2894e-01 -3.0365e-02 0.0000e+00
++7.4777e-01 -8.1426e-02 0.0000e+00
++7.6116e-01 -1.2666e-01 0.0000e+00
++5.6330e-01 +5.3284e-01 0.0000e+00
++5.7661e-01 +4.8397e-01 0.0000e+00
++5.9755e-01 +4.3259e-01 0.0000e+00
++6.1423e-01 +3.8245e-01 0.0000e+00
++6.3633e-01 +3.3838e-01 0.0000e+00
++6.6117e-01 +2.8412e-01 0.0000e+00
++6.7391e-01 +2.3923e-01 0.0000e+00
++7.0202e-01 +1.8533e-01 0.0000e+00
++7.1954e-01 +1.3887e-01 0.0000e+00
++7.3113e-01 +9.1923e-02 0.0000e+00
++7.5910e-01 +3.8186e-02 0.0000e+00
++7.7621e-01 -9.9443e-03 0.0000e+00
++6.4725e-01 +4.5581e-01 0.0000e+00
++6.7072e-01 +4.0678e-01 0.0000e+00
++6.8937e-01 +3.5489e-01 0.0000e+00
++7.0547e-01 +3.1121e-01 0.0000e+00
++7.2452e-01 +2.5692e-01 0.0000e+00
++7.4301e-01 +2.0255e-01 0.0000e+00
++7.6389e-01 +1.5609e-01 0.0000e+00
++7.8293e-01 +1.0781e-01 0.0000e+00
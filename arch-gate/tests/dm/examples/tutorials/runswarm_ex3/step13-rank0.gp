@@ -0,0 +1,711 @@
+-7.9509e-01 -2.7437e-02 0.0000e+00
+-7.7636e-01 -8.5405e-02 0.0000e+00
+-7.6818e-01 -1.3765e-01 0.0000e+00
+-7.4985e-01 -1.8658e-01 0.0000e+00
+-7.4223e-01 -2.3174e-01 0.0000e+00
+-7.2368e-01 -2.9273e-01 0.0000e+00
+-7.1134e-01 -3.4293e-01 0.0000e+00
+-6.9113e-01 -3.9296e-01 0.0000e+00
+-7.8806e-01 +1.3749e-01 0.0000e+00
+-7.7650e-01 +8.2936e-02 0.0000e+00
+-7.6150e-01 +3.0234e-02 0.0000e+00
+-7.4649e-01 -2.0225e-02 0.0000e+00
+-7.3064e-01 -6.8949e-02 0.0000e+00
+-7.2015e-01 -1.1662e-01 0.0000e+00
+-7.0543e-01 -1.7021e-01 0.0000e+00
+-6.8669e-01 -2.1764e-01 0.0000e+00
+-6.6825e-01 -2.7550e-01 0.0000e+00
+-6.5558e-01 -3.1913e-01 0.0000e+00
+-6.4358e-01 -3.7651e-01 0.0000e+00
+-6.2778e-01 -4.3211e-01 0.0000e+00
+-6.1106e-01 -4.7834e-01 0.0000e+00
+-7.5673e-01 +2.0691e-01 0.0000e+00
+-7.3975e-01 +1.4730e-01 0.0000e+00
+-7.1862e-01 +1.0488e-01 0.0000e+00
+-7.1054e-01 +4.9714e-02 0.0000e+00
+-6.9484e-01 +8.3964e-04 0.0000e+00
+-6.7648e-01 -5.5039e-02 0.0000e+00
+-6.6219e-01 -1.0838e-01 0.0000e+00
+-6.5314e-01 -1.5531e-01 0.0000e+00
+-6.3635e-01 -2.0832e-01 0.0000e+00
+-6.1651e-01 -2.6070e-01 0.0000e+00
+-6.0641e-01 -3.1211e-01 0.0000e+00
+-5.9287e-01 -3.6245e-01 0.0000e+00
+-5.7565e-01 -4.1071e-01 0.0000e+00
+-5.6413e-01 -4.6450e-01 0.0000e+00
+-5.4218e-01 -5.1434e-01 0.0000e+00
+-5.3415e-01 -5.6679e-01 0.0000e+00
+-7.3098e-01 +3.1753e-01 0.0000e+00
+-7.1570e-01 +2.6624e-01 0.0000e+00
+-7.0151e-01 +2.2157e-01 0.0000e+00
+-6.7958e-01 +1.6761e-01 0.0000e+00
+-6.6662e-01 +1.1750e-01 0.0000e+00
+-6.5536e-01 +6.5841e-02 0.0000e+00
+-6.4223e-01 +1.5827e-02 0.0000e+00
+-6.2970e-01 -3.9519e-02 0.0000e+00
+-6.1436e-01 -8.9404e-02 0.0000e+00
+-5.9350e-01 -1.3837e-01 0.0000e+00
+-5.8162e-01 -1.9342e-01 0.0000e+00
+-5.6500e-01 -2.3771e-01 0.0000e+00
+-5.5209e-01 -2.9454e-01 0.0000e+00
+-5.3804e-01 -3.4160e-01 0.0000e+00
+-5.2143e-01 -3.9733e-01 0.0000e+00
+-5.1545e-01 -4.5141e-01 0.0000e+00
+-4.9683e-01 -5.0465e-01 0.0000e+00
+-4.7665e-01 -5.5438e-01 0.0000e+00
+-4.6938e-01 -6.0076e-01 0.0000e+00
+-4.5555e-01 -6.5233e-01 0.0000e+00
+-6.8720e-01 +3.8719e-01 0.0000e+00
+-6.7887e-01 +3.3326e-01 0.0000e+00
+-6.5729e-01 +2.8535e-01 0.0000e+00
+-6.4440e-01 +2.3638e-01 0.0000e+00
+-6.2942e-01 +1.8115e-01 0.0000e+00
+-6.2234e-01 +1.2810e-01 0.0000e+00
+-6.0620e-01 +7.3188e-02 0.0000e+00
+-5.9159e-01 +2.8925e-02 0.0000e+00
+-5.8051e-01 -2.4098e-02 0.0000e+00
+-5.5796e-01 -6.9396e-02 0.0000e+00
+-5.4566e-01 -1.2996e-01 0.0000e+00
+-5.3472e-01 -1.8362e-01 0.0000e+00
+-5.2011e-01 -2.3292e-01 0.0000e+00
+-5.0486e-01 -2.8298e-01 0.0000e+00
+-4.8694e-01 -3.3687e-01 0.0000e+00
+-4.7263e-01 -3.8626e-01 0.0000e+00
+-4.5987e-01 -4.3809e-01 0.0000e+00
+-4.4683e-01 -4.8407e-01 0.0000e+00
+-4.3207e-01 -5.3746e-01 0.0000e+00
+-4.1814e-01 -5.8554e-01 0.0000e+00
+-4.0135e-01 -6.4369e-01 0.0000e+00
+-3.8993e-01 -6.9405e-01 0.0000e+00
+-6.5438e-01 +4.5418e-01 0.0000e+00
+-6.3803e-01 +4.0671e-01 0.0000e+00
+-6.2933e-01 +3.5013e-01 0.0000e+00
+-6.0996e-01 +2.9536e-01 0.0000e+00
+-5.9187e-01 +2.4370e-01 0.0000e+00
+-5.8116e-01 +1.9164e-01 0.0000e+00
+-5.7109e-01 +1.4820e-01 0.0000e+00
+-5.5629e-01 +8.9886e-02 0.0000e+00
+-5.4331e-01 +4.2466e-02 0.0000e+00
+-5.1913e-01 -1.1735e-02 0.0000e+00
+-5.1184e-01 -6.2947e-02 0.0000e+00
+-4.9341e-01 -1.1417e-01 0.0000e+00
+-4.8548e-01 -1.6451e-01 0.0000e+00
+-4.6312e-01 -2.1510e-01 0.0000e+00
+-4.5577e-01 -2.6826e-01 0.0000e+00
+-4.3772e-01 -3.1817e-01 0.0000e+00
+-4.2340e-01 -3.6637e-01 0.0000e+00
+-4.0701e-01 -4.1710e-01 0.0000e+00
+-3.9673e-01 -4.7572e-01 0.0000e+00
+-3.8246e-01 -5.2576e-01 0.0000e+00
+-3.5882e-01 -5.7702e-01 0.0000e+00
+-3.4984e-01 -6.1986e-01 0.0000e+00
+-3.3055e-01 -6.7932e-01 0.0000e+00
+-3.1934e-01 -7.3127e-01 0.0000e+00
+-6.0771e-01 +4.6746e-01 0.0000e+00
+-5.8825e-01 +4.1951e-01 0.0000e+00
+-5.7443e-01 +3.6518e-01 0.0000e+00
+-5.6218e-01 +3.0875e-01 0.0000e+00
+-5.4236e-01 +2.6679e-01 0.0000e+00
+-5.2872e-01 +2.0992e-01 0.0000e+00
+-5.1289e-01 +1.6309e-01 0.0000e+00
+-4.9689e-01 +1.0606e-01 0.0000e+00
+-4.8333e-01 +5.7777e-02 0.0000e+00
+-4.7728e-01 +9.1837e-03 0.0000e+00
+-4.6293e-01 -4.5881e-02 0.0000e+00
+-4.4385e-01 -1.0152e-01 0.0000e+00
+-4.3149e-01 -1.4962e-01 0.0000e+00
+-4.1448e-01 -2.0445e-01 0.0000e+00
+-3.9692e-01 -2.4520e-01 0.0000e+00
+-3.8383e-01 -2.9851e-01 0.0000e+00
+-3.7198e-01 -3.5356e-01 0.0000e+00
+-3.6244e-01 -4.0302e-01 0.0000e+00
+-3.3987e-01 -4.5332e-01 0.0000e+00
+-3.2354e-01 -5.1067e-01 0.0000e+00
+-3.1270e-01 -5.5510e-01 0.0000e+00
+-2.9731e-01 -6.1525e-01 0.0000e+00
+-2.9014e-01 -6.6053e-01 0.0000e+00
+-2.6989e-01 -7.0918e-01 0.0000e+00
+-5.6808e-01 +5.3374e-01 0.0000e+00
+-5.5334e-01 +4.8138e-01 0.0000e+00
+-5.3322e-01 +4.2955e-01 0.0000e+00
+-5.2182e-01 +3.8210e-01 0.0000e+00
+-5.1000e-01 +3.3245e-01 0.0000e+00
+-4.9636e-01 +2.7708e-01 0.0000e+00
+-4.8053e-01 +2.1989e-01 0.0000e+00
+-4.6641e-01 +1.7751e-01 0.0000e+00
+-4.4786e-01 +1.2277e-01 0.0000e+00
+-4.3680e-01 +6.9111e-02 0.0000e+00
+-4.2122e-01 +1.8435e-02 0.0000e+00
+-4.0378e-01 -3.0978e-02 0.0000e+00
+-3.8944e-01 -8.1711e-02 0.0000e+00
+-3.8360e-01 -1.3058e-01 0.0000e+00
+-3.5994e-01 -1.8536e-01 0.0000e+00
+-3.4864e-01 -2.3349e-01 0.0000e+00
+-3.2998e-01 -2.8610e-01 0.0000e+00
+-3.2527e-01 -3.3690e-01 0.0000e+00
+-3.0527e-01 -3.8803e-01 0.0000e+00
+-2.8551e-01 -4.4342e-01 0.0000e+00
+-2.7687e-01 -4.9582e-01 0.0000e+00
+-2.6593e-01 -5.4337e-01 0.0000e+00
+-2.5276e-01 -5.9585e-01 0.0000e+00
+-2.2977e-01 -6.4464e-01 0.0000e+00
+-2.2331e-01 -6.9635e-01 0.0000e+00
+-2.0113e-01 -7.5328e-01 0.0000e+00
+-5.3127e-01 +5.9279e-01 0.0000e+00
+-5.1119e-01 +5.4436e-01 0.0000e+00
+-4.9711e-01 +4.9214e-01 0.0000e+00
+-4.8958e-01 +4.4047e-01 0.0000e+00
+-4.6732e-01 +3.9416e-01 0.0000e+00
+-4.5559e-01 +3.4736e-01 0.0000e+00
+-4.4305e-01 +2.8794e-01 0.0000e+00
+-4.2408e-01 +2.4397e-01 0.0000e+00
+-4.1179e-01 +1.9376e-01 0.0000e+00
+-4.0165e-01 +1.3287e-01 0.0000e+00
+-3.8826e-01 +8.0110e-02 0.0000e+00
+-3.6639e-01 +3.8251e-02 0.0000e+00
+-3.5749e-01 -1.8419e-02 0.0000e+00
+-3.4024e-01 -6.8967e-02 0.0000e+00
+-3.2040e-01 -1.2223e-01 0.0000e+00
+-3.0858e-01 -1.6702e-01 0.0000e+00
+-2.9361e-01 -2.1905e-01 0.0000e+00
+-2.8236e-01 -2.7355e-01 0.0000e+00
+-2.7090e-01 -3.2854e-01 0.0000e+00
+-2.5796e-01 -3.7693e-01 0.0000e+00
+-2.4160e-01 -4.2826e-01 0.0000e+00
+-2.2157e-01 -4.7990e-01 0.0000e+00
+-2.1191e-01 -5.3003e-01 0.0000e+00
+-2.0061e-01 -5.8266e-01 0.0000e+00
+-1.8329e-01 -6.3321e-01 0.0000e+00
+-1.6743e-01 -6.8260e-01 0.0000e+00
+-1.5145e-01 -7.3940e-01 0.0000e+00
+-4.7160e-01 +6.0999e-01 0.0000e+00
+-4.6851e-01 +5.6156e-01 0.0000e+00
+-4.5344e-01 +5.1354e-01 0.0000e+00
+-4.3921e-01 +4.6303e-01 0.0000e+00
+-4.2425e-01 +4.0549e-01 0.0000e+00
+-4.0878e-01 +3.5607e-01 0.0000e+00
+-3.9428e-01 +2.9989e-01 0.0000e+00
+-3.7308e-01 +2.5834e-01 0.0000e+00
+-3.6437e-01 +1.9964e-01 0.0000e+00
+-3.4715e-01 +1.4919e-01 0.0000e+00
+-3.3511e-01 +1.0451e-01 0.0000e+00
+-3.1924e-01 +4.8267e-02 0.0000e+00
+-3.0363e-01 +1.4267e-03 0.0000e+00
+-2.8807e-01 -4.9961e-02 0.0000e+00
+-2.7324e-01 -1.0793e-01 0.0000e+00
+-2.5973e-01 -1.5666e-01 0.0000e+00
+-2.4278e-01 -2.0498e-01 0.0000e+00
+-2.2588e-01 -2.6216e-01 0.0000e+00
+-2.1643e-01 -3.1201e-01 0.0000e+00
+-2.0267e-01 -3.6112e-01 0.0000e+00
+-1.8987e-01 -4.0892e-01 0.0000e+00
+-1.7419e-01 -4.6317e-01 0.0000e+00
+-1.5980e-01 -5.1631e-01 0.0000e+00
+-1.3862e-01 -5.7094e-01 0.0000e+00
+-1.3121e-01 -6.2156e-01 0.0000e+00
+-1.1390e-01 -6.6882e-01 0.0000e+00
+-1.0224e-01 -7.2487e-01 0.0000e+00
+-8.6117e-02 -7.7265e-01 0.0000e+00
+-4.2864e-01 +6.2694e-01 0.0000e+00
+-4.1249e-01 +5.8079e-01 0.0000e+00
+-3.9774e-01 +5.2397e-01 0.0000e+00
+-3.8691e-01 +4.7127e-01 0.0000e+00
+-3.6444e-01 +4.1843e-01 0.0000e+00
+-3.5295e-01 +3.7255e-01 0.0000e+00
+-3.4550e-01 +3.2195e-01 0.0000e+00
+-3.2825e-01 +2.6688e-01 0.0000e+00
+-3.0680e-01 +2.1749e-01 0.0000e+00
+-2.9680e-01 +1.6308e-01 0.0000e+00
+-2.8509e-01 +1.1688e-01 0.0000e+00
+-2.7151e-01 +5.9118e-02 0.0000e+00
+-2.4754e-01 +7.9191e-03 0.0000e+00
+-2.3951e-01 -3.5036e-02 0.0000e+00
+-2.1897e-01 -9.3408e-02 0.0000e+00
+-2.1262e-01 -1.4615e-01 0.0000e+00
+-1.9484e-01 -1.8952e-01 0.0000e+00
+-1.8514e-01 -2.4606e-01 0.0000e+00
+-1.6557e-01 -2.9743e-01 0.0000e+00
+-1.5432e-01 -3.5024e-01 0.0000e+00
+-1.3368e-01 -3.9303e-01 0.0000e+00
+-1.2757e-01 -4.5022e-01 0.0000e+00
+-1.0496e-01 -5.0596e-01 0.0000e+00
+-9.7865e-02 -5.5107e-01 0.0000e+00
+-7.4440e-02 -6.0330e-01 0.0000e+00
+-5.9077e-02 -6.5760e-01 0.0000e+00
+-5.1411e-02 -7.0455e-01 0.0000e+00
+-3.3823e-02 -7.5928e-01 0.0000e+00
+-3.8990e-01 +6.9824e-01 0.0000e+00
+-3.7427e-01 +6.3970e-01 0.0000e+00
+-3.5746e-01 +5.9584e-01 0.0000e+00
+-3.4179e-01 +5.3658e-01 0.0000e+00
+-3.3128e-01 +4.9059e-01 0.0000e+00
+-3.1149e-01 +4.3546e-01 0.0000e+00
+-3.0066e-01 +3.8905e-01 0.0000e+00
+-2.9320e-01 +3.3237e-01 0.0000e+00
+-2.7568e-01 +2.8053e-01 0.0000e+00
+-2.5811e-01 +2.2894e-01 0.0000e+00
+-2.4515e-01 +1.7815e-01 0.0000e+00
+-2.3161e-01 +1.3042e-01 0.0000e+00
+-2.1658e-01 +7.8271e-02 0.0000e+00
+-2.0270e-01 +2.9519e-02 0.0000e+00
+-1.8315e-01 -2.9373e-02 0.0000e+00
+-1.7782e-01 -7.4247e-02 0.0000e+00
+-1.6279e-01 -1.2888e-01 0.0000e+00
+-1.4271e-01 -1.7927e-01 0.0000e+00
+-1.3196e-01 -2.3364e-01 0.0000e+00
+-1.1433e-01 -2.7922e-01 0.0000e+00
+-1.0177e-01 -3.3634e-01 0.0000e+00
+-8.6500e-02 -3.8066e-01 0.0000e+00
+-7.3263e-02 -4.3608e-01 0.0000e+00
+-5.3710e-02 -4.9001e-01 0.0000e+00
+-3.9854e-02 -5.3671e-01 0.0000e+00
+-3.1153e-02 -5.9206e-01 0.0000e+00
+-1.3645e-02 -6.3899e-01 0.0000e+00
++1.9898e-03 -6.9301e-01 0.0000e+00
++1.2988e-02 -7.4549e-01 0.0000e+00
++2.7175e-02 -7.9370e-01 0.0000e+00
+-3.3526e-01 +7.0949e-01 0.0000e+00
+-3.2240e-01 +6.5857e-01 0.0000e+00
+-3.1061e-01 +6.0646e-01 0.0000e+00
+-2.9468e-01 +5.5844e-01 0.0000e+00
+-2.8257e-01 +5.0518e-01 0.0000e+00
+-2.5997e-01 +4.4925e-01 0.0000e+00
+-2.5242e-01 +3.9632e-01 0.0000e+00
+-2.3484e-01 +3.5182e-01 0.0000e+00
+-2.2230e-01 +3.0263e-01 0.0000e+00
+-2.0721e-01 +2.4272e-01 0.0000e+00
+-1.9546e-01 +1.9210e-01 0.0000e+00
+-1.8125e-01 +1.4365e-01 0.0000e+00
+-1.6556e-01 +9.5536e-02 0.0000e+00
+-1.4409e-01 +3.8346e-02 0.0000e+00
+-1.3265e-01 -9.7871e-03 0.0000e+00
+-1.1659e-01 -6.4968e-02 0.0000e+00
+-1.0806e-01 -1.1103e-01 0.0000e+00
+-9.6579e-02 -1.6359e-01 0.0000e+00
+-7.8940e-02 -2.1608e-01 0.0000e+00
+-6.3392e-02 -2.6853e-01 0.0000e+00
+-5.3128e-02 -3.1620e-01 0.0000e+00
+-3.6074e-02 -3.7154e-01 0.0000e+00
+-2.4463e-02 -4.2298e-01 0.0000e+00
+-4.5013e-03 -4.7435e-01 0.0000e+00
++4.0773e-03 -5.2008e-01 0.0000e+00
++2.7061e-02 -5.6878e-01 0.0000e+00
++3.5927e-02 -6.2697e-01 0.0000e+00
++4.9136e-02 -6.7632e-01 0.0000e+00
++6.6559e-02 -7.3199e-01 0.0000e+00
++8.6223e-02 -7.8056e-01 0.0000e+00
+-2.9000e-01 +7.1717e-01 0.0000e+00
+-2.7092e-01 +6.6689e-01 0.0000e+00
+-2.5306e-01 +6.2135e-01 0.0000e+00
+-2.4974e-01 +5.7188e-01 0.0000e+00
+-2.3127e-01 +5.2120e-01 0.0000e+00
+-2.1180e-01 +4.7175e-01 0.0000e+00
+-2.0131e-01 +4.1547e-01 0.0000e+00
+-1.8228e-01 +3.5921e-01 0.0000e+00
+-1.6802e-01 +3.1317e-01 0.0000e+00
+-1.5529e-01 +2.5798e-01 0.0000e+00
+-1.3805e-01 +2.1192e-01 0.0000e+00
+-1.2456e-01 +1.5659e-01 0.0000e+00
+-1.1914e-01 +1.0827e-01 0.0000e+00
+-9.6495e-02 +5.4604e-02 0.0000e+00
+-8.3448e-02 +1.3846e-03 0.0000e+00
+-6.7328e-02 -4.8187e-02 0.0000e+00
+-5.6998e-02 -9.8072e-02 0.0000e+00
+-4.0238e-02 -1.5239e-01 0.0000e+00
+-2.5976e-02 -2.0557e-01 0.0000e+00
+-7.7209e-03 -2.5555e-01 0.0000e+00
++2.8347e-03 -3.0289e-01 0.0000e+00
++2.3127e-02 -3.5864e-01 0.0000e+00
++2.8390e-02 -4.1137e-01 0.0000e+00
++4.2539e-02 -4.5997e-01 0.0000e+00
++6.3470e-02 -5.0538e-01 0.0000e+00
++7.1000e-02 -5.5910e-01 0.0000e+00
++8.6040e-02 -6.0834e-01 0.0000e+00
++1.0118e-01 -6.5921e-01 0.0000e+00
++1.1523e-01 -7.1551e-01 0.0000e+00
++1.3759e-01 -7.6342e-01 0.0000e+00
+-2.3539e-01 +7.3884e-01 0.0000e+00
+-2.2364e-01 +6.8767e-01 0.0000e+00
+-2.0482e-01 +6.3836e-01 0.0000e+00
+-1.9016e-01 +5.8823e-01 0.0000e+00
+-1.7826e-01 +5.2971e-01 0.0000e+00
+-1.5977e-01 +4.8171e-01 0.0000e+00
+-1.4735e-01 +4.2562e-01 0.0000e+00
+-1.3112e-01 +3.7934e-01 0.0000e+00
+-1.2345e-01 +3.2722e-01 0.0000e+00
+-1.0104e-01 +2.7688e-01 0.0000e+00
+-9.1266e-02 +2.2126e-01 0.0000e+00
+-8.0162e-02 +1.7654e-01 0.0000e+00
+-5.6487e-02 +1.1834e-01 0.0000e+00
+-4.1540e-02 +6.8209e-02 0.0000e+00
+-3.6012e-02 +1.4474e-02 0.0000e+00
+-2.2668e-02 -3.0740e-02 0.0000e+00
+-5.1342e-03 -8.7459e-02 0.0000e+00
++7.0215e-03 -1.3318e-01 0.0000e+00
++2.1992e-02 -1.9119e-01 0.0000e+00
++4.1293e-02 -2.4089e-01 0.0000e+00
++5.4633e-02 -2.9319e-01 0.0000e+00
++7.2216e-02 -3.3701e-01 0.0000e+00
++8.0248e-02 -3.9467e-01 0.0000e+00
++1.0063e-01 -4.4173e-01 0.0000e+00
++1.1431e-01 -4.9919e-01 0.0000e+00
++1.2707e-01 -5.4162e-01 0.0000e+00
++1.4216e-01 -5.9520e-01 0.0000e+00
++1.5494e-01 -6.5262e-01 0.0000e+00
++1.6985e-01 -6.9962e-01 0.0000e+00
++1.8243e-01 -7.4773e-01 0.0000e+00
+-1.8282e-01 +7.4761e-01 0.0000e+00
+-1.6556e-01 +7.0191e-01 0.0000e+00
+-1.5456e-01 +6.4705e-01 0.0000e+00
+-1.3970e-01 +6.0124e-01 0.0000e+00
+-1.2422e-01 +5.4665e-01 0.0000e+00
+-1.1339e-01 +4.9110e-01 0.0000e+00
+-9.8805e-02 +4.4154e-01 0.0000e+00
+-8.8247e-02 +3.9150e-01 0.0000e+00
+-7.1140e-02 +3.3804e-01 0.0000e+00
+-5.6606e-02 +2.9091e-01 0.0000e+00
+-4.2401e-02 +2.3743e-01 0.0000e+00
+-2.2660e-02 +1.8750e-01 0.0000e+00
+-7.6561e-03 +1.3957e-01 0.0000e+00
++2.5792e-03 +7.9863e-02 0.0000e+00
++2.1010e-02 +3.4901e-02 0.0000e+00
++3.0962e-02 -2.3679e-02 0.0000e+00
++4.9732e-02 -6.5026e-02 0.0000e+00
++6.4961e-02 -1.2112e-01 0.0000e+00
++7.0976e-02 -1.7145e-01 0.0000e+00
++8.8995e-02 -2.2729e-01 0.0000e+00
++1.0591e-01 -2.7955e-01 0.0000e+00
++1.1938e-01 -3.2323e-01 0.0000e+00
++1.3095e-01 -3.7556e-01 0.0000e+00
++1.5285e-01 -4.3276e-01 0.0000e+00
++1.6701e-01 -4.7783e-01 0.0000e+00
++1.8000e-01 -5.3085e-01 0.0000e+00
++1.9776e-01 -5.8358e-01 0.0000e+00
++2.0298e-01 -6.3375e-01 0.0000e+00
++2.2452e-01 -6.8992e-01 0.0000e+00
++2.3249e-01 -7.3710e-01 0.0000e+00
+-1.3221e-01 +7.6311e-01 0.0000e+00
+-1.1921e-01 +7.1924e-01 0.0000e+00
+-9.9081e-02 +6.6496e-01 0.0000e+00
+-9.0179e-02 +6.0772e-01 0.0000e+00
+-7.0945e-02 +5.6224e-01 0.0000e+00
+-6.2607e-02 +5.0839e-01 0.0000e+00
+-4.8907e-02 +4.5794e-01 0.0000e+00
+-3.1739e-02 +4.0179e-01 0.0000e+00
+-1.3090e-02 +3.6015e-01 0.0000e+00
+-6.9844e-03 +3.0027e-01 0.0000e+00
++7.1658e-03 +2.5603e-01 0.0000e+00
++2.5921e-02 +1.9931e-01 0.0000e+00
++4.3493e-02 +1.5334e-01 0.0000e+00
++5.2166e-02 +9.8217e-02 0.0000e+00
++7.3841e-02 +4.8166e-02 0.0000e+00
++8.3399e-02 -9.1369e-04 0.0000e+00
++1.0037e-01 -6.0215e-02 0.0000e+00
++1.1190e-01 -1.0843e-01 0.0000e+00
++1.3269e-01 -1.5981e-01 0.0000e+00
++1.4479e-01 -2.0733e-01 0.0000e+00
++1.5278e-01 -2.6090e-01 0.0000e+00
++1.6888e-01 -3.0888e-01 0.0000e+00
++1.8678e-01 -3.6265e-01 0.0000e+00
++1.9509e-01 -4.1598e-01 0.0000e+00
++2.1880e-01 -4.6499e-01 0.0000e+00
++2.2797e-01 -5.1435e-01 0.0000e+00
++2.4098e-01 -5.6872e-01 0.0000e+00
++2.6296e-01 -6.1777e-01 0.0000e+00
++2.7297e-01 -6.7319e-01 0.0000e+00
++2.8208e-01 -7.2280e-01 0.0000e+00
+-8.2882e-02 +7.8097e-01 0.0000e+00
+-6.8297e-02 +7.3073e-01 0.0000e+00
+-5.2451e-02 +6.8064e-01 0.0000e+00
+-3.3402e-02 +6.2680e-01 0.0000e+00
+-2.6901e-02 +5.7837e-01 0.0000e+00
+-1.4975e-02 +5.2654e-01 0.0000e+00
++1.6230e-03 +4.7164e-01 0.0000e+00
++1.7799e-02 +4.2332e-01 0.0000e+00
++3.0237e-02 +3.6452e-01 0.0000e+00
++5.3300e-02 +3.1656e-01 0.0000e+00
++5.7605e-02 +2.7119e-01 0.0000e+00
++7.3265e-02 +2.1893e-01 0.0000e+00
++8.7934e-02 +1.6826e-01 0.0000e+00
++1.1078e-01 +1.1446e-01 0.0000e+00
++1.2021e-01 +5.9159e-02 0.0000e+00
++1.3604e-01 +6.0036e-03 0.0000e+00
++1.4745e-01 -3.8800e-02 0.0000e+00
++1.6508e-01 -9.3695e-02 0.0000e+00
++1.7979e-01 -1.4082e-01 0.0000e+00
++1.9026e-01 -1.9413e-01 0.0000e+00
++2.0801e-01 -2.5044e-01 0.0000e+00
++2.2219e-01 -2.9822e-01 0.0000e+00
++2.3835e-01 -3.4496e-01 0.0000e+00
++2.4737e-01 -4.0024e-01 0.0000e+00
++2.6476e-01 -4.5110e-01 0.0000e+00
++2.7564e-01 -4.9987e-01 0.0000e+00
++2.9613e-01 -5.5708e-01 0.0000e+00
++3.1069e-01 -6.0949e-01 0.0000e+00
++3.2517e-01 -6.6067e-01 0.0000e+00
++3.3583e-01 -7.1364e-01 0.0000e+00
+-2.5084e-02 +7.9168e-01 0.0000e+00
+-1.9511e-02 +7.4314e-01 0.0000e+00
+-4.5977e-03 +6.9484e-01 0.0000e+00
++1.2089e-02 +6.4148e-01 0.0000e+00
++2.9556e-02 +5.8851e-01 0.0000e+00
++3.9136e-02 +5.4148e-01 0.0000e+00
++6.0873e-02 +4.9068e-01 0.0000e+00
++6.6286e-02 +4.3742e-01 0.0000e+00
++8.1558e-02 +3.8137e-01 0.0000e+00
++9.6885e-02 +3.3715e-01 0.0000e+00
++1.1277e-01 +2.7838e-01 0.0000e+00
++1.2474e-01 +2.3297e-01 0.0000e+00
++1.3870e-01 +1.8183e-01 0.0000e+00
++1.5572e-01 +1.2530e-01 0.0000e+00
++1.7385e-01 +7.1392e-02 0.0000e+00
++1.9192e-01 +2.2294e-02 0.0000e+00
++2.0202e-01 -2.8765e-02 0.0000e+00
++2.1340e-01 -7.4402e-02 0.0000e+00
++2.2778e-01 -1.2658e-01 0.0000e+00
++2.4343e-01 -1.7560e-01 0.0000e+00
++2.5878e-01 -2.3288e-01 0.0000e+00
++2.7788e-01 -2.8131e-01 0.0000e+00
++2.9280e-01 -3.3180e-01 0.0000e+00
++3.0084e-01 -3.8322e-01 0.0000e+00
++3.2001e-01 -4.3290e-01 0.0000e+00
++3.2801e-01 -4.8659e-01 0.0000e+00
++3.5064e-01 -5.3944e-01 0.0000e+00
++3.5774e-01 -5.9330e-01 0.0000e+00
++3.7336e-01 -6.4422e-01 0.0000e+00
++3.9328e-01 -6.8972e-01 0.0000e+00
++3.4355e-02 +7.5828e-01 0.0000e+00
++4.6192e-02 +7.0833e-01 0.0000e+00
++6.1126e-02 +6.5287e-01 0.0000e+00
++7.4617e-02 +6.0535e-01 0.0000e+00
++9.6344e-02 +5.5681e-01 0.0000e+00
++1.0560e-01 +4.9634e-01 0.0000e+00
++1.2279e-01 +4.4752e-01 0.0000e+00
++1.3873e-01 +3.9900e-01 0.0000e+00
++1.5088e-01 +3.4534e-01 0.0000e+00
++1.6121e-01 +2.9353e-01 0.0000e+00
++1.7796e-01 +2.4884e-01 0.0000e+00
++2.0010e-01 +1.8980e-01 0.0000e+00
++2.0612e-01 +1.4326e-01 0.0000e+00
++2.2159e-01 +9.1861e-02 0.0000e+00
++2.4060e-01 +4.0440e-02 0.0000e+00
++2.4677e-01 -9.4159e-03 0.0000e+00
++2.6668e-01 -5.9243e-02 0.0000e+00
++2.8045e-01 -1.1077e-01 0.0000e+00
++3.0011e-01 -1.6949e-01 0.0000e+00
++3.1258e-01 -2.1658e-01 0.0000e+00
++3.2105e-01 -2.6676e-01 0.0000e+00
++3.4289e-01 -3.1513e-01 0.0000e+00
++3.5717e-01 -3.7094e-01 0.0000e+00
++3.6462e-01 -4.2320e-01 0.0000e+00
++3.7971e-01 -4.7404e-01 0.0000e+00
++4.0353e-01 -5.2774e-01 0.0000e+00
++4.1128e-01 -5.7623e-01 0.0000e+00
++4.2407e-01 -6.2438e-01 0.0000e+00
++8.4972e-02 +7.7722e-01 0.0000e+00
++1.0251e-01 +7.2492e-01 0.0000e+00
++1.1999e-01 +6.7012e-01 0.0000e+00
++1.2858e-01 +6.1706e-01 0.0000e+00
++1.4298e-01 +5.7241e-01 0.0000e+00
++1.5864e-01 +5.1946e-01 0.0000e+00
++1.7282e-01 +4.6992e-01 0.0000e+00
++1.8210e-01 +4.1630e-01 0.0000e+00
++2.0244e-01 +3.6634e-01 0.0000e+00
++2.1788e-01 +3.1178e-01 0.0000e+00
++2.3292e-01 +2.6515e-01 0.0000e+00
++2.4803e-01 +2.1250e-01 0.0000e+00
++2.6170e-01 +1.5728e-01 0.0000e+00
++2.7289e-01 +9.9817e-02 0.0000e+00
++2.9209e-01 +5.7637e-02 0.0000e+00
++3.0077e-01 -1.7581e-03 0.0000e+00
++3.1473e-01 -4.8932e-02 0.0000e+00
++3.3064e-01 -1.0190e-01 0.0000e+00
++3.4334e-01 -1.5517e-01 0.0000e+00
++3.6332e-01 -1.9870e-01 0.0000e+00
++3.7224e-01 -2.5699e-01 0.0000e+00
++3.8525e-01 -3.0437e-01 0.0000e+00
++4.0497e-01 -3.5135e-01 0.0000e+00
++4.1766e-01 -4.1057e-01 0.0000e+00
++4.2941e-01 -4.5980e-01 0.0000e+00
++4.5026e-01 -5.1393e-01 0.0000e+00
++4.6208e-01 -5.6428e-01 0.0000e+00
++4.7832e-01 -6.1705e-01 0.0000e+00
++1.5423e-01 +7.4033e-01 0.0000e+00
++1.6832e-01 +6.8917e-01 0.0000e+00
++1.7954e-01 +6.3289e-01 0.0000e+00
++1.9533e-01 +5.8064e-01 0.0000e+00
++2.1415e-01 +5.3176e-01 0.0000e+00
++2.2513e-01 +4.7757e-01 0.0000e+00
++2.3964e-01 +4.3140e-01 0.0000e+00
++2.5425e-01 +3.7230e-01 0.0000e+00
++2.6752e-01 +3.2450e-01 0.0000e+00
++2.8725e-01 +2.7725e-01 0.0000e+00
++2.9268e-01 +2.2161e-01 0.0000e+00
++3.1082e-01 +1.7482e-01 0.0000e+00
++3.2043e-01 +1.2357e-01 0.0000e+00
++3.3872e-01 +6.4253e-02 0.0000e+00
++3.6087e-01 +1.4456e-02 0.0000e+00
++3.7320e-01 -2.8021e-02 0.0000e+00
++3.8366e-01 -8.3938e-02 0.0000e+00
++3.9434e-01 -1.3260e-01 0.0000e+00
++4.1548e-01 -1.8821e-01 0.0000e+00
++4.2328e-01 -2.4235e-01 0.0000e+00
++4.4140e-01 -2.8750e-01 0.0000e+00
++4.5416e-01 -3.4356e-01 0.0000e+00
++4.7001e-01 -3.9732e-01 0.0000e+00
++4.8121e-01 -4.4336e-01 0.0000e+00
++5.0290e-01 -4.9739e-01 0.0000e+00
++5.1573e-01 -5.4726e-01 0.0000e+00
++5.2533e-01 -5.9577e-01 0.0000e+00
++2.0549e-01 +7.5421e-01 0.0000e+00
++2.1929e-01 +7.0158e-01 0.0000e+00
++2.2656e-01 +6.5127e-01 0.0000e+00
++2.5047e-01 +5.9836e-01 0.0000e+00
++2.5944e-01 +5.3969e-01 0.0000e+00
++2.7094e-01 +4.9736e-01 0.0000e+00
++2.8974e-01 +4.4338e-01 0.0000e+00
++3.0663e-01 +3.9072e-01 0.0000e+00
++3.2423e-01 +3.3857e-01 0.0000e+00
++3.3749e-01 +2.9151e-01 0.0000e+00
++3.4644e-01 +2.3252e-01 0.0000e+00
++3.5992e-01 +1.8256e-01 0.0000e+00
++3.7800e-01 +1.3276e-01 0.0000e+00
++3.9302e-01 +8.0157e-02 0.0000e+00
++4.0361e-01 +3.5331e-02 0.0000e+00
++4.2146e-01 -1.8265e-02 0.0000e+00
++4.3237e-01 -7.7262e-02 0.0000e+00
++4.4650e-01 -1.2227e-01 0.0000e+00
++4.6622e-01 -1.6873e-01 0.0000e+00
++4.8270e-01 -2.2543e-01 0.0000e+00
++4.9081e-01 -2.7553e-01 0.0000e+00
++5.0768e-01 -3.2691e-01 0.0000e+00
++5.2157e-01 -3.7925e-01 0.0000e+00
++5.3681e-01 -4.3333e-01 0.0000e+00
++5.5653e-01 -4.8447e-01 0.0000e+00
++5.6563e-01 -5.3628e-01 0.0000e+00
++2.6628e-01 +7.1363e-01 0.0000e+00
++2.8474e-01 +6.6609e-01 0.0000e+00
++3.0053e-01 +6.0640e-01 0.0000e+00
++3.1184e-01 +5.6259e-01 0.0000e+00
++3.3021e-01 +5.1093e-01 0.0000e+00
++3.4155e-01 +4.5572e-01 0.0000e+00
++3.6213e-01 +4.0432e-01 0.0000e+00
++3.6633e-01 +3.5500e-01 0.0000e+00
++3.8261e-01 +3.0136e-01 0.0000e+00
++3.9611e-01 +2.4881e-01 0.0000e+00
++4.1125e-01 +1.9660e-01 0.0000e+00
++4.2607e-01 +1.4291e-01 0.0000e+00
++4.4171e-01 +1.0193e-01 0.0000e+00
++4.5709e-01 +4.4197e-02 0.0000e+00
++4.7131e-01 -2.5074e-03 0.0000e+00
++4.8689e-01 -5.9882e-02 0.0000e+00
++5.0041e-01 -1.0440e-01 0.0000e+00
++5.1521e-01 -1.5968e-01 0.0000e+00
++5.3462e-01 -2.0906e-01 0.0000e+00
++5.4453e-01 -2.5665e-01 0.0000e+00
++5.5807e-01 -3.0840e-01 0.0000e+00
++5.7206e-01 -3.6738e-01 0.0000e+00
++5.8399e-01 -4.1333e-01 0.0000e+00
++6.0027e-01 -4.6810e-01 0.0000e+00
++3.2199e-01 +7.3223e-01 0.0000e+00
++3.3989e-01 +6.7617e-01 0.0000e+00
++3.5381e-01 +6.2743e-01 0.0000e+00
++3.6749e-01 +5.7814e-01 0.0000e+00
++3.8397e-01 +5.2029e-01 0.0000e+00
++3.9126e-01 +4.7439e-01 0.0000e+00
++4.0597e-01 +4.1910e-01 0.0000e+00
++4.2081e-01 +3.7291e-01 0.0000e+00
++4.3251e-01 +3.2088e-01 0.0000e+00
++4.5637e-01 +2.6801e-01 0.0000e+00
++4.6475e-01 +2.1325e-01 0.0000e+00
++4.8161e-01 +1.5966e-01 0.0000e+00
++4.9707e-01 +1.1705e-01 0.0000e+00
++5.0770e-01 +6.4422e-02 0.0000e+00
++5.2772e-01 +1.2902e-02 0.0000e+00
++5.3857e-01 -4.0993e-02 0.0000e+00
++5.5434e-01 -9.0010e-02 0.0000e+00
++5.6465e-01 -1.4600e-01 0.0000e+00
++5.8151e-01 -1.9073e-01 0.0000e+00
++5.9491e-01 -2.4963e-01 0.0000e+00
++6.0769e-01 -3.0470e-01 0.0000e+00
++6.2692e-01 -3.5034e-01 0.0000e+00
++6.3944e-01 -3.9793e-01 0.0000e+00
++6.5743e-01 -4.5315e-01 0.0000e+00
++3.9002e-01 +6.9188e-01 0.0000e+00
++4.0455e-01 +6.3793e-01 0.0000e+00
++4.1860e-01 +5.8894e-01 0.0000e+00
++4.3012e-01 +5.4001e-01 0.0000e+00
++4.4535e-01 +4.8611e-01 0.0000e+00
++4.5502e-01 +4.3701e-01 0.0000e+00
++4.7218e-01 +3.8007e-01 0.0000e+00
++4.8609e-01 +3.2566e-01 0.0000e+00
++5.0763e-01 +2.7876e-01 0.0000e+00
++5.2149e-01 +2.2898e-01 0.0000e+00
++5.3613e-01 +1.7453e-01 0.0000e+00
++5.4574e-01 +1.3097e-01 0.0000e+00
++5.5983e-01 +7.2609e-02 0.0000e+00
++5.7704e-01 +2.0003e-02 0.0000e+00
++5.9282e-01 -2.1492e-02 0.0000e+00
++6.0406e-01 -7.4899e-02 0.0000e+00
++6.2391e-01 -1.3349e-01 0.0000e+00
++6.3805e-01 -1.8414e-01 0.0000e+00
++6.4877e-01 -2.2760e-01 0.0000e+00
++6.5813e-01 -2.8772e-01 0.0000e+00
++6.7368e-01 -3.3980e-01 0.0000e+00
++6.9320e-01 -3.8472e-01 0.0000e+00
++4.5872e-01 +6.5246e-01 0.0000e+00
++4.6676e-01 +6.0795e-01 0.0000e+00
++4.8041e-01 +5.5559e-01 0.0000e+00
++4.9915e-01 +5.0211e-01 0.0000e+00
++5.0839e-01 +4.4908e-01 0.0000e+00
++5.3091e-01 +3.9644e-01 0.0000e+00
++5.4593e-01 +3.4262e-01 0.0000e+00
++5.5654e-01 +2.9911e-01 0.0000e+00
++5.6452e-01 +2.3979e-01 0.0000e+00
++5.8499e-01 +1.9037e-01 0.0000e+00
++5.9976e-01 +1.4263e-01 0.0000e+00
++6.0934e-01 +8.4915e-02 0.0000e+00
++6.2639e-01 +3.7836e-02 0.0000e+00
++6.4258e-01 -7.9987e-03 0.0000e+00
++6.5511e-01 -6.5784e-02 0.0000e+00
++6.7045e-01 -1.1982e-01 0.0000e+00
++6.8824e-01 -1.6159e-01 0.0000e+00
++6.9573e-01 -2.1867e-01 0.0000e+00
++7.0935e-01 -2.7397e-01 0.0000e+00
++7.3086e-01 -3.2527e-01 0.0000e+00
++5.2968e-01 +5.6735e-01 0.0000e+00
++5.5098e-01 +5.1619e-01 0.0000e+00
++5.6277e-01 +4.6577e-01 0.0000e+00
++5.7461e-01 +4.1523e-01 0.0000e+00
++5.8861e-01 +3.6481e-01 0.0000e+00
++6.0536e-01 +3.0894e-01 0.0000e+00
++6.1353e-01 +2.6143e-01 0.0000e+00
++6.3363e-01 +2.0148e-01 0.0000e+00
++6.4951e-01 +1.5272e-01 0.0000e+00
++6.6031e-01 +9.8996e-02 0.0000e+00
++6.8144e-01 +5.1214e-02 0.0000e+00
++6.9544e-01 +6.8987e-03 0.0000e+00
++7.0801e-01 -5.0252e-02 0.0000e+00
++7.2591e-01 -1.0326e-01 0.0000e+00
++7.3963e-01 -1.5620e-01 0.0000e+00
++7.4850e-01 -2.0277e-01 0.0000e+00
++6.1659e-01 +4.7651e-01 0.0000e+00
++6.2501e-01 +4.2631e-01 0.0000e+00
++6.4081e-01 +3.7284e-01 0.0000e+00
++6.5247e-01 +3.2103e-01 0.0000e+00
++6.7017e-01 +2.7475e-01 0.0000e+00
++6.8958e-01 +2.1800e-01 0.0000e+00
++6.9784e-01 +1.7184e-01 0.0000e+00
++7.2055e-01 +1.1513e-01 0.0000e+00
++7.3343e-01 +6.6921e-02 0.0000e+00
++7.4032e-01 +1.8810e-02 0.0000e+00
++7.6292e-01 -3.7724e-02 0.0000e+00
++7.7522e-01 -8.7565e-02 0.0000e+00
++6.9283e-01 +3.9108e-01 0.0000e+00
++7.1140e-01 +3.3970e-01 0.0000e+00
++7.2486e-01 +2.8595e-01 0.0000e+00
++7.3660e-01 +2.4066e-01 0.0000e+00
++7.5021e-01 +1.8447e-01 0.0000e+00
++7.6327e-01 +1.2825e-01 0.0000e+00
++7.7950e-01 +7.9706e-02 0.0000e+00
++7.9371e-01 +2.9517e-02 0.0000e+00
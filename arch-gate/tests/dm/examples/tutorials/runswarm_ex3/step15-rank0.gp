@@ -0,0 +1,711 @@
+-7.9263e-01 +1.3186e-01 0.0000e+00
+-7.8567e-01 +7.0720e-02 0.0000e+00
+-7.8803e-01 +1.7368e-02 0.0000e+00
+-7.7966e-01 -3.4749e-02 0.0000e+00
+-7.8116e-01 -8.0979e-02 0.0000e+00
+-7.7498e-01 -1.4507e-01 0.0000e+00
+-7.7282e-01 -1.9723e-01 0.0000e+00
+-7.6282e-01 -2.5081e-01 0.0000e+00
+-7.5268e-01 +2.9373e-01 0.0000e+00
+-7.5215e-01 +2.3741e-01 0.0000e+00
+-7.4784e-01 +1.8223e-01 0.0000e+00
+-7.4307e-01 +1.2927e-01 0.0000e+00
+-7.3712e-01 +7.7868e-02 0.0000e+00
+-7.3627e-01 +2.8572e-02 0.0000e+00
+-7.3242e-01 -2.7421e-02 0.0000e+00
+-7.2335e-01 -7.8123e-02 0.0000e+00
+-7.1666e-01 -1.3910e-01 0.0000e+00
+-7.1285e-01 -1.8483e-01 0.0000e+00
+-7.1245e-01 -2.4403e-01 0.0000e+00
+-7.0792e-01 -3.0223e-01 0.0000e+00
+-7.0061e-01 -3.5134e-01 0.0000e+00
+-7.0778e-01 +3.5619e-01 0.0000e+00
+-7.0289e-01 +2.9378e-01 0.0000e+00
+-6.9046e-01 +2.4755e-01 0.0000e+00
+-6.9349e-01 +1.9133e-01 0.0000e+00
+-6.8772e-01 +1.3980e-01 0.0000e+00
+-6.8073e-01 +8.0808e-02 0.0000e+00
+-6.7725e-01 +2.5144e-02 0.0000e+00
+-6.7767e-01 -2.3130e-02 0.0000e+00
+-6.7165e-01 -7.8965e-02 0.0000e+00
+-6.6249e-01 -1.3479e-01 0.0000e+00
+-6.6277e-01 -1.8771e-01 0.0000e+00
+-6.5943e-01 -2.4025e-01 0.0000e+00
+-6.5204e-01 -2.9147e-01 0.0000e+00
+-6.5139e-01 -3.4703e-01 0.0000e+00
+-6.3963e-01 -4.0076e-01 0.0000e+00
+-6.4217e-01 -4.5429e-01 0.0000e+00
+-6.6017e-01 +4.6055e-01 0.0000e+00
+-6.5529e-01 +4.0672e-01 0.0000e+00
+-6.5018e-01 +3.5965e-01 0.0000e+00
+-6.3926e-01 +3.0185e-01 0.0000e+00
+-6.3646e-01 +2.4965e-01 0.0000e+00
+-6.3564e-01 +1.9626e-01 0.0000e+00
+-6.3264e-01 +1.4411e-01 0.0000e+00
+-6.3130e-01 +8.6816e-02 0.0000e+00
+-6.2610e-01 +3.4362e-02 0.0000e+00
+-6.1524e-01 -1.8291e-02 0.0000e+00
+-6.1449e-01 -7.5161e-02 0.0000e+00
+-6.0689e-01 -1.2233e-01 0.0000e+00
+-6.0547e-01 -1.8118e-01 0.0000e+00
+-6.0098e-01 -2.3057e-01 0.0000e+00
+-5.9568e-01 -2.8907e-01 0.0000e+00
+-6.0058e-01 -3.4381e-01 0.0000e+00
+-5.9279e-01 -4.0024e-01 0.0000e+00
+-5.8276e-01 -4.5351e-01 0.0000e+00
+-5.8484e-01 -5.0088e-01 0.0000e+00
+-5.8146e-01 -5.5470e-01 0.0000e+00
+-6.0289e-01 +5.2075e-01 0.0000e+00
+-6.0542e-01 +4.6570e-01 0.0000e+00
+-5.9365e-01 +4.1396e-01 0.0000e+00
+-5.9068e-01 +3.6289e-01 0.0000e+00
+-5.8689e-01 +3.0522e-01 0.0000e+00
+-5.9050e-01 +2.5129e-01 0.0000e+00
+-5.8550e-01 +1.9370e-01 0.0000e+00
+-5.7989e-01 +1.4695e-01 0.0000e+00
+-5.7953e-01 +9.2245e-02 0.0000e+00
+-5.6626e-01 +4.2890e-02 0.0000e+00
+-5.6620e-01 -1.9526e-02 0.0000e+00
+-5.6610e-01 -7.4842e-02 0.0000e+00
+-5.6149e-01 -1.2657e-01 0.0000e+00
+-5.5641e-01 -1.7917e-01 0.0000e+00
+-5.4945e-01 -2.3611e-01 0.0000e+00
+-5.4515e-01 -2.8787e-01 0.0000e+00
+-5.4289e-01 -3.4173e-01 0.0000e+00
+-5.3918e-01 -3.8987e-01 0.0000e+00
+-5.3524e-01 -4.4567e-01 0.0000e+00
+-5.3107e-01 -4.9606e-01 0.0000e+00
+-5.2608e-01 -5.5699e-01 0.0000e+00
+-5.2484e-01 -6.0912e-01 0.0000e+00
+-5.5700e-01 +5.8052e-01 0.0000e+00
+-5.5031e-01 +5.3025e-01 0.0000e+00
+-5.5301e-01 +4.7249e-01 0.0000e+00
+-5.4479e-01 +4.1440e-01 0.0000e+00
+-5.3721e-01 +3.5964e-01 0.0000e+00
+-5.3702e-01 +3.0596e-01 0.0000e+00
+-5.3574e-01 +2.6094e-01 0.0000e+00
+-5.3275e-01 +2.0024e-01 0.0000e+00
+-5.2939e-01 +1.5070e-01 0.0000e+00
+-5.1628e-01 +9.2208e-02 0.0000e+00
+-5.1931e-01 +4.0050e-02 0.0000e+00
+-5.1131e-01 -1.4348e-02 0.0000e+00
+-5.1352e-01 -6.5768e-02 0.0000e+00
+-5.0150e-01 -1.2032e-01 0.0000e+00
+-5.0487e-01 -1.7443e-01 0.0000e+00
+-4.9697e-01 -2.2744e-01 0.0000e+00
+-4.9245e-01 -2.7803e-01 0.0000e+00
+-4.8636e-01 -3.3152e-01 0.0000e+00
+-4.8791e-01 -3.9161e-01 0.0000e+00
+-4.8378e-01 -4.4401e-01 0.0000e+00
+-4.7064e-01 -4.9949e-01 0.0000e+00
+-4.7032e-01 -5.4369e-01 0.0000e+00
+-4.6311e-01 -6.0642e-01 0.0000e+00
+-4.6240e-01 -6.6009e-01 0.0000e+00
+-5.0814e-01 +5.8432e-01 0.0000e+00
+-4.9847e-01 +5.3297e-01 0.0000e+00
+-4.9564e-01 +4.7642e-01 0.0000e+00
+-4.9480e-01 +4.1810e-01 0.0000e+00
+-4.8358e-01 +3.7260e-01 0.0000e+00
+-4.8145e-01 +3.1356e-01 0.0000e+00
+-4.7514e-01 +2.6403e-01 0.0000e+00
+-4.7071e-01 +2.0438e-01 0.0000e+00
+-4.6694e-01 +1.5387e-01 0.0000e+00
+-4.7067e-01 +1.0455e-01 0.0000e+00
+-4.6747e-01 +4.7163e-02 0.0000e+00
+-4.5971e-01 -1.1738e-02 0.0000e+00
+-4.5710e-01 -6.1830e-02 0.0000e+00
+-4.5122e-01 -1.1951e-01 0.0000e+00
+-4.4199e-01 -1.6336e-01 0.0000e+00
+-4.3970e-01 -2.1876e-01 0.0000e+00
+-4.3897e-01 -2.7563e-01 0.0000e+00
+-4.3942e-01 -3.2651e-01 0.0000e+00
+-4.2713e-01 -3.8082e-01 0.0000e+00
+-4.2244e-01 -4.4086e-01 0.0000e+00
+-4.2060e-01 -4.8701e-01 0.0000e+00
+-4.1739e-01 -5.4963e-01 0.0000e+00
+-4.1935e-01 -5.9590e-01 0.0000e+00
+-4.0902e-01 -6.4811e-01 0.0000e+00
+-4.5565e-01 +6.4202e-01 0.0000e+00
+-4.5153e-01 +5.8723e-01 0.0000e+00
+-4.4198e-01 +5.3190e-01 0.0000e+00
+-4.4018e-01 +4.8265e-01 0.0000e+00
+-4.3841e-01 +4.3113e-01 0.0000e+00
+-4.3598e-01 +3.7358e-01 0.0000e+00
+-4.3175e-01 +3.1379e-01 0.0000e+00
+-4.2624e-01 +2.6902e-01 0.0000e+00
+-4.1883e-01 +2.1111e-01 0.0000e+00
+-4.1861e-01 +1.5578e-01 0.0000e+00
+-4.1332e-01 +1.0249e-01 0.0000e+00
+-4.0594e-01 +5.0088e-02 0.0000e+00
+-4.0189e-01 -3.0055e-03 0.0000e+00
+-4.0588e-01 -5.2553e-02 0.0000e+00
+-3.9341e-01 -1.1152e-01 0.0000e+00
+-3.9185e-01 -1.6142e-01 0.0000e+00
+-3.8390e-01 -2.1724e-01 0.0000e+00
+-3.8940e-01 -2.6847e-01 0.0000e+00
+-3.7982e-01 -3.2310e-01 0.0000e+00
+-3.7134e-01 -3.8188e-01 0.0000e+00
+-3.7327e-01 -4.3549e-01 0.0000e+00
+-3.7194e-01 -4.8475e-01 0.0000e+00
+-3.6940e-01 -5.3934e-01 0.0000e+00
+-3.5640e-01 -5.9224e-01 0.0000e+00
+-3.6035e-01 -6.4472e-01 0.0000e+00
+-3.4977e-01 -7.0552e-01 0.0000e+00
+-4.0740e-01 +6.9311e-01 0.0000e+00
+-3.9721e-01 +6.4115e-01 0.0000e+00
+-3.9371e-01 +5.8665e-01 0.0000e+00
+-3.9659e-01 +5.3398e-01 0.0000e+00
+-3.8381e-01 +4.8368e-01 0.0000e+00
+-3.8156e-01 +4.3501e-01 0.0000e+00
+-3.8103e-01 +3.7367e-01 0.0000e+00
+-3.7105e-01 +3.2634e-01 0.0000e+00
+-3.6892e-01 +2.7418e-01 0.0000e+00
+-3.7106e-01 +2.1187e-01 0.0000e+00
+-3.6836e-01 +1.5696e-01 0.0000e+00
+-3.5508e-01 +1.1115e-01 0.0000e+00
+-3.5760e-01 +5.3263e-02 0.0000e+00
+-3.5063e-01 -2.2926e-04 0.0000e+00
+-3.4164e-01 -5.6926e-02 0.0000e+00
+-3.3890e-01 -1.0364e-01 0.0000e+00
+-3.3448e-01 -1.5814e-01 0.0000e+00
+-3.3424e-01 -2.1435e-01 0.0000e+00
+-3.3390e-01 -2.7108e-01 0.0000e+00
+-3.3077e-01 -3.2157e-01 0.0000e+00
+-3.2483e-01 -3.7566e-01 0.0000e+00
+-3.1533e-01 -4.3078e-01 0.0000e+00
+-3.1580e-01 -4.8235e-01 0.0000e+00
+-3.1514e-01 -5.3671e-01 0.0000e+00
+-3.0810e-01 -5.9022e-01 0.0000e+00
+-3.0228e-01 -6.4229e-01 0.0000e+00
+-2.9781e-01 -7.0172e-01 0.0000e+00
+-3.4489e-01 +6.9821e-01 0.0000e+00
+-3.5151e-01 +6.4964e-01 0.0000e+00
+-3.4620e-01 +5.9909e-01 0.0000e+00
+-3.4221e-01 +5.4624e-01 0.0000e+00
+-3.3891e-01 +4.8629e-01 0.0000e+00
+-3.3348e-01 +4.3427e-01 0.0000e+00
+-3.3036e-01 +3.7575e-01 0.0000e+00
+-3.1768e-01 +3.3037e-01 0.0000e+00
+-3.2080e-01 +2.7052e-01 0.0000e+00
+-3.1384e-01 +2.1713e-01 0.0000e+00
+-3.1086e-01 +1.7049e-01 0.0000e+00
+-3.0639e-01 +1.1163e-01 0.0000e+00
+-3.0031e-01 +6.2138e-02 0.0000e+00
+-2.9518e-01 +8.1531e-03 0.0000e+00
+-2.9210e-01 -5.2201e-02 0.0000e+00
+-2.8846e-01 -1.0315e-01 0.0000e+00
+-2.8135e-01 -1.5437e-01 0.0000e+00
+-2.7605e-01 -2.1436e-01 0.0000e+00
+-2.7667e-01 -2.6560e-01 0.0000e+00
+-2.7287e-01 -3.1698e-01 0.0000e+00
+-2.6975e-01 -3.6685e-01 0.0000e+00
+-2.6508e-01 -4.2370e-01 0.0000e+00
+-2.6146e-01 -4.7918e-01 0.0000e+00
+-2.5143e-01 -5.3751e-01 0.0000e+00
+-2.5421e-01 -5.8910e-01 0.0000e+00
+-2.4652e-01 -6.3935e-01 0.0000e+00
+-2.4619e-01 -6.9718e-01 0.0000e+00
+-2.3979e-01 -7.4770e-01 0.0000e+00
+-2.9896e-01 +7.0640e-01 0.0000e+00
+-2.9221e-01 +6.5748e-01 0.0000e+00
+-2.8897e-01 +5.9827e-01 0.0000e+00
+-2.8879e-01 +5.4394e-01 0.0000e+00
+-2.7711e-01 +4.8713e-01 0.0000e+00
+-2.7491e-01 +4.3942e-01 0.0000e+00
+-2.7766e-01 +3.8783e-01 0.0000e+00
+-2.7159e-01 +3.2986e-01 0.0000e+00
+-2.6024e-01 +2.7668e-01 0.0000e+00
+-2.6122e-01 +2.2081e-01 0.0000e+00
+-2.5887e-01 +1.7273e-01 0.0000e+00
+-2.5697e-01 +1.1283e-01 0.0000e+00
+-2.4348e-01 +5.7349e-02 0.0000e+00
+-2.4412e-01 +1.3217e-02 0.0000e+00
+-2.3546e-01 -4.8680e-02 0.0000e+00
+-2.3972e-01 -1.0216e-01 0.0000e+00
+-2.3080e-01 -1.4865e-01 0.0000e+00
+-2.3250e-01 -2.0658e-01 0.0000e+00
+-2.2340e-01 -2.6134e-01 0.0000e+00
+-2.2283e-01 -3.1587e-01 0.0000e+00
+-2.1095e-01 -3.6236e-01 0.0000e+00
+-2.1634e-01 -4.2021e-01 0.0000e+00
+-2.0510e-01 -4.7990e-01 0.0000e+00
+-2.0710e-01 -5.2598e-01 0.0000e+00
+-1.9436e-01 -5.8238e-01 0.0000e+00
+-1.9001e-01 -6.3920e-01 0.0000e+00
+-1.9181e-01 -6.8722e-01 0.0000e+00
+-1.8534e-01 -7.4492e-01 0.0000e+00
+-2.4635e-01 +7.6924e-01 0.0000e+00
+-2.4258e-01 +7.0816e-01 0.0000e+00
+-2.3472e-01 +6.6137e-01 0.0000e+00
+-2.3106e-01 +5.9957e-01 0.0000e+00
+-2.2985e-01 +5.5194e-01 0.0000e+00
+-2.2128e-01 +4.9340e-01 0.0000e+00
+-2.1984e-01 +4.4529e-01 0.0000e+00
+-2.2380e-01 +3.8769e-01 0.0000e+00
+-2.1682e-01 +3.3286e-01 0.0000e+00
+-2.0974e-01 +2.7827e-01 0.0000e+00
+-2.0707e-01 +2.2540e-01 0.0000e+00
+-2.0321e-01 +1.7544e-01 0.0000e+00
+-1.9876e-01 +1.2080e-01 0.0000e+00
+-1.9477e-01 +6.9764e-02 0.0000e+00
+-1.8719e-01 +7.5509e-03 0.0000e+00
+-1.9089e-01 -3.7941e-02 0.0000e+00
+-1.8694e-01 -9.5030e-02 0.0000e+00
+-1.7714e-01 -1.4894e-01 0.0000e+00
+-1.7737e-01 -2.0491e-01 0.0000e+00
+-1.6903e-01 -2.5356e-01 0.0000e+00
+-1.6802e-01 -3.1262e-01 0.0000e+00
+-1.6177e-01 -3.5955e-01 0.0000e+00
+-1.5975e-01 -4.1706e-01 0.0000e+00
+-1.5117e-01 -4.7437e-01 0.0000e+00
+-1.4680e-01 -5.2337e-01 0.0000e+00
+-1.4925e-01 -5.7991e-01 0.0000e+00
+-1.4131e-01 -6.2987e-01 0.0000e+00
+-1.3663e-01 -6.8648e-01 0.0000e+00
+-1.3624e-01 -7.4063e-01 0.0000e+00
+-1.3184e-01 -7.9119e-01 0.0000e+00
+-1.9001e-01 +7.6945e-01 0.0000e+00
+-1.8746e-01 +7.1647e-01 0.0000e+00
+-1.8622e-01 +6.6251e-01 0.0000e+00
+-1.8005e-01 +6.1179e-01 0.0000e+00
+-1.7871e-01 +5.5664e-01 0.0000e+00
+-1.6752e-01 +4.9675e-01 0.0000e+00
+-1.7063e-01 +4.4284e-01 0.0000e+00
+-1.6213e-01 +3.9526e-01 0.0000e+00
+-1.5955e-01 +3.4407e-01 0.0000e+00
+-1.5660e-01 +2.8173e-01 0.0000e+00
+-1.5509e-01 +2.2928e-01 0.0000e+00
+-1.5071e-01 +1.7846e-01 0.0000e+00
+-1.4479e-01 +1.2769e-01 0.0000e+00
+-1.3498e-01 +6.6781e-02 0.0000e+00
+-1.3328e-01 +1.6841e-02 0.0000e+00
+-1.2842e-01 -4.1000e-02 0.0000e+00
+-1.2919e-01 -8.8311e-02 0.0000e+00
+-1.2833e-01 -1.4264e-01 0.0000e+00
+-1.2137e-01 -1.9813e-01 0.0000e+00
+-1.1646e-01 -2.5317e-01 0.0000e+00
+-1.1584e-01 -3.0242e-01 0.0000e+00
+-1.1002e-01 -3.6061e-01 0.0000e+00
+-1.0881e-01 -4.1385e-01 0.0000e+00
+-9.9326e-02 -4.6871e-01 0.0000e+00
+-9.9980e-02 -5.1570e-01 0.0000e+00
+-8.6966e-02 -5.6851e-01 0.0000e+00
+-8.9827e-02 -6.2789e-01 0.0000e+00
+-8.6618e-02 -6.7938e-01 0.0000e+00
+-8.0506e-02 -7.3799e-01 0.0000e+00
+-7.0750e-02 -7.8999e-01 0.0000e+00
+-1.4367e-01 +7.6800e-01 0.0000e+00
+-1.3483e-01 +7.1440e-01 0.0000e+00
+-1.2626e-01 +6.6575e-01 0.0000e+00
+-1.3286e-01 +6.1611e-01 0.0000e+00
+-1.2472e-01 +5.6225e-01 0.0000e+00
+-1.1533e-01 +5.0940e-01 0.0000e+00
+-1.1620e-01 +4.5158e-01 0.0000e+00
+-1.0861e-01 +3.9207e-01 0.0000e+00
+-1.0370e-01 +3.4364e-01 0.0000e+00
+-1.0214e-01 +2.8645e-01 0.0000e+00
+-9.4285e-02 +2.3741e-01 0.0000e+00
+-9.1996e-02 +1.7993e-01 0.0000e+00
+-9.6293e-02 +1.3101e-01 0.0000e+00
+-8.4609e-02 +7.3357e-02 0.0000e+00
+-8.2336e-02 +1.8060e-02 0.0000e+00
+-7.6292e-02 -3.4239e-02 0.0000e+00
+-7.6042e-02 -8.5691e-02 0.0000e+00
+-7.0314e-02 -1.4282e-01 0.0000e+00
+-6.6830e-02 -1.9832e-01 0.0000e+00
+-5.8753e-02 -2.5145e-01 0.0000e+00
+-5.7772e-02 -3.0043e-01 0.0000e+00
+-4.8832e-02 -3.5968e-01 0.0000e+00
+-5.4169e-02 -4.1294e-01 0.0000e+00
+-4.9881e-02 -4.6388e-01 0.0000e+00
+-3.8240e-02 -5.1302e-01 0.0000e+00
+-4.1530e-02 -5.6771e-01 0.0000e+00
+-3.6489e-02 -6.1947e-01 0.0000e+00
+-3.1678e-02 -6.7285e-01 0.0000e+00
+-2.9023e-02 -7.3140e-01 0.0000e+00
+-1.6471e-02 -7.8331e-01 0.0000e+00
+-8.5267e-02 +7.7853e-01 0.0000e+00
+-8.3870e-02 +7.2553e-01 0.0000e+00
+-7.5102e-02 +6.7294e-01 0.0000e+00
+-7.0610e-02 +6.2038e-01 0.0000e+00
+-7.0535e-02 +5.6007e-01 0.0000e+00
+-6.1826e-02 +5.0884e-01 0.0000e+00
+-6.0755e-02 +4.5083e-01 0.0000e+00
+-5.3940e-02 +4.0177e-01 0.0000e+00
+-5.6771e-02 +3.4864e-01 0.0000e+00
+-4.4650e-02 +2.9432e-01 0.0000e+00
+-4.6101e-02 +2.3730e-01 0.0000e+00
+-4.4054e-02 +1.9080e-01 0.0000e+00
+-3.2255e-02 +1.2845e-01 0.0000e+00
+-2.7483e-02 +7.5835e-02 0.0000e+00
+-3.2757e-02 +2.1531e-02 0.0000e+00
+-2.8590e-02 -2.5899e-02 0.0000e+00
+-2.2575e-02 -8.5557e-02 0.0000e+00
+-1.9684e-02 -1.3325e-01 0.0000e+00
+-1.6467e-02 -1.9368e-01 0.0000e+00
+-7.2969e-03 -2.4673e-01 0.0000e+00
+-4.5515e-03 -3.0118e-01 0.0000e+00
++4.0917e-03 -3.4808e-01 0.0000e+00
++5.1092e-04 -4.0678e-01 0.0000e+00
++1.1277e-02 -4.5744e-01 0.0000e+00
++1.3333e-02 -5.1706e-01 0.0000e+00
++1.7474e-02 -5.6162e-01 0.0000e+00
++2.1698e-02 -6.1768e-01 0.0000e+00
++2.2867e-02 -6.7708e-01 0.0000e+00
++2.8223e-02 -7.2660e-01 0.0000e+00
++3.1058e-02 -7.7674e-01 0.0000e+00
+-3.1469e-02 +7.7670e-01 0.0000e+00
+-2.3522e-02 +7.2800e-01 0.0000e+00
+-2.3602e-02 +6.7149e-01 0.0000e+00
+-1.8057e-02 +6.2316e-01 0.0000e+00
+-1.3643e-02 +5.6603e-01 0.0000e+00
+-1.4035e-02 +5.0887e-01 0.0000e+00
+-9.5080e-03 +4.5689e-01 0.0000e+00
+-9.0646e-03 +4.0523e-01 0.0000e+00
+-2.8216e-03 +3.4888e-01 0.0000e+00
++2.1430e-03 +2.9932e-01 0.0000e+00
++5.5099e-03 +2.4354e-01 0.0000e+00
++1.5067e-02 +1.9016e-01 0.0000e+00
++2.0335e-02 +1.3971e-01 0.0000e+00
++1.8526e-02 +7.8549e-02 0.0000e+00
++2.7780e-02 +3.0350e-02 0.0000e+00
++2.5916e-02 -2.9635e-02 0.0000e+00
++3.6230e-02 -7.4322e-02 0.0000e+00
++4.0087e-02 -1.3291e-01 0.0000e+00
++3.5977e-02 -1.8393e-01 0.0000e+00
++4.2647e-02 -2.4282e-01 0.0000e+00
++4.8944e-02 -2.9794e-01 0.0000e+00
++5.3542e-02 -3.4387e-01 0.0000e+00
++5.4532e-02 -3.9800e-01 0.0000e+00
++6.4770e-02 -4.5900e-01 0.0000e+00
++6.9779e-02 -5.0645e-01 0.0000e+00
++7.2030e-02 -5.6154e-01 0.0000e+00
++7.9070e-02 -6.1729e-01 0.0000e+00
++7.4199e-02 -6.6801e-01 0.0000e+00
++8.4292e-02 -7.2792e-01 0.0000e+00
++8.2748e-02 -7.7622e-01 0.0000e+00
++2.1731e-02 +7.8192e-01 0.0000e+00
++2.5830e-02 +7.3589e-01 0.0000e+00
++3.4902e-02 +6.7813e-01 0.0000e+00
++3.2267e-02 +6.1968e-01 0.0000e+00
++4.2212e-02 +5.7080e-01 0.0000e+00
++3.9696e-02 +5.1582e-01 0.0000e+00
++4.3170e-02 +4.6314e-01 0.0000e+00
++4.8937e-02 +4.0412e-01 0.0000e+00
++5.9071e-02 +3.5917e-01 0.0000e+00
++5.3140e-02 +2.9867e-01 0.0000e+00
++5.8300e-02 +2.5203e-01 0.0000e+00
++6.5525e-02 +1.9214e-01 0.0000e+00
++7.3725e-02 +1.4311e-01 0.0000e+00
++7.1288e-02 +8.6801e-02 0.0000e+00
++8.2736e-02 +3.2916e-02 0.0000e+00
++8.2383e-02 -1.7584e-02 0.0000e+00
++8.7319e-02 -7.9686e-02 0.0000e+00
++8.9095e-02 -1.2973e-01 0.0000e+00
++9.9403e-02 -1.8475e-01 0.0000e+00
++1.0188e-01 -2.3421e-01 0.0000e+00
++9.9075e-02 -2.8885e-01 0.0000e+00
++1.0542e-01 -3.3957e-01 0.0000e+00
++1.1239e-01 -3.9638e-01 0.0000e+00
++1.0994e-01 -4.5083e-01 0.0000e+00
++1.2361e-01 -5.0410e-01 0.0000e+00
++1.2282e-01 -5.5480e-01 0.0000e+00
++1.2483e-01 -6.1123e-01 0.0000e+00
++1.3678e-01 -6.6418e-01 0.0000e+00
++1.3560e-01 -7.2105e-01 0.0000e+00
++1.3470e-01 -7.7199e-01 0.0000e+00
++7.4141e-02 +7.8974e-01 0.0000e+00
++7.8532e-02 +7.3708e-01 0.0000e+00
++8.4201e-02 +6.8432e-01 0.0000e+00
++9.2293e-02 +6.2722e-01 0.0000e+00
++8.9042e-02 +5.7797e-01 0.0000e+00
++9.0483e-02 +5.2427e-01 0.0000e+00
++9.5934e-02 +4.6660e-01 0.0000e+00
++1.0228e-01 +4.1552e-01 0.0000e+00
++1.0284e-01 +3.5482e-01 0.0000e+00
++1.1608e-01 +3.0274e-01 0.0000e+00
++1.1127e-01 +2.5695e-01 0.0000e+00
++1.1632e-01 +2.0209e-01 0.0000e+00
++1.2071e-01 +1.4899e-01 0.0000e+00
++1.3257e-01 +9.1164e-02 0.0000e+00
++1.3084e-01 +3.4525e-02 0.0000e+00
++1.3588e-01 -2.1263e-02 0.0000e+00
++1.3822e-01 -6.7903e-02 0.0000e+00
++1.4469e-01 -1.2577e-01 0.0000e+00
++1.4983e-01 -1.7537e-01 0.0000e+00
++1.4953e-01 -2.3024e-01 0.0000e+00
++1.5584e-01 -2.8954e-01 0.0000e+00
++1.6033e-01 -3.3967e-01 0.0000e+00
++1.6698e-01 -3.8918e-01 0.0000e+00
++1.6484e-01 -4.4571e-01 0.0000e+00
++1.7189e-01 -4.9954e-01 0.0000e+00
++1.7291e-01 -5.5000e-01 0.0000e+00
++1.8175e-01 -6.1074e-01 0.0000e+00
++1.8569e-01 -6.6553e-01 0.0000e+00
++1.8978e-01 -7.1910e-01 0.0000e+00
++1.8975e-01 -7.7367e-01 0.0000e+00
++1.3350e-01 +7.8878e-01 0.0000e+00
++1.2931e-01 +7.3961e-01 0.0000e+00
++1.3442e-01 +6.8881e-01 0.0000e+00
++1.4026e-01 +6.3265e-01 0.0000e+00
++1.4696e-01 +5.7671e-01 0.0000e+00
++1.4704e-01 +5.2824e-01 0.0000e+00
++1.5840e-01 +4.7360e-01 0.0000e+00
++1.5311e-01 +4.1979e-01 0.0000e+00
++1.5702e-01 +3.6125e-01 0.0000e+00
++1.6335e-01 +3.1440e-01 0.0000e+00
++1.6732e-01 +2.5305e-01 0.0000e+00
++1.7009e-01 +2.0569e-01 0.0000e+00
++1.7368e-01 +1.5227e-01 0.0000e+00
++1.7922e-01 +9.2907e-02 0.0000e+00
++1.8639e-01 +3.5908e-02 0.0000e+00
++1.9446e-01 -1.6313e-02 0.0000e+00
++1.9424e-01 -6.8880e-02 0.0000e+00
++1.9638e-01 -1.1634e-01 0.0000e+00
++2.0019e-01 -1.7087e-01 0.0000e+00
++2.0587e-01 -2.2253e-01 0.0000e+00
++2.0961e-01 -2.8231e-01 0.0000e+00
++2.1883e-01 -3.3408e-01 0.0000e+00
++2.2351e-01 -3.8704e-01 0.0000e+00
++2.2118e-01 -4.3956e-01 0.0000e+00
++2.3023e-01 -4.9257e-01 0.0000e+00
++2.2741e-01 -5.4733e-01 0.0000e+00
++2.3925e-01 -6.0417e-01 0.0000e+00
++2.3550e-01 -6.5891e-01 0.0000e+00
++2.4078e-01 -7.1245e-01 0.0000e+00
++2.5140e-01 -7.6148e-01 0.0000e+00
++1.8567e-01 +7.4382e-01 0.0000e+00
++1.8740e-01 +6.9201e-01 0.0000e+00
++1.9109e-01 +6.3411e-01 0.0000e+00
++1.9494e-01 +5.8437e-01 0.0000e+00
++2.0674e-01 +5.3197e-01 0.0000e+00
++2.0381e-01 +4.7026e-01 0.0000e+00
++2.1107e-01 +4.1848e-01 0.0000e+00
++2.1714e-01 +3.6726e-01 0.0000e+00
++2.1843e-01 +3.1171e-01 0.0000e+00
++2.1830e-01 +2.5836e-01 0.0000e+00
++2.2595e-01 +2.1076e-01 0.0000e+00
++2.3606e-01 +1.4788e-01 0.0000e+00
++2.3271e-01 +1.0060e-01 0.0000e+00
++2.3775e-01 +4.6625e-02 0.0000e+00
++2.4628e-01 -8.0838e-03 0.0000e+00
++2.4242e-01 -5.8676e-02 0.0000e+00
++2.5216e-01 -1.1199e-01 0.0000e+00
++2.5550e-01 -1.6575e-01 0.0000e+00
++2.6321e-01 -2.2782e-01 0.0000e+00
++2.6613e-01 -2.7693e-01 0.0000e+00
++2.6449e-01 -3.2830e-01 0.0000e+00
++2.7644e-01 -3.8055e-01 0.0000e+00
++2.7941e-01 -4.3866e-01 0.0000e+00
++2.7634e-01 -4.9189e-01 0.0000e+00
++2.8111e-01 -5.4524e-01 0.0000e+00
++2.9395e-01 -6.0317e-01 0.0000e+00
++2.9192e-01 -6.5272e-01 0.0000e+00
++2.9496e-01 -7.0296e-01 0.0000e+00
++2.3957e-01 +7.5246e-01 0.0000e+00
++2.4647e-01 +6.9717e-01 0.0000e+00
++2.5281e-01 +6.3942e-01 0.0000e+00
++2.5070e-01 +5.8518e-01 0.0000e+00
++2.5603e-01 +5.3809e-01 0.0000e+00
++2.6094e-01 +4.8254e-01 0.0000e+00
++2.6508e-01 +4.3066e-01 0.0000e+00
++2.6354e-01 +3.7572e-01 0.0000e+00
++2.7368e-01 +3.2219e-01 0.0000e+00
++2.7806e-01 +2.6509e-01 0.0000e+00
++2.8362e-01 +2.1592e-01 0.0000e+00
++2.8805e-01 +1.6077e-01 0.0000e+00
++2.9054e-01 +1.0337e-01 0.0000e+00
++2.9012e-01 +4.4241e-02 0.0000e+00
++3.0069e-01 -1.3564e-03 0.0000e+00
++2.9741e-01 -6.1894e-02 0.0000e+00
++3.0180e-01 -1.1139e-01 0.0000e+00
++3.0695e-01 -1.6700e-01 0.0000e+00
++3.0887e-01 -2.2228e-01 0.0000e+00
++3.1995e-01 -2.6938e-01 0.0000e+00
++3.1712e-01 -3.2887e-01 0.0000e+00
++3.2053e-01 -3.7838e-01 0.0000e+00
++3.3065e-01 -4.2883e-01 0.0000e+00
++3.3137e-01 -4.9000e-01 0.0000e+00
++3.3316e-01 -5.4108e-01 0.0000e+00
++3.4297e-01 -5.9884e-01 0.0000e+00
++3.4460e-01 -6.5105e-01 0.0000e+00
++3.5013e-01 -7.0654e-01 0.0000e+00
++3.0075e-01 +7.0208e-01 0.0000e+00
++3.0447e-01 +6.4861e-01 0.0000e+00
++3.0432e-01 +5.9065e-01 0.0000e+00
++3.0951e-01 +5.3576e-01 0.0000e+00
++3.1836e-01 +4.8361e-01 0.0000e+00
++3.1839e-01 +4.2777e-01 0.0000e+00
++3.2353e-01 +3.7916e-01 0.0000e+00
++3.2617e-01 +3.1773e-01 0.0000e+00
++3.2975e-01 +2.6775e-01 0.0000e+00
++3.3982e-01 +2.1703e-01 0.0000e+00
++3.3408e-01 +1.6085e-01 0.0000e+00
++3.4267e-01 +1.1091e-01 0.0000e+00
++3.4194e-01 +5.8251e-02 0.0000e+00
++3.4818e-01 -4.1329e-03 0.0000e+00
++3.6016e-01 -5.7863e-02 0.0000e+00
++3.6386e-01 -1.0238e-01 0.0000e+00
++3.6304e-01 -1.5983e-01 0.0000e+00
++3.6388e-01 -2.1014e-01 0.0000e+00
++3.7368e-01 -2.6943e-01 0.0000e+00
++3.7058e-01 -3.2458e-01 0.0000e+00
++3.7949e-01 -3.7291e-01 0.0000e+00
++3.8091e-01 -4.3096e-01 0.0000e+00
++3.8585e-01 -4.8735e-01 0.0000e+00
++3.8773e-01 -5.3516e-01 0.0000e+00
++3.9839e-01 -5.9300e-01 0.0000e+00
++4.0112e-01 -6.4493e-01 0.0000e+00
++4.0092e-01 -6.9487e-01 0.0000e+00
++3.5428e-01 +7.0557e-01 0.0000e+00
++3.5741e-01 +6.5070e-01 0.0000e+00
++3.5455e-01 +5.9945e-01 0.0000e+00
++3.6764e-01 +5.4228e-01 0.0000e+00
++3.6478e-01 +4.8241e-01 0.0000e+00
++3.6770e-01 +4.3820e-01 0.0000e+00
++3.7552e-01 +3.8100e-01 0.0000e+00
++3.8171e-01 +3.2548e-01 0.0000e+00
++3.8871e-01 +2.7034e-01 0.0000e+00
++3.9242e-01 +2.2110e-01 0.0000e+00
++3.8948e-01 +1.6091e-01 0.0000e+00
++3.9283e-01 +1.0875e-01 0.0000e+00
++4.0077e-01 +5.5836e-02 0.0000e+00
++4.0512e-01 +7.5110e-04 0.0000e+00
++4.0664e-01 -4.5744e-02 0.0000e+00
++4.1359e-01 -1.0237e-01 0.0000e+00
++4.1259e-01 -1.6296e-01 0.0000e+00
++4.1758e-01 -2.1035e-01 0.0000e+00
++4.2781e-01 -2.6029e-01 0.0000e+00
++4.3278e-01 -3.1971e-01 0.0000e+00
++4.3079e-01 -3.7093e-01 0.0000e+00
++4.3723e-01 -4.2518e-01 0.0000e+00
++4.4050e-01 -4.7977e-01 0.0000e+00
++4.4478e-01 -5.3636e-01 0.0000e+00
++4.5407e-01 -5.9093e-01 0.0000e+00
++4.5271e-01 -6.4404e-01 0.0000e+00
++4.0634e-01 +6.5324e-01 0.0000e+00
++4.1511e-01 +6.0248e-01 0.0000e+00
++4.1881e-01 +5.4023e-01 0.0000e+00
++4.2124e-01 +4.9460e-01 0.0000e+00
++4.2909e-01 +4.3978e-01 0.0000e+00
++4.2927e-01 +3.8285e-01 0.0000e+00
++4.3937e-01 +3.2786e-01 0.0000e+00
++4.3367e-01 +2.7818e-01 0.0000e+00
++4.3906e-01 +2.2183e-01 0.0000e+00
++4.4192e-01 +1.6710e-01 0.0000e+00
++4.4646e-01 +1.1239e-01 0.0000e+00
++4.5040e-01 +5.6263e-02 0.0000e+00
++4.5768e-01 +1.2568e-02 0.0000e+00
++4.6136e-01 -4.7663e-02 0.0000e+00
++4.6610e-01 -9.6745e-02 0.0000e+00
++4.7004e-01 -1.5666e-01 0.0000e+00
++4.7453e-01 -2.0344e-01 0.0000e+00
++4.7812e-01 -2.6113e-01 0.0000e+00
++4.8747e-01 -3.1389e-01 0.0000e+00
++4.8776e-01 -3.6299e-01 0.0000e+00
++4.9081e-01 -4.1693e-01 0.0000e+00
++4.9287e-01 -4.7812e-01 0.0000e+00
++4.9548e-01 -5.2599e-01 0.0000e+00
++5.0065e-01 -5.8347e-01 0.0000e+00
++4.6521e-01 +6.6051e-01 0.0000e+00
++4.7172e-01 +6.0143e-01 0.0000e+00
++4.7575e-01 +5.5040e-01 0.0000e+00
++4.7944e-01 +4.9886e-01 0.0000e+00
++4.8419e-01 +4.3829e-01 0.0000e+00
++4.8223e-01 +3.9139e-01 0.0000e+00
++4.8572e-01 +3.3371e-01 0.0000e+00
++4.9118e-01 +2.8502e-01 0.0000e+00
++4.9236e-01 +2.3117e-01 0.0000e+00
++5.0541e-01 +1.7406e-01 0.0000e+00
++5.0275e-01 +1.1817e-01 0.0000e+00
++5.0872e-01 +6.1742e-02 0.0000e+00
++5.1551e-01 +1.6462e-02 0.0000e+00
++5.1550e-01 -3.7762e-02 0.0000e+00
++5.2502e-01 -9.2770e-02 0.0000e+00
++5.2499e-01 -1.4830e-01 0.0000e+00
++5.3079e-01 -1.9998e-01 0.0000e+00
++5.2980e-01 -2.5747e-01 0.0000e+00
++5.3755e-01 -3.0513e-01 0.0000e+00
++5.3903e-01 -3.6612e-01 0.0000e+00
++5.4067e-01 -4.2319e-01 0.0000e+00
++5.5058e-01 -4.7222e-01 0.0000e+00
++5.5346e-01 -5.2184e-01 0.0000e+00
++5.6023e-01 -5.8011e-01 0.0000e+00
++5.2449e-01 +6.0695e-01 0.0000e+00
++5.2809e-01 +5.5064e-01 0.0000e+00
++5.3220e-01 +4.9933e-01 0.0000e+00
++5.3382e-01 +4.4858e-01 0.0000e+00
++5.3812e-01 +3.9218e-01 0.0000e+00
++5.3787e-01 +3.4164e-01 0.0000e+00
++5.4347e-01 +2.8183e-01 0.0000e+00
++5.4636e-01 +2.2518e-01 0.0000e+00
++5.5831e-01 +1.7445e-01 0.0000e+00
++5.6207e-01 +1.2240e-01 0.0000e+00
++5.6568e-01 +6.5556e-02 0.0000e+00
++5.6648e-01 +2.0512e-02 0.0000e+00
++5.6875e-01 -4.0082e-02 0.0000e+00
++5.7527e-01 -9.5606e-02 0.0000e+00
++5.8260e-01 -1.3984e-01 0.0000e+00
++5.8304e-01 -1.9496e-01 0.0000e+00
++5.9097e-01 -2.5693e-01 0.0000e+00
++5.9484e-01 -3.0991e-01 0.0000e+00
++5.9676e-01 -3.5508e-01 0.0000e+00
++5.9400e-01 -4.1647e-01 0.0000e+00
++5.9898e-01 -4.7114e-01 0.0000e+00
++6.0933e-01 -5.1952e-01 0.0000e+00
++5.8463e-01 +5.5419e-01 0.0000e+00
++5.8368e-01 +5.0852e-01 0.0000e+00
++5.8672e-01 +4.5395e-01 0.0000e+00
++5.9458e-01 +3.9726e-01 0.0000e+00
++5.9312e-01 +3.4291e-01 0.0000e+00
++6.0489e-01 +2.8630e-01 0.0000e+00
++6.0900e-01 +2.3001e-01 0.0000e+00
++6.1079e-01 +1.8481e-01 0.0000e+00
++6.0683e-01 +1.2449e-01 0.0000e+00
++6.1721e-01 +7.1464e-02 0.0000e+00
++6.2229e-01 +2.1254e-02 0.0000e+00
++6.2023e-01 -3.7802e-02 0.0000e+00
++6.2769e-01 -8.7821e-02 0.0000e+00
++6.3455e-01 -1.3643e-01 0.0000e+00
++6.3540e-01 -1.9615e-01 0.0000e+00
++6.3978e-01 -2.5271e-01 0.0000e+00
++6.4904e-01 -2.9762e-01 0.0000e+00
++6.4503e-01 -3.5563e-01 0.0000e+00
++6.4746e-01 -4.1310e-01 0.0000e+00
++6.5850e-01 -4.6819e-01 0.0000e+00
++6.3785e-01 +4.5574e-01 0.0000e+00
++6.4871e-01 +4.0083e-01 0.0000e+00
++6.5029e-01 +3.4856e-01 0.0000e+00
++6.5191e-01 +2.9616e-01 0.0000e+00
++6.5569e-01 +2.4344e-01 0.0000e+00
++6.6110e-01 +1.8477e-01 0.0000e+00
++6.5968e-01 +1.3611e-01 0.0000e+00
++6.6759e-01 +7.2739e-02 0.0000e+00
++6.7356e-01 +2.1294e-02 0.0000e+00
++6.7351e-01 -3.4056e-02 0.0000e+00
++6.8486e-01 -8.5585e-02 0.0000e+00
++6.8987e-01 -1.3226e-01 0.0000e+00
++6.9088e-01 -1.9135e-01 0.0000e+00
++6.9800e-01 -2.4741e-01 0.0000e+00
++7.0099e-01 -3.0257e-01 0.0000e+00
++7.0046e-01 -3.5044e-01 0.0000e+00
++7.0572e-01 +3.4843e-01 0.0000e+00
++7.0402e-01 +2.9705e-01 0.0000e+00
++7.0897e-01 +2.4095e-01 0.0000e+00
++7.1016e-01 +1.8732e-01 0.0000e+00
++7.1842e-01 +1.3797e-01 0.0000e+00
++7.2629e-01 +7.7905e-02 0.0000e+00
++7.2523e-01 +3.0551e-02 0.0000e+00
++7.3637e-01 -3.0136e-02 0.0000e+00
++7.3948e-01 -8.0434e-02 0.0000e+00
++7.3668e-01 -1.2944e-01 0.0000e+00
++7.4775e-01 -1.8993e-01 0.0000e+00
++7.4995e-01 -2.4173e-01 0.0000e+00
++7.6412e-01 +2.4860e-01 0.0000e+00
++7.7222e-01 +1.9403e-01 0.0000e+00
++7.7480e-01 +1.3812e-01 0.0000e+00
++7.7736e-01 +9.0939e-02 0.0000e+00
++7.7960e-01 +3.2580e-02 0.0000e+00
++7.8128e-01 -2.5683e-02 0.0000e+00
++7.8765e-01 -7.6991e-02 0.0000e+00
++7.9168e-01 -1.2952e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-6.9293e-01 +4.3784e-01 0.0000e+00
+-7.1061e-01 +3.7761e-01 0.0000e+00
+-7.3395e-01 +3.2839e-01 0.0000e+00
+-7.4672e-01 +2.7608e-01 0.0000e+00
+-7.6643e-01 +2.3321e-01 0.0000e+00
+-7.8601e-01 +1.7052e-01 0.0000e+00
+-8.0463e-01 +1.2062e-01 0.0000e+00
+-8.1644e-01 +6.6292e-02 0.0000e+00
+-5.9128e-01 +5.7419e-01 0.0000e+00
+-6.1308e-01 +5.2104e-01 0.0000e+00
+-6.3088e-01 +4.6746e-01 0.0000e+00
+-6.4736e-01 +4.1579e-01 0.0000e+00
+-6.6213e-01 +3.6510e-01 0.0000e+00
+-6.8086e-01 +3.1843e-01 0.0000e+00
+-6.9941e-01 +2.6426e-01 0.0000e+00
+-7.1096e-01 +2.1300e-01 0.0000e+00
+-7.2882e-01 +1.5303e-01 0.0000e+00
+-7.4334e-01 +1.0853e-01 0.0000e+00
+-7.6641e-01 +5.2716e-02 0.0000e+00
+-7.8520e-01 -3.7883e-03 0.0000e+00
+-7.9778e-01 -5.2857e-02 0.0000e+00
+-5.2434e-01 +6.1514e-01 0.0000e+00
+-5.4445e-01 +5.5452e-01 0.0000e+00
+-5.5107e-01 +5.0615e-01 0.0000e+00
+-5.7619e-01 +4.5449e-01 0.0000e+00
+-5.9117e-01 +4.0376e-01 0.0000e+00
+-6.0795e-01 +3.4554e-01 0.0000e+00
+-6.2672e-01 +2.9183e-01 0.0000e+00
+-6.4623e-01 +2.4661e-01 0.0000e+00
+-6.6269e-01 +1.9174e-01 0.0000e+00
+-6.7618e-01 +1.3563e-01 0.0000e+00
+-6.9740e-01 +8.5988e-02 0.0000e+00
+-7.1507e-01 +3.5278e-02 0.0000e+00
+-7.2840e-01 -1.5809e-02 0.0000e+00
+-7.4979e-01 -6.8294e-02 0.0000e+00
+-7.6001e-01 -1.2346e-01 0.0000e+00
+-7.8360e-01 -1.7278e-01 0.0000e+00
+-4.3825e-01 +6.9439e-01 0.0000e+00
+-4.5498e-01 +6.4185e-01 0.0000e+00
+-4.6881e-01 +5.9558e-01 0.0000e+00
+-4.8144e-01 +5.3692e-01 0.0000e+00
+-4.9947e-01 +4.8673e-01 0.0000e+00
+-5.1985e-01 +4.3621e-01 0.0000e+00
+-5.3768e-01 +3.8601e-01 0.0000e+00
+-5.5911e-01 +3.3161e-01 0.0000e+00
+-5.7499e-01 +2.8024e-01 0.0000e+00
+-5.8563e-01 +2.2644e-01 0.0000e+00
+-6.0744e-01 +1.7268e-01 0.0000e+00
+-6.1898e-01 +1.2533e-01 0.0000e+00
+-6.4095e-01 +6.9443e-02 0.0000e+00
+-6.5629e-01 +2.1226e-02 0.0000e+00
+-6.7447e-01 -3.5869e-02 0.0000e+00
+-7.0075e-01 -8.5384e-02 0.0000e+00
+-7.1578e-01 -1.4152e-01 0.0000e+00
+-7.2744e-01 -1.9557e-01 0.0000e+00
+-7.4816e-01 -2.3928e-01 0.0000e+00
+-7.6630e-01 -2.9121e-01 0.0000e+00
+-3.6056e-01 +7.2830e-01 0.0000e+00
+-3.8474e-01 +6.7756e-01 0.0000e+00
+-3.9416e-01 +6.2425e-01 0.0000e+00
+-4.1159e-01 +5.7506e-01 0.0000e+00
+-4.3087e-01 +5.1934e-01 0.0000e+00
+-4.5562e-01 +4.7007e-01 0.0000e+00
+-4.7372e-01 +4.1395e-01 0.0000e+00
+-4.8696e-01 +3.6779e-01 0.0000e+00
+-5.0828e-01 +3.1621e-01 0.0000e+00
+-5.1536e-01 +2.6456e-01 0.0000e+00
+-5.4001e-01 +2.0586e-01 0.0000e+00
+-5.6183e-01 +1.5382e-01 0.0000e+00
+-5.7798e-01 +1.0336e-01 0.0000e+00
+-5.9403e-01 +5.1896e-02 0.0000e+00
+-6.1003e-01 -4.3832e-03 0.0000e+00
+-6.2650e-01 -5.4750e-02 0.0000e+00
+-6.4570e-01 -1.0628e-01 0.0000e+00
+-6.6127e-01 -1.5300e-01 0.0000e+00
+-6.7966e-01 -2.0702e-01 0.0000e+00
+-6.9570e-01 -2.5604e-01 0.0000e+00
+-7.1513e-01 -3.1530e-01 0.0000e+00
+-7.3461e-01 -3.6480e-01 0.0000e+00
+-2.9375e-01 +7.6632e-01 0.0000e+00
+-3.0736e-01 +7.1641e-01 0.0000e+00
+-3.3278e-01 +6.6318e-01 0.0000e+00
+-3.4805e-01 +6.0531e-01 0.0000e+00
+-3.6262e-01 +5.5083e-01 0.0000e+00
+-3.8369e-01 +5.0029e-01 0.0000e+00
+-4.0032e-01 +4.5746e-01 0.0000e+00
+-4.2154e-01 +3.9922e-01 0.0000e+00
+-4.3800e-01 +3.5131e-01 0.0000e+00
+-4.4884e-01 +2.9113e-01 0.0000e+00
+-4.7234e-01 +2.4330e-01 0.0000e+00
+-4.8636e-01 +1.8899e-01 0.0000e+00
+-5.0881e-01 +1.4153e-01 0.0000e+00
+-5.1911e-01 +8.5480e-02 0.0000e+00
+-5.4370e-01 +3.5949e-02 0.0000e+00
+-5.5727e-01 -1.7017e-02 0.0000e+00
+-5.7305e-01 -6.6366e-02 0.0000e+00
+-5.8851e-01 -1.1907e-01 0.0000e+00
+-6.1376e-01 -1.7494e-01 0.0000e+00
+-6.3063e-01 -2.2584e-01 0.0000e+00
+-6.4024e-01 -2.8320e-01 0.0000e+00
+-6.5744e-01 -3.2488e-01 0.0000e+00
+-6.7551e-01 -3.8670e-01 0.0000e+00
+-6.9610e-01 -4.3744e-01 0.0000e+00
+-2.4631e-01 +7.5055e-01 0.0000e+00
+-2.5755e-01 +6.9844e-01 0.0000e+00
+-2.7729e-01 +6.4415e-01 0.0000e+00
+-2.9960e-01 +5.8900e-01 0.0000e+00
+-3.0706e-01 +5.4178e-01 0.0000e+00
+-3.2844e-01 +4.8543e-01 0.0000e+00
+-3.4213e-01 +4.3637e-01 0.0000e+00
+-3.6158e-01 +3.7853e-01 0.0000e+00
+-3.7804e-01 +3.2956e-01 0.0000e+00
+-4.0108e-01 +2.8467e-01 0.0000e+00
+-4.2079e-01 +2.2946e-01 0.0000e+00
+-4.3683e-01 +1.7101e-01 0.0000e+00
+-4.5420e-01 +1.2288e-01 0.0000e+00
+-4.7152e-01 +6.6330e-02 0.0000e+00
+-4.8021e-01 +2.1452e-02 0.0000e+00
+-4.9999e-01 -3.1533e-02 0.0000e+00
+-5.2183e-01 -8.5291e-02 0.0000e+00
+-5.4239e-01 -1.3294e-01 0.0000e+00
+-5.5235e-01 -1.8886e-01 0.0000e+00
+-5.7171e-01 -2.4716e-01 0.0000e+00
+-5.8826e-01 -2.9128e-01 0.0000e+00
+-6.1004e-01 -3.5142e-01 0.0000e+00
+-6.3020e-01 -3.9414e-01 0.0000e+00
+-6.4118e-01 -4.4732e-01 0.0000e+00
+-1.7412e-01 +7.8400e-01 0.0000e+00
+-1.9194e-01 +7.3086e-01 0.0000e+00
+-2.0487e-01 +6.7506e-01 0.0000e+00
+-2.2269e-01 +6.2805e-01 0.0000e+00
+-2.4143e-01 +5.7892e-01 0.0000e+00
+-2.6193e-01 +5.2385e-01 0.0000e+00
+-2.8162e-01 +4.6597e-01 0.0000e+00
+-2.9418e-01 +4.2170e-01 0.0000e+00
+-3.1014e-01 +3.6432e-01 0.0000e+00
+-3.3185e-01 +3.1222e-01 0.0000e+00
+-3.4797e-01 +2.6003e-01 0.0000e+00
+-3.6179e-01 +2.0784e-01 0.0000e+00
+-3.7901e-01 +1.5632e-01 0.0000e+00
+-4.0238e-01 +1.1133e-01 0.0000e+00
+-4.1401e-01 +5.0950e-02 0.0000e+00
+-4.3230e-01 +3.4193e-03 0.0000e+00
+-4.4693e-01 -5.2205e-02 0.0000e+00
+-4.7239e-01 -9.8191e-02 0.0000e+00
+-4.8502e-01 -1.5334e-01 0.0000e+00
+-5.0033e-01 -2.1195e-01 0.0000e+00
+-5.2336e-01 -2.6159e-01 0.0000e+00
+-5.4162e-01 -3.0843e-01 0.0000e+00
+-5.6085e-01 -3.6075e-01 0.0000e+00
+-5.6958e-01 -4.1563e-01 0.0000e+00
+-5.9408e-01 -4.6341e-01 0.0000e+00
+-6.0821e-01 -5.2475e-01 0.0000e+00
+-1.0853e-01 +8.1293e-01 0.0000e+00
+-1.1952e-01 +7.6004e-01 0.0000e+00
+-1.3782e-01 +7.0742e-01 0.0000e+00
+-1.6137e-01 +6.5904e-01 0.0000e+00
+-1.6929e-01 +6.0670e-01 0.0000e+00
+-1.8644e-01 +5.6005e-01 0.0000e+00
+-2.1023e-01 +5.0218e-01 0.0000e+00
+-2.1959e-01 +4.5373e-01 0.0000e+00
+-2.3824e-01 +4.0384e-01 0.0000e+00
+-2.6494e-01 +3.4612e-01 0.0000e+00
+-2.8413e-01 +2.9343e-01 0.0000e+00
+-2.8980e-01 +2.4510e-01 0.0000e+00
+-3.1509e-01 +1.9168e-01 0.0000e+00
+-3.2972e-01 +1.3864e-01 0.0000e+00
+-3.4372e-01 +8.1773e-02 0.0000e+00
+-3.5964e-01 +3.6774e-02 0.0000e+00
+-3.7707e-01 -1.6209e-02 0.0000e+00
+-3.9910e-01 -6.9147e-02 0.0000e+00
+-4.2124e-01 -1.2262e-01 0.0000e+00
+-4.3830e-01 -1.7132e-01 0.0000e+00
+-4.5414e-01 -2.2452e-01 0.0000e+00
+-4.6703e-01 -2.8011e-01 0.0000e+00
+-4.8789e-01 -3.2840e-01 0.0000e+00
+-5.0880e-01 -3.7976e-01 0.0000e+00
+-5.2337e-01 -4.3286e-01 0.0000e+00
+-5.3852e-01 -4.8411e-01 0.0000e+00
+-5.5785e-01 -5.4175e-01 0.0000e+00
+-4.7735e-02 +7.9296e-01 0.0000e+00
+-7.3198e-02 +7.4993e-01 0.0000e+00
+-8.8223e-02 +7.0030e-01 0.0000e+00
+-1.0540e-01 +6.4904e-01 0.0000e+00
+-1.2604e-01 +5.9136e-01 0.0000e+00
+-1.4154e-01 +5.4031e-01 0.0000e+00
+-1.6177e-01 +4.8407e-01 0.0000e+00
+-1.6783e-01 +4.3638e-01 0.0000e+00
+-1.9445e-01 +3.8135e-01 0.0000e+00
+-2.0905e-01 +3.2840e-01 0.0000e+00
+-2.2472e-01 +2.8338e-01 0.0000e+00
+-2.4383e-01 +2.2628e-01 0.0000e+00
+-2.5771e-01 +1.7734e-01 0.0000e+00
+-2.7427e-01 +1.2456e-01 0.0000e+00
+-2.9527e-01 +6.6596e-02 0.0000e+00
+-3.1203e-01 +1.7264e-02 0.0000e+00
+-3.2563e-01 -3.3710e-02 0.0000e+00
+-3.4441e-01 -9.2202e-02 0.0000e+00
+-3.6527e-01 -1.4013e-01 0.0000e+00
+-3.8205e-01 -1.8993e-01 0.0000e+00
+-3.9887e-01 -2.3806e-01 0.0000e+00
+-4.1699e-01 -2.9335e-01 0.0000e+00
+-4.3556e-01 -3.4694e-01 0.0000e+00
+-4.4922e-01 -4.0575e-01 0.0000e+00
+-4.7227e-01 -4.5314e-01 0.0000e+00
+-4.8494e-01 -5.0343e-01 0.0000e+00
+-5.0753e-01 -5.5792e-01 0.0000e+00
+-5.2151e-01 -6.0796e-01 0.0000e+00
+-1.3220e-03 +7.8247e-01 0.0000e+00
+-1.4343e-02 +7.3381e-01 0.0000e+00
+-3.4741e-02 +6.7687e-01 0.0000e+00
+-5.6089e-02 +6.2571e-01 0.0000e+00
+-6.7603e-02 +5.6769e-01 0.0000e+00
+-8.4433e-02 +5.2196e-01 0.0000e+00
+-1.0744e-01 +4.7455e-01 0.0000e+00
+-1.2469e-01 +4.1765e-01 0.0000e+00
+-1.3508e-01 +3.6316e-01 0.0000e+00
+-1.5813e-01 +3.1102e-01 0.0000e+00
+-1.7496e-01 +2.6489e-01 0.0000e+00
+-1.9690e-01 +2.0783e-01 0.0000e+00
+-2.0619e-01 +1.5033e-01 0.0000e+00
+-2.2427e-01 +1.0910e-01 0.0000e+00
+-2.4063e-01 +4.7478e-02 0.0000e+00
+-2.6582e-01 -1.1128e-03 0.0000e+00
+-2.7584e-01 -4.8352e-02 0.0000e+00
+-3.0038e-01 -1.0213e-01 0.0000e+00
+-3.1351e-01 -1.5722e-01 0.0000e+00
+-3.3457e-01 -2.0871e-01 0.0000e+00
+-3.4181e-01 -2.5712e-01 0.0000e+00
+-3.6978e-01 -3.0937e-01 0.0000e+00
+-3.8286e-01 -3.6994e-01 0.0000e+00
+-4.0298e-01 -4.1247e-01 0.0000e+00
+-4.1334e-01 -4.7053e-01 0.0000e+00
+-4.3175e-01 -5.2567e-01 0.0000e+00
+-4.5246e-01 -5.7010e-01 0.0000e+00
+-4.6923e-01 -6.2690e-01 0.0000e+00
++7.3023e-02 +8.2072e-01 0.0000e+00
++5.2377e-02 +7.6180e-01 0.0000e+00
++4.1242e-02 +7.1470e-01 0.0000e+00
++2.0211e-02 +6.5516e-01 0.0000e+00
++2.4897e-03 +6.0990e-01 0.0000e+00
+-1.2641e-02 +5.5147e-01 0.0000e+00
+-3.0334e-02 +5.0568e-01 0.0000e+00
+-5.6867e-02 +4.5309e-01 0.0000e+00
+-7.2016e-02 +3.9878e-01 0.0000e+00
+-8.6984e-02 +3.4466e-01 0.0000e+00
+-1.0541e-01 +2.9390e-01 0.0000e+00
+-1.2156e-01 +2.4540e-01 0.0000e+00
+-1.3901e-01 +1.9228e-01 0.0000e+00
+-1.5548e-01 +1.4271e-01 0.0000e+00
+-1.7299e-01 +8.1228e-02 0.0000e+00
+-1.9448e-01 +3.9923e-02 0.0000e+00
+-2.1338e-01 -1.5309e-02 0.0000e+00
+-2.2551e-01 -6.9869e-02 0.0000e+00
+-2.4789e-01 -1.2240e-01 0.0000e+00
+-2.5931e-01 -1.7144e-01 0.0000e+00
+-2.8175e-01 -2.2736e-01 0.0000e+00
+-2.9446e-01 -2.7396e-01 0.0000e+00
+-3.1533e-01 -3.2882e-01 0.0000e+00
+-3.2997e-01 -3.8609e-01 0.0000e+00
+-3.4526e-01 -4.3389e-01 0.0000e+00
+-3.6996e-01 -4.8607e-01 0.0000e+00
+-3.8227e-01 -5.3618e-01 0.0000e+00
+-4.0029e-01 -5.9125e-01 0.0000e+00
+-4.2137e-01 -6.4232e-01 0.0000e+00
+-4.3725e-01 -6.9159e-01 0.0000e+00
++1.2607e-01 +7.9860e-01 0.0000e+00
++1.0749e-01 +7.4779e-01 0.0000e+00
++8.7294e-02 +6.9657e-01 0.0000e+00
++7.3009e-02 +6.4644e-01 0.0000e+00
++5.2427e-02 +5.9406e-01 0.0000e+00
++3.9224e-02 +5.3333e-01 0.0000e+00
++1.4951e-02 +4.8388e-01 0.0000e+00
++4.1110e-03 +4.3579e-01 0.0000e+00
+-1.3739e-02 +3.8664e-01 0.0000e+00
+-3.5649e-02 +3.2687e-01 0.0000e+00
+-5.5007e-02 +2.7696e-01 0.0000e+00
+-7.1008e-02 +2.2745e-01 0.0000e+00
+-8.5555e-02 +1.7738e-01 0.0000e+00
+-1.0045e-01 +1.1623e-01 0.0000e+00
+-1.1863e-01 +6.8612e-02 0.0000e+00
+-1.3696e-01 +1.2309e-02 0.0000e+00
+-1.5642e-01 -3.1864e-02 0.0000e+00
+-1.7713e-01 -8.3278e-02 0.0000e+00
+-1.9256e-01 -1.3820e-01 0.0000e+00
+-2.0974e-01 -1.9189e-01 0.0000e+00
+-2.2866e-01 -2.3843e-01 0.0000e+00
+-2.4623e-01 -2.9544e-01 0.0000e+00
+-2.6618e-01 -3.4597e-01 0.0000e+00
+-2.7898e-01 -4.0130e-01 0.0000e+00
+-2.9821e-01 -4.4521e-01 0.0000e+00
+-3.0689e-01 -5.0002e-01 0.0000e+00
+-3.3309e-01 -5.5471e-01 0.0000e+00
+-3.5046e-01 -6.0439e-01 0.0000e+00
+-3.6793e-01 -6.6190e-01 0.0000e+00
+-3.7935e-01 -7.1466e-01 0.0000e+00
++1.6907e-01 +7.7888e-01 0.0000e+00
++1.5615e-01 +7.2500e-01 0.0000e+00
++1.4494e-01 +6.7587e-01 0.0000e+00
++1.1907e-01 +6.3182e-01 0.0000e+00
++1.0540e-01 +5.7796e-01 0.0000e+00
++9.3297e-02 +5.2455e-01 0.0000e+00
++6.9584e-02 +4.7055e-01 0.0000e+00
++5.3155e-02 +4.1160e-01 0.0000e+00
++3.8593e-02 +3.6413e-01 0.0000e+00
++1.7412e-02 +3.0974e-01 0.0000e+00
++5.3775e-03 +2.6053e-01 0.0000e+00
+-1.5232e-02 +2.0558e-01 0.0000e+00
+-3.8645e-02 +1.6130e-01 0.0000e+00
+-5.0492e-02 +1.0247e-01 0.0000e+00
+-7.0252e-02 +4.9584e-02 0.0000e+00
+-8.5281e-02 -1.9768e-03 0.0000e+00
+-1.0542e-01 -5.0446e-02 0.0000e+00
+-1.2266e-01 -1.0642e-01 0.0000e+00
+-1.4136e-01 -1.5998e-01 0.0000e+00
+-1.5481e-01 -2.1312e-01 0.0000e+00
+-1.7328e-01 -2.5956e-01 0.0000e+00
+-1.8834e-01 -3.1879e-01 0.0000e+00
+-2.1445e-01 -3.6675e-01 0.0000e+00
+-2.3059e-01 -4.1634e-01 0.0000e+00
+-2.3910e-01 -4.6714e-01 0.0000e+00
+-2.6385e-01 -5.1726e-01 0.0000e+00
+-2.7961e-01 -5.6791e-01 0.0000e+00
+-2.9623e-01 -6.2000e-01 0.0000e+00
+-3.1692e-01 -6.7610e-01 0.0000e+00
+-3.2567e-01 -7.2987e-01 0.0000e+00
++2.2814e-01 +7.6566e-01 0.0000e+00
++2.0846e-01 +7.1528e-01 0.0000e+00
++1.9588e-01 +6.6237e-01 0.0000e+00
++1.7929e-01 +6.1118e-01 0.0000e+00
++1.5548e-01 +5.5445e-01 0.0000e+00
++1.4338e-01 +5.0285e-01 0.0000e+00
++1.2141e-01 +4.4789e-01 0.0000e+00
++1.0839e-01 +3.9907e-01 0.0000e+00
++8.4691e-02 +3.5024e-01 0.0000e+00
++7.4576e-02 +2.9437e-01 0.0000e+00
++5.0633e-02 +2.4135e-01 0.0000e+00
++3.4143e-02 +1.9682e-01 0.0000e+00
++2.0544e-02 +1.3353e-01 0.0000e+00
++4.1939e-03 +8.2175e-02 0.0000e+00
+-2.2268e-02 +3.3213e-02 0.0000e+00
+-3.7133e-02 -1.3026e-02 0.0000e+00
+-5.5103e-02 -7.1493e-02 0.0000e+00
+-7.1273e-02 -1.1747e-01 0.0000e+00
+-9.2178e-02 -1.7556e-01 0.0000e+00
+-1.0457e-01 -2.2907e-01 0.0000e+00
+-1.2355e-01 -2.8134e-01 0.0000e+00
+-1.3399e-01 -3.2885e-01 0.0000e+00
+-1.6060e-01 -3.8261e-01 0.0000e+00
+-1.7054e-01 -4.3450e-01 0.0000e+00
+-1.9222e-01 -4.9137e-01 0.0000e+00
+-2.0597e-01 -5.3490e-01 0.0000e+00
+-2.2420e-01 -5.8928e-01 0.0000e+00
+-2.4663e-01 -6.4558e-01 0.0000e+00
+-2.6120e-01 -6.9425e-01 0.0000e+00
+-2.7839e-01 -7.4251e-01 0.0000e+00
++2.7799e-01 +7.4264e-01 0.0000e+00
++2.6618e-01 +6.9371e-01 0.0000e+00
++2.4372e-01 +6.4062e-01 0.0000e+00
++2.2980e-01 +5.9299e-01 0.0000e+00
++2.1132e-01 +5.3752e-01 0.0000e+00
++1.8832e-01 +4.8395e-01 0.0000e+00
++1.7199e-01 +4.3329e-01 0.0000e+00
++1.5195e-01 +3.8455e-01 0.0000e+00
++1.3551e-01 +3.2910e-01 0.0000e+00
++1.2055e-01 +2.8055e-01 0.0000e+00
++1.0162e-01 +2.2677e-01 0.0000e+00
++8.9469e-02 +1.7280e-01 0.0000e+00
++7.4443e-02 +1.2329e-01 0.0000e+00
++4.8522e-02 +6.6508e-02 0.0000e+00
++3.8135e-02 +1.7531e-02 0.0000e+00
++1.2629e-02 -3.8122e-02 0.0000e+00
++4.6279e-03 -8.4217e-02 0.0000e+00
+-1.4945e-02 -1.4082e-01 0.0000e+00
+-3.9013e-02 -1.8716e-01 0.0000e+00
+-5.6063e-02 -2.4516e-01 0.0000e+00
+-7.1972e-02 -2.9948e-01 0.0000e+00
+-8.5839e-02 -3.4448e-01 0.0000e+00
+-1.0634e-01 -3.9575e-01 0.0000e+00
+-1.2088e-01 -4.5716e-01 0.0000e+00
+-1.3495e-01 -5.0375e-01 0.0000e+00
+-1.5465e-01 -5.5643e-01 0.0000e+00
+-1.7011e-01 -6.1163e-01 0.0000e+00
+-1.9478e-01 -6.5738e-01 0.0000e+00
+-2.0901e-01 -7.1770e-01 0.0000e+00
+-2.2959e-01 -7.6250e-01 0.0000e+00
++3.3007e-01 +7.2648e-01 0.0000e+00
++3.1570e-01 +6.8158e-01 0.0000e+00
++3.0135e-01 +6.2369e-01 0.0000e+00
++2.7573e-01 +5.6978e-01 0.0000e+00
++2.6572e-01 +5.1990e-01 0.0000e+00
++2.4158e-01 +4.6921e-01 0.0000e+00
++2.2399e-01 +4.1830e-01 0.0000e+00
++2.0604e-01 +3.6054e-01 0.0000e+00
++1.9776e-01 +3.1426e-01 0.0000e+00
++1.6823e-01 +2.5973e-01 0.0000e+00
++1.5461e-01 +2.1385e-01 0.0000e+00
++1.3769e-01 +1.5468e-01 0.0000e+00
++1.2598e-01 +1.0534e-01 0.0000e+00
++1.0139e-01 +5.3372e-02 0.0000e+00
++9.0815e-02 -1.8188e-03 0.0000e+00
++7.0484e-02 -4.9155e-02 0.0000e+00
++5.0533e-02 -1.0949e-01 0.0000e+00
++3.2387e-02 -1.5724e-01 0.0000e+00
++2.0289e-02 -2.1304e-01 0.0000e+00
++3.0274e-03 -2.6053e-01 0.0000e+00
+-2.1243e-02 -3.1078e-01 0.0000e+00
+-3.5365e-02 -3.6097e-01 0.0000e+00
+-5.1309e-02 -4.1714e-01 0.0000e+00
+-7.5176e-02 -4.6736e-01 0.0000e+00
+-8.3417e-02 -5.2286e-01 0.0000e+00
+-1.0424e-01 -5.7021e-01 0.0000e+00
+-1.2470e-01 -6.2405e-01 0.0000e+00
+-1.3443e-01 -6.7856e-01 0.0000e+00
+-1.5806e-01 -7.3156e-01 0.0000e+00
+-1.7908e-01 -7.7908e-01 0.0000e+00
++3.8244e-01 +7.1307e-01 0.0000e+00
++3.6571e-01 +6.6183e-01 0.0000e+00
++3.5015e-01 +6.0999e-01 0.0000e+00
++3.3514e-01 +5.5310e-01 0.0000e+00
++3.1258e-01 +5.0809e-01 0.0000e+00
++2.9267e-01 +4.5704e-01 0.0000e+00
++2.7496e-01 +4.0066e-01 0.0000e+00
++2.6070e-01 +3.5013e-01 0.0000e+00
++2.3719e-01 +2.9285e-01 0.0000e+00
++2.2901e-01 +2.3864e-01 0.0000e+00
++2.0636e-01 +1.9750e-01 0.0000e+00
++1.8938e-01 +1.4392e-01 0.0000e+00
++1.7248e-01 +9.2268e-02 0.0000e+00
++1.6073e-01 +3.3206e-02 0.0000e+00
++1.3667e-01 -1.9355e-02 0.0000e+00
++1.1932e-01 -7.3796e-02 0.0000e+00
++1.0305e-01 -1.1857e-01 0.0000e+00
++8.6219e-02 -1.7554e-01 0.0000e+00
++7.1407e-02 -2.2420e-01 0.0000e+00
++4.9398e-02 -2.7566e-01 0.0000e+00
++3.1848e-02 -3.3391e-01 0.0000e+00
++1.6213e-02 -3.8282e-01 0.0000e+00
++2.8616e-03 -4.3199e-01 0.0000e+00
+-2.1531e-02 -4.8429e-01 0.0000e+00
+-3.6221e-02 -5.3769e-01 0.0000e+00
+-5.5246e-02 -5.8553e-01 0.0000e+00
+-7.0991e-02 -6.4613e-01 0.0000e+00
+-8.8986e-02 -6.9920e-01 0.0000e+00
+-1.0635e-01 -7.5118e-01 0.0000e+00
+-1.2799e-01 -8.0247e-01 0.0000e+00
++4.3786e-01 +6.8867e-01 0.0000e+00
++4.1445e-01 +6.4410e-01 0.0000e+00
++3.9913e-01 +5.9432e-01 0.0000e+00
++3.8239e-01 +5.3921e-01 0.0000e+00
++3.6654e-01 +4.8397e-01 0.0000e+00
++3.4742e-01 +4.3837e-01 0.0000e+00
++3.3646e-01 +3.8250e-01 0.0000e+00
++3.1017e-01 +3.3401e-01 0.0000e+00
++2.9066e-01 +2.7743e-01 0.0000e+00
++2.7807e-01 +2.3089e-01 0.0000e+00
++2.5750e-01 +1.7163e-01 0.0000e+00
++2.4135e-01 +1.2601e-01 0.0000e+00
++2.2357e-01 +7.4376e-02 0.0000e+00
++2.0528e-01 +1.6370e-02 0.0000e+00
++1.8944e-01 -4.0053e-02 0.0000e+00
++1.7635e-01 -9.2341e-02 0.0000e+00
++1.5533e-01 -1.4167e-01 0.0000e+00
++1.3855e-01 -1.8714e-01 0.0000e+00
++1.2053e-01 -2.3990e-01 0.0000e+00
++1.0542e-01 -2.9073e-01 0.0000e+00
++8.5262e-02 -3.4841e-01 0.0000e+00
++7.3432e-02 -4.0072e-01 0.0000e+00
++5.6853e-02 -4.5237e-01 0.0000e+00
++3.3869e-02 -5.0082e-01 0.0000e+00
++2.1381e-02 -5.5424e-01 0.0000e+00
+-2.9526e-03 -6.0460e-01 0.0000e+00
+-1.4338e-02 -6.6272e-01 0.0000e+00
+-3.9536e-02 -7.1270e-01 0.0000e+00
+-5.5770e-02 -7.6512e-01 0.0000e+00
+-6.5204e-02 -8.1542e-01 0.0000e+00
++4.6910e-01 +6.2574e-01 0.0000e+00
++4.5021e-01 +5.7635e-01 0.0000e+00
++4.3075e-01 +5.2046e-01 0.0000e+00
++4.1468e-01 +4.7217e-01 0.0000e+00
++4.0502e-01 +4.1824e-01 0.0000e+00
++3.7783e-01 +3.6138e-01 0.0000e+00
++3.6414e-01 +3.0983e-01 0.0000e+00
++3.4957e-01 +2.5928e-01 0.0000e+00
++3.2879e-01 +2.0654e-01 0.0000e+00
++3.0753e-01 +1.5643e-01 0.0000e+00
++2.9588e-01 +1.0866e-01 0.0000e+00
++2.8048e-01 +4.5543e-02 0.0000e+00
++2.5861e-01 +2.4238e-03 0.0000e+00
++2.4197e-01 -5.0315e-02 0.0000e+00
++2.2833e-01 -1.0513e-01 0.0000e+00
++2.0466e-01 -1.5116e-01 0.0000e+00
++1.9271e-01 -2.0513e-01 0.0000e+00
++1.7455e-01 -2.5700e-01 0.0000e+00
++1.5722e-01 -3.1840e-01 0.0000e+00
++1.4053e-01 -3.6573e-01 0.0000e+00
++1.1864e-01 -4.1337e-01 0.0000e+00
++1.0918e-01 -4.6723e-01 0.0000e+00
++8.8968e-02 -5.2303e-01 0.0000e+00
++6.4999e-02 -5.7185e-01 0.0000e+00
++4.8356e-02 -6.2390e-01 0.0000e+00
++3.7484e-02 -6.8345e-01 0.0000e+00
++1.5956e-02 -7.2922e-01 0.0000e+00
+-1.0828e-03 -7.7765e-01 0.0000e+00
++5.2319e-01 +6.1252e-01 0.0000e+00
++5.0779e-01 +5.5781e-01 0.0000e+00
++4.9088e-01 +5.0100e-01 0.0000e+00
++4.6742e-01 +4.5085e-01 0.0000e+00
++4.5378e-01 +4.0447e-01 0.0000e+00
++4.3640e-01 +3.5030e-01 0.0000e+00
++4.1974e-01 +2.9989e-01 0.0000e+00
++3.9654e-01 +2.4885e-01 0.0000e+00
++3.8488e-01 +1.9451e-01 0.0000e+00
++3.6638e-01 +1.3910e-01 0.0000e+00
++3.5214e-01 +9.0671e-02 0.0000e+00
++3.3446e-01 +3.7072e-02 0.0000e+00
++3.1407e-01 -1.7878e-02 0.0000e+00
++2.9026e-01 -7.3298e-02 0.0000e+00
++2.8215e-01 -1.2035e-01 0.0000e+00
++2.5508e-01 -1.7596e-01 0.0000e+00
++2.3961e-01 -2.2423e-01 0.0000e+00
++2.2243e-01 -2.7855e-01 0.0000e+00
++2.0234e-01 -3.3128e-01 0.0000e+00
++1.9411e-01 -3.7994e-01 0.0000e+00
++1.6789e-01 -4.3475e-01 0.0000e+00
++1.5149e-01 -4.8264e-01 0.0000e+00
++1.4103e-01 -5.3408e-01 0.0000e+00
++1.1748e-01 -5.9187e-01 0.0000e+00
++9.8935e-02 -6.4060e-01 0.0000e+00
++8.5285e-02 -6.9879e-01 0.0000e+00
++6.6141e-02 -7.4852e-01 0.0000e+00
++4.9369e-02 -8.0287e-01 0.0000e+00
++5.6076e-01 +5.4093e-01 0.0000e+00
++5.4308e-01 +4.8919e-01 0.0000e+00
++5.1999e-01 +4.3476e-01 0.0000e+00
++5.0313e-01 +3.8111e-01 0.0000e+00
++4.9080e-01 +3.2857e-01 0.0000e+00
++4.6872e-01 +2.7606e-01 0.0000e+00
++4.5430e-01 +2.2833e-01 0.0000e+00
++4.3245e-01 +1.6954e-01 0.0000e+00
++4.1602e-01 +1.2113e-01 0.0000e+00
++4.0541e-01 +6.9456e-02 0.0000e+00
++3.7777e-01 +1.8923e-02 0.0000e+00
++3.6607e-01 -3.1434e-02 0.0000e+00
++3.4452e-01 -8.0645e-02 0.0000e+00
++3.2569e-01 -1.4176e-01 0.0000e+00
++3.1567e-01 -1.9702e-01 0.0000e+00
++3.0152e-01 -2.4034e-01 0.0000e+00
++2.7800e-01 -2.9402e-01 0.0000e+00
++2.5887e-01 -3.4165e-01 0.0000e+00
++2.4460e-01 -4.0127e-01 0.0000e+00
++2.1985e-01 -4.5188e-01 0.0000e+00
++2.0909e-01 -5.0085e-01 0.0000e+00
++1.8743e-01 -5.5598e-01 0.0000e+00
++1.6975e-01 -6.1095e-01 0.0000e+00
++1.5258e-01 -6.5665e-01 0.0000e+00
++1.3970e-01 -7.1524e-01 0.0000e+00
++1.2170e-01 -7.6515e-01 0.0000e+00
++1.0174e-01 -8.1202e-01 0.0000e+00
++6.1246e-01 +5.2301e-01 0.0000e+00
++5.9368e-01 +4.7019e-01 0.0000e+00
++5.7069e-01 +4.2314e-01 0.0000e+00
++5.6036e-01 +3.6422e-01 0.0000e+00
++5.3397e-01 +3.0906e-01 0.0000e+00
++5.1921e-01 +2.6634e-01 0.0000e+00
++5.0390e-01 +2.0948e-01 0.0000e+00
++4.8774e-01 +1.5483e-01 0.0000e+00
++4.7248e-01 +1.0022e-01 0.0000e+00
++4.5647e-01 +5.2453e-02 0.0000e+00
++4.2987e-01 -2.9596e-03 0.0000e+00
++4.1237e-01 -5.3321e-02 0.0000e+00
++3.9888e-01 -1.0621e-01 0.0000e+00
++3.8115e-01 -1.5972e-01 0.0000e+00
++3.6417e-01 -2.0403e-01 0.0000e+00
++3.4828e-01 -2.6002e-01 0.0000e+00
++3.2334e-01 -3.1659e-01 0.0000e+00
++3.0927e-01 -3.6311e-01 0.0000e+00
++2.9911e-01 -4.1411e-01 0.0000e+00
++2.8025e-01 -4.7194e-01 0.0000e+00
++2.5810e-01 -5.1931e-01 0.0000e+00
++2.4267e-01 -5.7285e-01 0.0000e+00
++2.2413e-01 -6.2547e-01 0.0000e+00
++2.0574e-01 -6.8036e-01 0.0000e+00
++1.9286e-01 -7.3534e-01 0.0000e+00
++1.7056e-01 -7.8474e-01 0.0000e+00
++6.4068e-01 +4.5320e-01 0.0000e+00
++6.2883e-01 +4.0201e-01 0.0000e+00
++6.0766e-01 +3.4203e-01 0.0000e+00
++5.9187e-01 +2.9816e-01 0.0000e+00
++5.7754e-01 +2.4352e-01 0.0000e+00
++5.5517e-01 +1.8992e-01 0.0000e+00
++5.4288e-01 +1.3423e-01 0.0000e+00
++5.1785e-01 +8.9783e-02 0.0000e+00
++5.0060e-01 +3.4673e-02 0.0000e+00
++4.8162e-01 -1.7904e-02 0.0000e+00
++4.6422e-01 -7.1144e-02 0.0000e+00
++4.4570e-01 -1.2546e-01 0.0000e+00
++4.3524e-01 -1.6943e-01 0.0000e+00
++4.1485e-01 -2.2751e-01 0.0000e+00
++3.9987e-01 -2.7553e-01 0.0000e+00
++3.7985e-01 -3.3341e-01 0.0000e+00
++3.6554e-01 -3.7916e-01 0.0000e+00
++3.4608e-01 -4.3482e-01 0.0000e+00
++3.3397e-01 -4.8813e-01 0.0000e+00
++3.1480e-01 -5.3439e-01 0.0000e+00
++2.9630e-01 -5.8631e-01 0.0000e+00
++2.7401e-01 -6.4465e-01 0.0000e+00
++2.5751e-01 -6.9070e-01 0.0000e+00
++2.3960e-01 -7.4678e-01 0.0000e+00
++6.9891e-01 +4.3672e-01 0.0000e+00
++6.8163e-01 +3.7860e-01 0.0000e+00
++6.6521e-01 +3.2903e-01 0.0000e+00
++6.4827e-01 +2.7912e-01 0.0000e+00
++6.2875e-01 +2.2030e-01 0.0000e+00
++6.0833e-01 +1.7698e-01 0.0000e+00
++5.8878e-01 +1.2138e-01 0.0000e+00
++5.7463e-01 +7.3441e-02 0.0000e+00
++5.5441e-01 +2.2349e-02 0.0000e+00
++5.4406e-01 -3.6512e-02 0.0000e+00
++5.1943e-01 -8.7996e-02 0.0000e+00
++5.0270e-01 -1.4341e-01 0.0000e+00
++4.9115e-01 -1.8867e-01 0.0000e+00
++4.6967e-01 -2.3964e-01 0.0000e+00
++4.5683e-01 -2.9512e-01 0.0000e+00
++4.3482e-01 -3.4731e-01 0.0000e+00
++4.1981e-01 -3.9819e-01 0.0000e+00
++3.9611e-01 -4.5185e-01 0.0000e+00
++3.8452e-01 -4.9972e-01 0.0000e+00
++3.6176e-01 -5.5764e-01 0.0000e+00
++3.4070e-01 -6.1194e-01 0.0000e+00
++3.3061e-01 -6.6196e-01 0.0000e+00
++3.1366e-01 -7.0975e-01 0.0000e+00
++2.9694e-01 -7.6721e-01 0.0000e+00
++7.3343e-01 +3.6290e-01 0.0000e+00
++7.1451e-01 +3.0853e-01 0.0000e+00
++6.9806e-01 +2.5866e-01 0.0000e+00
++6.7948e-01 +2.1032e-01 0.0000e+00
++6.6118e-01 +1.5559e-01 0.0000e+00
++6.4094e-01 +1.0818e-01 0.0000e+00
++6.2253e-01 +4.9737e-02 0.0000e+00
++6.0281e-01 -4.6642e-03 0.0000e+00
++5.9395e-01 -5.7091e-02 0.0000e+00
++5.7687e-01 -1.0752e-01 0.0000e+00
++5.5775e-01 -1.6238e-01 0.0000e+00
++5.4067e-01 -2.0504e-01 0.0000e+00
++5.1881e-01 -2.6291e-01 0.0000e+00
++5.0296e-01 -3.1769e-01 0.0000e+00
++4.9232e-01 -3.6217e-01 0.0000e+00
++4.7091e-01 -4.1417e-01 0.0000e+00
++4.5383e-01 -4.7557e-01 0.0000e+00
++4.3648e-01 -5.2690e-01 0.0000e+00
++4.2041e-01 -5.7013e-01 0.0000e+00
++3.9350e-01 -6.2675e-01 0.0000e+00
++3.7653e-01 -6.8011e-01 0.0000e+00
++3.6710e-01 -7.2969e-01 0.0000e+00
++7.6907e-01 +2.8948e-01 0.0000e+00
++7.5009e-01 +2.4692e-01 0.0000e+00
++7.3134e-01 +1.9442e-01 0.0000e+00
++7.1628e-01 +1.3801e-01 0.0000e+00
++6.9338e-01 +8.7494e-02 0.0000e+00
++6.8203e-01 +2.9612e-02 0.0000e+00
++6.6360e-01 -2.4932e-02 0.0000e+00
++6.4739e-01 -6.8137e-02 0.0000e+00
++6.1978e-01 -1.2327e-01 0.0000e+00
++6.0854e-01 -1.7723e-01 0.0000e+00
++5.9344e-01 -2.2645e-01 0.0000e+00
++5.6811e-01 -2.8115e-01 0.0000e+00
++5.5532e-01 -3.3113e-01 0.0000e+00
++5.4251e-01 -3.7954e-01 0.0000e+00
++5.1967e-01 -4.3602e-01 0.0000e+00
++5.0138e-01 -4.9093e-01 0.0000e+00
++4.9230e-01 -5.3681e-01 0.0000e+00
++4.6557e-01 -5.8976e-01 0.0000e+00
++4.4509e-01 -6.4475e-01 0.0000e+00
++4.3365e-01 -7.0091e-01 0.0000e+00
++7.8012e-01 +1.7585e-01 0.0000e+00
++7.6858e-01 +1.1994e-01 0.0000e+00
++7.4937e-01 +7.0166e-02 0.0000e+00
++7.3014e-01 +2.0266e-02 0.0000e+00
++7.1281e-01 -3.0796e-02 0.0000e+00
++6.9467e-01 -8.8088e-02 0.0000e+00
++6.7407e-01 -1.3328e-01 0.0000e+00
++6.5641e-01 -1.9598e-01 0.0000e+00
++6.4164e-01 -2.4671e-01 0.0000e+00
++6.1968e-01 -2.9872e-01 0.0000e+00
++6.0995e-01 -3.5167e-01 0.0000e+00
++5.9617e-01 -3.9752e-01 0.0000e+00
++5.7372e-01 -4.5348e-01 0.0000e+00
++5.5821e-01 -5.0899e-01 0.0000e+00
++5.3919e-01 -5.6204e-01 0.0000e+00
++5.1972e-01 -6.0683e-01 0.0000e+00
++8.0143e-01 +4.8091e-02 0.0000e+00
++7.7948e-01 +4.6134e-04 0.0000e+00
++7.6192e-01 -5.4239e-02 0.0000e+00
++7.4180e-01 -1.0512e-01 0.0000e+00
++7.3002e-01 -1.5479e-01 0.0000e+00
++7.1363e-01 -2.1437e-01 0.0000e+00
++6.9388e-01 -2.5847e-01 0.0000e+00
++6.8033e-01 -3.1993e-01 0.0000e+00
++6.6333e-01 -3.6845e-01 0.0000e+00
++6.4129e-01 -4.1341e-01 0.0000e+00
++6.2775e-01 -4.7466e-01 0.0000e+00
++6.0930e-01 -5.2423e-01 0.0000e+00
++8.1680e-01 -6.8879e-02 0.0000e+00
++8.0280e-01 -1.2339e-01 0.0000e+00
++7.8309e-01 -1.7697e-01 0.0000e+00
++7.6681e-01 -2.2234e-01 0.0000e+00
++7.4580e-01 -2.7809e-01 0.0000e+00
++7.2432e-01 -3.3353e-01 0.0000e+00
++7.0998e-01 -3.8429e-01 0.0000e+00
++6.9296e-01 -4.3527e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-3.8893e-01 -6.4939e-01 0.0000e+00
+-3.3293e-01 -6.6438e-01 0.0000e+00
+-2.8698e-01 -6.8485e-01 0.0000e+00
+-2.3840e-01 -6.9548e-01 0.0000e+00
+-1.9839e-01 -7.1273e-01 0.0000e+00
+-1.4008e-01 -7.2942e-01 0.0000e+00
+-9.3596e-02 -7.4551e-01 0.0000e+00
+-4.3182e-02 -7.5522e-01 0.0000e+00
+-5.1706e-01 -5.5855e-01 0.0000e+00
+-4.6750e-01 -5.7751e-01 0.0000e+00
+-4.1765e-01 -5.9276e-01 0.0000e+00
+-3.6957e-01 -6.0684e-01 0.0000e+00
+-3.2246e-01 -6.1935e-01 0.0000e+00
+-2.7895e-01 -6.3561e-01 0.0000e+00
+-2.2853e-01 -6.5154e-01 0.0000e+00
+-1.8096e-01 -6.6107e-01 0.0000e+00
+-1.2520e-01 -6.7624e-01 0.0000e+00
+-8.3791e-02 -6.8866e-01 0.0000e+00
+-3.1753e-02 -7.0873e-01 0.0000e+00
++2.0828e-02 -7.2483e-01 0.0000e+00
++6.6406e-02 -7.3536e-01 0.0000e+00
+-5.5633e-01 -4.9765e-01 0.0000e+00
+-4.9993e-01 -5.1489e-01 0.0000e+00
+-4.5512e-01 -5.1993e-01 0.0000e+00
+-4.0687e-01 -5.4198e-01 0.0000e+00
+-3.5971e-01 -5.5469e-01 0.0000e+00
+-3.0559e-01 -5.6890e-01 0.0000e+00
+-2.5559e-01 -5.8504e-01 0.0000e+00
+-2.1341e-01 -6.0206e-01 0.0000e+00
+-1.6239e-01 -6.1604e-01 0.0000e+00
+-1.1029e-01 -6.2726e-01 0.0000e+00
+-6.3993e-02 -6.4575e-01 0.0000e+00
+-1.6787e-02 -6.6095e-01 0.0000e+00
++3.0671e-02 -6.7213e-01 0.0000e+00
++7.9600e-02 -6.9072e-01 0.0000e+00
++1.3075e-01 -6.9893e-01 0.0000e+00
++1.7680e-01 -7.1962e-01 0.0000e+00
+-6.3140e-01 -4.1992e-01 0.0000e+00
+-5.8253e-01 -4.3421e-01 0.0000e+00
+-5.3951e-01 -4.4596e-01 0.0000e+00
+-4.8506e-01 -4.5632e-01 0.0000e+00
+-4.3834e-01 -4.7187e-01 0.0000e+00
+-3.9125e-01 -4.8956e-01 0.0000e+00
+-3.4450e-01 -5.0492e-01 0.0000e+00
+-2.9381e-01 -5.2350e-01 0.0000e+00
+-2.4603e-01 -5.3702e-01 0.0000e+00
+-1.9613e-01 -5.4566e-01 0.0000e+00
+-1.4601e-01 -5.6461e-01 0.0000e+00
+-1.0204e-01 -5.7422e-01 0.0000e+00
+-4.9965e-02 -5.9327e-01 0.0000e+00
+-5.1109e-03 -6.0637e-01 0.0000e+00
++4.8001e-02 -6.2189e-01 0.0000e+00
++9.4294e-02 -6.4507e-01 0.0000e+00
++1.4645e-01 -6.5769e-01 0.0000e+00
++1.9661e-01 -6.6727e-01 0.0000e+00
++2.3742e-01 -6.8543e-01 0.0000e+00
++2.8577e-01 -7.0103e-01 0.0000e+00
+-6.6443e-01 -3.4895e-01 0.0000e+00
+-6.1704e-01 -3.7015e-01 0.0000e+00
+-5.6762e-01 -3.7768e-01 0.0000e+00
+-5.2183e-01 -3.9268e-01 0.0000e+00
+-4.6996e-01 -4.0925e-01 0.0000e+00
+-4.2392e-01 -4.3101e-01 0.0000e+00
+-3.7171e-01 -4.4649e-01 0.0000e+00
+-3.2880e-01 -4.5769e-01 0.0000e+00
+-2.8072e-01 -4.7624e-01 0.0000e+00
+-2.3287e-01 -4.8163e-01 0.0000e+00
+-1.7813e-01 -5.0309e-01 0.0000e+00
+-1.2961e-01 -5.2208e-01 0.0000e+00
+-8.2670e-02 -5.3589e-01 0.0000e+00
+-3.4800e-02 -5.4957e-01 0.0000e+00
++1.7511e-02 -5.6310e-01 0.0000e+00
++6.4374e-02 -5.7718e-01 0.0000e+00
++1.1237e-01 -5.9377e-01 0.0000e+00
++1.5585e-01 -6.0712e-01 0.0000e+00
++2.0613e-01 -6.2291e-01 0.0000e+00
++2.5174e-01 -6.3663e-01 0.0000e+00
++3.0687e-01 -6.5326e-01 0.0000e+00
++3.5300e-01 -6.7016e-01 0.0000e+00
+-7.0100e-01 -2.8811e-01 0.0000e+00
+-6.5462e-01 -2.9958e-01 0.0000e+00
+-6.0492e-01 -3.2187e-01 0.0000e+00
+-5.5116e-01 -3.3469e-01 0.0000e+00
+-5.0053e-01 -3.4693e-01 0.0000e+00
+-4.5341e-01 -3.6527e-01 0.0000e+00
+-4.1350e-01 -3.7968e-01 0.0000e+00
+-3.5926e-01 -3.9798e-01 0.0000e+00
+-3.1467e-01 -4.1212e-01 0.0000e+00
+-2.5887e-01 -4.2081e-01 0.0000e+00
+-2.1419e-01 -4.4144e-01 0.0000e+00
+-1.6375e-01 -4.5319e-01 0.0000e+00
+-1.1943e-01 -4.7286e-01 0.0000e+00
+-6.7459e-02 -4.8114e-01 0.0000e+00
+-2.1189e-02 -5.0275e-01 0.0000e+00
++2.8010e-02 -5.1411e-01 0.0000e+00
++7.3918e-02 -5.2758e-01 0.0000e+00
++1.2291e-01 -5.4070e-01 0.0000e+00
++1.7506e-01 -5.6277e-01 0.0000e+00
++2.2241e-01 -5.7723e-01 0.0000e+00
++2.7559e-01 -5.8483e-01 0.0000e+00
++3.1444e-01 -5.9980e-01 0.0000e+00
++3.7192e-01 -6.1511e-01 0.0000e+00
++4.1921e-01 -6.3300e-01 0.0000e+00
+-6.8748e-01 -2.4396e-01 0.0000e+00
+-6.3913e-01 -2.5319e-01 0.0000e+00
+-5.8858e-01 -2.7022e-01 0.0000e+00
+-5.3716e-01 -2.8959e-01 0.0000e+00
+-4.9340e-01 -2.9544e-01 0.0000e+00
+-4.4091e-01 -3.1393e-01 0.0000e+00
+-3.9532e-01 -3.2549e-01 0.0000e+00
+-3.4149e-01 -3.4217e-01 0.0000e+00
+-2.9591e-01 -3.5629e-01 0.0000e+00
+-2.5396e-01 -3.7657e-01 0.0000e+00
+-2.0255e-01 -3.9355e-01 0.0000e+00
+-1.4824e-01 -4.0706e-01 0.0000e+00
+-1.0342e-01 -4.2204e-01 0.0000e+00
+-5.0830e-02 -4.3678e-01 0.0000e+00
+-9.2057e-03 -4.4381e-01 0.0000e+00
++4.0147e-02 -4.6090e-01 0.0000e+00
++9.0260e-02 -4.7988e-01 0.0000e+00
++1.3470e-01 -4.9781e-01 0.0000e+00
++1.8655e-01 -5.0577e-01 0.0000e+00
++2.4080e-01 -5.2236e-01 0.0000e+00
++2.8190e-01 -5.3666e-01 0.0000e+00
++3.3791e-01 -5.5545e-01 0.0000e+00
++3.7779e-01 -5.7312e-01 0.0000e+00
++4.2712e-01 -5.8207e-01 0.0000e+00
+-7.1996e-01 -1.7806e-01 0.0000e+00
+-6.7051e-01 -1.9333e-01 0.0000e+00
+-6.1871e-01 -2.0404e-01 0.0000e+00
+-5.7491e-01 -2.1945e-01 0.0000e+00
+-5.2914e-01 -2.3567e-01 0.0000e+00
+-4.7785e-01 -2.5338e-01 0.0000e+00
+-4.2398e-01 -2.7028e-01 0.0000e+00
+-3.8282e-01 -2.8090e-01 0.0000e+00
+-3.2951e-01 -2.9437e-01 0.0000e+00
+-2.8092e-01 -3.1326e-01 0.0000e+00
+-2.3238e-01 -3.2699e-01 0.0000e+00
+-1.8390e-01 -3.3860e-01 0.0000e+00
+-1.3596e-01 -3.5336e-01 0.0000e+00
+-9.3896e-02 -3.7394e-01 0.0000e+00
+-3.7901e-02 -3.8335e-01 0.0000e+00
++6.3847e-03 -3.9919e-01 0.0000e+00
++5.8061e-02 -4.1146e-01 0.0000e+00
++1.0108e-01 -4.3395e-01 0.0000e+00
++1.5227e-01 -4.4439e-01 0.0000e+00
++2.0672e-01 -4.5723e-01 0.0000e+00
++2.5306e-01 -4.7741e-01 0.0000e+00
++2.9670e-01 -4.9323e-01 0.0000e+00
++3.4543e-01 -5.0983e-01 0.0000e+00
++3.9629e-01 -5.1668e-01 0.0000e+00
++4.4094e-01 -5.3824e-01 0.0000e+00
++4.9788e-01 -5.4993e-01 0.0000e+00
+-7.4812e-01 -1.1814e-01 0.0000e+00
+-6.9905e-01 -1.2712e-01 0.0000e+00
+-6.5006e-01 -1.4285e-01 0.0000e+00
+-6.0488e-01 -1.6353e-01 0.0000e+00
+-5.5638e-01 -1.6968e-01 0.0000e+00
+-5.1293e-01 -1.8449e-01 0.0000e+00
+-4.5898e-01 -2.0518e-01 0.0000e+00
+-4.1405e-01 -2.1274e-01 0.0000e+00
+-3.6758e-01 -2.2887e-01 0.0000e+00
+-3.1370e-01 -2.5223e-01 0.0000e+00
+-2.6463e-01 -2.6879e-01 0.0000e+00
+-2.1989e-01 -2.7295e-01 0.0000e+00
+-1.7001e-01 -2.9513e-01 0.0000e+00
+-1.2071e-01 -3.0746e-01 0.0000e+00
+-6.7908e-02 -3.1913e-01 0.0000e+00
+-2.6013e-02 -3.3284e-01 0.0000e+00
++2.3287e-02 -3.4776e-01 0.0000e+00
++7.2647e-02 -3.6693e-01 0.0000e+00
++1.2250e-01 -3.8619e-01 0.0000e+00
++1.6784e-01 -4.0086e-01 0.0000e+00
++2.1731e-01 -4.1431e-01 0.0000e+00
++2.6891e-01 -4.2499e-01 0.0000e+00
++3.1395e-01 -4.4319e-01 0.0000e+00
++3.6184e-01 -4.6135e-01 0.0000e+00
++4.1118e-01 -4.7363e-01 0.0000e+00
++4.5883e-01 -4.8649e-01 0.0000e+00
++5.1247e-01 -5.0306e-01 0.0000e+00
+-7.3103e-01 -6.1571e-02 0.0000e+00
+-6.9073e-01 -8.4130e-02 0.0000e+00
+-6.4458e-01 -9.6905e-02 0.0000e+00
+-5.9688e-01 -1.1163e-01 0.0000e+00
+-5.4318e-01 -1.2941e-01 0.0000e+00
+-4.9570e-01 -1.4260e-01 0.0000e+00
+-4.4333e-01 -1.6004e-01 0.0000e+00
+-3.9917e-01 -1.6457e-01 0.0000e+00
+-3.4778e-01 -1.8794e-01 0.0000e+00
+-2.9857e-01 -2.0025e-01 0.0000e+00
+-2.5666e-01 -2.1372e-01 0.0000e+00
+-2.0352e-01 -2.3011e-01 0.0000e+00
+-1.5803e-01 -2.4184e-01 0.0000e+00
+-1.0894e-01 -2.5596e-01 0.0000e+00
+-5.4966e-02 -2.7407e-01 0.0000e+00
+-9.0516e-03 -2.8845e-01 0.0000e+00
++3.8308e-02 -2.9988e-01 0.0000e+00
++9.2724e-02 -3.1593e-01 0.0000e+00
++1.3743e-01 -3.3413e-01 0.0000e+00
++1.8378e-01 -3.4852e-01 0.0000e+00
++2.2858e-01 -3.6299e-01 0.0000e+00
++2.8003e-01 -3.7850e-01 0.0000e+00
++3.2992e-01 -3.9446e-01 0.0000e+00
++3.8451e-01 -4.0577e-01 0.0000e+00
++4.2877e-01 -4.2600e-01 0.0000e+00
++4.7548e-01 -4.3659e-01 0.0000e+00
++5.2629e-01 -4.5624e-01 0.0000e+00
++5.7279e-01 -4.6805e-01 0.0000e+00
+-7.2236e-01 -1.8491e-02 0.0000e+00
+-6.7716e-01 -2.9438e-02 0.0000e+00
+-6.2413e-01 -4.7012e-02 0.0000e+00
+-5.7643e-01 -6.5593e-02 0.0000e+00
+-5.2261e-01 -7.4942e-02 0.0000e+00
+-4.8002e-01 -8.9471e-02 0.0000e+00
+-4.3574e-01 -1.0967e-01 0.0000e+00
+-3.8283e-01 -1.2434e-01 0.0000e+00
+-3.3229e-01 -1.3273e-01 0.0000e+00
+-2.8365e-01 -1.5285e-01 0.0000e+00
+-2.4069e-01 -1.6737e-01 0.0000e+00
+-1.8753e-01 -1.8637e-01 0.0000e+00
+-1.3424e-01 -1.9368e-01 0.0000e+00
+-9.5772e-02 -2.0946e-01 0.0000e+00
+-3.8522e-02 -2.2321e-01 0.0000e+00
++6.8942e-03 -2.4538e-01 0.0000e+00
++5.0728e-02 -2.5359e-01 0.0000e+00
++1.0092e-01 -2.7506e-01 0.0000e+00
++1.5207e-01 -2.8597e-01 0.0000e+00
++2.0007e-01 -3.0427e-01 0.0000e+00
++2.4493e-01 -3.0989e-01 0.0000e+00
++2.9378e-01 -3.3456e-01 0.0000e+00
++3.4998e-01 -3.4530e-01 0.0000e+00
++3.8969e-01 -3.6294e-01 0.0000e+00
++4.4353e-01 -3.7122e-01 0.0000e+00
++4.9484e-01 -3.8700e-01 0.0000e+00
++5.3632e-01 -4.0514e-01 0.0000e+00
++5.8913e-01 -4.1936e-01 0.0000e+00
+-7.5932e-01 +4.9302e-02 0.0000e+00
+-7.0447e-01 +3.1541e-02 0.0000e+00
+-6.6074e-01 +2.2301e-02 0.0000e+00
+-6.0530e-01 +4.1995e-03 0.0000e+00
+-5.6313e-01 -1.1163e-02 0.0000e+00
+-5.0885e-01 -2.3842e-02 0.0000e+00
+-4.6618e-01 -3.9166e-02 0.0000e+00
+-4.1704e-01 -6.2501e-02 0.0000e+00
+-3.6657e-01 -7.5288e-02 0.0000e+00
+-3.1628e-01 -8.7912e-02 0.0000e+00
+-2.6900e-01 -1.0381e-01 0.0000e+00
+-2.2388e-01 -1.1764e-01 0.0000e+00
+-1.7444e-01 -1.3258e-01 0.0000e+00
+-1.2833e-01 -1.4669e-01 0.0000e+00
+-7.1173e-02 -1.6150e-01 0.0000e+00
+-3.2566e-02 -1.8043e-01 0.0000e+00
++1.8843e-02 -1.9665e-01 0.0000e+00
++6.9481e-02 -2.0665e-01 0.0000e+00
++1.1847e-01 -2.2615e-01 0.0000e+00
++1.6400e-01 -2.3562e-01 0.0000e+00
++2.1612e-01 -2.5510e-01 0.0000e+00
++2.5942e-01 -2.6581e-01 0.0000e+00
++3.1053e-01 -2.8386e-01 0.0000e+00
++3.6373e-01 -2.9611e-01 0.0000e+00
++4.0820e-01 -3.0917e-01 0.0000e+00
++4.5691e-01 -3.3082e-01 0.0000e+00
++5.0345e-01 -3.4109e-01 0.0000e+00
++5.5469e-01 -3.5651e-01 0.0000e+00
++6.0230e-01 -3.7484e-01 0.0000e+00
++6.4814e-01 -3.8841e-01 0.0000e+00
+-7.4007e-01 +9.8764e-02 0.0000e+00
+-6.9274e-01 +8.2734e-02 0.0000e+00
+-6.4501e-01 +6.5218e-02 0.0000e+00
+-5.9842e-01 +5.3135e-02 0.0000e+00
+-5.4961e-01 +3.5290e-02 0.0000e+00
+-4.9325e-01 +2.4441e-02 0.0000e+00
+-4.4706e-01 +3.1233e-03 0.0000e+00
+-4.0242e-01 -5.8230e-03 0.0000e+00
+-3.5665e-01 -2.1217e-02 0.0000e+00
+-3.0099e-01 -4.0126e-02 0.0000e+00
+-2.5448e-01 -5.6896e-02 0.0000e+00
+-2.0842e-01 -7.0576e-02 0.0000e+00
+-1.6187e-01 -8.2901e-02 0.0000e+00
+-1.0509e-01 -9.5304e-02 0.0000e+00
+-6.0725e-02 -1.1103e-01 0.0000e+00
+-8.3410e-03 -1.2672e-01 0.0000e+00
++3.2870e-02 -1.4371e-01 0.0000e+00
++8.0793e-02 -1.6169e-01 0.0000e+00
++1.3184e-01 -1.7472e-01 0.0000e+00
++1.8178e-01 -1.8940e-01 0.0000e+00
++2.2517e-01 -2.0584e-01 0.0000e+00
++2.7819e-01 -2.2080e-01 0.0000e+00
++3.2528e-01 -2.3811e-01 0.0000e+00
++3.7664e-01 -2.4871e-01 0.0000e+00
++4.1761e-01 -2.6548e-01 0.0000e+00
++4.6840e-01 -2.7229e-01 0.0000e+00
++5.1947e-01 -2.9527e-01 0.0000e+00
++5.6572e-01 -3.1022e-01 0.0000e+00
++6.1920e-01 -3.2507e-01 0.0000e+00
++6.6816e-01 -3.3445e-01 0.0000e+00
+-7.2281e-01 +1.3889e-01 0.0000e+00
+-6.7278e-01 +1.2816e-01 0.0000e+00
+-6.2718e-01 +1.1890e-01 0.0000e+00
+-5.8593e-01 +9.5986e-02 0.0000e+00
+-5.3591e-01 +8.4552e-02 0.0000e+00
+-4.8634e-01 +7.4556e-02 0.0000e+00
+-4.3595e-01 +5.3856e-02 0.0000e+00
+-3.8117e-01 +3.9990e-02 0.0000e+00
+-3.3702e-01 +2.7593e-02 0.0000e+00
+-2.8635e-01 +9.2385e-03 0.0000e+00
+-2.4064e-01 -7.8551e-04 0.0000e+00
+-1.8946e-01 -1.8600e-02 0.0000e+00
+-1.4806e-01 -3.9237e-02 0.0000e+00
+-9.3486e-02 -4.8876e-02 0.0000e+00
+-4.4226e-02 -6.5953e-02 0.0000e+00
++3.7072e-03 -7.8690e-02 0.0000e+00
++4.8899e-02 -9.6213e-02 0.0000e+00
++1.0096e-01 -1.1089e-01 0.0000e+00
++1.5081e-01 -1.2698e-01 0.0000e+00
++2.0017e-01 -1.3822e-01 0.0000e+00
++2.4345e-01 -1.5425e-01 0.0000e+00
++2.9847e-01 -1.6684e-01 0.0000e+00
++3.4332e-01 -1.8989e-01 0.0000e+00
++3.8947e-01 -2.0370e-01 0.0000e+00
++4.3655e-01 -2.1043e-01 0.0000e+00
++4.8336e-01 -2.3218e-01 0.0000e+00
++5.3048e-01 -2.4561e-01 0.0000e+00
++5.7894e-01 -2.5980e-01 0.0000e+00
++6.3118e-01 -2.7767e-01 0.0000e+00
++6.8101e-01 -2.8456e-01 0.0000e+00
+-7.1191e-01 +1.9372e-01 0.0000e+00
+-6.6496e-01 +1.7667e-01 0.0000e+00
+-6.1584e-01 +1.6622e-01 0.0000e+00
+-5.6821e-01 +1.5204e-01 0.0000e+00
+-5.1531e-01 +1.3130e-01 0.0000e+00
+-4.6740e-01 +1.2127e-01 0.0000e+00
+-4.1618e-01 +1.0221e-01 0.0000e+00
+-3.7082e-01 +9.1264e-02 0.0000e+00
+-3.2522e-01 +7.0458e-02 0.0000e+00
+-2.7342e-01 +6.2353e-02 0.0000e+00
+-2.2393e-01 +4.1419e-02 0.0000e+00
+-1.8246e-01 +2.7177e-02 0.0000e+00
+-1.2373e-01 +1.6019e-02 0.0000e+00
+-7.5959e-02 +2.0581e-03 0.0000e+00
+-3.0172e-02 -2.1292e-02 0.0000e+00
++1.2846e-02 -3.3995e-02 0.0000e+00
++6.7220e-02 -4.9294e-02 0.0000e+00
++1.1003e-01 -6.3207e-02 0.0000e+00
++1.6411e-01 -8.1226e-02 0.0000e+00
++2.1379e-01 -9.1482e-02 0.0000e+00
++2.6247e-01 -1.0785e-01 0.0000e+00
++3.0656e-01 -1.1645e-01 0.0000e+00
++3.5678e-01 -1.3983e-01 0.0000e+00
++4.0490e-01 -1.4786e-01 0.0000e+00
++4.5788e-01 -1.6662e-01 0.0000e+00
++4.9837e-01 -1.7835e-01 0.0000e+00
++5.4898e-01 -1.9398e-01 0.0000e+00
++6.0145e-01 -2.1344e-01 0.0000e+00
++6.4671e-01 -2.2582e-01 0.0000e+00
++6.9165e-01 -2.4063e-01 0.0000e+00
+-6.9175e-01 +2.4025e-01 0.0000e+00
+-6.4632e-01 +2.3043e-01 0.0000e+00
+-5.9681e-01 +2.1087e-01 0.0000e+00
+-5.5253e-01 +1.9907e-01 0.0000e+00
+-5.0092e-01 +1.8323e-01 0.0000e+00
+-4.5095e-01 +1.6318e-01 0.0000e+00
+-4.0381e-01 +1.4922e-01 0.0000e+00
+-3.5838e-01 +1.3180e-01 0.0000e+00
+-3.0683e-01 +1.1784e-01 0.0000e+00
+-2.6167e-01 +1.0510e-01 0.0000e+00
+-2.1160e-01 +8.8814e-02 0.0000e+00
+-1.6151e-01 +7.8785e-02 0.0000e+00
+-1.1547e-01 +6.6006e-02 0.0000e+00
+-6.2472e-02 +4.3328e-02 0.0000e+00
+-1.7027e-02 +3.4820e-02 0.0000e+00
++3.4917e-02 +1.2501e-02 0.0000e+00
++7.7649e-02 +6.1313e-03 0.0000e+00
++1.3034e-01 -1.0689e-02 0.0000e+00
++1.7365e-01 -3.1886e-02 0.0000e+00
++2.2757e-01 -4.6348e-02 0.0000e+00
++2.7807e-01 -5.9836e-02 0.0000e+00
++3.1992e-01 -7.1646e-02 0.0000e+00
++3.6771e-01 -8.9441e-02 0.0000e+00
++4.2473e-01 -1.0150e-01 0.0000e+00
++4.6805e-01 -1.1347e-01 0.0000e+00
++5.1712e-01 -1.3050e-01 0.0000e+00
++5.6842e-01 -1.4355e-01 0.0000e+00
++6.1120e-01 -1.6531e-01 0.0000e+00
++6.6721e-01 -1.7713e-01 0.0000e+00
++7.0902e-01 -1.9514e-01 0.0000e+00
+-6.7799e-01 +2.8869e-01 0.0000e+00
+-6.3622e-01 +2.7641e-01 0.0000e+00
+-5.8245e-01 +2.6445e-01 0.0000e+00
+-5.3212e-01 +2.4198e-01 0.0000e+00
+-4.8584e-01 +2.3385e-01 0.0000e+00
+-4.3851e-01 +2.1268e-01 0.0000e+00
+-3.9113e-01 +1.9756e-01 0.0000e+00
+-3.3740e-01 +1.8226e-01 0.0000e+00
+-2.9450e-01 +1.7564e-01 0.0000e+00
+-2.4350e-01 +1.4958e-01 0.0000e+00
+-2.0084e-01 +1.3802e-01 0.0000e+00
+-1.4584e-01 +1.2370e-01 0.0000e+00
+-1.0003e-01 +1.1398e-01 0.0000e+00
+-5.1512e-02 +9.2428e-02 0.0000e+00
+-3.2523e-04 +8.3883e-02 0.0000e+00
++4.3825e-02 +6.6157e-02 0.0000e+00
++9.9969e-02 +4.9069e-02 0.0000e+00
++1.4445e-01 +3.3370e-02 0.0000e+00
++1.9624e-01 +2.3434e-02 0.0000e+00
++2.4046e-01 +8.5451e-03 0.0000e+00
++2.8739e-01 -1.2753e-02 0.0000e+00
++3.3404e-01 -2.4683e-02 0.0000e+00
++3.8624e-01 -3.8163e-02 0.0000e+00
++4.3314e-01 -5.9089e-02 0.0000e+00
++4.8455e-01 -6.5472e-02 0.0000e+00
++5.2873e-01 -8.3654e-02 0.0000e+00
++5.7889e-01 -1.0135e-01 0.0000e+00
++6.2943e-01 -1.0914e-01 0.0000e+00
++6.7888e-01 -1.2978e-01 0.0000e+00
++7.2322e-01 -1.4813e-01 0.0000e+00
+-6.6676e-01 +3.3733e-01 0.0000e+00
+-6.1909e-01 +3.2303e-01 0.0000e+00
+-5.7088e-01 +3.0980e-01 0.0000e+00
+-5.1803e-01 +2.9720e-01 0.0000e+00
+-4.7597e-01 +2.7737e-01 0.0000e+00
+-4.2841e-01 +2.6012e-01 0.0000e+00
+-3.7596e-01 +2.4501e-01 0.0000e+00
+-3.2900e-01 +2.3296e-01 0.0000e+00
+-2.7560e-01 +2.1251e-01 0.0000e+00
+-2.2537e-01 +2.0616e-01 0.0000e+00
+-1.8689e-01 +1.8615e-01 0.0000e+00
+-1.3705e-01 +1.7166e-01 0.0000e+00
+-8.8991e-02 +1.5720e-01 0.0000e+00
+-3.4204e-02 +1.4765e-01 0.0000e+00
++1.4852e-02 +1.2661e-01 0.0000e+00
++6.5497e-02 +1.1178e-01 0.0000e+00
++1.0719e-01 +9.7756e-02 0.0000e+00
++1.6016e-01 +8.3473e-02 0.0000e+00
++2.0541e-01 +7.0873e-02 0.0000e+00
++2.5340e-01 +5.1689e-02 0.0000e+00
++3.0757e-01 +3.6772e-02 0.0000e+00
++3.5307e-01 +2.3418e-02 0.0000e+00
++3.9876e-01 +1.2176e-02 0.0000e+00
++4.4758e-01 -9.1886e-03 0.0000e+00
++4.9720e-01 -2.1572e-02 0.0000e+00
++5.4179e-01 -3.8081e-02 0.0000e+00
++5.9808e-01 -5.1280e-02 0.0000e+00
++6.4747e-01 -6.6721e-02 0.0000e+00
++6.9585e-01 -8.1606e-02 0.0000e+00
++7.4368e-01 -1.0045e-01 0.0000e+00
+-6.4545e-01 +3.8904e-01 0.0000e+00
+-6.0379e-01 +3.6841e-01 0.0000e+00
+-5.5750e-01 +3.5537e-01 0.0000e+00
+-5.0625e-01 +3.4113e-01 0.0000e+00
+-4.5490e-01 +3.2771e-01 0.0000e+00
+-4.1238e-01 +3.1107e-01 0.0000e+00
+-3.6056e-01 +3.0218e-01 0.0000e+00
+-3.1521e-01 +2.7899e-01 0.0000e+00
+-2.6254e-01 +2.6222e-01 0.0000e+00
+-2.1929e-01 +2.5162e-01 0.0000e+00
+-1.6414e-01 +2.3394e-01 0.0000e+00
+-1.2167e-01 +2.2004e-01 0.0000e+00
+-7.3600e-02 +2.0476e-01 0.0000e+00
+-1.9644e-02 +1.8916e-01 0.0000e+00
++3.2797e-02 +1.7578e-01 0.0000e+00
++8.1359e-02 +1.6485e-01 0.0000e+00
++1.2737e-01 +1.4653e-01 0.0000e+00
++1.6971e-01 +1.3204e-01 0.0000e+00
++2.1882e-01 +1.1657e-01 0.0000e+00
++2.6608e-01 +1.0374e-01 0.0000e+00
++3.1977e-01 +8.6405e-02 0.0000e+00
++3.6834e-01 +7.6638e-02 0.0000e+00
++4.1638e-01 +6.2472e-02 0.0000e+00
++4.6162e-01 +4.2322e-02 0.0000e+00
++5.1121e-01 +3.1972e-02 0.0000e+00
++5.5824e-01 +1.0618e-02 0.0000e+00
++6.1216e-01 +1.3904e-03 0.0000e+00
++6.5885e-01 -2.0770e-02 0.0000e+00
++7.0760e-01 -3.4601e-02 0.0000e+00
++7.5425e-01 -4.2200e-02 0.0000e+00
+-5.8805e-01 +4.1927e-01 0.0000e+00
+-5.4203e-01 +4.0292e-01 0.0000e+00
+-4.9000e-01 +3.8619e-01 0.0000e+00
+-4.4507e-01 +3.7242e-01 0.0000e+00
+-3.9506e-01 +3.6469e-01 0.0000e+00
+-3.4197e-01 +3.4084e-01 0.0000e+00
+-2.9408e-01 +3.2935e-01 0.0000e+00
+-2.4709e-01 +3.1701e-01 0.0000e+00
+-1.9794e-01 +2.9898e-01 0.0000e+00
+-1.5121e-01 +2.8047e-01 0.0000e+00
+-1.0684e-01 +2.7076e-01 0.0000e+00
+-4.8237e-02 +2.5794e-01 0.0000e+00
+-7.9455e-03 +2.3870e-01 0.0000e+00
++4.1112e-02 +2.2450e-01 0.0000e+00
++9.2015e-02 +2.1312e-01 0.0000e+00
++1.3504e-01 +1.9228e-01 0.0000e+00
++1.8513e-01 +1.8244e-01 0.0000e+00
++2.3342e-01 +1.6682e-01 0.0000e+00
++2.9049e-01 +1.5218e-01 0.0000e+00
++3.3455e-01 +1.3781e-01 0.0000e+00
++3.7902e-01 +1.1865e-01 0.0000e+00
++4.2894e-01 +1.1111e-01 0.0000e+00
++4.8091e-01 +9.3681e-02 0.0000e+00
++5.2651e-01 +7.2630e-02 0.0000e+00
++5.7493e-01 +5.8413e-02 0.0000e+00
++6.3014e-01 +4.9691e-02 0.0000e+00
++6.7288e-01 +3.0826e-02 0.0000e+00
++7.1797e-01 +1.6164e-02 0.0000e+00
+-5.7703e-01 +4.6950e-01 0.0000e+00
+-5.2618e-01 +4.5649e-01 0.0000e+00
+-4.7337e-01 +4.4213e-01 0.0000e+00
+-4.2655e-01 +4.2158e-01 0.0000e+00
+-3.8343e-01 +4.1001e-01 0.0000e+00
+-3.3303e-01 +3.9516e-01 0.0000e+00
+-2.8613e-01 +3.8089e-01 0.0000e+00
+-2.3850e-01 +3.6060e-01 0.0000e+00
+-1.8807e-01 +3.5103e-01 0.0000e+00
+-1.3651e-01 +3.3518e-01 0.0000e+00
+-9.1481e-02 +3.2310e-01 0.0000e+00
+-4.1607e-02 +3.0796e-01 0.0000e+00
++9.5738e-03 +2.9035e-01 0.0000e+00
++6.1264e-02 +2.6960e-01 0.0000e+00
++1.0488e-01 +2.6314e-01 0.0000e+00
++1.5682e-01 +2.3938e-01 0.0000e+00
++2.0172e-01 +2.2616e-01 0.0000e+00
++2.5226e-01 +2.1150e-01 0.0000e+00
++3.0138e-01 +1.9412e-01 0.0000e+00
++3.4649e-01 +1.8759e-01 0.0000e+00
++3.9767e-01 +1.6460e-01 0.0000e+00
++4.4224e-01 +1.5051e-01 0.0000e+00
++4.8996e-01 +1.4199e-01 0.0000e+00
++5.4383e-01 +1.2153e-01 0.0000e+00
++5.8923e-01 +1.0548e-01 0.0000e+00
++6.4325e-01 +9.4160e-02 0.0000e+00
++6.8958e-01 +7.7583e-02 0.0000e+00
++7.4014e-01 +6.3298e-02 0.0000e+00
+-5.1177e-01 +5.0577e-01 0.0000e+00
+-4.6361e-01 +4.9059e-01 0.0000e+00
+-4.1285e-01 +4.7047e-01 0.0000e+00
+-3.6295e-01 +4.5609e-01 0.0000e+00
+-3.1418e-01 +4.4586e-01 0.0000e+00
+-2.6521e-01 +4.2664e-01 0.0000e+00
+-2.2083e-01 +4.1438e-01 0.0000e+00
+-1.6606e-01 +3.9551e-01 0.0000e+00
+-1.2101e-01 +3.8141e-01 0.0000e+00
+-7.3071e-02 +3.7275e-01 0.0000e+00
+-2.5808e-02 +3.4834e-01 0.0000e+00
++2.0941e-02 +3.3865e-01 0.0000e+00
++6.6849e-02 +3.1985e-01 0.0000e+00
++1.2369e-01 +3.0381e-01 0.0000e+00
++1.7493e-01 +2.9578e-01 0.0000e+00
++2.1523e-01 +2.8368e-01 0.0000e+00
++2.6531e-01 +2.6314e-01 0.0000e+00
++3.0971e-01 +2.4653e-01 0.0000e+00
++3.6506e-01 +2.3468e-01 0.0000e+00
++4.1234e-01 +2.1294e-01 0.0000e+00
++4.5778e-01 +2.0409e-01 0.0000e+00
++5.0916e-01 +1.8531e-01 0.0000e+00
++5.6029e-01 +1.7020e-01 0.0000e+00
++6.0286e-01 +1.5536e-01 0.0000e+00
++6.5724e-01 +1.4476e-01 0.0000e+00
++7.0371e-01 +1.2925e-01 0.0000e+00
++7.4742e-01 +1.1185e-01 0.0000e+00
+-4.9637e-01 +5.5389e-01 0.0000e+00
+-4.4719e-01 +5.3772e-01 0.0000e+00
+-4.0325e-01 +5.1754e-01 0.0000e+00
+-3.4862e-01 +5.0930e-01 0.0000e+00
+-2.9711e-01 +4.8615e-01 0.0000e+00
+-2.5735e-01 +4.7346e-01 0.0000e+00
+-2.0451e-01 +4.6059e-01 0.0000e+00
+-1.5371e-01 +4.4687e-01 0.0000e+00
+-1.0295e-01 +4.3399e-01 0.0000e+00
+-5.8500e-02 +4.2026e-01 0.0000e+00
+-6.7553e-03 +3.9693e-01 0.0000e+00
++4.0126e-02 +3.8188e-01 0.0000e+00
++8.9256e-02 +3.7060e-01 0.0000e+00
++1.3905e-01 +3.5541e-01 0.0000e+00
++1.8033e-01 +3.4071e-01 0.0000e+00
++2.3237e-01 +3.2728e-01 0.0000e+00
++2.8514e-01 +3.0550e-01 0.0000e+00
++3.2841e-01 +2.9354e-01 0.0000e+00
++3.7571e-01 +2.8529e-01 0.0000e+00
++4.2952e-01 +2.6915e-01 0.0000e+00
++4.7374e-01 +2.4974e-01 0.0000e+00
++5.2351e-01 +2.3668e-01 0.0000e+00
++5.7250e-01 +2.2072e-01 0.0000e+00
++6.2358e-01 +2.0496e-01 0.0000e+00
++6.7463e-01 +1.9428e-01 0.0000e+00
++7.2072e-01 +1.7478e-01 0.0000e+00
+-4.3254e-01 +5.8149e-01 0.0000e+00
+-3.8502e-01 +5.7168e-01 0.0000e+00
+-3.2918e-01 +5.5345e-01 0.0000e+00
+-2.8833e-01 +5.3985e-01 0.0000e+00
+-2.3757e-01 +5.2782e-01 0.0000e+00
+-1.8760e-01 +5.0835e-01 0.0000e+00
+-1.3590e-01 +4.9824e-01 0.0000e+00
+-9.4319e-02 +4.7611e-01 0.0000e+00
+-4.3059e-02 +4.6140e-01 0.0000e+00
++5.8993e-03 +4.4503e-01 0.0000e+00
++5.5435e-02 +4.3015e-01 0.0000e+00
++1.0599e-01 +4.1424e-01 0.0000e+00
++1.4681e-01 +4.0556e-01 0.0000e+00
++2.0088e-01 +3.8802e-01 0.0000e+00
++2.4554e-01 +3.7525e-01 0.0000e+00
++2.9943e-01 +3.5804e-01 0.0000e+00
++3.4198e-01 +3.4584e-01 0.0000e+00
++3.9380e-01 +3.2910e-01 0.0000e+00
++4.4328e-01 +3.1910e-01 0.0000e+00
++4.8641e-01 +3.0242e-01 0.0000e+00
++5.3476e-01 +2.8649e-01 0.0000e+00
++5.8911e-01 +2.6720e-01 0.0000e+00
++6.3198e-01 +2.5298e-01 0.0000e+00
++6.8415e-01 +2.3769e-01 0.0000e+00
+-4.1861e-01 +6.3561e-01 0.0000e+00
+-3.6458e-01 +6.2094e-01 0.0000e+00
+-3.1845e-01 +6.0688e-01 0.0000e+00
+-2.7200e-01 +5.9234e-01 0.0000e+00
+-2.1727e-01 +5.7561e-01 0.0000e+00
+-1.7682e-01 +5.5772e-01 0.0000e+00
+-1.2505e-01 +5.4089e-01 0.0000e+00
+-8.0485e-02 +5.2889e-01 0.0000e+00
+-3.2870e-02 +5.1135e-01 0.0000e+00
++2.1701e-02 +5.0310e-01 0.0000e+00
++6.9775e-02 +4.8149e-01 0.0000e+00
++1.2130e-01 +4.6727e-01 0.0000e+00
++1.6334e-01 +4.5760e-01 0.0000e+00
++2.1087e-01 +4.3890e-01 0.0000e+00
++2.6238e-01 +4.2827e-01 0.0000e+00
++3.1105e-01 +4.0910e-01 0.0000e+00
++3.5835e-01 +3.9636e-01 0.0000e+00
++4.0841e-01 +3.7567e-01 0.0000e+00
++4.5286e-01 +3.6602e-01 0.0000e+00
++5.0684e-01 +3.4630e-01 0.0000e+00
++5.5744e-01 +3.2805e-01 0.0000e+00
++6.0384e-01 +3.1983e-01 0.0000e+00
++6.4833e-01 +3.0524e-01 0.0000e+00
++7.0175e-01 +2.9108e-01 0.0000e+00
+-3.5122e-01 +6.6911e-01 0.0000e+00
+-3.0061e-01 +6.5284e-01 0.0000e+00
+-2.5421e-01 +6.3875e-01 0.0000e+00
+-2.0917e-01 +6.2267e-01 0.0000e+00
+-1.5824e-01 +6.0698e-01 0.0000e+00
+-1.1402e-01 +5.8934e-01 0.0000e+00
+-5.9658e-02 +5.7363e-01 0.0000e+00
+-8.9985e-03 +5.5663e-01 0.0000e+00
++3.9599e-02 +5.4961e-01 0.0000e+00
++8.6528e-02 +5.3495e-01 0.0000e+00
++1.3760e-01 +5.1851e-01 0.0000e+00
++1.7737e-01 +5.0368e-01 0.0000e+00
++2.3127e-01 +4.8478e-01 0.0000e+00
++2.8220e-01 +4.7135e-01 0.0000e+00
++3.2350e-01 +4.6251e-01 0.0000e+00
++3.7197e-01 +4.4389e-01 0.0000e+00
++4.2904e-01 +4.2948e-01 0.0000e+00
++4.7681e-01 +4.1460e-01 0.0000e+00
++5.1707e-01 +4.0071e-01 0.0000e+00
++5.6994e-01 +3.7712e-01 0.0000e+00
++6.1958e-01 +3.6263e-01 0.0000e+00
++6.6556e-01 +3.5502e-01 0.0000e+00
+-2.8423e-01 +7.0363e-01 0.0000e+00
+-2.4452e-01 +6.8705e-01 0.0000e+00
+-1.9563e-01 +6.7090e-01 0.0000e+00
+-1.4322e-01 +6.5824e-01 0.0000e+00
+-9.6079e-02 +6.3821e-01 0.0000e+00
+-4.2392e-02 +6.2901e-01 0.0000e+00
++8.3714e-03 +6.1320e-01 0.0000e+00
++4.8617e-02 +5.9919e-01 0.0000e+00
++1.0013e-01 +5.7491e-01 0.0000e+00
++1.5019e-01 +5.6573e-01 0.0000e+00
++1.9596e-01 +5.5287e-01 0.0000e+00
++2.4702e-01 +5.3069e-01 0.0000e+00
++2.9345e-01 +5.1999e-01 0.0000e+00
++3.3843e-01 +5.0924e-01 0.0000e+00
++3.9107e-01 +4.8939e-01 0.0000e+00
++4.4217e-01 +4.7372e-01 0.0000e+00
++4.8473e-01 +4.6635e-01 0.0000e+00
++5.3421e-01 +4.4284e-01 0.0000e+00
++5.8542e-01 +4.2515e-01 0.0000e+00
++6.3752e-01 +4.1582e-01 0.0000e+00
+-1.7957e-01 +7.1634e-01 0.0000e+00
+-1.2769e-01 +7.0692e-01 0.0000e+00
+-8.1318e-02 +6.9029e-01 0.0000e+00
+-3.4825e-02 +6.7363e-01 0.0000e+00
++1.2699e-02 +6.5876e-01 0.0000e+00
++6.5993e-02 +6.4327e-01 0.0000e+00
++1.0817e-01 +6.2526e-01 0.0000e+00
++1.6645e-01 +6.1033e-01 0.0000e+00
++2.1361e-01 +5.9782e-01 0.0000e+00
++2.6211e-01 +5.7869e-01 0.0000e+00
++3.1120e-01 +5.7088e-01 0.0000e+00
++3.5384e-01 +5.5917e-01 0.0000e+00
++4.0600e-01 +5.3968e-01 0.0000e+00
++4.5759e-01 +5.2659e-01 0.0000e+00
++5.0698e-01 +5.1019e-01 0.0000e+00
++5.4877e-01 +4.9321e-01 0.0000e+00
+-6.2087e-02 +7.3883e-01 0.0000e+00
+-1.7630e-02 +7.1962e-01 0.0000e+00
++3.3258e-02 +7.0461e-01 0.0000e+00
++8.0676e-02 +6.8716e-01 0.0000e+00
++1.2679e-01 +6.7738e-01 0.0000e+00
++1.8216e-01 +6.6357e-01 0.0000e+00
++2.2331e-01 +6.4631e-01 0.0000e+00
++2.8035e-01 +6.3515e-01 0.0000e+00
++3.2552e-01 +6.2053e-01 0.0000e+00
++3.6752e-01 +6.0118e-01 0.0000e+00
++4.2436e-01 +5.9002e-01 0.0000e+00
++4.7053e-01 +5.7409e-01 0.0000e+00
++4.5562e-02 +7.5560e-01 0.0000e+00
++9.6202e-02 +7.4389e-01 0.0000e+00
++1.4610e-01 +7.2687e-01 0.0000e+00
++1.8835e-01 +7.1284e-01 0.0000e+00
++2.4028e-01 +6.9468e-01 0.0000e+00
++2.9194e-01 +6.7606e-01 0.0000e+00
++3.3911e-01 +6.6395e-01 0.0000e+00
++3.8655e-01 +6.4937e-01 0.0000e+00
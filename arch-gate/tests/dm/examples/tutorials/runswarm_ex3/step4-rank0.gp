@@ -0,0 +1,711 @@
+-4.5387e-01 -6.1050e-01 0.0000e+00
+-3.9937e-01 -6.3109e-01 0.0000e+00
+-3.5546e-01 -6.5615e-01 0.0000e+00
+-3.0795e-01 -6.7164e-01 0.0000e+00
+-2.6966e-01 -6.9289e-01 0.0000e+00
+-2.1302e-01 -7.1542e-01 0.0000e+00
+-1.6815e-01 -7.3615e-01 0.0000e+00
+-1.1870e-01 -7.5090e-01 0.0000e+00
+-5.7291e-01 -5.0684e-01 0.0000e+00
+-5.2525e-01 -5.3076e-01 0.0000e+00
+-4.7692e-01 -5.5100e-01 0.0000e+00
+-4.3026e-01 -5.6988e-01 0.0000e+00
+-3.8439e-01 -5.8711e-01 0.0000e+00
+-3.4251e-01 -6.0771e-01 0.0000e+00
+-2.9369e-01 -6.2869e-01 0.0000e+00
+-2.4706e-01 -6.4297e-01 0.0000e+00
+-1.9282e-01 -6.6372e-01 0.0000e+00
+-1.5266e-01 -6.8028e-01 0.0000e+00
+-1.0263e-01 -7.0555e-01 0.0000e+00
+-5.1655e-02 -7.2691e-01 0.0000e+00
+-7.1298e-03 -7.4200e-01 0.0000e+00
+-6.0610e-01 -4.4202e-01 0.0000e+00
+-5.5142e-01 -4.6489e-01 0.0000e+00
+-5.0711e-01 -4.7442e-01 0.0000e+00
+-4.6107e-01 -5.0129e-01 0.0000e+00
+-4.1518e-01 -5.1872e-01 0.0000e+00
+-3.6248e-01 -5.3834e-01 0.0000e+00
+-3.1409e-01 -5.5948e-01 0.0000e+00
+-2.7362e-01 -5.8072e-01 0.0000e+00
+-2.2399e-01 -5.9980e-01 0.0000e+00
+-1.7302e-01 -6.1623e-01 0.0000e+00
+-1.2857e-01 -6.3935e-01 0.0000e+00
+-8.2882e-02 -6.5927e-01 0.0000e+00
+-3.6541e-02 -6.7519e-01 0.0000e+00
++1.0528e-02 -6.9868e-01 0.0000e+00
++6.0859e-02 -7.1201e-01 0.0000e+00
++1.0484e-01 -7.3730e-01 0.0000e+00
+-6.7339e-01 -3.5678e-01 0.0000e+00
+-6.2595e-01 -3.7596e-01 0.0000e+00
+-5.8410e-01 -3.9201e-01 0.0000e+00
+-5.3070e-01 -4.0782e-01 0.0000e+00
+-4.8552e-01 -4.2803e-01 0.0000e+00
+-4.4020e-01 -4.5044e-01 0.0000e+00
+-3.9500e-01 -4.7046e-01 0.0000e+00
+-3.4616e-01 -4.9412e-01 0.0000e+00
+-2.9973e-01 -5.1242e-01 0.0000e+00
+-2.5069e-01 -5.2605e-01 0.0000e+00
+-2.0247e-01 -5.5001e-01 0.0000e+00
+-1.5947e-01 -5.6402e-01 0.0000e+00
+-1.0929e-01 -5.8827e-01 0.0000e+00
+-6.5748e-02 -6.0586e-01 0.0000e+00
+-1.4188e-02 -6.2669e-01 0.0000e+00
++2.9788e-02 -6.5450e-01 0.0000e+00
++8.0679e-02 -6.7234e-01 0.0000e+00
++1.2988e-01 -6.8693e-01 0.0000e+00
++1.6888e-01 -7.0917e-01 0.0000e+00
++2.1566e-01 -7.2961e-01 0.0000e+00
+-6.9932e-01 -2.8250e-01 0.0000e+00
+-6.5406e-01 -3.0845e-01 0.0000e+00
+-6.0539e-01 -3.2091e-01 0.0000e+00
+-5.6109e-01 -3.4050e-01 0.0000e+00
+-5.1088e-01 -3.6225e-01 0.0000e+00
+-4.6703e-01 -3.8862e-01 0.0000e+00
+-4.1636e-01 -4.0932e-01 0.0000e+00
+-3.7457e-01 -4.2481e-01 0.0000e+00
+-3.2834e-01 -4.4817e-01 0.0000e+00
+-2.8103e-01 -4.5834e-01 0.0000e+00
+-2.2844e-01 -4.8528e-01 0.0000e+00
+-1.8181e-01 -5.0912e-01 0.0000e+00
+-1.3626e-01 -5.2762e-01 0.0000e+00
+-8.9757e-02 -5.4609e-01 0.0000e+00
+-3.8799e-02 -5.6485e-01 0.0000e+00
++6.6554e-03 -5.8362e-01 0.0000e+00
++5.2993e-02 -6.0501e-01 0.0000e+00
++9.5136e-02 -6.2270e-01 0.0000e+00
++1.4384e-01 -6.4352e-01 0.0000e+00
++1.8807e-01 -6.6180e-01 0.0000e+00
++2.4155e-01 -6.8395e-01 0.0000e+00
++2.8599e-01 -7.0546e-01 0.0000e+00
+-7.2981e-01 -2.1801e-01 0.0000e+00
+-6.8458e-01 -2.3411e-01 0.0000e+00
+-6.3710e-01 -2.6137e-01 0.0000e+00
+-5.8462e-01 -2.7957e-01 0.0000e+00
+-5.3523e-01 -2.9688e-01 0.0000e+00
+-4.8993e-01 -3.1993e-01 0.0000e+00
+-4.5147e-01 -3.3833e-01 0.0000e+00
+-3.9906e-01 -3.6206e-01 0.0000e+00
+-3.5589e-01 -3.8065e-01 0.0000e+00
+-3.0095e-01 -3.9492e-01 0.0000e+00
+-2.5834e-01 -4.2003e-01 0.0000e+00
+-2.0906e-01 -4.3682e-01 0.0000e+00
+-1.6672e-01 -4.6092e-01 0.0000e+00
+-1.1557e-01 -4.7440e-01 0.0000e+00
+-7.1464e-02 -5.0063e-01 0.0000e+00
+-2.3401e-02 -5.1691e-01 0.0000e+00
++2.1160e-02 -5.3498e-01 0.0000e+00
++6.8844e-02 -5.5299e-01 0.0000e+00
++1.1878e-01 -5.8028e-01 0.0000e+00
++1.6469e-01 -5.9947e-01 0.0000e+00
++2.1710e-01 -6.1239e-01 0.0000e+00
++2.5446e-01 -6.3124e-01 0.0000e+00
++3.1041e-01 -6.5230e-01 0.0000e+00
++3.5591e-01 -6.7492e-01 0.0000e+00
+-7.1188e-01 -1.7522e-01 0.0000e+00
+-6.6445e-01 -1.8928e-01 0.0000e+00
+-6.1560e-01 -2.1136e-01 0.0000e+00
+-5.6612e-01 -2.3588e-01 0.0000e+00
+-5.2295e-01 -2.4610e-01 0.0000e+00
+-4.7230e-01 -2.6984e-01 0.0000e+00
+-4.2787e-01 -2.8596e-01 0.0000e+00
+-3.7571e-01 -3.0803e-01 0.0000e+00
+-3.3154e-01 -3.2670e-01 0.0000e+00
+-2.9162e-01 -3.5117e-01 0.0000e+00
+-2.4191e-01 -3.7330e-01 0.0000e+00
+-1.8895e-01 -3.9224e-01 0.0000e+00
+-1.4563e-01 -4.1170e-01 0.0000e+00
+-9.4509e-02 -4.3170e-01 0.0000e+00
+-5.3587e-02 -4.4289e-01 0.0000e+00
+-5.9434e-03 -4.6492e-01 0.0000e+00
++4.2272e-02 -4.8890e-01 0.0000e+00
++8.4922e-02 -5.1128e-01 0.0000e+00
++1.3597e-01 -5.2443e-01 0.0000e+00
++1.8857e-01 -5.4644e-01 0.0000e+00
++2.2823e-01 -5.6485e-01 0.0000e+00
++2.8236e-01 -5.8924e-01 0.0000e+00
++3.2048e-01 -6.1090e-01 0.0000e+00
++3.6892e-01 -6.2479e-01 0.0000e+00
+-7.3777e-01 -1.0606e-01 0.0000e+00
+-6.8984e-01 -1.2628e-01 0.0000e+00
+-6.3911e-01 -1.4217e-01 0.0000e+00
+-5.9686e-01 -1.6196e-01 0.0000e+00
+-5.5270e-01 -1.8275e-01 0.0000e+00
+-5.0319e-01 -2.0559e-01 0.0000e+00
+-4.5100e-01 -2.2789e-01 0.0000e+00
+-4.1091e-01 -2.4262e-01 0.0000e+00
+-3.5894e-01 -2.6142e-01 0.0000e+00
+-3.1225e-01 -2.8517e-01 0.0000e+00
+-2.6508e-01 -3.0376e-01 0.0000e+00
+-2.1776e-01 -3.2021e-01 0.0000e+00
+-1.7129e-01 -3.3976e-01 0.0000e+00
+-1.3129e-01 -3.6455e-01 0.0000e+00
+-7.6235e-02 -3.7956e-01 0.0000e+00
+-3.3534e-02 -3.9982e-01 0.0000e+00
++1.6915e-02 -4.1727e-01 0.0000e+00
++5.7683e-02 -4.4406e-01 0.0000e+00
++1.0783e-01 -4.5962e-01 0.0000e+00
++1.6100e-01 -4.7790e-01 0.0000e+00
++2.0532e-01 -5.0271e-01 0.0000e+00
++2.4738e-01 -5.2290e-01 0.0000e+00
++2.9445e-01 -5.4437e-01 0.0000e+00
++3.4462e-01 -5.5631e-01 0.0000e+00
++3.8711e-01 -5.8233e-01 0.0000e+00
++4.4289e-01 -5.9972e-01 0.0000e+00
+-7.5993e-01 -4.3325e-02 0.0000e+00
+-7.1176e-01 -5.7214e-02 0.0000e+00
+-6.6434e-01 -7.7844e-02 0.0000e+00
+-6.2123e-01 -1.0304e-01 0.0000e+00
+-5.7335e-01 -1.1404e-01 0.0000e+00
+-5.3138e-01 -1.3319e-01 0.0000e+00
+-4.7950e-01 -1.5928e-01 0.0000e+00
+-4.3532e-01 -1.7134e-01 0.0000e+00
+-3.9047e-01 -1.9211e-01 0.0000e+00
+-3.3892e-01 -2.2086e-01 0.0000e+00
+-2.9151e-01 -2.4233e-01 0.0000e+00
+-2.4718e-01 -2.5097e-01 0.0000e+00
+-1.9952e-01 -2.7812e-01 0.0000e+00
+-1.5146e-01 -2.9539e-01 0.0000e+00
+-9.9821e-02 -3.1234e-01 0.0000e+00
+-5.9297e-02 -3.3023e-01 0.0000e+00
+-1.1489e-02 -3.5009e-01 0.0000e+00
++3.5953e-02 -3.7420e-01 0.0000e+00
++8.3882e-02 -3.9844e-01 0.0000e+00
++1.2775e-01 -4.1765e-01 0.0000e+00
++1.7588e-01 -4.3604e-01 0.0000e+00
++2.2641e-01 -4.5188e-01 0.0000e+00
++2.6963e-01 -4.7458e-01 0.0000e+00
++3.1570e-01 -4.9753e-01 0.0000e+00
++3.6381e-01 -5.1475e-01 0.0000e+00
++4.1018e-01 -5.3237e-01 0.0000e+00
++4.6216e-01 -5.5431e-01 0.0000e+00
+-7.3718e-01 +1.1531e-02 0.0000e+00
+-6.9915e-01 -1.5057e-02 0.0000e+00
+-6.5427e-01 -3.2447e-02 0.0000e+00
+-6.0804e-01 -5.1944e-02 0.0000e+00
+-5.5612e-01 -7.5095e-02 0.0000e+00
+-5.0996e-01 -9.3025e-02 0.0000e+00
+-4.5933e-01 -1.1570e-01 0.0000e+00
+-4.1563e-01 -1.2465e-01 0.0000e+00
+-3.6658e-01 -1.5316e-01 0.0000e+00
+-3.1860e-01 -1.7039e-01 0.0000e+00
+-2.7803e-01 -1.8806e-01 0.0000e+00
+-2.2653e-01 -2.0975e-01 0.0000e+00
+-1.8222e-01 -2.2604e-01 0.0000e+00
+-1.3454e-01 -2.4507e-01 0.0000e+00
+-8.2373e-02 -2.6857e-01 0.0000e+00
+-3.7897e-02 -2.8755e-01 0.0000e+00
++8.3202e-03 -3.0371e-01 0.0000e+00
++6.1131e-02 -3.2520e-01 0.0000e+00
++1.0402e-01 -3.4788e-01 0.0000e+00
++1.4893e-01 -3.6690e-01 0.0000e+00
++1.9228e-01 -3.8585e-01 0.0000e+00
++2.4218e-01 -4.0650e-01 0.0000e+00
++2.9047e-01 -4.2745e-01 0.0000e+00
++3.4393e-01 -4.4422e-01 0.0000e+00
++3.8617e-01 -4.6888e-01 0.0000e+00
++4.3182e-01 -4.8414e-01 0.0000e+00
++4.8066e-01 -5.0887e-01 0.0000e+00
++5.2599e-01 -5.2533e-01 0.0000e+00
+-7.2421e-01 +5.3746e-02 0.0000e+00
+-6.8010e-01 +3.8278e-02 0.0000e+00
+-6.2883e-01 +1.5401e-02 0.0000e+00
+-5.8299e-01 -7.9495e-03 0.0000e+00
+-5.3010e-01 -2.2681e-02 0.0000e+00
+-4.8897e-01 -4.1469e-02 0.0000e+00
+-4.4671e-01 -6.6093e-02 0.0000e+00
+-3.9526e-01 -8.6055e-02 0.0000e+00
+-3.4557e-01 -9.9497e-02 0.0000e+00
+-2.9894e-01 -1.2449e-01 0.0000e+00
+-2.5743e-01 -1.4331e-01 0.0000e+00
+-2.0616e-01 -1.6761e-01 0.0000e+00
+-1.5361e-01 -1.8025e-01 0.0000e+00
+-1.1672e-01 -1.9988e-01 0.0000e+00
+-6.0843e-02 -2.1935e-01 0.0000e+00
+-1.7644e-02 -2.4607e-01 0.0000e+00
++2.5368e-02 -2.5866e-01 0.0000e+00
++7.3413e-02 -2.8515e-01 0.0000e+00
++1.2347e-01 -3.0117e-01 0.0000e+00
++1.6965e-01 -3.2428e-01 0.0000e+00
++2.1394e-01 -3.3438e-01 0.0000e+00
++2.6032e-01 -3.6394e-01 0.0000e+00
++3.1545e-01 -3.8030e-01 0.0000e+00
++3.5340e-01 -4.0191e-01 0.0000e+00
++4.0641e-01 -4.1557e-01 0.0000e+00
++4.5614e-01 -4.3648e-01 0.0000e+00
++4.9580e-01 -4.5877e-01 0.0000e+00
++5.4719e-01 -4.7827e-01 0.0000e+00
+-7.5439e-01 +1.2523e-01 0.0000e+00
+-7.0131e-01 +1.0199e-01 0.0000e+00
+-6.5851e-01 +8.8375e-02 0.0000e+00
+-6.0488e-01 +6.4729e-02 0.0000e+00
+-5.6425e-01 +4.5150e-02 0.0000e+00
+-5.1124e-01 +2.7043e-02 0.0000e+00
+-4.7010e-01 +7.4522e-03 0.0000e+00
+-4.2329e-01 -2.0796e-02 0.0000e+00
+-3.7410e-01 -3.8631e-02 0.0000e+00
+-3.2507e-01 -5.6285e-02 0.0000e+00
+-2.7939e-01 -7.6905e-02 0.0000e+00
+-2.3564e-01 -9.5256e-02 0.0000e+00
+-1.8770e-01 -1.1514e-01 0.0000e+00
+-1.4299e-01 -1.3386e-01 0.0000e+00
+-8.7323e-02 -1.5438e-01 0.0000e+00
+-5.0608e-02 -1.7717e-01 0.0000e+00
+-8.2240e-04 -1.9854e-01 0.0000e+00
++4.8816e-02 -2.1360e-01 0.0000e+00
++9.5855e-02 -2.3800e-01 0.0000e+00
++1.4044e-01 -2.5202e-01 0.0000e+00
++1.9061e-01 -2.7671e-01 0.0000e+00
++2.3284e-01 -2.9175e-01 0.0000e+00
++2.8215e-01 -3.1492e-01 0.0000e+00
++3.3411e-01 -3.3248e-01 0.0000e+00
++3.7728e-01 -3.4999e-01 0.0000e+00
++4.2383e-01 -3.7651e-01 0.0000e+00
++4.6934e-01 -3.9143e-01 0.0000e+00
++5.1904e-01 -4.1198e-01 0.0000e+00
++5.6481e-01 -4.3507e-01 0.0000e+00
++6.0930e-01 -4.5323e-01 0.0000e+00
+-7.3019e-01 +1.7277e-01 0.0000e+00
+-6.8447e-01 +1.5201e-01 0.0000e+00
+-6.3849e-01 +1.2972e-01 0.0000e+00
+-5.9311e-01 +1.1298e-01 0.0000e+00
+-5.4608e-01 +9.0251e-02 0.0000e+00
+-4.9080e-01 +7.3766e-02 0.0000e+00
+-4.4675e-01 +4.7829e-02 0.0000e+00
+-4.0300e-01 +3.4419e-02 0.0000e+00
+-3.5877e-01 +1.4448e-02 0.0000e+00
+-3.0500e-01 -1.0027e-02 0.0000e+00
+-2.6017e-01 -3.1448e-02 0.0000e+00
+-2.1548e-01 -4.9734e-02 0.0000e+00
+-1.7016e-01 -6.6714e-02 0.0000e+00
+-1.1462e-01 -8.4794e-02 0.0000e+00
+-7.1829e-02 -1.0496e-01 0.0000e+00
+-2.1013e-02 -1.2588e-01 0.0000e+00
++1.8499e-02 -1.4699e-01 0.0000e+00
++6.4624e-02 -1.6977e-01 0.0000e+00
++1.1437e-01 -1.8791e-01 0.0000e+00
++1.6284e-01 -2.0758e-01 0.0000e+00
++2.0459e-01 -2.2835e-01 0.0000e+00
++2.5611e-01 -2.4862e-01 0.0000e+00
++3.0147e-01 -2.7064e-01 0.0000e+00
++3.5177e-01 -2.8637e-01 0.0000e+00
++3.9106e-01 -3.0725e-01 0.0000e+00
++4.4117e-01 -3.1913e-01 0.0000e+00
++4.8994e-01 -3.4722e-01 0.0000e+00
++5.3469e-01 -3.6679e-01 0.0000e+00
++5.8669e-01 -3.8699e-01 0.0000e+00
++6.3471e-01 -4.0127e-01 0.0000e+00
+-7.0892e-01 +2.1117e-01 0.0000e+00
+-6.5997e-01 +1.9543e-01 0.0000e+00
+-6.1529e-01 +1.8161e-01 0.0000e+00
+-5.7634e-01 +1.5458e-01 0.0000e+00
+-5.2745e-01 +1.3814e-01 0.0000e+00
+-4.7888e-01 +1.2319e-01 0.0000e+00
+-4.3057e-01 +9.7451e-02 0.0000e+00
+-3.7717e-01 +7.8106e-02 0.0000e+00
+-3.3426e-01 +6.1295e-02 0.0000e+00
+-2.8542e-01 +3.7873e-02 0.0000e+00
+-2.4072e-01 +2.3279e-02 0.0000e+00
+-1.9132e-01 +3.4653e-04 0.0000e+00
+-1.5198e-01 -2.4431e-02 0.0000e+00
+-9.8373e-02 -3.9528e-02 0.0000e+00
+-5.0821e-02 -6.1530e-02 0.0000e+00
+-4.1617e-03 -7.9060e-02 0.0000e+00
++3.9278e-02 -1.0110e-01 0.0000e+00
++8.9868e-02 -1.2099e-01 0.0000e+00
++1.3812e-01 -1.4206e-01 0.0000e+00
++1.8635e-01 -1.5823e-01 0.0000e+00
++2.2803e-01 -1.7859e-01 0.0000e+00
++2.8179e-01 -1.9669e-01 0.0000e+00
++3.2434e-01 -2.2422e-01 0.0000e+00
++3.6910e-01 -2.4264e-01 0.0000e+00
++4.1551e-01 -2.5409e-01 0.0000e+00
++4.6015e-01 -2.8052e-01 0.0000e+00
++5.0592e-01 -2.9866e-01 0.0000e+00
++5.5296e-01 -3.1770e-01 0.0000e+00
++6.0342e-01 -3.4078e-01 0.0000e+00
++6.5256e-01 -3.5266e-01 0.0000e+00
+-6.9254e-01 +2.6491e-01 0.0000e+00
+-6.4729e-01 +2.4317e-01 0.0000e+00
+-5.9921e-01 +2.2780e-01 0.0000e+00
+-5.5301e-01 +2.0886e-01 0.0000e+00
+-5.0218e-01 +1.8283e-01 0.0000e+00
+-4.5527e-01 +1.6801e-01 0.0000e+00
+-4.0596e-01 +1.4382e-01 0.0000e+00
+-3.6169e-01 +1.2835e-01 0.0000e+00
+-3.1817e-01 +1.0298e-01 0.0000e+00
+-2.6718e-01 +8.9695e-02 0.0000e+00
+-2.1979e-01 +6.3812e-02 0.0000e+00
+-1.7974e-01 +4.5423e-02 0.0000e+00
+-1.2213e-01 +2.8392e-02 0.0000e+00
+-7.5753e-02 +9.6540e-03 0.0000e+00
+-3.2301e-02 -1.8275e-02 0.0000e+00
++9.4463e-03 -3.5279e-02 0.0000e+00
++6.2290e-02 -5.6016e-02 0.0000e+00
++1.0371e-01 -7.4210e-02 0.0000e+00
++1.5599e-01 -9.7637e-02 0.0000e+00
++2.0464e-01 -1.1286e-01 0.0000e+00
++2.5168e-01 -1.3410e-01 0.0000e+00
++2.9491e-01 -1.4710e-01 0.0000e+00
++3.4280e-01 -1.7551e-01 0.0000e+00
++3.9012e-01 -1.8835e-01 0.0000e+00
++4.4122e-01 -2.1241e-01 0.0000e+00
++4.8054e-01 -2.2819e-01 0.0000e+00
++5.2958e-01 -2.4888e-01 0.0000e+00
++5.8011e-01 -2.7359e-01 0.0000e+00
++6.2413e-01 -2.9049e-01 0.0000e+00
++6.6759e-01 -3.0979e-01 0.0000e+00
+-6.6773e-01 +3.0943e-01 0.0000e+00
+-6.2328e-01 +2.9506e-01 0.0000e+00
+-5.7572e-01 +2.7055e-01 0.0000e+00
+-5.3262e-01 +2.5432e-01 0.0000e+00
+-4.8259e-01 +2.3332e-01 0.0000e+00
+-4.3463e-01 +2.0827e-01 0.0000e+00
+-3.8889e-01 +1.8960e-01 0.0000e+00
+-3.4520e-01 +1.6763e-01 0.0000e+00
+-2.9504e-01 +1.4852e-01 0.0000e+00
+-2.5116e-01 +1.3127e-01 0.0000e+00
+-2.0272e-01 +1.0997e-01 0.0000e+00
+-1.5363e-01 +9.4936e-02 0.0000e+00
+-1.0887e-01 +7.7552e-02 0.0000e+00
+-5.8139e-02 +4.9575e-02 0.0000e+00
+-1.3545e-02 +3.6522e-02 0.0000e+00
++3.6167e-02 +9.0088e-03 0.0000e+00
++7.8262e-02 -1.6336e-03 0.0000e+00
++1.2927e-01 -2.3723e-02 0.0000e+00
++1.7046e-01 -4.9251e-02 0.0000e+00
++2.2294e-01 -6.9105e-02 0.0000e+00
++2.7209e-01 -8.7643e-02 0.0000e+00
++3.1276e-01 -1.0364e-01 0.0000e+00
++3.5877e-01 -1.2621e-01 0.0000e+00
++4.1458e-01 -1.4398e-01 0.0000e+00
++4.5670e-01 -1.6028e-01 0.0000e+00
++5.0407e-01 -1.8221e-01 0.0000e+00
++5.5407e-01 -2.0040e-01 0.0000e+00
++5.9467e-01 -2.2643e-01 0.0000e+00
++6.4949e-01 -2.4385e-01 0.0000e+00
++6.8951e-01 -2.6604e-01 0.0000e+00
+-6.4912e-01 +3.5649e-01 0.0000e+00
+-6.0858e-01 +3.4004e-01 0.0000e+00
+-5.5601e-01 +3.2269e-01 0.0000e+00
+-5.0792e-01 +2.9519e-01 0.0000e+00
+-4.6246e-01 +2.8243e-01 0.0000e+00
+-4.1724e-01 +2.5653e-01 0.0000e+00
+-3.7137e-01 +2.3667e-01 0.0000e+00
+-3.1918e-01 +2.1600e-01 0.0000e+00
+-2.7693e-01 +2.0509e-01 0.0000e+00
+-2.2855e-01 +1.7393e-01 0.0000e+00
+-1.8704e-01 +1.5811e-01 0.0000e+00
+-1.3347e-01 +1.3828e-01 0.0000e+00
+-8.8633e-02 +1.2398e-01 0.0000e+00
+-4.2269e-02 +9.7580e-02 0.0000e+00
++8.0630e-03 +8.3915e-02 0.0000e+00
++5.0441e-02 +6.1775e-02 0.0000e+00
++1.0488e-01 +3.9072e-02 0.0000e+00
++1.4779e-01 +1.8926e-02 0.0000e+00
++1.9858e-01 +3.8097e-03 0.0000e+00
++2.4131e-01 -1.5501e-02 0.0000e+00
++2.8611e-01 -4.1492e-02 0.0000e+00
++3.3157e-01 -5.8087e-02 0.0000e+00
++3.8243e-01 -7.6787e-02 0.0000e+00
++4.2723e-01 -1.0240e-01 0.0000e+00
++4.7801e-01 -1.1393e-01 0.0000e+00
++5.2036e-01 -1.3653e-01 0.0000e+00
++5.6875e-01 -1.5924e-01 0.0000e+00
++6.1851e-01 -1.7208e-01 0.0000e+00
++6.6590e-01 -1.9767e-01 0.0000e+00
++7.0840e-01 -2.2046e-01 0.0000e+00
+-6.3303e-01 +4.0401e-01 0.0000e+00
+-5.8679e-01 +3.8493e-01 0.0000e+00
+-5.3990e-01 +3.6689e-01 0.0000e+00
+-4.8831e-01 +3.4900e-01 0.0000e+00
+-4.4824e-01 +3.2497e-01 0.0000e+00
+-4.0239e-01 +3.0296e-01 0.0000e+00
+-3.5146e-01 +2.8260e-01 0.0000e+00
+-3.0570e-01 +2.6586e-01 0.0000e+00
+-2.5434e-01 +2.4007e-01 0.0000e+00
+-2.0475e-01 +2.2870e-01 0.0000e+00
+-1.6828e-01 +2.0484e-01 0.0000e+00
+-1.1989e-01 +1.8537e-01 0.0000e+00
+-7.3271e-02 +1.6610e-01 0.0000e+00
+-1.9439e-02 +1.5107e-01 0.0000e+00
++2.7513e-02 +1.2512e-01 0.0000e+00
++7.6675e-02 +1.0523e-01 0.0000e+00
++1.1697e-01 +8.7037e-02 0.0000e+00
++1.6851e-01 +6.7458e-02 0.0000e+00
++2.1250e-01 +5.0332e-02 0.0000e+00
++2.5857e-01 +2.6349e-02 0.0000e+00
++3.1124e-01 +6.0158e-03 0.0000e+00
++3.5541e-01 -1.1889e-02 0.0000e+00
++3.9998e-01 -2.7700e-02 0.0000e+00
++4.4666e-01 -5.3947e-02 0.0000e+00
++4.9505e-01 -7.1293e-02 0.0000e+00
++5.3799e-01 -9.2260e-02 0.0000e+00
++5.9295e-01 -1.1109e-01 0.0000e+00
++6.4080e-01 -1.3147e-01 0.0000e+00
++6.8769e-01 -1.5119e-01 0.0000e+00
++7.3363e-01 -1.7482e-01 0.0000e+00
+-6.0655e-01 +4.5359e-01 0.0000e+00
+-5.6695e-01 +4.2879e-01 0.0000e+00
+-5.2196e-01 +4.1112e-01 0.0000e+00
+-4.7213e-01 +3.9176e-01 0.0000e+00
+-4.2213e-01 +3.7320e-01 0.0000e+00
+-3.8127e-01 +3.5230e-01 0.0000e+00
+-3.3034e-01 +3.3824e-01 0.0000e+00
+-2.8732e-01 +3.1051e-01 0.0000e+00
+-2.3632e-01 +2.8848e-01 0.0000e+00
+-1.9413e-01 +2.7355e-01 0.0000e+00
+-1.4074e-01 +2.5035e-01 0.0000e+00
+-9.9662e-02 +2.3221e-01 0.0000e+00
+-5.3123e-02 +2.1212e-01 0.0000e+00
+-7.2803e-04 +1.9112e-01 0.0000e+00
++5.0375e-02 +1.7250e-01 0.0000e+00
++9.7844e-02 +1.5671e-01 0.0000e+00
++1.4202e-01 +1.3380e-01 0.0000e+00
++1.8291e-01 +1.1507e-01 0.0000e+00
++2.3048e-01 +9.4691e-02 0.0000e+00
++2.7645e-01 +7.7135e-02 0.0000e+00
++3.2841e-01 +5.4428e-02 0.0000e+00
++3.7600e-01 +3.9804e-02 0.0000e+00
++4.2263e-01 +2.0833e-02 0.0000e+00
++4.6585e-01 -3.8394e-03 0.0000e+00
++5.1441e-01 -1.9149e-02 0.0000e+00
++5.5930e-01 -4.5206e-02 0.0000e+00
++6.1230e-01 -5.9825e-02 0.0000e+00
++6.5678e-01 -8.6656e-02 0.0000e+00
++7.0414e-01 -1.0536e-01 0.0000e+00
++7.5003e-01 -1.1763e-01 0.0000e+00
+-5.4613e-01 +4.7808e-01 0.0000e+00
+-5.0174e-01 +4.5712e-01 0.0000e+00
+-4.5139e-01 +4.3519e-01 0.0000e+00
+-4.0783e-01 +4.1692e-01 0.0000e+00
+-3.5860e-01 +4.0420e-01 0.0000e+00
+-3.0789e-01 +3.7504e-01 0.0000e+00
+-2.6115e-01 +3.5875e-01 0.0000e+00
+-2.1538e-01 +3.4172e-01 0.0000e+00
+-1.6804e-01 +3.1878e-01 0.0000e+00
+-1.2316e-01 +2.9559e-01 0.0000e+00
+-7.9767e-02 +2.8145e-01 0.0000e+00
+-2.2443e-02 +2.6277e-01 0.0000e+00
++1.5925e-02 +2.3950e-01 0.0000e+00
++6.3562e-02 +2.2039e-01 0.0000e+00
++1.1333e-01 +2.0391e-01 0.0000e+00
++1.5426e-01 +1.7878e-01 0.0000e+00
++2.0337e-01 +1.6393e-01 0.0000e+00
++2.5010e-01 +1.4348e-01 0.0000e+00
++3.0570e-01 +1.2313e-01 0.0000e+00
++3.4833e-01 +1.0436e-01 0.0000e+00
++3.9088e-01 +8.0752e-02 0.0000e+00
++4.4005e-01 +6.8213e-02 0.0000e+00
++4.9028e-01 +4.5590e-02 0.0000e+00
++5.3378e-01 +1.9978e-02 0.0000e+00
++5.8077e-01 +9.2034e-04 0.0000e+00
++6.3511e-01 -1.3324e-02 0.0000e+00
++6.7596e-01 -3.6462e-02 0.0000e+00
++7.1958e-01 -5.5633e-02 0.0000e+00
+-5.3008e-01 +5.2720e-01 0.0000e+00
+-4.8054e-01 +5.0911e-01 0.0000e+00
+-4.2916e-01 +4.8947e-01 0.0000e+00
+-3.8439e-01 +4.6423e-01 0.0000e+00
+-3.4242e-01 +4.4835e-01 0.0000e+00
+-2.9352e-01 +4.2846e-01 0.0000e+00
+-2.4804e-01 +4.0951e-01 0.0000e+00
+-2.0244e-01 +3.8445e-01 0.0000e+00
+-1.5297e-01 +3.6984e-01 0.0000e+00
+-1.0299e-01 +3.4883e-01 0.0000e+00
+-5.9171e-02 +3.3225e-01 0.0000e+00
+-1.0811e-02 +3.1212e-01 0.0000e+00
++3.8608e-02 +2.8939e-01 0.0000e+00
++8.8223e-02 +2.6347e-01 0.0000e+00
++1.3120e-01 +2.5265e-01 0.0000e+00
++1.8076e-01 +2.2370e-01 0.0000e+00
++2.2434e-01 +2.0599e-01 0.0000e+00
++2.7341e-01 +1.8628e-01 0.0000e+00
++3.2079e-01 +1.6398e-01 0.0000e+00
++3.6524e-01 +1.5294e-01 0.0000e+00
++4.1413e-01 +1.2483e-01 0.0000e+00
++4.5729e-01 +1.0628e-01 0.0000e+00
++5.0416e-01 +9.2993e-02 0.0000e+00
++5.5598e-01 +6.7143e-02 0.0000e+00
++5.9978e-01 +4.6554e-02 0.0000e+00
++6.5267e-01 +2.9835e-02 0.0000e+00
++6.9734e-01 +8.6245e-03 0.0000e+00
++7.4647e-01 -1.0715e-02 0.0000e+00
+-4.6120e-01 +5.5695e-01 0.0000e+00
+-4.1455e-01 +5.3695e-01 0.0000e+00
+-3.6581e-01 +5.1176e-01 0.0000e+00
+-3.1734e-01 +4.9238e-01 0.0000e+00
+-2.6959e-01 +4.7728e-01 0.0000e+00
+-2.2255e-01 +4.5316e-01 0.0000e+00
+-1.7939e-01 +4.3646e-01 0.0000e+00
+-1.2651e-01 +4.1211e-01 0.0000e+00
+-8.2873e-02 +3.9351e-01 0.0000e+00
+-3.5796e-02 +3.8006e-01 0.0000e+00
++9.0263e-03 +3.5092e-01 0.0000e+00
++5.4807e-02 +3.3656e-01 0.0000e+00
++9.8835e-02 +3.1317e-01 0.0000e+00
++1.5407e-01 +2.9144e-01 0.0000e+00
++2.0450e-01 +2.7829e-01 0.0000e+00
++2.4360e-01 +2.6215e-01 0.0000e+00
++2.9162e-01 +2.3661e-01 0.0000e+00
++3.3436e-01 +2.1556e-01 0.0000e+00
++3.8853e-01 +1.9817e-01 0.0000e+00
++4.3363e-01 +1.7171e-01 0.0000e+00
++4.7819e-01 +1.5831e-01 0.0000e+00
++5.2769e-01 +1.3440e-01 0.0000e+00
++5.7731e-01 +1.1417e-01 0.0000e+00
++6.1840e-01 +9.5071e-02 0.0000e+00
++6.7172e-01 +7.9036e-02 0.0000e+00
++7.1664e-01 +5.8875e-02 0.0000e+00
++7.5861e-01 +3.7107e-02 0.0000e+00
+-4.4098e-01 +6.0353e-01 0.0000e+00
+-3.9342e-01 +5.8244e-01 0.0000e+00
+-3.5150e-01 +5.5786e-01 0.0000e+00
+-2.9769e-01 +5.4416e-01 0.0000e+00
+-2.4850e-01 +5.1586e-01 0.0000e+00
+-2.1000e-01 +4.9920e-01 0.0000e+00
+-1.5846e-01 +4.8104e-01 0.0000e+00
+-1.0902e-01 +4.6224e-01 0.0000e+00
+-5.9556e-02 +4.4428e-01 0.0000e+00
+-1.6474e-02 +4.2611e-01 0.0000e+00
++3.2938e-02 +3.9760e-01 0.0000e+00
++7.8314e-02 +3.7787e-01 0.0000e+00
++1.2632e-01 +3.6167e-01 0.0000e+00
++1.7459e-01 +3.4151e-01 0.0000e+00
++2.1440e-01 +3.2268e-01 0.0000e+00
++2.6510e-01 +3.0404e-01 0.0000e+00
++3.1569e-01 +2.7699e-01 0.0000e+00
++3.5776e-01 +2.6070e-01 0.0000e+00
++4.0424e-01 +2.4772e-01 0.0000e+00
++4.5644e-01 +2.2620e-01 0.0000e+00
++4.9871e-01 +2.0237e-01 0.0000e+00
++5.4718e-01 +1.8433e-01 0.0000e+00
++5.9458e-01 +1.6347e-01 0.0000e+00
++6.4408e-01 +1.4260e-01 0.0000e+00
++6.9406e-01 +1.2682e-01 0.0000e+00
++7.3820e-01 +1.0271e-01 0.0000e+00
+-3.7439e-01 +6.2474e-01 0.0000e+00
+-3.2785e-01 +6.1018e-01 0.0000e+00
+-2.7383e-01 +5.8637e-01 0.0000e+00
+-2.3434e-01 +5.6868e-01 0.0000e+00
+-1.8478e-01 +5.5158e-01 0.0000e+00
+-1.3676e-01 +5.2711e-01 0.0000e+00
+-8.6080e-02 +5.1183e-01 0.0000e+00
+-4.6708e-02 +4.8554e-01 0.0000e+00
++3.0808e-03 +4.6571e-01 0.0000e+00
++5.0403e-02 +4.4444e-01 0.0000e+00
++9.8450e-02 +4.2461e-01 0.0000e+00
++1.4742e-01 +4.0365e-01 0.0000e+00
++1.8737e-01 +3.9088e-01 0.0000e+00
++2.3968e-01 +3.6793e-01 0.0000e+00
++2.8307e-01 +3.5069e-01 0.0000e+00
++3.3524e-01 +3.2810e-01 0.0000e+00
++3.7657e-01 +3.1164e-01 0.0000e+00
++4.2671e-01 +2.8972e-01 0.0000e+00
++4.7519e-01 +2.7477e-01 0.0000e+00
++5.1666e-01 +2.5378e-01 0.0000e+00
++5.6340e-01 +2.3302e-01 0.0000e+00
++6.1583e-01 +2.0829e-01 0.0000e+00
++6.5728e-01 +1.8978e-01 0.0000e+00
++7.0792e-01 +1.6927e-01 0.0000e+00
+-3.5505e-01 +6.7747e-01 0.0000e+00
+-3.0248e-01 +6.5740e-01 0.0000e+00
+-2.5776e-01 +6.3872e-01 0.0000e+00
+-2.1276e-01 +6.1954e-01 0.0000e+00
+-1.5970e-01 +5.9734e-01 0.0000e+00
+-1.2105e-01 +5.7540e-01 0.0000e+00
+-7.0962e-02 +5.5340e-01 0.0000e+00
+-2.7596e-02 +5.3693e-01 0.0000e+00
++1.8265e-02 +5.1463e-01 0.0000e+00
++7.2010e-02 +5.0093e-01 0.0000e+00
++1.1792e-01 +4.7451e-01 0.0000e+00
++1.6803e-01 +4.5514e-01 0.0000e+00
++2.0910e-01 +4.4127e-01 0.0000e+00
++2.5476e-01 +4.1781e-01 0.0000e+00
++3.0521e-01 +4.0203e-01 0.0000e+00
++3.5196e-01 +3.7799e-01 0.0000e+00
++3.9799e-01 +3.6053e-01 0.0000e+00
++4.4598e-01 +3.3482e-01 0.0000e+00
++4.8947e-01 +3.2074e-01 0.0000e+00
++5.4147e-01 +2.9561e-01 0.0000e+00
++5.9024e-01 +2.7230e-01 0.0000e+00
++6.3582e-01 +2.5945e-01 0.0000e+00
++6.7886e-01 +2.4041e-01 0.0000e+00
++7.3086e-01 +2.2090e-01 0.0000e+00
+-2.8431e-01 +7.0423e-01 0.0000e+00
+-2.3533e-01 +6.8290e-01 0.0000e+00
+-1.9034e-01 +6.6417e-01 0.0000e+00
+-1.4690e-01 +6.4359e-01 0.0000e+00
+-9.7539e-02 +6.2281e-01 0.0000e+00
+-5.5085e-02 +6.0074e-01 0.0000e+00
+-2.2953e-03 +5.7960e-01 0.0000e+00
++4.6664e-02 +5.5753e-01 0.0000e+00
++9.4559e-02 +5.4565e-01 0.0000e+00
++1.4002e-01 +5.2630e-01 0.0000e+00
++1.8945e-01 +5.0475e-01 0.0000e+00
++2.2773e-01 +4.8595e-01 0.0000e+00
++2.7975e-01 +4.6165e-01 0.0000e+00
++3.2933e-01 +4.4313e-01 0.0000e+00
++3.6975e-01 +4.3016e-01 0.0000e+00
++4.1636e-01 +4.0670e-01 0.0000e+00
++4.7199e-01 +3.8657e-01 0.0000e+00
++5.1827e-01 +3.6692e-01 0.0000e+00
++5.5714e-01 +3.4900e-01 0.0000e+00
++6.0765e-01 +3.2012e-01 0.0000e+00
++6.5585e-01 +3.0067e-01 0.0000e+00
++7.0106e-01 +2.8846e-01 0.0000e+00
+-2.1387e-01 +7.3205e-01 0.0000e+00
+-1.7581e-01 +7.1150e-01 0.0000e+00
+-1.2854e-01 +6.9046e-01 0.0000e+00
+-7.7397e-02 +6.7256e-01 0.0000e+00
+-3.2258e-02 +6.4782e-01 0.0000e+00
++2.0509e-02 +6.3325e-01 0.0000e+00
++6.9692e-02 +6.1236e-01 0.0000e+00
++1.0854e-01 +5.9433e-01 0.0000e+00
++1.5762e-01 +5.6490e-01 0.0000e+00
++2.0677e-01 +5.5071e-01 0.0000e+00
++2.5125e-01 +5.3327e-01 0.0000e+00
++3.0009e-01 +5.0599e-01 0.0000e+00
++3.4545e-01 +4.9064e-01 0.0000e+00
++3.8935e-01 +4.7539e-01 0.0000e+00
++4.4001e-01 +4.5028e-01 0.0000e+00
++4.8954e-01 +4.2950e-01 0.0000e+00
++5.3137e-01 +4.1788e-01 0.0000e+00
++5.7849e-01 +3.8942e-01 0.0000e+00
++6.2793e-01 +3.6660e-01 0.0000e+00
++6.7911e-01 +3.5207e-01 0.0000e+00
+-1.0793e-01 +7.3430e-01 0.0000e+00
+-5.6999e-02 +7.1969e-01 0.0000e+00
+-1.2290e-02 +6.9842e-01 0.0000e+00
++3.2538e-02 +6.7711e-01 0.0000e+00
++7.8575e-02 +6.5749e-01 0.0000e+00
++1.3032e-01 +6.3668e-01 0.0000e+00
++1.7069e-01 +6.1444e-01 0.0000e+00
++2.2748e-01 +5.9369e-01 0.0000e+00
++2.7339e-01 +5.7646e-01 0.0000e+00
++3.1998e-01 +5.5248e-01 0.0000e+00
++3.6829e-01 +5.3976e-01 0.0000e+00
++4.0976e-01 +5.2379e-01 0.0000e+00
++4.5997e-01 +4.9908e-01 0.0000e+00
++5.1025e-01 +4.8083e-01 0.0000e+00
++5.5800e-01 +4.5950e-01 0.0000e+00
++5.9809e-01 +4.3833e-01 0.0000e+00
++1.1796e-02 +7.4504e-01 0.0000e+00
++5.4332e-02 +7.2139e-01 0.0000e+00
++1.0372e-01 +7.0129e-01 0.0000e+00
++1.4939e-01 +6.7909e-01 0.0000e+00
++1.9453e-01 +6.6470e-01 0.0000e+00
++2.4852e-01 +6.4536e-01 0.0000e+00
++2.8794e-01 +6.2398e-01 0.0000e+00
++3.4387e-01 +6.0712e-01 0.0000e+00
++3.8757e-01 +5.8798e-01 0.0000e+00
++4.2764e-01 +5.6443e-01 0.0000e+00
++4.8337e-01 +5.4759e-01 0.0000e+00
++5.2794e-01 +5.2704e-01 0.0000e+00
++1.2112e-01 +7.5105e-01 0.0000e+00
++1.7059e-01 +7.3427e-01 0.0000e+00
++2.1879e-01 +7.1226e-01 0.0000e+00
++2.5963e-01 +6.9401e-01 0.0000e+00
++3.0975e-01 +6.7065e-01 0.0000e+00
++3.5954e-01 +6.4687e-01 0.0000e+00
++4.0551e-01 +6.3004e-01 0.0000e+00
++4.5149e-01 +6.1071e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-5.1492e-01 -5.6511e-01 0.0000e+00
+-4.6248e-01 -5.9115e-01 0.0000e+00
+-4.2107e-01 -6.2060e-01 0.0000e+00
+-3.7511e-01 -6.4085e-01 0.0000e+00
+-3.3895e-01 -6.6593e-01 0.0000e+00
+-2.8456e-01 -6.9411e-01 0.0000e+00
+-2.4176e-01 -7.1934e-01 0.0000e+00
+-1.9379e-01 -7.3903e-01 0.0000e+00
+-6.2360e-01 -4.4955e-01 0.0000e+00
+-5.7833e-01 -4.7823e-01 0.0000e+00
+-5.3202e-01 -5.0330e-01 0.0000e+00
+-4.8724e-01 -5.2685e-01 0.0000e+00
+-4.4310e-01 -5.4867e-01 0.0000e+00
+-4.0328e-01 -5.7346e-01 0.0000e+00
+-3.5656e-01 -5.9932e-01 0.0000e+00
+-3.1136e-01 -6.1827e-01 0.0000e+00
+-2.5919e-01 -6.4443e-01 0.0000e+00
+-2.2069e-01 -6.6502e-01 0.0000e+00
+-1.7318e-01 -6.9529e-01 0.0000e+00
+-1.2435e-01 -7.2174e-01 0.0000e+00
+-8.1330e-02 -7.4129e-01 0.0000e+00
+-6.5030e-01 -3.8141e-01 0.0000e+00
+-5.9791e-01 -4.0975e-01 0.0000e+00
+-5.5455e-01 -4.2371e-01 0.0000e+00
+-5.1120e-01 -4.5518e-01 0.0000e+00
+-4.6706e-01 -4.7720e-01 0.0000e+00
+-4.1631e-01 -5.0209e-01 0.0000e+00
+-3.7004e-01 -5.2808e-01 0.0000e+00
+-3.3169e-01 -5.5336e-01 0.0000e+00
+-2.8397e-01 -5.7740e-01 0.0000e+00
+-2.3464e-01 -5.9893e-01 0.0000e+00
+-1.9250e-01 -6.2649e-01 0.0000e+00
+-1.4881e-01 -6.5098e-01 0.0000e+00
+-1.0406e-01 -6.7154e-01 0.0000e+00
+-5.9340e-02 -6.9973e-01 0.0000e+00
+-1.0342e-02 -7.1809e-01 0.0000e+00
++3.1112e-02 -7.4779e-01 0.0000e+00
+-7.0907e-01 -2.8944e-01 0.0000e+00
+-6.6355e-01 -3.1337e-01 0.0000e+00
+-6.2330e-01 -3.3360e-01 0.0000e+00
+-5.7148e-01 -3.5475e-01 0.0000e+00
+-5.2833e-01 -3.7948e-01 0.0000e+00
+-4.8525e-01 -4.0642e-01 0.0000e+00
+-4.4204e-01 -4.3097e-01 0.0000e+00
+-3.9557e-01 -4.5950e-01 0.0000e+00
+-3.5098e-01 -4.8245e-01 0.0000e+00
+-3.0330e-01 -5.0098e-01 0.0000e+00
+-2.5748e-01 -5.2977e-01 0.0000e+00
+-2.1587e-01 -5.4807e-01 0.0000e+00
+-1.6812e-01 -5.7734e-01 0.0000e+00
+-1.2633e-01 -5.9928e-01 0.0000e+00
+-7.6857e-02 -6.2527e-01 0.0000e+00
+-3.5662e-02 -6.5747e-01 0.0000e+00
++1.3445e-02 -6.8041e-01 0.0000e+00
++6.1191e-02 -6.9992e-01 0.0000e+00
++9.7961e-02 -7.2606e-01 0.0000e+00
++1.4270e-01 -7.5117e-01 0.0000e+00
+-7.2757e-01 -2.1257e-01 0.0000e+00
+-6.8490e-01 -2.4304e-01 0.0000e+00
+-6.3748e-01 -2.6038e-01 0.0000e+00
+-5.9514e-01 -2.8439e-01 0.0000e+00
+-5.4711e-01 -3.1117e-01 0.0000e+00
+-5.0589e-01 -3.4192e-01 0.0000e+00
+-4.5729e-01 -3.6768e-01 0.0000e+00
+-4.1705e-01 -3.8735e-01 0.0000e+00
+-3.7316e-01 -4.1533e-01 0.0000e+00
+-3.2687e-01 -4.3023e-01 0.0000e+00
+-2.7697e-01 -4.6244e-01 0.0000e+00
+-2.3273e-01 -4.9094e-01 0.0000e+00
+-1.8902e-01 -5.1399e-01 0.0000e+00
+-1.4437e-01 -5.3711e-01 0.0000e+00
+-9.5284e-02 -5.6097e-01 0.0000e+00
+-5.1707e-02 -5.8429e-01 0.0000e+00
+-7.5077e-03 -6.1031e-01 0.0000e+00
++3.2866e-02 -6.3222e-01 0.0000e+00
++7.9484e-02 -6.5791e-01 0.0000e+00
++1.2189e-01 -6.8061e-01 0.0000e+00
++1.7315e-01 -7.0810e-01 0.0000e+00
++2.1544e-01 -7.3406e-01 0.0000e+00
+-7.5161e-01 -1.4503e-01 0.0000e+00
+-7.0799e-01 -1.6566e-01 0.0000e+00
+-6.6324e-01 -1.9766e-01 0.0000e+00
+-6.1258e-01 -2.2111e-01 0.0000e+00
+-5.6491e-01 -2.4336e-01 0.0000e+00
+-5.2193e-01 -2.7094e-01 0.0000e+00
+-4.8530e-01 -2.9318e-01 0.0000e+00
+-4.3526e-01 -3.2215e-01 0.0000e+00
+-3.9395e-01 -3.4507e-01 0.0000e+00
+-3.4045e-01 -3.6482e-01 0.0000e+00
+-3.0034e-01 -3.9419e-01 0.0000e+00
+-2.5275e-01 -4.1591e-01 0.0000e+00
+-2.1281e-01 -4.4425e-01 0.0000e+00
+-1.6301e-01 -4.6284e-01 0.0000e+00
+-1.2153e-01 -4.9348e-01 0.0000e+00
+-7.5092e-02 -5.1457e-01 0.0000e+00
+-3.2338e-02 -5.3709e-01 0.0000e+00
++1.3545e-02 -5.5987e-01 0.0000e+00
++6.0752e-02 -5.9216e-01 0.0000e+00
++1.0474e-01 -6.1594e-01 0.0000e+00
++1.5586e-01 -6.3410e-01 0.0000e+00
++1.9134e-01 -6.5669e-01 0.0000e+00
++2.4518e-01 -6.8334e-01 0.0000e+00
++2.8842e-01 -7.1051e-01 0.0000e+00
+-7.2940e-01 -1.0403e-01 0.0000e+00
+-6.8337e-01 -1.2283e-01 0.0000e+00
+-6.3673e-01 -1.4980e-01 0.0000e+00
+-5.8971e-01 -1.7927e-01 0.0000e+00
+-5.4756e-01 -1.9381e-01 0.0000e+00
+-4.9929e-01 -2.2261e-01 0.0000e+00
+-4.5646e-01 -2.4317e-01 0.0000e+00
+-4.0651e-01 -2.7045e-01 0.0000e+00
+-3.6421e-01 -2.9355e-01 0.0000e+00
+-3.2674e-01 -3.2201e-01 0.0000e+00
+-2.7924e-01 -3.4910e-01 0.0000e+00
+-2.2817e-01 -3.7334e-01 0.0000e+00
+-1.8680e-01 -3.9714e-01 0.0000e+00
+-1.3768e-01 -4.2225e-01 0.0000e+00
+-9.7876e-02 -4.3753e-01 0.0000e+00
+-5.2435e-02 -4.6432e-01 0.0000e+00
+-6.6181e-03 -4.9313e-01 0.0000e+00
++3.3794e-02 -5.1978e-01 0.0000e+00
++8.3530e-02 -5.3803e-01 0.0000e+00
++1.3392e-01 -5.6530e-01 0.0000e+00
++1.7175e-01 -5.8768e-01 0.0000e+00
++2.2344e-01 -6.1747e-01 0.0000e+00
++2.5939e-01 -6.4294e-01 0.0000e+00
++3.0644e-01 -6.6168e-01 0.0000e+00
+-7.4837e-01 -3.2283e-02 0.0000e+00
+-7.0247e-01 -5.7295e-02 0.0000e+00
+-6.5333e-01 -7.8257e-02 0.0000e+00
+-6.1305e-01 -1.0227e-01 0.0000e+00
+-5.7098e-01 -1.2748e-01 0.0000e+00
+-5.2375e-01 -1.5527e-01 0.0000e+00
+-4.7379e-01 -1.8279e-01 0.0000e+00
+-4.3518e-01 -2.0153e-01 0.0000e+00
+-3.8508e-01 -2.2553e-01 0.0000e+00
+-3.4077e-01 -2.5394e-01 0.0000e+00
+-2.9546e-01 -2.7725e-01 0.0000e+00
+-2.4978e-01 -2.9843e-01 0.0000e+00
+-2.0527e-01 -3.2263e-01 0.0000e+00
+-1.6775e-01 -3.5142e-01 0.0000e+00
+-1.1419e-01 -3.7193e-01 0.0000e+00
+-7.3516e-02 -3.9647e-01 0.0000e+00
+-2.4812e-02 -4.1896e-01 0.0000e+00
++1.3277e-02 -4.4983e-01 0.0000e+00
++6.1867e-02 -4.7040e-01 0.0000e+00
++1.1321e-01 -4.9400e-01 0.0000e+00
++1.5504e-01 -5.2324e-01 0.0000e+00
++1.9509e-01 -5.4764e-01 0.0000e+00
++2.4001e-01 -5.7382e-01 0.0000e+00
++2.8899e-01 -5.9077e-01 0.0000e+00
++3.2888e-01 -6.2104e-01 0.0000e+00
++3.8292e-01 -6.4401e-01 0.0000e+00
+-7.6426e-01 +3.2668e-02 0.0000e+00
+-7.1748e-01 +1.3962e-02 0.0000e+00
+-6.7213e-01 -1.1410e-02 0.0000e+00
+-6.3154e-01 -4.0917e-02 0.0000e+00
+-5.8475e-01 -5.6707e-02 0.0000e+00
+-5.4470e-01 -8.0056e-02 0.0000e+00
+-4.9542e-01 -1.1133e-01 0.0000e+00
+-4.5245e-01 -1.2781e-01 0.0000e+00
+-4.0968e-01 -1.5306e-01 0.0000e+00
+-3.6101e-01 -1.8697e-01 0.0000e+00
+-3.1574e-01 -2.1318e-01 0.0000e+00
+-2.7228e-01 -2.2625e-01 0.0000e+00
+-2.2734e-01 -2.5817e-01 0.0000e+00
+-1.8100e-01 -2.8025e-01 0.0000e+00
+-1.3106e-01 -3.0236e-01 0.0000e+00
+-9.2320e-02 -3.2430e-01 0.0000e+00
+-4.6498e-02 -3.4894e-01 0.0000e+00
+-1.4665e-03 -3.7779e-01 0.0000e+00
++4.4038e-02 -4.0683e-01 0.0000e+00
++8.5989e-02 -4.3042e-01 0.0000e+00
++1.3227e-01 -4.5363e-01 0.0000e+00
++1.8122e-01 -4.7452e-01 0.0000e+00
++2.2217e-01 -5.0154e-01 0.0000e+00
++2.6595e-01 -5.2910e-01 0.0000e+00
++3.1234e-01 -5.5113e-01 0.0000e+00
++3.5694e-01 -5.7339e-01 0.0000e+00
++4.0673e-01 -6.0052e-01 0.0000e+00
+-7.3603e-01 +8.5250e-02 0.0000e+00
+-7.0065e-01 +5.4858e-02 0.0000e+00
+-6.5752e-01 +3.2980e-02 0.0000e+00
+-6.1324e-01 +8.8600e-03 0.0000e+00
+-5.6363e-01 -1.9483e-02 0.0000e+00
+-5.1927e-01 -4.2029e-02 0.0000e+00
+-4.7090e-01 -6.9769e-02 0.0000e+00
+-4.2810e-01 -8.3091e-02 0.0000e+00
+-3.8189e-01 -1.1651e-01 0.0000e+00
+-3.3564e-01 -1.3853e-01 0.0000e+00
+-2.9684e-01 -1.6025e-01 0.0000e+00
+-2.4751e-01 -1.8710e-01 0.0000e+00
+-2.0482e-01 -2.0781e-01 0.0000e+00
+-1.5904e-01 -2.3162e-01 0.0000e+00
+-1.0923e-01 -2.6034e-01 0.0000e+00
+-6.6651e-02 -2.8376e-01 0.0000e+00
+-2.2051e-02 -3.0454e-01 0.0000e+00
++2.8612e-02 -3.3131e-01 0.0000e+00
++6.9233e-02 -3.5828e-01 0.0000e+00
++1.1224e-01 -3.8179e-01 0.0000e+00
++1.5370e-01 -4.0508e-01 0.0000e+00
++2.0153e-01 -4.3072e-01 0.0000e+00
++2.4773e-01 -4.5650e-01 0.0000e+00
++2.9951e-01 -4.7861e-01 0.0000e+00
++3.3929e-01 -5.0750e-01 0.0000e+00
++3.8341e-01 -5.2732e-01 0.0000e+00
++4.2977e-01 -5.5694e-01 0.0000e+00
++4.7345e-01 -5.7793e-01 0.0000e+00
+-7.1884e-01 +1.2617e-01 0.0000e+00
+-6.7627e-01 +1.0629e-01 0.0000e+00
+-6.2729e-01 +7.8284e-02 0.0000e+00
+-5.8379e-01 +5.0350e-02 0.0000e+00
+-5.3237e-01 +3.0329e-02 0.0000e+00
+-4.9311e-01 +7.4279e-03 0.0000e+00
+-4.5332e-01 -2.1422e-02 0.0000e+00
+-4.0387e-01 -4.6529e-02 0.0000e+00
+-3.5552e-01 -6.4941e-02 0.0000e+00
+-3.1139e-01 -9.4595e-02 0.0000e+00
+-2.7176e-01 -1.1756e-01 0.0000e+00
+-2.2293e-01 -1.4700e-01 0.0000e+00
+-1.7163e-01 -1.6489e-01 0.0000e+00
+-1.3671e-01 -1.8821e-01 0.0000e+00
+-8.2778e-02 -2.1327e-01 0.0000e+00
+-4.2251e-02 -2.4431e-01 0.0000e+00
+-4.9804e-04 -2.6120e-01 0.0000e+00
++4.4897e-02 -2.9250e-01 0.0000e+00
++9.3353e-02 -3.1352e-01 0.0000e+00
++1.3722e-01 -3.4124e-01 0.0000e+00
++1.8050e-01 -3.5577e-01 0.0000e+00
++2.2393e-01 -3.8997e-01 0.0000e+00
++2.7742e-01 -4.1184e-01 0.0000e+00
++3.1321e-01 -4.3725e-01 0.0000e+00
++3.6485e-01 -4.5621e-01 0.0000e+00
++4.1249e-01 -4.8210e-01 0.0000e+00
++4.4993e-01 -5.0835e-01 0.0000e+00
++4.9936e-01 -5.3299e-01 0.0000e+00
+-7.4186e-01 +2.0067e-01 0.0000e+00
+-6.9111e-01 +1.7212e-01 0.0000e+00
+-6.4967e-01 +1.5423e-01 0.0000e+00
+-5.9841e-01 +1.2522e-01 0.0000e+00
+-5.5973e-01 +1.0157e-01 0.0000e+00
+-5.0853e-01 +7.8167e-02 0.0000e+00
+-4.6935e-01 +5.4462e-02 0.0000e+00
+-4.2537e-01 +2.1533e-02 0.0000e+00
+-3.7797e-01 -1.2205e-03 0.0000e+00
+-3.3069e-01 -2.3778e-02 0.0000e+00
+-2.8708e-01 -4.8967e-02 0.0000e+00
+-2.4517e-01 -7.1691e-02 0.0000e+00
+-1.9922e-01 -9.6370e-02 0.0000e+00
+-1.5638e-01 -1.1956e-01 0.0000e+00
+-1.0276e-01 -1.4565e-01 0.0000e+00
+-6.8326e-02 -1.7211e-01 0.0000e+00
+-2.0676e-02 -1.9846e-01 0.0000e+00
++2.7456e-02 -2.1848e-01 0.0000e+00
++7.2055e-02 -2.4759e-01 0.0000e+00
++1.1524e-01 -2.6606e-01 0.0000e+00
++1.6294e-01 -2.9577e-01 0.0000e+00
++2.0367e-01 -3.1503e-01 0.0000e+00
++2.5066e-01 -3.4313e-01 0.0000e+00
++3.0087e-01 -3.6590e-01 0.0000e+00
++3.4228e-01 -3.8772e-01 0.0000e+00
++3.8618e-01 -4.1890e-01 0.0000e+00
++4.3020e-01 -4.3836e-01 0.0000e+00
++4.7784e-01 -4.6388e-01 0.0000e+00
++5.2131e-01 -4.9155e-01 0.0000e+00
++5.6398e-01 -5.1416e-01 0.0000e+00
+-7.1291e-01 +2.4579e-01 0.0000e+00
+-6.6927e-01 +2.2046e-01 0.0000e+00
+-6.2552e-01 +1.9357e-01 0.0000e+00
+-5.8181e-01 +1.7229e-01 0.0000e+00
+-5.3705e-01 +1.4486e-01 0.0000e+00
+-4.8343e-01 +1.2285e-01 0.0000e+00
+-4.4196e-01 +9.2504e-02 0.0000e+00
+-3.9956e-01 +7.4719e-02 0.0000e+00
+-3.5732e-01 +5.0324e-02 0.0000e+00
+-3.0600e-01 +2.0473e-02 0.0000e+00
+-2.6331e-01 -5.4312e-03 0.0000e+00
+-2.2045e-01 -2.8186e-02 0.0000e+00
+-1.7684e-01 -4.9697e-02 0.0000e+00
+-1.2310e-01 -7.3332e-02 0.0000e+00
+-8.2325e-02 -9.7779e-02 0.0000e+00
+-3.3601e-02 -1.2378e-01 0.0000e+00
++3.7998e-03 -1.4884e-01 0.0000e+00
++4.7647e-02 -1.7623e-01 0.0000e+00
++9.5577e-02 -1.9934e-01 0.0000e+00
++1.4208e-01 -2.2387e-01 0.0000e+00
++1.8175e-01 -2.4881e-01 0.0000e+00
++2.3125e-01 -2.7423e-01 0.0000e+00
++2.7441e-01 -3.0078e-01 0.0000e+00
++3.2314e-01 -3.2155e-01 0.0000e+00
++3.6034e-01 -3.4635e-01 0.0000e+00
++4.0926e-01 -3.6324e-01 0.0000e+00
++4.5522e-01 -3.9621e-01 0.0000e+00
++4.9802e-01 -4.2026e-01 0.0000e+00
++5.4799e-01 -4.4566e-01 0.0000e+00
++5.9459e-01 -4.6474e-01 0.0000e+00
+-6.8781e-01 +2.8207e-01 0.0000e+00
+-6.4043e-01 +2.6143e-01 0.0000e+00
+-5.9712e-01 +2.4314e-01 0.0000e+00
+-5.6088e-01 +2.1221e-01 0.0000e+00
+-5.1364e-01 +1.9089e-01 0.0000e+00
+-4.6656e-01 +1.7108e-01 0.0000e+00
+-4.2082e-01 +1.4051e-01 0.0000e+00
+-3.6936e-01 +1.1582e-01 0.0000e+00
+-3.2813e-01 +9.4721e-02 0.0000e+00
+-2.8164e-01 +6.6415e-02 0.0000e+00
+-2.3839e-01 +4.7351e-02 0.0000e+00
+-1.9129e-01 +1.9479e-02 0.0000e+00
+-1.5443e-01 -9.2331e-03 0.0000e+00
+-1.0233e-01 -2.9691e-02 0.0000e+00
+-5.6974e-02 -5.6448e-02 0.0000e+00
+-1.2068e-02 -7.8644e-02 0.0000e+00
++2.9168e-02 -1.0503e-01 0.0000e+00
++7.7769e-02 -1.2998e-01 0.0000e+00
++1.2391e-01 -1.5587e-01 0.0000e+00
++1.7053e-01 -1.7687e-01 0.0000e+00
++2.1017e-01 -2.0140e-01 0.0000e+00
++2.6212e-01 -2.2487e-01 0.0000e+00
++3.0191e-01 -2.5665e-01 0.0000e+00
++3.4483e-01 -2.7955e-01 0.0000e+00
++3.9010e-01 -2.9564e-01 0.0000e+00
++4.3210e-01 -3.2653e-01 0.0000e+00
++4.7605e-01 -3.4925e-01 0.0000e+00
++5.2119e-01 -3.7299e-01 0.0000e+00
++5.6934e-01 -4.0113e-01 0.0000e+00
++6.1729e-01 -4.1792e-01 0.0000e+00
+-6.6605e-01 +3.3417e-01 0.0000e+00
+-6.2298e-01 +3.0789e-01 0.0000e+00
+-5.7643e-01 +2.8773e-01 0.0000e+00
+-5.3212e-01 +2.6416e-01 0.0000e+00
+-4.8390e-01 +2.3305e-01 0.0000e+00
+-4.3847e-01 +2.1354e-01 0.0000e+00
+-3.9158e-01 +1.8442e-01 0.0000e+00
+-3.4886e-01 +1.6452e-01 0.0000e+00
+-3.0787e-01 +1.3480e-01 0.0000e+00
+-2.5821e-01 +1.1641e-01 0.0000e+00
+-2.1341e-01 +8.5791e-02 0.0000e+00
+-1.7520e-01 +6.3398e-02 0.0000e+00
+-1.1929e-01 +4.0605e-02 0.0000e+00
+-7.4787e-02 +1.7229e-02 0.0000e+00
+-3.4128e-02 -1.5045e-02 0.0000e+00
++5.9184e-03 -3.6224e-02 0.0000e+00
++5.6689e-02 -6.2245e-02 0.0000e+00
++9.6286e-02 -8.4581e-02 0.0000e+00
++1.4623e-01 -1.1324e-01 0.0000e+00
++1.9335e-01 -1.3332e-01 0.0000e+00
++2.3827e-01 -1.5927e-01 0.0000e+00
++2.8020e-01 -1.7659e-01 0.0000e+00
++3.2525e-01 -2.0978e-01 0.0000e+00
++3.7128e-01 -2.2736e-01 0.0000e+00
++4.1998e-01 -2.5653e-01 0.0000e+00
++4.5772e-01 -2.7624e-01 0.0000e+00
++5.0469e-01 -3.0184e-01 0.0000e+00
++5.5275e-01 -3.3160e-01 0.0000e+00
++5.9508e-01 -3.5291e-01 0.0000e+00
++6.3661e-01 -3.7655e-01 0.0000e+00
+-6.3679e-01 +3.7620e-01 0.0000e+00
+-5.9377e-01 +3.5739e-01 0.0000e+00
+-5.4867e-01 +3.2812e-01 0.0000e+00
+-5.0719e-01 +3.0758e-01 0.0000e+00
+-4.5926e-01 +2.8158e-01 0.0000e+00
+-4.1380e-01 +2.5173e-01 0.0000e+00
+-3.6993e-01 +2.2849e-01 0.0000e+00
+-3.2843e-01 +2.0215e-01 0.0000e+00
+-2.8019e-01 +1.7802e-01 0.0000e+00
+-2.3803e-01 +1.5638e-01 0.0000e+00
+-1.9172e-01 +1.3025e-01 0.0000e+00
+-1.4414e-01 +1.1030e-01 0.0000e+00
+-1.0111e-01 +8.8439e-02 0.0000e+00
+-5.3182e-02 +5.5389e-02 0.0000e+00
+-9.8927e-03 +3.7877e-02 0.0000e+00
++3.7068e-02 +5.3922e-03 0.0000e+00
++7.8098e-02 -9.4598e-03 0.0000e+00
++1.2690e-01 -3.6650e-02 0.0000e+00
++1.6553e-01 -6.6297e-02 0.0000e+00
++2.1603e-01 -9.1399e-02 0.0000e+00
++2.6332e-01 -1.1485e-01 0.0000e+00
++3.0240e-01 -1.3491e-01 0.0000e+00
++3.4615e-01 -1.6209e-01 0.0000e+00
++4.0018e-01 -1.8543e-01 0.0000e+00
++4.4067e-01 -2.0595e-01 0.0000e+00
++4.8585e-01 -2.3262e-01 0.0000e+00
++5.3403e-01 -2.5580e-01 0.0000e+00
++5.7203e-01 -2.8590e-01 0.0000e+00
++6.2511e-01 -3.0880e-01 0.0000e+00
++6.6290e-01 -3.3499e-01 0.0000e+00
+-6.1347e-01 +4.2140e-01 0.0000e+00
+-5.7457e-01 +4.0089e-01 0.0000e+00
+-5.2374e-01 +3.7829e-01 0.0000e+00
+-4.7840e-01 +3.4598e-01 0.0000e+00
+-4.3422e-01 +3.2868e-01 0.0000e+00
+-3.9159e-01 +2.9826e-01 0.0000e+00
+-3.4770e-01 +2.7381e-01 0.0000e+00
+-2.9758e-01 +2.4792e-01 0.0000e+00
+-2.5642e-01 +2.3278e-01 0.0000e+00
+-2.1115e-01 +1.9679e-01 0.0000e+00
+-1.7123e-01 +1.7681e-01 0.0000e+00
+-1.1964e-01 +1.5163e-01 0.0000e+00
+-7.6234e-02 +1.3285e-01 0.0000e+00
+-3.2511e-02 +1.0181e-01 0.0000e+00
++1.6455e-02 +8.3109e-02 0.0000e+00
++5.6618e-02 +5.6731e-02 0.0000e+00
++1.0878e-01 +2.8585e-02 0.0000e+00
++1.4968e-01 +4.1469e-03 0.0000e+00
++1.9896e-01 -1.6049e-02 0.0000e+00
++2.3976e-01 -3.9632e-02 0.0000e+00
++2.8196e-01 -7.0103e-02 0.0000e+00
++3.2576e-01 -9.1243e-02 0.0000e+00
++3.7475e-01 -1.1503e-01 0.0000e+00
++4.1699e-01 -1.4513e-01 0.0000e+00
++4.6661e-01 -1.6173e-01 0.0000e+00
++5.0671e-01 -1.8856e-01 0.0000e+00
++5.5283e-01 -2.1611e-01 0.0000e+00
++6.0131e-01 -2.3393e-01 0.0000e+00
++6.4613e-01 -2.6426e-01 0.0000e+00
++6.8636e-01 -2.9130e-01 0.0000e+00
+-5.9263e-01 +4.6731e-01 0.0000e+00
+-5.4829e-01 +4.4361e-01 0.0000e+00
+-5.0321e-01 +4.2088e-01 0.0000e+00
+-4.5341e-01 +3.9784e-01 0.0000e+00
+-4.1574e-01 +3.6979e-01 0.0000e+00
+-3.7210e-01 +3.4320e-01 0.0000e+00
+-3.2320e-01 +3.1775e-01 0.0000e+00
+-2.7912e-01 +2.9643e-01 0.0000e+00
+-2.3034e-01 +2.6551e-01 0.0000e+00
+-1.8188e-01 +2.4917e-01 0.0000e+00
+-1.4779e-01 +2.2167e-01 0.0000e+00
+-1.0135e-01 +1.9736e-01 0.0000e+00
+-5.6661e-02 +1.7342e-01 0.0000e+00
+-4.3315e-03 +1.5302e-01 0.0000e+00
++4.0025e-02 +1.2237e-01 0.0000e+00
++8.7199e-02 +9.7567e-02 0.0000e+00
++1.2567e-01 +7.5340e-02 0.0000e+00
++1.7525e-01 +5.0607e-02 0.0000e+00
++2.1753e-01 +2.9082e-02 0.0000e+00
++2.6121e-01 +4.9202e-04 0.0000e+00
++3.1185e-01 -2.5109e-02 0.0000e+00
++3.5422e-01 -4.7430e-02 0.0000e+00
++3.9721e-01 -6.7698e-02 0.0000e+00
++4.4127e-01 -9.8613e-02 0.0000e+00
++4.8792e-01 -1.2080e-01 0.0000e+00
++5.2876e-01 -1.4606e-01 0.0000e+00
++5.8185e-01 -1.7038e-01 0.0000e+00
++6.2766e-01 -1.9555e-01 0.0000e+00
++6.7257e-01 -2.1996e-01 0.0000e+00
++7.1615e-01 -2.4819e-01 0.0000e+00
+-5.6119e-01 +5.1425e-01 0.0000e+00
+-5.2407e-01 +4.8549e-01 0.0000e+00
+-4.8085e-01 +4.6332e-01 0.0000e+00
+-4.3296e-01 +4.3897e-01 0.0000e+00
+-3.8481e-01 +4.1542e-01 0.0000e+00
+-3.4604e-01 +3.9043e-01 0.0000e+00
+-2.9652e-01 +3.7127e-01 0.0000e+00
+-2.5626e-01 +3.3924e-01 0.0000e+00
+-2.0747e-01 +3.1211e-01 0.0000e+00
+-1.6678e-01 +2.9296e-01 0.0000e+00
+-1.1571e-01 +2.6443e-01 0.0000e+00
+-7.6442e-02 +2.4217e-01 0.0000e+00
+-3.1911e-02 +2.1744e-01 0.0000e+00
++1.8384e-02 +1.9119e-01 0.0000e+00
++6.7625e-02 +1.6747e-01 0.0000e+00
++1.1351e-01 +1.4693e-01 0.0000e+00
++1.5540e-01 +1.1959e-01 0.0000e+00
++1.9442e-01 +9.6779e-02 0.0000e+00
++2.3995e-01 +7.1642e-02 0.0000e+00
++2.8416e-01 +4.9489e-02 0.0000e+00
++3.3386e-01 +2.1587e-02 0.0000e+00
++3.7998e-01 +2.2044e-03 0.0000e+00
++4.2471e-01 -2.1429e-02 0.0000e+00
++4.6546e-01 -5.0424e-02 0.0000e+00
++5.1249e-01 -7.0589e-02 0.0000e+00
++5.5478e-01 -1.0114e-01 0.0000e+00
++6.0631e-01 -1.2105e-01 0.0000e+00
++6.4811e-01 -1.5233e-01 0.0000e+00
++6.9361e-01 -1.7578e-01 0.0000e+00
++7.3827e-01 -1.9263e-01 0.0000e+00
+-4.9832e-01 +5.3269e-01 0.0000e+00
+-4.5603e-01 +5.0730e-01 0.0000e+00
+-4.0787e-01 +4.8033e-01 0.0000e+00
+-3.6614e-01 +4.5771e-01 0.0000e+00
+-3.1818e-01 +4.4006e-01 0.0000e+00
+-2.7038e-01 +4.0583e-01 0.0000e+00
+-2.2527e-01 +3.8487e-01 0.0000e+00
+-1.8121e-01 +3.6326e-01 0.0000e+00
+-1.3616e-01 +3.3558e-01 0.0000e+00
+-9.3603e-02 +3.0791e-01 0.0000e+00
+-5.1623e-02 +2.8942e-01 0.0000e+00
++3.8340e-03 +2.6501e-01 0.0000e+00
++3.9874e-02 +2.3790e-01 0.0000e+00
++8.5601e-02 +2.1403e-01 0.0000e+00
++1.3372e-01 +1.9258e-01 0.0000e+00
++1.7214e-01 +1.6335e-01 0.0000e+00
++2.1977e-01 +1.4359e-01 0.0000e+00
++2.6445e-01 +1.1847e-01 0.0000e+00
++3.1802e-01 +9.2560e-02 0.0000e+00
++3.5876e-01 +6.9524e-02 0.0000e+00
++3.9896e-01 +4.1664e-02 0.0000e+00
++4.4688e-01 +2.4208e-02 0.0000e+00
++4.9484e-01 -3.4380e-03 0.0000e+00
++5.3577e-01 -3.3399e-02 0.0000e+00
++5.8086e-01 -5.7157e-02 0.0000e+00
++6.3378e-01 -7.6835e-02 0.0000e+00
++6.7232e-01 -1.0406e-01 0.0000e+00
++7.1402e-01 -1.2759e-01 0.0000e+00
+-4.7736e-01 +5.8021e-01 0.0000e+00
+-4.2963e-01 +5.5716e-01 0.0000e+00
+-3.8021e-01 +5.3238e-01 0.0000e+00
+-3.3797e-01 +5.0267e-01 0.0000e+00
+-2.9759e-01 +4.8260e-01 0.0000e+00
+-2.5067e-01 +4.5781e-01 0.0000e+00
+-2.0709e-01 +4.3431e-01 0.0000e+00
+-1.6399e-01 +4.0470e-01 0.0000e+00
+-1.1599e-01 +3.8514e-01 0.0000e+00
+-6.8107e-02 +3.5913e-01 0.0000e+00
+-2.5947e-02 +3.3816e-01 0.0000e+00
++2.0401e-02 +3.1320e-01 0.0000e+00
++6.7547e-02 +2.8553e-01 0.0000e+00
++1.1457e-01 +2.5465e-01 0.0000e+00
++1.5646e-01 +2.3953e-01 0.0000e+00
++2.0313e-01 +2.0562e-01 0.0000e+00
++2.4494e-01 +1.8356e-01 0.0000e+00
++2.9203e-01 +1.5893e-01 0.0000e+00
++3.3719e-01 +1.3190e-01 0.0000e+00
++3.8054e-01 +1.1642e-01 0.0000e+00
++4.2661e-01 +8.3418e-02 0.0000e+00
++4.6792e-01 +6.0554e-02 0.0000e+00
++5.1346e-01 +4.2576e-02 0.0000e+00
++5.6270e-01 +1.1544e-02 0.0000e+00
++6.0444e-01 -1.3425e-02 0.0000e+00
++6.5565e-01 -3.5431e-02 0.0000e+00
++6.9820e-01 -6.1110e-02 0.0000e+00
++7.4540e-01 -8.5362e-02 0.0000e+00
+-4.0550e-01 +6.0307e-01 0.0000e+00
+-3.6086e-01 +5.7841e-01 0.0000e+00
+-3.1463e-01 +5.4834e-01 0.0000e+00
+-2.6810e-01 +5.2412e-01 0.0000e+00
+-2.2186e-01 +5.0424e-01 0.0000e+00
+-1.7723e-01 +4.7541e-01 0.0000e+00
+-1.3574e-01 +4.5440e-01 0.0000e+00
+-8.5303e-02 +4.2476e-01 0.0000e+00
+-4.3522e-02 +4.0180e-01 0.0000e+00
++2.2098e-03 +3.8364e-01 0.0000e+00
++4.4119e-02 +3.5002e-01 0.0000e+00
++8.8463e-02 +3.3108e-01 0.0000e+00
++1.3015e-01 +3.0328e-01 0.0000e+00
++1.8322e-01 +2.7603e-01 0.0000e+00
++2.3233e-01 +2.5784e-01 0.0000e+00
++2.6981e-01 +2.3780e-01 0.0000e+00
++3.1529e-01 +2.0745e-01 0.0000e+00
++3.5592e-01 +1.8213e-01 0.0000e+00
++4.0834e-01 +1.5932e-01 0.0000e+00
++4.5080e-01 +1.2834e-01 0.0000e+00
++4.9402e-01 +1.1049e-01 0.0000e+00
++5.4113e-01 +8.1629e-02 0.0000e+00
++5.8873e-01 +5.6437e-02 0.0000e+00
++6.2791e-01 +3.3231e-02 0.0000e+00
++6.7962e-01 +1.1864e-02 0.0000e+00
++7.2252e-01 -1.2788e-02 0.0000e+00
++7.6232e-01 -3.8754e-02 0.0000e+00
+-3.8063e-01 +6.4763e-01 0.0000e+00
+-3.3518e-01 +6.2178e-01 0.0000e+00
+-2.9571e-01 +5.9301e-01 0.0000e+00
+-2.4327e-01 +5.7393e-01 0.0000e+00
+-1.9691e-01 +5.4071e-01 0.0000e+00
+-1.6008e-01 +5.2020e-01 0.0000e+00
+-1.1035e-01 +4.9688e-01 0.0000e+00
+-6.2794e-02 +4.7314e-01 0.0000e+00
+-1.5127e-02 +4.5024e-01 0.0000e+00
++2.6137e-02 +4.2776e-01 0.0000e+00
++7.2698e-02 +3.9431e-01 0.0000e+00
++1.1610e-01 +3.7004e-01 0.0000e+00
++1.6248e-01 +3.4904e-01 0.0000e+00
++2.0874e-01 +3.2405e-01 0.0000e+00
++2.4667e-01 +3.0124e-01 0.0000e+00
++2.9550e-01 +2.7753e-01 0.0000e+00
++3.4339e-01 +2.4542e-01 0.0000e+00
++3.8383e-01 +2.2492e-01 0.0000e+00
++4.2901e-01 +2.0729e-01 0.0000e+00
++4.7906e-01 +1.8055e-01 0.0000e+00
++5.1895e-01 +1.5250e-01 0.0000e+00
++5.6561e-01 +1.2961e-01 0.0000e+00
++6.1092e-01 +1.0402e-01 0.0000e+00
++6.5834e-01 +7.8194e-02 0.0000e+00
++7.0674e-01 +5.7415e-02 0.0000e+00
++7.4847e-01 +2.8889e-02 0.0000e+00
+-3.1192e-01 +6.6218e-01 0.0000e+00
+-2.6684e-01 +6.4296e-01 0.0000e+00
+-2.1519e-01 +6.1375e-01 0.0000e+00
+-1.7748e-01 +5.9211e-01 0.0000e+00
+-1.2963e-01 +5.7006e-01 0.0000e+00
+-8.4049e-02 +5.4079e-01 0.0000e+00
+-3.4897e-02 +5.2044e-01 0.0000e+00
++1.8455e-03 +4.9021e-01 0.0000e+00
++4.9652e-02 +4.6540e-01 0.0000e+00
++9.4847e-02 +4.3940e-01 0.0000e+00
++1.4091e-01 +4.1476e-01 0.0000e+00
++1.8778e-01 +3.8890e-01 0.0000e+00
++2.2646e-01 +3.7215e-01 0.0000e+00
++2.7648e-01 +3.4396e-01 0.0000e+00
++3.1814e-01 +3.2239e-01 0.0000e+00
++3.6805e-01 +2.9458e-01 0.0000e+00
++4.0773e-01 +2.7399e-01 0.0000e+00
++4.5568e-01 +2.4705e-01 0.0000e+00
++5.0267e-01 +2.2725e-01 0.0000e+00
++5.4204e-01 +2.0211e-01 0.0000e+00
++5.8671e-01 +1.7668e-01 0.0000e+00
++6.3666e-01 +1.4671e-01 0.0000e+00
++6.7626e-01 +1.2406e-01 0.0000e+00
++7.2485e-01 +9.8480e-02 0.0000e+00
+-2.8731e-01 +7.1297e-01 0.0000e+00
+-2.3674e-01 +6.8765e-01 0.0000e+00
+-1.9389e-01 +6.6450e-01 0.0000e+00
+-1.5081e-01 +6.4081e-01 0.0000e+00
+-9.9970e-02 +6.1331e-01 0.0000e+00
+-6.3508e-02 +5.8751e-01 0.0000e+00
+-1.5623e-02 +5.6050e-01 0.0000e+00
++2.6097e-02 +5.3969e-01 0.0000e+00
++6.9728e-02 +5.1281e-01 0.0000e+00
++1.2210e-01 +4.9373e-01 0.0000e+00
++1.6538e-01 +4.6272e-01 0.0000e+00
++2.1354e-01 +4.3833e-01 0.0000e+00
++2.5323e-01 +4.2036e-01 0.0000e+00
++2.9654e-01 +3.9233e-01 0.0000e+00
++3.4541e-01 +3.7151e-01 0.0000e+00
++3.8976e-01 +3.4280e-01 0.0000e+00
++4.3404e-01 +3.2073e-01 0.0000e+00
++4.7946e-01 +2.9023e-01 0.0000e+00
++5.2154e-01 +2.7179e-01 0.0000e+00
++5.7103e-01 +2.4146e-01 0.0000e+00
++6.1747e-01 +2.1328e-01 0.0000e+00
++6.6177e-01 +1.9587e-01 0.0000e+00
++7.0290e-01 +1.7252e-01 0.0000e+00
++7.5295e-01 +1.4782e-01 0.0000e+00
+-2.1389e-01 +7.3266e-01 0.0000e+00
+-1.6704e-01 +7.0643e-01 0.0000e+00
+-1.2392e-01 +6.8320e-01 0.0000e+00
+-8.2541e-02 +6.5828e-01 0.0000e+00
+-3.5258e-02 +6.3256e-01 0.0000e+00
++4.9893e-03 +6.0625e-01 0.0000e+00
++5.5664e-02 +5.7983e-01 0.0000e+00
++1.0242e-01 +5.5286e-01 0.0000e+00
++1.4912e-01 +5.3619e-01 0.0000e+00
++1.9265e-01 +5.1230e-01 0.0000e+00
++2.3993e-01 +4.8581e-01 0.0000e+00
++2.7633e-01 +4.6317e-01 0.0000e+00
++3.2591e-01 +4.3368e-01 0.0000e+00
++3.7364e-01 +4.1020e-01 0.0000e+00
++4.1277e-01 +3.9319e-01 0.0000e+00
++4.5703e-01 +3.6506e-01 0.0000e+00
++5.1064e-01 +3.3938e-01 0.0000e+00
++5.5497e-01 +3.1509e-01 0.0000e+00
++5.9204e-01 +2.9329e-01 0.0000e+00
++6.3967e-01 +2.5936e-01 0.0000e+00
++6.8591e-01 +2.3509e-01 0.0000e+00
++7.2991e-01 +2.1836e-01 0.0000e+00
+-1.4066e-01 +7.5344e-01 0.0000e+00
+-1.0466e-01 +7.2908e-01 0.0000e+00
+-5.9498e-02 +7.0332e-01 0.0000e+00
+-1.0141e-02 +6.8030e-01 0.0000e+00
++3.2524e-02 +6.5105e-01 0.0000e+00
++8.3834e-02 +6.3120e-01 0.0000e+00
++1.3093e-01 +6.0540e-01 0.0000e+00
++1.6797e-01 +5.8347e-01 0.0000e+00
++2.1411e-01 +5.4914e-01 0.0000e+00
++2.6184e-01 +5.3003e-01 0.0000e+00
++3.0458e-01 +5.0815e-01 0.0000e+00
++3.5069e-01 +4.7598e-01 0.0000e+00
++3.9451e-01 +4.5610e-01 0.0000e+00
++4.3689e-01 +4.3646e-01 0.0000e+00
++4.8504e-01 +4.0628e-01 0.0000e+00
++5.3249e-01 +3.8055e-01 0.0000e+00
++5.7315e-01 +3.6474e-01 0.0000e+00
++6.1743e-01 +3.3157e-01 0.0000e+00
++6.6460e-01 +3.0381e-01 0.0000e+00
++7.1431e-01 +2.8416e-01 0.0000e+00
+-3.4504e-02 +7.4509e-01 0.0000e+00
++1.4970e-02 +7.2539e-01 0.0000e+00
++5.7552e-02 +6.9965e-01 0.0000e+00
++1.0025e-01 +6.7386e-01 0.0000e+00
++1.4432e-01 +6.4963e-01 0.0000e+00
++1.9399e-01 +6.2364e-01 0.0000e+00
++2.3214e-01 +5.9737e-01 0.0000e+00
++2.8685e-01 +5.7094e-01 0.0000e+00
++3.3103e-01 +5.4912e-01 0.0000e+00
++3.7523e-01 +5.2048e-01 0.0000e+00
++4.2227e-01 +5.0293e-01 0.0000e+00
++4.6214e-01 +4.8281e-01 0.0000e+00
++5.0987e-01 +4.5308e-01 0.0000e+00
++5.5833e-01 +4.2980e-01 0.0000e+00
++6.0395e-01 +4.0369e-01 0.0000e+00
++6.4192e-01 +3.7853e-01 0.0000e+00
++8.6300e-02 +7.4386e-01 0.0000e+00
++1.2647e-01 +7.1595e-01 0.0000e+00
++1.7385e-01 +6.9092e-01 0.0000e+00
++2.1730e-01 +6.6415e-01 0.0000e+00
++2.6100e-01 +6.4525e-01 0.0000e+00
++3.1305e-01 +6.2050e-01 0.0000e+00
++3.5034e-01 +5.9519e-01 0.0000e+00
++4.0458e-01 +5.7273e-01 0.0000e+00
++4.4637e-01 +5.4922e-01 0.0000e+00
++4.8408e-01 +5.2166e-01 0.0000e+00
++5.3812e-01 +4.9925e-01 0.0000e+00
++5.8065e-01 +4.7424e-01 0.0000e+00
++1.9623e-01 +7.3894e-01 0.0000e+00
++2.4402e-01 +7.1721e-01 0.0000e+00
++2.9001e-01 +6.9038e-01 0.0000e+00
++3.2903e-01 +6.6804e-01 0.0000e+00
++3.7681e-01 +6.3967e-01 0.0000e+00
++4.2423e-01 +6.1092e-01 0.0000e+00
++4.6851e-01 +5.8949e-01 0.0000e+00
++5.1256e-01 +5.6556e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-5.7143e-01 -5.1362e-01 0.0000e+00
+-5.2160e-01 -5.4490e-01 0.0000e+00
+-4.8313e-01 -5.7849e-01 0.0000e+00
+-4.3920e-01 -6.0334e-01 0.0000e+00
+-4.0554e-01 -6.3203e-01 0.0000e+00
+-3.5397e-01 -6.6566e-01 0.0000e+00
+-3.1370e-01 -6.9516e-01 0.0000e+00
+-2.6770e-01 -7.1965e-01 0.0000e+00
+-6.6855e-01 -3.8719e-01 0.0000e+00
+-6.2615e-01 -4.2040e-01 0.0000e+00
+-5.8235e-01 -4.5010e-01 0.0000e+00
+-5.3993e-01 -4.7813e-01 0.0000e+00
+-4.9797e-01 -5.0436e-01 0.0000e+00
+-4.6063e-01 -5.3313e-01 0.0000e+00
+-4.1649e-01 -5.6366e-01 0.0000e+00
+-3.7319e-01 -5.8713e-01 0.0000e+00
+-3.2364e-01 -6.1852e-01 0.0000e+00
+-2.8719e-01 -6.4295e-01 0.0000e+00
+-2.4271e-01 -6.7797e-01 0.0000e+00
+-1.9652e-01 -7.0931e-01 0.0000e+00
+-1.5546e-01 -7.3315e-01 0.0000e+00
+-6.8844e-01 -3.1638e-01 0.0000e+00
+-6.3888e-01 -3.4996e-01 0.0000e+00
+-5.9693e-01 -3.6825e-01 0.0000e+00
+-5.5672e-01 -4.0406e-01 0.0000e+00
+-5.1478e-01 -4.3049e-01 0.0000e+00
+-4.6652e-01 -4.6046e-01 0.0000e+00
+-4.2285e-01 -4.9107e-01 0.0000e+00
+-3.8703e-01 -5.2019e-01 0.0000e+00
+-3.4171e-01 -5.4900e-01 0.0000e+00
+-2.9453e-01 -5.7546e-01 0.0000e+00
+-2.5515e-01 -6.0724e-01 0.0000e+00
+-2.1391e-01 -6.3610e-01 0.0000e+00
+-1.7121e-01 -6.6113e-01 0.0000e+00
+-1.2931e-01 -6.9379e-01 0.0000e+00
+-8.2151e-02 -7.1706e-01 0.0000e+00
+-4.3667e-02 -7.5090e-01 0.0000e+00
+-7.3801e-01 -2.1854e-01 0.0000e+00
+-6.9488e-01 -2.4701e-01 0.0000e+00
+-6.5666e-01 -2.7127e-01 0.0000e+00
+-6.0695e-01 -2.9760e-01 0.0000e+00
+-5.6627e-01 -3.2665e-01 0.0000e+00
+-5.2589e-01 -3.5789e-01 0.0000e+00
+-4.8514e-01 -3.8676e-01 0.0000e+00
+-4.4152e-01 -4.1995e-01 0.0000e+00
+-3.9922e-01 -4.4735e-01 0.0000e+00
+-3.5340e-01 -4.7065e-01 0.0000e+00
+-3.1045e-01 -5.0402e-01 0.0000e+00
+-2.7068e-01 -5.2648e-01 0.0000e+00
+-2.2585e-01 -5.6053e-01 0.0000e+00
+-1.8626e-01 -5.8665e-01 0.0000e+00
+-1.3938e-01 -6.1759e-01 0.0000e+00
+-1.0141e-01 -6.5391e-01 0.0000e+00
+-5.4596e-02 -6.8175e-01 0.0000e+00
+-8.8008e-03 -7.0604e-01 0.0000e+00
++2.5355e-02 -7.3586e-01 0.0000e+00
++6.7584e-02 -7.6544e-01 0.0000e+00
+-7.4883e-01 -1.3982e-01 0.0000e+00
+-7.0921e-01 -1.7455e-01 0.0000e+00
+-6.6352e-01 -1.9663e-01 0.0000e+00
+-6.2358e-01 -2.2487e-01 0.0000e+00
+-5.7823e-01 -2.5646e-01 0.0000e+00
+-5.4008e-01 -2.9133e-01 0.0000e+00
+-4.9406e-01 -3.2195e-01 0.0000e+00
+-4.5579e-01 -3.4565e-01 0.0000e+00
+-4.1469e-01 -3.7802e-01 0.0000e+00
+-3.6989e-01 -3.9755e-01 0.0000e+00
+-3.2321e-01 -4.3474e-01 0.0000e+00
+-2.8182e-01 -4.6767e-01 0.0000e+00
+-2.4042e-01 -4.9509e-01 0.0000e+00
+-1.9808e-01 -5.2267e-01 0.0000e+00
+-1.5138e-01 -5.5144e-01 0.0000e+00
+-1.1014e-01 -5.7912e-01 0.0000e+00
+-6.8539e-02 -6.0956e-01 0.0000e+00
+-3.0356e-02 -6.3550e-01 0.0000e+00
++1.3693e-02 -6.6586e-01 0.0000e+00
++5.3833e-02 -6.9280e-01 0.0000e+00
++1.0234e-01 -7.2542e-01 0.0000e+00
++1.4204e-01 -7.5560e-01 0.0000e+00
+-7.6611e-01 -6.9870e-02 0.0000e+00
+-7.2455e-01 -9.4858e-02 0.0000e+00
+-6.8301e-01 -1.3134e-01 0.0000e+00
+-6.3469e-01 -1.5985e-01 0.0000e+00
+-5.8925e-01 -1.8686e-01 0.0000e+00
+-5.4902e-01 -2.1875e-01 0.0000e+00
+-5.1462e-01 -2.4465e-01 0.0000e+00
+-4.6748e-01 -2.7862e-01 0.0000e+00
+-4.2846e-01 -3.0567e-01 0.0000e+00
+-3.7693e-01 -3.3078e-01 0.0000e+00
+-3.3976e-01 -3.6416e-01 0.0000e+00
+-2.9434e-01 -3.9064e-01 0.0000e+00
+-2.5723e-01 -4.2297e-01 0.0000e+00
+-2.0930e-01 -4.4654e-01 0.0000e+00
+-1.7088e-01 -4.8133e-01 0.0000e+00
+-1.2655e-01 -5.0706e-01 0.0000e+00
+-8.6047e-02 -5.3386e-01 0.0000e+00
+-4.2442e-02 -5.6123e-01 0.0000e+00
++1.5361e-03 -5.9823e-01 0.0000e+00
++4.3150e-02 -6.2641e-01 0.0000e+00
++9.2453e-02 -6.4969e-01 0.0000e+00
++1.2567e-01 -6.7582e-01 0.0000e+00
++1.7685e-01 -7.0786e-01 0.0000e+00
++2.1737e-01 -7.3935e-01 0.0000e+00
+-7.3980e-01 -3.1087e-02 0.0000e+00
+-6.9566e-01 -5.4497e-02 0.0000e+00
+-6.5171e-01 -8.6130e-02 0.0000e+00
+-6.0763e-01 -1.2030e-01 0.0000e+00
+-5.6694e-01 -1.3905e-01 0.0000e+00
+-5.2155e-01 -1.7268e-01 0.0000e+00
+-4.8078e-01 -1.9752e-01 0.0000e+00
+-4.3356e-01 -2.2980e-01 0.0000e+00
+-3.9356e-01 -2.5712e-01 0.0000e+00
+-3.5894e-01 -2.8934e-01 0.0000e+00
+-3.1415e-01 -3.2118e-01 0.0000e+00
+-2.6550e-01 -3.5052e-01 0.0000e+00
+-2.2651e-01 -3.7846e-01 0.0000e+00
+-1.7990e-01 -4.0848e-01 0.0000e+00
+-1.4163e-01 -4.2775e-01 0.0000e+00
+-9.8867e-02 -4.5908e-01 0.0000e+00
+-5.5931e-02 -4.9247e-01 0.0000e+00
+-1.8184e-02 -5.2315e-01 0.0000e+00
++2.9727e-02 -5.4638e-01 0.0000e+00
++7.7395e-02 -5.7869e-01 0.0000e+00
++1.1298e-01 -6.0485e-01 0.0000e+00
++1.6169e-01 -6.3982e-01 0.0000e+00
++1.9509e-01 -6.6888e-01 0.0000e+00
++2.4027e-01 -6.9232e-01 0.0000e+00
+-7.5160e-01 +4.2554e-02 0.0000e+00
+-7.0820e-01 +1.2952e-02 0.0000e+00
+-6.6116e-01 -1.2924e-02 0.0000e+00
+-6.2328e-01 -4.0969e-02 0.0000e+00
+-5.8373e-01 -7.0385e-02 0.0000e+00
+-5.3927e-01 -1.0290e-01 0.0000e+00
+-4.9207e-01 -1.3541e-01 0.0000e+00
+-4.5533e-01 -1.5801e-01 0.0000e+00
+-4.0764e-01 -1.8702e-01 0.0000e+00
+-3.6616e-01 -2.1987e-01 0.0000e+00
+-3.2318e-01 -2.4770e-01 0.0000e+00
+-2.7962e-01 -2.7345e-01 0.0000e+00
+-2.3753e-01 -3.0211e-01 0.0000e+00
+-2.0289e-01 -3.3465e-01 0.0000e+00
+-1.5138e-01 -3.6051e-01 0.0000e+00
+-1.1316e-01 -3.8912e-01 0.0000e+00
+-6.6708e-02 -4.1648e-01 0.0000e+00
+-3.1706e-02 -4.5116e-01 0.0000e+00
++1.4827e-02 -4.7659e-01 0.0000e+00
++6.3809e-02 -5.0533e-01 0.0000e+00
++1.0272e-01 -5.3875e-01 0.0000e+00
++1.4032e-01 -5.6714e-01 0.0000e+00
++1.8263e-01 -5.9782e-01 0.0000e+00
++2.2991e-01 -6.1967e-01 0.0000e+00
++2.6678e-01 -6.5393e-01 0.0000e+00
++3.1852e-01 -6.8230e-01 0.0000e+00
+-7.6100e-01 +1.0909e-01 0.0000e+00
+-7.1609e-01 +8.5711e-02 0.0000e+00
+-6.7327e-01 +5.5803e-02 0.0000e+00
+-6.3563e-01 +2.2236e-02 0.0000e+00
+-5.9042e-01 +1.7676e-03 0.0000e+00
+-5.5271e-01 -2.5586e-02 0.0000e+00
+-5.0656e-01 -6.1786e-02 0.0000e+00
+-4.6523e-01 -8.2560e-02 0.0000e+00
+-4.2498e-01 -1.1209e-01 0.0000e+00
+-3.7970e-01 -1.5087e-01 0.0000e+00
+-3.3706e-01 -1.8161e-01 0.0000e+00
+-2.9490e-01 -1.9902e-01 0.0000e+00
+-2.5315e-01 -2.3544e-01 0.0000e+00
+-2.0902e-01 -2.6215e-01 0.0000e+00
+-1.6129e-01 -2.8925e-01 0.0000e+00
+-1.2475e-01 -3.1507e-01 0.0000e+00
+-8.1391e-02 -3.4429e-01 0.0000e+00
+-3.9246e-02 -3.7765e-01 0.0000e+00
++3.3544e-03 -4.1123e-01 0.0000e+00
++4.2946e-02 -4.3902e-01 0.0000e+00
++8.6910e-02 -4.6686e-01 0.0000e+00
++1.3377e-01 -4.9265e-01 0.0000e+00
++1.7202e-01 -5.2376e-01 0.0000e+00
++2.1304e-01 -5.5570e-01 0.0000e+00
++2.5723e-01 -5.8236e-01 0.0000e+00
++2.9960e-01 -6.0908e-01 0.0000e+00
++3.4668e-01 -6.4120e-01 0.0000e+00
+-7.2750e-01 +1.5885e-01 0.0000e+00
+-6.9517e-01 +1.2492e-01 0.0000e+00
+-6.5422e-01 +9.8732e-02 0.0000e+00
+-6.1235e-01 +7.0184e-02 0.0000e+00
+-5.6558e-01 +3.6880e-02 0.0000e+00
+-5.2347e-01 +9.8975e-03 0.0000e+00
+-4.7788e-01 -2.2679e-02 0.0000e+00
+-4.3641e-01 -4.0281e-02 0.0000e+00
+-3.9354e-01 -7.8316e-02 0.0000e+00
+-3.4949e-01 -1.0497e-01 0.0000e+00
+-3.1286e-01 -1.3057e-01 0.0000e+00
+-2.6622e-01 -1.6235e-01 0.0000e+00
+-2.2560e-01 -1.8733e-01 0.0000e+00
+-1.8220e-01 -2.1571e-01 0.0000e+00
+-1.3526e-01 -2.4941e-01 0.0000e+00
+-9.5027e-02 -2.7709e-01 0.0000e+00
+-5.2506e-02 -3.0234e-01 0.0000e+00
+-4.5196e-03 -3.3417e-01 0.0000e+00
++3.3405e-02 -3.6520e-01 0.0000e+00
++7.4061e-02 -3.9301e-01 0.0000e+00
++1.1319e-01 -4.2045e-01 0.0000e+00
++1.5846e-01 -4.5087e-01 0.0000e+00
++2.0208e-01 -4.8127e-01 0.0000e+00
++2.5165e-01 -5.0857e-01 0.0000e+00
++2.8854e-01 -5.4143e-01 0.0000e+00
++3.3067e-01 -5.6566e-01 0.0000e+00
++3.7408e-01 -5.9992e-01 0.0000e+00
++4.1566e-01 -6.2528e-01 0.0000e+00
+-7.0622e-01 +1.9805e-01 0.0000e+00
+-6.6564e-01 +1.7391e-01 0.0000e+00
+-6.1946e-01 +1.4101e-01 0.0000e+00
+-5.7875e-01 +1.0873e-01 0.0000e+00
+-5.2934e-01 +8.3566e-02 0.0000e+00
+-4.9237e-01 +5.6739e-02 0.0000e+00
+-4.5546e-01 +2.3910e-02 0.0000e+00
+-4.0852e-01 -6.1420e-03 0.0000e+00
+-3.6201e-01 -2.9389e-02 0.0000e+00
+-3.2085e-01 -6.3457e-02 0.0000e+00
+-2.8352e-01 -9.0386e-02 0.0000e+00
+-2.3763e-01 -1.2471e-01 0.0000e+00
+-1.8812e-01 -1.4773e-01 0.0000e+00
+-1.5553e-01 -1.7454e-01 0.0000e+00
+-1.0410e-01 -2.0499e-01 0.0000e+00
+-6.6682e-02 -2.4008e-01 0.0000e+00
+-2.6618e-02 -2.6115e-01 0.0000e+00
++1.5648e-02 -2.9699e-01 0.0000e+00
++6.2001e-02 -3.2286e-01 0.0000e+00
++1.0309e-01 -3.5497e-01 0.0000e+00
++1.4492e-01 -3.7382e-01 0.0000e+00
++1.8493e-01 -4.1236e-01 0.0000e+00
++2.3624e-01 -4.3959e-01 0.0000e+00
++2.6948e-01 -4.6857e-01 0.0000e+00
++3.1923e-01 -4.9269e-01 0.0000e+00
++3.6428e-01 -5.2335e-01 0.0000e+00
++3.9909e-01 -5.5334e-01 0.0000e+00
++4.4606e-01 -5.8293e-01 0.0000e+00
+-7.2179e-01 +2.7486e-01 0.0000e+00
+-6.7390e-01 +2.4123e-01 0.0000e+00
+-6.3425e-01 +2.1919e-01 0.0000e+00
+-5.8588e-01 +1.8506e-01 0.0000e+00
+-5.4957e-01 +1.5755e-01 0.0000e+00
+-5.0071e-01 +1.2902e-01 0.0000e+00
+-4.6391e-01 +1.0140e-01 0.0000e+00
+-4.2322e-01 +6.4070e-02 0.0000e+00
+-3.7809e-01 +3.6576e-02 0.0000e+00
+-3.3307e-01 +9.2916e-03 0.0000e+00
+-2.9197e-01 -2.0259e-02 0.0000e+00
+-2.5234e-01 -4.7175e-02 0.0000e+00
+-2.0885e-01 -7.6448e-02 0.0000e+00
+-1.6834e-01 -1.0392e-01 0.0000e+00
+-1.1733e-01 -1.3538e-01 0.0000e+00
+-8.5537e-02 -1.6528e-01 0.0000e+00
+-4.0522e-02 -1.9639e-01 0.0000e+00
++5.6076e-03 -2.2123e-01 0.0000e+00
++4.7296e-02 -2.5479e-01 0.0000e+00
++8.8629e-02 -2.7759e-01 0.0000e+00
++1.3336e-01 -3.1207e-01 0.0000e+00
++1.7216e-01 -3.3540e-01 0.0000e+00
++2.1634e-01 -3.6820e-01 0.0000e+00
++2.6428e-01 -3.9598e-01 0.0000e+00
++3.0351e-01 -4.2195e-01 0.0000e+00
++3.4429e-01 -4.5752e-01 0.0000e+00
++3.8636e-01 -4.8138e-01 0.0000e+00
++4.3145e-01 -5.1166e-01 0.0000e+00
++4.7215e-01 -5.4368e-01 0.0000e+00
++5.1256e-01 -5.7056e-01 0.0000e+00
+-6.8834e-01 +3.1708e-01 0.0000e+00
+-6.4722e-01 +2.8738e-01 0.0000e+00
+-6.0616e-01 +2.5612e-01 0.0000e+00
+-5.6458e-01 +2.3047e-01 0.0000e+00
+-5.2257e-01 +1.9856e-01 0.0000e+00
+-4.7114e-01 +1.7119e-01 0.0000e+00
+-4.3271e-01 +1.3670e-01 0.0000e+00
+-3.9209e-01 +1.1468e-01 0.0000e+00
+-3.5229e-01 +8.6057e-02 0.0000e+00
+-3.0395e-01 +5.1073e-02 0.0000e+00
+-2.6386e-01 +2.0900e-02 0.0000e+00
+-2.2327e-01 -6.1409e-03 0.0000e+00
+-1.8181e-01 -3.2014e-02 0.0000e+00
+-1.3043e-01 -6.1022e-02 0.0000e+00
+-9.2103e-02 -8.9547e-02 0.0000e+00
+-4.5979e-02 -1.2042e-01 0.0000e+00
+-1.1084e-02 -1.4922e-01 0.0000e+00
++3.0023e-02 -1.8100e-01 0.0000e+00
++7.5642e-02 -2.0890e-01 0.0000e+00
++1.1970e-01 -2.3808e-01 0.0000e+00
++1.5687e-01 -2.6699e-01 0.0000e+00
++2.0382e-01 -2.9736e-01 0.0000e+00
++2.4433e-01 -3.2823e-01 0.0000e+00
++2.9098e-01 -3.5386e-01 0.0000e+00
++3.2570e-01 -3.8239e-01 0.0000e+00
++3.7293e-01 -4.0417e-01 0.0000e+00
++4.1560e-01 -4.4174e-01 0.0000e+00
++4.5599e-01 -4.7006e-01 0.0000e+00
++5.0343e-01 -5.0046e-01 0.0000e+00
++5.4811e-01 -5.2420e-01 0.0000e+00
+-6.5960e-01 +3.5085e-01 0.0000e+00
+-6.1428e-01 +3.2547e-01 0.0000e+00
+-5.7281e-01 +3.0286e-01 0.0000e+00
+-5.3966e-01 +2.6830e-01 0.0000e+00
+-4.9455e-01 +2.4225e-01 0.0000e+00
+-4.4946e-01 +2.1773e-01 0.0000e+00
+-4.0677e-01 +1.8259e-01 0.0000e+00
+-3.5778e-01 +1.5276e-01 0.0000e+00
+-3.1866e-01 +1.2753e-01 0.0000e+00
+-2.7499e-01 +9.4579e-02 0.0000e+00
+-2.3366e-01 +7.1190e-02 0.0000e+00
+-1.8934e-01 +3.8608e-02 0.0000e+00
+-1.5535e-01 +6.2095e-03 0.0000e+00
+-1.0530e-01 -1.9458e-02 0.0000e+00
+-6.2619e-02 -5.0751e-02 0.0000e+00
+-1.9932e-02 -7.7437e-02 0.0000e+00
++1.8664e-02 -1.0795e-01 0.0000e+00
++6.4772e-02 -1.3775e-01 0.0000e+00
++1.0832e-01 -1.6826e-01 0.0000e+00
++1.5284e-01 -1.9392e-01 0.0000e+00
++1.9003e-01 -2.2241e-01 0.0000e+00
++2.3963e-01 -2.5108e-01 0.0000e+00
++2.7625e-01 -2.8684e-01 0.0000e+00
++3.1688e-01 -3.1404e-01 0.0000e+00
++3.6054e-01 -3.3465e-01 0.0000e+00
++3.9944e-01 -3.6974e-01 0.0000e+00
++4.4113e-01 -3.9685e-01 0.0000e+00
++4.8389e-01 -4.2511e-01 0.0000e+00
++5.2923e-01 -4.5806e-01 0.0000e+00
++5.7550e-01 -4.7965e-01 0.0000e+00
+-6.3263e-01 +4.0077e-01 0.0000e+00
+-5.9219e-01 +3.7019e-01 0.0000e+00
+-5.4766e-01 +3.4537e-01 0.0000e+00
+-5.0571e-01 +3.1737e-01 0.0000e+00
+-4.6059e-01 +2.8144e-01 0.0000e+00
+-4.1712e-01 +2.5739e-01 0.0000e+00
+-3.7313e-01 +2.2358e-01 0.0000e+00
+-3.3241e-01 +1.9940e-01 0.0000e+00
+-2.9439e-01 +1.6558e-01 0.0000e+00
+-2.4657e-01 +1.4223e-01 0.0000e+00
+-2.0483e-01 +1.0713e-01 0.0000e+00
+-1.6886e-01 +8.0918e-02 0.0000e+00
+-1.1523e-01 +5.2534e-02 0.0000e+00
+-7.3064e-02 +2.4708e-02 0.0000e+00
+-3.5633e-02 -1.1632e-02 0.0000e+00
++2.2960e-03 -3.6816e-02 0.0000e+00
++5.0464e-02 -6.7914e-02 0.0000e+00
++8.7828e-02 -9.4209e-02 0.0000e+00
++1.3490e-01 -1.2786e-01 0.0000e+00
++1.8002e-01 -1.5266e-01 0.0000e+00
++2.2234e-01 -1.8309e-01 0.0000e+00
++2.6255e-01 -2.0462e-01 0.0000e+00
++3.0427e-01 -2.4231e-01 0.0000e+00
++3.4855e-01 -2.6449e-01 0.0000e+00
++3.9433e-01 -2.9853e-01 0.0000e+00
++4.3010e-01 -3.2202e-01 0.0000e+00
++4.7451e-01 -3.5231e-01 0.0000e+00
++5.1959e-01 -3.8687e-01 0.0000e+00
++5.5979e-01 -4.1241e-01 0.0000e+00
++5.9895e-01 -4.4021e-01 0.0000e+00
+-5.9917e-01 +4.3988e-01 0.0000e+00
+-5.5803e-01 +4.1676e-01 0.0000e+00
+-5.1585e-01 +3.8299e-01 0.0000e+00
+-4.7643e-01 +3.5830e-01 0.0000e+00
+-4.3110e-01 +3.2751e-01 0.0000e+00
+-3.8863e-01 +2.9311e-01 0.0000e+00
+-3.4708e-01 +2.6548e-01 0.0000e+00
+-3.0822e-01 +2.3500e-01 0.0000e+00
+-2.6239e-01 +2.0604e-01 0.0000e+00
+-2.2239e-01 +1.8018e-01 0.0000e+00
+-1.7870e-01 +1.4942e-01 0.0000e+00
+-1.3311e-01 +1.2471e-01 0.0000e+00
+-9.2266e-02 +9.8550e-02 0.0000e+00
+-4.7643e-02 +6.0708e-02 0.0000e+00
+-6.1050e-03 +3.8866e-02 0.0000e+00
++3.7607e-02 +1.6854e-03 0.0000e+00
++7.7152e-02 -1.7270e-02 0.0000e+00
++1.2323e-01 -4.9339e-02 0.0000e+00
++1.5890e-01 -8.2850e-02 0.0000e+00
++2.0689e-01 -1.1300e-01 0.0000e+00
++2.5184e-01 -1.4118e-01 0.0000e+00
++2.8890e-01 -1.6515e-01 0.0000e+00
++3.2994e-01 -1.9670e-01 0.0000e+00
++3.8163e-01 -2.2545e-01 0.0000e+00
++4.2008e-01 -2.5002e-01 0.0000e+00
++4.6259e-01 -2.8120e-01 0.0000e+00
++5.0845e-01 -3.0921e-01 0.0000e+00
++5.4344e-01 -3.4310e-01 0.0000e+00
++5.9423e-01 -3.7131e-01 0.0000e+00
++6.2940e-01 -4.0128e-01 0.0000e+00
+-5.7133e-01 +4.8275e-01 0.0000e+00
+-5.3448e-01 +4.5835e-01 0.0000e+00
+-4.8591e-01 +4.3067e-01 0.0000e+00
+-4.4380e-01 +3.9382e-01 0.0000e+00
+-4.0135e-01 +3.7210e-01 0.0000e+00
+-3.6177e-01 +3.3741e-01 0.0000e+00
+-3.2032e-01 +3.0858e-01 0.0000e+00
+-2.7278e-01 +2.7768e-01 0.0000e+00
+-2.3314e-01 +2.5843e-01 0.0000e+00
+-1.9148e-01 +2.1790e-01 0.0000e+00
+-1.5355e-01 +1.9393e-01 0.0000e+00
+-1.0448e-01 +1.6360e-01 0.0000e+00
+-6.2949e-02 +1.4047e-01 0.0000e+00
+-2.2330e-02 +1.0506e-01 0.0000e+00
++2.4765e-02 +8.1463e-02 0.0000e+00
++6.2291e-02 +5.1069e-02 0.0000e+00
++1.1164e-01 +1.7706e-02 0.0000e+00
++1.5009e-01 -1.0821e-02 0.0000e+00
++1.9736e-01 -3.5945e-02 0.0000e+00
++2.3580e-01 -6.3608e-02 0.0000e+00
++2.7495e-01 -9.8299e-02 0.0000e+00
++3.1663e-01 -1.2382e-01 0.0000e+00
++3.6324e-01 -1.5250e-01 0.0000e+00
++4.0248e-01 -1.8682e-01 0.0000e+00
++4.5044e-01 -2.0839e-01 0.0000e+00
++4.8785e-01 -2.3923e-01 0.0000e+00
++5.3122e-01 -2.7139e-01 0.0000e+00
++5.7791e-01 -2.9406e-01 0.0000e+00
++6.1971e-01 -3.2887e-01 0.0000e+00
++6.5723e-01 -3.5993e-01 0.0000e+00
+-5.4590e-01 +5.2658e-01 0.0000e+00
+-5.0393e-01 +4.9844e-01 0.0000e+00
+-4.6112e-01 +4.7120e-01 0.0000e+00
+-4.1362e-01 +4.4318e-01 0.0000e+00
+-3.7876e-01 +4.1136e-01 0.0000e+00
+-3.3778e-01 +3.8041e-01 0.0000e+00
+-2.9143e-01 +3.5007e-01 0.0000e+00
+-2.4948e-01 +3.2434e-01 0.0000e+00
+-2.0379e-01 +2.8854e-01 0.0000e+00
+-1.5697e-01 +2.6736e-01 0.0000e+00
+-1.2563e-01 +2.3645e-01 0.0000e+00
+-8.1615e-02 +2.0749e-01 0.0000e+00
+-3.9319e-02 +1.7909e-01 0.0000e+00
++1.0970e-02 +1.5345e-01 0.0000e+00
++5.2262e-02 +1.1837e-01 0.0000e+00
++9.6955e-02 +8.8847e-02 0.0000e+00
++1.3321e-01 +6.2773e-02 0.0000e+00
++1.8031e-01 +3.3082e-02 0.0000e+00
++2.2044e-01 +7.3293e-03 0.0000e+00
++2.6125e-01 -2.5629e-02 0.0000e+00
++3.0933e-01 -5.6293e-02 0.0000e+00
++3.4948e-01 -8.2851e-02 0.0000e+00
++3.9044e-01 -1.0742e-01 0.0000e+00
++4.3141e-01 -1.4274e-01 0.0000e+00
++4.7584e-01 -1.6959e-01 0.0000e+00
++5.1415e-01 -1.9893e-01 0.0000e+00
++5.6481e-01 -2.2857e-01 0.0000e+00
++6.0810e-01 -2.5831e-01 0.0000e+00
++6.5058e-01 -2.8722e-01 0.0000e+00
++6.9133e-01 -3.1980e-01 0.0000e+00
+-5.0977e-01 +5.7036e-01 0.0000e+00
+-4.7552e-01 +5.3789e-01 0.0000e+00
+-4.3452e-01 +5.1140e-01 0.0000e+00
+-3.8906e-01 +4.8226e-01 0.0000e+00
+-3.4327e-01 +4.5390e-01 0.0000e+00
+-3.0700e-01 +4.2504e-01 0.0000e+00
+-2.5939e-01 +4.0092e-01 0.0000e+00
+-2.2234e-01 +3.6487e-01 0.0000e+00
+-1.7626e-01 +3.3286e-01 0.0000e+00
+-1.3748e-01 +3.0964e-01 0.0000e+00
+-8.9263e-02 +2.7600e-01 0.0000e+00
+-5.2225e-02 +2.4982e-01 0.0000e+00
+-1.0167e-02 +2.2063e-01 0.0000e+00
++3.7503e-02 +1.8936e-01 0.0000e+00
++8.4372e-02 +1.6070e-01 0.0000e+00
++1.2821e-01 +1.3558e-01 0.0000e+00
++1.6736e-01 +1.0405e-01 0.0000e+00
++2.0410e-01 +7.7337e-02 0.0000e+00
++2.4712e-01 +4.7647e-02 0.0000e+00
++2.8911e-01 +2.1073e-02 0.0000e+00
++3.3601e-01 -1.1799e-02 0.0000e+00
++3.8020e-01 -3.5794e-02 0.0000e+00
++4.2257e-01 -6.3901e-02 0.0000e+00
++4.6042e-01 -9.6971e-02 0.0000e+00
++5.0543e-01 -1.2184e-01 0.0000e+00
++5.4467e-01 -1.5661e-01 0.0000e+00
++5.9421e-01 -1.8169e-01 0.0000e+00
++6.3288e-01 -2.1714e-01 0.0000e+00
++6.7603e-01 -2.4514e-01 0.0000e+00
++7.1901e-01 -2.6646e-01 0.0000e+00
+-4.4505e-01 +5.8252e-01 0.0000e+00
+-4.0530e-01 +5.5290e-01 0.0000e+00
+-3.5983e-01 +5.2112e-01 0.0000e+00
+-3.2037e-01 +4.9432e-01 0.0000e+00
+-2.7417e-01 +4.7187e-01 0.0000e+00
+-2.2980e-01 +4.3287e-01 0.0000e+00
+-1.8679e-01 +4.0740e-01 0.0000e+00
+-1.4489e-01 +3.8138e-01 0.0000e+00
+-1.0260e-01 +3.4920e-01 0.0000e+00
+-6.2812e-02 +3.1727e-01 0.0000e+00
+-2.2680e-02 +2.9458e-01 0.0000e+00
++3.0335e-02 +2.6463e-01 0.0000e+00
++6.3664e-02 +2.3392e-01 0.0000e+00
++1.0700e-01 +2.0547e-01 0.0000e+00
++1.5298e-01 +1.7921e-01 0.0000e+00
++1.8848e-01 +1.4614e-01 0.0000e+00
++2.3413e-01 +1.2161e-01 0.0000e+00
++2.7629e-01 +9.2026e-02 0.0000e+00
++3.2727e-01 +6.0758e-02 0.0000e+00
++3.6572e-01 +3.3647e-02 0.0000e+00
++4.0312e-01 +1.7681e-03 0.0000e+00
++4.4930e-01 -2.0480e-02 0.0000e+00
++4.9449e-01 -5.2922e-02 0.0000e+00
++5.3243e-01 -8.6977e-02 0.0000e+00
++5.7514e-01 -1.1524e-01 0.0000e+00
++6.2610e-01 -1.4021e-01 0.0000e+00
++6.6191e-01 -1.7129e-01 0.0000e+00
++7.0126e-01 -1.9899e-01 0.0000e+00
+-4.1934e-01 +6.2795e-01 0.0000e+00
+-3.7391e-01 +6.0012e-01 0.0000e+00
+-3.2697e-01 +5.7040e-01 0.0000e+00
+-2.8770e-01 +5.3647e-01 0.0000e+00
+-2.4933e-01 +5.1235e-01 0.0000e+00
+-2.0489e-01 +4.8288e-01 0.0000e+00
+-1.6366e-01 +4.5502e-01 0.0000e+00
+-1.2352e-01 +4.2110e-01 0.0000e+00
+-7.7472e-02 +3.9674e-01 0.0000e+00
+-3.2195e-02 +3.6594e-01 0.0000e+00
++7.8698e-03 +3.4076e-01 0.0000e+00
++5.1721e-02 +3.1116e-01 0.0000e+00
++9.6100e-02 +2.7877e-01 0.0000e+00
++1.4003e-01 +2.4319e-01 0.0000e+00
++1.8041e-01 +2.2388e-01 0.0000e+00
++2.2369e-01 +1.8531e-01 0.0000e+00
++2.6330e-01 +1.5906e-01 0.0000e+00
++3.0793e-01 +1.2973e-01 0.0000e+00
++3.5038e-01 +9.8184e-02 0.0000e+00
++3.9218e-01 +7.8365e-02 0.0000e+00
++4.3495e-01 +4.0757e-02 0.0000e+00
++4.7398e-01 +1.3762e-02 0.0000e+00
++5.1772e-01 -8.7698e-03 0.0000e+00
++5.6385e-01 -4.4725e-02 0.0000e+00
++6.0310e-01 -7.3868e-02 0.0000e+00
++6.5211e-01 -1.0100e-01 0.0000e+00
++6.9209e-01 -1.3093e-01 0.0000e+00
++7.3686e-01 -1.5990e-01 0.0000e+00
+-3.4519e-01 +6.4362e-01 0.0000e+00
+-3.0302e-01 +6.1449e-01 0.0000e+00
+-2.5980e-01 +5.7980e-01 0.0000e+00
+-2.1569e-01 +5.5093e-01 0.0000e+00
+-1.7144e-01 +5.2643e-01 0.0000e+00
+-1.2969e-01 +4.9313e-01 0.0000e+00
+-9.0303e-02 +4.6797e-01 0.0000e+00
+-4.2826e-02 +4.3330e-01 0.0000e+00
+-3.3421e-03 +4.0615e-01 0.0000e+00
++4.0573e-02 +3.8342e-01 0.0000e+00
++7.9121e-02 +3.4561e-01 0.0000e+00
++1.2157e-01 +3.2223e-01 0.0000e+00
++1.6048e-01 +2.9027e-01 0.0000e+00
++2.1082e-01 +2.5771e-01 0.0000e+00
++2.5812e-01 +2.3460e-01 0.0000e+00
++2.9359e-01 +2.1081e-01 0.0000e+00
++3.3603e-01 +1.7592e-01 0.0000e+00
++3.7413e-01 +1.4653e-01 0.0000e+00
++4.2428e-01 +1.1849e-01 0.0000e+00
++4.6364e-01 +8.3264e-02 0.0000e+00
++5.0507e-01 +6.1088e-02 0.0000e+00
++5.4929e-01 +2.7516e-02 0.0000e+00
++5.9437e-01 -2.4365e-03 0.0000e+00
++6.3123e-01 -2.9560e-02 0.0000e+00
++6.8081e-01 -5.6097e-02 0.0000e+00
++7.2124e-01 -8.5041e-02 0.0000e+00
++7.5844e-01 -1.1499e-01 0.0000e+00
+-3.1587e-01 +6.8569e-01 0.0000e+00
+-2.7300e-01 +6.5530e-01 0.0000e+00
+-2.3641e-01 +6.2258e-01 0.0000e+00
+-1.8588e-01 +5.9825e-01 0.0000e+00
+-1.4284e-01 +5.6040e-01 0.0000e+00
+-1.0806e-01 +5.3621e-01 0.0000e+00
+-6.0663e-02 +5.0792e-01 0.0000e+00
+-1.5480e-02 +4.7942e-01 0.0000e+00
++2.9897e-02 +4.5175e-01 0.0000e+00
++6.8914e-02 +4.2515e-01 0.0000e+00
++1.1213e-01 +3.8704e-01 0.0000e+00
++1.5310e-01 +3.5843e-01 0.0000e+00
++1.9739e-01 +3.3279e-01 0.0000e+00
++2.4114e-01 +3.0318e-01 0.0000e+00
++2.7679e-01 +2.7657e-01 0.0000e+00
++3.2326e-01 +2.4798e-01 0.0000e+00
++3.6793e-01 +2.1108e-01 0.0000e+00
++4.0632e-01 +1.8654e-01 0.0000e+00
++4.4974e-01 +1.6439e-01 0.0000e+00
++4.9711e-01 +1.3265e-01 0.0000e+00
++5.3420e-01 +1.0060e-01 0.0000e+00
++5.7857e-01 +7.3048e-02 0.0000e+00
++6.2133e-01 +4.2924e-02 0.0000e+00
++6.6616e-01 +1.2360e-02 0.0000e+00
++7.1248e-01 -1.3259e-02 0.0000e+00
++7.5136e-01 -4.5958e-02 0.0000e+00
+-2.4570e-01 +6.9337e-01 0.0000e+00
+-2.0254e-01 +6.6965e-01 0.0000e+00
+-1.5382e-01 +6.3527e-01 0.0000e+00
+-1.1826e-01 +6.0986e-01 0.0000e+00
+-7.2621e-02 +5.8302e-01 0.0000e+00
+-2.9970e-02 +5.4919e-01 0.0000e+00
++1.7147e-02 +5.2392e-01 0.0000e+00
++5.0867e-02 +4.9003e-01 0.0000e+00
++9.6191e-02 +4.6043e-01 0.0000e+00
++1.3879e-01 +4.2992e-01 0.0000e+00
++1.8239e-01 +4.0067e-01 0.0000e+00
++2.2667e-01 +3.7013e-01 0.0000e+00
++2.6367e-01 +3.4950e-01 0.0000e+00
++3.1087e-01 +3.1631e-01 0.0000e+00
++3.5038e-01 +2.9057e-01 0.0000e+00
++3.9750e-01 +2.5777e-01 0.0000e+00
++4.3513e-01 +2.3321e-01 0.0000e+00
++4.8039e-01 +2.0148e-01 0.0000e+00
++5.2539e-01 +1.7698e-01 0.0000e+00
++5.6225e-01 +1.4791e-01 0.0000e+00
++6.0437e-01 +1.1801e-01 0.0000e+00
++6.5133e-01 +8.3041e-02 0.0000e+00
++6.8866e-01 +5.6431e-02 0.0000e+00
++7.3470e-01 +2.5995e-02 0.0000e+00
+-2.1601e-01 +7.4170e-01 0.0000e+00
+-1.6798e-01 +7.1132e-01 0.0000e+00
+-1.2744e-01 +6.8388e-01 0.0000e+00
+-8.6730e-02 +6.5589e-01 0.0000e+00
+-3.8640e-02 +6.2330e-01 0.0000e+00
+-4.7578e-03 +5.9386e-01 0.0000e+00
++4.0427e-02 +5.6206e-01 0.0000e+00
++8.0067e-02 +5.3708e-01 0.0000e+00
++1.2101e-01 +5.0583e-01 0.0000e+00
++1.7148e-01 +4.8152e-01 0.0000e+00
++2.1165e-01 +4.4618e-01 0.0000e+00
++2.5738e-01 +4.1698e-01 0.0000e+00
++2.9526e-01 +3.9504e-01 0.0000e+00
++3.3578e-01 +3.6268e-01 0.0000e+00
++3.8256e-01 +3.3697e-01 0.0000e+00
++4.2403e-01 +3.0382e-01 0.0000e+00
++4.6611e-01 +2.7732e-01 0.0000e+00
++5.0848e-01 +2.4228e-01 0.0000e+00
++5.4872e-01 +2.1964e-01 0.0000e+00
++5.9518e-01 +1.8436e-01 0.0000e+00
++6.3880e-01 +1.5153e-01 0.0000e+00
++6.8135e-01 +1.2969e-01 0.0000e+00
++7.2015e-01 +1.0223e-01 0.0000e+00
++7.6773e-01 +7.2523e-02 0.0000e+00
+-1.4062e-01 +7.5405e-01 0.0000e+00
+-9.6395e-02 +7.2314e-01 0.0000e+00
+-5.5598e-02 +6.9560e-01 0.0000e+00
+-1.6714e-02 +6.6653e-01 0.0000e+00
++2.7998e-02 +6.3609e-01 0.0000e+00
++6.5614e-02 +6.0575e-01 0.0000e+00
++1.1365e-01 +5.7426e-01 0.0000e+00
++1.5770e-01 +5.4262e-01 0.0000e+00
++2.0274e-01 +5.2128e-01 0.0000e+00
++2.4388e-01 +4.9303e-01 0.0000e+00
++2.8851e-01 +4.6182e-01 0.0000e+00
++3.2265e-01 +4.3554e-01 0.0000e+00
++3.6928e-01 +4.0108e-01 0.0000e+00
++4.1466e-01 +3.7283e-01 0.0000e+00
++4.5209e-01 +3.5191e-01 0.0000e+00
++4.9354e-01 +3.1936e-01 0.0000e+00
++5.4458e-01 +2.8831e-01 0.0000e+00
++5.8648e-01 +2.5959e-01 0.0000e+00
++6.2137e-01 +2.3409e-01 0.0000e+00
++6.6560e-01 +1.9539e-01 0.0000e+00
++7.0942e-01 +1.6650e-01 0.0000e+00
++7.5175e-01 +1.4537e-01 0.0000e+00
+-6.5316e-02 +7.6751e-01 0.0000e+00
+-3.1752e-02 +7.3955e-01 0.0000e+00
++1.0834e-02 +7.0927e-01 0.0000e+00
++5.7889e-02 +6.8131e-01 0.0000e+00
++9.7628e-02 +6.4779e-01 0.0000e+00
++1.4695e-01 +6.2282e-01 0.0000e+00
++1.9147e-01 +5.9230e-01 0.0000e+00
++2.2632e-01 +5.6668e-01 0.0000e+00
++2.6902e-01 +5.2773e-01 0.0000e+00
++3.1484e-01 +5.0385e-01 0.0000e+00
++3.5539e-01 +4.7769e-01 0.0000e+00
++3.9829e-01 +4.4091e-01 0.0000e+00
++4.4012e-01 +4.1665e-01 0.0000e+00
++4.8054e-01 +3.9277e-01 0.0000e+00
++5.2567e-01 +3.5778e-01 0.0000e+00
++5.7054e-01 +3.2730e-01 0.0000e+00
++6.0963e-01 +3.0742e-01 0.0000e+00
++6.5059e-01 +2.6982e-01 0.0000e+00
++6.9498e-01 +2.3735e-01 0.0000e+00
++7.4273e-01 +2.1273e-01 0.0000e+00
++4.0005e-02 +7.4854e-01 0.0000e+00
++8.7509e-02 +7.2389e-01 0.0000e+00
++1.2752e-01 +6.9389e-01 0.0000e+00
++1.6763e-01 +6.6383e-01 0.0000e+00
++2.0929e-01 +6.3520e-01 0.0000e+00
++2.5635e-01 +6.0424e-01 0.0000e+00
++2.9187e-01 +5.7416e-01 0.0000e+00
++3.4394e-01 +5.4225e-01 0.0000e+00
++3.8595e-01 +5.1602e-01 0.0000e+00
++4.2728e-01 +4.8296e-01 0.0000e+00
++4.7256e-01 +4.6070e-01 0.0000e+00
++5.1042e-01 +4.3660e-01 0.0000e+00
++5.5518e-01 +4.0210e-01 0.0000e+00
++6.0132e-01 +3.7397e-01 0.0000e+00
++6.4432e-01 +3.4330e-01 0.0000e+00
++6.7978e-01 +3.1433e-01 0.0000e+00
++1.6069e-01 +7.3523e-01 0.0000e+00
++1.9807e-01 +7.0331e-01 0.0000e+00
++2.4294e-01 +6.7353e-01 0.0000e+00
++2.8372e-01 +6.4242e-01 0.0000e+00
++3.2553e-01 +6.1915e-01 0.0000e+00
++3.7510e-01 +5.8920e-01 0.0000e+00
++4.0986e-01 +5.6015e-01 0.0000e+00
++4.6185e-01 +5.3227e-01 0.0000e+00
++5.0129e-01 +5.0459e-01 0.0000e+00
++5.3624e-01 +4.7326e-01 0.0000e+00
++5.8805e-01 +4.4544e-01 0.0000e+00
++6.2807e-01 +4.1618e-01 0.0000e+00
++2.7012e-01 +7.1931e-01 0.0000e+00
++3.1574e-01 +6.9281e-01 0.0000e+00
++3.5905e-01 +6.6138e-01 0.0000e+00
++3.9584e-01 +6.3514e-01 0.0000e+00
++4.4078e-01 +6.0199e-01 0.0000e+00
++4.8532e-01 +5.6849e-01 0.0000e+00
++5.2746e-01 +5.4263e-01 0.0000e+00
++5.6912e-01 +5.1431e-01 0.0000e+00
@@ -0,0 +1,711 @@
+-6.6844e-01 -3.9420e-01 0.0000e+00
+-6.2536e-01 -4.3513e-01 0.0000e+00
+-5.9400e-01 -4.7608e-01 0.0000e+00
+-5.5547e-01 -5.0946e-01 0.0000e+00
+-5.2790e-01 -5.4460e-01 0.0000e+00
+-4.8356e-01 -5.8821e-01 0.0000e+00
+-4.4959e-01 -6.2547e-01 0.0000e+00
+-4.0895e-01 -6.5892e-01 0.0000e+00
+-7.3930e-01 -2.4961e-01 0.0000e+00
+-7.0397e-01 -2.9097e-01 0.0000e+00
+-6.6655e-01 -3.2913e-01 0.0000e+00
+-6.3016e-01 -3.6536e-01 0.0000e+00
+-5.9386e-01 -3.9972e-01 0.0000e+00
+-5.6265e-01 -4.3568e-01 0.0000e+00
+-5.2506e-01 -4.7473e-01 0.0000e+00
+-4.8688e-01 -5.0662e-01 0.0000e+00
+-4.4410e-01 -5.4760e-01 0.0000e+00
+-4.1290e-01 -5.7908e-01 0.0000e+00
+-3.7588e-01 -6.2265e-01 0.0000e+00
+-3.3642e-01 -6.6291e-01 0.0000e+00
+-3.0053e-01 -6.9473e-01 0.0000e+00
+-7.4483e-01 -1.7553e-01 0.0000e+00
+-7.0249e-01 -2.1869e-01 0.0000e+00
+-6.6461e-01 -2.4518e-01 0.0000e+00
+-6.3197e-01 -2.8868e-01 0.0000e+00
+-5.9573e-01 -3.2323e-01 0.0000e+00
+-5.5395e-01 -3.6255e-01 0.0000e+00
+-5.1683e-01 -4.0159e-01 0.0000e+00
+-4.8719e-01 -4.3758e-01 0.0000e+00
+-4.4810e-01 -4.7517e-01 0.0000e+00
+-4.0668e-01 -5.1080e-01 0.0000e+00
+-3.7405e-01 -5.5014e-01 0.0000e+00
+-3.3899e-01 -5.8696e-01 0.0000e+00
+-3.0173e-01 -6.2028e-01 0.0000e+00
+-2.6678e-01 -6.6099e-01 0.0000e+00
+-2.2474e-01 -6.9346e-01 0.0000e+00
+-1.9341e-01 -7.3466e-01 0.0000e+00
+-7.7434e-01 -6.8749e-02 0.0000e+00
+-7.3734e-01 -1.0556e-01 0.0000e+00
+-7.0435e-01 -1.3723e-01 0.0000e+00
+-6.6040e-01 -1.7323e-01 0.0000e+00
+-6.2594e-01 -2.1013e-01 0.0000e+00
+-5.9221e-01 -2.4914e-01 0.0000e+00
+-5.5764e-01 -2.8587e-01 0.0000e+00
+-5.2110e-01 -3.2744e-01 0.0000e+00
+-4.8470e-01 -3.6303e-01 0.0000e+00
+-4.4399e-01 -3.9526e-01 0.0000e+00
+-4.0815e-01 -4.3689e-01 0.0000e+00
+-3.7327e-01 -4.6708e-01 0.0000e+00
+-3.3570e-01 -5.0976e-01 0.0000e+00
+-3.0173e-01 -5.4353e-01 0.0000e+00
+-2.6151e-01 -5.8353e-01 0.0000e+00
+-2.3118e-01 -6.2709e-01 0.0000e+00
+-1.9040e-01 -6.6402e-01 0.0000e+00
+-1.4992e-01 -6.9722e-01 0.0000e+00
+-1.2207e-01 -7.3357e-01 0.0000e+00
+-8.6181e-02 -7.7131e-01 0.0000e+00
+-7.6930e-01 +1.1349e-02 0.0000e+00
+-7.3703e-01 -3.0966e-02 0.0000e+00
+-6.9621e-01 -6.1959e-02 0.0000e+00
+-6.6232e-01 -9.7908e-02 0.0000e+00
+-6.2374e-01 -1.3825e-01 0.0000e+00
+-5.9294e-01 -1.8040e-01 0.0000e+00
+-5.5351e-01 -2.1992e-01 0.0000e+00
+-5.2036e-01 -2.5103e-01 0.0000e+00
+-4.8614e-01 -2.9130e-01 0.0000e+00
+-4.4570e-01 -3.1959e-01 0.0000e+00
+-4.0693e-01 -3.6575e-01 0.0000e+00
+-3.7254e-01 -4.0663e-01 0.0000e+00
+-3.3703e-01 -4.4206e-01 0.0000e+00
+-3.0063e-01 -4.7783e-01 0.0000e+00
+-2.6016e-01 -5.1565e-01 0.0000e+00
+-2.2486e-01 -5.5130e-01 0.0000e+00
+-1.8977e-01 -5.8976e-01 0.0000e+00
+-1.5715e-01 -6.2308e-01 0.0000e+00
+-1.1961e-01 -6.6194e-01 0.0000e+00
+-8.5265e-02 -6.9664e-01 0.0000e+00
+-4.3767e-02 -7.3863e-01 0.0000e+00
+-1.0505e-02 -7.7645e-01 0.0000e+00
+-7.7242e-01 +8.4051e-02 0.0000e+00
+-7.3628e-01 +5.1001e-02 0.0000e+00
+-7.0244e-01 +6.5757e-03 0.0000e+00
+-6.6032e-01 -3.1314e-02 0.0000e+00
+-6.2073e-01 -6.7146e-02 0.0000e+00
+-5.8728e-01 -1.0675e-01 0.0000e+00
+-5.5841e-01 -1.3928e-01 0.0000e+00
+-5.1853e-01 -1.8234e-01 0.0000e+00
+-4.8531e-01 -2.1692e-01 0.0000e+00
+-4.3931e-01 -2.5209e-01 0.0000e+00
+-4.0919e-01 -2.9257e-01 0.0000e+00
+-3.6952e-01 -3.2786e-01 0.0000e+00
+-3.3926e-01 -3.6729e-01 0.0000e+00
+-2.9651e-01 -4.0021e-01 0.0000e+00
+-2.6543e-01 -4.4234e-01 0.0000e+00
+-2.2670e-01 -4.7668e-01 0.0000e+00
+-1.9196e-01 -5.1131e-01 0.0000e+00
+-1.5426e-01 -5.4712e-01 0.0000e+00
+-1.1813e-01 -5.9256e-01 0.0000e+00
+-8.2564e-02 -6.2878e-01 0.0000e+00
+-3.8410e-02 -6.6168e-01 0.0000e+00
+-1.0749e-02 -6.9420e-01 0.0000e+00
++3.3507e-02 -7.3615e-01 0.0000e+00
++6.7327e-02 -7.7543e-01 0.0000e+00
+-7.3862e-01 +1.1718e-01 0.0000e+00
+-6.9960e-01 +8.5179e-02 0.0000e+00
+-6.6242e-01 +4.5074e-02 0.0000e+00
+-6.2562e-01 +2.4337e-03 0.0000e+00
+-5.8908e-01 -2.4276e-02 0.0000e+00
+-5.5087e-01 -6.6647e-02 0.0000e+00
+-5.1548e-01 -9.9392e-02 0.0000e+00
+-4.7518e-01 -1.4079e-01 0.0000e+00
+-4.4105e-01 -1.7584e-01 0.0000e+00
+-4.1322e-01 -2.1465e-01 0.0000e+00
+-3.7524e-01 -2.5514e-01 0.0000e+00
+-3.3295e-01 -2.9392e-01 0.0000e+00
+-2.9994e-01 -3.2937e-01 0.0000e+00
+-2.5980e-01 -3.6841e-01 0.0000e+00
+-2.2576e-01 -3.9514e-01 0.0000e+00
+-1.8969e-01 -4.3471e-01 0.0000e+00
+-1.5387e-01 -4.7636e-01 0.0000e+00
+-1.2263e-01 -5.1429e-01 0.0000e+00
+-7.9846e-02 -5.4686e-01 0.0000e+00
+-3.9117e-02 -5.8838e-01 0.0000e+00
+-9.1198e-03 -6.2140e-01 0.0000e+00
++3.2110e-02 -6.6576e-01 0.0000e+00
++5.9366e-02 -7.0121e-01 0.0000e+00
++9.9402e-02 -7.3345e-01 0.0000e+00
+-7.3557e-01 +1.9245e-01 0.0000e+00
+-6.9853e-01 +1.5446e-01 0.0000e+00
+-6.5713e-01 +1.1944e-01 0.0000e+00
+-6.2524e-01 +8.4097e-02 0.0000e+00
+-5.9197e-01 +4.7064e-02 0.0000e+00
+-5.5446e-01 +5.9845e-03 0.0000e+00
+-5.1423e-01 -3.5639e-02 0.0000e+00
+-4.8238e-01 -6.5362e-02 0.0000e+00
+-4.4096e-01 -1.0362e-01 0.0000e+00
+-4.0647e-01 -1.4444e-01 0.0000e+00
+-3.6949e-01 -1.8059e-01 0.0000e+00
+-3.3151e-01 -2.1479e-01 0.0000e+00
+-2.9558e-01 -2.5158e-01 0.0000e+00
+-2.6779e-01 -2.9073e-01 0.0000e+00
+-2.2197e-01 -3.2663e-01 0.0000e+00
+-1.8986e-01 -3.6260e-01 0.0000e+00
+-1.4934e-01 -3.9897e-01 0.0000e+00
+-1.2162e-01 -4.4030e-01 0.0000e+00
+-8.0639e-02 -4.7479e-01 0.0000e+00
+-3.7894e-02 -5.1303e-01 0.0000e+00
+-6.0566e-03 -5.5390e-01 0.0000e+00
++2.5490e-02 -5.8954e-01 0.0000e+00
++6.1240e-02 -6.2837e-01 0.0000e+00
++1.0368e-01 -6.5945e-01 0.0000e+00
++1.3332e-01 -7.0074e-01 0.0000e+00
++1.7887e-01 -7.3918e-01 0.0000e+00
+-7.3157e-01 +2.6020e-01 0.0000e+00
+-6.9178e-01 +2.2807e-01 0.0000e+00
+-6.5538e-01 +1.8990e-01 0.0000e+00
+-6.2483e-01 +1.4914e-01 0.0000e+00
+-5.8416e-01 +1.1983e-01 0.0000e+00
+-5.5230e-01 +8.5211e-02 0.0000e+00
+-5.1385e-01 +4.0143e-02 0.0000e+00
+-4.7709e-01 +1.1313e-02 0.0000e+00
+-4.4315e-01 -2.5976e-02 0.0000e+00
+-4.0608e-01 -7.3421e-02 0.0000e+00
+-3.7001e-01 -1.1238e-01 0.0000e+00
+-3.3176e-01 -1.3805e-01 0.0000e+00
+-2.9771e-01 -1.8245e-01 0.0000e+00
+-2.5936e-01 -2.1772e-01 0.0000e+00
+-2.1753e-01 -2.5410e-01 0.0000e+00
+-1.8652e-01 -2.8697e-01 0.0000e+00
+-1.4944e-01 -3.2457e-01 0.0000e+00
+-1.1438e-01 -3.6602e-01 0.0000e+00
+-7.8926e-02 -4.0779e-01 0.0000e+00
+-4.5288e-02 -4.4322e-01 0.0000e+00
+-7.3313e-03 -4.7957e-01 0.0000e+00
++3.3903e-02 -5.1447e-01 0.0000e+00
++6.5548e-02 -5.5293e-01 0.0000e+00
++9.9768e-02 -5.9275e-01 0.0000e+00
++1.3818e-01 -6.2799e-01 0.0000e+00
++1.7479e-01 -6.6291e-01 0.0000e+00
++2.1497e-01 -7.0412e-01 0.0000e+00
+-6.8846e-01 +3.0277e-01 0.0000e+00
+-6.6323e-01 +2.6271e-01 0.0000e+00
+-6.2793e-01 +2.2859e-01 0.0000e+00
+-5.9219e-01 +1.9195e-01 0.0000e+00
+-5.5255e-01 +1.4963e-01 0.0000e+00
+-5.1625e-01 +1.1449e-01 0.0000e+00
+-4.7764e-01 +7.3124e-02 0.0000e+00
+-4.4010e-01 +4.7403e-02 0.0000e+00
+-4.0527e-01 +1.1754e-03 0.0000e+00
+-3.6699e-01 -3.4021e-02 0.0000e+00
+-3.3585e-01 -6.6691e-02 0.0000e+00
+-2.9603e-01 -1.0748e-01 0.0000e+00
+-2.6081e-01 -1.4034e-01 0.0000e+00
+-2.2353e-01 -1.7711e-01 0.0000e+00
+-1.8379e-01 -2.1987e-01 0.0000e+00
+-1.4950e-01 -2.5532e-01 0.0000e+00
+-1.1245e-01 -2.8882e-01 0.0000e+00
+-7.1309e-02 -3.2993e-01 0.0000e+00
+-3.9969e-02 -3.6823e-01 0.0000e+00
+-5.2828e-03 -4.0390e-01 0.0000e+00
++2.7969e-02 -4.3888e-01 0.0000e+00
++6.6699e-02 -4.7805e-01 0.0000e+00
++1.0380e-01 -5.1687e-01 0.0000e+00
++1.4742e-01 -5.5381e-01 0.0000e+00
++1.7736e-01 -5.9372e-01 0.0000e+00
++2.1423e-01 -6.2614e-01 0.0000e+00
++2.5036e-01 -6.6873e-01 0.0000e+00
++2.8645e-01 -7.0215e-01 0.0000e+00
+-6.5955e-01 +3.3732e-01 0.0000e+00
+-6.2420e-01 +3.0530e-01 0.0000e+00
+-5.8507e-01 +2.6350e-01 0.0000e+00
+-5.5122e-01 +2.2339e-01 0.0000e+00
+-5.0733e-01 +1.8860e-01 0.0000e+00
+-4.7610e-01 +1.5465e-01 0.0000e+00
+-4.4613e-01 +1.1476e-01 0.0000e+00
+-4.0567e-01 +7.5624e-02 0.0000e+00
+-3.6427e-01 +4.3306e-02 0.0000e+00
+-3.3033e-01 +1.3468e-03 0.0000e+00
+-2.9876e-01 -3.2779e-02 0.0000e+00
+-2.6019e-01 -7.5934e-02 0.0000e+00
+-2.1579e-01 -1.0863e-01 0.0000e+00
+-1.8888e-01 -1.4169e-01 0.0000e+00
+-1.4406e-01 -1.8212e-01 0.0000e+00
+-1.1403e-01 -2.2435e-01 0.0000e+00
+-7.8582e-02 -2.5322e-01 0.0000e+00
+-4.3906e-02 -2.9714e-01 0.0000e+00
+-3.1897e-03 -3.3203e-01 0.0000e+00
++3.1070e-02 -3.7204e-01 0.0000e+00
++6.8707e-02 -3.9907e-01 0.0000e+00
++1.0061e-01 -4.4523e-01 0.0000e+00
++1.4596e-01 -4.8244e-01 0.0000e+00
++1.7307e-01 -5.1778e-01 0.0000e+00
++2.1750e-01 -5.5161e-01 0.0000e+00
++2.5597e-01 -5.9097e-01 0.0000e+00
++2.8443e-01 -6.2763e-01 0.0000e+00
++3.2502e-01 -6.6631e-01 0.0000e+00
+-6.5961e-01 +4.1647e-01 0.0000e+00
+-6.1892e-01 +3.7360e-01 0.0000e+00
+-5.8407e-01 +3.4385e-01 0.0000e+00
+-5.4301e-01 +3.0038e-01 0.0000e+00
+-5.1257e-01 +2.6589e-01 0.0000e+00
+-4.6990e-01 +2.2787e-01 0.0000e+00
+-4.3899e-01 +1.9316e-01 0.0000e+00
+-4.0617e-01 +1.4807e-01 0.0000e+00
+-3.6699e-01 +1.1183e-01 0.0000e+00
+-3.2788e-01 +7.5813e-02 0.0000e+00
+-2.9310e-01 +3.8338e-02 0.0000e+00
+-2.5925e-01 +3.7639e-03 0.0000e+00
+-2.2206e-01 -3.3913e-02 0.0000e+00
+-1.8744e-01 -6.9214e-02 0.0000e+00
+-1.4323e-01 -1.1056e-01 0.0000e+00
+-1.1774e-01 -1.4652e-01 0.0000e+00
+-7.9394e-02 -1.8632e-01 0.0000e+00
+-3.8694e-02 -2.2014e-01 0.0000e+00
+-4.1348e-03 -2.6170e-01 0.0000e+00
++3.2226e-02 -2.9254e-01 0.0000e+00
++6.9614e-02 -3.3562e-01 0.0000e+00
++1.0336e-01 -3.6648e-01 0.0000e+00
++1.4054e-01 -4.0779e-01 0.0000e+00
++1.8244e-01 -4.4488e-01 0.0000e+00
++2.1608e-01 -4.7843e-01 0.0000e+00
++2.4934e-01 -5.2180e-01 0.0000e+00
++2.8622e-01 -5.5384e-01 0.0000e+00
++3.2480e-01 -5.9284e-01 0.0000e+00
++3.5869e-01 -6.3267e-01 0.0000e+00
++3.9333e-01 -6.6736e-01 0.0000e+00
+-6.1804e-01 +4.5158e-01 0.0000e+00
+-5.8327e-01 +4.1395e-01 0.0000e+00
+-5.4888e-01 +3.7479e-01 0.0000e+00
+-5.1284e-01 +3.4108e-01 0.0000e+00
+-4.7763e-01 +3.0109e-01 0.0000e+00
+-4.3219e-01 +2.6371e-01 0.0000e+00
+-4.0105e-01 +2.2188e-01 0.0000e+00
+-3.6523e-01 +1.9195e-01 0.0000e+00
+-3.3156e-01 +1.5565e-01 0.0000e+00
+-2.9070e-01 +1.1135e-01 0.0000e+00
+-2.5704e-01 +7.3462e-02 0.0000e+00
+-2.2227e-01 +3.8575e-02 0.0000e+00
+-1.8639e-01 +4.6676e-03 0.0000e+00
+-1.4133e-01 -3.4325e-02 0.0000e+00
+-1.0909e-01 -7.0231e-02 0.0000e+00
+-6.9604e-02 -1.1002e-01 0.0000e+00
+-4.0818e-02 -1.4551e-01 0.0000e+00
+-6.4768e-03 -1.8519e-01 0.0000e+00
++3.3106e-02 -2.2194e-01 0.0000e+00
++7.0884e-02 -2.5963e-01 0.0000e+00
++1.0190e-01 -2.9569e-01 0.0000e+00
++1.4231e-01 -3.3515e-01 0.0000e+00
++1.7624e-01 -3.7381e-01 0.0000e+00
++2.1730e-01 -4.0852e-01 0.0000e+00
++2.4597e-01 -4.4370e-01 0.0000e+00
++2.8837e-01 -4.7471e-01 0.0000e+00
++3.2309e-01 -5.2044e-01 0.0000e+00
++3.5742e-01 -5.5656e-01 0.0000e+00
++3.9830e-01 -5.9614e-01 0.0000e+00
++4.3779e-01 -6.2858e-01 0.0000e+00
+-5.8283e-01 +4.7926e-01 0.0000e+00
+-5.4305e-01 +4.4508e-01 0.0000e+00
+-5.0651e-01 +4.1439e-01 0.0000e+00
+-4.8060e-01 +3.7355e-01 0.0000e+00
+-4.4115e-01 +3.3874e-01 0.0000e+00
+-4.0141e-01 +3.0545e-01 0.0000e+00
+-3.6619e-01 +2.6212e-01 0.0000e+00
+-3.2365e-01 +2.2279e-01 0.0000e+00
+-2.8997e-01 +1.8999e-01 0.0000e+00
+-2.5333e-01 +1.4863e-01 0.0000e+00
+-2.1708e-01 +1.1721e-01 0.0000e+00
+-1.7973e-01 +7.6090e-02 0.0000e+00
+-1.5255e-01 +3.7217e-02 0.0000e+00
+-1.0813e-01 +1.7957e-03 0.0000e+00
+-7.2143e-02 -3.7719e-02 0.0000e+00
+-3.5220e-02 -7.2677e-02 0.0000e+00
+-3.1118e-03 -1.1060e-01 0.0000e+00
++3.6573e-02 -1.4933e-01 0.0000e+00
++7.3588e-02 -1.8824e-01 0.0000e+00
++1.1253e-01 -2.2255e-01 0.0000e+00
++1.4364e-01 -2.5819e-01 0.0000e+00
++1.8702e-01 -2.9650e-01 0.0000e+00
++2.1612e-01 -3.3923e-01 0.0000e+00
++2.5090e-01 -3.7427e-01 0.0000e+00
++2.9000e-01 -4.0341e-01 0.0000e+00
++3.2150e-01 -4.4593e-01 0.0000e+00
++3.5734e-01 -4.8111e-01 0.0000e+00
++3.9403e-01 -5.1764e-01 0.0000e+00
++4.3232e-01 -5.5932e-01 0.0000e+00
++4.7382e-01 -5.8995e-01 0.0000e+00
+-5.4615e-01 +5.2329e-01 0.0000e+00
+-5.1223e-01 +4.8493e-01 0.0000e+00
+-4.7311e-01 +4.5145e-01 0.0000e+00
+-4.3718e-01 +4.1534e-01 0.0000e+00
+-3.9970e-01 +3.7074e-01 0.0000e+00
+-3.6147e-01 +3.3824e-01 0.0000e+00
+-3.2469e-01 +2.9597e-01 0.0000e+00
+-2.8920e-01 +2.6389e-01 0.0000e+00
+-2.5833e-01 +2.2281e-01 0.0000e+00
+-2.1566e-01 +1.9013e-01 0.0000e+00
+-1.8136e-01 +1.4703e-01 0.0000e+00
+-1.5099e-01 +1.1388e-01 0.0000e+00
+-1.0357e-01 +7.5055e-02 0.0000e+00
+-6.7392e-02 +3.9074e-02 0.0000e+00
+-3.7603e-02 -4.3888e-03 0.0000e+00
+-5.0901e-03 -3.6907e-02 0.0000e+00
++3.6377e-02 -7.7328e-02 0.0000e+00
++6.8107e-02 -1.1083e-01 0.0000e+00
++1.0798e-01 -1.5356e-01 0.0000e+00
++1.4769e-01 -1.8714e-01 0.0000e+00
++1.8350e-01 -2.2573e-01 0.0000e+00
++2.1900e-01 -2.5508e-01 0.0000e+00
++2.5276e-01 -3.0074e-01 0.0000e+00
++2.9216e-01 -3.3155e-01 0.0000e+00
++3.3068e-01 -3.7441e-01 0.0000e+00
++3.6139e-01 -4.0482e-01 0.0000e+00
++3.9930e-01 -4.4369e-01 0.0000e+00
++4.3702e-01 -4.8692e-01 0.0000e+00
++4.7171e-01 -5.2025e-01 0.0000e+00
++5.0492e-01 -5.5560e-01 0.0000e+00
+-5.0520e-01 +5.5532e-01 0.0000e+00
+-4.6910e-01 +5.2420e-01 0.0000e+00
+-4.3410e-01 +4.8233e-01 0.0000e+00
+-4.0001e-01 +4.5000e-01 0.0000e+00
+-3.6129e-01 +4.1045e-01 0.0000e+00
+-3.2612e-01 +3.6791e-01 0.0000e+00
+-2.9051e-01 +3.3225e-01 0.0000e+00
+-2.5814e-01 +2.9429e-01 0.0000e+00
+-2.1856e-01 +2.5646e-01 0.0000e+00
+-1.8413e-01 +2.2286e-01 0.0000e+00
+-1.4703e-01 +1.8366e-01 0.0000e+00
+-1.0684e-01 +1.5009e-01 0.0000e+00
+-7.1633e-02 +1.1602e-01 0.0000e+00
+-3.5025e-02 +6.9629e-02 0.0000e+00
++1.7293e-03 +3.9699e-02 0.0000e+00
++3.7568e-02 -5.8528e-03 0.0000e+00
++7.2927e-02 -3.2527e-02 0.0000e+00
++1.1213e-01 -7.3492e-02 0.0000e+00
++1.4074e-01 -1.1380e-01 0.0000e+00
++1.8222e-01 -1.5325e-01 0.0000e+00
++2.2108e-01 -1.9014e-01 0.0000e+00
++2.5298e-01 -2.2128e-01 0.0000e+00
++2.8730e-01 -2.6072e-01 0.0000e+00
++3.3273e-01 -2.9952e-01 0.0000e+00
++3.6587e-01 -3.3153e-01 0.0000e+00
++4.0172e-01 -3.7091e-01 0.0000e+00
++4.4152e-01 -4.0780e-01 0.0000e+00
++4.6938e-01 -4.4836e-01 0.0000e+00
++5.1403e-01 -4.8644e-01 0.0000e+00
++5.4285e-01 -5.2315e-01 0.0000e+00
+-4.6906e-01 +5.9219e-01 0.0000e+00
+-4.3747e-01 +5.6066e-01 0.0000e+00
+-3.9492e-01 +5.2354e-01 0.0000e+00
+-3.6060e-01 +4.7865e-01 0.0000e+00
+-3.2292e-01 +4.4865e-01 0.0000e+00
+-2.9067e-01 +4.0639e-01 0.0000e+00
+-2.5541e-01 +3.6956e-01 0.0000e+00
+-2.1452e-01 +3.2946e-01 0.0000e+00
+-1.7913e-01 +3.0247e-01 0.0000e+00
+-1.4598e-01 +2.5402e-01 0.0000e+00
+-1.1323e-01 +2.2270e-01 0.0000e+00
+-7.0716e-02 +1.8286e-01 0.0000e+00
+-3.4226e-02 +1.5166e-01 0.0000e+00
+-1.0956e-03 +1.0847e-01 0.0000e+00
++4.0810e-02 +7.5696e-02 0.0000e+00
++7.1882e-02 +3.8100e-02 0.0000e+00
++1.1407e-01 -4.7990e-03 0.0000e+00
++1.4643e-01 -4.0731e-02 0.0000e+00
++1.8820e-01 -7.5057e-02 0.0000e+00
++2.2072e-01 -1.1013e-01 0.0000e+00
++2.5254e-01 -1.5231e-01 0.0000e+00
++2.8870e-01 -1.8591e-01 0.0000e+00
++3.2911e-01 -2.2363e-01 0.0000e+00
++3.6109e-01 -2.6545e-01 0.0000e+00
++4.0426e-01 -2.9639e-01 0.0000e+00
++4.3513e-01 -3.3441e-01 0.0000e+00
++4.7163e-01 -3.7492e-01 0.0000e+00
++5.1332e-01 -4.0670e-01 0.0000e+00
++5.4774e-01 -4.4952e-01 0.0000e+00
++5.7867e-01 -4.8778e-01 0.0000e+00
+-4.3512e-01 +6.3049e-01 0.0000e+00
+-3.9920e-01 +5.9424e-01 0.0000e+00
+-3.6227e-01 +5.5871e-01 0.0000e+00
+-3.2085e-01 +5.2147e-01 0.0000e+00
+-2.9270e-01 +4.8300e-01 0.0000e+00
+-2.5832e-01 +4.4416e-01 0.0000e+00
+-2.1850e-01 +4.0485e-01 0.0000e+00
+-1.8211e-01 +3.7099e-01 0.0000e+00
+-1.4404e-01 +3.2641e-01 0.0000e+00
+-1.0192e-01 +2.9608e-01 0.0000e+00
+-7.7080e-02 +2.5921e-01 0.0000e+00
+-3.9300e-02 +2.2174e-01 0.0000e+00
+-3.1073e-03 +1.8516e-01 0.0000e+00
++4.1551e-02 +1.4972e-01 0.0000e+00
++7.5413e-02 +1.0673e-01 0.0000e+00
++1.1376e-01 +6.8567e-02 0.0000e+00
++1.4443e-01 +3.5504e-02 0.0000e+00
++1.8513e-01 -3.3113e-03 0.0000e+00
++2.1970e-01 -3.6832e-02 0.0000e+00
++2.5352e-01 -7.7623e-02 0.0000e+00
++2.9498e-01 -1.1760e-01 0.0000e+00
++3.2941e-01 -1.5192e-01 0.0000e+00
++3.6505e-01 -1.8443e-01 0.0000e+00
++3.9854e-01 -2.2759e-01 0.0000e+00
++4.3716e-01 -2.6306e-01 0.0000e+00
++4.6922e-01 -2.9978e-01 0.0000e+00
++5.1345e-01 -3.3924e-01 0.0000e+00
++5.5036e-01 -3.7735e-01 0.0000e+00
++5.8663e-01 -4.1446e-01 0.0000e+00
++6.2046e-01 -4.5487e-01 0.0000e+00
+-3.9060e-01 +6.6661e-01 0.0000e+00
+-3.6319e-01 +6.2762e-01 0.0000e+00
+-3.2789e-01 +5.9319e-01 0.0000e+00
+-2.8872e-01 +5.5525e-01 0.0000e+00
+-2.4906e-01 +5.1801e-01 0.0000e+00
+-2.1892e-01 +4.8219e-01 0.0000e+00
+-1.7661e-01 +4.4879e-01 0.0000e+00
+-1.4714e-01 +4.0568e-01 0.0000e+00
+-1.0793e-01 +3.6478e-01 0.0000e+00
+-7.4179e-02 +3.3404e-01 0.0000e+00
+-3.3171e-02 +2.9109e-01 0.0000e+00
+-1.7391e-03 +2.5776e-01 0.0000e+00
++3.4060e-02 +2.2046e-01 0.0000e+00
++7.4999e-02 +1.7996e-01 0.0000e+00
++1.1567e-01 +1.4222e-01 0.0000e+00
++1.5404e-01 +1.0858e-01 0.0000e+00
++1.8650e-01 +6.9540e-02 0.0000e+00
++2.1753e-01 +3.5744e-02 0.0000e+00
++2.5417e-01 -2.2522e-03 0.0000e+00
++2.9044e-01 -3.6960e-02 0.0000e+00
++3.3029e-01 -7.8884e-02 0.0000e+00
++3.6924e-01 -1.1148e-01 0.0000e+00
++4.0556e-01 -1.4778e-01 0.0000e+00
++4.3642e-01 -1.8809e-01 0.0000e+00
++4.7601e-01 -2.2171e-01 0.0000e+00
++5.0790e-01 -2.6398e-01 0.0000e+00
++5.5193e-01 -2.9871e-01 0.0000e+00
++5.8312e-01 -3.4155e-01 0.0000e+00
++6.2024e-01 -3.7789e-01 0.0000e+00
++6.5853e-01 -4.0759e-01 0.0000e+00
+-3.2409e-01 +6.6570e-01 0.0000e+00
+-2.9067e-01 +6.2843e-01 0.0000e+00
+-2.5201e-01 +5.8787e-01 0.0000e+00
+-2.1830e-01 +5.5345e-01 0.0000e+00
+-1.7705e-01 +5.2199e-01 0.0000e+00
+-1.4093e-01 +4.7450e-01 0.0000e+00
+-1.0344e-01 +4.4068e-01 0.0000e+00
+-6.7163e-02 +4.0654e-01 0.0000e+00
+-3.1737e-02 +3.6623e-01 0.0000e+00
++1.2691e-03 +3.2666e-01 0.0000e+00
++3.6464e-02 +2.9618e-01 0.0000e+00
++8.2957e-02 +2.5591e-01 0.0000e+00
++1.0981e-01 +2.1884e-01 0.0000e+00
++1.4703e-01 +1.8202e-01 0.0000e+00
++1.8729e-01 +1.4682e-01 0.0000e+00
++2.1582e-01 +1.0698e-01 0.0000e+00
++2.5611e-01 +7.3573e-02 0.0000e+00
++2.9194e-01 +3.5847e-02 0.0000e+00
++3.3615e-01 -5.3040e-03 0.0000e+00
++3.6879e-01 -3.9832e-02 0.0000e+00
++3.9944e-01 -7.8874e-02 0.0000e+00
++4.4071e-01 -1.1013e-01 0.0000e+00
++4.7896e-01 -1.5129e-01 0.0000e+00
++5.0971e-01 -1.9259e-01 0.0000e+00
++5.4634e-01 -2.2912e-01 0.0000e+00
++5.9179e-01 -2.6403e-01 0.0000e+00
++6.2103e-01 -3.0196e-01 0.0000e+00
++6.5445e-01 -3.3726e-01 0.0000e+00
+-2.8956e-01 +7.0554e-01 0.0000e+00
+-2.5015e-01 +6.6890e-01 0.0000e+00
+-2.0962e-01 +6.3009e-01 0.0000e+00
+-1.7753e-01 +5.8864e-01 0.0000e+00
+-1.4437e-01 +5.5710e-01 0.0000e+00
+-1.0627e-01 +5.1903e-01 0.0000e+00
+-7.1019e-02 +4.8320e-01 0.0000e+00
+-3.8067e-02 +4.4159e-01 0.0000e+00
++2.6500e-03 +4.0826e-01 0.0000e+00
++4.1314e-02 +3.6872e-01 0.0000e+00
++7.5943e-02 +3.3578e-01 0.0000e+00
++1.1344e-01 +2.9771e-01 0.0000e+00
++1.5089e-01 +2.5676e-01 0.0000e+00
++1.8727e-01 +2.1275e-01 0.0000e+00
++2.2339e-01 +1.8556e-01 0.0000e+00
++2.5852e-01 +1.3872e-01 0.0000e+00
++2.9247e-01 +1.0481e-01 0.0000e+00
++3.3079e-01 +6.6849e-02 0.0000e+00
++3.6651e-01 +2.7126e-02 0.0000e+00
++4.0393e-01 -8.5442e-04 0.0000e+00
++4.3875e-01 -4.6641e-02 0.0000e+00
++4.7199e-01 -8.1171e-02 0.0000e+00
++5.1079e-01 -1.1223e-01 0.0000e+00
++5.4927e-01 -1.5705e-01 0.0000e+00
++5.8229e-01 -1.9375e-01 0.0000e+00
++6.2539e-01 -2.3041e-01 0.0000e+00
++6.5899e-01 -2.6804e-01 0.0000e+00
++6.9751e-01 -3.0567e-01 0.0000e+00
+-2.1302e-01 +7.0622e-01 0.0000e+00
+-1.7709e-01 +6.6895e-01 0.0000e+00
+-1.4124e-01 +6.2596e-01 0.0000e+00
+-1.0335e-01 +5.8856e-01 0.0000e+00
+-6.4438e-02 +5.5545e-01 0.0000e+00
+-2.9769e-02 +5.1414e-01 0.0000e+00
++4.1944e-03 +4.8135e-01 0.0000e+00
++4.4261e-02 +4.3753e-01 0.0000e+00
++7.7921e-02 +4.0276e-01 0.0000e+00
++1.1685e-01 +3.7147e-01 0.0000e+00
++1.4745e-01 +3.2633e-01 0.0000e+00
++1.8480e-01 +2.9470e-01 0.0000e+00
++2.1693e-01 +2.5527e-01 0.0000e+00
++2.6025e-01 +2.1297e-01 0.0000e+00
++3.0246e-01 +1.8064e-01 0.0000e+00
++3.3282e-01 +1.4999e-01 0.0000e+00
++3.6785e-01 +1.0696e-01 0.0000e+00
++3.9969e-01 +7.0243e-02 0.0000e+00
++4.4373e-01 +3.2447e-02 0.0000e+00
++4.7565e-01 -1.0296e-02 0.0000e+00
++5.1223e-01 -4.0536e-02 0.0000e+00
++5.4930e-01 -8.2617e-02 0.0000e+00
++5.8794e-01 -1.2129e-01 0.0000e+00
++6.1900e-01 -1.5551e-01 0.0000e+00
++6.6278e-01 -1.9170e-01 0.0000e+00
++6.9702e-01 -2.2844e-01 0.0000e+00
++7.2786e-01 -2.6553e-01 0.0000e+00
+-1.7557e-01 +7.4201e-01 0.0000e+00
+-1.3921e-01 +7.0335e-01 0.0000e+00
+-1.0953e-01 +6.6364e-01 0.0000e+00
+-6.4371e-02 +6.2945e-01 0.0000e+00
+-2.9335e-02 +5.8336e-01 0.0000e+00
++2.5782e-04 +5.5246e-01 0.0000e+00
++4.1528e-02 +5.1497e-01 0.0000e+00
++8.0559e-02 +4.7772e-01 0.0000e+00
++1.1995e-01 +4.4125e-01 0.0000e+00
++1.5325e-01 +4.0711e-01 0.0000e+00
++1.8842e-01 +3.6074e-01 0.0000e+00
++2.2326e-01 +3.2422e-01 0.0000e+00
++2.6197e-01 +2.8998e-01 0.0000e+00
++2.9937e-01 +2.5191e-01 0.0000e+00
++3.2934e-01 +2.1845e-01 0.0000e+00
++3.6962e-01 +1.8085e-01 0.0000e+00
++4.0647e-01 +1.3538e-01 0.0000e+00
++4.3957e-01 +1.0341e-01 0.0000e+00
++4.7812e-01 +7.2798e-02 0.0000e+00
++5.1867e-01 +3.1900e-02 0.0000e+00
++5.4898e-01 -7.2433e-03 0.0000e+00
++5.8739e-01 -4.3396e-02 0.0000e+00
++6.2370e-01 -8.1770e-02 0.0000e+00
++6.6197e-01 -1.2100e-01 0.0000e+00
++7.0270e-01 -1.5562e-01 0.0000e+00
++7.3465e-01 -1.9577e-01 0.0000e+00
+-1.0457e-01 +7.3558e-01 0.0000e+00
+-6.6586e-02 +7.0346e-01 0.0000e+00
+-2.5226e-02 +6.5968e-01 0.0000e+00
++4.8903e-03 +6.2742e-01 0.0000e+00
++4.4709e-02 +5.9171e-01 0.0000e+00
++8.0168e-02 +5.4969e-01 0.0000e+00
++1.2176e-01 +5.1526e-01 0.0000e+00
++1.4836e-01 +4.7495e-01 0.0000e+00
++1.8732e-01 +4.3659e-01 0.0000e+00
++2.2338e-01 +3.9786e-01 0.0000e+00
++2.6070e-01 +3.6019e-01 0.0000e+00
++2.9843e-01 +3.2109e-01 0.0000e+00
++3.3093e-01 +2.9327e-01 0.0000e+00
++3.7103e-01 +2.5098e-01 0.0000e+00
++4.0499e-01 +2.1759e-01 0.0000e+00
++4.4508e-01 +1.7569e-01 0.0000e+00
++4.7742e-01 +1.4386e-01 0.0000e+00
++5.1588e-01 +1.0339e-01 0.0000e+00
++5.5553e-01 +7.0136e-02 0.0000e+00
++5.8621e-01 +3.3982e-02 0.0000e+00
++6.2193e-01 -4.0478e-03 0.0000e+00
++6.6142e-01 -4.8055e-02 0.0000e+00
++6.9306e-01 -8.1866e-02 0.0000e+00
++7.3255e-01 -1.2120e-01 0.0000e+00
+-6.5508e-02 +7.7749e-01 0.0000e+00
+-2.4033e-02 +7.3780e-01 0.0000e+00
++1.0613e-02 +7.0253e-01 0.0000e+00
++4.5316e-02 +6.6668e-01 0.0000e+00
++8.6407e-02 +6.2480e-01 0.0000e+00
++1.1406e-01 +5.8887e-01 0.0000e+00
++1.5243e-01 +5.4835e-01 0.0000e+00
++1.8668e-01 +5.1570e-01 0.0000e+00
++2.2097e-01 +4.7657e-01 0.0000e+00
++2.6606e-01 +4.4241e-01 0.0000e+00
++2.9877e-01 +3.9939e-01 0.0000e+00
++3.3820e-01 +3.6133e-01 0.0000e+00
++3.7132e-01 +3.3203e-01 0.0000e+00
++4.0496e-01 +2.9190e-01 0.0000e+00
++4.4613e-01 +2.5709e-01 0.0000e+00
++4.8056e-01 +2.1597e-01 0.0000e+00
++5.1692e-01 +1.8133e-01 0.0000e+00
++5.5185e-01 +1.3816e-01 0.0000e+00
++5.8716e-01 +1.0770e-01 0.0000e+00
++6.2610e-01 +6.3480e-02 0.0000e+00
++6.6272e-01 +2.2257e-02 0.0000e+00
++7.0048e-01 -7.8791e-03 0.0000e+00
++7.3340e-01 -4.2819e-02 0.0000e+00
++7.7456e-01 -8.1748e-02 0.0000e+00
++1.1594e-02 +7.7463e-01 0.0000e+00
++4.9196e-02 +7.3518e-01 0.0000e+00
++8.4077e-02 +6.9976e-01 0.0000e+00
++1.1676e-01 +6.6321e-01 0.0000e+00
++1.5494e-01 +6.2413e-01 0.0000e+00
++1.8611e-01 +5.8657e-01 0.0000e+00
++2.2736e-01 +5.4579e-01 0.0000e+00
++2.6465e-01 +5.0565e-01 0.0000e+00
++3.0497e-01 +4.7552e-01 0.0000e+00
++3.4005e-01 +4.3933e-01 0.0000e+00
++3.7799e-01 +3.9950e-01 0.0000e+00
++4.0653e-01 +3.6666e-01 0.0000e+00
++4.4580e-01 +3.2322e-01 0.0000e+00
++4.8508e-01 +2.8617e-01 0.0000e+00
++5.1795e-01 +2.5798e-01 0.0000e+00
++5.5247e-01 +2.1746e-01 0.0000e+00
++5.9680e-01 +1.7651e-01 0.0000e+00
++6.3253e-01 +1.3970e-01 0.0000e+00
++6.6198e-01 +1.0747e-01 0.0000e+00
++6.9803e-01 +6.0318e-02 0.0000e+00
++7.3563e-01 +2.2949e-02 0.0000e+00
++7.7330e-01 -6.4376e-03 0.0000e+00
++8.8838e-02 +7.7289e-01 0.0000e+00
++1.1648e-01 +7.3850e-01 0.0000e+00
++1.5258e-01 +7.0001e-01 0.0000e+00
++1.9357e-01 +6.6292e-01 0.0000e+00
++2.2621e-01 +6.2179e-01 0.0000e+00
++2.7005e-01 +5.8720e-01 0.0000e+00
++3.0801e-01 +5.4809e-01 0.0000e+00
++3.3739e-01 +5.1575e-01 0.0000e+00
++3.7188e-01 +4.6864e-01 0.0000e+00
++4.1246e-01 +4.3584e-01 0.0000e+00
++4.4738e-01 +4.0183e-01 0.0000e+00
++4.8249e-01 +3.5684e-01 0.0000e+00
++5.1905e-01 +3.2446e-01 0.0000e+00
++5.5429e-01 +2.9273e-01 0.0000e+00
++5.9197e-01 +2.4907e-01 0.0000e+00
++6.3030e-01 +2.0992e-01 0.0000e+00
++6.6502e-01 +1.8242e-01 0.0000e+00
++6.9805e-01 +1.3701e-01 0.0000e+00
++7.3550e-01 +9.5982e-02 0.0000e+00
++7.7785e-01 +6.2057e-02 0.0000e+00
++1.8931e-01 +7.3306e-01 0.0000e+00
++2.3141e-01 +6.9915e-01 0.0000e+00
++2.6502e-01 +6.6145e-01 0.0000e+00
++2.9873e-01 +6.2367e-01 0.0000e+00
++3.3423e-01 +5.8699e-01 0.0000e+00
++3.7464e-01 +5.4693e-01 0.0000e+00
++4.0379e-01 +5.1004e-01 0.0000e+00
++4.4895e-01 +4.6804e-01 0.0000e+00
++4.8529e-01 +4.3367e-01 0.0000e+00
++5.1960e-01 +3.9267e-01 0.0000e+00
++5.5997e-01 +3.6158e-01 0.0000e+00
++5.9264e-01 +3.3015e-01 0.0000e+00
++6.3005e-01 +2.8704e-01 0.0000e+00
++6.7010e-01 +2.4997e-01 0.0000e+00
++7.0654e-01 +2.1100e-01 0.0000e+00
++7.3585e-01 +1.7523e-01 0.0000e+00
++3.0613e-01 +6.9574e-01 0.0000e+00
++3.3675e-01 +6.5666e-01 0.0000e+00
++3.7522e-01 +6.1821e-01 0.0000e+00
++4.0936e-01 +5.7926e-01 0.0000e+00
++4.4610e-01 +5.4785e-01 0.0000e+00
++4.8919e-01 +5.0829e-01 0.0000e+00
++5.1779e-01 +4.7258e-01 0.0000e+00
++5.6369e-01 +4.3458e-01 0.0000e+00
++5.9720e-01 +3.9928e-01 0.0000e+00
++6.2553e-01 +3.6127e-01 0.0000e+00
++6.7126e-01 +3.2337e-01 0.0000e+00
++7.0503e-01 +2.8640e-01 0.0000e+00
++4.1128e-01 +6.5810e-01 0.0000e+00
++4.5114e-01 +6.2273e-01 0.0000e+00
++4.8773e-01 +5.8295e-01 0.0000e+00
++5.1891e-01 +5.4962e-01 0.0000e+00
++5.5677e-01 +5.0782e-01 0.0000e+00
++5.9417e-01 +4.6574e-01 0.0000e+00
++6.3071e-01 +4.3172e-01 0.0000e+00
++6.6629e-01 +3.9534e-01 0.0000e+00
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/field/examples/tutorials/output/ex1_da.out ex1_da.tmp > diff-runex1_da.out 2> diff-runex1_da.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dm_type da -dim 2 -num_components 2 -num_point_tests 2 -num_fe_tests 2 -num_fv_tests 2 -dmfield_view  > ex1_da.tmp 2> runex1_da.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/field/examples/tutorials/output/ex1_da_1.out ex1_da_1.tmp > diff-runex1_da_1.out 2> diff-runex1_da_1.out
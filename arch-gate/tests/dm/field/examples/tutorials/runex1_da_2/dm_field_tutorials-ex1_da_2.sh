@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dm_type da -dim 2 -num_fe_tests 2  > ex1_da_2.tmp 2> runex1_da_2.err
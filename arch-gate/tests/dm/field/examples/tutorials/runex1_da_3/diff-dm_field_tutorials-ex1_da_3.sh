@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/field/examples/tutorials/output/ex1_da_3.out ex1_da_3.tmp > diff-runex1_da_3.out 2> diff-runex1_da_3.out
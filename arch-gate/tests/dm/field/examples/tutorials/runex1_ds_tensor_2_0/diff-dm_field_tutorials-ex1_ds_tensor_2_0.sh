@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/field/examples/tutorials/output/ex1_ds_tensor_2_0.out ex1_ds_tensor_2_0.tmp > diff-runex1_ds_tensor_2_0.out 2> diff-runex1_ds_tensor_2_0.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dm_type plex -dim 2 -num_fe_tests 2 -petscspace_poly_tensor 1 -petscspace_degree 0 -simplex 0  > ex1_ds_tensor_2_0.tmp 2> runex1_ds_tensor_2_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex10_0.out ex10_0.tmp > diff-runex10_0.out 2> diff-runex10_0.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex10 -dim 3 -interpolate 1 -cell_simplex 0 -num_dof 1,0,0,0 -mat_view  > ex10_3.tmp 2> runex10_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex10 -dim 2 -interpolate 1 -cell_simplex 0 -refinement_uniform -num_dof 1,0,0  > ex10_5.tmp 2> runex10_5.err
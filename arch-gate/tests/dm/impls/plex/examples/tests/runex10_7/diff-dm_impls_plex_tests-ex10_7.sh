@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex10_7.out ex10_7.tmp > diff-runex10_7.out 2> diff-runex10_7.out
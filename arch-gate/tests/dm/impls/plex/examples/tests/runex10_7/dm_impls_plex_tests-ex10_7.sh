@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex10 -dim 3 -interpolate 1 -cell_simplex 0 -refinement_uniform -num_dof 1,0,0,0  > ex10_7.tmp 2> runex10_7.err
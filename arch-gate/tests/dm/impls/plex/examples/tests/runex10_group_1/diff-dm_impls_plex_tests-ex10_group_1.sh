@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex10_group_1.out ex10_group_1.tmp > diff-runex10_group_1.out 2> diff-runex10_group_1.out
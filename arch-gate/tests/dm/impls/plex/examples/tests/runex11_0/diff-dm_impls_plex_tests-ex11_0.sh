@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex11_0.out ex11_0.tmp > diff-runex11_0.out 2> diff-runex11_0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex18_1_1d_dist1.out ex18_1_1d_dist1.tmp > diff-runex18_1_1d_dist1.out 2> diff-runex18_1_1d_dist1.out
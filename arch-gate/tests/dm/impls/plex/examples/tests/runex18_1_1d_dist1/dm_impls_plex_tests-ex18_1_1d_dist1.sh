@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_geometry -dim 1 -distribute 1  > ex18_1_1d_dist1.tmp 2> runex18_1_1d_dist1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_geometry -cell_simplex 0 -distribute 0 -interpolate serial  > ex18_1_quad_dist0_interpolate-serial.tmp 2> runex18_1_quad_dist0_interpolate-serial.err
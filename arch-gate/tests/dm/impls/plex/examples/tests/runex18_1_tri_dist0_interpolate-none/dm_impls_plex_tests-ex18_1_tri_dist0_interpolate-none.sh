@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_geometry -distribute 0 -interpolate none  > ex18_1_tri_dist0_interpolate-none.tmp 2> runex18_1_tri_dist0_interpolate-none.err
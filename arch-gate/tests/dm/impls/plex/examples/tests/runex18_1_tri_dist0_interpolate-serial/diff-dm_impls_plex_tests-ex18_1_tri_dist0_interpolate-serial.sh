@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex18_1_tri_dist0_interpolate-serial.out ex18_1_tri_dist0_interpolate-serial.tmp > diff-runex18_1_tri_dist0_interpolate-serial.out 2> diff-runex18_1_tri_dist0_interpolate-serial.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex18 -testnum 1 -interpolate serial -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_geometry  > ex18_2.tmp 2> runex18_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -dim 3 -dm_view ascii::ascii_info_detail -distribute 0 -interpolate none  > ex18_4_tet_dist0_interpolate-none.tmp 2> runex18_4_tet_dist0_interpolate-none.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -dim 3 -distribute 0 -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_geometry  -rotate_interface_0 0 -rotate_interface_1 0 > ex18_4_tet_test_orient.tmp 2> runex18_4_tet_test_orient.err
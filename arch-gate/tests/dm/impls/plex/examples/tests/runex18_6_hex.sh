@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex18'
+testname='runex18_6_hex'
+label='dm_impls_plex_tests-ex18_6_hex'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-use_generator -dm_plex_check_symmetry -dm_plex_check_geometry -distribute -cell_simplex 0 -dm_plex_check_skeleton tensor'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+if ! $force; then
+    printf "ok ${label} # TODO fails due to wrong SF\n"
+    total=1; todo=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+
+
+nsize_in=${nsize:-1 2 4}
+interpolate_in=${interpolate:-none serial parallel}
+faces_in=${faces:-2,2,2  1,3,5  3,4,7}
+
+
+for nsize in ${nsize_in}; do
+   for interpolate in ${interpolate_in}; do
+      for faces in ${faces_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -interpolate ${interpolate} -faces ${faces}" ex18_6_hex.tmp ${testname}.err "${label}_nsize-${nsize}interpolate-${interpolate}_faces-${faces}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/dm/impls/plex/examples/tests/output/ex18_6_hex.out ex18_6_hex.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_nsize-${nsize}interpolate-${interpolate}_faces-${faces} ""
+         else
+            printf "ok ${label} # SKIP Command failed so no diff\n"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
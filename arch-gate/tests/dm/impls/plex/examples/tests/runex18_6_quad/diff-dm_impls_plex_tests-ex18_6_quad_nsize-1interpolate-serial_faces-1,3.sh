@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex18_6_quad.out ex18_6_quad.tmp > diff-runex18_6_quad.out 2> diff-runex18_6_quad.out
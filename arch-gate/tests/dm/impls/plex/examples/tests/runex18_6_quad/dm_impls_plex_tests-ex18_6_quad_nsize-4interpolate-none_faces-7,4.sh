@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex18 -use_generator -dm_plex_check_symmetry -dm_plex_check_geometry -distribute -cell_simplex 0 -dm_plex_check_skeleton tensor  -interpolate none -faces 7,4 > ex18_6_quad.tmp 2> runex18_6_quad.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_1d_0.out ex1_1d_0.tmp > diff-runex1_1d_0.out 2> diff-runex1_1d_0.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 1 -domain_shape box -dm_view ascii::ascii_info_detail  > ex1_1d_0.tmp 2> runex1_1d_0.err
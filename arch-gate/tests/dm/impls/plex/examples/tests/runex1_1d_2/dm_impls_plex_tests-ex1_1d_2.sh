@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 1 -domain_box_sizes 5 -x_periodicity periodic -dm_view ascii::ascii_info_detail -test_shape  > ex1_1d_2.tmp 2> runex1_1d_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex1 -dim 1 -domain_box_sizes 4 -dm_refine 1 -overlap 1 -petscpartitioner_type simple -dm_view ascii::ascii_info_detail  > ex1_1d_refine_overlap_1.tmp 2> runex1_1d_refine_overlap_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 2 -cell_simplex 0 -interpolate -dm_view ascii::ascii_info_detail  > ex1_6.tmp 2> runex1_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_7.out ex1_7.tmp > diff-runex1_7.out 2> diff-runex1_7.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 2 -cell_simplex 0 -interpolate -dm_refine 1 -dm_view ascii::ascii_info_detail  > ex1_7.tmp 2> runex1_7.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_8.out ex1_8.tmp > diff-runex1_8.out 2> diff-runex1_8.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex1 -dim 2 -cell_simplex 0 -interpolate -dm_refine 1 -interpolate 1 -test_partition -dm_view ascii::ascii_latex  > ex1_8.tmp 2> runex1_8.err
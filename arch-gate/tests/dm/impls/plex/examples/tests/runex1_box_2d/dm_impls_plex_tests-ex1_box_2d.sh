@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 2 -cell_simplex 0 -interpolate -domain_shape box -dm_refine 2 -test_shape -dm_view  > ex1_box_2d.tmp 2> runex1_box_2d.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_box_2d_per.out ex1_box_2d_per.tmp > diff-runex1_box_2d_per.out 2> diff-runex1_box_2d_per.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 2 -cell_simplex 0 -interpolate 0 -domain_shape box -domain_box_sizes 3,3 -test_shape -dm_view ::ascii_info_detail  > ex1_box_2d_per_unint.tmp 2> runex1_box_2d_per_unint.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 3 -cell_simplex 0 -interpolate -domain_shape box -dm_refine 3 -test_shape -dm_view  > ex1_box_3d.tmp 2> runex1_box_3d.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_cylinder.out ex1_cylinder.tmp > diff-runex1_cylinder.out 2> diff-runex1_cylinder.out
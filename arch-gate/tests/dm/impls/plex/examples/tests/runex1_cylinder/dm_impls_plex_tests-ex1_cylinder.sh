@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 3 -cell_simplex 0 -interpolate -domain_shape cylinder -test_shape -dm_view  > ex1_cylinder.tmp 2> runex1_cylinder.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 3 -cell_simplex 0 -interpolate -domain_shape cylinder -z_periodicity periodic -test_shape -dm_view  > ex1_cylinder_per.tmp 2> runex1_cylinder_per.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -dim 3 -cell_simplex 0 -interpolate -cell_wedge -domain_shape cylinder -dm_view vtk: -dm_plex_check_symmetry -dm_plex_check_faces tensor -dm_plex_check_skeleton tensor  > ex1_cylinder_wedge_int.tmp 2> runex1_cylinder_wedge_int.err
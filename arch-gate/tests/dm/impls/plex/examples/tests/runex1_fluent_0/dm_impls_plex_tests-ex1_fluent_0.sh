@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.cas -interpolate 1 -dm_view  > ex1_fluent_0.tmp 2> runex1_fluent_0.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.cas -interpolate 1 -test_partition -dm_view  > ex1_fluent_1.tmp 2> runex1_fluent_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_fluent_2.out ex1_fluent_2.tmp > diff-runex1_fluent_2.out 2> diff-runex1_fluent_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_glvis_2d_quad_per.out ex1_glvis_2d_quad_per.tmp > diff-runex1_glvis_2d_quad_per.out 2> diff-runex1_glvis_2d_quad_per.out
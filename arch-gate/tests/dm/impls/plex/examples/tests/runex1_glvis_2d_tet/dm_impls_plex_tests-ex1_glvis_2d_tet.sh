@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_periodic.msh -dm_view glvis:  > ex1_glvis_2d_tet.tmp 2> runex1_glvis_2d_tet.err
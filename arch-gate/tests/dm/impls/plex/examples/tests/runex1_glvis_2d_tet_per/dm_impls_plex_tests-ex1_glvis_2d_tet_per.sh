@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_periodic.msh -dm_plex_gmsh_periodic -dm_view glvis: -viewer_glvis_dm_plex_enable_boundary 0  > ex1_glvis_2d_tet_per.tmp 2> runex1_glvis_2d_tet_per.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_periodic.msh -dm_plex_gmsh_periodic -viewer_glvis_dm_plex_enable_boundary -viewer_glvis_dm_plex_enable_mfem -dm_view glvis: -interpolate  > ex1_glvis_2d_tet_per_mfem.tmp 2> runex1_glvis_2d_tet_per_mfem.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_glvis_3d_hex_per_mfem.out ex1_glvis_3d_hex_per_mfem.tmp > diff-runex1_glvis_3d_hex_per_mfem.out 2> diff-runex1_glvis_3d_hex_per_mfem.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_glvis_3d_tet.out ex1_glvis_3d_tet.tmp > diff-runex1_glvis_3d_tet.out 2> diff-runex1_glvis_3d_tet.out
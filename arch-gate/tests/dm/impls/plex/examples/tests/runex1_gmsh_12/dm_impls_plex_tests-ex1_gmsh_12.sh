@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_bin_physnames.msh -viewer_binary_mpiio -petscpartitioner_type simple -interpolate 1 -dm_view  > ex1_gmsh_12.tmp 2> runex1_gmsh_12.err
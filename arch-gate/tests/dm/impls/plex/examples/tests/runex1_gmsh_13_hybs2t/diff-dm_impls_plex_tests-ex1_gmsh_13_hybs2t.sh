@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_13_hybs2t.out ex1_gmsh_13_hybs2t.tmp > diff-runex1_gmsh_13_hybs2t.out 2> diff-runex1_gmsh_13_hybs2t.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/hybrid_triquad.msh -petscpartitioner_type simple -interpolate 1 -dm_view -test_shape -simplex2tensor -dm_plex_gmsh_hybrid -dm_plex_check_faces unknown -dm_plex_check_skeleton unknown -dm_plex_check_symmetry  > ex1_gmsh_13_hybs2t.tmp 2> runex1_gmsh_13_hybs2t.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_14_ext.out ex1_gmsh_14_ext.tmp > diff-runex1_gmsh_14_ext.out 2> diff-runex1_gmsh_14_ext.out
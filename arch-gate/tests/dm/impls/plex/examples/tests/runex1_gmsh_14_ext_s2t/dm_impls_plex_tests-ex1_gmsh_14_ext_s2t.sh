@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ext_layers 2 -ext_thickness 1.5 -ext_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_bin.msh -dm_view -interpolate -dm_plex_check_faces unknown -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -simplex2tensor -test_shape  > ex1_gmsh_14_ext_s2t.tmp 2> runex1_gmsh_14_ext_s2t.err
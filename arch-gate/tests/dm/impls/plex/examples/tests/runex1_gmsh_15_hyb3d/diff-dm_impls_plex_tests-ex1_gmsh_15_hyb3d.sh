@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_15_hyb3d.out ex1_gmsh_15_hyb3d.tmp > diff-runex1_gmsh_15_hyb3d.out 2> diff-runex1_gmsh_15_hyb3d.out
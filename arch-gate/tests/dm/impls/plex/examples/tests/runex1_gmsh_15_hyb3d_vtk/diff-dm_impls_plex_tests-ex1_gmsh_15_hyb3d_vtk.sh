@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_15_hyb3d_vtk.out ex1_gmsh_15_hyb3d_vtk.tmp > diff-runex1_gmsh_15_hyb3d_vtk.out 2> diff-runex1_gmsh_15_hyb3d_vtk.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/hybrid_tetwedge.msh -dm_view vtk:  > ex1_gmsh_15_hyb3d_vtk.tmp 2> runex1_gmsh_15_hyb3d_vtk.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex1 -ext_layers 3 -ext_filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/surfacesphere_bin.msh -dm_plex_gmsh_spacedim 3 -simplex2tensor -dm_plex_check_symmetry -dm_plex_check_faces unknown -dm_plex_check_skeleton unknown -dm_view -interpolate -test_shape -petscpartitioner_type simple  > ex1_gmsh_16_spheresurface_extruded_s2t.tmp 2> runex1_gmsh_16_spheresurface_extruded_s2t.err
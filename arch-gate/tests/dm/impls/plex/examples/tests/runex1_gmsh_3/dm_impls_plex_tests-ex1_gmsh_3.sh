@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex1 -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.msh -test_partition -interpolate 1 -dm_view  > ex1_gmsh_3.tmp 2> runex1_gmsh_3.err
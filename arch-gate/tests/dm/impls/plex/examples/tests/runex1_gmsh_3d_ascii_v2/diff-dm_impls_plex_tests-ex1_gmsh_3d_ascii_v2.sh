@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_3d.out ex1_gmsh_3d_ascii_v2.tmp > diff-runex1_gmsh_3d_ascii_v2.out 2> diff-runex1_gmsh_3d_ascii_v2.out
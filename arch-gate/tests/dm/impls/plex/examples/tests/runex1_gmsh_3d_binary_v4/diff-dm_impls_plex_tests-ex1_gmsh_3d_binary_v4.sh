@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_3d.out ex1_gmsh_3d_binary_v4.tmp > diff-runex1_gmsh_3d_binary_v4.out 2> diff-runex1_gmsh_3d_binary_v4.out
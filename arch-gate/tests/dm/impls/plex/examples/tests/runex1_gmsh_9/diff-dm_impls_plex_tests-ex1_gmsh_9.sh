@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex1_gmsh_9.out ex1_gmsh_9.tmp > diff-runex1_gmsh_9.out 2> diff-runex1_gmsh_9.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex22 -petscspace_degree 2 -tensor_petscspace_degree 2  > ex22_0.tmp 2> runex22_0.err
@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex24'
+testname='runex24_0'
+label='dm_impls_plex_tests-ex24_0'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-filename ${PETSC_DIR}/share/petsc/datafiles/meshes/blockcylinder-50.exo -interpolate -petscpartititoner_ptscotch_vertex_weight 0 -mat_partitioning_ptscotch_proc_weight 0'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    printf "ok ${label} # SKIP PETSC_HAVE_CHACO requirement not met, PETSC_HAVE_PARMETIS requirement not met, PETSC_HAVE_PTSCOTCH requirement not met, PETSC_HAVE_EXODUSII requirement not met\n"
+    total=1; skip=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+nsize_in=${nsize:-1 2 3 4 8}
+partitioning_in=${partitioning:-chaco parmetis ptscotch}
+repartitioning_in=${repartitioning:-parmetis ptscotch}
+
+
+for nsize in ${nsize_in}; do
+   for partitioning in ${partitioning_in}; do
+      for repartitioning in ${repartitioning_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -partitioning ${partitioning} -repartitioning ${repartitioning}" ex24_0.tmp ${testname}.err "${label}_nsize-${nsize}partitioning-${partitioning}_repartitioning-${repartitioning}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/dm/impls/plex/examples/tests/output/ex24_0.out ex24_0.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_nsize-${nsize}partitioning-${partitioning}_repartitioning-${repartitioning} ""
+         else
+            printf "ok ${label} # SKIP Command failed so no diff\n"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex27 -dim 2 -simplex 0 -field0_petscspace_degree 2 -field1_petscspace_degree 1 -field2_petscspace_degree 1 -petscsection_point_major 0 -dm_view -dof_view  > ex27_quad_fm.tmp 2> runex27_quad_fm.err
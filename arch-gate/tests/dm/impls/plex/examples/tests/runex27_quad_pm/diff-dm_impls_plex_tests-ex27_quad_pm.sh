@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex27_quad_pm.out ex27_quad_pm.tmp > diff-runex27_quad_pm.out 2> diff-runex27_quad_pm.out
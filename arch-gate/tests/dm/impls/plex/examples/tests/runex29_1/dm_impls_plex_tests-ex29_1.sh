@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex29 -dim 3 -simplex 0 -dm_refine 2 -petscpartitioner_type simple -dm_view  > ex29_1.tmp 2> runex29_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex29_quad_0.out ex29_quad_0.tmp > diff-runex29_quad_0.out 2> diff-runex29_quad_0.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex29 -dim 3 -simplex 0 -dm_refine 2 -petscpartitioner_type simple -dm_view -pdm_view  > ex29_quad_0.tmp 2> runex29_quad_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex3_constraints.out ex3_constraints.tmp > diff-runex3_constraints.out 2> diff-runex3_constraints.out
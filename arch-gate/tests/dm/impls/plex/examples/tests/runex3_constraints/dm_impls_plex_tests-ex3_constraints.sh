@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -simplex 0 -petscspace_type tensor -petscspace_degree 1 -qorder 0 -constraints  > ex3_constraints.tmp 2> runex3_constraints.err
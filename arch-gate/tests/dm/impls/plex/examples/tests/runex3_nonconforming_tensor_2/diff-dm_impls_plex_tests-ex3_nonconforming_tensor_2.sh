@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex3_nonconforming_tensor_2.out ex3_nonconforming_tensor_2.tmp > diff-runex3_nonconforming_tensor_2.out 2> diff-runex3_nonconforming_tensor_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_fe_jacobian -test_injector -petscpartitioner_type simple -tree -simplex 0 -dim 2 -dm_plex_max_projection_height 1 -petscspace_type tensor -petscspace_degree 2 -qorder 2 -dm_view ascii::ASCII_INFO_DETAIL  > ex3_nonconforming_tensor_2.tmp 2> runex3_nonconforming_tensor_2.err
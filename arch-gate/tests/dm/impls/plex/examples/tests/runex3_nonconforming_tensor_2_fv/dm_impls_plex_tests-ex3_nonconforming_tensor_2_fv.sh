@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_fv_grad -test_injector -petsclimiter_type none -petscpartitioner_type simple -tree -simplex 0 -dim 2 -num_comp 2  > ex3_nonconforming_tensor_2_fv.tmp 2> runex3_nonconforming_tensor_2_fv.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_fe_jacobian -petscpartitioner_type simple -tree -simplex 0 -dim 2 -dm_plex_max_projection_height 1 -petscspace_type tensor -petscspace_degree 4 -qorder 4  > ex3_nonconforming_tensor_2_hi.tmp 2> runex3_nonconforming_tensor_2_hi.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_fe_jacobian -petscpartitioner_type simple -tree -simplex 0 -dim 3 -dm_plex_max_projection_height 2 -petscspace_type tensor -petscspace_degree 1 -qorder 1 -dm_view ascii::ASCII_INFO_DETAIL  > ex3_nonconforming_tensor_3.tmp 2> runex3_nonconforming_tensor_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex3_nonconforming_tensor_3_fv.out ex3_nonconforming_tensor_3_fv.tmp > diff-runex3_nonconforming_tensor_3_fv.out 2> diff-runex3_nonconforming_tensor_3_fv.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex3_q1_2d_plex_0.out ex3_q1_2d_plex_0.tmp > diff-runex3_q1_2d_plex_0.out 2> diff-runex3_q1_2d_plex_0.out
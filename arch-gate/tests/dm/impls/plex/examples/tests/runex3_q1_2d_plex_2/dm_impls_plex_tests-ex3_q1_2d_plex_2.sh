@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -use_da 0 -simplex 0 -petscspace_degree 1 -qorder 1 -porder 2  > ex3_q1_2d_plex_2.tmp 2> runex3_q1_2d_plex_2.err
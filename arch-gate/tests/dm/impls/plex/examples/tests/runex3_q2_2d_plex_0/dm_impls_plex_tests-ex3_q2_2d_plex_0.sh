@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -use_da 0 -simplex 0 -petscspace_degree 2 -qorder 2 -convergence  > ex3_q2_2d_plex_0.tmp 2> runex3_q2_2d_plex_0.err
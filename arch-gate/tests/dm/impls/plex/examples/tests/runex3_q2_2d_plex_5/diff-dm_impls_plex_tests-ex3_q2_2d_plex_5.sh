@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex3_q2_2d_plex_5.out ex3_q2_2d_plex_5.tmp > diff-runex3_q2_2d_plex_5.out 2> diff-runex3_q2_2d_plex_5.out
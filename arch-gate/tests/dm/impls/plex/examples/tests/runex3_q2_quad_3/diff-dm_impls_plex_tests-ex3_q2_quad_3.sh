@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex3_q2_quad_3.out ex3_q2_quad_3.tmp > diff-runex3_q2_quad_3.out 2> diff-runex3_q2_quad_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -use_da 0 -simplex 0 -petscspace_degree 2 -qorder 5 -porder 1  > ex3_q2_quad_5.tmp 2> runex3_q2_quad_5.err
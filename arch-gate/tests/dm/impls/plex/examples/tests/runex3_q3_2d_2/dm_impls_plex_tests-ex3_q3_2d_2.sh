@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -use_da 0 -simplex 0 -petscspace_degree 3 -qorder 3 -porder 2  > ex3_q3_2d_2.tmp 2> runex3_q3_2d_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -dim 2 -cell_hybrid 0 -dm_view ascii::ascii_info_detail -hyb_dm_plex_check_symmetry -hyb_dm_plex_check_skeleton unknown -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_faces unknown -hyb_dm_plex_check_faces unknown  > ex4_0.tmp 2> runex4_0.err
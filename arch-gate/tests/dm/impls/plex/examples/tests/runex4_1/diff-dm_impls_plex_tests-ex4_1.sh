@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex4_1.out ex4_1.tmp > diff-runex4_1.out 2> diff-runex4_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -dim 3 -cell_hybrid 0 -dm_view ascii::ascii_info_detail -hyb_dm_plex_check_symmetry -hyb_dm_plex_check_skeleton unknown -hyb_dm_plex_check_faces unknown -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_faces unknown -test_num 1 -dm_refine 1  > ex4_10.tmp 2> runex4_10.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex4 -dim 2 -cell_simplex 0 -cell_hybrid 0 -dm_view ascii::ascii_info_detail -hyb_dm_plex_check_symmetry -hyb_dm_plex_check_skeleton unknown -hyb_dm_plex_check_faces unknown -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_faces unknown -dm_refine 1  > ex4_13.tmp 2> runex4_13.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex4_26.out ex4_26.tmp > diff-runex4_26.out 2> diff-runex4_26.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex4_7.out ex4_7.tmp > diff-runex4_7.out 2> diff-runex4_7.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex4_9.out ex4_9.tmp > diff-runex4_9.out 2> diff-runex4_9.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex4 -test_partition 0 -petscpartitioner_type simple -dm_view -reinterpolate -hyb_dm_plex_check_symmetry -hyb_dm_plex_check_skeleton unknown -hyb_dm_plex_check_faces unknown -orig_dm_plex_check_symmetry -in_dm_plex_check_symmetry -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_faces unknown -dim 2 -dm_refine 2 -test_num 1  > ex4_hybint_2d_1.tmp 2> runex4_hybint_2d_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex5_hex_0.out ex5_hex_0.tmp > diff-runex5_hex_0.out 2> diff-runex5_hex_0.out
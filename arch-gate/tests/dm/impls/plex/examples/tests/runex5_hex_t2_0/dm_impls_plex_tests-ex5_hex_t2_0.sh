@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -orig_dm_plex_check_symmetry -orig_dm_plex_check_skeleton tensor -orig_dm_plex_check_faces tensor -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton tensor -dm_plex_check_faces tensor -dim 3 -cell_simplex 0 -test_num 2  > ex5_hex_t2_0.tmp 2> runex5_hex_t2_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex5_quad_1.out ex5_quad_1.tmp > diff-runex5_quad_1.out 2> diff-runex5_quad_1.out
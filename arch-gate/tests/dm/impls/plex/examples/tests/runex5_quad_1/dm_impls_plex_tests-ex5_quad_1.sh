@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex5 -orig_dm_plex_check_symmetry -orig_dm_plex_check_skeleton tensor -orig_dm_plex_check_faces tensor -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton tensor -dm_plex_check_faces tensor -dim 2 -cell_simplex 0  > ex5_quad_1.tmp 2> runex5_quad_1.err
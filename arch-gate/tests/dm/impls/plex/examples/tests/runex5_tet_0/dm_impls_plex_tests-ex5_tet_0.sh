@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -orig_dm_plex_check_symmetry -orig_dm_plex_check_skeleton simplex -orig_dm_plex_check_faces simplex -dm_view ascii::ascii_info_detail -dm_plex_check_symmetry -dm_plex_check_skeleton simplex -dm_plex_check_faces simplex -dim 3  > ex5_tet_0.tmp 2> runex5_tet_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex5_tri_1.out ex5_tri_1.tmp > diff-runex5_tri_1.out 2> diff-runex5_tri_1.out
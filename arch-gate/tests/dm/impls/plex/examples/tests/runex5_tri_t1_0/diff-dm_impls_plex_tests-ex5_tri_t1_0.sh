@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex5_tri_t1_0.out ex5_tri_t1_0.tmp > diff-runex5_tri_t1_0.out 2> diff-runex5_tri_t1_0.out
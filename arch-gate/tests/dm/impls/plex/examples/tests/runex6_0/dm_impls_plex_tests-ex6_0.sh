@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -malloc_dump  > ex6_0.tmp 2> runex6_0.err
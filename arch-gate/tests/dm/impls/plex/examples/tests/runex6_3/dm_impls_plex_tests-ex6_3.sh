@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -malloc_dump -pend 10000 -fill 0.25  > ex6_3.tmp 2> runex6_3.err
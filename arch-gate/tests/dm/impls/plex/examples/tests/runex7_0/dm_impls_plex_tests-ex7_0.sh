@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dim 2 -dm_view ascii::ascii_info_detail  > ex7_0.tmp 2> runex7_0.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex7 -petscpartitioner_type simple -dim 2 -dm_view ascii::ascii_info_detail  > ex7_1.tmp 2> runex7_1.err
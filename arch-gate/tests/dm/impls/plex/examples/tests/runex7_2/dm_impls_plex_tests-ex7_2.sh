@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dim 2 -cell_simplex 0 -dm_view ascii::ascii_info_detail  > ex7_2.tmp 2> runex7_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex7 -petscpartitioner_type simple -dim 2 -cell_simplex 0 -dm_view ascii::ascii_info_detail  > ex7_3.tmp 2> runex7_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dim 3 -dm_view ascii::ascii_info_detail  > ex7_4.tmp 2> runex7_4.err
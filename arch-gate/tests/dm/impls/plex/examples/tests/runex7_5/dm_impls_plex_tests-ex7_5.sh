@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex7 -petscpartitioner_type simple -dim 3 -dm_view ascii::ascii_info_detail  > ex7_5.tmp 2> runex7_5.err
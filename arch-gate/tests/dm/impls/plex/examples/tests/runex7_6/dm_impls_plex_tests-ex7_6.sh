@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dim 3 -cell_simplex 0 -dm_view ascii::ascii_info_detail  > ex7_6.tmp 2> runex7_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex7_7.out ex7_7.tmp > diff-runex7_7.out 2> diff-runex7_7.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex7_8.out ex7_8.tmp > diff-runex7_8.out 2> diff-runex7_8.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dim 2 -cell_simplex 0 -testnum 1 -dm_view ascii::ascii_info_detail  > ex7_8.tmp 2> runex7_8.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tests/output/ex8_0.out ex8_0.tmp > diff-runex8_0.out 2> diff-runex8_0.out
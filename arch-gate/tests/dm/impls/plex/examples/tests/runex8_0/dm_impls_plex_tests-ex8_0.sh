@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex8 -dm_view ascii::ascii_info_detail  > ex8_0.tmp 2> runex8_0.err
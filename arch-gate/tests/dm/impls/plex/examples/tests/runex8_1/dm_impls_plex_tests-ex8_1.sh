@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex8 -interpolate -dm_view ascii::ascii_info_detail  > ex8_1.tmp 2> runex8_1.err
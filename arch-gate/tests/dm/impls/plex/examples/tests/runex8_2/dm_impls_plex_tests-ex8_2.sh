@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex8 -transform  > ex8_2.tmp 2> runex8_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex8 -interpolate -transform  > ex8_3.tmp 2> runex8_3.err
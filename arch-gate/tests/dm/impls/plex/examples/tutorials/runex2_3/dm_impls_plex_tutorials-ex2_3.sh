@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -dm_plex_check_symmetry -dm_plex_check_skeleton unknown -dm_plex_check_faces unknown -dm_plex_check_geometry -filename ${wPETSC_DIR}/share/petsc/datafiles/meshes/square.msh  > ex2_3.tmp 2> runex2_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -dim 2 -num_fields 1 -num_components 1 -order 2  > ex6_0.tmp 2> runex6_0.err
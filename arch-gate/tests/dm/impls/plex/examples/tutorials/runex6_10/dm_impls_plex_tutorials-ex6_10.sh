@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -dim 3 -num_fields 2 -num_components 1,1 -order 2,2  > ex6_10.tmp 2> runex6_10.err
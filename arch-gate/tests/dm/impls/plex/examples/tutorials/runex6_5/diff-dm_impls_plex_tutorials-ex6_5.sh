@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tutorials/output/ex6_5.out ex6_5.tmp > diff-runex6_5.out 2> diff-runex6_5.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -dim 2 -num_fields 2 -num_components 1,2 -order 2,3  > ex6_5.tmp 2> runex6_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/plex/examples/tutorials/output/ex6_8.out ex6_8.tmp > diff-runex6_8.out 2> diff-runex6_8.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -dim 3 -num_fields 1 -num_components 1 -order 5  > ex6_8.tmp 2> runex6_8.err
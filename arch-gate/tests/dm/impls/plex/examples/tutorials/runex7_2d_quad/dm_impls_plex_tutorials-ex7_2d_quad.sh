@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dm_view  > ex7_2d_quad.tmp 2> runex7_2d_quad.err
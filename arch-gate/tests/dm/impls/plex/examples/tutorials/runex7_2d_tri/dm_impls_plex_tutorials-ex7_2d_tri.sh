@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -simplex -dm_view  > ex7_2d_tri.tmp 2> runex7_2d_tri.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex7 -dim 3 -simplex -dm_view  > ex7_3d_tri.tmp 2> runex7_3d_tri.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex10_4.out ex10_4.tmp > diff-runex10_4.out 2> diff-runex10_4.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex11   > ex11_2.tmp 2> runex11_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex11 -stag_grid_x 4 -stag_grid_y 5 -stag_stencil_width 2  > ex11_4.tmp 2> runex11_4.err
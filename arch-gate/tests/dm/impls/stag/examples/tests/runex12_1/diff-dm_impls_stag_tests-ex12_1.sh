@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex12_1.out ex12_1.tmp > diff-runex12_1.out 2> diff-runex12_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 6 ../ex12 -stag_ranks_x 3 -stag_ranks_y 2 -stag_dof_0 2 -stag_grid_x 6  > ex12_2.tmp 2> runex12_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex12_3.out ex12_3.tmp > diff-runex12_3.out 2> diff-runex12_3.out
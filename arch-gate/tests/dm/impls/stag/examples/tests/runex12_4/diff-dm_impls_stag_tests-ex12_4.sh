@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex12_4.out ex12_4.tmp > diff-runex12_4.out 2> diff-runex12_4.out
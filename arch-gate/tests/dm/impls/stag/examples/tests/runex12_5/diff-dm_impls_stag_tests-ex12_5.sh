@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex12_5.out ex12_5.tmp > diff-runex12_5.out 2> diff-runex12_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex12_7.out ex12_7.tmp > diff-runex12_7.out 2> diff-runex12_7.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex12 -stag_stencil_width 1 -stag_grid_x 2 -stag_grid_y 2 -stag_boundary_type_y ghosted  > ex12_7.tmp 2> runex12_7.err
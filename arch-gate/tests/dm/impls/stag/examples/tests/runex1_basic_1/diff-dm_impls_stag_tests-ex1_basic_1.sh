@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex1_basic_1.out ex1_basic_1.tmp > diff-runex1_basic_1.out 2> diff-runex1_basic_1.out
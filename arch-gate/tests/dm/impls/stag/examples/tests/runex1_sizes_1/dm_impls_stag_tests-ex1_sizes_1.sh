@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex1 -dm_view -dim 1 -setSizes  > ex1_sizes_1.tmp 2> runex1_sizes_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 6 ../ex1 -dm_view -dim 2 -setSizes  > ex1_sizes_2.tmp 2> runex1_sizes_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 12 ../ex1 -dm_view -dim 3 -setSizes  > ex1_sizes_3.tmp 2> runex1_sizes_3.err
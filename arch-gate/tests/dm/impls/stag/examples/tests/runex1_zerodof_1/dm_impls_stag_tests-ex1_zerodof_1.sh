@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex1 -dm_view -dim 1 -stag_dof_0 0 -stag_dof_1 0  > ex1_zerodof_1.tmp 2> runex1_zerodof_1.err
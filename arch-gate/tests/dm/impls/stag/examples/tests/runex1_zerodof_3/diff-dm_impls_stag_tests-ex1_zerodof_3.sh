@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex1_zerodof_3.out ex1_zerodof_3.tmp > diff-runex1_zerodof_3.out 2> diff-runex1_zerodof_3.out
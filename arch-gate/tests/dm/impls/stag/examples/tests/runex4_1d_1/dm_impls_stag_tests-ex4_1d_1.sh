@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -dim 1  > ex4_1d_1.tmp 2> runex4_1d_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex4_1d_2.out ex4_1d_2.tmp > diff-runex4_1d_2.out 2> diff-runex4_1d_2.out
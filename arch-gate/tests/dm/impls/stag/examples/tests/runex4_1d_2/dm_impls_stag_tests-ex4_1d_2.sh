@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex4 -dim 1  > ex4_1d_2.tmp 2> runex4_1d_2.err
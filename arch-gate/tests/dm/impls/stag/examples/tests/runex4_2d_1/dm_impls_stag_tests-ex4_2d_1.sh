@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -dim 2  > ex4_2d_1.tmp 2> runex4_2d_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex4 -dim 2  > ex4_2d_2.tmp 2> runex4_2d_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -dim 3  > ex4_3d_1.tmp 2> runex4_3d_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 8 ../ex4 -dim 3  > ex4_3d_2.tmp 2> runex4_3d_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex5_2.out ex5_2.tmp > diff-runex5_2.out 2> diff-runex5_2.out
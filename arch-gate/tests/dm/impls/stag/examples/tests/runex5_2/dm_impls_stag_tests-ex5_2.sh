@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex5   > ex5_2.tmp 2> runex5_2.err
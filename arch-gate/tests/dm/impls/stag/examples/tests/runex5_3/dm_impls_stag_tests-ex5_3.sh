@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -stag_grid_x 19  > ex5_3.tmp 2> runex5_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex5_4.out ex5_4.tmp > diff-runex5_4.out 2> diff-runex5_4.out
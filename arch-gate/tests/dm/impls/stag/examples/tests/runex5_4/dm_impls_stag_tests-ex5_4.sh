@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex5 -stag_grid_x 21 -stag_stencil_width 2  > ex5_4.tmp 2> runex5_4.err
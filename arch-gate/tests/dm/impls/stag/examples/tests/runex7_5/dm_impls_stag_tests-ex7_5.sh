@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 12 ../ex7 -stag_ranks_x 3 -stag_ranks_y 2 -stag_ranks_z 2 -stag_dof_0 0 -stag_dof_1 0 -stag_dof_2 0 -stag_grid_x 4 -stag_boundary_type_x ghosted -stag_boundary_type_z ghosted -stag_stencil_width 1  > ex7_5.tmp 2> runex7_5.err
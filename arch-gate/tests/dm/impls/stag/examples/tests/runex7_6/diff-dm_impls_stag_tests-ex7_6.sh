@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex7_6.out ex7_6.tmp > diff-runex7_6.out 2> diff-runex7_6.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex8_2.out ex8_2.tmp > diff-runex8_2.out 2> diff-runex8_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 8 ../ex8 -stag_grid_x 4 -stag_grid_y 5 -stag_grid_z 4 -stag_stencil_width 2  > ex8_4.tmp 2> runex8_4.err
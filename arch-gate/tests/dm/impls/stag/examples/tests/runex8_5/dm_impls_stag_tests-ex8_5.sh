@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 8 ../ex8 -stag_dof_0 3 -stag_dof_1 2 -stag_dof_2 4 -stag_dof_3 2 -stag_stencil_width 3 -stag_grid_x 6 -stag_grid_y 6 -stag_grid_z 6  > ex8_5.tmp 2> runex8_5.err
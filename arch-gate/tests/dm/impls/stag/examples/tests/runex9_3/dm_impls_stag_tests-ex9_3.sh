@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 8 ../ex9 -stag_dof_0 3 -stag_dof_1 2 -stag_dof_2 4 -stag_dof_3 2 -stag_stencil_width 3 -stag_grid_x 6 -stag_grid_y 6 -stag_grid_z 7  > ex9_3.tmp 2> runex9_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex9_4.out ex9_4.tmp > diff-runex9_4.out 2> diff-runex9_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex9_5.out ex9_5.tmp > diff-runex9_5.out 2> diff-runex9_5.out
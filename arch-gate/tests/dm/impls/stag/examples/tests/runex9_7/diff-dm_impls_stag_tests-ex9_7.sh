@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tests/output/ex9_7.out ex9_7.tmp > diff-runex9_7.out 2> diff-runex9_7.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 8 ../ex9 -stag_stencil_width 1 -stag_grid_x 3 -stag_grid_y 2 -stag_grid_z 2 -stag_boundary_type_x ghosted -stag_boundary_type_y ghosted  > ex9_7.tmp 2> runex9_7.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tutorials/output/ex1_ghosted_vacuous.out ex1_ghosted_vacuous.tmp > diff-runex1_ghosted_vacuous.out 2> diff-runex1_ghosted_vacuous.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex1 -dm_view -stag_grid_x 13 -stag_boundary_type_x ghosted -a 1.1234  > ex1_ghosted_vacuous.tmp 2> runex1_ghosted_vacuous.err
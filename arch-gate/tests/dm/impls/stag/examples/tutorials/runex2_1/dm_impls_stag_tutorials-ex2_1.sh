@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex2 -ksp_monitor_short -ksp_converged_reason  > ex2_1.tmp 2> runex2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tutorials/output/ex3_2.out ex3_2.tmp > diff-runex3_2-0.out 2> diff-runex3_2-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tutorials/output/ex3_2_alt.out ex3_2.tmp > diff-runex3_2-1.out 2> diff-runex3_2-1.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tutorials/output/ex3_2_alt_2.out ex3_2.tmp > diff-runex3_2-2.out 2> diff-runex3_2-2.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tutorials/output/ex3_2_alt_3.out ex3_2.tmp > diff-runex3_2-3.out 2> diff-runex3_2-3.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/impls/stag/examples/tutorials/output/ex3_2_alt_4.out ex3_2.tmp > diff-runex3_2.out 2> diff-runex3_2.out
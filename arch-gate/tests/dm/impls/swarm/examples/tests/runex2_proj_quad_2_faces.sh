@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex2'
+testname='runex2_proj_quad_2_faces'
+label='dm_impls_swarm_tests-ex2_proj_quad_2_faces'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-dim 2 -simplex 0 -faces 2 -dm_view -sw_view -petscspace_degree 2 -ptof_pc_type lu -ftop_ksp_rtol 1e-15 -ftop_ksp_type lsqr -ftop_pc_type none'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    printf "ok ${label} # SKIP PETSC_HAVE_TRIANGLE requirement not met\n"
+    total=1; skip=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+nsize_in=${nsize:-1}
+petscfe_default_quadrature_order_in=${petscfe_default_quadrature_order:-2 3}
+
+
+for nsize in ${nsize_in}; do
+   for petscfe_default_quadrature_order in ${petscfe_default_quadrature_order_in}; do
+
+      petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -petscfe_default_quadrature_order ${petscfe_default_quadrature_order}" ex2_proj_quad_2_faces.tmp ${testname}.err "${label}_petscfe_default_quadrature_order-${petscfe_default_quadrature_order}" 'grep -v marker | grep -v atomic | grep -v usage'
+      res=$?
+
+      if test $res = 0; then
+         petsc_testrun "${diff_exe} /root/repo/src/dm/impls/swarm/examples/tests/output/ex2_proj_quad_2_faces.out ex2_proj_quad_2_faces.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_petscfe_default_quadrature_order-${petscfe_default_quadrature_order} ""
+      else
+         printf "ok ${label} # SKIP Command failed so no diff\n"
+      fi
+
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
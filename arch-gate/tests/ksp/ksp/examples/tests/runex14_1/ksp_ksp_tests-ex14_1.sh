@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex14   > ex14_1.tmp 2> runex14_1.err
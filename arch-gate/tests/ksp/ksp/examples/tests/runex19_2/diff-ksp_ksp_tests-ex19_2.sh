@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex19_2.out ex19_2.tmp > diff-runex19_2.out 2> diff-runex19_2.out
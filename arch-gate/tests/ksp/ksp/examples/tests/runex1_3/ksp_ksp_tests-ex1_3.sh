@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -pc_type sor -pc_sor_symmetric -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex1_3.tmp 2> runex1_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex20 -ksp_monitor_short  > ex20_1.tmp 2> runex20_1.err
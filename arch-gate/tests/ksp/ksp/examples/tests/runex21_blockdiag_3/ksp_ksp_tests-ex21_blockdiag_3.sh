@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex21 -mat_schur_complement_ainv_type blockdiag  > ex21_blockdiag_3.tmp 2> runex21_blockdiag_3.err
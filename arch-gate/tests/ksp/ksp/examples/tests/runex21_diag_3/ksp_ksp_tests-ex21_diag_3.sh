@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex21 -mat_schur_complement_ainv_type diag  > ex21_diag_3.tmp 2> runex21_diag_3.err
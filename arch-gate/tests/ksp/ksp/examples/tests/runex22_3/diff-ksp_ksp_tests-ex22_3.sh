@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex22_3.out ex22_3.tmp > diff-runex22_3.out 2> diff-runex22_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex24_1.out ex24_1.tmp > diff-runex24_1.out 2> diff-runex24_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex24 -pc_type icc -mat_type seqsbaij -mat_ignore_lower_triangular  > ex24_1.tmp 2> runex24_1.err
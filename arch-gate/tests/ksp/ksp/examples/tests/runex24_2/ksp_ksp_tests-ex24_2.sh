@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex24 -pc_type icc -pc_factor_levels 2 -mat_type seqsbaij -mat_ignore_lower_triangular  > ex24_2.tmp 2> runex24_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex24 -pc_type bjacobi -sub_pc_type icc -mat_type mpisbaij -mat_ignore_lower_triangular -ksp_max_it 8  > ex24_3.tmp 2> runex24_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex24 -pc_type bjacobi -sub_pc_type icc -sub_pc_factor_levels 1 -mat_type mpisbaij -mat_ignore_lower_triangular  > ex24_4.tmp 2> runex24_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex26_2.out ex26_2.tmp > diff-runex26_2.out 2> diff-runex26_2.out
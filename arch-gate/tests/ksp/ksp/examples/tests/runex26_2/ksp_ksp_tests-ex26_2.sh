@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex26 -ksp_monitor_short  > ex26_2.tmp 2> runex26_2.err
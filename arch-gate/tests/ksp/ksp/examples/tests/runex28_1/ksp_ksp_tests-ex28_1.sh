@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex28   > ex28_1.tmp 2> runex28_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex28 -procedural -pc_redundant_number 3 -redundant_ksp_type gmres -redundant_pc_type bjacobi  > ex28_2.tmp 2> runex28_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex32 -ksp_monitor_short -dm_mat_type sbaij -ksp_monitor_short -pc_type cholesky -ksp_view  > ex32_1.tmp 2> runex32_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex39_1.out ex39_1.tmp > diff-runex39_1.out 2> diff-runex39_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -pc_type jacobi -ksp_monitor_short -m 5 -ksp_gmres_cgs_refinement_type refine_always  > ex3_1.tmp 2> runex3_1.err
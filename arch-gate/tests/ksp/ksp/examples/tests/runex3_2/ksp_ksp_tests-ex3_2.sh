@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex3 -pc_type jacobi -ksp_monitor_short -m 5 -ksp_gmres_cgs_refinement_type refine_always  > ex3_2.tmp 2> runex3_2.err
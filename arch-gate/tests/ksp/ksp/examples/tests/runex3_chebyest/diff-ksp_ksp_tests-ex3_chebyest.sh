@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex3_chebyest.out ex3_chebyest.tmp > diff-runex3_chebyest.out 2> diff-runex3_chebyest.out
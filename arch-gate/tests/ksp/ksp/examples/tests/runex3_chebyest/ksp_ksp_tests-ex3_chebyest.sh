@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3 -ksp_est_view -ksp_type chebyshev -ksp_chebyshev_esteig  > ex3_chebyest.tmp 2> runex3_chebyest.err
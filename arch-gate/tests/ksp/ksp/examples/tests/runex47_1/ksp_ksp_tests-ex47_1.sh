@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex47 -pc_type fieldsplit  > ex47_1.tmp 2> runex47_1.err
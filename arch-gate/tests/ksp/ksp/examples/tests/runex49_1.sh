@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex49'
+testname='runex49_1'
+label='ksp_ksp_tests-ex49_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-pc_type cholesky'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1}
+bs_in=${bs:-1 2 3 4 5 6 7 8 9 10 11 12}
+
+
+for nsize in ${nsize_in}; do
+   for bs in ${bs_in}; do
+
+      petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -bs ${bs}" ex49_1.tmp ${testname}.err "${label}_bs-${bs}" 
+      res=$?
+
+      if test $res = 0; then
+         petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex49_1.out ex49_1.tmp > diff-${testname}-0.out 2> diff-${testname}-0.out || ${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex49_1_alt.out ex49_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_bs-${bs} ""
+      else
+         printf "ok ${label} # SKIP Command failed so no diff\n"
+      fi
+
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
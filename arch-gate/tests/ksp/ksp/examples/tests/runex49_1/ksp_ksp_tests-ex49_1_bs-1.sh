@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex49 -pc_type cholesky  -bs 1 > ex49_1.tmp 2> runex49_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -pc_type sor -pc_sor_symmetric -ksp_monitor_short -m 5 -ksp_gmres_cgs_refinement_type refine_always  > ex4_3.tmp 2> runex4_3.err
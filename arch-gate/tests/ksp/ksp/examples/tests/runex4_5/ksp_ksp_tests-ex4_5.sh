@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -pc_type eisenstat -ksp_monitor_short -m 5	-ksp_gmres_cgs_refinement_type refine_always  > ex4_5.tmp 2> runex4_5.err
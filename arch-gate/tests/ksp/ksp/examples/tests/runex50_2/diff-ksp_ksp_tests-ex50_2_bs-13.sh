@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex50_2.out ex50_2.tmp > diff-runex50_2.out 2> diff-runex50_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex50 -mat_type aij -pc_type vpbjacobi -variable_block_sizes  -bs 5 > ex50_3.tmp 2> runex50_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex51 -reverse -pc_type cholesky  > ex51_2.tmp 2> runex51_2.err
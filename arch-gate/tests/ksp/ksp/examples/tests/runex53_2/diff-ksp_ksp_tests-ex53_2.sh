@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex53_2.out ex53_2.tmp > diff-runex53_2.out 2> diff-runex53_2.out
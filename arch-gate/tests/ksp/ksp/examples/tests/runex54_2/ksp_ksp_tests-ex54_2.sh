@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex54 -ksp_monitor_true_residual -ksp_max_it 10 -sys_view -ksp_converged_reason -ksp_view -ksp_lsqr_compute_standard_error -ksp_lsqr_monitor  > ex54_2.tmp 2> runex54_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex57 -pc_type fieldsplit -ksp_monitor  > ex57_1.tmp 2> runex57_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex58_asm.out ex58_asm.tmp > diff-runex58_asm.out 2> diff-runex58_asm.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex58 -ksp_converged_reason -pc_type asm -sub_pc_type sor  > ex58_asm.tmp 2> runex58_asm.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex58_bjacobi.out ex58_bjacobi.tmp > diff-runex58_bjacobi.out 2> diff-runex58_bjacobi.out
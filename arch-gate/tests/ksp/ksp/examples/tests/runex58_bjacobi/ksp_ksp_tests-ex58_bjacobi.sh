@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex58 -ksp_converged_reason -pc_type bjacobi -sub_pc_type ilu  > ex58_bjacobi.tmp 2> runex58_bjacobi.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex58_ilu.out ex58_ilu.tmp > diff-runex58_ilu.out 2> diff-runex58_ilu.out
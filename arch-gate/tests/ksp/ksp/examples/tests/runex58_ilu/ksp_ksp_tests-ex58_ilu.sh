@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -ksp_converged_reason -pc_type ilu  > ex58_ilu.tmp 2> runex58_ilu.err
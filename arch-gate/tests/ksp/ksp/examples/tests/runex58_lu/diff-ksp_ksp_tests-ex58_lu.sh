@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex58_lu.out ex58_lu.tmp > diff-runex58_lu.out 2> diff-runex58_lu.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -ksp_converged_reason -pc_type lu  > ex58_lu.tmp 2> runex58_lu.err
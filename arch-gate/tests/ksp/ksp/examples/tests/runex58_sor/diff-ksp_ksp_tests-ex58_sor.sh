@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex58_sor.out ex58_sor.tmp > diff-runex58_sor.out 2> diff-runex58_sor.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -ksp_converged_reason -pc_type sor  > ex58_sor.tmp 2> runex58_sor.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex58_ssor.out ex58_ssor.tmp > diff-runex58_ssor.out 2> diff-runex58_ssor.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -ksp_converged_reason -pc_type sor -pc_sor_symmetric -pc_sor_its 2  > ex58_ssor.tmp 2> runex58_ssor.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex59_cg.out ex59_cg.tmp > diff-runex59_cg.out 2> diff-runex59_cg.out
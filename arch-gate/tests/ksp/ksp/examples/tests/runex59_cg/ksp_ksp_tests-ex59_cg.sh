@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -ksp_type cg -pc_type jacobi  > ex59_cg.tmp 2> runex59_cg.err
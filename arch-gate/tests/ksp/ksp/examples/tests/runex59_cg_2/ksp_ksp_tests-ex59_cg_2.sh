@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex59 -ksp_type cg -pc_type bjacobi -sub_pc_type icc  > ex59_cg_2.tmp 2> runex59_cg_2.err
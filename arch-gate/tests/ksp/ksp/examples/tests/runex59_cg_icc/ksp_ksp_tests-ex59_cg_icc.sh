@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -ksp_type cg -pc_type icc  > ex59_cg_icc.tmp 2> runex59_cg_icc.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex59_columns.out ex59_columns.tmp > diff-runex59_columns.out 2> diff-runex59_columns.out
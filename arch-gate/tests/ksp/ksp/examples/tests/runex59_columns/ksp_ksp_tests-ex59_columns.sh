@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -ksp_type bcgs -pc_type none  > ex59_columns.tmp 2> runex59_columns.err
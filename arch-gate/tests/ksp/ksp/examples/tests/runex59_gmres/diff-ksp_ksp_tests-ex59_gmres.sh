@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex59_gmres.out ex59_gmres.tmp > diff-runex59_gmres.out 2> diff-runex59_gmres.out
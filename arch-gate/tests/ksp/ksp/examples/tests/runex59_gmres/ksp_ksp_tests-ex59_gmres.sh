@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -ksp_type gmres -pc_type ilu -ksp_gmres_restart 5  > ex59_gmres.tmp 2> runex59_gmres.err
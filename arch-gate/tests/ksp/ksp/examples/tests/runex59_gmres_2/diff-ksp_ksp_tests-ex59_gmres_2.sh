@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex59_gmres_2.out ex59_gmres_2.tmp > diff-runex59_gmres_2.out 2> diff-runex59_gmres_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex59 -ksp_type gmres -pc_type bjacobi -sub_pc_type ilu -ksp_gmres_restart 5  > ex59_gmres_2.tmp 2> runex59_gmres_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex59_preonly.out ex59_preonly.tmp > diff-runex59_preonly.out 2> diff-runex59_preonly.out
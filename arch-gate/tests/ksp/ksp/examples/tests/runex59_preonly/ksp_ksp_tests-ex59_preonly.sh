@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -ksp_type preonly -pc_type lu  > ex59_preonly.tmp 2> runex59_preonly.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex60_scg.out ex60_scg.tmp > diff-runex60_scg.out 2> diff-runex60_scg.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex60 -ksp_type scg -pc_type none  > ex60_scg.tmp 2> runex60_scg.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex60_scg_2.out ex60_scg_2.tmp > diff-runex60_scg_2.out 2> diff-runex60_scg_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex60 -ksp_type scg -pc_type none  > ex60_scg_2.tmp 2> runex60_scg_2.err
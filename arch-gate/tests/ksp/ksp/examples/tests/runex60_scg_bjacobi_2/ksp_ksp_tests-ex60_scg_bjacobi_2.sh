@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex60 -ksp_type scg -pc_type bjacobi -sub_pc_type icc -ksp_norm_type natural  > ex60_scg_bjacobi_2.tmp 2> runex60_scg_bjacobi_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex60_scg_jacobi.out ex60_scg_jacobi.tmp > diff-runex60_scg_jacobi.out 2> diff-runex60_scg_jacobi.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex60 -ksp_type scg -pc_type jacobi -ksp_scg_s 3 -ksp_norm_type unpreconditioned  > ex60_scg_jacobi.tmp 2> runex60_scg_jacobi.err
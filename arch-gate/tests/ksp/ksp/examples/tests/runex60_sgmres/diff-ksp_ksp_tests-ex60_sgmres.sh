@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex60_sgmres.out ex60_sgmres.tmp > diff-runex60_sgmres.out 2> diff-runex60_sgmres.out
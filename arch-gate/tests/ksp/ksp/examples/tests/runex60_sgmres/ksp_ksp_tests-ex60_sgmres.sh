@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex60 -ksp_type sgmres -pc_type none -ksp_sgmres_restart 20  > ex60_sgmres.tmp 2> runex60_sgmres.err
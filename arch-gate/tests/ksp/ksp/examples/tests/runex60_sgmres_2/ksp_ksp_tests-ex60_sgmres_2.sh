@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex60 -ksp_type sgmres -pc_type none -ksp_sgmres_restart 20  > ex60_sgmres_2.tmp 2> runex60_sgmres_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex60_sgmres_ilu.out ex60_sgmres_ilu.tmp > diff-runex60_sgmres_ilu.out 2> diff-runex60_sgmres_ilu.out
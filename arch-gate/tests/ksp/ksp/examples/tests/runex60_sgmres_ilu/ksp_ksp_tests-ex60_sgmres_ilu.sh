@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex60 -ksp_type sgmres -pc_type ilu -ksp_sgmres_s 5 -ksp_sgmres_restart 20  > ex60_sgmres_ilu.tmp 2> runex60_sgmres_ilu.err
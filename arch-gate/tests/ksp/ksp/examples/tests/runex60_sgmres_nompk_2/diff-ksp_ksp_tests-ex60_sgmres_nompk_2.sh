@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex60_sgmres_nompk_2.out ex60_sgmres_nompk_2.tmp > diff-runex60_sgmres_nompk_2.out 2> diff-runex60_sgmres_nompk_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex60 -ksp_type sgmres -pc_type none -ksp_sgmres_restart 20 -ksp_sgmres_matrix_powers 0  > ex60_sgmres_nompk_2.tmp 2> runex60_sgmres_nompk_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex61   -mat_type sell -nonzero_guess 0 > ex61_1.tmp 2> runex61_1.err
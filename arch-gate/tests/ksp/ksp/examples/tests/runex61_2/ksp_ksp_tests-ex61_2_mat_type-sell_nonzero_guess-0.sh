@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex61   -mat_type sell -nonzero_guess 0 > ex61_2.tmp 2> runex61_2.err
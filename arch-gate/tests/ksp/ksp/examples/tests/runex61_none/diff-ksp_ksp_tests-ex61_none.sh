@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex61_1.out ex61_none.tmp > diff-runex61_none.out 2> diff-runex61_none.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex61 -pc_type none -ksp_chebyshev_eigenvalues 0.5,20 -nonzero_guess 1  > ex61_none.tmp 2> runex61_none.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex61_1.out ex61_rowmax.tmp > diff-runex61_rowmax.out 2> diff-runex61_rowmax.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex61 -pc_jacobi_type rowmax -pc_jacobi_abs -nonzero_guess 1  > ex61_rowmax.tmp 2> runex61_rowmax.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex62_1.out ex62_1.tmp > diff-runex62_1.out 2> diff-runex62_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex62   > ex62_1.tmp 2> runex62_1.err
@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex23'
+testname='runex23_3'
+label='dm_tests-ex23_3'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-two'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2 4}
+dof_in=${dof:-1 3}
+stencil_type_in=${stencil_type:-0 1}
+
+
+for nsize in ${nsize_in}; do
+   for dof in ${dof_in}; do
+      for stencil_type in ${stencil_type_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -dof ${dof} -stencil_type ${stencil_type}" ex23_3.tmp ${testname}.err "${label}_nsize-${nsize}dof-${dof}_stencil_type-${stencil_type}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/dm/examples/tests/output/ex23_3.out ex23_3.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_nsize-${nsize}dof-${dof}_stencil_type-${stencil_type} ""
+         else
+            printf "ok ${label} # SKIP Command failed so no diff\n"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests" 
@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex61'
+testname='runex61_2'
+label='ksp_ksp_tests-ex61_2'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args=''
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-3}
+mat_type_in=${mat_type:-aij sell}
+nonzero_guess_in=${nonzero_guess:-0 1}
+
+
+for nsize in ${nsize_in}; do
+   for mat_type in ${mat_type_in}; do
+      for nonzero_guess in ${nonzero_guess_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -mat_type ${mat_type} -nonzero_guess ${nonzero_guess}" ex61_2.tmp ${testname}.err "${label}_mat_type-${mat_type}_nonzero_guess-${nonzero_guess}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex61_1.out ex61_2.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_mat_type-${mat_type}_nonzero_guess-${nonzero_guess} ""
+         else
+            printf "ok ${label} # SKIP Command failed so no diff\n"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests" 
@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex8'
+testname='runex8_2'
+label='ksp_ksp_tutorials-ex8_2'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-print_error -pc_asm_blocks 8'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2}
+pc_asm_local_type_in=${pc_asm_local_type:-additive multiplicative}
+pc_asm_type_in=${pc_asm_type:-basic restrict}
+
+
+for nsize in ${nsize_in}; do
+   for pc_asm_local_type in ${pc_asm_local_type_in}; do
+      for pc_asm_type in ${pc_asm_type_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -pc_asm_local_type ${pc_asm_local_type} -pc_asm_type ${pc_asm_type}" ex8_2.tmp ${testname}.err "${label}_pc_asm_local_type-${pc_asm_local_type}_pc_asm_type-${pc_asm_type}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tutorials/output/ex8_2.out ex8_2.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_pc_asm_local_type-${pc_asm_local_type}_pc_asm_type-${pc_asm_type} ""
+         else
+            printf "ok ${label} # SKIP Command failed so no diff\n"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests" 
@@ -0,0 +1,67 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex199'
+testname='runex199_1'
+label='mat_tests-ex199_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-f ${DATAFILESPATH}/matrices/arco1'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    if test -z "${DATAFILESPATH}"; then
+        printf "ok ${label} # SKIP Requires DATAFILESPATH\n"
+        total=1; skip=1
+        petsc_testend "/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests" 
+        exit
+    fi
+fi
+
+
+nsize_in=${nsize:-3}
+mat_coloring_type_in=${mat_coloring_type:- jp power natural greedy}
+mat_coloring_distance_in=${mat_coloring_distance:- 1 2}
+
+
+for nsize in ${nsize_in}; do
+   for mat_coloring_type in ${mat_coloring_type_in}; do
+      for mat_coloring_distance in ${mat_coloring_distance_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -mat_coloring_type ${mat_coloring_type} -mat_coloring_distance ${mat_coloring_distance}" ex199_1.tmp ${testname}.err "${label}_mat_coloring_type-${mat_coloring_type}_mat_coloring_distance-${mat_coloring_distance}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/mat/examples/tests/output/ex199_1.out ex199_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_mat_coloring_type-${mat_coloring_type}_mat_coloring_distance-${mat_coloring_distance} ""
+         else
+            printf "ok ${label} # SKIP Command failed so no diff\n"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests" 
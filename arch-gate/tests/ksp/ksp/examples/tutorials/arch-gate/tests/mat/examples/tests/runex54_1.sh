@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex54'
+testname='runex54_1'
+label='mat_tests-ex54_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args=''
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1 3}
+mat_block_size_in=${mat_block_size:-1 3 4 6 8}
+ov_in=${ov:-1 3}
+mat_size_in=${mat_size:-11 13}
+nd_in=${nd:-7}
+
+
+for nsize in ${nsize_in}; do
+   for mat_block_size in ${mat_block_size_in}; do
+      for ov in ${ov_in}; do
+         for mat_size in ${mat_size_in}; do
+            for nd in ${nd_in}; do
+
+               petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -mat_block_size ${mat_block_size} -ov ${ov} -mat_size ${mat_size} -nd ${nd}" ex54_1.tmp ${testname}.err "${label}_nsize-${nsize}mat_block_size-${mat_block_size}_ov-${ov}_mat_size-${mat_size}_nd-${nd}" 
+               res=$?
+
+               if test $res = 0; then
+                  petsc_testrun "${diff_exe} /root/repo/src/mat/examples/tests/output/ex54.out ex54_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_nsize-${nsize}mat_block_size-${mat_block_size}_ov-${ov}_mat_size-${mat_size}_nd-${nd} ""
+               else
+                  printf "ok ${label} # SKIP Command failed so no diff\n"
+               fi
+
+            done
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests/ksp/ksp/examples/tutorials/arch-gate/tests" 
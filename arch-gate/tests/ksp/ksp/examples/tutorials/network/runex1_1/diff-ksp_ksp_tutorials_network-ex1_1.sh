@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/network/output/ex1_1.out ex1_1.tmp > diff-runex1_1.out 2> diff-runex1_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ksp_monitor_short  > ex1_1.tmp 2> runex1_1.err
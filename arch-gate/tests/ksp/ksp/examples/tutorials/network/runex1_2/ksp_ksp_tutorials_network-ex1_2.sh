@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex1 -petscpartitioner_type simple -ksp_converged_reason  > ex1_2.tmp 2> runex1_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1_nest -ksp_converged_reason  > ex1_nest.tmp 2> runex1_nest.err
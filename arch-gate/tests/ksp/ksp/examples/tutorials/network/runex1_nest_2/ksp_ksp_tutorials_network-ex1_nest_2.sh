@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex1_nest -petscpartitioner_type simple -ksp_converged_reason  > ex1_nest_2.tmp 2> runex1_nest_2.err
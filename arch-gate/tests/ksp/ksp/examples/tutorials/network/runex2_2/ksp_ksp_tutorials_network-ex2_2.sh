@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -petscpartitioner_type simple -pc_type asm -sub_pc_type ilu -ksp_converged_reason  > ex2_2.tmp 2> runex2_2.err
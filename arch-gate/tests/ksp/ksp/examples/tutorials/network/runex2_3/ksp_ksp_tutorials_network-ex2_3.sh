@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex2 -petscpartitioner_type simple -pc_type asm -sub_pc_type lu -sub_pc_factor_shift_type nonzero -ksp_converged_reason  > ex2_3.tmp 2> runex2_3.err
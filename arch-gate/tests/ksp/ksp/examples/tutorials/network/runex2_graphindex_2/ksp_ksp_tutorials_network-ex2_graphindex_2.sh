@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -petscpartitioner_type simple -n 20 -vertex_global_section_view -edge_global_section_view  > ex2_graphindex_2.tmp 2> runex2_graphindex_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex12 -ksp_gmres_cgs_refinement_type refine_always  > ex12_1.tmp 2> runex12_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex15 -ksp_view -user_defined_pc -ksp_gmres_cgs_refinement_type refine_always  > ex15_1.tmp 2> runex15_1.err
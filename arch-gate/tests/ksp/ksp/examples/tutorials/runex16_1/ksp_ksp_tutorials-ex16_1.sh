@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex16 -ntimes 4 -ksp_gmres_cgs_refinement_type refine_always  > ex16_1.tmp 2> runex16_1.err
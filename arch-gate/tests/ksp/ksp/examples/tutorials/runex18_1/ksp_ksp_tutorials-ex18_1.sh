@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex18 -m 39 -n 18 -ksp_monitor_short -permute nd  > ex18_1.tmp 2> runex18_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex18 -m 13 -n 17 -ksp_monitor_short -ksp_type cg -ksp_cg_single_reduction  > ex18_3.tmp 2> runex18_3.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex18 -m 13 -n 17 -ksp_monitor_short -ksp_type cg -pc_type icc -pc_factor_mat_solver_type bas -ksp_view -pc_factor_levels 1  2>&1 | cat > ex18_bas.tmp
+cat ex18_bas.tmp | grep -v "variant " > ex18_bas.tmp.tmp 2>> runex18_bas.err && mv ex18_bas.tmp.tmp ex18_bas.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex1_1.tmp 2> runex1_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex23 -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex23_1.tmp 2> runex23_1.err
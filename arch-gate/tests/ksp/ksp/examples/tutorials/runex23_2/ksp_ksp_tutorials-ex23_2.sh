@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex23 -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex23_2.tmp 2> runex23_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex23 -ksp_monitor_short -ksp_rtol 1e-6 -ksp_type pipefgmres  > ex23_3.tmp 2> runex23_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex29_3.out ex29_3.tmp > diff-runex29_3.out 2> diff-runex29_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always  > ex2_2.tmp 2> runex2_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -pc_type sor -pc_sor_symmetric -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex2_3.tmp 2> runex2_3.err
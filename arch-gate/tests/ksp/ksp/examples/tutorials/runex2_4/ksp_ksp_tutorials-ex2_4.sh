@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -pc_type eisenstat -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex2_4.tmp 2> runex2_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_bjacobi_3.out ex2_bjacobi_3.tmp > diff-runex2_bjacobi_3.out 2> diff-runex2_bjacobi_3.out
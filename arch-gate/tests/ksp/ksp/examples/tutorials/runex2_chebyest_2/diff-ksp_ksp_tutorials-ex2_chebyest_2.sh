@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_chebyest_2.out ex2_chebyest_2.tmp > diff-runex2_chebyest_2-0.out 2> diff-runex2_chebyest_2-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_chebyest_2_alt.out ex2_chebyest_2.tmp > diff-runex2_chebyest_2-1.out 2> diff-runex2_chebyest_2-1.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_chebyest_2_alt_2.out ex2_chebyest_2.tmp > diff-runex2_chebyest_2.out 2> diff-runex2_chebyest_2.out
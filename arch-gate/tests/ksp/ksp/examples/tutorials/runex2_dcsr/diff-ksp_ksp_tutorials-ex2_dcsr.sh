@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_dcsr.out ex2_dcsr.tmp > diff-runex2_dcsr.out 2> diff-runex2_dcsr.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex2 -ksp_monitor_short -m 4 -n 20 -mat_mpiaij_dcsr  > ex2_dcsr.tmp 2> runex2_dcsr.err
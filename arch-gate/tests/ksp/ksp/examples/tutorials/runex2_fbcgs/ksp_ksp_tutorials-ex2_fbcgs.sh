@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -ksp_type fbcgs -pc_type ilu  > ex2_fbcgs.tmp 2> runex2_fbcgs.err
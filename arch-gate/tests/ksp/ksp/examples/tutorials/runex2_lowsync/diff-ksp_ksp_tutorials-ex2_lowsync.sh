@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_lowsync.out ex2_lowsync.tmp > diff-runex2_lowsync.out 2> diff-runex2_lowsync.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -ksp_monitor_short -m 9 -n 9 -ksp_gmres_lowsyncgramschmidt  > ex2_lowsync.tmp 2> runex2_lowsync.err
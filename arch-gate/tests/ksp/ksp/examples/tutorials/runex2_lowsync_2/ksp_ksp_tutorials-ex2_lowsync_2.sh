@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -ksp_monitor_short -m 9 -n 9 -pc_type bjacobi -sub_pc_type ilu -ksp_gmres_lowsyncgramschmidt  > ex2_lowsync_2.tmp 2> runex2_lowsync_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -ksp_monitor_short -m 9 -n 9 -ksp_type fgmres -pc_type bjacobi -sub_pc_type ilu -ksp_gmres_lowsyncgramschmidt -ksp_gmres_restart 10  > ex2_lowsync_fgmres.tmp 2> runex2_lowsync_fgmres.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pipecg.out ex2_pipecg.tmp > diff-runex2_pipecg.out 2> diff-runex2_pipecg.out
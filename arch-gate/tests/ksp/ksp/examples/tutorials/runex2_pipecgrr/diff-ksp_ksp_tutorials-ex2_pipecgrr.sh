@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pipecgrr.out ex2_pipecgrr.tmp > diff-runex2_pipecgrr.out 2> diff-runex2_pipecgrr.out
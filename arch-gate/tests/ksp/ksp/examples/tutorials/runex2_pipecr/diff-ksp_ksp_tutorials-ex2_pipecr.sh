@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pipecr.out ex2_pipecr.tmp > diff-runex2_pipecr.out 2> diff-runex2_pipecr.out
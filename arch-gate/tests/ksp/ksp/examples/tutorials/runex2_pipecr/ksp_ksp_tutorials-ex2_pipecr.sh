@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -ksp_monitor_short -ksp_type pipecr -m 9 -n 9  > ex2_pipecr.tmp 2> runex2_pipecr.err
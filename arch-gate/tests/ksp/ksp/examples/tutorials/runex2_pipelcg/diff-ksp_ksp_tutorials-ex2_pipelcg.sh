@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pipelcg.out ex2_pipelcg.tmp > diff-runex2_pipelcg.out 2> diff-runex2_pipelcg.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -ksp_monitor_short -ksp_type pipelcg -m 9 -n 9 -pc_type none -ksp_pipelcg_pipel 2 -ksp_pipelcg_lmax 2  2>&1 | cat > ex2_pipelcg.tmp
+cat ex2_pipelcg.tmp | grep -v "sqrt breakdown in iteration" > ex2_pipelcg.tmp.tmp 2>> runex2_pipelcg.err && mv ex2_pipelcg.tmp.tmp ex2_pipelcg.tmp
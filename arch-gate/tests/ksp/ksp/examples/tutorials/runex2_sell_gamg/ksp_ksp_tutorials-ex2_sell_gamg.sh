@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -ksp_monitor_short -m 9 -n 9 -mat_type sell -pc_type gamg  > ex2_sell_gamg.tmp 2> runex2_sell_gamg.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_split_mult.out ex2_split_mult.tmp > diff-runex2_split_mult.out 2> diff-runex2_split_mult.out
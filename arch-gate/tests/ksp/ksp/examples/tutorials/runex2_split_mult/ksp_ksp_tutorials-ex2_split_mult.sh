@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex2 -ksp_monitor_short -m 12 -n 10 -mat_mpiaij_split_mult  > ex2_split_mult.tmp 2> runex2_split_mult.err
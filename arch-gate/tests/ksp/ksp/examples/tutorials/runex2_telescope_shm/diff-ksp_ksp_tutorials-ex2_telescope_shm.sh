@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_telescope.out ex2_telescope_shm.tmp > diff-runex2_telescope_shm.out 2> diff-runex2_telescope_shm.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex2 -m 100 -n 100 -ksp_converged_reason -pc_type telescope -pc_telescope_use_shared_memory -telescope_pc_type bjacobi  > ex2_telescope_shm.tmp 2> runex2_telescope_shm.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex30   > ex30_1.tmp 2> runex30_1.err
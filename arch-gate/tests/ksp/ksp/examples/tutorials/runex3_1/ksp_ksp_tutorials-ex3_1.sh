@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex3 -ksp_monitor_short  > ex3_1.tmp 2> runex3_1.err
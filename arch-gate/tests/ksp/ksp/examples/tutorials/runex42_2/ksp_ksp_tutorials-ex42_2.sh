@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex42 -stokes_ksp_monitor_short -stokes_ksp_converged_reason -stokes_pc_type redundant -stokes_redundant_pc_type lu  > ex42_2.tmp 2> runex42_2.err
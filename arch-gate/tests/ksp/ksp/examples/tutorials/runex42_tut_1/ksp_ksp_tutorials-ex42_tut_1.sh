@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex42 -stokes_ksp_monitor  > ex42_tut_1.tmp 2> runex42_tut_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_1.out ex43_1.tmp > diff-runex43_1.out 2> diff-runex43_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_5.out ex43_5.tmp > diff-runex43_5.out 2> diff-runex43_5.out
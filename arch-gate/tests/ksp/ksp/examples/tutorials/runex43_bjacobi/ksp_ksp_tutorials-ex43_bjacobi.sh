@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex43 -stokes_ksp_rtol 1.e-4 -stokes_pc_type bjacobi -stokes_pc_bjacobi_blocks 2 -dm_mat_type aij -stokes_ksp_converged_reason  > ex43_bjacobi.tmp 2> runex43_bjacobi.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_fetidp_unsym.out ex43_fetidp_unsym.tmp > diff-runex43_fetidp_unsym.out 2> diff-runex43_fetidp_unsym.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex45 -ksp_monitor_short -da_grid_x 21 -da_grid_y 21 -da_grid_z 21 -pc_type mg -pc_mg_levels 3 -mg_levels_ksp_type richardson -mg_levels_ksp_max_it 1 -mg_levels_pc_type bjacobi  > ex45_2.tmp 2> runex45_2.err
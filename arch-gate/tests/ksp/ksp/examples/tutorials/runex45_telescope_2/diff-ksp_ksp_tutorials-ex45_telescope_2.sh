@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex45_telescope_2.out ex45_telescope_2.tmp > diff-runex45_telescope_2.out 2> diff-runex45_telescope_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex49_5.out ex49_5.tmp > diff-runex49_5.out 2> diff-runex49_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex49_bddc_layerjump.out ex49_bddc_layerjump.tmp > diff-runex49_bddc_layerjump.out 2> diff-runex49_bddc_layerjump.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex49 -mx 40 -my 40 -elas_ksp_monitor_short -no_view -c_str 3 -sponge_E0 1 -sponge_E1 1000 -sponge_nu0 0.4 -sponge_nu1 0.2 -sponge_t 1 -sponge_w 8 -elas_ksp_type cg -elas_pc_type bddc -elas_pc_bddc_monolithic -dm_mat_type is -elas_ksp_norm_type natural  > ex49_bddc_layerjump.tmp 2> runex49_bddc_layerjump.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 9 ../ex49 -mx 30 -my 30 -elas_ksp_monitor_short -no_view -c_str 2 -brick_E 1,1000 -brick_nu 0.4,0.2 -brick_span 10 -elas_ksp_type cg -elas_pc_type bddc -elas_pc_bddc_monolithic -dm_mat_type is -elas_pc_bddc_use_deluxe_scaling -elas_ksp_norm_type natural -elas_pc_bddc_schur_layers 1  > ex49_bddc_subdomainjump_deluxe.tmp 2> runex49_bddc_subdomainjump_deluxe.err
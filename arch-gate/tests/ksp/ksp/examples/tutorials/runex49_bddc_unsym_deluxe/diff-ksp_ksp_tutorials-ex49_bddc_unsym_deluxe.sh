@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex49_bddc_unsym_deluxe.out ex49_bddc_unsym_deluxe.tmp > diff-runex49_bddc_unsym_deluxe.out 2> diff-runex49_bddc_unsym_deluxe.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex49 -elas_ksp_monitor_short -no_view -elas_ksp_converged_reason -elas_ksp_type cg -elas_ksp_norm_type natural -mx 22 -my 22 -dm_mat_type is -elas_pc_type bddc -elas_pc_bddc_monolithic -use_nonsymbc -elas_pc_bddc_symmetric 0 -elas_pc_bddc_use_deluxe_scaling -elas_sub_schurs_symmetric 0  > ex49_bddc_unsym_deluxe.tmp 2> runex49_bddc_unsym_deluxe.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex50 -da_grid_x 4 -da_grid_y 4 -mat_view  > ex50_tut_1.tmp 2> runex50_tut_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex54 -ne 49 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -mg_levels_esteig_ksp_type cg  > ex54_1.tmp 2> runex54_1.err
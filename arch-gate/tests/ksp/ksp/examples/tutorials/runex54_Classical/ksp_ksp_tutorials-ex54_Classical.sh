@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex54 -ne 49 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_type classical -mg_levels_ksp_chebyshev_esteig 0,0.05,0,1.05 -ksp_converged_reason -mg_levels_esteig_ksp_type cg  > ex54_Classical.tmp 2> runex54_Classical.err
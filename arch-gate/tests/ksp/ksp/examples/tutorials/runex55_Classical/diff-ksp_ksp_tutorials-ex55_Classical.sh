@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex55_classical.out ex55_Classical.tmp > diff-runex55_Classical.out 2> diff-runex55_Classical.out
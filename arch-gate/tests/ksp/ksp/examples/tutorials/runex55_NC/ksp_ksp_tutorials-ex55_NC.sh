@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex55 -ne 29 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -mg_levels_esteig_ksp_type cg  > ex55_NC.tmp 2> runex55_NC.err
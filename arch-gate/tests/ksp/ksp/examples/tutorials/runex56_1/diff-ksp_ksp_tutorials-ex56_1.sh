@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_1.out ex56_1.tmp > diff-runex56_1.out 2> diff-runex56_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_esteig.out ex56_esteig.tmp > diff-runex56_esteig.out 2> diff-runex56_esteig.out
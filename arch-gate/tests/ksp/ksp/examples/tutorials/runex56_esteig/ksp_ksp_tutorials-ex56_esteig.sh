@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex56 -ne 9 -alpha 1.e-3 -ksp_converged_reason -ksp_type cg -ksp_max_it 50 -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -pc_gamg_coarse_eq_limit 100 -mg_levels_ksp_type chebyshev -mg_levels_pc_type jacobi -two_solves -use_mat_nearnullspace -pc_gamg_use_sa_esteig -pc_gamg_esteig_reuse 2  > ex56_esteig.tmp 2> runex56_esteig.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_latebs.out ex56_latebs.tmp > diff-runex56_latebs.out 2> diff-runex56_latebs.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_mis2.out ex56_mis2.tmp > diff-runex56_mis2.out 2> diff-runex56_mis2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex56 -ne 9 -alpha 1.e-3 -ksp_converged_reason -ksp_type cg -ksp_max_it 50 -pc_type gamg -pc_gamg_agg_nsmooths 1 -pc_gamg_square_graph 1 -pc_gamg_aggressive_mis2 -pc_gamg_threshold 0.01 -pc_gamg_coarse_eq_limit 200 -mg_levels_ksp_type chebyshev -mg_levels_pc_type sor -use_mat_nearnullspace -mg_levels_esteig_ksp_type cg  > ex56_mis2.tmp 2> runex56_mis2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_nns.out ex56_nns.tmp > diff-runex56_nns.out 2> diff-runex56_nns.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex56 -use_mat_nearnullspace -ksp_monitor_short -pc_type telescope -pc_telescope_reduction_factor 2 -telescope_pc_type gamg  > ex56_nns_telescope.tmp 2> runex56_nns_telescope.err
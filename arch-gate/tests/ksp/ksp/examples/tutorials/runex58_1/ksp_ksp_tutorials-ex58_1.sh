@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -mat_type aij  > ex58_1.tmp 2> runex58_1.err
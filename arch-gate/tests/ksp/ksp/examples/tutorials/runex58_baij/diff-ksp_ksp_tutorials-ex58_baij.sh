@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex58.out ex58_baij.tmp > diff-runex58_baij.out 2> diff-runex58_baij.out
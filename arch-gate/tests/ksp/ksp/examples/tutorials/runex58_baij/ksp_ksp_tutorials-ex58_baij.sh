@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -mat_type baij  > ex58_baij.tmp 2> runex58_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex58.out ex58_sbaij.tmp > diff-runex58_sbaij.out 2> diff-runex58_sbaij.out
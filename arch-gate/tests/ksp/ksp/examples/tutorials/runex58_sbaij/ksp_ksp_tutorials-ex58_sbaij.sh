@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -mat_type sbaij  > ex58_sbaij.tmp 2> runex58_sbaij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex59 -npx 2 -npy 2 -nex 6 -ney 6 -fluxes_ksp_max_it 10 -physical_ksp_max_it 10 -npz 1 -nez 1  > ex59_bddc_fetidp_3.tmp 2> runex59_bddc_fetidp_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex59 -npx 2 -npy 2 -nex 6 -ney 6 -fluxes_ksp_max_it 10 -physical_ksp_max_it 10 -npz 1 -nez 1 -physical_pc_bddc_use_change_of_basis -physical_pc_bddc_use_deluxe_scaling -physical_pc_bddc_deluxe_singlemat -fluxes_fetidp_ksp_type cg  > ex59_bddc_fetidp_4.tmp 2> runex59_bddc_fetidp_4.err
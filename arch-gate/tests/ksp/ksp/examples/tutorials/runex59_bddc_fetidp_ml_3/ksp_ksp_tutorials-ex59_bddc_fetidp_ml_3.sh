@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex59 -npx 2 -npy 2 -nex 6 -ney 6 -fluxes_ksp_max_it 10 -physical_ksp_max_it 10 -physical_ksp_view -physical_pc_bddc_levels 1 -physical_pc_bddc_coarsening_ratio 4  2>&1 | cat > ex59_bddc_fetidp_ml_3.tmp
+cat ex59_bddc_fetidp_ml_3.tmp | grep -v "variant HERMITIAN" > ex59_bddc_fetidp_ml_3.tmp.tmp 2>> runex59_bddc_fetidp_ml_3.err && mv ex59_bddc_fetidp_ml_3.tmp.tmp ex59_bddc_fetidp_ml_3.tmp
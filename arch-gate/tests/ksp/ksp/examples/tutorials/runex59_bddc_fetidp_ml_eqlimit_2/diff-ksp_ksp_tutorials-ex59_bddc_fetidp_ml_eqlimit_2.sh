@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex59_bddc_fetidp_ml_eqlimit.out ex59_bddc_fetidp_ml_eqlimit_2.tmp > diff-runex59_bddc_fetidp_ml_eqlimit_2.out 2> diff-runex59_bddc_fetidp_ml_eqlimit_2.out
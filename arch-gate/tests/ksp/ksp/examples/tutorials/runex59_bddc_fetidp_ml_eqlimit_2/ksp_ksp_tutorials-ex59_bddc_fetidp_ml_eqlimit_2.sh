@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 9 ../ex59 -npx 3 -npy 3 -p 2 -nex 6 -ney 6 -physical_pc_bddc_deluxe_singlemat -physical_pc_bddc_use_deluxe_scaling -physical_pc_bddc_graph_maxcount 1 -physical_pc_bddc_levels 3 -physical_pc_bddc_coarsening_ratio 2 -physical_pc_bddc_coarse_ksp_type gmres -physical_pc_bddc_coarse_eqs_limit 46  > ex59_bddc_fetidp_ml_eqlimit_2.tmp 2> runex59_bddc_fetidp_ml_eqlimit_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex5 -pc_type asm  > ex5_asm.tmp 2> runex5_asm.err
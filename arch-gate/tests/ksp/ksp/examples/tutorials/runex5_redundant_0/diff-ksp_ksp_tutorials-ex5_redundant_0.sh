@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex5_redundant_0.out ex5_redundant_0.tmp > diff-runex5_redundant_0.out 2> diff-runex5_redundant_0.out
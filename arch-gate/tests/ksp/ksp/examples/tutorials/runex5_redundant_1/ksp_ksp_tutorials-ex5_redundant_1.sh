@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex5 -pc_type redundant -pc_redundant_number 1 -redundant_ksp_type gmres -redundant_pc_type jacobi  > ex5_redundant_1.tmp 2> runex5_redundant_1.err
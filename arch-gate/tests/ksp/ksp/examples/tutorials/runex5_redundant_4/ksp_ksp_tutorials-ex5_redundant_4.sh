@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex5 -pc_type redundant -pc_redundant_number 3 -redundant_ksp_type gmres -redundant_pc_type jacobi -psubcomm_type interlaced  > ex5_redundant_4.tmp 2> runex5_redundant_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex60_6.out ex60_6.tmp > diff-runex60_6.out 2> diff-runex60_6.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex62_2D_3.out ex62_2D_3.tmp > diff-runex62_2D_3.out 2> diff-runex62_2D_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex65_1.out ex65_1.tmp > diff-runex65_1.out 2> diff-runex65_1.out
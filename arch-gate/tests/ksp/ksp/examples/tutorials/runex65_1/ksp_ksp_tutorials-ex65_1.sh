@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex65 -ksp_monitor -pc_type mg -da_refine 3  > ex65_1.tmp 2> runex65_1.err
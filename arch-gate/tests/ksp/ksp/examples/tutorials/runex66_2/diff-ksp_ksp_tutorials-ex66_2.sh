@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex66_2.out ex66_2.tmp > diff-runex66_2.out 2> diff-runex66_2.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex67 -symmetric false -ksp_view -ksp_converged_reason -pc_type jacobi -mat_no_inode -ksp_monitor_true_residual -ksp_rtol 1.e-14 -ksp_max_it 12 -ksp_pc_side left  2>&1 | cat > ex67_nonsymmetric_left.tmp
+cat ex67_nonsymmetric_left.tmp | sed s/ATOL/RTOL/g > ex67_nonsymmetric_left.tmp.tmp 2>> runex67_nonsymmetric_left.err && mv ex67_nonsymmetric_left.tmp.tmp ex67_nonsymmetric_left.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex67_symmetric_left.out ex67_symmetric_left.tmp > diff-runex67_symmetric_left.out 2> diff-runex67_symmetric_left.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex67 -ksp_view -ksp_converged_reason -pc_type sor -mat_no_inode -ksp_monitor_true_residual -ksp_rtol 1.e-14 -ksp_max_it 12 -ksp_pc_side right  2>&1 | cat > ex67_symmetric_right.tmp
+cat ex67_symmetric_right.tmp | sed s/ATOL/RTOL/g > ex67_symmetric_right.tmp.tmp 2>> runex67_symmetric_right.err && mv ex67_symmetric_right.tmp.tmp ex67_symmetric_right.tmp
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex67 -symmetric false -ksp_monitor -ksp_view -pc_type asm -sub_pc_type lu -sub_pc_factor_zeropivot 1.e-33 -ksp_converged_reason  2>&1 | cat > ex67_transpose_asm.tmp
+cat ex67_transpose_asm.tmp | sed s/ATOL/RTOL/g > ex67_transpose_asm.tmp.tmp 2>> runex67_transpose_asm.err && mv ex67_transpose_asm.tmp.tmp ex67_transpose_asm.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex6 -ksp_view  > ex6_1.tmp 2> runex6_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex6 -user_subdomains -ksp_view ${ARGS}  > ex6_2.tmp 2> runex6_2.err
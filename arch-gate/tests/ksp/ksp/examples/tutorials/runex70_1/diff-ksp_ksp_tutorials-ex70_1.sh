@@ -0,0 +1 @@
+grep -v atomic /root/repo/src/ksp/ksp/examples/tutorials/output/ex70_1.out | /root/repo/lib/petsc/bin/petscdiff  - ex70_1.tmp > diff-runex70_1.out 2> diff-runex70_1.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex70 -no_view  2>&1 | cat > ex70_1.tmp
+cat ex70_1.tmp | grep -v atomic > ex70_1.tmp.tmp 2>> runex70_1.err && mv ex70_1.tmp.tmp ex70_1.tmp
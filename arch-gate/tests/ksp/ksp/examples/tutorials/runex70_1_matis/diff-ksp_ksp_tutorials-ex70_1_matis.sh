@@ -0,0 +1 @@
+grep -v atomic /root/repo/src/ksp/ksp/examples/tutorials/output/ex70_1_matis.out | /root/repo/lib/petsc/bin/petscdiff  - ex70_1_matis.tmp > diff-runex70_1_matis.out 2> diff-runex70_1_matis.out
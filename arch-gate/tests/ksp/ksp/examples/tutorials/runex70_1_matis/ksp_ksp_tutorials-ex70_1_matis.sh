@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex70 -no_view -dm_mat_type is  2>&1 | cat > ex70_1_matis.tmp
+cat ex70_1_matis.tmp | grep -v atomic > ex70_1_matis.tmp.tmp 2>> runex70_1_matis.err && mv ex70_1_matis.tmp.tmp ex70_1_matis.tmp
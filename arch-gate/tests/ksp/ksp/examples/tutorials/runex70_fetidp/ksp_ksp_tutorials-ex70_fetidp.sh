@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex70 -no_view -dm_mat_type is -stokes_ksp_type fetidp -mx 80 -my 80 -stokes_ksp_converged_reason -stokes_ksp_rtol 1.0e-8 -ppcell 2 -nt 4 -randomize_coords -stokes_ksp_error_if_not_converged -stokes_fetidp_bddc_pc_bddc_coarse_redundant_pc_type svd  2>&1 | cat > ex70_fetidp.tmp
+cat ex70_fetidp.tmp | grep -v atomic > ex70_fetidp.tmp.tmp 2>> runex70_fetidp.err && mv ex70_fetidp.tmp.tmp ex70_fetidp.tmp
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex70 -no_view -dm_mat_type is -stokes_ksp_type fetidp -mx 80 -my 80 -stokes_ksp_converged_reason -stokes_ksp_rtol 1.0e-8 -ppcell 2 -nt 4 -randomize_coords -stokes_ksp_error_if_not_converged -stokes_fetidp_bddc_pc_bddc_coarse_redundant_pc_type svd -stokes_fetidp_pc_lumped -stokes_fetidp_bddc_pc_bddc_dirichlet_pc_type none -stokes_fetidp_bddc_pc_bddc_switch_static  2>&1 | cat > ex70_fetidp_lumped.tmp
+cat ex70_fetidp_lumped.tmp | grep -v atomic > ex70_fetidp_lumped.tmp.tmp 2>> runex70_fetidp_lumped.err && mv ex70_fetidp_lumped.tmp.tmp ex70_fetidp_lumped.tmp
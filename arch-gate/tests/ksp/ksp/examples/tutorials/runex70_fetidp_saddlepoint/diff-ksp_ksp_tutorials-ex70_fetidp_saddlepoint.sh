@@ -0,0 +1 @@
+grep -v atomic /root/repo/src/ksp/ksp/examples/tutorials/output/ex70_fetidp_saddlepoint.out | /root/repo/lib/petsc/bin/petscdiff  - ex70_fetidp_saddlepoint.tmp > diff-runex70_fetidp_saddlepoint.out 2> diff-runex70_fetidp_saddlepoint.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex70 -no_view -dm_mat_type is -stokes_ksp_type fetidp -mx 80 -my 80 -stokes_ksp_converged_reason -stokes_ksp_rtol 1.0e-8 -ppcell 2 -nt 4 -randomize_coords -stokes_ksp_error_if_not_converged -stokes_ksp_fetidp_saddlepoint -stokes_fetidp_ksp_type cg -stokes_ksp_norm_type natural -stokes_fetidp_pc_fieldsplit_schur_fact_type diag -stokes_fetidp_fieldsplit_p_pc_type bjacobi -stokes_fetidp_fieldsplit_lag_ksp_type preonly -stokes_fetidp_fieldsplit_p_ksp_type preonly -stokes_ksp_fetidp_pressure_field 2 -stokes_fetidp_pc_fieldsplit_schur_scale -1  2>&1 | cat > ex70_fetidp_saddlepoint.tmp
+cat ex70_fetidp_saddlepoint.tmp | grep -v atomic > ex70_fetidp_saddlepoint.tmp.tmp 2>> runex70_fetidp_saddlepoint.err && mv ex70_fetidp_saddlepoint.tmp.tmp ex70_fetidp_saddlepoint.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_bddc_1.out ex71_bddc_1.tmp > diff-runex71_bddc_1.out 2> diff-runex71_bddc_1.out
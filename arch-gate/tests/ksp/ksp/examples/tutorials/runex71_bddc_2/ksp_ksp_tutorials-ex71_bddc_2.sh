@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 8 ../ex71 -pde_type Poisson -dim 3 -dirichlet 0 -ksp_view -use_global -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged  2>&1 | cat > ex71_bddc_2.tmp
+cat ex71_bddc_2.tmp | grep -v "variant HERMITIAN" > ex71_bddc_2.tmp.tmp 2>> runex71_bddc_2.err && mv ex71_bddc_2.tmp.tmp ex71_bddc_2.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_bddc_elast_deluxe_layers.out ex71_bddc_elast_deluxe_layers.tmp > diff-runex71_bddc_elast_deluxe_layers.out 2> diff-runex71_bddc_elast_deluxe_layers.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 8 ../ex71 -pde_type Elasticity -cells 7,9,8 -dim 3 -ksp_view -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged -pc_bddc_monolithic -pc_bddc_use_deluxe_scaling -pc_bddc_schur_layers 1  2>&1 | cat > ex71_bddc_elast_deluxe_layers.tmp
+cat ex71_bddc_elast_deluxe_layers.tmp | grep -v "variant HERMITIAN" > ex71_bddc_elast_deluxe_layers.tmp.tmp 2>> runex71_bddc_elast_deluxe_layers.err && mv ex71_bddc_elast_deluxe_layers.tmp.tmp ex71_bddc_elast_deluxe_layers.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_dmda_matis_poiss_1d.out ex71_dmda_matis_poiss_1d_loc.tmp > diff-runex71_dmda_matis_poiss_1d_loc.out 2> diff-runex71_dmda_matis_poiss_1d_loc.out
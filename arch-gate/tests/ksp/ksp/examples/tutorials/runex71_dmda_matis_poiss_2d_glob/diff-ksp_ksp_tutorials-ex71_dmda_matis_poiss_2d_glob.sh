@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_dmda_matis_poiss_2d.out ex71_dmda_matis_poiss_2d_glob.tmp > diff-runex71_dmda_matis_poiss_2d_glob.out 2> diff-runex71_dmda_matis_poiss_2d_glob.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 9 ../ex71 -test_assembly -assembled_view -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged -dim 2 -cells 5,7 -pde_type Poisson  > ex71_dmda_matis_poiss_2d_loc.tmp 2> runex71_dmda_matis_poiss_2d_loc.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_fetidp_2.out ex71_fetidp_2.tmp > diff-runex71_fetidp_2.out 2> diff-runex71_fetidp_2.out
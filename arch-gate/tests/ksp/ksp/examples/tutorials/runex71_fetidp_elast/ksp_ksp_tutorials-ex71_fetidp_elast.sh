@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 8 ../ex71 -pde_type Elasticity -cells 9,7,8 -dim 3 -ksp_view -ksp_type fetidp -fetidp_ksp_type cg -fetidp_bddc_pc_bddc_coarse_redundant_pc_type svd -ksp_fetidp_fullyredundant -ksp_error_if_not_converged -fetidp_bddc_pc_bddc_monolithic  2>&1 | cat > ex71_fetidp_elast.tmp
+cat ex71_fetidp_elast.tmp | grep -v "variant HERMITIAN" > ex71_fetidp_elast.tmp.tmp 2>> runex71_fetidp_elast.err && mv ex71_fetidp_elast.tmp.tmp ex71_fetidp_elast.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex72 -f0 ${wPETSC_DIR}/share/petsc/datafiles/matrices/spd-real-int32-float64  > ex72_1.tmp 2> runex72_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex72_1a.out ex72_1a.tmp > diff-runex72_1a.out 2> diff-runex72_1a.out
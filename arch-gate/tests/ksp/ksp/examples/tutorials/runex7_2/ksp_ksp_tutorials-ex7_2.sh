@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex7 -ksp_view  > ex7_2.tmp 2> runex7_2.err
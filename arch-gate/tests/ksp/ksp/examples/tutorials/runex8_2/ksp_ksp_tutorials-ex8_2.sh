@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex8 -print_error -pc_asm_blocks 8  > ex8_2.tmp 2> runex8_2.err
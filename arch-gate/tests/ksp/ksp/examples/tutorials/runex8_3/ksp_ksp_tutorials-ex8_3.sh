@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex8 -print_error -pc_asm_blocks 8 -pc_asm_local_type multiplicative  > ex8_3.tmp 2> runex8_3.err
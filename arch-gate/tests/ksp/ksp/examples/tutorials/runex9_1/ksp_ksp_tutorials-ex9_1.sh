@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex9 -t 2 -pc_type jacobi -ksp_monitor_short -ksp_type gmres -ksp_gmres_cgs_refinement_type refine_always -s2_ksp_type bcgs -s2_pc_type jacobi -s2_ksp_monitor_short  > ex9_1.tmp 2> runex9_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1   > ex1_1.tmp 2> runex1_1.err
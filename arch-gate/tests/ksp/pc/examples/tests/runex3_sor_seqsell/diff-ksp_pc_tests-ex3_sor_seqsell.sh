@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/pc/examples/tests/output/ex3_1.out ex3_sor_seqsell.tmp > diff-runex3_sor_seqsell.out 2> diff-runex3_sor_seqsell.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5   > ex5_1.tmp 2> runex5_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex6 -m 7  > ex6_1.tmp 2> runex6_1.err
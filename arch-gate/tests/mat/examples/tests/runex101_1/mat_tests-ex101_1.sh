@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex101   > ex101_1.tmp 2> runex101_1.err
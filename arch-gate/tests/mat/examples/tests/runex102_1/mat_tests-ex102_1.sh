@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex102 -view_product  > ex102_1.tmp 2> runex102_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex102 -low_rank -view_product  > ex102_2.tmp 2> runex102_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex102 -use_c -view_product  > ex102_3.tmp 2> runex102_3.err
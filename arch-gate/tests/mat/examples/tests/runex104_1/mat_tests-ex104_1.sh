@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex104   > ex104_1.tmp 2> runex104_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex107.out ex107_1.tmp > diff-runex107_1.out 2> diff-runex107_1.out
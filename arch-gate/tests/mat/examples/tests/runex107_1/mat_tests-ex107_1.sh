@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex107   > ex107_1.tmp 2> runex107_1.err
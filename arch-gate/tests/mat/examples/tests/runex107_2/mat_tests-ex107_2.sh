@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex107 -mat_type baij -mat_block_size 2 -m 10  > ex107_2.tmp 2> runex107_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex109 -M 10 -N 10  > ex109_1.tmp 2> runex109_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex109   > ex109_2.tmp 2> runex109_2.err
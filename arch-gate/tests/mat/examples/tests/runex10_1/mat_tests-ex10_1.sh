@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex10   > ex10_1.tmp 2> runex10_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex110_1.out ex110_1.tmp > diff-runex110_1.out 2> diff-runex110_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex110   > ex110_1.tmp 2> runex110_1.err
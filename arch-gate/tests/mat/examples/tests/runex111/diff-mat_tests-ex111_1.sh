@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex111_1.out ex111_1.tmp > diff-runex111.out 2> diff-runex111.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex111   > ex111_1.tmp 2> runex111.err
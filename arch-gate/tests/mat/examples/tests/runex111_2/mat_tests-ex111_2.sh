@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex111 -matmatmatmult_via scalable  > ex111_2.tmp 2> runex111_2.err
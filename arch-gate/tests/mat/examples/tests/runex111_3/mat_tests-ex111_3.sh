@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex111 -matmatmatmult_via nonscalable  > ex111_3.tmp 2> runex111_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex114.out ex114_1.tmp > diff-runex114_1.out 2> diff-runex114_1.out
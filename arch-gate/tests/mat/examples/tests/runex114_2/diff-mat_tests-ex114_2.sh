@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex114_2.out ex114_2.tmp > diff-runex114_2.out 2> diff-runex114_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex114   > ex114_2.tmp 2> runex114_2.err
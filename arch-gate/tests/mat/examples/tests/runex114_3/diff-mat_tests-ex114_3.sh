@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex114_3.out ex114_3.tmp > diff-runex114_3.out 2> diff-runex114_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex114 -mat_type baij  > ex114_3.tmp 2> runex114_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex11 -mat_type seqbaij -mat_block_size 5  > ex11_2.tmp 2> runex11_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex11 -keep_nonzero_pattern  > ex11_3.tmp 2> runex11_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex128   > ex128_1.tmp 2> runex128_1.err
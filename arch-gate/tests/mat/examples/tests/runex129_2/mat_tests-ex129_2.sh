@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex129 -dm_mat_type aij -dof 1 -inplacelu  > ex129_2.tmp 2> runex129_2.err
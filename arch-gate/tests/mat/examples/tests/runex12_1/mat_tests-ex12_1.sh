@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex12   2>&1 | cat > ex12_1.tmp
+cat ex12_1.tmp | grep -v "MPI processes" > ex12_1.tmp.tmp 2>> runex12_1.err && mv ex12_1.tmp.tmp ex12_1.tmp
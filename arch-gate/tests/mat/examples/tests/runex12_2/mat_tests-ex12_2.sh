@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex12 -mat_type mpibaij -mat_block_size 3  2>&1 | cat > ex12_2.tmp
+cat ex12_2.tmp | grep -v "MPI processes" > ex12_2.tmp.tmp 2>> runex12_2.err && mv ex12_2.tmp.tmp ex12_2.tmp
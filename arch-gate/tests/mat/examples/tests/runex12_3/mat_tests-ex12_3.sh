@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex12 -mat_type mpiaij -keep_nonzero_pattern  2>&1 | cat > ex12_3.tmp
+cat ex12_3.tmp | grep -v "MPI processes" > ex12_3.tmp.tmp 2>> runex12_3.err && mv ex12_3.tmp.tmp ex12_3.tmp
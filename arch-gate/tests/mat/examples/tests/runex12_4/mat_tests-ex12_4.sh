@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex12 -keep_nonzero_pattern -mat_type mpibaij -mat_block_size 3  2>&1 | cat > ex12_4.tmp
+cat ex12_4.tmp | grep -v "MPI processes" > ex12_4.tmp.tmp 2>> runex12_4.err && mv ex12_4.tmp.tmp ex12_4.tmp
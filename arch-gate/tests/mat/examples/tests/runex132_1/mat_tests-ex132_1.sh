@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex132   > ex132_1.tmp 2> runex132_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex134_1.out ex134_1.tmp > diff-runex134_1.out 2> diff-runex134_1.out
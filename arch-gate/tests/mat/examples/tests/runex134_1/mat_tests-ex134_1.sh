@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex134 -mat_ignore_lower_triangular  > ex134_1.tmp 2> runex134_1.err
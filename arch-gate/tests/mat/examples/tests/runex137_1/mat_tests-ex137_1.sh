@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex137   > ex137_1.tmp 2> runex137_1.err
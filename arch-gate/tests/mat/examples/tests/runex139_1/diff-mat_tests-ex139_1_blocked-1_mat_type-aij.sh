@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex139_1.out ex139_1.tmp > diff-runex139_1.out 2> diff-runex139_1.out
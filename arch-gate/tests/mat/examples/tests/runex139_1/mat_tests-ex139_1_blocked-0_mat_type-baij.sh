@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex139   -blocked 0 -mat_type baij 2>&1 | cat > ex139_1.tmp
+cat ex139_1.tmp | grep -v "type: mpi" > ex139_1.tmp.tmp 2>> runex139_1.err && mv ex139_1.tmp.tmp ex139_1.tmp
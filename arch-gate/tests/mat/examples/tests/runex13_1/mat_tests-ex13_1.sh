@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex13   2>&1 | cat > ex13_1.tmp
+cat ex13_1.tmp | grep -v "MPI processes" > ex13_1.tmp.tmp 2>> runex13_1.err && mv ex13_1.tmp.tmp ex13_1.tmp
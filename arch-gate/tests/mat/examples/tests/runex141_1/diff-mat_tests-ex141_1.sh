@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex141.out ex141_1.tmp > diff-runex141_1.out 2> diff-runex141_1.out
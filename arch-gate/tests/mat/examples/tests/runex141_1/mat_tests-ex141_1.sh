@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex141   > ex141_1.tmp 2> runex141_1.err
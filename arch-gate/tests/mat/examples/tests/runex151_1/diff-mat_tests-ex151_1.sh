@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex151_1.out ex151_1.tmp > diff-runex151_1.out 2> diff-runex151_1.out
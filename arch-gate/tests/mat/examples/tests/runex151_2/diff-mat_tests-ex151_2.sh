@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex151_2.out ex151_2.tmp > diff-runex151_2.out 2> diff-runex151_2.out
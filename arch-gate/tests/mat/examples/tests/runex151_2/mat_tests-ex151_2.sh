@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex151 -view_sparse  > ex151_2.tmp 2> runex151_2.err
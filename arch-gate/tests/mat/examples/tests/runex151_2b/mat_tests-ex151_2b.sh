@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex151 -mat_type baij -view_sparse  > ex151_2b.tmp 2> runex151_2b.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex151 -view_sparse  > ex151_3.tmp 2> runex151_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex151_3b.out ex151_3b.tmp > diff-runex151_3b.out 2> diff-runex151_3b.out
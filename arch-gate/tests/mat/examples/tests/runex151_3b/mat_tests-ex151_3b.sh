@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex151 -mat_type baij -view_sparse  > ex151_3b.tmp 2> runex151_3b.err
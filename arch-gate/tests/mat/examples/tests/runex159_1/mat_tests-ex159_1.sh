@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex159   > ex159_1.tmp 2> runex159_1.err
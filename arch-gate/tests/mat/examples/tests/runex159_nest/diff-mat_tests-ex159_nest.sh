@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex159_nest.out ex159_nest.tmp > diff-runex159_nest.out 2> diff-runex159_nest.out
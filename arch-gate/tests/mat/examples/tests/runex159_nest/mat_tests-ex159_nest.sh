@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex159 -nest  > ex159_nest.tmp 2> runex159_nest.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex160.out ex160_1.tmp > diff-runex160_1.out 2> diff-runex160_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex160   > ex160_1.tmp 2> runex160_1.err
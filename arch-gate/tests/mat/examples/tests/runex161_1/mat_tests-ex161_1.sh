@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex161   > ex161_1.tmp 2> runex161_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex161 -matmattransmult_color -mat_no_inode  > ex161_2.tmp 2> runex161_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex161.out ex161_5.tmp > diff-runex161_5.out 2> diff-runex161_5.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex161 -matmattransmult_color -mat_no_inode -A_matrart_via coloring_rart  > ex161_5.tmp 2> runex161_5.err
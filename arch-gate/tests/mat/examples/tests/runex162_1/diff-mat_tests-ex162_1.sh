@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex162_1.out ex162_1.tmp > diff-runex162_1.out 2> diff-runex162_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex162   > ex162_1.tmp 2> runex162_1.err
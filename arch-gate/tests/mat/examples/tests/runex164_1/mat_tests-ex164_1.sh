@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex164   > ex164_1.tmp 2> runex164_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex172   > ex172_1.tmp 2> runex172_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex172 -different  > ex172_2.tmp 2> runex172_2.err
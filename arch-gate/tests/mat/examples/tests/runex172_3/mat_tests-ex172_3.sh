@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex172 -skip  > ex172_3.tmp 2> runex172_3.err
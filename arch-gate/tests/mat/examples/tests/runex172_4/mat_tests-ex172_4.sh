@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex172 -different -skip  > ex172_4.tmp 2> runex172_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex172 -mat_type baij> ex172.tmp 2>&1  > ex172_mpibaij.tmp 2> runex172_mpibaij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex172 -mat_type sbaij> ex172.tmp 2>&1  > ex172_mpisbaij.tmp 2> runex172_mpisbaij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex172 -mat_type sbaij> ex172.tmp 2>&1  > ex172_sbaij.tmp 2> runex172_sbaij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex173 -f0 ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64  > ex173_1.tmp 2> runex173_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex180_1.out ex180_10.tmp > diff-runex180_10.out 2> diff-runex180_10.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex180 -mat_type baij -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -malloc_dump  > ex180_4more.tmp 2> runex180_4more.err
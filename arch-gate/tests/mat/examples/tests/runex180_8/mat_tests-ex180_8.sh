@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex180 -mat_type sbaij -matload_block_size 4 -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -malloc_dump  > ex180_8.tmp 2> runex180_8.err
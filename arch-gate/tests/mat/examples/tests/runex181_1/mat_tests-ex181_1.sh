@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex181   2>&1 | cat > ex181_1.tmp
+cat ex181_1.tmp | grep -v "Mat Object" > ex181_1.tmp.tmp 2>> runex181_1.err && mv ex181_1.tmp.tmp ex181_1.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex181_2.out ex181_2.tmp > diff-runex181_2.out 2> diff-runex181_2.out
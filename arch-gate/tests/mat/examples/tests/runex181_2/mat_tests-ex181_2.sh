@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex181 -detect_bug  2>&1 | cat > ex181_2.tmp
+cat ex181_2.tmp | grep -v "Mat Object" > ex181_2.tmp.tmp 2>> runex181_2.err && mv ex181_2.tmp.tmp ex181_2.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex182_1.out ex182_1.tmp > diff-runex182_1.out 2> diff-runex182_1.out
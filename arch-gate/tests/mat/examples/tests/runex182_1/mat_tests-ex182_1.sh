@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex182 -info  2>&1 | cat > ex182_1.tmp
+cat ex182_1.tmp | grep malloc | sort -b > ex182_1.tmp.tmp 2>> runex182_1.err && mv ex182_1.tmp.tmp ex182_1.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex182_2.out ex182_2.tmp > diff-runex182_2.out 2> diff-runex182_2.out
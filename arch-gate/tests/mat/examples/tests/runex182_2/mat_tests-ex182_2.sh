@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex182 -info ex182info  2>&1 | cat > ex182_2.tmp
+cat ex182_2.tmp | grep -h malloc "ex182info.0" | sort -b > ex182_2.tmp.tmp 2>> runex182_2.err && mv ex182_2.tmp.tmp ex182_2.tmp
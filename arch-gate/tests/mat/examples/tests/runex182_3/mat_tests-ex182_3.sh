@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex182 -info -mat_type baij  2>&1 | cat > ex182_3.tmp
+cat ex182_3.tmp | grep malloc | sort -b > ex182_3.tmp.tmp 2>> runex182_3.err && mv ex182_3.tmp.tmp ex182_3.tmp
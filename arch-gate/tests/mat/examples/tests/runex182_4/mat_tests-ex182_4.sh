@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex182 -info ex182info -mat_type baij  2>&1 | cat > ex182_4.tmp
+cat ex182_4.tmp | grep -h malloc "ex182info.1" | sort -b > ex182_4.tmp.tmp 2>> runex182_4.err && mv ex182_4.tmp.tmp ex182_4.tmp
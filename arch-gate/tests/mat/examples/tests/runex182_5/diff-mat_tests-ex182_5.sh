@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex182_5.out ex182_5.tmp > diff-runex182_5.out 2> diff-runex182_5.out
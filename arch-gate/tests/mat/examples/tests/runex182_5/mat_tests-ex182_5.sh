@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex182 -info -mat_type sbaij  2>&1 | cat > ex182_5.tmp
+cat ex182_5.tmp | grep malloc | sort  -b > ex182_5.tmp.tmp 2>> runex182_5.err && mv ex182_5.tmp.tmp ex182_5.tmp
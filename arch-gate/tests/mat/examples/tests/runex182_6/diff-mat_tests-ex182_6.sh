@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex182_6.out ex182_6.tmp > diff-runex182_6.out 2> diff-runex182_6.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex182 -info ex182info -mat_type sbaij  2>&1 | cat > ex182_6.tmp
+cat ex182_6.tmp | grep -h malloc "ex182info.0" | sort -b > ex182_6.tmp.tmp 2>> runex182_6.err && mv ex182_6.tmp.tmp ex182_6.tmp
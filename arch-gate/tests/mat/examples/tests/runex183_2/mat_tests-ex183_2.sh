@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex183 -total_subdomains 2  > ex183_2.tmp 2> runex183_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 6 ../ex183 -total_subdomains 2  > ex183_4.tmp 2> runex183_4.err
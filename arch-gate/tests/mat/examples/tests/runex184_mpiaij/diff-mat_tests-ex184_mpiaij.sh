@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex184_mpiaij.out ex184_mpiaij.tmp > diff-runex184_mpiaij.out 2> diff-runex184_mpiaij.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex184 -mat_type mpiaij -mat_size 12 -mat_block_size 3  > ex184_mpiaij.tmp 2> runex184_mpiaij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex184 -mat_type mpibaij -mat_size 12 -mat_block_size 3  > ex184_mpibaij.tmp 2> runex184_mpibaij.err
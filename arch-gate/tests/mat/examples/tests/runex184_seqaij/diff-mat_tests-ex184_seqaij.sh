@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex184_seqaij.out ex184_seqaij.tmp > diff-runex184_seqaij.out 2> diff-runex184_seqaij.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_10.out ex18_10.tmp > diff-runex18_10.out 2> diff-runex18_10.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -bs 2 -nonlocal_bc  > ex18_10.tmp 2> runex18_10.err
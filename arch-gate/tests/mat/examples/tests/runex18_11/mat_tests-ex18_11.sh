@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 7 ../ex18 -bs 2 -nonlocal_bc  > ex18_11.tmp 2> runex18_11.err
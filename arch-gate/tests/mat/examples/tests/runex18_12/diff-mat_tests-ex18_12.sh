@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_12.out ex18_12.tmp > diff-runex18_12.out 2> diff-runex18_12.out
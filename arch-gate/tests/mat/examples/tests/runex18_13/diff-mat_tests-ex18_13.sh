@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_13.out ex18_13.tmp > diff-runex18_13.out 2> diff-runex18_13.out
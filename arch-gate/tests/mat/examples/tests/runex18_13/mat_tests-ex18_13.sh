@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -bs 2 -nonlocal_bc -mat_type baij  > ex18_13.tmp 2> runex18_13.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 7 ../ex18   > ex18_2.tmp 2> runex18_2.err
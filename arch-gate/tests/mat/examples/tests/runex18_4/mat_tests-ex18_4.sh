@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -mat_type baij  > ex18_4.tmp 2> runex18_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex18 -bs 2 -mat_type baij  > ex18_6.tmp 2> runex18_6.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_7.out ex18_7.tmp > diff-runex18_7.out 2> diff-runex18_7.out
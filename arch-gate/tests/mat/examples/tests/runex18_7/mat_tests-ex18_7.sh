@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex18 -bs 2 -mat_type baij  > ex18_7.tmp 2> runex18_7.err
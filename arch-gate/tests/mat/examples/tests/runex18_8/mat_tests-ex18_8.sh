@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 7 ../ex18 -bs 2 -mat_type baij  > ex18_8.tmp 2> runex18_8.err
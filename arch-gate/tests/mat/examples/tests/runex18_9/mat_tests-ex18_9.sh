@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex18 -bs 2 -nonlocal_bc  > ex18_9.tmp 2> runex18_9.err
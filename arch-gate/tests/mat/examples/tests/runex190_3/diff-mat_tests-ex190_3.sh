@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex190_3.out ex190_3.tmp > diff-runex190_3.out 2> diff-runex190_3.out
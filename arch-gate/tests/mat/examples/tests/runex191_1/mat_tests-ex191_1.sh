@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex191   2>&1 | cat > ex191_1.tmp
+cat ex191_1.tmp | grep -v alloced > ex191_1.tmp.tmp 2>> runex191_1.err && mv ex191_1.tmp.tmp ex191_1.tmp
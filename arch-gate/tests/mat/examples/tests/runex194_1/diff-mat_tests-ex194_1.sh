@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex194_1.out ex194_1.tmp > diff-runex194_1.out 2> diff-runex194_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex195_1.out ex195_1.tmp > diff-runex195_1.out 2> diff-runex195_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex195   > ex195_1.tmp 2> runex195_1.err
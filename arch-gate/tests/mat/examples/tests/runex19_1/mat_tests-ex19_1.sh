@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19   > ex19_1.tmp 2> runex19_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex200   > ex200_1.tmp 2> runex200_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex203_1.out ex203_1.tmp > diff-runex203_1.out 2> diff-runex203_1.out
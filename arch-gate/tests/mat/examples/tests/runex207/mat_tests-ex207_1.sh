@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex207   > ex207_1.tmp 2> runex207.err
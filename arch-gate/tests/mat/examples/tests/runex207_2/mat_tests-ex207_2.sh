@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex207   > ex207_2.tmp 2> runex207_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex208   > ex208_1.tmp 2> runex208.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex208 -mat_type baij  > ex208_baij_2.tmp 2> runex208_baij_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex20_1.out ex20_1.tmp > diff-runex20_1.out 2> diff-runex20_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex20 -conv_mat_type seqaij  > ex20_1.tmp 2> runex20_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex210_1.out ex210_1.tmp > diff-runex210_1.out 2> diff-runex210_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex210   > ex210_1.tmp 2> runex210_1.err
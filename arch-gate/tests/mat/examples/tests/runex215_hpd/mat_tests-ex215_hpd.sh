@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex215 -hpd_solve  > ex215_hpd.tmp 2> runex215_hpd.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex215.out ex215_ns.tmp > diff-runex215_ns.out 2> diff-runex215_ns.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex215.out ex215_sym.tmp > diff-runex215_sym.out 2> diff-runex215_sym.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex220 -f ${DATAFILESPATH}/matrices/small  > ex220_1.tmp 2> runex220_1.err
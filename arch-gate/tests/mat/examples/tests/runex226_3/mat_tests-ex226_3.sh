@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex226 -m 6 -n 6 -stencil 2d5point -matmatmult_via seqmpi  > ex226_3.tmp 2> runex226_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex227 -mat_null_space_test_view -mat_view  > ex227_no_prefix.tmp 2> runex227_no_prefix.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex227 -prefix_mat_null_space_test_view -with_prefix -prefix_mat_view  > ex227_prefix.tmp 2> runex227_prefix.err
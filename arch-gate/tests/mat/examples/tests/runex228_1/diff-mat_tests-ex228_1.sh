@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex228_1.out ex228_1.tmp > diff-runex228_1.out 2> diff-runex228_1.out
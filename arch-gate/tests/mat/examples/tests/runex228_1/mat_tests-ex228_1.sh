@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex228 -m 3 -n 4  > ex228_1.tmp 2> runex228_1.err
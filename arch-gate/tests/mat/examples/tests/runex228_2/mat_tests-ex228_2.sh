@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex228 -m 3 -n 4  > ex228_2.tmp 2> runex228_2.err
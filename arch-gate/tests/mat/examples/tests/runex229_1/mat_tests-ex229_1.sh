@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex229 -m 3 -n 3  > ex229_1.tmp 2> runex229_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex229_2.out ex229_2.tmp > diff-runex229_2.out 2> diff-runex229_2.out
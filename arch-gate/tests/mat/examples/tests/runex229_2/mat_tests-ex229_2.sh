@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex229 -m 3 -n 3  > ex229_2.tmp 2> runex229_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex230_1.out ex230_1.tmp > diff-runex230_1.out 2> diff-runex230_1.out
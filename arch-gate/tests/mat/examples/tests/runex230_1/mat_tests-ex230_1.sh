@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex230 -m 5 -n 6  > ex230_1.tmp 2> runex230_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex230_2.out ex230_2.tmp > diff-runex230_2.out 2> diff-runex230_2.out
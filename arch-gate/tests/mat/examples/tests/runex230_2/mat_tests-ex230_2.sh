@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex230 -m 5 -n 6  > ex230_2.tmp 2> runex230_2.err
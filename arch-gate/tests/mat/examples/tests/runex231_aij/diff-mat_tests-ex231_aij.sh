@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex231_aij.out ex231_aij.tmp > diff-runex231_aij.out 2> diff-runex231_aij.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex231 -mat_type aij  > ex231_aij.tmp 2> runex231_aij.err
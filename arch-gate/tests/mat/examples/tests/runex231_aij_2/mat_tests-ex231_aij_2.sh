@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex231 -mat_type aij  > ex231_aij_2.tmp 2> runex231_aij_2.err
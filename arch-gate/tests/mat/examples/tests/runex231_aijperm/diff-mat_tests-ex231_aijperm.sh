@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex231_aijperm.out ex231_aijperm.tmp > diff-runex231_aijperm.out 2> diff-runex231_aijperm.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex231 -mat_type aijperm  > ex231_aijperm.tmp 2> runex231_aijperm.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex231 -mat_type sell  > ex231_sell.tmp 2> runex231_sell.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex231 -mat_type sell  > ex231_sell_2.tmp 2> runex231_sell_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex231 -mat_type sell -mat_sell_kernel avx2  > ex231_sell_avx2.tmp 2> runex231_sell_avx2.err
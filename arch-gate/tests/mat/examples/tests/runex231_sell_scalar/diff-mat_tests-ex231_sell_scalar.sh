@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex231_sell.out ex231_sell_scalar.tmp > diff-runex231_sell_scalar.out 2> diff-runex231_sell_scalar.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex231 -mat_type sell -mat_sell_kernel scalar  > ex231_sell_scalar.tmp 2> runex231_sell_scalar.err
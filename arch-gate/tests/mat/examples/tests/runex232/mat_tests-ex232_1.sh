@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex232   > ex232_1.tmp 2> runex232.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex232 -matptap_reuse_symbolic -info  2>&1 | cat > ex232_1.tmp
+cat ex232_1.tmp | grep -e "^[a-z]" -e "^\[0\] MatPtAP(): Reusing the symbolic" > ex232_1.tmp.tmp 2>> runex232_1.err && mv ex232_1.tmp.tmp ex232_1.tmp
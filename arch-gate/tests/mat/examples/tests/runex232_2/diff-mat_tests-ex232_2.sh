@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex232_1.out ex232_2.tmp > diff-runex232_2.out 2> diff-runex232_2.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex232 -matptap_reuse_symbolic -info  2>&1 | cat > ex232_2.tmp
+cat ex232_2.tmp | grep -e "^[a-z]" -e "^\[0\] MatPtAP(): Reusing the symbolic" > ex232_2.tmp.tmp 2>> runex232_2.err && mv ex232_2.tmp.tmp ex232_2.tmp
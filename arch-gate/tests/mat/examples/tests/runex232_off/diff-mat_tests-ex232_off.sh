@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex232_off.out ex232_off.tmp > diff-runex232_off.out 2> diff-runex232_off.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex232 -info  2>&1 | cat > ex232_off.tmp
+cat ex232_off.tmp | grep -e "^[a-z]" -e "^\[0\] MatPtAP(): Reusing the symbolic" > ex232_off.tmp.tmp 2>> runex232_off.err && mv ex232_off.tmp.tmp ex232_off.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex232_1.out ex232_scalable.tmp > diff-runex232_scalable.out 2> diff-runex232_scalable.out
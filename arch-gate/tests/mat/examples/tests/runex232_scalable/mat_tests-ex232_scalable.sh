@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex232 -matptap_reuse_symbolic -matptap_via scalable -info  2>&1 | cat > ex232_scalable.tmp
+cat ex232_scalable.tmp | grep -e "^[a-z]" -e "^\[0\] MatPtAP(): Reusing the symbolic" > ex232_scalable.tmp.tmp 2>> runex232_scalable.err && mv ex232_scalable.tmp.tmp ex232_scalable.tmp
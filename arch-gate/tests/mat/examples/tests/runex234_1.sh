@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex234'
+testname='runex234_1'
+label='mat_tests-ex234_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogfile=/root/repo/arch-gate/tests/examples_${petsc_arch}.log
+config_dir='/root/repo/config'
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args=''
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec --oversubscribe"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1}
+mat_sell_sigma_in=${mat_sell_sigma:-0 8 32}
+mat_sell_slice_height_in=${mat_sell_slice_height:-4 8}
+mat_sell_kernel_in=${mat_sell_kernel:-auto scalar}
+
+
+for nsize in ${nsize_in}; do
+   for mat_sell_sigma in ${mat_sell_sigma_in}; do
+      for mat_sell_slice_height in ${mat_sell_slice_height_in}; do
+         for mat_sell_kernel in ${mat_sell_kernel_in}; do
+
+            petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -mat_sell_sigma ${mat_sell_sigma} -mat_sell_slice_height ${mat_sell_slice_height} -mat_sell_kernel ${mat_sell_kernel}" ex234_1.tmp ${testname}.err "${label}_mat_sell_sigma-${mat_sell_sigma}_mat_sell_slice_height-${mat_sell_slice_height}_mat_sell_kernel-${mat_sell_kernel}" 
+            res=$?
+
+            if test $res = 0; then
+               petsc_testrun "${diff_exe} /root/repo/src/mat/examples/tests/output/ex234_1.out ex234_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label}_mat_sell_sigma-${mat_sell_sigma}_mat_sell_slice_height-${mat_sell_slice_height}_mat_sell_kernel-${mat_sell_kernel} ""
+            else
+               printf "ok ${label} # SKIP Command failed so no diff\n"
+            fi
+
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
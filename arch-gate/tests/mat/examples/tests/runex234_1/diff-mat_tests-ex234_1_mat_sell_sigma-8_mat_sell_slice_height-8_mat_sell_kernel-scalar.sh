@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex234_1.out ex234_1.tmp > diff-runex234_1.out 2> diff-runex234_1.out
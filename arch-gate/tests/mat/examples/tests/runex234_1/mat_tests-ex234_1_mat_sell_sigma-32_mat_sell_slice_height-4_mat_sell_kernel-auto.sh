@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex234   -mat_sell_sigma 32 -mat_sell_slice_height 4 -mat_sell_kernel auto > ex234_1.tmp 2> runex234_1.err
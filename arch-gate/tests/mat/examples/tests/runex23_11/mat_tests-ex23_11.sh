@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex23 -m 12 -n 17 -test_trans -nr 2 -nc 3 -permmap  > ex23_11.tmp 2> runex23_11.err
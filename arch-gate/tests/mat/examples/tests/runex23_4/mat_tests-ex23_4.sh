@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 6 ../ex23 -m 9 -n 12 -test_trans -nr 2 -nc 7  > ex23_4.tmp 2> runex23_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex23_5.out ex23_5.tmp > diff-runex23_5.out 2> diff-runex23_5.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 6 ../ex23 -m 12 -n 12 -test_trans -nr 3 -nc 1  > ex23_5.tmp 2> runex23_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex23_9.out ex23_9.tmp > diff-runex23_9.out 2> diff-runex23_9.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex23 -m 12 -n 17 -test_trans -nr 2 -nc 3 -diffmap -permmap -matis_localmat_type baij  2>&1 | cat > ex23_baij.tmp
+cat ex23_baij.tmp | grep -v "type:" > ex23_baij.tmp.tmp 2>> runex23_baij.err && mv ex23_baij.tmp.tmp ex23_baij.tmp
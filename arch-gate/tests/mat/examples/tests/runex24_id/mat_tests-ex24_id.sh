@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex24 -mat_coloring_type id  > ex24_id.tmp 2> runex24_id.err
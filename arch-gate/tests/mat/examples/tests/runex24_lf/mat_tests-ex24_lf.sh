@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex24 -mat_coloring_type lf  > ex24_lf.tmp 2> runex24_lf.err
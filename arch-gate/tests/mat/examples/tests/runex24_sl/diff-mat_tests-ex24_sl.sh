@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex24_1.out ex24_sl.tmp > diff-runex24_sl.out 2> diff-runex24_sl.out
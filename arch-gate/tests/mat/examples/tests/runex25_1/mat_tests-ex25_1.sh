@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex25   > ex25_1.tmp 2> runex25_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex26 -bs 2  > ex26_2.tmp 2> runex26_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex29   > ex29_1.tmp 2> runex29_1.err
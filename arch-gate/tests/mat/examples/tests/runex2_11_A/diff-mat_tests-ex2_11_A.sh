@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex2_11_A.out ex2_11_A.tmp > diff-runex2_11_A.out 2> diff-runex2_11_A.out
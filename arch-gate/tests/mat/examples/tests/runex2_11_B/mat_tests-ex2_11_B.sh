@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -mat_type seqaij -rectB  2>&1 | cat > ex2_11_B.tmp
+cat ex2_11_B.tmp | grep -v "Mat Object" > ex2_11_B.tmp.tmp 2>> runex2_11_B.err && mv ex2_11_B.tmp.tmp ex2_11_B.tmp
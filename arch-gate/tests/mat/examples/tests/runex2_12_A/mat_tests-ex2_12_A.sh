@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -mat_type seqdense -rectA  2>&1 | cat > ex2_12_A.tmp
+cat ex2_12_A.tmp | grep -v "Mat Object" > ex2_12_A.tmp.tmp 2>> runex2_12_A.err && mv ex2_12_A.tmp.tmp ex2_12_A.tmp
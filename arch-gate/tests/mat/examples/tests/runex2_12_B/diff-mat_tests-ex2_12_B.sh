@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex2_12_B.out ex2_12_B.tmp > diff-runex2_12_B.out 2> diff-runex2_12_B.out
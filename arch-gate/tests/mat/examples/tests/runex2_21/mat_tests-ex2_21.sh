@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -mat_type mpiaij  > ex2_21.tmp 2> runex2_21.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex2_22.out ex2_22.tmp > diff-runex2_22.out 2> diff-runex2_22.out
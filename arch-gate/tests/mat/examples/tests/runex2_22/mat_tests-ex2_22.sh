@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -mat_type mpidense  > ex2_22.tmp 2> runex2_22.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex2_23.out ex2_23.tmp > diff-runex2_23.out 2> diff-runex2_23.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex2 -mat_type mpiaij  2>&1 | cat > ex2_23.tmp
+cat ex2_23.tmp | grep -v type | grep -v "MPI processes" > ex2_23.tmp.tmp 2>> runex2_23.err && mv ex2_23.tmp.tmp ex2_23.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex2_24.out ex2_24.tmp > diff-runex2_24.out 2> diff-runex2_24.out
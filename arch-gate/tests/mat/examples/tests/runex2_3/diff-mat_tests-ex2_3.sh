@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex2_3.out ex2_3.tmp > diff-runex2_3.out 2> diff-runex2_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex2 -mat_type mpiaij -rectA  > ex2_3.tmp 2> runex2_3.err
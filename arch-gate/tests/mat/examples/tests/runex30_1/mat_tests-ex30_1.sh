@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex30 -mat_ordering -display_matrices -nox  2>&1 | cat > ex30_1.tmp
+cat ex30_1.tmp | grep -v "MPI processes" > ex30_1.tmp.tmp 2>> runex30_1.err && mv ex30_1.tmp.tmp ex30_1.tmp
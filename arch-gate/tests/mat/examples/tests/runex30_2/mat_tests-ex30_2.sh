@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex30 -mat_ordering -display_matrices -nox -lu  > ex30_2.tmp 2> runex30_2.err
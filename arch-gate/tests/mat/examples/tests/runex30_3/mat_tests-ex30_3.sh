@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex30 -mat_ordering -lu -triangular_solve  > ex30_3.tmp 2> runex30_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex30_4.out ex30_4.tmp > diff-runex30_4.out 2> diff-runex30_4.out
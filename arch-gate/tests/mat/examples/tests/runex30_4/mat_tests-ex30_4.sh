@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex30   > ex30_4.tmp 2> runex30_4.err
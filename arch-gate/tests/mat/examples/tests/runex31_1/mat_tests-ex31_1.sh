@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex31   2>&1 | cat > ex31_1.tmp
+cat ex31_1.tmp | grep -v "MPI processes" > ex31_1.tmp.tmp 2>> runex31_1.err && mv ex31_1.tmp.tmp ex31_1.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex37_1.out ex37_1.tmp > diff-runex37_1.out 2> diff-runex37_1.out
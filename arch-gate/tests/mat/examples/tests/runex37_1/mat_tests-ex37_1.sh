@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex37   2>&1 | cat > ex37_1.tmp
+cat ex37_1.tmp | grep -v "MPI processes" > ex37_1.tmp.tmp 2>> runex37_1.err && mv ex37_1.tmp.tmp ex37_1.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex37_2.out ex37_2.tmp > diff-runex37_2.out 2> diff-runex37_2.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex37   2>&1 | cat > ex37_2.tmp
+cat ex37_2.tmp | grep -v "MPI processes" > ex37_2.tmp.tmp 2>> runex37_2.err && mv ex37_2.tmp.tmp ex37_2.tmp
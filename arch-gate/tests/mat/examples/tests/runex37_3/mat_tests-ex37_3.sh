@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex37 -mat_type baij -mat_block_size 1  2>&1 | cat > ex37_3.tmp
+cat ex37_3.tmp | grep -v "MPI processes" > ex37_3.tmp.tmp 2>> runex37_3.err && mv ex37_3.tmp.tmp ex37_3.tmp
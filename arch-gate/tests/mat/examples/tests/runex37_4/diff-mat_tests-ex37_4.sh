@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex37_4.out ex37_4.tmp > diff-runex37_4.out 2> diff-runex37_4.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex37 -mat_type baij -mat_block_size 2  2>&1 | cat > ex37_4.tmp
+cat ex37_4.tmp | grep -v "MPI processes" > ex37_4.tmp.tmp 2>> runex37_4.err && mv ex37_4.tmp.tmp ex37_4.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex37_5.out ex37_5.tmp > diff-runex37_5.out 2> diff-runex37_5.out
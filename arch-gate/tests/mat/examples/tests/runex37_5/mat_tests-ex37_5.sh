@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex37 -mat_type baij -mat_block_size 1  2>&1 | cat > ex37_5.tmp
+cat ex37_5.tmp | grep -v "MPI processes" > ex37_5.tmp.tmp 2>> runex37_5.err && mv ex37_5.tmp.tmp ex37_5.tmp
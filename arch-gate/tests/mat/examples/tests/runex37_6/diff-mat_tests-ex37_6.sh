@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex37_6.out ex37_6.tmp > diff-runex37_6.out 2> diff-runex37_6.out
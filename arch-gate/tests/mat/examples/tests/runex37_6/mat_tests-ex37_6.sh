@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex37 -mat_type baij -mat_block_size 2  2>&1 | cat > ex37_6.tmp
+cat ex37_6.tmp | grep -v "MPI processes" > ex37_6.tmp.tmp 2>> runex37_6.err && mv ex37_6.tmp.tmp ex37_6.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex3   > ex3_1.tmp 2> runex3_1.err
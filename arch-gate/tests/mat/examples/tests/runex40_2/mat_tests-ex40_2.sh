@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex40 -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -mat_increase_overlap_scalable 1 -ov 2 -nd 7  > ex40_2.tmp 2> runex40_2.err
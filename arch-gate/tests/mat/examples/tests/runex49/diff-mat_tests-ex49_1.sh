@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex49_1.out ex49_1.tmp > diff-runex49.out 2> diff-runex49.out
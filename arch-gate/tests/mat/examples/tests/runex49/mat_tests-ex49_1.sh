@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex49   > ex49_1.tmp 2> runex49.err
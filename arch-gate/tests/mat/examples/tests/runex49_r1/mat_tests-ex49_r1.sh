@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex49 -rect1  > ex49_r1.tmp 2> runex49_r1.err
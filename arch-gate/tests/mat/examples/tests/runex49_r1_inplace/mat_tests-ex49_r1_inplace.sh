@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex49 -rect1 -in_place  > ex49_r1_inplace.tmp 2> runex49_r1_inplace.err
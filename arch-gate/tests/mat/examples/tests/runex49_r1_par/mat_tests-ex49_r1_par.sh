@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex49 -rect1  > ex49_r1_par.tmp 2> runex49_r1_par.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex4_2.out ex4_2.tmp > diff-runex4_2.out 2> diff-runex4_2.out
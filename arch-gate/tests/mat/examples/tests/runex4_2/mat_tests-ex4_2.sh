@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex4 -mat_type dense  > ex4_2.tmp 2> runex4_2.err
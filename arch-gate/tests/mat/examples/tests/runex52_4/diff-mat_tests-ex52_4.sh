@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex52_4.out ex52_4.tmp > diff-runex52_4.out 2> diff-runex52_4.out
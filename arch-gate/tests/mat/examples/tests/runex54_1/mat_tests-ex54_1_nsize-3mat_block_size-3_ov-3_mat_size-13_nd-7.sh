@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex54   -mat_block_size 3 -ov 3 -mat_size 13 -nd 7 > ex54_1.tmp 2> runex54_1.err
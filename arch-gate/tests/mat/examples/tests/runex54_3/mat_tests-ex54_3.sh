@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex54 -nd 2 -test_nd0  > ex54_3.tmp 2> runex54_3.err
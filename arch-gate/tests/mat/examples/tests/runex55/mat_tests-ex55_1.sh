@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex55   > ex55_1.tmp 2> runex55.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex56   2>&1 | cat > ex56_1.tmp
+cat ex56_1.tmp | grep -v "MPI processes" > ex56_1.tmp.tmp 2>> runex56_1.err && mv ex56_1.tmp.tmp ex56_1.tmp
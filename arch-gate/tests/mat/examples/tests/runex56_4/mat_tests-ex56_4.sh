@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex56 -ass_extern  2>&1 | cat > ex56_4.tmp
+cat ex56_4.tmp | grep -v "MPI processes" > ex56_4.tmp.tmp 2>> runex56_4.err && mv ex56_4.tmp.tmp ex56_4.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex56_5.out ex56_5.tmp > diff-runex56_5.out 2> diff-runex56_5.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex56 -ass_extern -zero_rows  2>&1 | cat > ex56_5.tmp
+cat ex56_5.tmp | grep -v "MPI processes" > ex56_5.tmp.tmp 2>> runex56_5.err && mv ex56_5.tmp.tmp ex56_5.tmp
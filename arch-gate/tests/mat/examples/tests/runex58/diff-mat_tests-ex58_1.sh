@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex58_1.out ex58_1.tmp > diff-runex58.out 2> diff-runex58.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59   > ex59_1.tmp 2> runex59.err
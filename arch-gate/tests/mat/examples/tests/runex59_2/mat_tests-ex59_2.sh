@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex59   > ex59_2.tmp 2> runex59_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex59_2_sbaij.out ex59_2_sbaij.tmp > diff-runex59_2_sbaij.out 2> diff-runex59_2_sbaij.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type seqaij -rectA  2>&1 | cat > ex5_11_A.tmp
+cat ex5_11_A.tmp | grep -v type > ex5_11_A.tmp.tmp 2>> runex5_11_A.err && mv ex5_11_A.tmp.tmp ex5_11_A.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex5_11_B.out ex5_11_B.tmp > diff-runex5_11_B.out 2> diff-runex5_11_B.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type seqaij -rectB  2>&1 | cat > ex5_11_B.tmp
+cat ex5_11_B.tmp | grep -v type > ex5_11_B.tmp.tmp 2>> runex5_11_B.err && mv ex5_11_B.tmp.tmp ex5_11_B.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type seqdense -rectB  > ex5_12_B.tmp 2> runex5_12_B.err
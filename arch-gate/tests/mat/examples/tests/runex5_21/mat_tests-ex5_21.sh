@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type mpiaij  2>&1 | cat > ex5_21.tmp
+cat ex5_21.tmp | grep -v type > ex5_21.tmp.tmp 2>> runex5_21.err && mv ex5_21.tmp.tmp ex5_21.tmp
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type mpiaij  2>&1 | cat > ex5_23.tmp
+cat ex5_23.tmp | grep -v type > ex5_23.tmp.tmp 2>> runex5_23.err && mv ex5_23.tmp.tmp ex5_23.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type mpidense  > ex5_24.tmp 2> runex5_24.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type mpiaij -test_diagonalscale  2>&1 | cat > ex5_31.tmp
+cat ex5_31.tmp | grep -v type > ex5_31.tmp.tmp 2>> runex5_31.err && mv ex5_31.tmp.tmp ex5_31.tmp
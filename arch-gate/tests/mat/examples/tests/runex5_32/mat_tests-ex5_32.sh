@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type mpibaij -test_diagonalscale  2>&1 | cat > ex5_32.tmp
+cat ex5_32.tmp | grep -v Mat_ > ex5_32.tmp.tmp 2>> runex5_32.err && mv ex5_32.tmp.tmp ex5_32.tmp
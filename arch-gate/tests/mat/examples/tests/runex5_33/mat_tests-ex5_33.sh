@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type mpiaij -test_diagonalscale  2>&1 | cat > ex5_33.tmp
+cat ex5_33.tmp | grep -v type > ex5_33.tmp.tmp 2>> runex5_33.err && mv ex5_33.tmp.tmp ex5_33.tmp
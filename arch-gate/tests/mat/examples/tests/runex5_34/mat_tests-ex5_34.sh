@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type mpibaij -test_diagonalscale  2>&1 | cat > ex5_34.tmp
+cat ex5_34.tmp | grep -v Mat_ > ex5_34.tmp.tmp 2>> runex5_34.err && mv ex5_34.tmp.tmp ex5_34.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type sell  > ex5_sell_2.tmp 2> runex5_sell_2.err
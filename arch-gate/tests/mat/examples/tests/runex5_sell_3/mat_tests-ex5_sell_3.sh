@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type sell -test_diagonalscale  > ex5_sell_3.tmp 2> runex5_sell_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type sell -test_diagonalscale  > ex5_sell_4.tmp 2> runex5_sell_4.err
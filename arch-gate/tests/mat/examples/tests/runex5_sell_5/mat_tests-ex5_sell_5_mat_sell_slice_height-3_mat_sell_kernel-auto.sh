@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mat_type sell  -mat_sell_slice_height 3 -mat_sell_kernel auto > ex5_sell_5.tmp 2> runex5_sell_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex5_53.out ex5_sell_6.tmp > diff-runex5_sell_6.out 2> diff-runex5_sell_6.out
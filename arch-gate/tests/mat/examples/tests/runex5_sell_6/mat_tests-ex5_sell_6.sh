@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex5 -mat_type sell -mat_sell_slice_height 4 -test_diagonalscale  > ex5_sell_6.tmp 2> runex5_sell_6.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex60 -col 7  > ex60_1.tmp 2> runex60_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex61_2.out ex61_2.tmp > diff-runex61_2.out 2> diff-runex61_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex68   > ex68_1.tmp 2> runex68_1.err
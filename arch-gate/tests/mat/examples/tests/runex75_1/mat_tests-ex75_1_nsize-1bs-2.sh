@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex75 -mat_ignore_lower_triangular  -bs 2 > ex75_1.tmp 2> runex75_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex76   -bs 7 > ex76_1.tmp 2> runex76_1.err
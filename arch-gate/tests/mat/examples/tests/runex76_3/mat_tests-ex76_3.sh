@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex76 -testaij  > ex76_3.tmp 2> runex76_3.err
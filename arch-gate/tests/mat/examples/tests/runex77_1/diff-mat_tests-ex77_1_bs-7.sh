@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex77_1.out ex77_1.tmp > diff-runex77_1.out 2> diff-runex77_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex77   -bs 2 > ex77_1.tmp 2> runex77_1.err
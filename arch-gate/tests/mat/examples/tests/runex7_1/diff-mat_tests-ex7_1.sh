@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex7_1.out ex7_1.tmp > diff-runex7_1.out 2> diff-runex7_1.out
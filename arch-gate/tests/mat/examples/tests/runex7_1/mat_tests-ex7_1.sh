@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex7   2>&1 | cat > ex7_1.tmp
+cat ex7_1.tmp | grep -v "MPI processes" > ex7_1.tmp.tmp 2>> runex7_1.err && mv ex7_1.tmp.tmp ex7_1.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex86   > ex86_1.tmp 2> runex86_1.err
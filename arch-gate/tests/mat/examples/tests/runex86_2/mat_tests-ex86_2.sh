@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex86 -mat_type baij  > ex86_2.tmp 2> runex86_2.err
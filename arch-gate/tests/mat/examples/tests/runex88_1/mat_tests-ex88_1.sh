@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex88   > ex88_1.tmp 2> runex88_1.err
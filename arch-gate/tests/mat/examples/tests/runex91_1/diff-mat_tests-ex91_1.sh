@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex91_1.out ex91_1.tmp > diff-runex91_1.out 2> diff-runex91_1.out
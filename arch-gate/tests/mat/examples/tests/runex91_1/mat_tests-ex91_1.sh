@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex91 -ov 2  > ex91_1.tmp 2> runex91_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex92 -test_overlap -test_submat  -ov 3 -mat_block_size 8 > ex92_1.tmp 2> runex92_1.err
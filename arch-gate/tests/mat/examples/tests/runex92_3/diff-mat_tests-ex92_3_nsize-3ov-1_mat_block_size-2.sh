@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex92_1.out ex92_3.tmp > diff-runex92_3.out 2> diff-runex92_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex92_1.out ex92_4.tmp > diff-runex92_4.out 2> diff-runex92_4.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex92 -test_submat -test_allcols  -ov 1 -mat_block_size 2 > ex92_4.tmp 2> runex92_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex93 -B_matmatmult_via nonscalable  > ex93_2.tmp 2> runex93_2.err
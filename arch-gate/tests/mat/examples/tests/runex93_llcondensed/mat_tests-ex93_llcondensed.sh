@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex93 -B_matmatmult_via llcondensed  > ex93_llcondensed.tmp 2> runex93_llcondensed.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex93 -B_matmatmult_via scalable_fast  > ex93_scalable_fast.tmp 2> runex93_scalable_fast.err
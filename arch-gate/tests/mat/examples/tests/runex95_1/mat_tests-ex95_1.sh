@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 3 ../ex95   2>&1 | cat > ex95_1.tmp
+cat ex95_1.tmp | grep -v "MPI processes" > ex95_1.tmp.tmp 2>> runex95_1.err && mv ex95_1.tmp.tmp ex95_1.tmp
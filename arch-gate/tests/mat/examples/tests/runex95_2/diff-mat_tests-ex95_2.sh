@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex95_2.out ex95_2.tmp > diff-runex95_2.out 2> diff-runex95_2.out
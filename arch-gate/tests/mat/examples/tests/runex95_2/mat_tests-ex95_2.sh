@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex95   2>&1 | cat > ex95_2.tmp
+cat ex95_2.tmp | grep -v "MPI processes" > ex95_2.tmp.tmp 2>> runex95_2.err && mv ex95_2.tmp.tmp ex95_2.tmp
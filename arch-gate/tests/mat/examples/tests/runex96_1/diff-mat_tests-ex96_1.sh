@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex96_1.out ex96_1.tmp > diff-runex96_1.out 2> diff-runex96_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex96 -Mx 10 -My 5 -Mz 10  > ex96_nonscalable.tmp 2> runex96_nonscalable.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex97_1.out ex97_1.tmp > diff-runex97_1.out 2> diff-runex97_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex97   > ex97_1.tmp 2> runex97_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex99   > ex99_1.tmp 2> runex99_1.err
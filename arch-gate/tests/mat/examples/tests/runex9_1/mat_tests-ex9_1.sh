@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex9 -view_info  > ex9_1.tmp 2> runex9_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex9_2.out ex9_2.tmp > diff-runex9_2.out 2> diff-runex9_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex9 -nsubcomms 2 -view_mat -psubcomm_type contiguous  > ex9_3.tmp 2> runex9_3.err
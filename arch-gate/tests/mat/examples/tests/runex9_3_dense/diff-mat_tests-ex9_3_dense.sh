@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex9_3_dense.out ex9_3_dense.tmp > diff-runex9_3_dense.out 2> diff-runex9_3_dense.out
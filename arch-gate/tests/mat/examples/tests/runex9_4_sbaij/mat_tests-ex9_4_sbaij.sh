@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex9 -mat_type sbaij -nsubcomms 2 -view_mat -psubcomm_type interlaced  > ex9_4_sbaij.tmp 2> runex9_4_sbaij.err
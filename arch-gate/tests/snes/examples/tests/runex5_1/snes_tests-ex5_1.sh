@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -snes_monitor_short -snes_view -ksp_monitor  > ex5_1.tmp 2> runex5_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 5 ../ex12 -run_type test -petscpartitioner_type simple -refinement_limit 0.0 -simplex 0 -interpolate -bc_type dirichlet -petscspace_degree 1 -dm_refine 1 -cells 2,2  > ex12_amr_0.tmp 2> runex12_amr_0.err
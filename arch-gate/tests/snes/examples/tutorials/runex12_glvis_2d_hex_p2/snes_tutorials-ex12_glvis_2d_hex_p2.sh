@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex12 -quiet -run_type test -interpolate 1 -bc_type dirichlet -petscspace_degree 2 -vec_view glvis: -simplex 0 -dm_refine 1  > ex12_glvis_2d_hex_p2.tmp 2> runex12_glvis_2d_hex_p2.err
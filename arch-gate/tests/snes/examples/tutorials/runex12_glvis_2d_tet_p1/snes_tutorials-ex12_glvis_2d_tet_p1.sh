@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex12 -quiet -run_type test -interpolate 1 -bc_type dirichlet -petscspace_degree 1 -vec_view glvis: -f ${wPETSC_DIR}/share/petsc/datafiles/meshes/square_periodic.msh  > ex12_glvis_2d_tet_p1.tmp 2> runex12_glvis_2d_tet_p1.err
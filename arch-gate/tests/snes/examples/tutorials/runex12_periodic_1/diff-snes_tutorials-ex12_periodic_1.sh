@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex12_periodic_1.out ex12_periodic_1.tmp > diff-runex12_periodic_1.out 2> diff-runex12_periodic_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex12 -quiet -run_type test -simplex 0 -x_periodicity periodic -y_periodicity periodic -vec_view vtk:test.vtu:vtk_vtu -interpolate 1 -petscspace_degree 1 -dm_refine 1  > ex12_periodic_1.tmp 2> runex12_periodic_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex12_quad_bddc.out ex12_quad_bddc.tmp > diff-runex12_quad_bddc.out 2> diff-runex12_quad_bddc.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 5 ../ex12 -run_type full -petscpartitioner_type simple -dm_refine 2 -bc_type dirichlet -interpolate 1 -petscspace_degree 2 -dm_mat_type is -pc_type bddc -ksp_type gmres -snes_monitor_short -ksp_monitor_short -snes_view -simplex 0 -petscspace_poly_tensor -pc_bddc_corner_selection -cells 3,3 -ksp_rtol 1.e-9 -pc_bddc_use_edges 0  2>&1 | cat > ex12_quad_bddc.tmp
+cat ex12_quad_bddc.tmp | sed -e "s/aijcusparse/aij/g" -e "s/aijviennacl/aij/g" -e "s/factorization: cusparse/factorization: petsc/g" > ex12_quad_bddc.tmp.tmp 2>> runex12_quad_bddc.err && mv ex12_quad_bddc.tmp.tmp ex12_quad_bddc.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex12_tensor_plex_2d.out ex12_tensor_plex_2d.tmp > diff-runex12_tensor_plex_2d.out 2> diff-runex12_tensor_plex_2d.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex12 -run_type test -refinement_limit 0.0 -simplex 0 -interpolate -bc_type dirichlet -petscspace_degree 1 -dm_refine_hierarchy 2 -cells 2,2  > ex12_tensor_plex_2d.tmp 2> runex12_tensor_plex_2d.err
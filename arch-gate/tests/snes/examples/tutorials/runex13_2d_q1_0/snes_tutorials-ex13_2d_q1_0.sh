@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex13 -simplex 0 -potential_petscspace_degree 1 -dm_refine 2 -convest_num_refine 3 -snes_convergence_estimate  > ex13_2d_q1_0.tmp 2> runex13_2d_q1_0.err
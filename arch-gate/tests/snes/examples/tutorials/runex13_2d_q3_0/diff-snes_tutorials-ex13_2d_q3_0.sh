@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex13_2d_q3_0.out ex13_2d_q3_0.tmp > diff-runex13_2d_q3_0.out 2> diff-runex13_2d_q3_0.out
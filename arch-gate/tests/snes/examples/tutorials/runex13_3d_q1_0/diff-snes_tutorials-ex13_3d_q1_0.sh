@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex13_3d_q1_0.out ex13_3d_q1_0.tmp > diff-runex13_3d_q1_0.out 2> diff-runex13_3d_q1_0.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex13 -dim 3 -simplex 0 -potential_petscspace_degree 2 -dm_refine 1 -convest_num_refine 2 -snes_convergence_estimate  > ex13_3d_q2_0.tmp 2> runex13_3d_q2_0.err
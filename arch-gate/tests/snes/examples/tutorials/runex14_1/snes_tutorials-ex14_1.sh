@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex14 -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex14_1.tmp 2> runex14_1.err
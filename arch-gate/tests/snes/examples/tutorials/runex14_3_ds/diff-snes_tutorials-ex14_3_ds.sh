@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex14_3_ds.out ex14_3_ds.tmp > diff-runex14_3_ds.out 2> diff-runex14_3_ds.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex14 -fdcoloring_local -fdcoloring -ksp_monitor_short -da_refine 1  > ex14_4.tmp 2> runex14_4.err
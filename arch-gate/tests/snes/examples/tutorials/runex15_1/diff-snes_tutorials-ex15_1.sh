@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex15_1.out ex15_1.tmp > diff-runex15_1.out 2> diff-runex15_1.out
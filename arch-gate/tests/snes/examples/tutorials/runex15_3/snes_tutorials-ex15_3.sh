@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex15 -snes_monitor_short -da_grid_x 20 -da_grid_y 20 -p 1.3 -lambda 1 -jtype PICARD -picard -precheck 1  > ex15_3.tmp 2> runex15_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex15_4.out ex15_4.tmp > diff-runex15_4.out 2> diff-runex15_4.out
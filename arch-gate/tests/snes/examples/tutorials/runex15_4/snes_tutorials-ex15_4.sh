@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex15 -snes_monitor_short -snes_type newtonls -npc_snes_type ngs -snes_npc_side left -da_grid_x 20 -da_grid_y 20 -p 1.3 -lambda 1 -ksp_monitor_short  > ex15_4.tmp 2> runex15_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex15 -snes_monitor_short -da_grid_x 20 -da_grid_y 20 -p 6.0 -lambda 0 -jtype NEWTON -snes_type ngmres -npc_snes_type newtonls -npc_snes_lag_jacobian 5 -npc_pc_type asm -npc_ksp_converged_reason -npc_snes_lag_jacobian_persists  > ex15_lag_jac.tmp 2> runex15_lag_jac.err
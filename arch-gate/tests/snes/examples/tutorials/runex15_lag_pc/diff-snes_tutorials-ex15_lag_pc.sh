@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex15_lag_pc.out ex15_lag_pc.tmp > diff-runex15_lag_pc.out 2> diff-runex15_lag_pc.out
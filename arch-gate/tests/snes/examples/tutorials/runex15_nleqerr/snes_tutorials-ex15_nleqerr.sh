@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex15 -snes_monitor_short -snes_type newtonls -da_grid_x 20 -da_grid_y 20 -p 1.3 -lambda 1 -snes_linesearch_monitor -pc_type lu -snes_linesearch_type nleqerr  > ex15_nleqerr.tmp 2> runex15_nleqerr.err
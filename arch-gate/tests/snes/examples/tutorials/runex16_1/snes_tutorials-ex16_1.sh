@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex16 -da_refine 2 -pc_type mg -rad 10.0 -young 10. -ploading 0.0 -loading -1. -mg_levels_ksp_max_it 2 -snes_monitor_short -ksp_monitor_short -snes_max_it 7  > ex16_1.tmp 2> runex16_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex16_3.out ex16_3.tmp > diff-runex16_3.out 2> diff-runex16_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex17 -sol_type elas_quad -simplex 0 -displacement_petscspace_degree 1 -dm_refine 1 -convest_num_refine 3 -snes_convergence_estimate  > ex17_2d_q1_quad_elas.tmp 2> runex17_2d_q1_quad_elas.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex17 -simplex 0 -displacement_petscspace_degree 2 -dm_refine 2 -dmsnes_check  > ex17_2d_q2_quad_vlap.tmp 2> runex17_2d_q2_quad_vlap.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex17_2d_q3_trig_elas.out ex17_2d_q3_trig_elas.tmp > diff-runex17_2d_q3_trig_elas.out 2> diff-runex17_2d_q3_trig_elas.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex17 -dim 3 -cells 2,2,2 -simplex 0 -displacement_petscspace_degree 1 -convest_num_refine 2 -snes_convergence_estimate  > ex17_3d_q1_quad_vlap.tmp 2> runex17_3d_q1_quad_vlap.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex17 -sol_type elas_quad -dim 3 -simplex 0 -displacement_petscspace_degree 2 -dm_refine 1 -dmsnes_check  > ex17_3d_q2_quad_elas.tmp 2> runex17_3d_q2_quad_elas.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex17 -dim 3 -simplex 0 -displacement_petscspace_degree 3 -dm_refine 0 -dmsnes_check  > ex17_3d_q3_quad_vlap.tmp 2> runex17_3d_q3_quad_vlap.err
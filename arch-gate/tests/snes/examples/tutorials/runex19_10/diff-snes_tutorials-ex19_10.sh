@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_10.out ex19_10.tmp > diff-runex19_10.out 2> diff-runex19_10.out
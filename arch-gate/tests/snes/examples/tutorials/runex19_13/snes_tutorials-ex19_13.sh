@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex19 -snes_monitor_short -ksp_monitor_short -pc_type fieldsplit -pc_fieldsplit_type multiplicative -snes_view -da_refine 1 -ksp_type fgmres -snes_mf_operator  > ex19_13.tmp 2> runex19_13.err
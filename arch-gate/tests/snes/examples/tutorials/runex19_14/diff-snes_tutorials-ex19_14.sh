@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_14.out ex19_14.tmp > diff-runex19_14.out 2> diff-runex19_14.out
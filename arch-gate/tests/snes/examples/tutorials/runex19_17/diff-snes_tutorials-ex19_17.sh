@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_17.out ex19_17.tmp > diff-runex19_17.out 2> diff-runex19_17.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -snes_monitor_short -ksp_pc_side right  > ex19_17.tmp 2> runex19_17.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_2.out ex19_2_bcols1.tmp > diff-runex19_2_bcols1.out 2> diff-runex19_2_bcols1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 3 -snes_converged_reason -pc_type mg -mat_fd_type ds -mat_fd_coloring_bcols 1> ex19_1.tmp 2>&1  > ex19_2_bcols1.tmp 2> runex19_2_bcols1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_6.out ex19_6.tmp > diff-runex19_6.out 2> diff-runex19_6.out
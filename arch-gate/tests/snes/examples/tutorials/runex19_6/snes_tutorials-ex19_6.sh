@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -snes_monitor_short -ksp_monitor_short -pc_type fieldsplit -snes_view -ksp_type fgmres -da_refine 1  > ex19_6.tmp 2> runex19_6.err
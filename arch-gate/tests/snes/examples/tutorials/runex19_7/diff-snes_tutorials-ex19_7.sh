@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_7.out ex19_7.tmp > diff-runex19_7.out 2> diff-runex19_7.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex19 -snes_monitor_short -ksp_monitor_short -pc_type fieldsplit -snes_view -da_refine 1 -ksp_type fgmres  > ex19_7.tmp 2> runex19_7.err
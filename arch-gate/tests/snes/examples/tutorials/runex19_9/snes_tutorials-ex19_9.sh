@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex19 -snes_monitor_short -ksp_monitor_short -pc_type fieldsplit -pc_fieldsplit_type multiplicative -snes_view -da_refine 1 -ksp_type fgmres  > ex19_9.tmp 2> runex19_9.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_aspin.out ex19_aspin.tmp > diff-runex19_aspin-0.out 2> diff-runex19_aspin-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_aspin_alt.out ex19_aspin.tmp > diff-runex19_aspin.out 2> diff-runex19_aspin.out
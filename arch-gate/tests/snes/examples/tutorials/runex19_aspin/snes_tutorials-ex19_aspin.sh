@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 3 -da_overlap 2 -snes_monitor_short -snes_type aspin -grashof 4e4 -lidvelocity 100 -ksp_monitor_short  > ex19_aspin.tmp 2> runex19_aspin.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_bcgsl.out ex19_bcgsl.tmp > diff-runex19_bcgsl.out 2> diff-runex19_bcgsl.out
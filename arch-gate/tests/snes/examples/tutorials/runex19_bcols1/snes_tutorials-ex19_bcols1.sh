@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex19 -da_refine 3 -snes_monitor_short -pc_type mg -ksp_type fgmres -pc_mg_type full -mat_fd_coloring_bcols 1  > ex19_bcols1.tmp 2> runex19_bcols1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 4 -ksp_type fgmres -pc_type bjacobi -pc_bjacobi_blocks 2 -sub_ksp_type gmres -sub_ksp_max_it 2 -sub_pc_type bjacobi -sub_sub_ksp_type preonly -sub_sub_pc_type ilu -snes_monitor_short  > ex19_bjacobi.tmp 2> runex19_bjacobi.err
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 2 -pc_type lu -ksp_type cgne -ksp_monitor_short -ksp_converged_reason -ksp_view -ksp_norm_type unpreconditioned  2>&1 | cat > ex19_cgne.tmp
+cat ex19_cgne.tmp | grep -v HERMITIAN > ex19_cgne.tmp.tmp 2>> runex19_cgne.err && mv ex19_cgne.tmp.tmp ex19_cgne.tmp
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 1 -ksp_monitor_short -ksp_type cgs  > ex19_cgs.tmp 2> runex19_cgs.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_composite_fieldsplit.out ex19_composite_fieldsplit.tmp > diff-runex19_composite_fieldsplit.out 2> diff-runex19_composite_fieldsplit.out
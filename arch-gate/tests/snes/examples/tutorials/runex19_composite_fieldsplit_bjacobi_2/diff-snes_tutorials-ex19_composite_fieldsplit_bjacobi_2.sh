@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_composite_fieldsplit_bjacobi_2.out ex19_composite_fieldsplit_bjacobi_2.tmp > diff-runex19_composite_fieldsplit_bjacobi_2.out 2> diff-runex19_composite_fieldsplit_bjacobi_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex19 -da_refine 3 -grashof 4e4 -lidvelocity 100 -snes_monitor_short -snes_type composite -snes_composite_type additiveoptimal -snes_composite_sneses ngs,newtonls -sub_0_snes_max_it 20 -sub_1_pc_type mg  > ex19_composite_gs_newton.tmp 2> runex19_composite_gs_newton.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_fas_full.out ex19_fas_full.tmp > diff-runex19_fas_full.out 2> diff-runex19_fas_full.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_2.out ex19_fdcoloring_ds.tmp > diff-runex19_fdcoloring_ds.out 2> diff-runex19_fdcoloring_ds.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 3 -snes_converged_reason -pc_type mg -mat_fd_type ds  > ex19_fdcoloring_ds.tmp 2> runex19_fdcoloring_ds.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_2.out ex19_fdcoloring_ds_baij.tmp > diff-runex19_fdcoloring_ds_baij.out 2> diff-runex19_fdcoloring_ds_baij.out
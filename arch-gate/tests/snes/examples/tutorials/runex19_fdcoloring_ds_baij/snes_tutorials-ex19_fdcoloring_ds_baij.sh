@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 3 -snes_converged_reason -pc_type mg -mat_fd_type ds -dm_mat_type baij  > ex19_fdcoloring_ds_baij.tmp 2> runex19_fdcoloring_ds_baij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 3 -snes_converged_reason -pc_type mg -mat_fd_type ds -mat_fd_coloring_bcols 1  > ex19_fdcoloring_ds_bcols1.tmp 2> runex19_fdcoloring_ds_bcols1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_fdcoloring_wp.out ex19_fdcoloring_wp.tmp > diff-runex19_fdcoloring_wp.out 2> diff-runex19_fdcoloring_wp.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 3 -snes_monitor_short -pc_type mg -dm_mat_type baij  > ex19_fdcoloring_wp_baij.tmp 2> runex19_fdcoloring_wp_baij.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 3 -snes_monitor_short -pc_type mg -mat_fd_coloring_bcols 1  > ex19_fdcoloring_wp_bcols1.tmp 2> runex19_fdcoloring_wp_bcols1.err
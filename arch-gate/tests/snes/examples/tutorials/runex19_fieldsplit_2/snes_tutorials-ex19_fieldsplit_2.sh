@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -ksp_type fgmres -pc_type fieldsplit -pc_fieldsplit_block_size 4 -pc_fieldsplit_type additive -pc_fieldsplit_0_fields 0,1,2 -pc_fieldsplit_1_fields 3 -snes_monitor_short -ksp_monitor_short  > ex19_fieldsplit_2.tmp 2> runex19_fieldsplit_2.err
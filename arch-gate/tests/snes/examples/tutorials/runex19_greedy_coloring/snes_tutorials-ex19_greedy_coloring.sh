@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex19 -da_refine 3 -snes_monitor_short -snes_fd_color -snes_fd_color_use_mat -mat_coloring_type greedy -mat_coloring_weight_type lf -mat_coloring_view> ex19_greedy_coloring.tmp 2>&1  > ex19_greedy_coloring.tmp 2> runex19_greedy_coloring.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_ibcgs.out ex19_ibcgs.tmp > diff-runex19_ibcgs.out 2> diff-runex19_ibcgs.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex19 -ksp_type ibcgs -ksp_monitor_short -da_refine 2 -snes_view  > ex19_ibcgs.tmp 2> runex19_ibcgs.err
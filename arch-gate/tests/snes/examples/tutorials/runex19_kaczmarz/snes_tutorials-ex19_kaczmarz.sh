@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex19 -pc_type kaczmarz -ksp_monitor_short -snes_monitor_short -snes_view  > ex19_kaczmarz.tmp 2> runex19_kaczmarz.err
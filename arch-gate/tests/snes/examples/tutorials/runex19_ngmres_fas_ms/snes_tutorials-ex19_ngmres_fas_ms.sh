@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex19 -snes_grid_sequence 2 -lidvelocity 200 -grashof 1e4 -snes_monitor_short -snes_view -snes_converged_reason -snes_type ngmres -npc_snes_type fas -npc_fas_coarse_snes_type newtonls -npc_fas_coarse_ksp_type preonly -npc_snes_max_it 1  > ex19_ngmres_fas_ms.tmp 2> runex19_ngmres_fas_ms.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_ngmres_nasm.out ex19_ngmres_nasm.tmp > diff-runex19_ngmres_nasm.out 2> diff-runex19_ngmres_nasm.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 4 -da_overlap 2 -snes_monitor_short -snes_type ngmres -snes_max_it 10 -npc_snes_type nasm -npc_snes_nasm_type basic -grashof 4e4 -lidvelocity 100  > ex19_ngmres_nasm.tmp 2> runex19_ngmres_nasm.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_ngs_fd.out ex19_ngs_fd.tmp > diff-runex19_ngs_fd.out 2> diff-runex19_ngs_fd.out
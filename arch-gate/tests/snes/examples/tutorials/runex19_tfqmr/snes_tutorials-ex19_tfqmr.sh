@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 1 -ksp_monitor_short -ksp_type tfqmr  > ex19_tfqmr.tmp 2> runex19_tfqmr.err
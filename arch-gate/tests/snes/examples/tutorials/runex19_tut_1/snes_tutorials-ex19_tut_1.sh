@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 5 -snes_monitor -ksp_monitor -snes_view  > ex19_tut_1.tmp 2> runex19_tut_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex19_tut_2.out ex19_tut_2.tmp > diff-runex19_tut_2.out 2> diff-runex19_tut_2.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 5 -snes_monitor -ksp_monitor -snes_view -pc_type mg  > ex19_tut_2.tmp 2> runex19_tut_2.err
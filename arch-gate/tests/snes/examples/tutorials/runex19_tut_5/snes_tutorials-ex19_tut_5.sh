@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex19 -da_refine 5 -log_view -pc_type mg  2>&1 | cat > ex19_tut_5.tmp
+cat ex19_tut_5.tmp | head -n 2 > ex19_tut_5.tmp.tmp 2>> runex19_tut_5.err && mv ex19_tut_5.tmp.tmp ex19_tut_5.tmp
@@ -0,0 +1 @@
+head -n 2 /root/repo/src/snes/examples/tutorials/output/ex19_tut_6.out | /root/repo/lib/petsc/bin/petscdiff  - ex19_tut_6.tmp > diff-runex19_tut_6.out 2> diff-runex19_tut_6.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 5 -log_view  2>&1 | cat > ex19_tut_6.tmp
+cat ex19_tut_6.tmp | head -n 2 > ex19_tut_6.tmp.tmp 2>> runex19_tut_6.err && mv ex19_tut_6.tmp.tmp ex19_tut_6.tmp
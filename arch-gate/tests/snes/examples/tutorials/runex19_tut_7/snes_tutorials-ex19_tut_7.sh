@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 4 ../ex19 -da_refine 5 -log_view -pc_type mg  2>&1 | cat > ex19_tut_7.tmp
+cat ex19_tut_7.tmp | head -n 2 > ex19_tut_7.tmp.tmp 2>> runex19_tut_7.err && mv ex19_tut_7.tmp.tmp ex19_tut_7.tmp
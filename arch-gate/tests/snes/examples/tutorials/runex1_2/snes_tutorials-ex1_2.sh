@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -snes_monitor_short  > ex1_2.tmp 2> runex1_2.err
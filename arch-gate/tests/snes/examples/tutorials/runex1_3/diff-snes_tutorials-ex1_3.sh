@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex1_1.out ex1_3.tmp > diff-runex1_3.out 2> diff-runex1_3.out
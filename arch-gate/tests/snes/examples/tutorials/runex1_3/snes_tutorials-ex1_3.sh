@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ksp_view_solution ascii:ex1_2_sol.tmp:ascii_matlab -snes_monitor_short  > ex1_3.tmp 2> runex1_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ksp_view_solution ascii:ex1_2_sol.tmp::append -snes_monitor_short  > ex1_4.tmp 2> runex1_4.err
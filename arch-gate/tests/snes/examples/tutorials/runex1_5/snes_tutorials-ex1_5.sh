@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ksp_view_solution ascii:ex1_2_sol.tmp:ascii_matlab:append -snes_monitor_short  > ex1_5.tmp 2> runex1_5.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex1 -ksp_view_solution ascii:ex1_2_sol.tmp:default:append -snes_monitor_short  > ex1_6.tmp 2> runex1_6.err
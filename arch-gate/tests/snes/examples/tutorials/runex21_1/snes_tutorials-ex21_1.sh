@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex21 -snes_linesearch_monitor -snes_mf -snes_monitor_short -nox -ksp_monitor_short -snes_converged_reason  > ex21_1.tmp 2> runex21_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex25 -pc_type mg -da_refine 1 -ksp_type fgmres  > ex25_1.tmp 2> runex25_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex25 -pc_type mg -da_refine 1 -ksp_type fgmres  > ex25_2.tmp 2> runex25_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex28 -u_da_grid_x 20 -snes_converged_reason -snes_monitor_short -problem_type 2  > ex28_2.tmp 2> runex28_2.err
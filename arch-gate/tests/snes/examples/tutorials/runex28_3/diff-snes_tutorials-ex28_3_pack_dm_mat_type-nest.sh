@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex28_3.out ex28_3.tmp > diff-runex28_3.out 2> diff-runex28_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -nox -snes_monitor_cancel -snes_monitor_short -snes_type newtontr -snes_view  > ex2_2.tmp 2> runex2_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex2_3.out ex2_3.tmp > diff-runex2_3.out 2> diff-runex2_3.out
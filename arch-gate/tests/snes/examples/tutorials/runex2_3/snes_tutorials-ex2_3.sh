@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex2 -nox -snes_monitor_cancel -snes_monitor_short -malloc no -snes_view -pc_type jacobi -ksp_gmres_cgs_refinement_type refine_always  > ex2_3.tmp 2> runex2_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex33 -snes_converged_reason -snes_monitor_short  > ex33_0.tmp 2> runex33_0.err
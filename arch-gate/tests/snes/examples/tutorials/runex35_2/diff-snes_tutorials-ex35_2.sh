@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex35_2.out ex35_2.tmp > diff-runex35_2.out 2> diff-runex35_2.out
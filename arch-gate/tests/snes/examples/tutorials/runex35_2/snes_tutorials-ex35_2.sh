@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -snes_monitor_short -ksp_monitor_short -ksp_type richardson -pc_type none -ksp_richardson_self_scale  > ex35_2.tmp 2> runex35_2.err
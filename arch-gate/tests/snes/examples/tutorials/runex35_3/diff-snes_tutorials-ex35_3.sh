@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex35_3.out ex35_3.tmp > diff-runex35_3.out 2> diff-runex35_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -snes_monitor_short -snes_type ngmres  > ex35_3.tmp 2> runex35_3.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -snes_monitor_short -ksp_type gmres -ksp_monitor_short -pc_type none  > ex35_4.tmp 2> runex35_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -snes_monitor_short -snes_type ncg  > ex35_5.tmp 2> runex35_5.err
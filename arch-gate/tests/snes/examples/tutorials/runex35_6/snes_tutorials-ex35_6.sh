@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -snes_monitor_short -ksp_type cg -ksp_monitor_short -pc_type none  > ex35_6.tmp 2> runex35_6.err
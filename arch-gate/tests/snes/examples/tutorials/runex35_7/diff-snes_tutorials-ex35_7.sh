@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex35_7.out ex35_7.tmp > diff-runex35_7.out 2> diff-runex35_7.out
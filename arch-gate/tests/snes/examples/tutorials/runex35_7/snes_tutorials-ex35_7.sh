@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -da_refine 2 -snes_monitor_short -pc_type mg -mg_levels_ksp_type richardson -mg_levels_pc_type none -mg_levels_ksp_monitor_short -mg_levels_ksp_richardson_self_scale -ksp_type richardson -ksp_monitor_short  > ex35_7.tmp 2> runex35_7.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex35_8.out ex35_8.tmp > diff-runex35_8.out 2> diff-runex35_8.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex35 -da_refine 2 -snes_monitor_short -snes_type fas -fas_levels_snes_monitor_short -fas_coarse_snes_type newtonls -fas_coarse_pc_type lu -fas_coarse_ksp_type preonly -snes_type fas -snes_rtol 1.e-5  > ex35_8.tmp 2> runex35_8.err
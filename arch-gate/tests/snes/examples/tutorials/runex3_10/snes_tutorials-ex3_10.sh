@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_jacobian_domain_error -snes_converged_reason -snes_type qn -snes_qn_scale_type jacobian -snes_check_jacobian_domain_error 1  > ex3_10.tmp 2> runex3_10.err
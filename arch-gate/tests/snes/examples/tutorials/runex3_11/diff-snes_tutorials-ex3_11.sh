@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex3_11.out ex3_11.tmp > diff-runex3_11.out 2> diff-runex3_11.out
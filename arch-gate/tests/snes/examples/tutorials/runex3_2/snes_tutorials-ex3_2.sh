@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 3 ../ex3 -nox -pc_type asm -mat_type mpiaij -snes_monitor_cancel -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex3_2.tmp 2> runex3_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex3 -nox -snes_monitor_cancel -snes_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex3_3.tmp 2> runex3_3.err
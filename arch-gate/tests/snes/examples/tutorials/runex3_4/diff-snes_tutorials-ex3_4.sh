@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex3_4.out ex3_4.tmp > diff-runex3_4.out 2> diff-runex3_4.out
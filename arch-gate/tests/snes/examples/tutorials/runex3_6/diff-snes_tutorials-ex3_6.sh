@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex3_6.out ex3_6.tmp > diff-runex3_6.out 2> diff-runex3_6.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_jacobian_domain_error -snes_converged_reason -snes_check_jacobian_domain_error 1  > ex3_6.tmp 2> runex3_6.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_jacobian_domain_error -snes_converged_reason -snes_type newtontr -snes_check_jacobian_domain_error 1  > ex3_7.tmp 2> runex3_7.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex3 -test_jacobian_domain_error -snes_converged_reason -snes_type vinewtonrsls -snes_check_jacobian_domain_error 1  > ex3_8.tmp 2> runex3_8.err
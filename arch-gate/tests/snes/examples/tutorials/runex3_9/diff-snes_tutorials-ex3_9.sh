@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex3_9.out ex3_9.tmp > diff-runex3_9.out 2> diff-runex3_9.out
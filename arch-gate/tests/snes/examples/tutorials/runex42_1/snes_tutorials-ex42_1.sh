@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex42 -snes_monitor_short -snes_max_it 1000  > ex42_1.tmp 2> runex42_1.err
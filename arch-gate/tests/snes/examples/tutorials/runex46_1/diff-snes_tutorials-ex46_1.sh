@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex46_1.out ex46_1.tmp > diff-runex46_1-0.out 2> diff-runex46_1-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex46_1_alt.out ex46_1.tmp > diff-runex46_1.out 2> diff-runex46_1.out
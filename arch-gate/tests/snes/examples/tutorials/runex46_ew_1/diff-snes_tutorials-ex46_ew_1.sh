@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex46_ew_1.out ex46_ew_1.tmp > diff-runex46_ew_1.out 2> diff-runex46_ew_1.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex46 -snes_monitor_short -ksp_converged_reason -da_grid_x 20 -da_grid_y 20 -snes_ksp_ew -snes_ksp_ew_version 2  > ex46_ew_2.tmp 2> runex46_ew_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex46 -K 3 -m 1 -D 0.2 -snes_monitor_short -snes_type ngmres -snes_npc_side right -npc_snes_type newtonls -npc_snes_linesearch_type basic -snes_ngmres_restart_it 2 -snes_ngmres_restart_fm_rise -snes_rtol 1.e-2 -snes_max_it 5  > ex46_fm_rise_4.tmp 2> runex46_fm_rise_4.err
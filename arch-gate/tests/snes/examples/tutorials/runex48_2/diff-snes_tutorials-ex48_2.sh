@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex48_2.out ex48_2.tmp > diff-runex48_2.out 2> diff-runex48_2.out
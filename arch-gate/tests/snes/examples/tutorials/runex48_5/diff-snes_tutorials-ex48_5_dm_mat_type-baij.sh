@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex48_5.out ex48_5.tmp > diff-runex48_5.out 2> diff-runex48_5.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex56_0.out ex56_0.tmp > diff-runex56_0.out 2> diff-runex56_0.out
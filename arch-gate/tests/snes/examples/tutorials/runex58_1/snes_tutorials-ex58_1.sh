@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex58 -snes_type vinewtonrsls -pc_type mg -ksp_monitor_short -pc_mg_galerkin pmat -da_refine 5 -snes_vi_monitor -pc_mg_type full -snes_max_it 100 -snes_converged_reason  > ex58_1.tmp 2> runex58_1.err
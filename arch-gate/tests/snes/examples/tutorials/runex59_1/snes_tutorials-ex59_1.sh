@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -n 14 -snes_monitor_short -snes_converged_reason  > ex59_1.tmp 2> runex59_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex59 -n 15 -snes_monitor_short -snes_converged_reason  > ex59_2.tmp 2> runex59_2.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -pc_type mg -ksp_converged_reason -snes_view -pc_mg_galerkin pmat -snes_grid_sequence 3 -mg_levels_ksp_norm_type unpreconditioned -snes_monitor_short -mg_levels_ksp_chebyshev_esteig 0.5,1.1 -mg_levels_pc_type sor -pc_mg_type full -ksp_atol -1.  > ex5_2.tmp 2> runex5_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_3.out ex5_3.tmp > diff-runex5_3.out 2> diff-runex5_3.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 2 ../ex5 -snes_grid_sequence 2 -snes_mf_operator -snes_converged_reason -snes_view -pc_type mg -snes_atol -1 -snes_rtol 1.e-2  2>&1 | cat > ex5_3.tmp
+cat ex5_3.tmp | grep -v "otal number of function evaluations" > ex5_3.tmp.tmp 2>> runex5_3.err && mv ex5_3.tmp.tmp ex5_3.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_4.out ex5_4.tmp > diff-runex5_4-0.out 2> diff-runex5_4-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_4_alt.out ex5_4.tmp > diff-runex5_4.out 2> diff-runex5_4.out
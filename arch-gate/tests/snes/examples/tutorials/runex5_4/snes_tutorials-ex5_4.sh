@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex5 -snes_grid_sequence 2 -snes_monitor_short -ksp_converged_reason -snes_converged_reason -snes_view -pc_type mg -snes_atol -1 -ksp_atol -1  > ex5_4.tmp 2> runex5_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_5_anderson.out ex5_5_anderson.tmp > diff-runex5_5_anderson.out 2> diff-runex5_5_anderson.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_5_broyden.out ex5_5_broyden.tmp > diff-runex5_5_broyden.out 2> diff-runex5_5_broyden.out
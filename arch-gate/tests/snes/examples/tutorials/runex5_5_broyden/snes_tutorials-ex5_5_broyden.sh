@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type qn -snes_qn_type broyden -snes_qn_m 10  > ex5_5_broyden.tmp 2> runex5_5_broyden.err
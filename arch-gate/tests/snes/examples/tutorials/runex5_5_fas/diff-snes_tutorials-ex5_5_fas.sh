@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_5_fas.out ex5_5_fas.tmp > diff-runex5_5_fas.out 2> diff-runex5_5_fas.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -fas_coarse_snes_max_it 1 -fas_coarse_pc_type lu -fas_coarse_ksp_type preonly -snes_monitor_short -snes_type fas -fas_coarse_ksp_type richardson -da_refine 6 -snes_fas_type additive -snes_max_it 50  > ex5_5_fas_additive.tmp 2> runex5_5_fas_additive.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -da_refine 1 -snes_type fas -snes_fas_monitor  > ex5_5_fas_monitor.tmp 2> runex5_5_fas_monitor.err
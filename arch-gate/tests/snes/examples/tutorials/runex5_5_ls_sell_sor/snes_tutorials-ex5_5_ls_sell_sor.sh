@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -da_grid_x 81 -da_grid_y 81 -snes_monitor_short -snes_max_it 50 -par 6.0 -snes_type newtonls -dm_mat_type sell -pc_type sor  > ex5_5_ls_sell_sor.tmp 2> runex5_5_ls_sell_sor.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex5 -snes_monitor_short -snes_converged_reason -da_refine 4 -da_overlap 3 -snes_type nasm -snes_nasm_type restrict -snes_max_it 10  > ex5_5_nasm.tmp 2> runex5_5_nasm.err
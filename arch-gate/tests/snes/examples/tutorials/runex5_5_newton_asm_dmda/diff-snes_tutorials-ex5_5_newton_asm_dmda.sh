@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_5_newton_asm_dmda.out ex5_5_newton_asm_dmda.tmp > diff-runex5_5_newton_asm_dmda.out 2> diff-runex5_5_newton_asm_dmda.out
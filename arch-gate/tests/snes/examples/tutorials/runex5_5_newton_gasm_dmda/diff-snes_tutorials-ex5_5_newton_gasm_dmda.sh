@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_5_newton_gasm_dmda.out ex5_5_newton_gasm_dmda.tmp > diff-runex5_5_newton_gasm_dmda.out 2> diff-runex5_5_newton_gasm_dmda.out
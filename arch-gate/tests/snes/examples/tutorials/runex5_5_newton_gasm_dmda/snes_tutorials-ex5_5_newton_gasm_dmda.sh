@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex5 -snes_monitor_short -ksp_monitor_short -snes_converged_reason -da_refine 4 -da_overlap 3 -snes_type newtonls -pc_type gasm -malloc_dump  > ex5_5_newton_gasm_dmda.tmp 2> runex5_5_newton_gasm_dmda.err
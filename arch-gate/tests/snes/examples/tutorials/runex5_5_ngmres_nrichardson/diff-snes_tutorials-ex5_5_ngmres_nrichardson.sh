@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_5_ngmres_richardson.out ex5_5_ngmres_nrichardson.tmp > diff-runex5_5_ngmres_nrichardson.out 2> diff-runex5_5_ngmres_nrichardson.out
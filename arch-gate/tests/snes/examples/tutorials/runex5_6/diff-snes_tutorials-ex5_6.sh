@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_6.out ex5_6.tmp > diff-runex5_6-0.out 2> diff-runex5_6-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_6_alt.out ex5_6.tmp > diff-runex5_6.out 2> diff-runex5_6.out
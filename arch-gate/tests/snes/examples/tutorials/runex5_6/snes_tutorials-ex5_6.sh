@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 4 ../ex5 -snes_converged_reason -ksp_converged_reason -da_grid_x 129 -da_grid_y 129 -pc_type mg -pc_mg_levels 8 -mg_levels_ksp_type chebyshev -mg_levels_ksp_chebyshev_esteig 0,0.5,0,1.1 -mg_levels_ksp_max_it 2  > ex5_6.tmp 2> runex5_6.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex5 -mms 1 -par 0.0 -snes_monitor_short -snes_converged_reason -snes_view -ksp_rtol 1.0e-9 -ksp_monitor_short -ksp_type richardson -pc_type asm -pc_asm_blocks 2 -pc_asm_overlap 0 -pc_asm_local_type additive -sub_pc_type lu  > ex5_asm_0.tmp 2> runex5_asm_0.err
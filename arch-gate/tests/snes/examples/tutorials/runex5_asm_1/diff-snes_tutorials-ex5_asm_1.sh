@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_asm_1.out ex5_asm_1.tmp > diff-runex5_asm_1.out 2> diff-runex5_asm_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex5_msm_1.out ex5_msm_1.tmp > diff-runex5_msm_1.out 2> diff-runex5_msm_1.out
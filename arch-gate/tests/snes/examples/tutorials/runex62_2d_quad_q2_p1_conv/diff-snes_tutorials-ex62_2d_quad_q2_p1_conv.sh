@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex62_2d_quad_q2_p1_conv.out ex62_2d_quad_q2_p1_conv.tmp > diff-runex62_2d_quad_q2_p1_conv.out 2> diff-runex62_2d_quad_q2_p1_conv.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex62_bddc_quad.out ex62_bddc_quad.tmp > diff-runex62_bddc_quad.out 2> diff-runex62_bddc_quad.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex62_quad_q2q1_full.out ex62_quad_q2q1_full.tmp > diff-runex62_quad_q2q1_full.out 2> diff-runex62_quad_q2q1_full.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex69_q1p0.out ex69_q1p0.tmp > diff-runex69_q1p0.out 2> diff-runex69_q1p0.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex69_q2q1.out ex69_q2q1.tmp > diff-runex69_q2q1.out 2> diff-runex69_q2q1.out
@@ -0,0 +1,2 @@
+mpiexec --oversubscribe  -n 1 ../ex69 -dm_plex_separate_marker -simplex 0 -vel_petscspace_degree 2 -pres_petscspace_degree 1 -pc_fieldsplit_diag_use_amat -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_factorization_type full -pc_fieldsplit_schur_precondition a11 -fieldsplit_velocity_pc_type lu -fieldsplit_pressure_pc_type lu -snes_error_if_not_converged -snes_view -ksp_error_if_not_converged -dm_view  2>&1 | cat > ex69_q2q1.tmp
+cat ex69_q2q1.tmp | sed  -e "s/SNES iterations *= *[123]/SNES iterations=4/g" -e "s/solver iterations *= *[123]/solver iterations=4/g" -e "s/evaluations=2/evaluations=3/g" > ex69_q2q1.tmp.tmp 2>> runex69_q2q1.err && mv ex69_q2q1.tmp.tmp ex69_q2q1.tmp
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex69_q2q1ref.out ex69_q2q1ref.tmp > diff-runex69_q2q1ref.out 2> diff-runex69_q2q1ref.out
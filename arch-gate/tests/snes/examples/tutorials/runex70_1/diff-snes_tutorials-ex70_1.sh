@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex70_1.out ex70_1.tmp > diff-runex70_1.out 2> diff-runex70_1.out
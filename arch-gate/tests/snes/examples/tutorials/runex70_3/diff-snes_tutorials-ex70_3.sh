@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex70_3.out ex70_3.tmp > diff-runex70_3.out 2> diff-runex70_3.out
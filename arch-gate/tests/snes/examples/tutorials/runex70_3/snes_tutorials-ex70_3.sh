@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex70 -nx 16 -ny 24 -ksp_type fgmres -pc_type fieldsplit -pc_fieldsplit_type schur -pc_fieldsplit_schur_fact_type lower -user_pc  > ex70_3.tmp 2> runex70_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex70_4_pcksp.out ex70_4_pcksp.tmp > diff-runex70_4_pcksp.out 2> diff-runex70_4_pcksp.out
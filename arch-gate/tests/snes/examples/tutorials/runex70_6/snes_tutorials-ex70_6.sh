@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex70 -nx 4 -ny 8 -mat_set_symmetric -ksp_type preonly -pc_type fieldsplit -pc_fieldsplit_type gkb -fieldsplit_0_ksp_type cg -fieldsplit_0_pc_type jacobi -fieldsplit_0_ksp_rtol 1e-10  > ex70_6.tmp 2> runex70_6.err
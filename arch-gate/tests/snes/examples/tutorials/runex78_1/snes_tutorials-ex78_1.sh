@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex78 -snes_monitor_short -ksp_monitor_short -pc_type sor -snes_converged_reason -da_refine 3  > ex78_1.tmp 2> runex78_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex99 -snes_linesearch_type cp  > ex99_1.tmp 2> runex99_1.err
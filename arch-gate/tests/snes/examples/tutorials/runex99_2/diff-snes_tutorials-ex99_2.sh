@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex99_2.out ex99_2.tmp > diff-runex99_2.out 2> diff-runex99_2.out
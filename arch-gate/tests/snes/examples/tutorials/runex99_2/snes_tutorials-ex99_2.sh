@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex99 -snes_linesearch_type basic  > ex99_2.tmp 2> runex99_2.err
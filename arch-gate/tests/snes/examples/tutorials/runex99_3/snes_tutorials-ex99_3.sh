@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex99   > ex99_3.tmp 2> runex99_3.err
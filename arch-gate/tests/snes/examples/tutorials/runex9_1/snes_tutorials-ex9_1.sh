@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex9 -da_refine 1 -snes_monitor_short -snes_type vinewtonrsls  > ex9_1.tmp 2> runex9_1.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 2 ../ex9 -da_refine 1 -snes_monitor_short -snes_type vinewtonssls  > ex9_2.tmp 2> runex9_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex9_3.out ex9_3.tmp > diff-runex9_3.out 2> diff-runex9_3.out
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex9 -mat_is_symmetric  > ex9_4.tmp 2> runex9_4.err
@@ -0,0 +1 @@
+mpiexec --oversubscribe  -n 1 ../ex9 -ksp_converged_reason -snes_fd_color  > ex9_5.tmp 2> runex9_5.err